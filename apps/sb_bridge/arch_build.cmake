@@ -0,0 +1,32 @@
+###########################################################
+#
+# SB_BRIDGE platform build setup
+#
+# This file is evaluated as part of the "prepare" stage
+# and can be used to set up prerequisites for the build,
+# such as generating header files
+#
+###########################################################
+
+# The list of header files that control the SB_BRIDGE configuration
+set(SB_BRIDGE_PLATFORM_CONFIG_FILE_LIST
+  sb_bridge_platform_cfg.h
+  sb_bridge_perfids.h
+  sb_bridge_tbl.h
+)
+
+# Create wrappers around the all the config header files
+# This makes them individually overridable by the missions, without modifying
+# the distribution default copies
+foreach(SB_BRIDGE_CFGFILE ${SB_BRIDGE_PLATFORM_CONFIG_FILE_LIST})
+  get_filename_component(CFGKEY "${SB_BRIDGE_CFGFILE}" NAME_WE)
+  if (DEFINED SB_BRIDGE_CFGFILE_SRC_${CFGKEY})
+    set(DEFAULT_SOURCE GENERATED_FILE "${SB_BRIDGE_CFGFILE_SRC_${CFGKEY}}")
+  else()
+    set(DEFAULT_SOURCE FALLBACK_FILE "${CMAKE_CURRENT_LIST_DIR}/config/default_${SB_BRIDGE_CFGFILE}")
+  endif()
+  generate_config_includefile(
+    FILE_NAME           "${SB_BRIDGE_CFGFILE}"
+    ${DEFAULT_SOURCE}
+  )
+endforeach()
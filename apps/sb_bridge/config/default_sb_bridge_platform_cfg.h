@@ -0,0 +1,94 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * SB Bridge Application Platform Configuration Header File
+ *
+ * All cFS instances attached to the same shared memory object must be
+ * built with the same SB_BRIDGE_MAX_PEERS and SB_BRIDGE_RING_SIZE.  The
+ * object name and the instances to exchange messages with are set in the
+ * configuration table, see sb_bridge_tbl.h.
+ */
+#ifndef SB_BRIDGE_PLATFORM_CFG_H
+#define SB_BRIDGE_PLATFORM_CFG_H
+
+/**
+ * \brief Number of instances one shared memory object can link
+ *
+ * The object holds one ring for each ordered pair of instances, so its
+ * size grows with the square of this value.  Between 2 and 32.
+ */
+#define SB_BRIDGE_MAX_PEERS 4
+
+/**
+ * \brief Size in bytes of the message ring between two instances, in each direction
+ *
+ * Must be a power of two.  Messages that do not fit in the free space of
+ * the ring when forwarded are dropped and counted.
+ */
+#define SB_BRIDGE_RING_SIZE (256 * 1024)
+
+/**
+ * \brief Size of the shared memory object name in the configuration table, including the terminator
+ */
+#define SB_BRIDGE_SEGMENT_NAME_LEN 64
+
+/**
+ * \brief Number of 10 ms polls to wait for another instance to finish
+ * setting up the shared memory object
+ */
+#define SB_BRIDGE_ATTACH_RETRIES 100
+
+/**
+ * \brief Depth and name of the pipe carrying messages to be forwarded
+ */
+#define SB_BRIDGE_PIPE_DEPTH 64
+#define SB_BRIDGE_PIPE_NAME  "SB_BRIDGE_PIPE"
+
+/**
+ * \brief Message limit used for subscriptions made on behalf of the peers
+ */
+#define SB_BRIDGE_MSG_LIM 16
+
+/**
+ * \brief Maximum number of distinct MsgIds the peers together may subscribe to
+ */
+#define SB_BRIDGE_MAX_PEER_SUBS 256
+
+/**
+ * \brief Pipe receive timeout, in milliseconds
+ *
+ * Bounds how long a failed subscription forward waits to be retried.
+ */
+#define SB_BRIDGE_RCV_TIMEOUT 1000
+
+/**
+ * \brief Receive task doorbell wait timeout, in milliseconds
+ */
+#define SB_BRIDGE_RX_WAIT_MSEC 1000
+
+/**
+ * \brief Receive task name, stack size and priority
+ */
+#define SB_BRIDGE_RX_TASK_NAME       "SB_BRIDGE_RX"
+#define SB_BRIDGE_RX_TASK_STACK_SIZE 16384
+#define SB_BRIDGE_RX_TASK_PRIORITY   60
+
+#endif
@@ -0,0 +1,57 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Specification for the SB_BRIDGE configuration table
+ *
+ * The table is read once when the bridge starts; a new load takes effect
+ * at the next application restart.
+ */
+#ifndef SB_BRIDGE_TBL_H
+#define SB_BRIDGE_TBL_H
+
+#include "common_types.h"
+
+#include "sb_bridge_platform_cfg.h"
+
+typedef struct
+{
+    /** \brief Name of the POSIX shared memory object, starting with '/' */
+    char SegmentName[SB_BRIDGE_SEGMENT_NAME_LEN];
+
+    /**
+     * \brief Number of entries used in PeerIds
+     *
+     * Zero exchanges messages with every instance attached to the object.
+     */
+    uint32 NumPeers;
+
+    /**
+     * \brief Processor IDs of the instances to exchange messages with
+     *
+     * Records from other instances are discarded.  Messages are not relayed,
+     * so two instances only see each other's messages if they list each other.
+     */
+    uint32 PeerIds[SB_BRIDGE_MAX_PEERS - 1];
+} SB_BRIDGE_ConfigTable_t;
+
+/* Define filenames of default data images for tables */
+#define SB_BRIDGE_CONFIG_TABLE_FILE "/cf/sb_bridge_cfg.tbl"
+
+#endif
@@ -0,0 +1,46 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Define SB Bridge Event messages
+ */
+#ifndef SB_BRIDGE_EVENTIDS_H
+#define SB_BRIDGE_EVENTIDS_H
+
+/*****************************************************************************/
+
+/* Event message ID's */
+#define SB_BRIDGE_EVM_RESERVED 0
+
+#define SB_BRIDGE_INIT_INF_EID      1
+#define SB_BRIDGE_SHM_ERR_EID       2
+#define SB_BRIDGE_CR_PIPE_ERR_EID   3
+#define SB_BRIDGE_SUBSCRIBE_ERR_EID 4
+#define SB_BRIDGE_RCV_ERR_EID       5
+#define SB_BRIDGE_TASK_ERR_EID      6
+#define SB_BRIDGE_TX_STALL_ERR_EID  7
+#define SB_BRIDGE_TX_RESUME_INF_EID 8
+#define SB_BRIDGE_RX_ERR_EID        9
+#define SB_BRIDGE_PEER_SUB_DBG_EID  10
+#define SB_BRIDGE_PEER_FULL_ERR_EID 11
+#define SB_BRIDGE_TBL_ERR_EID       12
+
+/******************************************************************************/
+
+#endif
@@ -0,0 +1,674 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *  This file contains the source code for the SB Bridge application
+ */
+
+#include "cfe.h"
+#include "cfe_psp.h"
+#include "cfe_sb_fcncodes.h"
+#include "cfe_sb_msg.h"
+#include "cfe_sb_msgids.h"
+
+#include "sb_bridge_app.h"
+#include "sb_bridge_eventids.h"
+#include "sb_bridge_perfids.h"
+
+#include <string.h>
+
+/*
+** SB Bridge Global Data Section
+*/
+SB_BRIDGE_Data_t SB_BRIDGE_Data;
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                   */
+/* SB_BRIDGE_AppMain() -- Application entry point and main process loop */
+/*                                                                   */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SB_BRIDGE_AppMain(void)
+{
+    uint32           RunStatus = CFE_ES_RunStatus_APP_RUN;
+    CFE_Status_t     status;
+    CFE_SB_Buffer_t *BufPtr;
+
+    CFE_ES_PerfLogEntry(SB_BRIDGE_MAIN_TASK_PERF_ID);
+
+    status = SB_BRIDGE_Init();
+
+    if (status != CFE_SUCCESS)
+    {
+        RunStatus = CFE_ES_RunStatus_APP_ERROR;
+    }
+
+    while (CFE_ES_RunLoop(&RunStatus) == true)
+    {
+        CFE_ES_PerfLogExit(SB_BRIDGE_MAIN_TASK_PERF_ID);
+
+        status = CFE_SB_ReceiveBuffer(&BufPtr, SB_BRIDGE_Data.DataPipe, SB_BRIDGE_RCV_TIMEOUT);
+
+        CFE_ES_PerfLogEntry(SB_BRIDGE_MAIN_TASK_PERF_ID);
+
+        if (status == CFE_SUCCESS)
+        {
+            SB_BRIDGE_ProcessLocal(BufPtr);
+        }
+        else if (status != CFE_SB_TIME_OUT)
+        {
+            CFE_EVS_SendEvent(SB_BRIDGE_RCV_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "SB_BRIDGE: Pipe read error, RC = 0x%08X", (unsigned int)status);
+            RunStatus = CFE_ES_RunStatus_APP_ERROR;
+        }
+
+        /* A subscription report did not fit in the ring, send them all again */
+        if (SB_BRIDGE_Data.ResyncPending && SB_BRIDGE_Data.TxStalled == 0)
+        {
+            SB_BRIDGE_Data.ResyncPending = false;
+            SB_BRIDGE_SendSubRptCmd(CFE_SB_SEND_PREV_SUBS_CC);
+        }
+    }
+
+    CFE_ES_PerfLogExit(SB_BRIDGE_MAIN_TASK_PERF_ID);
+
+    if (CFE_RESOURCEID_TEST_DEFINED(SB_BRIDGE_Data.RxTaskId))
+    {
+        CFE_ES_DeleteChildTask(SB_BRIDGE_Data.RxTaskId);
+    }
+    SB_BRIDGE_LinkClose(&SB_BRIDGE_Data.Link);
+
+    CFE_ES_ExitApp(RunStatus);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper: true if the instance in link slot Slot is one this
+ * bridge exchanges messages with
+ *
+ *-----------------------------------------------------------------*/
+static bool SB_BRIDGE_IsPeer(uint32 Slot)
+{
+    uint32 ProcessorId;
+    uint32 i;
+
+    if (!SB_BRIDGE_LinkGetPeer(&SB_BRIDGE_Data.Link, Slot, &ProcessorId))
+    {
+        return false;
+    }
+
+    if (SB_BRIDGE_Data.Config.NumPeers == 0)
+    {
+        return true;
+    }
+
+    for (i = 0; i < SB_BRIDGE_Data.Config.NumPeers; ++i)
+    {
+        if (SB_BRIDGE_Data.Config.PeerIds[i] == ProcessorId)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper: queue a record for every peer
+ *
+ * \returns false if it did not fit in the ring of at least one of them
+ *
+ *-----------------------------------------------------------------*/
+static bool SB_BRIDGE_Broadcast(uint16 Type, const void *Data, size_t Length)
+{
+    bool   AllQueued = true;
+    uint32 Slot;
+
+    for (Slot = 0; Slot < SB_BRIDGE_MAX_PEERS; ++Slot)
+    {
+        if (SB_BRIDGE_IsPeer(Slot) && !SB_BRIDGE_LinkPut(&SB_BRIDGE_Data.Link, Slot, Type, Data, Length))
+        {
+            AllQueued = false;
+        }
+    }
+
+    return AllQueued;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t SB_BRIDGE_ValidateConfig(void *TblData)
+{
+    const SB_BRIDGE_ConfigTable_t *Config = TblData;
+    const char *                   End;
+
+    End = memchr(Config->SegmentName, 0, sizeof(Config->SegmentName));
+    if (End == NULL || End - Config->SegmentName < 2 || Config->SegmentName[0] != '/')
+    {
+        CFE_EVS_SendEvent(SB_BRIDGE_TBL_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "SB_BRIDGE: Configuration table has no valid shared memory object name");
+        return CFE_STATUS_VALIDATION_FAILURE;
+    }
+
+    if (Config->NumPeers > SB_BRIDGE_MAX_PEERS - 1)
+    {
+        CFE_EVS_SendEvent(SB_BRIDGE_TBL_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "SB_BRIDGE: Configuration table lists %u peers, at most %u supported",
+                          (unsigned int)Config->NumPeers, (unsigned int)(SB_BRIDGE_MAX_PEERS - 1));
+        return CFE_STATUS_VALIDATION_FAILURE;
+    }
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* SB_BRIDGE_Init() -- SB Bridge initialization                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t SB_BRIDGE_Init(void)
+{
+    CFE_Status_t status;
+    int32        OsStatus;
+    void *       TblPtr;
+
+    memset(&SB_BRIDGE_Data, 0, sizeof(SB_BRIDGE_Data));
+    SB_BRIDGE_Data.RxTaskId = CFE_ES_TASKID_UNDEFINED;
+
+    status = CFE_EVS_Register(NULL, 0, CFE_EVS_EventFilter_BINARY);
+    if (status != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("SB_BRIDGE: Error registering for Event Services, RC = 0x%08X\n", (unsigned int)status);
+    }
+
+    /*
+    ** The configuration is read once, a new load takes effect on restart
+    */
+    if (status == CFE_SUCCESS)
+    {
+        status = CFE_TBL_Register(&SB_BRIDGE_Data.ConfigHandle, "Config", sizeof(SB_BRIDGE_ConfigTable_t),
+                                  CFE_TBL_OPT_DEFAULT, SB_BRIDGE_ValidateConfig);
+        if (status == CFE_SUCCESS)
+        {
+            status = CFE_TBL_Load(SB_BRIDGE_Data.ConfigHandle, CFE_TBL_SRC_FILE, SB_BRIDGE_CONFIG_TABLE_FILE);
+        }
+        if (status == CFE_SUCCESS)
+        {
+            status = CFE_TBL_GetAddress(&TblPtr, SB_BRIDGE_Data.ConfigHandle);
+            if (status == CFE_TBL_INFO_UPDATED)
+            {
+                status = CFE_SUCCESS;
+            }
+        }
+        if (status == CFE_SUCCESS)
+        {
+            memcpy(&SB_BRIDGE_Data.Config, TblPtr, sizeof(SB_BRIDGE_Data.Config));
+            CFE_TBL_ReleaseAddress(SB_BRIDGE_Data.ConfigHandle);
+        }
+        else
+        {
+            CFE_EVS_SendEvent(SB_BRIDGE_TBL_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "SB_BRIDGE: Can't load configuration table, RC = 0x%08X", (unsigned int)status);
+        }
+    }
+
+    if (status == CFE_SUCCESS)
+    {
+        status = CFE_SB_CreatePipe(&SB_BRIDGE_Data.DataPipe, SB_BRIDGE_PIPE_DEPTH, SB_BRIDGE_PIPE_NAME);
+        if (status == CFE_SUCCESS)
+        {
+            /* What the receive task injects must not come back to be forwarded */
+            status = CFE_SB_SetPipeOpts(SB_BRIDGE_Data.DataPipe, CFE_SB_PIPEOPTS_IGNOREMINE);
+        }
+        if (status != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(SB_BRIDGE_CR_PIPE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "SB_BRIDGE: Can't create pipe, RC = 0x%08X", (unsigned int)status);
+        }
+    }
+
+    /*
+    ** Local scope keeps the bridge's own subscriptions out of the reports
+    */
+    if (status == CFE_SUCCESS)
+    {
+        status = CFE_SB_SubscribeLocal(CFE_SB_ValueToMsgId(CFE_SB_ONESUB_TLM_MID), SB_BRIDGE_Data.DataPipe,
+                                       SB_BRIDGE_PIPE_DEPTH);
+        if (status == CFE_SUCCESS)
+        {
+            status = CFE_SB_SubscribeLocal(CFE_SB_ValueToMsgId(CFE_SB_ALLSUBS_TLM_MID), SB_BRIDGE_Data.DataPipe,
+                                           SB_BRIDGE_PIPE_DEPTH);
+        }
+        if (status != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(SB_BRIDGE_SUBSCRIBE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "SB_BRIDGE: Can't subscribe to subscription reports, RC = 0x%08X",
+                              (unsigned int)status);
+        }
+    }
+
+    if (status == CFE_SUCCESS)
+    {
+        OsStatus = OS_MutSemCreate(&SB_BRIDGE_Data.SubMutex, "SB_BRIDGE_SUBS", 0);
+        if (OsStatus != OS_SUCCESS)
+        {
+            CFE_EVS_SendEvent(SB_BRIDGE_TASK_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "SB_BRIDGE: Can't create mutex, RC = %ld", (long)OsStatus);
+            status = CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+        }
+    }
+
+    if (status == CFE_SUCCESS)
+    {
+        status =
+            SB_BRIDGE_LinkOpen(&SB_BRIDGE_Data.Link, SB_BRIDGE_Data.Config.SegmentName, CFE_PSP_GetProcessorId());
+        if (status != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(SB_BRIDGE_SHM_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "SB_BRIDGE: Can't attach to shared memory %s, RC = 0x%08X",
+                              SB_BRIDGE_Data.Config.SegmentName, (unsigned int)status);
+        }
+    }
+
+    if (status == CFE_SUCCESS)
+    {
+        status = CFE_ES_CreateChildTask(&SB_BRIDGE_Data.RxTaskId, SB_BRIDGE_RX_TASK_NAME, SB_BRIDGE_RxTask,
+                                        CFE_ES_TASK_STACK_ALLOCATE, SB_BRIDGE_RX_TASK_STACK_SIZE,
+                                        SB_BRIDGE_RX_TASK_PRIORITY, 0);
+        if (status != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(SB_BRIDGE_TASK_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "SB_BRIDGE: Can't create receive task, RC = 0x%08X", (unsigned int)status);
+        }
+    }
+
+    if (status == CFE_SUCCESS)
+    {
+        /*
+        ** Ask the peers for their subscriptions (they may have been running
+        ** for a while) and have the local SB report ours, now and as they change
+        */
+        SB_BRIDGE_Broadcast(SB_BRIDGE_REC_RESYNC, NULL, 0);
+        SB_BRIDGE_SendSubRptCmd(CFE_SB_ENABLE_SUB_REPORTING_CC);
+        SB_BRIDGE_SendSubRptCmd(CFE_SB_SEND_PREV_SUBS_CC);
+
+        CFE_EVS_SendEvent(SB_BRIDGE_INIT_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "SB_BRIDGE Initialized on %s slot %u", SB_BRIDGE_Data.Config.SegmentName,
+                          (unsigned int)SB_BRIDGE_Data.Link.Slot);
+    }
+
+    return status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void SB_BRIDGE_SendSubRptCmd(CFE_MSG_FcnCode_t FcnCode)
+{
+    /* The subscription reporting commands carry no payload */
+    CFE_MSG_CommandHeader_t Cmd;
+
+    memset(&Cmd, 0, sizeof(Cmd));
+    CFE_MSG_Init(CFE_MSG_PTR(Cmd), CFE_SB_ValueToMsgId(CFE_SB_SUB_RPT_CTRL_MID), sizeof(Cmd));
+    CFE_MSG_SetFcnCode(CFE_MSG_PTR(Cmd), FcnCode);
+    CFE_SB_TransmitMsg(CFE_MSG_PTR(Cmd), true);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper: pass one local subscription change to the peers
+ *
+ *-----------------------------------------------------------------*/
+static void SB_BRIDGE_PutSub(uint16 Type, CFE_SB_MsgId_t MsgId)
+{
+    CFE_SB_MsgId_Atom_t Value = CFE_SB_MsgIdToValue(MsgId);
+
+    if (!SB_BRIDGE_Broadcast(Type, &Value, sizeof(Value)))
+    {
+        SB_BRIDGE_Data.ResyncPending = true;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper: index of MsgId in the peer subscription list, or -1
+ *
+ * The caller holds SubMutex.
+ *
+ *-----------------------------------------------------------------*/
+static int32 SB_BRIDGE_FindPeerSub(CFE_SB_MsgId_t MsgId)
+{
+    uint32 i;
+
+    for (i = 0; i < SB_BRIDGE_Data.PeerSubCount; ++i)
+    {
+        if (CFE_SB_MsgId_Equal(SB_BRIDGE_Data.PeerSubs[i].MsgId, MsgId))
+        {
+            return (int32)i;
+        }
+    }
+
+    return -1;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper: forward a local message to the peer in link slot Slot
+ *
+ *-----------------------------------------------------------------*/
+static void SB_BRIDGE_Forward(uint32 Slot, const CFE_SB_Buffer_t *BufPtr, CFE_SB_MsgId_t MsgId, CFE_MSG_Size_t Size)
+{
+    uint32 Bit = (uint32)1 << Slot;
+
+    if (SB_BRIDGE_LinkPut(&SB_BRIDGE_Data.Link, Slot, SB_BRIDGE_REC_MSG, BufPtr, Size))
+    {
+        ++SB_BRIDGE_Data.TxMsgCount;
+        if ((SB_BRIDGE_Data.TxStalled & Bit) != 0)
+        {
+            SB_BRIDGE_Data.TxStalled &= ~Bit;
+            CFE_EVS_SendEvent(SB_BRIDGE_TX_RESUME_INF_EID, CFE_EVS_EventType_INFORMATION,
+                              "SB_BRIDGE: Forwarding to slot %u resumed, %u messages dropped so far",
+                              (unsigned int)Slot, (unsigned int)SB_BRIDGE_Data.TxDropCount);
+        }
+    }
+    else
+    {
+        ++SB_BRIDGE_Data.TxDropCount;
+        if ((SB_BRIDGE_Data.TxStalled & Bit) == 0)
+        {
+            SB_BRIDGE_Data.TxStalled |= Bit;
+            CFE_EVS_SendEvent(SB_BRIDGE_TX_STALL_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "SB_BRIDGE: Ring to slot %u full, dropping MsgId 0x%x size %u", (unsigned int)Slot,
+                              (unsigned int)CFE_SB_MsgIdToValue(MsgId), (unsigned int)Size);
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void SB_BRIDGE_ProcessLocal(const CFE_SB_Buffer_t *BufPtr)
+{
+    const CFE_SB_SingleSubscriptionTlm_t *OneSub;
+    const CFE_SB_AllSubscriptionsTlm_t *  AllSubs;
+    CFE_SB_MsgId_t                        MsgId    = CFE_SB_INVALID_MSG_ID;
+    CFE_MSG_Size_t                        Size     = 0;
+    uint32                                PeerMask = 0;
+    int32                                 Idx;
+    uint32                                i;
+
+    CFE_MSG_GetMsgId(&BufPtr->Msg, &MsgId);
+    CFE_MSG_GetSize(&BufPtr->Msg, &Size);
+
+    if (CFE_SB_MsgId_Equal(MsgId, CFE_SB_ValueToMsgId(CFE_SB_ONESUB_TLM_MID)))
+    {
+        if (Size >= sizeof(*OneSub))
+        {
+            OneSub = (const CFE_SB_SingleSubscriptionTlm_t *)BufPtr;
+            SB_BRIDGE_PutSub(OneSub->Payload.SubType == CFE_SB_UNSUBSCRIPTION ? SB_BRIDGE_REC_UNSUB
+                                                                               : SB_BRIDGE_REC_SUB,
+                             OneSub->Payload.MsgId);
+        }
+    }
+    else if (CFE_SB_MsgId_Equal(MsgId, CFE_SB_ValueToMsgId(CFE_SB_ALLSUBS_TLM_MID)))
+    {
+        if (Size >= sizeof(*AllSubs))
+        {
+            AllSubs = (const CFE_SB_AllSubscriptionsTlm_t *)BufPtr;
+            for (i = 0; i < AllSubs->Payload.Entries && i < CFE_SB_SUB_ENTRIES_PER_PKT; ++i)
+            {
+                SB_BRIDGE_PutSub(SB_BRIDGE_REC_SUB, AllSubs->Payload.Entry[i].MsgId);
+            }
+        }
+    }
+    else
+    {
+        /* Everything else on the pipe is here because a peer subscribed to it */
+        OS_MutSemTake(SB_BRIDGE_Data.SubMutex);
+        Idx = SB_BRIDGE_FindPeerSub(MsgId);
+        if (Idx >= 0)
+        {
+            PeerMask = SB_BRIDGE_Data.PeerSubs[Idx].PeerMask;
+        }
+        OS_MutSemGive(SB_BRIDGE_Data.SubMutex);
+
+        for (i = 0; PeerMask != 0; ++i)
+        {
+            if ((PeerMask & ((uint32)1 << i)) != 0)
+            {
+                PeerMask &= ~((uint32)1 << i);
+                SB_BRIDGE_Forward(i, BufPtr, MsgId, Size);
+            }
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper: apply a subscription change made on the peer in link
+ * slot Slot
+ *
+ *-----------------------------------------------------------------*/
+static void SB_BRIDGE_ProcessPeerSub(uint32 Slot, uint16 Type, CFE_SB_MsgId_Atom_t Value)
+{
+    SB_BRIDGE_PeerSub_t *Entry;
+    CFE_SB_MsgId_t       MsgId  = CFE_SB_ValueToMsgId(Value);
+    CFE_Status_t         status = CFE_SUCCESS;
+    uint32               Bit    = (uint32)1 << Slot;
+    bool                 Full   = false;
+    bool                 Added  = false;
+    int32                Idx;
+
+    /* The subscription reports are consumed here, never bridged */
+    if (!CFE_SB_IsValidMsgId(MsgId) || CFE_SB_MsgId_Equal(MsgId, CFE_SB_ValueToMsgId(CFE_SB_ONESUB_TLM_MID)) ||
+        CFE_SB_MsgId_Equal(MsgId, CFE_SB_ValueToMsgId(CFE_SB_ALLSUBS_TLM_MID)))
+    {
+        return;
+    }
+
+    OS_MutSemTake(SB_BRIDGE_Data.SubMutex);
+
+    Idx = SB_BRIDGE_FindPeerSub(MsgId);
+
+    if (Type == SB_BRIDGE_REC_SUB && Idx >= 0)
+    {
+        SB_BRIDGE_Data.PeerSubs[Idx].PeerMask |= Bit;
+    }
+    else if (Type == SB_BRIDGE_REC_SUB)
+    {
+        if (SB_BRIDGE_Data.PeerSubCount >= SB_BRIDGE_MAX_PEER_SUBS)
+        {
+            Full = true;
+        }
+        else
+        {
+            status = CFE_SB_SubscribeLocal(MsgId, SB_BRIDGE_Data.DataPipe, SB_BRIDGE_MSG_LIM);
+            if (status == CFE_SUCCESS)
+            {
+                Entry           = &SB_BRIDGE_Data.PeerSubs[SB_BRIDGE_Data.PeerSubCount];
+                Entry->MsgId    = MsgId;
+                Entry->PeerMask = Bit;
+                ++SB_BRIDGE_Data.PeerSubCount;
+                Added = true;
+            }
+        }
+    }
+    else if (Type == SB_BRIDGE_REC_UNSUB && Idx >= 0 && (SB_BRIDGE_Data.PeerSubs[Idx].PeerMask & Bit) != 0)
+    {
+        /* The route stays until no peer wants it any more */
+        SB_BRIDGE_Data.PeerSubs[Idx].PeerMask &= ~Bit;
+        if (SB_BRIDGE_Data.PeerSubs[Idx].PeerMask == 0)
+        {
+            CFE_SB_UnsubscribeLocal(MsgId, SB_BRIDGE_Data.DataPipe);
+            --SB_BRIDGE_Data.PeerSubCount;
+            SB_BRIDGE_Data.PeerSubs[Idx] = SB_BRIDGE_Data.PeerSubs[SB_BRIDGE_Data.PeerSubCount];
+        }
+    }
+
+    OS_MutSemGive(SB_BRIDGE_Data.SubMutex);
+
+    if (Full)
+    {
+        CFE_EVS_SendEvent(SB_BRIDGE_PEER_FULL_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "SB_BRIDGE: Peer subscription table full, MsgId 0x%x not bridged", (unsigned int)Value);
+    }
+    else if (Added)
+    {
+        CFE_EVS_SendEvent(SB_BRIDGE_PEER_SUB_DBG_EID, CFE_EVS_EventType_DEBUG,
+                          "SB_BRIDGE: Bridging MsgId 0x%x to peers", (unsigned int)Value);
+    }
+    else if (status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(SB_BRIDGE_SUBSCRIBE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "SB_BRIDGE: Can't subscribe to MsgId 0x%x for peers, RC = 0x%08X", (unsigned int)Value,
+                          (unsigned int)status);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper: copy a message off the ring coming from link slot Slot
+ * and publish it locally
+ *
+ *-----------------------------------------------------------------*/
+static void SB_BRIDGE_ProcessPeerMsg(uint32 Slot, const SB_BRIDGE_RecHdr_t *Hdr)
+{
+    CFE_SB_Buffer_t *BufPtr;
+    CFE_SB_MsgId_t   MsgId = CFE_SB_INVALID_MSG_ID;
+    CFE_Status_t     status;
+
+    if (Hdr->Length < sizeof(CFE_MSG_Message_t))
+    {
+        ++SB_BRIDGE_Data.RxErrCount;
+        return;
+    }
+
+    BufPtr = CFE_SB_AllocateMessageBuffer(Hdr->Length);
+    if (BufPtr == NULL)
+    {
+        ++SB_BRIDGE_Data.RxErrCount;
+        return;
+    }
+
+    SB_BRIDGE_LinkCopyOut(&SB_BRIDGE_Data.Link, Slot, BufPtr, Hdr->Length);
+
+    /* Not an origination: keep the peer's sequence count and time stamp */
+    status = CFE_SB_TransmitBuffer(BufPtr, false);
+    if (status == CFE_SUCCESS)
+    {
+        ++SB_BRIDGE_Data.RxMsgCount;
+    }
+    else
+    {
+        CFE_MSG_GetMsgId(&BufPtr->Msg, &MsgId);
+        CFE_SB_ReleaseMessageBuffer(BufPtr);
+        ++SB_BRIDGE_Data.RxErrCount;
+        CFE_EVS_SendEvent(SB_BRIDGE_RX_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "SB_BRIDGE: Can't publish MsgId 0x%x from slot %u, RC = 0x%08X",
+                          (unsigned int)CFE_SB_MsgIdToValue(MsgId), (unsigned int)Slot, (unsigned int)status);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void SB_BRIDGE_ProcessPeer(uint32 Slot, const SB_BRIDGE_RecHdr_t *Hdr)
+{
+    CFE_SB_MsgId_Atom_t Value;
+
+    /* Instances not in the configured peer set are not listened to */
+    if (!SB_BRIDGE_IsPeer(Slot))
+    {
+        return;
+    }
+
+    switch (Hdr->Type)
+    {
+        case SB_BRIDGE_REC_MSG:
+            SB_BRIDGE_ProcessPeerMsg(Slot, Hdr);
+            break;
+
+        case SB_BRIDGE_REC_SUB:
+        case SB_BRIDGE_REC_UNSUB:
+            if (Hdr->Length == sizeof(Value))
+            {
+                SB_BRIDGE_LinkCopyOut(&SB_BRIDGE_Data.Link, Slot, &Value, sizeof(Value));
+                SB_BRIDGE_ProcessPeerSub(Slot, Hdr->Type, Value);
+            }
+            break;
+
+        case SB_BRIDGE_REC_RESYNC:
+            SB_BRIDGE_SendSubRptCmd(CFE_SB_SEND_PREV_SUBS_CC);
+            break;
+
+        default:
+            ++SB_BRIDGE_Data.RxErrCount;
+            break;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void SB_BRIDGE_RxTask(void)
+{
+    SB_BRIDGE_RecHdr_t Hdr;
+    uint32             Slot;
+    bool               Busy;
+
+    CFE_ES_PerfLogEntry(SB_BRIDGE_RX_TASK_PERF_ID);
+
+    while (true)
+    {
+        /* One record per peer and pass, so a busy peer cannot starve the others */
+        Busy = false;
+        for (Slot = 0; Slot < SB_BRIDGE_MAX_PEERS; ++Slot)
+        {
+            if (SB_BRIDGE_LinkPeek(&SB_BRIDGE_Data.Link, Slot, &Hdr))
+            {
+                SB_BRIDGE_ProcessPeer(Slot, &Hdr);
+                SB_BRIDGE_LinkRelease(&SB_BRIDGE_Data.Link, Slot, &Hdr);
+                Busy = true;
+            }
+        }
+
+        if (!Busy)
+        {
+            CFE_ES_PerfLogExit(SB_BRIDGE_RX_TASK_PERF_ID);
+            SB_BRIDGE_LinkWait(&SB_BRIDGE_Data.Link, SB_BRIDGE_RX_WAIT_MSEC);
+            CFE_ES_PerfLogEntry(SB_BRIDGE_RX_TASK_PERF_ID);
+        }
+    }
+}
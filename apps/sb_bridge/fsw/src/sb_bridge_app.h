@@ -0,0 +1,115 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Define SB Bridge Application header file
+ *
+ * The SB Bridge joins the software buses of several cFS instances running
+ * on the same host.  Each instance runs one bridge; the bridges share the
+ * rings described in sb_bridge_link.h, in the object named by the
+ * configuration table.
+ *
+ * Subscriptions are propagated with the SB subscription reporting that
+ * exists for networked buses: the bridge enables reporting and requests the
+ * previous subscriptions from its local SB, and passes every global
+ * subscription it is told about to all of its peers.  A peer bridge
+ * subscribes locally (so that its own subscriptions are never reported
+ * back), remembers which peers asked for each MsgId, and forwards each
+ * matching message to each of them with one copy into their ring.
+ * Messages received from a peer are copied once into an SB buffer and
+ * transmitted without changing their sequence count or time stamp.
+ *
+ * The bridge's pipe ignores messages sent by the bridge itself
+ * (#CFE_SB_PIPEOPTS_IGNOREMINE), so what it injects is never sent back or
+ * relayed to a third instance.  This also keeps the bridge's own event
+ * messages local.  SB does not report unsubscriptions today, so a route
+ * stays bridged until the peer restarts.
+ */
+
+#ifndef SB_BRIDGE_APP_H
+#define SB_BRIDGE_APP_H
+
+#include "common_types.h"
+#include "osapi.h"
+#include "cfe.h"
+
+#include "sb_bridge_platform_cfg.h"
+#include "sb_bridge_tbl.h"
+#include "sb_bridge_link.h"
+
+/************************************************************************
+** Type Definitions
+*************************************************************************/
+
+/**
+ * A MsgId subscribed on behalf of one or more peers
+ */
+typedef struct
+{
+    CFE_SB_MsgId_t MsgId;
+    uint32         PeerMask; /**< \brief Bit n is set if the instance in link slot n subscribed */
+} SB_BRIDGE_PeerSub_t;
+
+/**
+ * SB Bridge global data structure
+ */
+typedef struct
+{
+    CFE_SB_PipeId_t  DataPipe;
+    SB_BRIDGE_Link_t Link;
+    CFE_ES_TaskId_t  RxTaskId;
+
+    CFE_TBL_Handle_t        ConfigHandle;
+    SB_BRIDGE_ConfigTable_t Config; /**< \brief Copy of the configuration table taken at start */
+
+    /*
+    ** MsgIds subscribed on behalf of the peers, changed by the receive task
+    ** and read by the main task; guarded by SubMutex
+    */
+    osal_id_t           SubMutex;
+    SB_BRIDGE_PeerSub_t PeerSubs[SB_BRIDGE_MAX_PEER_SUBS];
+    uint32              PeerSubCount;
+
+    bool   ResyncPending; /**< \brief A subscription could not be queued and all must be re-sent */
+    uint32 TxStalled;     /**< \brief Bit n is set while the ring to link slot n is full */
+
+    uint32 TxMsgCount;
+    uint32 TxDropCount;
+    uint32 RxMsgCount;
+    uint32 RxErrCount;
+} SB_BRIDGE_Data_t;
+
+/************************************************************************
+ * Function Prototypes
+ ************************************************************************/
+
+void         SB_BRIDGE_AppMain(void);
+CFE_Status_t SB_BRIDGE_Init(void);
+CFE_Status_t SB_BRIDGE_ValidateConfig(void *TblData);
+void         SB_BRIDGE_ProcessLocal(const CFE_SB_Buffer_t *BufPtr);
+void         SB_BRIDGE_SendSubRptCmd(CFE_MSG_FcnCode_t FcnCode);
+void         SB_BRIDGE_ProcessPeer(uint32 Slot, const SB_BRIDGE_RecHdr_t *Hdr);
+void         SB_BRIDGE_RxTask(void);
+
+/******************************************************************************/
+
+/* Global State Object */
+extern SB_BRIDGE_Data_t SB_BRIDGE_Data;
+
+#endif
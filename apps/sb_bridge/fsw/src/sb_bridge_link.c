@@ -0,0 +1,420 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *  Shared memory link between SB Bridge instances
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "osapi.h"
+
+#include "sb_bridge_link.h"
+
+#if (SB_BRIDGE_RING_SIZE & (SB_BRIDGE_RING_SIZE - 1)) != 0
+#error SB_BRIDGE_RING_SIZE must be a power of two
+#endif
+
+#if SB_BRIDGE_MAX_PEERS < 2 || SB_BRIDGE_MAX_PEERS > 32
+#error SB_BRIDGE_MAX_PEERS must be between 2 and 32
+#endif
+
+#define SB_BRIDGE_RING_MASK     (SB_BRIDGE_RING_SIZE - 1)
+#define SB_BRIDGE_REC_ALIGN(x)  (((x) + 7) & ~((uint32)7))
+#define SB_BRIDGE_REC_TOTAL(len) SB_BRIDGE_REC_ALIGN(sizeof(SB_BRIDGE_RecHdr_t) + (uint32)(len))
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper: copy into the ring starting at index Pos, wrapping
+ * at the end of the data area
+ *
+ *-----------------------------------------------------------------*/
+static void SB_BRIDGE_RingCopyIn(SB_BRIDGE_Ring_t *Ring, uint32 Pos, const void *Src, size_t Length)
+{
+    uint32 Offset = Pos & SB_BRIDGE_RING_MASK;
+    size_t First  = SB_BRIDGE_RING_SIZE - Offset;
+
+    if (First >= Length)
+    {
+        memcpy(&Ring->Data[Offset], Src, Length);
+    }
+    else
+    {
+        memcpy(&Ring->Data[Offset], Src, First);
+        memcpy(Ring->Data, (const uint8 *)Src + First, Length - First);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper: copy out of the ring starting at index Pos
+ *
+ *-----------------------------------------------------------------*/
+static void SB_BRIDGE_RingCopyOut(const SB_BRIDGE_Ring_t *Ring, uint32 Pos, void *Dest, size_t Length)
+{
+    uint32 Offset = Pos & SB_BRIDGE_RING_MASK;
+    size_t First  = SB_BRIDGE_RING_SIZE - Offset;
+
+    if (First >= Length)
+    {
+        memcpy(Dest, &Ring->Data[Offset], Length);
+    }
+    else
+    {
+        memcpy(Dest, &Ring->Data[Offset], First);
+        memcpy((uint8 *)Dest + First, Ring->Data, Length - First);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper: wait for the instance that created the object to
+ * finish initializing the doorbells
+ *
+ *-----------------------------------------------------------------*/
+static bool SB_BRIDGE_LinkAttach(SB_BRIDGE_Shm_t *Shm)
+{
+    uint32 Retries = 0;
+    uint32 Magic   = 0;
+    uint32 Slot;
+
+    if (__atomic_compare_exchange_n(&Shm->Magic, &Magic, SB_BRIDGE_SHM_SETTING_UP, false, __ATOMIC_ACQ_REL,
+                                    __ATOMIC_ACQUIRE))
+    {
+        Shm->RingSize = SB_BRIDGE_RING_SIZE;
+        Shm->MaxPeers = SB_BRIDGE_MAX_PEERS;
+        for (Slot = 0; Slot < SB_BRIDGE_MAX_PEERS; ++Slot)
+        {
+            if (sem_init(&Shm->Slot[Slot].Doorbell, 1, 0) != 0)
+            {
+                __atomic_store_n(&Shm->Magic, 0, __ATOMIC_RELEASE);
+                return false;
+            }
+        }
+        __atomic_store_n(&Shm->Magic, SB_BRIDGE_SHM_MAGIC, __ATOMIC_RELEASE);
+    }
+
+    while (__atomic_load_n(&Shm->Magic, __ATOMIC_ACQUIRE) != SB_BRIDGE_SHM_MAGIC)
+    {
+        if (++Retries > SB_BRIDGE_ATTACH_RETRIES)
+        {
+            return false;
+        }
+        OS_TaskDelay(10);
+    }
+
+    /* Every instance on the object must agree on its layout */
+    return (Shm->RingSize == SB_BRIDGE_RING_SIZE && Shm->MaxPeers == SB_BRIDGE_MAX_PEERS);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t SB_BRIDGE_LinkOpen(SB_BRIDGE_Link_t *Link, const char *Name, uint32 LocalId)
+{
+    struct stat      st;
+    SB_BRIDGE_Shm_t *Shm;
+    uint32           Owner;
+    uint32           Slot;
+    uint32           Peer;
+    int              fd;
+    void *           Addr;
+
+    memset(Link, 0, sizeof(*Link));
+
+    fd = shm_open(Name, O_RDWR | O_CREAT, 0660);
+    if (fd < 0)
+    {
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+
+    /* A freshly created object has size zero and reads back as all zeros */
+    if (fstat(fd, &st) != 0 || (st.st_size != 0 && st.st_size != (off_t)sizeof(SB_BRIDGE_Shm_t)) ||
+        ftruncate(fd, sizeof(SB_BRIDGE_Shm_t)) != 0)
+    {
+        close(fd);
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+
+    Addr = mmap(NULL, sizeof(SB_BRIDGE_Shm_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (Addr == MAP_FAILED)
+    {
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+
+    Shm = Addr;
+    if (!SB_BRIDGE_LinkAttach(Shm))
+    {
+        munmap(Addr, sizeof(SB_BRIDGE_Shm_t));
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+
+    /* Reclaim the slot held before a restart, otherwise take a free one */
+    ++LocalId;
+    for (Slot = 0; Slot < SB_BRIDGE_MAX_PEERS; ++Slot)
+    {
+        if (__atomic_load_n(&Shm->Slot[Slot].Owner, __ATOMIC_ACQUIRE) == LocalId)
+        {
+            break;
+        }
+    }
+    if (Slot == SB_BRIDGE_MAX_PEERS)
+    {
+        for (Slot = 0; Slot < SB_BRIDGE_MAX_PEERS; ++Slot)
+        {
+            Owner = 0;
+            if (__atomic_compare_exchange_n(&Shm->Slot[Slot].Owner, &Owner, LocalId, false, __ATOMIC_ACQ_REL,
+                                            __ATOMIC_ACQUIRE))
+            {
+                break;
+            }
+        }
+    }
+    if (Slot == SB_BRIDGE_MAX_PEERS)
+    {
+        munmap(Addr, sizeof(SB_BRIDGE_Shm_t));
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+
+    Link->Shm  = Shm;
+    Link->Slot = Slot;
+    for (Peer = 0; Peer < SB_BRIDGE_MAX_PEERS; ++Peer)
+    {
+        Link->TxTail[Peer] = __atomic_load_n(&Shm->Ring[Slot][Peer].Tail, __ATOMIC_ACQUIRE);
+        Link->RxHead[Peer] = __atomic_load_n(&Shm->Ring[Peer][Slot].Head, __ATOMIC_ACQUIRE);
+    }
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void SB_BRIDGE_LinkClose(SB_BRIDGE_Link_t *Link)
+{
+    if (Link->Shm != NULL)
+    {
+        munmap(Link->Shm, sizeof(SB_BRIDGE_Shm_t));
+        Link->Shm = NULL;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool SB_BRIDGE_LinkGetPeer(SB_BRIDGE_Link_t *Link, uint32 Slot, uint32 *ProcessorId)
+{
+    uint32 Owner;
+
+    if (Slot >= SB_BRIDGE_MAX_PEERS || Slot == Link->Slot)
+    {
+        return false;
+    }
+
+    Owner = __atomic_load_n(&Link->Shm->Slot[Slot].Owner, __ATOMIC_ACQUIRE);
+    if (Owner == 0)
+    {
+        return false;
+    }
+
+    *ProcessorId = Owner - 1;
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool SB_BRIDGE_LinkPut(SB_BRIDGE_Link_t *Link, uint32 Slot, uint16 Type, const void *Data, size_t Length)
+{
+    SB_BRIDGE_Ring_t * Ring   = &Link->Shm->Ring[Link->Slot][Slot];
+    SB_BRIDGE_Slot_t * Reader = &Link->Shm->Slot[Slot];
+    uint32 *           TxTail = &Link->TxTail[Slot];
+    SB_BRIDGE_RecHdr_t Hdr;
+    uint32             Head;
+    uint32             Total;
+
+    if (Length > SB_BRIDGE_RING_SIZE - sizeof(Hdr))
+    {
+        return false;
+    }
+
+    Total = SB_BRIDGE_REC_TOTAL(Length);
+    Head  = __atomic_load_n(&Ring->Head, __ATOMIC_ACQUIRE);
+    if (Total > SB_BRIDGE_RING_SIZE - (*TxTail - Head))
+    {
+        return false;
+    }
+
+    /* Records start 8 byte aligned, so the header itself never wraps */
+    Hdr.Length = Length;
+    Hdr.Type   = Type;
+    Hdr.Spare  = 0;
+    memcpy(&Ring->Data[*TxTail & SB_BRIDGE_RING_MASK], &Hdr, sizeof(Hdr));
+    if (Length > 0)
+    {
+        SB_BRIDGE_RingCopyIn(Ring, *TxTail + sizeof(Hdr), Data, Length);
+    }
+
+    *TxTail += Total;
+    __atomic_store_n(&Ring->Tail, *TxTail, __ATOMIC_RELEASE);
+
+    /*
+     * Pairs with the fence in SB_BRIDGE_LinkWait(): either the reader sees
+     * the new Tail before sleeping, or this sees Waiting and posts.  Of
+     * several writers seeing Waiting, only the one clearing it posts.
+     */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&Reader->Waiting, __ATOMIC_RELAXED) != 0 &&
+        __atomic_exchange_n(&Reader->Waiting, 0, __ATOMIC_ACQ_REL) != 0)
+    {
+        sem_post(&Reader->Doorbell);
+    }
+
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool SB_BRIDGE_LinkPeek(SB_BRIDGE_Link_t *Link, uint32 Slot, SB_BRIDGE_RecHdr_t *Hdr)
+{
+    SB_BRIDGE_Ring_t *Ring   = &Link->Shm->Ring[Slot][Link->Slot];
+    uint32 *          RxHead = &Link->RxHead[Slot];
+    uint32            Tail;
+
+    Tail = __atomic_load_n(&Ring->Tail, __ATOMIC_ACQUIRE);
+    if (Tail == *RxHead)
+    {
+        return false;
+    }
+
+    memcpy(Hdr, &Ring->Data[*RxHead & SB_BRIDGE_RING_MASK], sizeof(*Hdr));
+
+    /* A record that claims more than was written means the ring is corrupt; drop everything queued */
+    if (Tail - *RxHead < sizeof(*Hdr) || Hdr->Length > Tail - *RxHead - sizeof(*Hdr))
+    {
+        *RxHead = Tail;
+        __atomic_store_n(&Ring->Head, Tail, __ATOMIC_RELEASE);
+        return false;
+    }
+
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void SB_BRIDGE_LinkCopyOut(SB_BRIDGE_Link_t *Link, uint32 Slot, void *Dest, size_t Length)
+{
+    SB_BRIDGE_RingCopyOut(&Link->Shm->Ring[Slot][Link->Slot], Link->RxHead[Slot] + sizeof(SB_BRIDGE_RecHdr_t), Dest,
+                          Length);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void SB_BRIDGE_LinkRelease(SB_BRIDGE_Link_t *Link, uint32 Slot, const SB_BRIDGE_RecHdr_t *Hdr)
+{
+    Link->RxHead[Slot] += SB_BRIDGE_REC_TOTAL(Hdr->Length);
+    __atomic_store_n(&Link->Shm->Ring[Slot][Link->Slot].Head, Link->RxHead[Slot], __ATOMIC_RELEASE);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper: true if any ring leading into this instance's slot
+ * holds an unread record
+ *
+ *-----------------------------------------------------------------*/
+static bool SB_BRIDGE_LinkPending(SB_BRIDGE_Link_t *Link)
+{
+    uint32 Peer;
+
+    for (Peer = 0; Peer < SB_BRIDGE_MAX_PEERS; ++Peer)
+    {
+        if (__atomic_load_n(&Link->Shm->Ring[Peer][Link->Slot].Tail, __ATOMIC_ACQUIRE) != Link->RxHead[Peer])
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void SB_BRIDGE_LinkWait(SB_BRIDGE_Link_t *Link, uint32 Msecs)
+{
+    SB_BRIDGE_Slot_t *Self = &Link->Shm->Slot[Link->Slot];
+    struct timespec   Deadline;
+
+    __atomic_store_n(&Self->Waiting, 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+    if (!SB_BRIDGE_LinkPending(Link))
+    {
+        clock_gettime(CLOCK_REALTIME, &Deadline);
+        Deadline.tv_sec += Msecs / 1000;
+        Deadline.tv_nsec += (long)(Msecs % 1000) * 1000000L;
+        if (Deadline.tv_nsec >= 1000000000L)
+        {
+            Deadline.tv_nsec -= 1000000000L;
+            ++Deadline.tv_sec;
+        }
+
+        /* A post left over from an earlier wait only causes one extra pass */
+        while (sem_timedwait(&Self->Doorbell, &Deadline) != 0 && errno == EINTR)
+        {
+            /* retry after a signal */
+        }
+    }
+
+    __atomic_store_n(&Self->Waiting, 0, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,168 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Shared memory link between SB Bridge instances
+ *
+ * The link is a POSIX shared memory object holding SB_BRIDGE_MAX_PEERS
+ * slots and one single-producer, single-consumer byte ring per ordered pair
+ * of slots.  Each bridge claims one slot by processor ID: it is the only
+ * writer of the rings leading out of its slot and the only reader of the
+ * rings leading into it, so no ring needs a lock.  Records are an 8 byte
+ * header followed by the payload, padded to 8 bytes; a forwarded SB message
+ * is a single copy into the ring.
+ *
+ * A reader with nothing to do sleeps on its slot's process-shared semaphore,
+ * which writers only post when the reader has announced it is about to wait.
+ */
+#ifndef SB_BRIDGE_LINK_H
+#define SB_BRIDGE_LINK_H
+
+#include <semaphore.h>
+
+#include "common_types.h"
+#include "cfe_error.h"
+
+#include "sb_bridge_platform_cfg.h"
+
+/*
+** Record types carried on the rings
+*/
+#define SB_BRIDGE_REC_MSG    1 /**< \brief Payload is a complete SB message */
+#define SB_BRIDGE_REC_SUB    2 /**< \brief Payload is a CFE_SB_MsgId_Atom_t the peer subscribed to */
+#define SB_BRIDGE_REC_UNSUB  3 /**< \brief Payload is a CFE_SB_MsgId_Atom_t the peer unsubscribed from */
+#define SB_BRIDGE_REC_RESYNC 4 /**< \brief No payload; peer asks for all subscriptions to be re-sent */
+
+#define SB_BRIDGE_SHM_MAGIC      0x53424252 /* "SBBR" */
+#define SB_BRIDGE_SHM_SETTING_UP 0x53424249
+
+typedef struct
+{
+    uint32 Length; /**< \brief Payload length in bytes, excluding this header */
+    uint16 Type;   /**< \brief One of the SB_BRIDGE_REC_ values */
+    uint16 Spare;
+} SB_BRIDGE_RecHdr_t;
+
+/**
+ * One direction between two slots
+ *
+ * The consumer-owned and producer-owned indices are kept on separate cache
+ * lines.  Indices are free-running byte counts; the ring offset is the
+ * index modulo SB_BRIDGE_RING_SIZE.
+ */
+typedef struct
+{
+    volatile uint32 Head; /**< \brief Next byte to read, written by the consumer */
+    uint8           Spare0[60];
+    volatile uint32 Tail; /**< \brief Next byte to write, written by the producer */
+    uint8           Spare1[60];
+    uint8           Data[SB_BRIDGE_RING_SIZE];
+} SB_BRIDGE_Ring_t;
+
+/**
+ * One instance attached to the link
+ */
+typedef struct
+{
+    volatile uint32 Owner;   /**< \brief Processor ID + 1 of the instance in this slot, 0 if free */
+    volatile uint32 Waiting; /**< \brief Set by the owner before sleeping on Doorbell */
+    uint8           Spare[56];
+    sem_t           Doorbell; /**< \brief Posted by the writers of the rings leading into this slot */
+} SB_BRIDGE_Slot_t;
+
+/**
+ * Layout of the shared memory object
+ *
+ * Ring[n][n] is never used; its pages are never touched either.
+ */
+typedef struct
+{
+    volatile uint32  Magic;
+    uint32           RingSize;
+    uint32           MaxPeers;
+    uint32           Spare;
+    SB_BRIDGE_Slot_t Slot[SB_BRIDGE_MAX_PEERS];
+    SB_BRIDGE_Ring_t Ring[SB_BRIDGE_MAX_PEERS][SB_BRIDGE_MAX_PEERS]; /**< \brief Ring[n][m] goes from slot n to m */
+} SB_BRIDGE_Shm_t;
+
+/**
+ * Process-local view of the link
+ */
+typedef struct
+{
+    SB_BRIDGE_Shm_t *Shm;
+    uint32           Slot;                        /**< \brief Slot claimed by this instance */
+    uint32           TxTail[SB_BRIDGE_MAX_PEERS]; /**< \brief Local copies of Ring[Slot][n].Tail */
+    uint32           RxHead[SB_BRIDGE_MAX_PEERS]; /**< \brief Local copies of Ring[n][Slot].Head */
+} SB_BRIDGE_Link_t;
+
+/*
+** Function Prototypes
+*/
+
+/**
+ * Map the shared memory object, creating it if this is the first instance,
+ * and claim a slot for LocalId.  An instance that restarts reclaims the slot
+ * it held before and resumes all of its rings where they were left.
+ */
+CFE_Status_t SB_BRIDGE_LinkOpen(SB_BRIDGE_Link_t *Link, const char *Name, uint32 LocalId);
+
+/**
+ * Unmap the shared memory object.  The object itself is left in place for
+ * the peers and for a later restart.
+ */
+void SB_BRIDGE_LinkClose(SB_BRIDGE_Link_t *Link);
+
+/**
+ * Get the processor ID of the instance in another slot
+ *
+ * \returns true if Slot is held by another instance
+ */
+bool SB_BRIDGE_LinkGetPeer(SB_BRIDGE_Link_t *Link, uint32 Slot, uint32 *ProcessorId);
+
+/**
+ * Append a record to the ring leading to Slot and wake its owner if it is waiting
+ *
+ * \returns true if the record was queued, false if the ring lacks space
+ */
+bool SB_BRIDGE_LinkPut(SB_BRIDGE_Link_t *Link, uint32 Slot, uint16 Type, const void *Data, size_t Length);
+
+/**
+ * Get the header of the oldest unread record on the ring coming from Slot
+ *
+ * \returns true if a record is available
+ */
+bool SB_BRIDGE_LinkPeek(SB_BRIDGE_Link_t *Link, uint32 Slot, SB_BRIDGE_RecHdr_t *Hdr);
+
+/**
+ * Copy the payload of the record returned by SB_BRIDGE_LinkPeek()
+ */
+void SB_BRIDGE_LinkCopyOut(SB_BRIDGE_Link_t *Link, uint32 Slot, void *Dest, size_t Length);
+
+/**
+ * Consume the record returned by SB_BRIDGE_LinkPeek()
+ */
+void SB_BRIDGE_LinkRelease(SB_BRIDGE_Link_t *Link, uint32 Slot, const SB_BRIDGE_RecHdr_t *Hdr);
+
+/**
+ * Sleep until a peer queues a record for this instance or Msecs elapse
+ */
+void SB_BRIDGE_LinkWait(SB_BRIDGE_Link_t *Link, uint32 Msecs);
+
+#endif
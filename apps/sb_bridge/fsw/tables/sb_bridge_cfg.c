@@ -0,0 +1,28 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+#include "cfe_tbl_filedef.h" /* Required to obtain the CFE_TBL_FILEDEF macro definition */
+#include "sb_bridge_tbl.h"
+
+/*
+** Default configuration: one shared memory object for every instance on
+** the host, each exchanging messages with all the others
+*/
+SB_BRIDGE_ConfigTable_t SB_BRIDGE_ConfigTable = {.SegmentName = "/cfs_sb_bridge", .NumPeers = 0};
+
+CFE_TBL_FILEDEF(SB_BRIDGE_ConfigTable, SB_BRIDGE.Config, SB Bridge segment and peers, sb_bridge_cfg.tbl)
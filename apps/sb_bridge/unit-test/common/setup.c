@@ -0,0 +1,100 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Common setup for the sb_bridge coverage tests
+ */
+
+#include "sb_bridge_app.h"
+
+#include "setup.h"
+
+#include <string.h>
+
+/* Contents of the configuration table handed out by CFE_TBL_GetAddress */
+SB_BRIDGE_ConfigTable_t UT_ConfigTable;
+
+/* The fields must not overlap the payload of the SB subscription reports */
+CompileTimeAssert(sizeof(UT_MsgFields_t) <= sizeof(CFE_MSG_TelemetryHeader_t), UtMsgFieldsTooLarge);
+
+/*
+ * Get the fields of the message passed to a CFE_MSG stub
+ */
+static void UT_GetMsgFields(const UT_StubContext_t *Context, UT_MsgFields_t *Fields)
+{
+    const CFE_MSG_Message_t *MsgPtr = UT_Hook_GetArgValueByName(Context, "MsgPtr", const CFE_MSG_Message_t *);
+
+    memcpy(Fields, MsgPtr, sizeof(*Fields));
+}
+
+static void UT_Handler_CFE_MSG_GetMsgId(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_SB_MsgId_t *MsgId = UT_Hook_GetArgValueByName(Context, "MsgId", CFE_SB_MsgId_t *);
+    UT_MsgFields_t  Fields;
+
+    UT_GetMsgFields(Context, &Fields);
+    *MsgId = CFE_SB_ValueToMsgId(Fields.MsgId);
+}
+
+static void UT_Handler_CFE_MSG_GetSize(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_MSG_Size_t *Size = UT_Hook_GetArgValueByName(Context, "Size", CFE_MSG_Size_t *);
+    UT_MsgFields_t  Fields;
+
+    UT_GetMsgFields(Context, &Fields);
+    *Size = Fields.Size;
+}
+
+/*
+ * Every table address is UT_ConfigTable, unless a status code is set
+ */
+static void UT_Handler_CFE_TBL_GetAddress(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    void **TblPtr = UT_Hook_GetArgValueByName(Context, "TblPtr", void **);
+    int32  status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+    if (status >= 0)
+    {
+        *TblPtr = &UT_ConfigTable;
+    }
+}
+
+/*
+ * Setup function prior to every test
+ */
+void SB_BRIDGE_UT_Setup(void)
+{
+    UT_ResetState(0);
+    memset(&SB_BRIDGE_Data, 0, sizeof(SB_BRIDGE_Data));
+
+    UT_SetHandlerFunction(UT_KEY(CFE_MSG_GetMsgId), UT_Handler_CFE_MSG_GetMsgId, NULL);
+    UT_SetHandlerFunction(UT_KEY(CFE_MSG_GetSize), UT_Handler_CFE_MSG_GetSize, NULL);
+
+    /* The default configuration table links to every instance on the object */
+    memset(&UT_ConfigTable, 0, sizeof(UT_ConfigTable));
+    strncpy(UT_ConfigTable.SegmentName, "/ut_sb_bridge", sizeof(UT_ConfigTable.SegmentName) - 1);
+    UT_SetHandlerFunction(UT_KEY(CFE_TBL_GetAddress), UT_Handler_CFE_TBL_GetAddress, NULL);
+}
+
+/*
+ * Teardown function after every test
+ */
+void SB_BRIDGE_UT_TearDown(void) {}
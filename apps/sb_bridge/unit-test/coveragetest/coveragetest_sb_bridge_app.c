@@ -0,0 +1,586 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** File: coveragetest_sb_bridge_app.c
+**
+** Purpose:
+** Coverage Unit Test cases for the SB Bridge Application
+*/
+
+/*
+ * Includes
+ */
+#include "sb_bridge_coveragetest_common.h"
+
+#include "cfe_sb_fcncodes.h"
+#include "cfe_sb_msg.h"
+#include "cfe_sb_msgids.h"
+
+#include <string.h>
+
+#define UT_MSG_SIZE  32
+#define UT_MSGID     0x0881
+#define UT_MSGID_ALT 0x0882
+
+/* Number of peers with the default link stub, every slot but ours */
+#define UT_NUM_PEERS (SB_BRIDGE_MAX_PEERS - 1)
+
+typedef union
+{
+    CFE_SB_Buffer_t                Buf;
+    UT_MsgFields_t                 Fields;
+    CFE_SB_SingleSubscriptionTlm_t OneSub;
+    CFE_SB_AllSubscriptionsTlm_t   AllSubs;
+} UT_Buf_t;
+
+/* Type and slot of the last record queued for a peer */
+static uint16 UT_PutType;
+static uint32 UT_PutSlots;
+
+/*
+ * Build a test message
+ */
+static void UT_InitMsg(UT_Buf_t *Msg, CFE_SB_MsgId_Atom_t MsgId, uint16 SeqCnt, uint32 Seconds)
+{
+    memset(Msg, 0, sizeof(*Msg));
+    Msg->Fields.MsgId   = MsgId;
+    Msg->Fields.SeqCnt  = SeqCnt;
+    Msg->Fields.Size    = UT_MSG_SIZE;
+    Msg->Fields.Seconds = Seconds;
+}
+
+/*
+ * Capture the type of the record queued for a peer, and the slots of all of them
+ */
+static int32 UT_LinkPutHook(void *UserObj, int32 StubRetcode, uint32 CallCount, const UT_StubContext_t *Context)
+{
+    UT_PutType = UT_Hook_GetArgValueByName(Context, "Type", uint16);
+    UT_PutSlots |= (uint32)1 << UT_Hook_GetArgValueByName(Context, "Slot", uint32);
+
+    return StubRetcode;
+}
+
+/*
+ * Have a peer subscription in place once SB_BRIDGE_Init() has cleared the global data
+ */
+static int32 UT_CreateChildTaskHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                    const UT_StubContext_t *Context)
+{
+    SB_BRIDGE_Data.PeerSubs[0].MsgId    = CFE_SB_ValueToMsgId(UT_MSGID);
+    SB_BRIDGE_Data.PeerSubs[0].PeerMask = 0x2;
+    SB_BRIDGE_Data.PeerSubCount         = 1;
+
+    return StubRetcode;
+}
+
+/*
+ * Capture the options set on the bridge pipe
+ */
+static uint8 UT_PipeOpts;
+
+static int32 UT_SetPipeOptsHook(void *UserObj, int32 StubRetcode, uint32 CallCount, const UT_StubContext_t *Context)
+{
+    UT_PipeOpts = UT_Hook_GetArgValueByName(Context, "Opts", uint8);
+
+    return StubRetcode;
+}
+
+/*
+ * Hand out the buffer passed as UserObj, unless a status code is set
+ */
+static void UT_Handler_AllocateMessageBuffer(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_SB_Buffer_t *BufPtr = UserObj;
+    int32            status;
+
+    if (UT_Stub_GetInt32StatusCode(Context, &status) && status != CFE_SUCCESS)
+    {
+        BufPtr = NULL;
+    }
+
+    UT_Stub_SetReturnValue(FuncKey, BufPtr);
+}
+
+/*
+ * Copy the record payload from the data passed as UserObj
+ */
+static void UT_Handler_LinkCopyOut(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    void * Dest   = UT_Hook_GetArgValueByName(Context, "Dest", void *);
+    size_t Length = UT_Hook_GetArgValueByName(Context, "Length", size_t);
+
+    memcpy(Dest, UserObj, Length);
+}
+
+/*
+ * Pass one record from the peer in Slot to the bridge with its payload in
+ * Src; a message is injected into Dest
+ */
+static void UT_FromPeer(uint32 Slot, uint16 Type, const void *Src, uint32 Length, UT_Buf_t *Dest)
+{
+    SB_BRIDGE_RecHdr_t Hdr;
+
+    Hdr.Length = Length;
+    Hdr.Type   = Type;
+    Hdr.Spare  = 0;
+
+    UT_SetHandlerFunction(UT_KEY(CFE_SB_AllocateMessageBuffer), UT_Handler_AllocateMessageBuffer, Dest);
+    UT_SetHandlerFunction(UT_KEY(SB_BRIDGE_LinkCopyOut), UT_Handler_LinkCopyOut, (void *)Src);
+
+    SB_BRIDGE_ProcessPeer(Slot, &Hdr);
+}
+
+/*
+ * The peer in Slot publishes Msg, which the bridge injects locally in Dest
+ */
+static void UT_PeerPublishes(uint32 Slot, const UT_Buf_t *Msg, UT_Buf_t *Dest)
+{
+    UT_FromPeer(Slot, SB_BRIDGE_REC_MSG, Msg, UT_MSG_SIZE, Dest);
+}
+
+/*
+ * The peer in Slot subscribes to or unsubscribes from MsgId
+ */
+static void UT_PeerSubscription(uint32 Slot, uint16 Type, CFE_SB_MsgId_Atom_t MsgId)
+{
+    UT_FromPeer(Slot, Type, &MsgId, sizeof(MsgId), NULL);
+}
+
+/*
+**********************************************************************************
+**          TEST CASE FUNCTIONS
+**********************************************************************************
+*/
+
+void Test_SB_BRIDGE_AppMain(void)
+{
+    /*
+     * Test Case For:
+     * void SB_BRIDGE_AppMain( void )
+     */
+    UT_Buf_t         Msg;
+    CFE_SB_Buffer_t *BufPtr = &Msg.Buf;
+
+    /* nominal, no loop iterations */
+    SB_BRIDGE_AppMain();
+    UtAssert_STUB_COUNT(CFE_ES_ExitApp, 1);
+    UtAssert_STUB_COUNT(CFE_ES_DeleteChildTask, 1);
+    UtAssert_STUB_COUNT(SB_BRIDGE_LinkClose, 1);
+
+    /* initialization fails before the receive task is created */
+    UT_SetDeferredRetcode(UT_KEY(CFE_EVS_Register), 1, CFE_EVS_INVALID_PARAMETER);
+    SB_BRIDGE_AppMain();
+    UtAssert_STUB_COUNT(CFE_ES_ExitApp, 2);
+    UtAssert_STUB_COUNT(CFE_ES_DeleteChildTask, 1);
+
+    /* a message to forward, a timeout and a pipe error */
+    UT_SetHookFunction(UT_KEY(CFE_ES_CreateChildTask), UT_CreateChildTaskHook, NULL);
+    UT_InitMsg(&Msg, UT_MSGID, 1, 1);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RunLoop), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RunLoop), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RunLoop), 1, true);
+    UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &BufPtr, sizeof(BufPtr), false);
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 2, CFE_SB_TIME_OUT);
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SB_PIPE_RD_ERR);
+    SB_BRIDGE_AppMain();
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 3);
+    UtAssert_STUB_COUNT(SB_BRIDGE_LinkPut, 2 * UT_NUM_PEERS + 1);
+    UtAssert_UINT32_EQ(SB_BRIDGE_Data.TxMsgCount, 1);
+}
+
+void Test_SB_BRIDGE_AppMain_Resync(void)
+{
+    /*
+     * Test Case For:
+     * void SB_BRIDGE_AppMain( void )
+     * re-sending the subscriptions after one did not fit in a ring
+     */
+    UT_Buf_t         Report;
+    UT_Buf_t         Msg;
+    CFE_SB_Buffer_t *BufPtrs[2];
+
+    UT_InitMsg(&Report, CFE_SB_ONESUB_TLM_MID, 0, 0);
+    Report.Fields.Size          = sizeof(Report.OneSub);
+    Report.OneSub.Payload.MsgId = CFE_SB_ValueToMsgId(UT_MSGID);
+    UT_InitMsg(&Msg, UT_MSGID, 1, 1);
+
+    /* the local SB is asked for all subscriptions again right away */
+    BufPtrs[0] = &Report.Buf;
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RunLoop), 1, true);
+    UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), BufPtrs, sizeof(BufPtrs[0]), false);
+    UT_SetDeferredRetcode(UT_KEY(SB_BRIDGE_LinkPut), UT_NUM_PEERS + 2, -1);
+    SB_BRIDGE_AppMain();
+    UtAssert_BOOL_FALSE(SB_BRIDGE_Data.ResyncPending);
+    UtAssert_STUB_COUNT(SB_BRIDGE_LinkPut, 2 * UT_NUM_PEERS);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 3);
+
+    /* but not while a ring is too full to forward messages */
+    UT_ResetState(0);
+    SB_BRIDGE_UT_Setup();
+    UT_SetHookFunction(UT_KEY(CFE_ES_CreateChildTask), UT_CreateChildTaskHook, NULL);
+    BufPtrs[0] = &Msg.Buf;
+    BufPtrs[1] = &Report.Buf;
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RunLoop), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RunLoop), 1, true);
+    UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), BufPtrs, sizeof(BufPtrs), false);
+    UT_SetDeferredRetcode(UT_KEY(SB_BRIDGE_LinkPut), UT_NUM_PEERS + 1, -1);
+    UT_SetDeferredRetcode(UT_KEY(SB_BRIDGE_LinkPut), 1, -1);
+    SB_BRIDGE_AppMain();
+    UtAssert_BOOL_TRUE(SB_BRIDGE_Data.ResyncPending);
+    UtAssert_UINT32_EQ(SB_BRIDGE_Data.TxStalled, 0x2);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 2);
+}
+
+void Test_SB_BRIDGE_Init(void)
+{
+    /*
+     * Test Case For:
+     * CFE_Status_t SB_BRIDGE_Init( void )
+     */
+
+    UT_SetHookFunction(UT_KEY(CFE_SB_SetPipeOpts), UT_SetPipeOptsHook, NULL);
+
+    /* nominal, ask every peer for its subscriptions and the local SB for ours */
+    UtAssert_INT32_EQ(SB_BRIDGE_Init(), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(SB_BRIDGE_LinkPut, UT_NUM_PEERS);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 2);
+    UtAssert_STUB_COUNT(CFE_SB_SubscribeLocal, 2);
+    UtAssert_STUB_COUNT(CFE_TBL_ReleaseAddress, 1);
+    UtAssert_StrCmp(SB_BRIDGE_Data.Config.SegmentName, UT_ConfigTable.SegmentName, "Configured segment name");
+
+    /* what the bridge injects does not come back on its own pipe */
+    UtAssert_UINT32_EQ(UT_PipeOpts, CFE_SB_PIPEOPTS_IGNOREMINE);
+
+    /* a configuration table that was just loaded is used as well */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, CFE_TBL_INFO_UPDATED);
+    UtAssert_INT32_EQ(SB_BRIDGE_Init(), CFE_SUCCESS);
+
+    /* each step failing stops the initialization there */
+    UT_SetDeferredRetcode(UT_KEY(CFE_EVS_Register), 1, CFE_EVS_INVALID_PARAMETER);
+    UtAssert_INT32_EQ(SB_BRIDGE_Init(), CFE_EVS_INVALID_PARAMETER);
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_Register), 1, CFE_TBL_ERR_INVALID_NAME);
+    UtAssert_INT32_EQ(SB_BRIDGE_Init(), CFE_TBL_ERR_INVALID_NAME);
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_Load), 1, CFE_TBL_ERR_ACCESS);
+    UtAssert_INT32_EQ(SB_BRIDGE_Init(), CFE_TBL_ERR_ACCESS);
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, CFE_TBL_ERR_NEVER_LOADED);
+    UtAssert_INT32_EQ(SB_BRIDGE_Init(), CFE_TBL_ERR_NEVER_LOADED);
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_CreatePipe), 1, CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(SB_BRIDGE_Init(), CFE_SB_BAD_ARGUMENT);
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_SetPipeOpts), 1, CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(SB_BRIDGE_Init(), CFE_SB_BAD_ARGUMENT);
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_SubscribeLocal), 2, CFE_SB_MAX_MSGS_MET);
+    UtAssert_INT32_EQ(SB_BRIDGE_Init(), CFE_SB_MAX_MSGS_MET);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_MutSemCreate), 1, OS_ERROR);
+    UtAssert_INT32_EQ(SB_BRIDGE_Init(), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+
+    UT_SetDeferredRetcode(UT_KEY(SB_BRIDGE_LinkOpen), 1, CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+    UtAssert_INT32_EQ(SB_BRIDGE_Init(), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CreateChildTask), 1, CFE_ES_ERR_CHILD_TASK_CREATE);
+    UtAssert_INT32_EQ(SB_BRIDGE_Init(), CFE_ES_ERR_CHILD_TASK_CREATE);
+
+    UtAssert_STUB_COUNT(SB_BRIDGE_LinkPut, 2 * UT_NUM_PEERS);
+}
+
+void Test_SB_BRIDGE_ValidateConfig(void)
+{
+    /*
+     * Test Case For:
+     * CFE_Status_t SB_BRIDGE_ValidateConfig(void *TblData)
+     */
+    SB_BRIDGE_ConfigTable_t Config;
+
+    /* nominal, with all peers or with a full list of them */
+    memset(&Config, 0, sizeof(Config));
+    strncpy(Config.SegmentName, "/cfs", sizeof(Config.SegmentName) - 1);
+    UtAssert_INT32_EQ(SB_BRIDGE_ValidateConfig(&Config), CFE_SUCCESS);
+    Config.NumPeers = SB_BRIDGE_MAX_PEERS - 1;
+    UtAssert_INT32_EQ(SB_BRIDGE_ValidateConfig(&Config), CFE_SUCCESS);
+
+    /* too many peers */
+    Config.NumPeers = SB_BRIDGE_MAX_PEERS;
+    UtAssert_INT32_EQ(SB_BRIDGE_ValidateConfig(&Config), CFE_STATUS_VALIDATION_FAILURE);
+    Config.NumPeers = 0;
+
+    /* the name must be a terminated POSIX shared memory object name */
+    strncpy(Config.SegmentName, "cfs", sizeof(Config.SegmentName) - 1);
+    UtAssert_INT32_EQ(SB_BRIDGE_ValidateConfig(&Config), CFE_STATUS_VALIDATION_FAILURE);
+    strncpy(Config.SegmentName, "/", sizeof(Config.SegmentName) - 1);
+    UtAssert_INT32_EQ(SB_BRIDGE_ValidateConfig(&Config), CFE_STATUS_VALIDATION_FAILURE);
+    memset(Config.SegmentName, '/', sizeof(Config.SegmentName));
+    UtAssert_INT32_EQ(SB_BRIDGE_ValidateConfig(&Config), CFE_STATUS_VALIDATION_FAILURE);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 4);
+}
+
+void Test_SB_BRIDGE_PeerSet(void)
+{
+    /*
+     * Test Case For:
+     * void SB_BRIDGE_ProcessPeer(uint32 Slot, const SB_BRIDGE_RecHdr_t *Hdr)
+     * void SB_BRIDGE_ProcessLocal(const CFE_SB_Buffer_t *BufPtr)
+     * with a configured peer set
+     */
+    UT_Buf_t Msg;
+
+    /* only processor 3, in slot 2, is a peer */
+    SB_BRIDGE_Data.Config.NumPeers   = 2;
+    SB_BRIDGE_Data.Config.PeerIds[0] = 7;
+    SB_BRIDGE_Data.Config.PeerIds[1] = 3;
+    UT_SetHookFunction(UT_KEY(SB_BRIDGE_LinkPut), UT_LinkPutHook, NULL);
+    UT_PutSlots = 0;
+
+    /* records from other instances are discarded */
+    UT_PeerSubscription(1, SB_BRIDGE_REC_SUB, UT_MSGID);
+    UT_PeerSubscription(3, SB_BRIDGE_REC_RESYNC, UT_MSGID);
+    UtAssert_STUB_COUNT(CFE_SB_SubscribeLocal, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UT_PeerSubscription(2, SB_BRIDGE_REC_SUB, UT_MSGID);
+    UtAssert_STUB_COUNT(CFE_SB_SubscribeLocal, 1);
+
+    /* a slot nobody holds is not a peer */
+    UT_SetDeferredRetcode(UT_KEY(SB_BRIDGE_LinkGetPeer), 1, -1);
+    UT_PeerSubscription(2, SB_BRIDGE_REC_SUB, UT_MSGID_ALT);
+    UtAssert_STUB_COUNT(CFE_SB_SubscribeLocal, 1);
+
+    /* local subscriptions only go to the peer */
+    UT_InitMsg(&Msg, CFE_SB_ONESUB_TLM_MID, 0, 0);
+    Msg.Fields.Size          = sizeof(Msg.OneSub);
+    Msg.OneSub.Payload.MsgId = CFE_SB_ValueToMsgId(UT_MSGID);
+    SB_BRIDGE_ProcessLocal(&Msg.Buf);
+    UtAssert_STUB_COUNT(SB_BRIDGE_LinkPut, 1);
+    UtAssert_UINT32_EQ(UT_PutSlots, 0x4);
+}
+
+void Test_SB_BRIDGE_ProcessLocal_SubReports(void)
+{
+    /*
+     * Test Case For:
+     * void SB_BRIDGE_ProcessLocal(const CFE_SB_Buffer_t *BufPtr)
+     * with the SB subscription reports
+     */
+    UT_Buf_t Msg;
+
+    UT_SetHookFunction(UT_KEY(SB_BRIDGE_LinkPut), UT_LinkPutHook, NULL);
+    UT_PutSlots = 0;
+
+    /* one subscription, then one unsubscription, each passed to every peer */
+    UT_InitMsg(&Msg, CFE_SB_ONESUB_TLM_MID, 0, 0);
+    Msg.Fields.Size            = sizeof(Msg.OneSub);
+    Msg.OneSub.Payload.MsgId   = CFE_SB_ValueToMsgId(UT_MSGID);
+    Msg.OneSub.Payload.SubType = CFE_SB_SUBSCRIPTION;
+    SB_BRIDGE_ProcessLocal(&Msg.Buf);
+    UtAssert_STUB_COUNT(SB_BRIDGE_LinkPut, UT_NUM_PEERS);
+    UtAssert_UINT32_EQ(UT_PutType, SB_BRIDGE_REC_SUB);
+    UtAssert_UINT32_EQ(UT_PutSlots, ((uint32)1 << SB_BRIDGE_MAX_PEERS) - 2);
+
+    Msg.OneSub.Payload.SubType = CFE_SB_UNSUBSCRIPTION;
+    SB_BRIDGE_ProcessLocal(&Msg.Buf);
+    UtAssert_STUB_COUNT(SB_BRIDGE_LinkPut, 2 * UT_NUM_PEERS);
+    UtAssert_UINT32_EQ(UT_PutType, SB_BRIDGE_REC_UNSUB);
+
+    /* a report that does not fit in one of the rings asks for a resync */
+    UT_SetDeferredRetcode(UT_KEY(SB_BRIDGE_LinkPut), 1, -1);
+    SB_BRIDGE_ProcessLocal(&Msg.Buf);
+    UtAssert_BOOL_TRUE(SB_BRIDGE_Data.ResyncPending);
+
+    /* a truncated report is ignored */
+    Msg.Fields.Size = sizeof(Msg.OneSub) - 1;
+    SB_BRIDGE_ProcessLocal(&Msg.Buf);
+    UtAssert_STUB_COUNT(SB_BRIDGE_LinkPut, 3 * UT_NUM_PEERS);
+
+    /* all subscriptions, each passed on */
+    UT_InitMsg(&Msg, CFE_SB_ALLSUBS_TLM_MID, 0, 0);
+    Msg.Fields.Size                    = sizeof(Msg.AllSubs);
+    Msg.AllSubs.Payload.Entries        = 2;
+    Msg.AllSubs.Payload.Entry[0].MsgId = CFE_SB_ValueToMsgId(UT_MSGID);
+    Msg.AllSubs.Payload.Entry[1].MsgId = CFE_SB_ValueToMsgId(UT_MSGID_ALT);
+    SB_BRIDGE_ProcessLocal(&Msg.Buf);
+    UtAssert_STUB_COUNT(SB_BRIDGE_LinkPut, 5 * UT_NUM_PEERS);
+    UtAssert_UINT32_EQ(UT_PutType, SB_BRIDGE_REC_SUB);
+
+    /* the entry count is not trusted beyond the packet */
+    Msg.AllSubs.Payload.Entries = CFE_SB_SUB_ENTRIES_PER_PKT + 1;
+    SB_BRIDGE_ProcessLocal(&Msg.Buf);
+    UtAssert_STUB_COUNT(SB_BRIDGE_LinkPut, (5 + CFE_SB_SUB_ENTRIES_PER_PKT) * UT_NUM_PEERS);
+
+    Msg.Fields.Size = sizeof(Msg.AllSubs) - 1;
+    SB_BRIDGE_ProcessLocal(&Msg.Buf);
+    UtAssert_STUB_COUNT(SB_BRIDGE_LinkPut, (5 + CFE_SB_SUB_ENTRIES_PER_PKT) * UT_NUM_PEERS);
+}
+
+void Test_SB_BRIDGE_ProcessLocal_Forward(void)
+{
+    /*
+     * Test Case For:
+     * void SB_BRIDGE_ProcessLocal(const CFE_SB_Buffer_t *BufPtr)
+     * with a message peers subscribed to
+     */
+    UT_Buf_t Msg;
+
+    UT_SetHookFunction(UT_KEY(SB_BRIDGE_LinkPut), UT_LinkPutHook, NULL);
+    UT_PutSlots = 0;
+    UT_InitMsg(&Msg, UT_MSGID, 1, 1);
+
+    /* nothing goes out before a peer subscribes */
+    SB_BRIDGE_ProcessLocal(&Msg.Buf);
+    UtAssert_STUB_COUNT(SB_BRIDGE_LinkPut, 0);
+
+    /* nominal, to each subscribed peer only */
+    UT_PeerSubscription(1, SB_BRIDGE_REC_SUB, UT_MSGID);
+    UT_PeerSubscription(3, SB_BRIDGE_REC_SUB, UT_MSGID);
+    SB_BRIDGE_ProcessLocal(&Msg.Buf);
+    UtAssert_UINT32_EQ(UT_PutType, SB_BRIDGE_REC_MSG);
+    UtAssert_UINT32_EQ(UT_PutSlots, 0xA);
+    UtAssert_UINT32_EQ(SB_BRIDGE_Data.TxMsgCount, 2);
+
+    /* the ring to one peer is full, only the first drop is reported */
+    UT_SetDeferredRetcode(UT_KEY(SB_BRIDGE_LinkPut), 1, -1);
+    UT_SetDeferredRetcode(UT_KEY(SB_BRIDGE_LinkPut), 2, -1);
+    SB_BRIDGE_ProcessLocal(&Msg.Buf);
+    SB_BRIDGE_ProcessLocal(&Msg.Buf);
+    UtAssert_UINT32_EQ(SB_BRIDGE_Data.TxDropCount, 2);
+    UtAssert_UINT32_EQ(SB_BRIDGE_Data.TxMsgCount, 4);
+    UtAssert_UINT32_EQ(SB_BRIDGE_Data.TxStalled, 0x2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+
+    /* forwarding resumes */
+    SB_BRIDGE_ProcessLocal(&Msg.Buf);
+    UtAssert_UINT32_EQ(SB_BRIDGE_Data.TxMsgCount, 6);
+    UtAssert_UINT32_EQ(SB_BRIDGE_Data.TxStalled, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 3);
+}
+
+void Test_SB_BRIDGE_ProcessPeer_Msg(void)
+{
+    /*
+     * Test Case For:
+     * void SB_BRIDGE_ProcessPeer(uint32 Slot, const SB_BRIDGE_RecHdr_t *Hdr)
+     * with messages from a peer
+     */
+    UT_Buf_t PeerMsg;
+    UT_Buf_t Injected;
+
+    UT_InitMsg(&PeerMsg, UT_MSGID, 1, 1);
+
+    /* too short to be a message */
+    UT_FromPeer(1, SB_BRIDGE_REC_MSG, &PeerMsg, sizeof(CFE_MSG_Message_t) - 1, &Injected);
+    UtAssert_UINT32_EQ(SB_BRIDGE_Data.RxErrCount, 1);
+    UtAssert_STUB_COUNT(CFE_SB_AllocateMessageBuffer, 0);
+
+    /* no buffer */
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_AllocateMessageBuffer), 1, -1);
+    UT_PeerPublishes(1, &PeerMsg, &Injected);
+    UtAssert_UINT32_EQ(SB_BRIDGE_Data.RxErrCount, 2);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 0);
+
+    /* nominal, published without a new sequence count or time stamp */
+    UT_PeerPublishes(1, &PeerMsg, &Injected);
+    UtAssert_UINT32_EQ(SB_BRIDGE_Data.RxMsgCount, 1);
+    UtAssert_MemCmp(&Injected, &PeerMsg, UT_MSG_SIZE, "Injected message content");
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 1);
+
+    /* could not be published */
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_TransmitBuffer), 1, CFE_SB_BAD_ARGUMENT);
+    UT_PeerPublishes(1, &PeerMsg, &Injected);
+    UtAssert_UINT32_EQ(SB_BRIDGE_Data.RxErrCount, 3);
+    UtAssert_STUB_COUNT(CFE_SB_ReleaseMessageBuffer, 1);
+
+    /* an unknown record type */
+    UT_FromPeer(1, 0, NULL, 0, NULL);
+    UtAssert_UINT32_EQ(SB_BRIDGE_Data.RxErrCount, 4);
+}
+
+void Test_SB_BRIDGE_ProcessPeer_Subs(void)
+{
+    /*
+     * Test Case For:
+     * void SB_BRIDGE_ProcessPeer(uint32 Slot, const SB_BRIDGE_RecHdr_t *Hdr)
+     * with subscription changes made on the peers
+     */
+    CFE_SB_MsgId_Atom_t Value = UT_MSGID;
+    uint32              i;
+
+    /* nominal, subscribed once however often and by however many peers it is reported */
+    UT_PeerSubscription(1, SB_BRIDGE_REC_SUB, UT_MSGID);
+    UT_PeerSubscription(1, SB_BRIDGE_REC_SUB, UT_MSGID);
+    UT_PeerSubscription(2, SB_BRIDGE_REC_SUB, UT_MSGID);
+    UtAssert_STUB_COUNT(CFE_SB_SubscribeLocal, 1);
+    UtAssert_UINT32_EQ(SB_BRIDGE_Data.PeerSubCount, 1);
+    UtAssert_UINT32_EQ(SB_BRIDGE_Data.PeerSubs[0].PeerMask, 0x6);
+
+    /* invalid, the subscription reports themselves, or a bad length */
+    UT_PeerSubscription(1, SB_BRIDGE_REC_SUB, CFE_SB_MsgIdToValue(CFE_SB_INVALID_MSG_ID));
+    UT_PeerSubscription(1, SB_BRIDGE_REC_SUB, CFE_SB_ONESUB_TLM_MID);
+    UT_PeerSubscription(1, SB_BRIDGE_REC_SUB, CFE_SB_ALLSUBS_TLM_MID);
+    UT_FromPeer(1, SB_BRIDGE_REC_SUB, &Value, sizeof(Value) - 1, NULL);
+    UtAssert_STUB_COUNT(CFE_SB_SubscribeLocal, 1);
+
+    /* the local subscription fails */
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_SubscribeLocal), 1, CFE_SB_MAX_MSGS_MET);
+    UT_PeerSubscription(1, SB_BRIDGE_REC_SUB, UT_MSGID_ALT);
+    UtAssert_UINT32_EQ(SB_BRIDGE_Data.PeerSubCount, 1);
+
+    /* unsubscribing, which is only done for a MsgId bridged to that peer */
+    UT_PeerSubscription(1, SB_BRIDGE_REC_UNSUB, UT_MSGID_ALT);
+    UT_PeerSubscription(3, SB_BRIDGE_REC_UNSUB, UT_MSGID);
+    UtAssert_UINT32_EQ(SB_BRIDGE_Data.PeerSubs[0].PeerMask, 0x6);
+
+    /* the route stays while another peer wants it */
+    UT_PeerSubscription(1, SB_BRIDGE_REC_UNSUB, UT_MSGID);
+    UtAssert_UINT32_EQ(SB_BRIDGE_Data.PeerSubs[0].PeerMask, 0x4);
+    UtAssert_STUB_COUNT(CFE_SB_UnsubscribeLocal, 0);
+    UT_PeerSubscription(2, SB_BRIDGE_REC_UNSUB, UT_MSGID);
+    UtAssert_STUB_COUNT(CFE_SB_UnsubscribeLocal, 1);
+    UtAssert_UINT32_EQ(SB_BRIDGE_Data.PeerSubCount, 0);
+
+    /* the table is full */
+    for (i = 0; i <= SB_BRIDGE_MAX_PEER_SUBS; ++i)
+    {
+        UT_PeerSubscription(1, SB_BRIDGE_REC_SUB, UT_MSGID + i);
+    }
+    UtAssert_UINT32_EQ(SB_BRIDGE_Data.PeerSubCount, SB_BRIDGE_MAX_PEER_SUBS);
+
+    /* the peer asks for our subscriptions */
+    UT_FromPeer(1, SB_BRIDGE_REC_RESYNC, NULL, 0, NULL);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(SB_BRIDGE_AppMain);
+    ADD_TEST(SB_BRIDGE_AppMain_Resync);
+    ADD_TEST(SB_BRIDGE_Init);
+    ADD_TEST(SB_BRIDGE_ValidateConfig);
+    ADD_TEST(SB_BRIDGE_PeerSet);
+    ADD_TEST(SB_BRIDGE_ProcessLocal_SubReports);
+    ADD_TEST(SB_BRIDGE_ProcessLocal_Forward);
+    ADD_TEST(SB_BRIDGE_ProcessPeer_Msg);
+    ADD_TEST(SB_BRIDGE_ProcessPeer_Subs);
+}
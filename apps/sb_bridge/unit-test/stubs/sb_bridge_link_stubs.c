@@ -0,0 +1,159 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in sb_bridge_link header
+ */
+
+#include "sb_bridge_link.h"
+#include "utgenstub.h"
+
+void UT_DefaultHandler_SB_BRIDGE_LinkCopyOut(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_SB_BRIDGE_LinkGetPeer(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_SB_BRIDGE_LinkPeek(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_SB_BRIDGE_LinkPut(void *, UT_EntryKey_t, const UT_StubContext_t *);
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SB_BRIDGE_LinkClose()
+ * ----------------------------------------------------
+ */
+void SB_BRIDGE_LinkClose(SB_BRIDGE_Link_t *Link)
+{
+    UT_GenStub_AddParam(SB_BRIDGE_LinkClose, SB_BRIDGE_Link_t *, Link);
+
+    UT_GenStub_Execute(SB_BRIDGE_LinkClose, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SB_BRIDGE_LinkCopyOut()
+ * ----------------------------------------------------
+ */
+void SB_BRIDGE_LinkCopyOut(SB_BRIDGE_Link_t *Link, uint32 Slot, void *Dest, size_t Length)
+{
+    UT_GenStub_AddParam(SB_BRIDGE_LinkCopyOut, SB_BRIDGE_Link_t *, Link);
+    UT_GenStub_AddParam(SB_BRIDGE_LinkCopyOut, uint32, Slot);
+    UT_GenStub_AddParam(SB_BRIDGE_LinkCopyOut, void *, Dest);
+    UT_GenStub_AddParam(SB_BRIDGE_LinkCopyOut, size_t, Length);
+
+    UT_GenStub_Execute(SB_BRIDGE_LinkCopyOut, Basic, UT_DefaultHandler_SB_BRIDGE_LinkCopyOut);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SB_BRIDGE_LinkGetPeer()
+ * ----------------------------------------------------
+ */
+bool SB_BRIDGE_LinkGetPeer(SB_BRIDGE_Link_t *Link, uint32 Slot, uint32 *ProcessorId)
+{
+    UT_GenStub_SetupReturnBuffer(SB_BRIDGE_LinkGetPeer, bool);
+
+    UT_GenStub_AddParam(SB_BRIDGE_LinkGetPeer, SB_BRIDGE_Link_t *, Link);
+    UT_GenStub_AddParam(SB_BRIDGE_LinkGetPeer, uint32, Slot);
+    UT_GenStub_AddParam(SB_BRIDGE_LinkGetPeer, uint32 *, ProcessorId);
+
+    UT_GenStub_Execute(SB_BRIDGE_LinkGetPeer, Basic, UT_DefaultHandler_SB_BRIDGE_LinkGetPeer);
+
+    return UT_GenStub_GetReturnValue(SB_BRIDGE_LinkGetPeer, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SB_BRIDGE_LinkOpen()
+ * ----------------------------------------------------
+ */
+CFE_Status_t SB_BRIDGE_LinkOpen(SB_BRIDGE_Link_t *Link, const char *Name, uint32 LocalId)
+{
+    UT_GenStub_SetupReturnBuffer(SB_BRIDGE_LinkOpen, CFE_Status_t);
+
+    UT_GenStub_AddParam(SB_BRIDGE_LinkOpen, SB_BRIDGE_Link_t *, Link);
+    UT_GenStub_AddParam(SB_BRIDGE_LinkOpen, const char *, Name);
+    UT_GenStub_AddParam(SB_BRIDGE_LinkOpen, uint32, LocalId);
+
+    UT_GenStub_Execute(SB_BRIDGE_LinkOpen, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(SB_BRIDGE_LinkOpen, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SB_BRIDGE_LinkPeek()
+ * ----------------------------------------------------
+ */
+bool SB_BRIDGE_LinkPeek(SB_BRIDGE_Link_t *Link, uint32 Slot, SB_BRIDGE_RecHdr_t *Hdr)
+{
+    UT_GenStub_SetupReturnBuffer(SB_BRIDGE_LinkPeek, bool);
+
+    UT_GenStub_AddParam(SB_BRIDGE_LinkPeek, SB_BRIDGE_Link_t *, Link);
+    UT_GenStub_AddParam(SB_BRIDGE_LinkPeek, uint32, Slot);
+    UT_GenStub_AddParam(SB_BRIDGE_LinkPeek, SB_BRIDGE_RecHdr_t *, Hdr);
+
+    UT_GenStub_Execute(SB_BRIDGE_LinkPeek, Basic, UT_DefaultHandler_SB_BRIDGE_LinkPeek);
+
+    return UT_GenStub_GetReturnValue(SB_BRIDGE_LinkPeek, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SB_BRIDGE_LinkPut()
+ * ----------------------------------------------------
+ */
+bool SB_BRIDGE_LinkPut(SB_BRIDGE_Link_t *Link, uint32 Slot, uint16 Type, const void *Data, size_t Length)
+{
+    UT_GenStub_SetupReturnBuffer(SB_BRIDGE_LinkPut, bool);
+
+    UT_GenStub_AddParam(SB_BRIDGE_LinkPut, SB_BRIDGE_Link_t *, Link);
+    UT_GenStub_AddParam(SB_BRIDGE_LinkPut, uint32, Slot);
+    UT_GenStub_AddParam(SB_BRIDGE_LinkPut, uint16, Type);
+    UT_GenStub_AddParam(SB_BRIDGE_LinkPut, const void *, Data);
+    UT_GenStub_AddParam(SB_BRIDGE_LinkPut, size_t, Length);
+
+    UT_GenStub_Execute(SB_BRIDGE_LinkPut, Basic, UT_DefaultHandler_SB_BRIDGE_LinkPut);
+
+    return UT_GenStub_GetReturnValue(SB_BRIDGE_LinkPut, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SB_BRIDGE_LinkRelease()
+ * ----------------------------------------------------
+ */
+void SB_BRIDGE_LinkRelease(SB_BRIDGE_Link_t *Link, uint32 Slot, const SB_BRIDGE_RecHdr_t *Hdr)
+{
+    UT_GenStub_AddParam(SB_BRIDGE_LinkRelease, SB_BRIDGE_Link_t *, Link);
+    UT_GenStub_AddParam(SB_BRIDGE_LinkRelease, uint32, Slot);
+    UT_GenStub_AddParam(SB_BRIDGE_LinkRelease, const SB_BRIDGE_RecHdr_t *, Hdr);
+
+    UT_GenStub_Execute(SB_BRIDGE_LinkRelease, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SB_BRIDGE_LinkWait()
+ * ----------------------------------------------------
+ */
+void SB_BRIDGE_LinkWait(SB_BRIDGE_Link_t *Link, uint32 Msecs)
+{
+    UT_GenStub_AddParam(SB_BRIDGE_LinkWait, SB_BRIDGE_Link_t *, Link);
+    UT_GenStub_AddParam(SB_BRIDGE_LinkWait, uint32, Msecs);
+
+    UT_GenStub_Execute(SB_BRIDGE_LinkWait, Basic, NULL);
+}
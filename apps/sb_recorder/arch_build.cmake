@@ -0,0 +1,32 @@
+###########################################################
+#
+# SB_RECORDER platform build setup
+#
+# This file is evaluated as part of the "prepare" stage
+# and can be used to set up prerequisites for the build,
+# such as generating header files
+#
+###########################################################
+
+# The list of header files that control the SB_RECORDER configuration
+set(SB_RECORDER_PLATFORM_CONFIG_FILE_LIST
+  sb_recorder_platform_cfg.h
+  sb_recorder_perfids.h
+  sb_recorder_msgids.h
+)
+
+# Create wrappers around the all the config header files
+# This makes them individually overridable by the missions, without modifying
+# the distribution default copies
+foreach(SB_RECORDER_CFGFILE ${SB_RECORDER_PLATFORM_CONFIG_FILE_LIST})
+  get_filename_component(CFGKEY "${SB_RECORDER_CFGFILE}" NAME_WE)
+  if (DEFINED SB_RECORDER_CFGFILE_SRC_${CFGKEY})
+    set(DEFAULT_SOURCE GENERATED_FILE "${SB_RECORDER_CFGFILE_SRC_${CFGKEY}}")
+  else()
+    set(DEFAULT_SOURCE FALLBACK_FILE "${CMAKE_CURRENT_LIST_DIR}/config/default_${SB_RECORDER_CFGFILE}")
+  endif()
+  generate_config_includefile(
+    FILE_NAME           "${SB_RECORDER_CFGFILE}"
+    ${DEFAULT_SOURCE}
+  )
+endforeach()
@@ -0,0 +1,98 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * SB Recorder Application Platform Configuration Header File
+ *
+ * A recording made on one platform can only be replayed on a platform with
+ * the same byte order and an SB message size limit at least as large as
+ * the largest recorded message.
+ */
+#ifndef SB_RECORDER_PLATFORM_CFG_H
+#define SB_RECORDER_PLATFORM_CFG_H
+
+/**
+ * \brief Depth and name of the pipe carrying commands and recorded messages
+ *
+ * The depth may not exceed the OSAL queue depth limit.  Messages arriving
+ * while the pipe is full are dropped by SB, never held by the publisher.
+ */
+#define SB_RECORDER_PIPE_DEPTH 50
+#define SB_RECORDER_PIPE_NAME  "SB_RECORDER_PIPE"
+
+/**
+ * \brief Message limit used for each recorded MsgId
+ */
+#define SB_RECORDER_MSG_LIM 32
+
+/**
+ * \brief Pipe receive timeout, in milliseconds
+ *
+ * A partly filled chunk is written out when no message has arrived for
+ * this long, which bounds how much of a recording is lost on a crash.
+ */
+#define SB_RECORDER_RCV_TIMEOUT 1000
+
+/**
+ * \brief Size in bytes of one chunk of the recording file
+ *
+ * Each chunk is written with one file write.  A chunk must be able to hold
+ * the largest SB message plus the chunk and record headers.
+ */
+#define SB_RECORDER_CHUNK_SIZE (64 * 1024)
+
+/**
+ * \brief Number of chunk buffers
+ *
+ * One buffer is filled while the others are being written.  If all of them
+ * are still in flight when another message arrives, the message is dropped
+ * and counted rather than waiting for the file system.
+ */
+#define SB_RECORDER_NUM_CHUNKS 4
+
+/**
+ * \brief Maximum number of chunks in one recording
+ *
+ * Sizes the chunk index written at the end of the file.  The recording is
+ * stopped when it is full.
+ */
+#define SB_RECORDER_MAX_CHUNKS 4096
+
+/**
+ * \brief Maximum number of MsgIds recorded at the same time
+ */
+#define SB_RECORDER_MAX_MSGIDS 256
+
+/**
+ * \brief Longest single sleep of the replay task, in milliseconds
+ *
+ * Long gaps in a recording are waited out in steps of this size so that a
+ * stop command takes effect promptly.
+ */
+#define SB_RECORDER_REPLAY_MAX_DELAY 100
+
+/**
+ * \brief Replay task name, stack size and priority
+ */
+#define SB_RECORDER_REPLAY_TASK_NAME       "SB_RECORDER_REPLAY"
+#define SB_RECORDER_REPLAY_TASK_STACK_SIZE 16384
+#define SB_RECORDER_REPLAY_TASK_PRIORITY   70
+
+#endif
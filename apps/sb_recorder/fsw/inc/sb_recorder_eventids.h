@@ -0,0 +1,50 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Define SB Recorder Event messages
+ */
+#ifndef SB_RECORDER_EVENTIDS_H
+#define SB_RECORDER_EVENTIDS_H
+
+/*****************************************************************************/
+
+/* Event message ID's */
+#define SB_RECORDER_EVM_RESERVED 0
+
+#define SB_RECORDER_INIT_INF_EID          1
+#define SB_RECORDER_CR_PIPE_ERR_EID       2
+#define SB_RECORDER_SUBSCRIBE_ERR_EID     3
+#define SB_RECORDER_RCV_ERR_EID           4
+#define SB_RECORDER_TASK_ERR_EID          5
+#define SB_RECORDER_CC_ERR_EID            6
+#define SB_RECORDER_LEN_ERR_EID           7
+#define SB_RECORDER_NOOP_INF_EID          8
+#define SB_RECORDER_BUSY_ERR_EID          9
+#define SB_RECORDER_REC_START_INF_EID     10
+#define SB_RECORDER_REC_STOP_INF_EID      11
+#define SB_RECORDER_REC_FILE_ERR_EID      12
+#define SB_RECORDER_REC_FULL_ERR_EID      13
+#define SB_RECORDER_REPLAY_START_INF_EID  14
+#define SB_RECORDER_REPLAY_DONE_INF_EID   15
+#define SB_RECORDER_REPLAY_FILE_ERR_EID   16
+
+/******************************************************************************/
+
+#endif
@@ -0,0 +1,84 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   SB Recorder file format
+ *
+ * A recording starts with a standard cFE file header (sub type
+ * SB_RECORDER_FS_SUBTYPE) followed by a sequence of chunks.  Each chunk is
+ * a SB_RECORDER_ChunkHdr_t and the records it holds; each record is a
+ * SB_RECORDER_RecordHdr_t followed by the complete SB message, padded to a
+ * multiple of 8 bytes.
+ *
+ * When a recording is stopped the chunk index is appended, followed by a
+ * SB_RECORDER_Trailer_t at the very end of the file.  A file without a
+ * valid trailer (for instance because the recorder did not stop cleanly)
+ * can still be read by walking the chunks from the start.
+ *
+ * Apart from the cFE file header, all values are in the byte order of the
+ * recording platform.
+ */
+#ifndef SB_RECORDER_FILE_H
+#define SB_RECORDER_FILE_H
+
+#include "common_types.h"
+#include "cfe_time_extern_typedefs.h"
+
+#define SB_RECORDER_FS_SUBTYPE    0x53425243 /* "SBRC" */
+#define SB_RECORDER_CHUNK_MAGIC   0x53424348 /* "SBCH" */
+#define SB_RECORDER_TRAILER_MAGIC 0x53424958 /* "SBIX" */
+
+/**
+ * \brief Record alignment within a chunk, in bytes
+ */
+#define SB_RECORDER_RECORD_ALIGN 8
+
+typedef struct
+{
+    uint32 Magic;       /**< \brief SB_RECORDER_CHUNK_MAGIC */
+    uint32 Length;      /**< \brief Chunk length in bytes, including this header */
+    uint32 Sequence;    /**< \brief Chunk number within the file, starting at 0 */
+    uint32 RecordCount; /**< \brief Number of records in the chunk */
+} SB_RECORDER_ChunkHdr_t;
+
+typedef struct
+{
+    CFE_TIME_SysTime_t Time;   /**< \brief Time at which the recorder took the message off its pipe */
+    uint32             Length; /**< \brief Message length in bytes, excluding this header and padding */
+    uint32             Spare;
+} SB_RECORDER_RecordHdr_t;
+
+typedef struct
+{
+    uint32             Offset;      /**< \brief File offset of the chunk */
+    uint32             Length;      /**< \brief Chunk length in bytes */
+    uint32             RecordCount; /**< \brief Number of records in the chunk */
+    uint32             Spare;
+    CFE_TIME_SysTime_t FirstTime; /**< \brief Time of the first record in the chunk */
+} SB_RECORDER_IndexEntry_t;
+
+typedef struct
+{
+    uint32 Magic;       /**< \brief SB_RECORDER_TRAILER_MAGIC */
+    uint32 IndexOffset; /**< \brief File offset of the first SB_RECORDER_IndexEntry_t, also the end of the chunks */
+    uint32 ChunkCount;  /**< \brief Number of index entries */
+    uint32 RecordCount; /**< \brief Number of records in the file */
+} SB_RECORDER_Trailer_t;
+
+#endif
@@ -0,0 +1,96 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   SB Recorder command definitions
+ *
+ * All commands are sent on SB_RECORDER_CMD_MID.  Recording and replay are
+ * mutually exclusive.
+ */
+#ifndef SB_RECORDER_MSG_H
+#define SB_RECORDER_MSG_H
+
+#include "common_types.h"
+#include "cfe_mission_cfg.h"
+#include "cfe_msg_hdr.h"
+#include "cfe_sb_extern_typedefs.h"
+
+/*
+** Command codes
+*/
+#define SB_RECORDER_NOOP_CC         0
+#define SB_RECORDER_START_RECORD_CC 1
+#define SB_RECORDER_STOP_RECORD_CC  2
+#define SB_RECORDER_START_REPLAY_CC 3
+#define SB_RECORDER_STOP_REPLAY_CC  4
+
+/**
+ * \brief Maximum number of MsgIds named in a start record command
+ */
+#define SB_RECORDER_MAX_CMD_MSGIDS 16
+
+/**
+ * \brief Command with no arguments
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+} SB_RECORDER_NoArgsCmd_t;
+
+typedef SB_RECORDER_NoArgsCmd_t SB_RECORDER_NoopCmd_t;
+typedef SB_RECORDER_NoArgsCmd_t SB_RECORDER_StopRecordCmd_t;
+typedef SB_RECORDER_NoArgsCmd_t SB_RECORDER_StopReplayCmd_t;
+
+/**
+ * \brief Start record command payload
+ */
+typedef struct
+{
+    char   Filename[CFE_MISSION_MAX_PATH_LEN]; /**< \brief Recording file, overwritten if it exists */
+    uint16 NumMsgIds;                          /**< \brief Number of entries used in MsgId, or 0 to record
+                                                            every MsgId subscribed to anywhere on the bus */
+    uint16 Spare;
+
+    CFE_SB_MsgId_t MsgId[SB_RECORDER_MAX_CMD_MSGIDS]; /**< \brief MsgIds to record */
+} SB_RECORDER_StartRecord_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_CommandHeader_t           CommandHeader; /**< \brief Command header */
+    SB_RECORDER_StartRecord_Payload_t Payload;       /**< \brief Command payload */
+} SB_RECORDER_StartRecordCmd_t;
+
+/**
+ * \brief Start replay command payload
+ */
+typedef struct
+{
+    char   Filename[CFE_MISSION_MAX_PATH_LEN]; /**< \brief Recording file to replay */
+    uint16 Speed; /**< \brief 1 replays with the recorded inter-arrival times, N replays N times faster,
+                             and 0 transmits every message as fast as SB accepts them */
+    uint16 Spare;
+} SB_RECORDER_StartReplay_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_CommandHeader_t           CommandHeader; /**< \brief Command header */
+    SB_RECORDER_StartReplay_Payload_t Payload;       /**< \brief Command payload */
+} SB_RECORDER_StartReplayCmd_t;
+
+#endif
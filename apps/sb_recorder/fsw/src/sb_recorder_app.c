@@ -0,0 +1,545 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *  This file contains the source code for the SB Recorder application
+ */
+
+#include "cfe.h"
+#include "cfe_sb_fcncodes.h"
+#include "cfe_sb_msg.h"
+#include "cfe_sb_msgids.h"
+
+#include "sb_recorder_app.h"
+#include "sb_recorder_eventids.h"
+#include "sb_recorder_msgids.h"
+#include "sb_recorder_perfids.h"
+
+#include <string.h>
+
+/*
+** SB Recorder Global Data Section
+*/
+SB_RECORDER_Data_t SB_RECORDER_Data;
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                   */
+/* SB_RECORDER_AppMain() -- Application entry point and main process loop */
+/*                                                                   */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SB_RECORDER_AppMain(void)
+{
+    uint32           RunStatus = CFE_ES_RunStatus_APP_RUN;
+    CFE_Status_t     status;
+    CFE_SB_Buffer_t *BufPtr;
+    CFE_SB_MsgId_t   MsgId;
+    CFE_MSG_Size_t   Size;
+    int32            OsStatus;
+
+    CFE_ES_PerfLogEntry(SB_RECORDER_MAIN_TASK_PERF_ID);
+
+    status = SB_RECORDER_Init();
+
+    if (status != CFE_SUCCESS)
+    {
+        RunStatus = CFE_ES_RunStatus_APP_ERROR;
+    }
+
+    while (CFE_ES_RunLoop(&RunStatus) == true)
+    {
+        CFE_ES_PerfLogExit(SB_RECORDER_MAIN_TASK_PERF_ID);
+
+        status = CFE_SB_ReceiveBuffer(&BufPtr, SB_RECORDER_Data.Pipe, SB_RECORDER_RCV_TIMEOUT);
+
+        CFE_ES_PerfLogEntry(SB_RECORDER_MAIN_TASK_PERF_ID);
+
+        if (status == CFE_SUCCESS)
+        {
+            MsgId = CFE_SB_INVALID_MSG_ID;
+            Size  = 0;
+            CFE_MSG_GetMsgId(&BufPtr->Msg, &MsgId);
+            CFE_MSG_GetSize(&BufPtr->Msg, &Size);
+
+            if (CFE_SB_MsgId_Equal(MsgId, CFE_SB_ValueToMsgId(SB_RECORDER_CMD_MID)))
+            {
+                SB_RECORDER_ProcessCommand(BufPtr);
+            }
+            else if (CFE_SB_MsgId_Equal(MsgId, CFE_SB_ValueToMsgId(CFE_SB_ONESUB_TLM_MID)) ||
+                     CFE_SB_MsgId_Equal(MsgId, CFE_SB_ValueToMsgId(CFE_SB_ALLSUBS_TLM_MID)))
+            {
+                SB_RECORDER_ProcessSubReport(BufPtr, MsgId, Size);
+            }
+            else if (SB_RECORDER_Data.Recording)
+            {
+                OsStatus = SB_RECORDER_WriterAppend(BufPtr, Size);
+                if (OsStatus == OS_ERROR_TIMEOUT || OsStatus == OS_ERR_INVALID_SIZE)
+                {
+                    ++SB_RECORDER_Data.RecordDropCount;
+                }
+                else if (OsStatus != OS_SUCCESS)
+                {
+                    CFE_EVS_SendEvent(OsStatus == OS_ERR_NO_FREE_IDS ? SB_RECORDER_REC_FULL_ERR_EID
+                                                                      : SB_RECORDER_REC_FILE_ERR_EID,
+                                      CFE_EVS_EventType_ERROR, "SB_RECORDER: Recording to %s failed, RC = %ld",
+                                      SB_RECORDER_Data.RecordFile, (long)OsStatus);
+                    SB_RECORDER_StopRecord();
+                }
+            }
+        }
+        else if (status == CFE_SB_TIME_OUT)
+        {
+            /* Quiet bus, get what we have onto the file */
+            if (SB_RECORDER_Data.Recording)
+            {
+                OsStatus = SB_RECORDER_WriterFlush();
+                if (OsStatus != OS_SUCCESS)
+                {
+                    CFE_EVS_SendEvent(OsStatus == OS_ERR_NO_FREE_IDS ? SB_RECORDER_REC_FULL_ERR_EID
+                                                                      : SB_RECORDER_REC_FILE_ERR_EID,
+                                      CFE_EVS_EventType_ERROR, "SB_RECORDER: Recording to %s failed, RC = %ld",
+                                      SB_RECORDER_Data.RecordFile, (long)OsStatus);
+                    SB_RECORDER_StopRecord();
+                }
+            }
+        }
+        else
+        {
+            CFE_EVS_SendEvent(SB_RECORDER_RCV_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "SB_RECORDER: Pipe read error, RC = 0x%08X", (unsigned int)status);
+            RunStatus = CFE_ES_RunStatus_APP_ERROR;
+        }
+    }
+
+    CFE_ES_PerfLogExit(SB_RECORDER_MAIN_TASK_PERF_ID);
+
+    if (SB_RECORDER_Data.Recording)
+    {
+        SB_RECORDER_StopRecord();
+    }
+    if (CFE_RESOURCEID_TEST_DEFINED(SB_RECORDER_Data.ReplayTaskId))
+    {
+        CFE_ES_DeleteChildTask(SB_RECORDER_Data.ReplayTaskId);
+    }
+
+    CFE_ES_ExitApp(RunStatus);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* SB_RECORDER_Init() -- SB Recorder initialization                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t SB_RECORDER_Init(void)
+{
+    CFE_Status_t status;
+    CFE_SB_Qos_t CmdQos;
+    int32        OsStatus;
+
+    memset(&SB_RECORDER_Data, 0, sizeof(SB_RECORDER_Data));
+    SB_RECORDER_Data.ReplayTaskId = CFE_ES_TASKID_UNDEFINED;
+    SB_RECORDER_Data.Fd           = OS_OBJECT_ID_UNDEFINED;
+
+    status = CFE_EVS_Register(NULL, 0, CFE_EVS_EventFilter_BINARY);
+    if (status != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("SB_RECORDER: Error registering for Event Services, RC = 0x%08X\n",
+                             (unsigned int)status);
+    }
+
+    if (status == CFE_SUCCESS)
+    {
+        status = CFE_SB_CreatePipe(&SB_RECORDER_Data.Pipe, SB_RECORDER_PIPE_DEPTH, SB_RECORDER_PIPE_NAME);
+        if (status != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(SB_RECORDER_CR_PIPE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "SB_RECORDER: Can't create pipe, RC = 0x%08X", (unsigned int)status);
+        }
+    }
+
+    /*
+    ** Commands share the pipe with recorded traffic, so they take the priority lane
+    */
+    if (status == CFE_SUCCESS)
+    {
+        memset(&CmdQos, 0, sizeof(CmdQos));
+        CmdQos.Priority = CFE_SB_QosPriority_HIGH;
+
+        status = CFE_SB_SubscribeEx(CFE_SB_ValueToMsgId(SB_RECORDER_CMD_MID), SB_RECORDER_Data.Pipe, CmdQos,
+                                    SB_RECORDER_MSG_LIM);
+        if (status != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(SB_RECORDER_SUBSCRIBE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "SB_RECORDER: Can't subscribe to commands, RC = 0x%08X", (unsigned int)status);
+        }
+    }
+
+    if (status == CFE_SUCCESS)
+    {
+        OsStatus = OS_BinSemCreate(&SB_RECORDER_Data.ReplaySem, "SB_RECORDER_REPLAY", 0, 0);
+        if (OsStatus != OS_SUCCESS)
+        {
+            CFE_EVS_SendEvent(SB_RECORDER_TASK_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "SB_RECORDER: Can't create semaphore, RC = %ld", (long)OsStatus);
+            status = CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+        }
+    }
+
+    if (status == CFE_SUCCESS)
+    {
+        status = CFE_ES_CreateChildTask(&SB_RECORDER_Data.ReplayTaskId, SB_RECORDER_REPLAY_TASK_NAME,
+                                        SB_RECORDER_ReplayTask, CFE_ES_TASK_STACK_ALLOCATE,
+                                        SB_RECORDER_REPLAY_TASK_STACK_SIZE, SB_RECORDER_REPLAY_TASK_PRIORITY, 0);
+        if (status != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(SB_RECORDER_TASK_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "SB_RECORDER: Can't create replay task, RC = 0x%08X", (unsigned int)status);
+        }
+    }
+
+    if (status == CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(SB_RECORDER_INIT_INF_EID, CFE_EVS_EventType_INFORMATION, "SB_RECORDER Initialized");
+    }
+
+    return status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper: true if the command is the expected length
+ *
+ *-----------------------------------------------------------------*/
+static bool SB_RECORDER_VerifyCmdLength(const CFE_SB_Buffer_t *BufPtr, size_t ExpectedLength)
+{
+    CFE_MSG_Size_t    ActualLength = 0;
+    CFE_MSG_FcnCode_t FcnCode      = 0;
+
+    CFE_MSG_GetSize(&BufPtr->Msg, &ActualLength);
+    if (ActualLength != ExpectedLength)
+    {
+        CFE_MSG_GetFcnCode(&BufPtr->Msg, &FcnCode);
+        CFE_EVS_SendEvent(SB_RECORDER_LEN_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "SB_RECORDER: Invalid length for command code %u, expected %lu, got %lu",
+                          (unsigned int)FcnCode, (unsigned long)ExpectedLength, (unsigned long)ActualLength);
+        return false;
+    }
+
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper: index of MsgId in the recorded list, or -1
+ *
+ *-----------------------------------------------------------------*/
+static int32 SB_RECORDER_FindMsgId(CFE_SB_MsgId_t MsgId)
+{
+    uint32 i;
+
+    for (i = 0; i < SB_RECORDER_Data.MsgIdCount; ++i)
+    {
+        if (CFE_SB_MsgId_Equal(SB_RECORDER_Data.MsgIds[i], MsgId))
+        {
+            return (int32)i;
+        }
+    }
+
+    return -1;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper: start recording MsgId
+ *
+ *-----------------------------------------------------------------*/
+static void SB_RECORDER_AddMsgId(CFE_SB_MsgId_t MsgId)
+{
+    CFE_Status_t status;
+
+    /* Our own commands and the subscription reports are never recorded */
+    if (!CFE_SB_IsValidMsgId(MsgId) || SB_RECORDER_FindMsgId(MsgId) >= 0 ||
+        CFE_SB_MsgId_Equal(MsgId, CFE_SB_ValueToMsgId(SB_RECORDER_CMD_MID)) ||
+        CFE_SB_MsgId_Equal(MsgId, CFE_SB_ValueToMsgId(CFE_SB_ONESUB_TLM_MID)) ||
+        CFE_SB_MsgId_Equal(MsgId, CFE_SB_ValueToMsgId(CFE_SB_ALLSUBS_TLM_MID)))
+    {
+        return;
+    }
+
+    if (SB_RECORDER_Data.MsgIdCount >= SB_RECORDER_MAX_MSGIDS)
+    {
+        CFE_EVS_SendEvent(SB_RECORDER_REC_FULL_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "SB_RECORDER: MsgId table full, 0x%x not recorded",
+                          (unsigned int)CFE_SB_MsgIdToValue(MsgId));
+        return;
+    }
+
+    /* Local scope keeps the recorder out of the subscription reports it consumes */
+    status = CFE_SB_SubscribeLocal(MsgId, SB_RECORDER_Data.Pipe, SB_RECORDER_MSG_LIM);
+    if (status == CFE_SUCCESS)
+    {
+        SB_RECORDER_Data.MsgIds[SB_RECORDER_Data.MsgIdCount] = MsgId;
+        ++SB_RECORDER_Data.MsgIdCount;
+    }
+    else
+    {
+        CFE_EVS_SendEvent(SB_RECORDER_SUBSCRIBE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "SB_RECORDER: Can't subscribe to MsgId 0x%x, RC = 0x%08X",
+                          (unsigned int)CFE_SB_MsgIdToValue(MsgId), (unsigned int)status);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper: send a payload-free SB subscription reporting command
+ *
+ *-----------------------------------------------------------------*/
+static void SB_RECORDER_SendSubRptCmd(CFE_MSG_FcnCode_t FcnCode)
+{
+    CFE_MSG_CommandHeader_t Cmd;
+
+    memset(&Cmd, 0, sizeof(Cmd));
+    CFE_MSG_Init(CFE_MSG_PTR(Cmd), CFE_SB_ValueToMsgId(CFE_SB_SUB_RPT_CTRL_MID), sizeof(Cmd));
+    CFE_MSG_SetFcnCode(CFE_MSG_PTR(Cmd), FcnCode);
+    CFE_SB_TransmitMsg(CFE_MSG_PTR(Cmd), true);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper: start recording command
+ *
+ *-----------------------------------------------------------------*/
+static void SB_RECORDER_StartRecordCmd(const SB_RECORDER_StartRecordCmd_t *Cmd)
+{
+    const SB_RECORDER_StartRecord_Payload_t *Payload = &Cmd->Payload;
+    int32                                    OsStatus;
+    uint32                                   i;
+
+    if (SB_RECORDER_Data.Recording || SB_RECORDER_Data.ReplayActive)
+    {
+        CFE_EVS_SendEvent(SB_RECORDER_BUSY_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "SB_RECORDER: Can't start recording, %s in progress",
+                          SB_RECORDER_Data.Recording ? "recording" : "replay");
+        return;
+    }
+
+    if (Payload->NumMsgIds > SB_RECORDER_MAX_CMD_MSGIDS)
+    {
+        CFE_EVS_SendEvent(SB_RECORDER_LEN_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "SB_RECORDER: Invalid MsgId count %u", (unsigned int)Payload->NumMsgIds);
+        return;
+    }
+
+    CFE_SB_MessageStringGet(SB_RECORDER_Data.RecordFile, Payload->Filename, NULL,
+                            sizeof(SB_RECORDER_Data.RecordFile), sizeof(Payload->Filename));
+
+    OsStatus = SB_RECORDER_WriterOpen(SB_RECORDER_Data.RecordFile);
+    if (OsStatus != OS_SUCCESS)
+    {
+        CFE_EVS_SendEvent(SB_RECORDER_REC_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "SB_RECORDER: Can't create %s, RC = %ld", SB_RECORDER_Data.RecordFile, (long)OsStatus);
+        return;
+    }
+
+    SB_RECORDER_Data.Recording  = true;
+    SB_RECORDER_Data.Wildcard   = (Payload->NumMsgIds == 0);
+    SB_RECORDER_Data.MsgIdCount = 0;
+
+    if (SB_RECORDER_Data.Wildcard)
+    {
+        /* Learn every route now and as it is created */
+        CFE_SB_SubscribeLocal(CFE_SB_ValueToMsgId(CFE_SB_ONESUB_TLM_MID), SB_RECORDER_Data.Pipe,
+                              SB_RECORDER_PIPE_DEPTH);
+        CFE_SB_SubscribeLocal(CFE_SB_ValueToMsgId(CFE_SB_ALLSUBS_TLM_MID), SB_RECORDER_Data.Pipe,
+                              SB_RECORDER_PIPE_DEPTH);
+        SB_RECORDER_SendSubRptCmd(CFE_SB_ENABLE_SUB_REPORTING_CC);
+        SB_RECORDER_SendSubRptCmd(CFE_SB_SEND_PREV_SUBS_CC);
+    }
+    else
+    {
+        for (i = 0; i < Payload->NumMsgIds; ++i)
+        {
+            SB_RECORDER_AddMsgId(Payload->MsgId[i]);
+        }
+    }
+
+    CFE_EVS_SendEvent(SB_RECORDER_REC_START_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "SB_RECORDER: Recording %s to %s",
+                      SB_RECORDER_Data.Wildcard ? "all routes" : "selected MsgIds", SB_RECORDER_Data.RecordFile);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void SB_RECORDER_StopRecord(void)
+{
+    int32  OsStatus;
+    uint32 i;
+
+    for (i = 0; i < SB_RECORDER_Data.MsgIdCount; ++i)
+    {
+        CFE_SB_UnsubscribeLocal(SB_RECORDER_Data.MsgIds[i], SB_RECORDER_Data.Pipe);
+    }
+    SB_RECORDER_Data.MsgIdCount = 0;
+
+    /* Reporting is left enabled, other applications may rely on it */
+    if (SB_RECORDER_Data.Wildcard)
+    {
+        CFE_SB_UnsubscribeLocal(CFE_SB_ValueToMsgId(CFE_SB_ONESUB_TLM_MID), SB_RECORDER_Data.Pipe);
+        CFE_SB_UnsubscribeLocal(CFE_SB_ValueToMsgId(CFE_SB_ALLSUBS_TLM_MID), SB_RECORDER_Data.Pipe);
+        SB_RECORDER_Data.Wildcard = false;
+    }
+
+    SB_RECORDER_Data.Recording = false;
+
+    OsStatus = SB_RECORDER_WriterClose();
+
+    CFE_EVS_SendEvent(SB_RECORDER_REC_STOP_INF_EID,
+                      OsStatus == OS_SUCCESS ? CFE_EVS_EventType_INFORMATION : CFE_EVS_EventType_ERROR,
+                      "SB_RECORDER: Recorded %lu msgs, %lu bytes in %lu chunks to %s, %lu dropped, RC = %ld",
+                      (unsigned long)SB_RECORDER_Data.RecordCount, (unsigned long)SB_RECORDER_Data.RecordBytes,
+                      (unsigned long)SB_RECORDER_Data.ChunkCount, SB_RECORDER_Data.RecordFile,
+                      (unsigned long)SB_RECORDER_Data.RecordDropCount, (long)OsStatus);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper: start replay command
+ *
+ *-----------------------------------------------------------------*/
+static void SB_RECORDER_StartReplayCmd(const SB_RECORDER_StartReplayCmd_t *Cmd)
+{
+    if (SB_RECORDER_Data.Recording || SB_RECORDER_Data.ReplayActive)
+    {
+        CFE_EVS_SendEvent(SB_RECORDER_BUSY_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "SB_RECORDER: Can't start replay, %s in progress",
+                          SB_RECORDER_Data.Recording ? "recording" : "replay");
+        return;
+    }
+
+    CFE_SB_MessageStringGet(SB_RECORDER_Data.ReplayFile, Cmd->Payload.Filename, NULL,
+                            sizeof(SB_RECORDER_Data.ReplayFile), sizeof(Cmd->Payload.Filename));
+    SB_RECORDER_Data.ReplaySpeed  = Cmd->Payload.Speed;
+    SB_RECORDER_Data.ReplayStop   = false;
+    SB_RECORDER_Data.ReplayActive = true;
+
+    CFE_EVS_SendEvent(SB_RECORDER_REPLAY_START_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "SB_RECORDER: Replaying %s, speed %u", SB_RECORDER_Data.ReplayFile,
+                      (unsigned int)SB_RECORDER_Data.ReplaySpeed);
+
+    OS_BinSemGive(SB_RECORDER_Data.ReplaySem);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void SB_RECORDER_ProcessCommand(const CFE_SB_Buffer_t *BufPtr)
+{
+    CFE_MSG_FcnCode_t FcnCode = 0;
+
+    CFE_MSG_GetFcnCode(&BufPtr->Msg, &FcnCode);
+
+    switch (FcnCode)
+    {
+        case SB_RECORDER_NOOP_CC:
+            if (SB_RECORDER_VerifyCmdLength(BufPtr, sizeof(SB_RECORDER_NoopCmd_t)))
+            {
+                CFE_EVS_SendEvent(SB_RECORDER_NOOP_INF_EID, CFE_EVS_EventType_INFORMATION,
+                                  "SB_RECORDER: NOOP command");
+            }
+            break;
+
+        case SB_RECORDER_START_RECORD_CC:
+            if (SB_RECORDER_VerifyCmdLength(BufPtr, sizeof(SB_RECORDER_StartRecordCmd_t)))
+            {
+                SB_RECORDER_StartRecordCmd((const SB_RECORDER_StartRecordCmd_t *)BufPtr);
+            }
+            break;
+
+        case SB_RECORDER_STOP_RECORD_CC:
+            if (SB_RECORDER_VerifyCmdLength(BufPtr, sizeof(SB_RECORDER_StopRecordCmd_t)) &&
+                SB_RECORDER_Data.Recording)
+            {
+                SB_RECORDER_StopRecord();
+            }
+            break;
+
+        case SB_RECORDER_START_REPLAY_CC:
+            if (SB_RECORDER_VerifyCmdLength(BufPtr, sizeof(SB_RECORDER_StartReplayCmd_t)))
+            {
+                SB_RECORDER_StartReplayCmd((const SB_RECORDER_StartReplayCmd_t *)BufPtr);
+            }
+            break;
+
+        case SB_RECORDER_STOP_REPLAY_CC:
+            if (SB_RECORDER_VerifyCmdLength(BufPtr, sizeof(SB_RECORDER_StopReplayCmd_t)))
+            {
+                SB_RECORDER_Data.ReplayStop = true;
+            }
+            break;
+
+        default:
+            CFE_EVS_SendEvent(SB_RECORDER_CC_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "SB_RECORDER: Invalid command code %u", (unsigned int)FcnCode);
+            break;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void SB_RECORDER_ProcessSubReport(const CFE_SB_Buffer_t *BufPtr, CFE_SB_MsgId_t MsgId, CFE_MSG_Size_t Size)
+{
+    const CFE_SB_SingleSubscriptionTlm_t *OneSub;
+    const CFE_SB_AllSubscriptionsTlm_t *  AllSubs;
+    uint32                                i;
+
+    if (!SB_RECORDER_Data.Recording || !SB_RECORDER_Data.Wildcard)
+    {
+        return;
+    }
+
+    if (CFE_SB_MsgId_Equal(MsgId, CFE_SB_ValueToMsgId(CFE_SB_ONESUB_TLM_MID)))
+    {
+        if (Size >= sizeof(*OneSub))
+        {
+            OneSub = (const CFE_SB_SingleSubscriptionTlm_t *)BufPtr;
+            if (OneSub->Payload.SubType == CFE_SB_SUBSCRIPTION)
+            {
+                SB_RECORDER_AddMsgId(OneSub->Payload.MsgId);
+            }
+        }
+    }
+    else if (Size >= sizeof(*AllSubs))
+    {
+        AllSubs = (const CFE_SB_AllSubscriptionsTlm_t *)BufPtr;
+        for (i = 0; i < AllSubs->Payload.Entries && i < CFE_SB_SUB_ENTRIES_PER_PKT; ++i)
+        {
+            SB_RECORDER_AddMsgId(AllSubs->Payload.Entry[i].MsgId);
+        }
+    }
+}
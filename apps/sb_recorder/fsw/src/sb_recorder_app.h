@@ -0,0 +1,179 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Define SB Recorder Application header file
+ *
+ * The SB Recorder captures Software Bus traffic to a file and plays it back
+ * into a (possibly different) cFS instance.
+ *
+ * When recording, the recorder subscribes with local scope to either a list
+ * of MsgIds or, in wildcard mode, to every MsgId that any application
+ * subscribes to globally, as learned from the SB subscription reports.  A
+ * publisher only ever queues a buffer reference on the recorder's pipe.  The
+ * recorder copies each message into a chunk buffer and hands full chunks to
+ * OS_AsyncWrite(), so the file system is never waited on; if every chunk
+ * buffer is still being written the message is dropped and counted.
+ *
+ * When replaying, a child task reads the file one chunk at a time and
+ * transmits each record with CFE_SB_TransmitBuffer() without changing its
+ * sequence count or time stamp, either with the recorded inter-arrival
+ * times (optionally scaled) or as fast as SB accepts them.  The completion
+ * event reports the achieved message rate, so a replay at full speed also
+ * serves as a throughput test of SB and the receiving applications.
+ *
+ * Commands are subscribed with high priority so they are handled ahead of
+ * recorded traffic queued on the same pipe.
+ */
+
+#ifndef SB_RECORDER_APP_H
+#define SB_RECORDER_APP_H
+
+#include "common_types.h"
+#include "osapi.h"
+#include "cfe.h"
+
+#include "sb_recorder_platform_cfg.h"
+#include "sb_recorder_file.h"
+#include "sb_recorder_msg.h"
+
+/************************************************************************
+** Type Definitions
+*************************************************************************/
+
+/**
+ * One chunk buffer, filled by the main task and written asynchronously
+ */
+typedef struct
+{
+    OS_AsyncIo_t       Req;
+    bool               Submitted;
+    uint32             Length;    /**< \brief Bytes used, including the chunk header; 0 if empty */
+    uint32             MsgBytes;  /**< \brief Message bytes in the records, excluding headers and padding */
+    CFE_TIME_SysTime_t FirstTime; /**< \brief Time of the first record */
+
+    union
+    {
+        SB_RECORDER_ChunkHdr_t Hdr;
+        uint64                 Align;
+        uint8                  Bytes[SB_RECORDER_CHUNK_SIZE];
+    } Data;
+} SB_RECORDER_Chunk_t;
+
+/**
+ * SB Recorder global data structure
+ */
+typedef struct
+{
+    CFE_SB_PipeId_t Pipe;
+    CFE_ES_TaskId_t ReplayTaskId;
+    osal_id_t       ReplaySem;
+
+    /*
+    ** Recording state, only touched by the main task
+    */
+    bool           Recording;
+    bool           Wildcard;
+    char           RecordFile[OS_MAX_PATH_LEN];
+    CFE_SB_MsgId_t MsgIds[SB_RECORDER_MAX_MSGIDS];
+    uint32         MsgIdCount;
+
+    osal_id_t                Fd;
+    bool                     UseAsync;
+    uint32                   FillIdx;
+    uint32                   FileOffset;
+    SB_RECORDER_Chunk_t      Chunks[SB_RECORDER_NUM_CHUNKS];
+    SB_RECORDER_IndexEntry_t Index[SB_RECORDER_MAX_CHUNKS];
+    uint32                   ChunkCount;
+
+    uint32 RecordCount;
+    uint32 RecordDropCount;
+    uint32 WriteErrCount;
+    uint64 RecordBytes;
+
+    /*
+    ** Replay request, set by the main task while no replay is running
+    */
+    volatile bool ReplayActive;
+    volatile bool ReplayStop;
+    char          ReplayFile[OS_MAX_PATH_LEN];
+    uint16        ReplaySpeed;
+} SB_RECORDER_Data_t;
+
+/************************************************************************
+ * Function Prototypes
+ ************************************************************************/
+
+void         SB_RECORDER_AppMain(void);
+CFE_Status_t SB_RECORDER_Init(void);
+void         SB_RECORDER_ProcessCommand(const CFE_SB_Buffer_t *BufPtr);
+void         SB_RECORDER_ProcessSubReport(const CFE_SB_Buffer_t *BufPtr, CFE_SB_MsgId_t MsgId, CFE_MSG_Size_t Size);
+void         SB_RECORDER_StopRecord(void);
+
+/**
+ * \brief Create the recording file and write its file header
+ *
+ * \param[in] Filename Path of the file, overwritten if it exists
+ *
+ * \return OS_SUCCESS, or an OSAL error code
+ */
+int32 SB_RECORDER_WriterOpen(const char *Filename);
+
+/**
+ * \brief Append one message to the recording
+ *
+ * Never waits for the file system.
+ *
+ * \param[in] BufPtr Message to record
+ * \param[in] Size   Size of the message in bytes
+ *
+ * \return OS_SUCCESS if the message was recorded, OS_ERROR_TIMEOUT if it
+ *         was dropped because no chunk buffer was free, OS_ERR_INVALID_SIZE
+ *         if it can never fit in a chunk, OS_ERR_NO_FREE_IDS if the chunk
+ *         index is full, or an error writing the file
+ */
+int32 SB_RECORDER_WriterAppend(const CFE_SB_Buffer_t *BufPtr, CFE_MSG_Size_t Size);
+
+/**
+ * \brief Start writing the chunk being filled, if it holds any records
+ *
+ * If the asynchronous write cannot be submitted the records in the chunk
+ * are counted as dropped and left out of the chunk index, and recording
+ * continues.
+ *
+ * \return OS_SUCCESS, OS_ERR_NO_FREE_IDS if the chunk index is full, or
+ *         an error writing the file synchronously
+ */
+int32 SB_RECORDER_WriterFlush(void);
+
+/**
+ * \brief Write out all pending data, the chunk index and trailer, and close the file
+ *
+ * \return OS_SUCCESS, or the first error writing the file
+ */
+int32 SB_RECORDER_WriterClose(void);
+
+void SB_RECORDER_ReplayTask(void);
+
+/******************************************************************************/
+
+/* Global State Object */
+extern SB_RECORDER_Data_t SB_RECORDER_Data;
+
+#endif
@@ -0,0 +1,307 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *  Replay task for the SB Recorder application
+ *
+ * The replay task owns the first chunk buffer while it runs; the main task
+ * does not record during a replay.
+ */
+
+#include "cfe.h"
+
+#include "sb_recorder_app.h"
+#include "sb_recorder_eventids.h"
+#include "sb_recorder_perfids.h"
+
+#include <string.h>
+
+/*
+** Outcome of one replay, reported when it ends
+*/
+typedef struct
+{
+    uint32 MsgCount;
+    uint32 DropCount;
+    uint64 Bytes;
+} SB_RECORDER_ReplayStats_t;
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper: microseconds from Start to End, 0 if End is not later
+ *
+ *-----------------------------------------------------------------*/
+static uint64 SB_RECORDER_ElapsedUsec(CFE_TIME_SysTime_t Start, CFE_TIME_SysTime_t End)
+{
+    CFE_TIME_SysTime_t Delta;
+
+    if (CFE_TIME_Compare(End, Start) != CFE_TIME_A_GT_B)
+    {
+        return 0;
+    }
+
+    Delta = CFE_TIME_Subtract(End, Start);
+
+    return ((uint64)Delta.Seconds * 1000000) + CFE_TIME_Sub2MicroSecs(Delta.Subseconds);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper: read exactly Size bytes, false on error or end of file
+ *
+ *-----------------------------------------------------------------*/
+static bool SB_RECORDER_ReadAll(osal_id_t Fd, void *Data, size_t Size)
+{
+    return OS_read(Fd, Data, Size) == Size;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper: find where the chunks of an open recording end
+ *
+ * Uses the trailer if there is one, otherwise the end of the file.  Leaves
+ * the file positioned after the cFE file header.
+ *
+ *-----------------------------------------------------------------*/
+static uint32 SB_RECORDER_ReplayFindEnd(osal_id_t Fd)
+{
+    SB_RECORDER_Trailer_t Trailer;
+    int32                 FileSize;
+    uint32                End;
+
+    FileSize = OS_lseek(Fd, 0, OS_SEEK_END);
+    End      = (FileSize > 0) ? (uint32)FileSize : 0;
+
+    if (FileSize >= (int32)(sizeof(CFE_FS_Header_t) + sizeof(Trailer)) &&
+        OS_lseek(Fd, FileSize - (int32)sizeof(Trailer), OS_SEEK_SET) >= 0 &&
+        SB_RECORDER_ReadAll(Fd, &Trailer, sizeof(Trailer)) && Trailer.Magic == SB_RECORDER_TRAILER_MAGIC &&
+        Trailer.IndexOffset <= (uint32)FileSize)
+    {
+        End = Trailer.IndexOffset;
+    }
+
+    OS_lseek(Fd, sizeof(CFE_FS_Header_t), OS_SEEK_SET);
+
+    return End;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper: wait until a record is due
+ *
+ * RecordUsec is the record's offset from the first record of the file and
+ * StartTime the local time at which the first record was sent.
+ *
+ *-----------------------------------------------------------------*/
+static void SB_RECORDER_ReplayPace(uint64 RecordUsec, CFE_TIME_SysTime_t StartTime)
+{
+    uint64 DueUsec;
+    uint64 NowUsec;
+    uint64 WaitMsec;
+
+    DueUsec = RecordUsec / SB_RECORDER_Data.ReplaySpeed;
+
+    while (!SB_RECORDER_Data.ReplayStop)
+    {
+        NowUsec = SB_RECORDER_ElapsedUsec(StartTime, CFE_TIME_GetTime());
+        if (NowUsec + 1000 > DueUsec)
+        {
+            break;
+        }
+
+        WaitMsec = (DueUsec - NowUsec) / 1000;
+        if (WaitMsec > SB_RECORDER_REPLAY_MAX_DELAY)
+        {
+            WaitMsec = SB_RECORDER_REPLAY_MAX_DELAY;
+        }
+
+        CFE_ES_PerfLogExit(SB_RECORDER_REPLAY_TASK_PERF_ID);
+        OS_TaskDelay(WaitMsec);
+        CFE_ES_PerfLogEntry(SB_RECORDER_REPLAY_TASK_PERF_ID);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper: transmit the records of one chunk held in Chunks[0]
+ *
+ * Returns false if the chunk is malformed.
+ *
+ *-----------------------------------------------------------------*/
+static bool SB_RECORDER_ReplayChunk(SB_RECORDER_ReplayStats_t *Stats, CFE_TIME_SysTime_t *FirstRecord,
+                                    CFE_TIME_SysTime_t *StartTime)
+{
+    SB_RECORDER_Chunk_t *   Chunk = &SB_RECORDER_Data.Chunks[0];
+    SB_RECORDER_RecordHdr_t RecHdr;
+    CFE_SB_Buffer_t *       BufPtr;
+    uint32                  Offset;
+    uint32                  i;
+
+    Offset = sizeof(SB_RECORDER_ChunkHdr_t);
+
+    for (i = 0; i < Chunk->Data.Hdr.RecordCount && !SB_RECORDER_Data.ReplayStop; ++i)
+    {
+        if (Offset + sizeof(RecHdr) > Chunk->Length)
+        {
+            return false;
+        }
+
+        memcpy(&RecHdr, &Chunk->Data.Bytes[Offset], sizeof(RecHdr));
+        if (RecHdr.Length < sizeof(CFE_MSG_Message_t) || RecHdr.Length > Chunk->Length - Offset - sizeof(RecHdr))
+        {
+            return false;
+        }
+
+        if (Stats->MsgCount == 0 && Stats->DropCount == 0)
+        {
+            *FirstRecord = RecHdr.Time;
+            *StartTime   = CFE_TIME_GetTime();
+        }
+        else if (SB_RECORDER_Data.ReplaySpeed != 0)
+        {
+            SB_RECORDER_ReplayPace(SB_RECORDER_ElapsedUsec(*FirstRecord, RecHdr.Time), *StartTime);
+        }
+
+        BufPtr = CFE_SB_AllocateMessageBuffer(RecHdr.Length);
+        if (BufPtr == NULL)
+        {
+            ++Stats->DropCount;
+        }
+        else
+        {
+            memcpy(BufPtr, &Chunk->Data.Bytes[Offset + sizeof(RecHdr)], RecHdr.Length);
+
+            /* Not an origination: keep the recorded sequence count and time stamp */
+            if (CFE_SB_TransmitBuffer(BufPtr, false) == CFE_SUCCESS)
+            {
+                ++Stats->MsgCount;
+                Stats->Bytes += RecHdr.Length;
+            }
+            else
+            {
+                CFE_SB_ReleaseMessageBuffer(BufPtr);
+                ++Stats->DropCount;
+            }
+        }
+
+        Offset += (sizeof(RecHdr) + RecHdr.Length + SB_RECORDER_RECORD_ALIGN - 1) &
+                  ~((uint32)SB_RECORDER_RECORD_ALIGN - 1);
+    }
+
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper: replay the file named in ReplayFile
+ *
+ *-----------------------------------------------------------------*/
+static void SB_RECORDER_Replay(void)
+{
+    SB_RECORDER_Chunk_t *     Chunk = &SB_RECORDER_Data.Chunks[0];
+    SB_RECORDER_ReplayStats_t Stats;
+    CFE_FS_Header_t           FsHdr;
+    CFE_TIME_SysTime_t        FirstRecord;
+    CFE_TIME_SysTime_t        StartTime;
+    osal_id_t                 Fd;
+    int32                     OsStatus;
+    uint32                    Offset;
+    uint32                    End;
+    uint64                    ElapsedUsec;
+    bool                      Valid;
+
+    memset(&Stats, 0, sizeof(Stats));
+    memset(&FirstRecord, 0, sizeof(FirstRecord));
+    StartTime = CFE_TIME_GetTime();
+
+    OsStatus = OS_OpenCreate(&Fd, SB_RECORDER_Data.ReplayFile, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+    if (OsStatus != OS_SUCCESS)
+    {
+        CFE_EVS_SendEvent(SB_RECORDER_REPLAY_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "SB_RECORDER: Can't open %s for replay, RC = %ld", SB_RECORDER_Data.ReplayFile,
+                          (long)OsStatus);
+        return;
+    }
+
+    Valid = (CFE_FS_ReadHeader(&FsHdr, Fd) == sizeof(FsHdr) && FsHdr.SubType == SB_RECORDER_FS_SUBTYPE);
+    if (!Valid)
+    {
+        CFE_EVS_SendEvent(SB_RECORDER_REPLAY_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "SB_RECORDER: %s is not an SB recording", SB_RECORDER_Data.ReplayFile);
+        OS_close(Fd);
+        return;
+    }
+
+    End    = SB_RECORDER_ReplayFindEnd(Fd);
+    Offset = sizeof(FsHdr);
+
+    while (Valid && !SB_RECORDER_Data.ReplayStop && Offset + sizeof(SB_RECORDER_ChunkHdr_t) <= End)
+    {
+        Valid = SB_RECORDER_ReadAll(Fd, &Chunk->Data.Hdr, sizeof(Chunk->Data.Hdr)) &&
+                Chunk->Data.Hdr.Magic == SB_RECORDER_CHUNK_MAGIC &&
+                Chunk->Data.Hdr.Length >= sizeof(Chunk->Data.Hdr) &&
+                Chunk->Data.Hdr.Length <= SB_RECORDER_CHUNK_SIZE && Chunk->Data.Hdr.Length <= End - Offset &&
+                SB_RECORDER_ReadAll(Fd, &Chunk->Data.Bytes[sizeof(Chunk->Data.Hdr)],
+                                    Chunk->Data.Hdr.Length - sizeof(Chunk->Data.Hdr));
+
+        if (Valid)
+        {
+            Chunk->Length = Chunk->Data.Hdr.Length;
+            Offset += Chunk->Length;
+            Valid = SB_RECORDER_ReplayChunk(&Stats, &FirstRecord, &StartTime);
+        }
+    }
+
+    OS_close(Fd);
+    Chunk->Length = 0;
+
+    ElapsedUsec = SB_RECORDER_ElapsedUsec(StartTime, CFE_TIME_GetTime());
+    if (ElapsedUsec == 0)
+    {
+        ElapsedUsec = 1;
+    }
+
+    CFE_EVS_SendEvent(SB_RECORDER_REPLAY_DONE_INF_EID,
+                      Valid ? CFE_EVS_EventType_INFORMATION : CFE_EVS_EventType_ERROR,
+                      "SB_RECORDER: Replay %s%s: %lu msgs, %lu dropped, %lu bytes in %lu ms, %lu msg/s",
+                      SB_RECORDER_Data.ReplayStop ? "stopped" : "done",
+                      Valid ? "" : " at corrupt chunk", (unsigned long)Stats.MsgCount,
+                      (unsigned long)Stats.DropCount, (unsigned long)Stats.Bytes,
+                      (unsigned long)(ElapsedUsec / 1000),
+                      (unsigned long)(((uint64)Stats.MsgCount * 1000000) / ElapsedUsec));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void SB_RECORDER_ReplayTask(void)
+{
+    while (OS_BinSemTake(SB_RECORDER_Data.ReplaySem) == OS_SUCCESS)
+    {
+        CFE_ES_PerfLogEntry(SB_RECORDER_REPLAY_TASK_PERF_ID);
+
+        SB_RECORDER_Replay();
+        SB_RECORDER_Data.ReplayActive = false;
+
+        CFE_ES_PerfLogExit(SB_RECORDER_REPLAY_TASK_PERF_ID);
+    }
+}
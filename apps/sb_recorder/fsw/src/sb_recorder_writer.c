@@ -0,0 +1,338 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *  Recording file writer for the SB Recorder application
+ *
+ * All functions run in the main task.
+ */
+
+#include "cfe.h"
+
+#include "sb_recorder_app.h"
+
+#include <string.h>
+
+/* The largest SB message must fit in an otherwise empty chunk */
+CompileTimeAssert(sizeof(SB_RECORDER_ChunkHdr_t) + sizeof(SB_RECORDER_RecordHdr_t) + CFE_MISSION_SB_MAX_SB_MSG_SIZE <=
+                      SB_RECORDER_CHUNK_SIZE,
+                  SbRecorderChunkTooSmall);
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper: convert the result of a synchronous write to a status
+ *
+ *-----------------------------------------------------------------*/
+static int32 SB_RECORDER_WriteAll(const void *Data, size_t Size)
+{
+    int32 OsStatus;
+
+    OsStatus = OS_write(SB_RECORDER_Data.Fd, Data, Size);
+    if (OsStatus == Size)
+    {
+        OsStatus = OS_SUCCESS;
+    }
+    else if (OsStatus >= 0)
+    {
+        OsStatus = OS_ERROR;
+    }
+
+    return OsStatus;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper: collect the outcome of a chunk write
+ *
+ * Returns OS_ERROR_TIMEOUT if the write is still in progress after
+ * Timeout milliseconds, otherwise OS_SUCCESS and the chunk is empty.
+ *
+ *-----------------------------------------------------------------*/
+static int32 SB_RECORDER_WaitChunk(SB_RECORDER_Chunk_t *Chunk, int32 Timeout)
+{
+    int32 OsStatus;
+
+    OsStatus = OS_SUCCESS;
+
+    if (Chunk->Submitted)
+    {
+        OsStatus = OS_AsyncWait(&Chunk->Req, Timeout);
+        if (OsStatus == OS_ERROR_TIMEOUT)
+        {
+            return OsStatus;
+        }
+
+        if (OsStatus != OS_SUCCESS || Chunk->Req.Result != Chunk->Length)
+        {
+            ++SB_RECORDER_Data.WriteErrCount;
+        }
+
+        Chunk->Submitted = false;
+        Chunk->Length    = 0;
+        OsStatus         = OS_SUCCESS;
+    }
+
+    return OsStatus;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 SB_RECORDER_WriterOpen(const char *Filename)
+{
+    CFE_FS_Header_t FsHdr;
+    int32           OsStatus;
+    uint32          i;
+
+    SB_RECORDER_Data.FillIdx     = 0;
+    SB_RECORDER_Data.ChunkCount  = 0;
+    SB_RECORDER_Data.UseAsync    = true;
+    SB_RECORDER_Data.RecordCount = 0;
+    SB_RECORDER_Data.RecordBytes = 0;
+
+    SB_RECORDER_Data.RecordDropCount = 0;
+    SB_RECORDER_Data.WriteErrCount   = 0;
+
+    for (i = 0; i < SB_RECORDER_NUM_CHUNKS; ++i)
+    {
+        SB_RECORDER_Data.Chunks[i].Submitted = false;
+        SB_RECORDER_Data.Chunks[i].Length    = 0;
+    }
+
+    OsStatus = OS_OpenCreate(&SB_RECORDER_Data.Fd, Filename, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE,
+                             OS_WRITE_ONLY);
+    if (OsStatus != OS_SUCCESS)
+    {
+        return OsStatus;
+    }
+
+    CFE_FS_InitHeader(&FsHdr, "SB traffic recording", SB_RECORDER_FS_SUBTYPE);
+    if (CFE_FS_WriteHeader(SB_RECORDER_Data.Fd, &FsHdr) != sizeof(FsHdr))
+    {
+        OS_close(SB_RECORDER_Data.Fd);
+        SB_RECORDER_Data.Fd = OS_OBJECT_ID_UNDEFINED;
+        return OS_ERROR;
+    }
+
+    SB_RECORDER_Data.FileOffset = sizeof(FsHdr);
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 SB_RECORDER_WriterFlush(void)
+{
+    SB_RECORDER_Chunk_t *     Chunk;
+    SB_RECORDER_IndexEntry_t *Entry;
+    int32                     OsStatus;
+
+    Chunk = &SB_RECORDER_Data.Chunks[SB_RECORDER_Data.FillIdx];
+    if (Chunk->Length == 0 || Chunk->Submitted)
+    {
+        return OS_SUCCESS;
+    }
+
+    if (SB_RECORDER_Data.ChunkCount >= SB_RECORDER_MAX_CHUNKS)
+    {
+        return OS_ERR_NO_FREE_IDS;
+    }
+
+    Chunk->Data.Hdr.Magic    = SB_RECORDER_CHUNK_MAGIC;
+    Chunk->Data.Hdr.Length   = Chunk->Length;
+    Chunk->Data.Hdr.Sequence = SB_RECORDER_Data.ChunkCount;
+
+    OsStatus = OS_ERR_NOT_IMPLEMENTED;
+    if (SB_RECORDER_Data.UseAsync)
+    {
+        OsStatus = OS_AsyncWrite(SB_RECORDER_Data.Fd, Chunk->Data.Bytes, Chunk->Length, &Chunk->Req);
+        if (OsStatus == OS_SUCCESS)
+        {
+            Chunk->Submitted = true;
+        }
+        else if (OsStatus != OS_ERR_NOT_IMPLEMENTED)
+        {
+            /* The file region is given back on failure, so only the records in this chunk are lost */
+            ++SB_RECORDER_Data.WriteErrCount;
+            SB_RECORDER_Data.RecordDropCount += Chunk->Data.Hdr.RecordCount;
+            SB_RECORDER_Data.RecordCount -= Chunk->Data.Hdr.RecordCount;
+            SB_RECORDER_Data.RecordBytes -= Chunk->MsgBytes;
+            Chunk->Length = 0;
+
+            return OS_SUCCESS;
+        }
+    }
+
+    if (OsStatus == OS_ERR_NOT_IMPLEMENTED)
+    {
+        /* No asynchronous I/O on this platform, the recorder task absorbs the write instead */
+        SB_RECORDER_Data.UseAsync = false;
+        OsStatus                  = SB_RECORDER_WriteAll(Chunk->Data.Bytes, Chunk->Length);
+    }
+
+    /* Only a chunk that is on its way to the file goes in the index */
+    if (OsStatus == OS_SUCCESS)
+    {
+        Entry              = &SB_RECORDER_Data.Index[SB_RECORDER_Data.ChunkCount];
+        Entry->Offset      = SB_RECORDER_Data.FileOffset;
+        Entry->Length      = Chunk->Length;
+        Entry->RecordCount = Chunk->Data.Hdr.RecordCount;
+        Entry->Spare       = 0;
+        Entry->FirstTime   = Chunk->FirstTime;
+
+        ++SB_RECORDER_Data.ChunkCount;
+        SB_RECORDER_Data.FileOffset += Chunk->Length;
+    }
+
+    if (!Chunk->Submitted)
+    {
+        Chunk->Length = 0;
+    }
+
+    /* Fill the next buffer, which may still be in flight from an earlier flush */
+    SB_RECORDER_Data.FillIdx = (SB_RECORDER_Data.FillIdx + 1) % SB_RECORDER_NUM_CHUNKS;
+
+    return OsStatus;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 SB_RECORDER_WriterAppend(const CFE_SB_Buffer_t *BufPtr, CFE_MSG_Size_t Size)
+{
+    SB_RECORDER_Chunk_t *   Chunk;
+    SB_RECORDER_RecordHdr_t RecHdr;
+    size_t                  RecLen;
+    int32                   OsStatus;
+
+    RecLen = sizeof(RecHdr) + Size;
+    RecLen = (RecLen + SB_RECORDER_RECORD_ALIGN - 1) & ~((size_t)SB_RECORDER_RECORD_ALIGN - 1);
+
+    if (RecLen > SB_RECORDER_CHUNK_SIZE - sizeof(SB_RECORDER_ChunkHdr_t))
+    {
+        return OS_ERR_INVALID_SIZE;
+    }
+
+    /* Never wait here: SB drops for our pipe rather than for the publisher if we fall behind */
+    Chunk    = &SB_RECORDER_Data.Chunks[SB_RECORDER_Data.FillIdx];
+    OsStatus = SB_RECORDER_WaitChunk(Chunk, OS_CHECK);
+
+    if (OsStatus == OS_SUCCESS && Chunk->Length + RecLen > SB_RECORDER_CHUNK_SIZE)
+    {
+        OsStatus = SB_RECORDER_WriterFlush();
+        if (OsStatus == OS_SUCCESS)
+        {
+            Chunk    = &SB_RECORDER_Data.Chunks[SB_RECORDER_Data.FillIdx];
+            OsStatus = SB_RECORDER_WaitChunk(Chunk, OS_CHECK);
+        }
+    }
+
+    if (OsStatus != OS_SUCCESS)
+    {
+        return OsStatus;
+    }
+
+    RecHdr.Time   = CFE_TIME_GetTime();
+    RecHdr.Length = Size;
+    RecHdr.Spare  = 0;
+
+    if (Chunk->Length == 0)
+    {
+        Chunk->Length               = sizeof(SB_RECORDER_ChunkHdr_t);
+        Chunk->FirstTime            = RecHdr.Time;
+        Chunk->MsgBytes             = 0;
+        Chunk->Data.Hdr.RecordCount = 0;
+    }
+
+    memcpy(&Chunk->Data.Bytes[Chunk->Length], &RecHdr, sizeof(RecHdr));
+    memcpy(&Chunk->Data.Bytes[Chunk->Length + sizeof(RecHdr)], BufPtr, Size);
+    memset(&Chunk->Data.Bytes[Chunk->Length + sizeof(RecHdr) + Size], 0, RecLen - sizeof(RecHdr) - Size);
+
+    Chunk->Length += RecLen;
+    Chunk->MsgBytes += Size;
+    ++Chunk->Data.Hdr.RecordCount;
+
+    ++SB_RECORDER_Data.RecordCount;
+    SB_RECORDER_Data.RecordBytes += Size;
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 SB_RECORDER_WriterClose(void)
+{
+    SB_RECORDER_Trailer_t Trailer;
+    int32                 OsStatus;
+    int32                 WriteStatus;
+    uint32                i;
+
+    OsStatus = SB_RECORDER_WriterFlush();
+
+    /* All writes must be complete before the index is appended and the file is closed */
+    for (i = 0; i < SB_RECORDER_NUM_CHUNKS; ++i)
+    {
+        SB_RECORDER_WaitChunk(&SB_RECORDER_Data.Chunks[i], OS_PEND);
+        SB_RECORDER_Data.Chunks[i].Length = 0;
+    }
+
+    if (SB_RECORDER_Data.WriteErrCount != 0 && OsStatus == OS_SUCCESS)
+    {
+        OsStatus = OS_ERROR;
+    }
+
+    Trailer.Magic       = SB_RECORDER_TRAILER_MAGIC;
+    Trailer.IndexOffset = SB_RECORDER_Data.FileOffset;
+    Trailer.ChunkCount  = SB_RECORDER_Data.ChunkCount;
+    Trailer.RecordCount = SB_RECORDER_Data.RecordCount;
+
+    WriteStatus = OS_SUCCESS;
+    if (SB_RECORDER_Data.ChunkCount != 0)
+    {
+        WriteStatus = SB_RECORDER_WriteAll(SB_RECORDER_Data.Index,
+                                           SB_RECORDER_Data.ChunkCount * sizeof(SB_RECORDER_IndexEntry_t));
+    }
+    if (WriteStatus == OS_SUCCESS)
+    {
+        WriteStatus = SB_RECORDER_WriteAll(&Trailer, sizeof(Trailer));
+    }
+    if (OsStatus == OS_SUCCESS)
+    {
+        OsStatus = WriteStatus;
+    }
+
+    OS_close(SB_RECORDER_Data.Fd);
+    SB_RECORDER_Data.Fd = OS_OBJECT_ID_UNDEFINED;
+
+    return OsStatus;
+}
@@ -0,0 +1,44 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Common setup for the sb_recorder coverage tests
+ */
+
+#include "sb_recorder_app.h"
+
+#include "setup.h"
+
+#include <string.h>
+
+/*
+ * Setup function prior to every test
+ */
+void SB_RECORDER_UT_Setup(void)
+{
+    UT_ResetState(0);
+    memset(&SB_RECORDER_Data, 0, sizeof(SB_RECORDER_Data));
+    SB_RECORDER_Data.Fd = OS_OBJECT_ID_UNDEFINED;
+}
+
+/*
+ * Teardown function after every test
+ */
+void SB_RECORDER_UT_TearDown(void) {}
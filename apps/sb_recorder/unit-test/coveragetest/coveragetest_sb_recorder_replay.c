@@ -0,0 +1,325 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** File: coveragetest_sb_recorder_replay.c
+**
+** Purpose:
+** Coverage Unit Test cases for the SB Recorder replay task
+*/
+
+/*
+ * Includes
+ */
+#include "sb_recorder_coveragetest_common.h"
+
+#include <string.h>
+
+/* Size of the test messages, and of their records within a chunk */
+#define UT_MSG_SIZE 32
+#define UT_REC_SIZE \
+    ((sizeof(SB_RECORDER_RecordHdr_t) + UT_MSG_SIZE + SB_RECORDER_RECORD_ALIGN - 1) & ~(SB_RECORDER_RECORD_ALIGN - 1))
+#define UT_CHUNK_SIZE (sizeof(SB_RECORDER_ChunkHdr_t) + (2 * UT_REC_SIZE))
+
+/*
+ * The part of a recording the replay task reads after the cFE file header:
+ * the last bytes of the file where the trailer would be, then the chunks in
+ * order from the start of the file.
+ */
+typedef struct
+{
+    SB_RECORDER_Trailer_t Trailer;
+    uint8                 Chunk[UT_CHUNK_SIZE];
+} UT_FileImage_t;
+
+typedef union
+{
+    CFE_SB_Buffer_t Buf;
+    uint8           Bytes[UT_MSG_SIZE];
+} UT_Msg_t;
+
+static UT_FileImage_t   UT_File;
+static CFE_FS_Header_t  UT_FsHdr;
+static UT_Msg_t         UT_Msgs[2];
+static CFE_SB_Buffer_t *UT_MsgPtrs[2];
+
+static uint16 UT_EventID;
+static uint16 UT_EventType;
+
+/*
+ * Capture the ID and type of the last event sent
+ */
+static int32 UT_SendEventHook(void *UserObj, int32 StubRetcode, uint32 CallCount, const UT_StubContext_t *Context)
+{
+    UT_EventID   = UT_Hook_GetArgValueByName(Context, "EventID", uint16);
+    UT_EventType = UT_Hook_GetArgValueByName(Context, "EventType", CFE_EVS_EventType_Enum_t);
+
+    return StubRetcode;
+}
+
+/*
+ * Stand-in for the passage of time while the replay waits: stop the replay
+ */
+static int32 UT_TaskDelayHook(void *UserObj, int32 StubRetcode, uint32 CallCount, const UT_StubContext_t *Context)
+{
+    SB_RECORDER_Data.ReplayStop = true;
+
+    return StubRetcode;
+}
+
+/*
+ * Build a recording of one chunk with two records, whose chunks end at
+ * IndexOffset according to its trailer, in a file of FileSize bytes
+ */
+static void UT_SetupFile(uint32 IndexOffset, int32 FileSize)
+{
+    SB_RECORDER_ChunkHdr_t  ChunkHdr;
+    SB_RECORDER_RecordHdr_t RecHdr;
+    uint32                  i;
+
+    memset(&UT_File, 0, sizeof(UT_File));
+    memset(&UT_FsHdr, 0, sizeof(UT_FsHdr));
+    memset(UT_Msgs, 0, sizeof(UT_Msgs));
+
+    UT_File.Trailer.Magic       = SB_RECORDER_TRAILER_MAGIC;
+    UT_File.Trailer.IndexOffset = IndexOffset;
+    UT_File.Trailer.ChunkCount  = 1;
+    UT_File.Trailer.RecordCount = 2;
+
+    ChunkHdr.Magic       = SB_RECORDER_CHUNK_MAGIC;
+    ChunkHdr.Length      = UT_CHUNK_SIZE;
+    ChunkHdr.Sequence    = 0;
+    ChunkHdr.RecordCount = 2;
+    memcpy(UT_File.Chunk, &ChunkHdr, sizeof(ChunkHdr));
+
+    for (i = 0; i < 2; ++i)
+    {
+        memset(&RecHdr, 0, sizeof(RecHdr));
+        RecHdr.Time.Seconds = i;
+        RecHdr.Length       = UT_MSG_SIZE;
+        memcpy(&UT_File.Chunk[sizeof(ChunkHdr) + (i * UT_REC_SIZE)], &RecHdr, sizeof(RecHdr));
+        UT_MsgPtrs[i] = &UT_Msgs[i].Buf;
+    }
+
+    UT_FsHdr.SubType = SB_RECORDER_FS_SUBTYPE;
+
+    UT_SetDataBuffer(UT_KEY(CFE_FS_ReadHeader), &UT_FsHdr, sizeof(UT_FsHdr), false);
+    UT_SetDataBuffer(UT_KEY(OS_read), &UT_File, sizeof(UT_File), false);
+    UT_SetDataBuffer(UT_KEY(CFE_SB_AllocateMessageBuffer), UT_MsgPtrs, sizeof(UT_MsgPtrs), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, FileSize);
+}
+
+/*
+ * Run the replay task for one replay request
+ */
+static void UT_RunReplay(void)
+{
+    UT_EventID   = 0;
+    UT_EventType = 0;
+    UT_SetHookFunction(UT_KEY(CFE_EVS_SendEvent), UT_SendEventHook, NULL);
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemTake), 2, OS_ERROR);
+
+    SB_RECORDER_Data.ReplayActive = true;
+    SB_RECORDER_ReplayTask();
+
+    UtAssert_BOOL_FALSE(SB_RECORDER_Data.ReplayActive);
+    UtAssert_STUB_COUNT(OS_BinSemTake, 2);
+}
+
+/*
+**********************************************************************************
+**          TEST CASE FUNCTIONS
+**********************************************************************************
+*/
+
+void Test_SB_RECORDER_ReplayTrailer(void)
+{
+    /*
+     * Test Case For:
+     * void SB_RECORDER_ReplayTask(void)
+     * with a recording that was closed normally
+     */
+    uint32 IndexOffset;
+
+    /* the replay stops where the index starts, not at the end of the file */
+    IndexOffset = sizeof(CFE_FS_Header_t) + UT_CHUNK_SIZE;
+    UT_SetupFile(IndexOffset, IndexOffset + sizeof(SB_RECORDER_IndexEntry_t) + sizeof(SB_RECORDER_Trailer_t));
+    UT_RunReplay();
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 2);
+    UtAssert_STUB_COUNT(OS_read, 3);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_UINT32_EQ(UT_EventID, SB_RECORDER_REPLAY_DONE_INF_EID);
+    UtAssert_UINT32_EQ(UT_EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_MemCmp(&UT_Msgs[0], &UT_File.Chunk[sizeof(SB_RECORDER_ChunkHdr_t) + sizeof(SB_RECORDER_RecordHdr_t)],
+                    UT_MSG_SIZE, "First message content");
+}
+
+void Test_SB_RECORDER_ReplayNoTrailer(void)
+{
+    /*
+     * Test Case For:
+     * void SB_RECORDER_ReplayTask(void)
+     * with a recording that was never closed
+     */
+    int32 FileSize;
+
+    /* without a trailer the chunks run to the end of the file */
+    FileSize = sizeof(CFE_FS_Header_t) + UT_CHUNK_SIZE;
+    UT_SetupFile(0, FileSize);
+    UT_File.Trailer.Magic = 0;
+    UT_RunReplay();
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 2);
+    UtAssert_UINT32_EQ(UT_EventType, CFE_EVS_EventType_INFORMATION);
+
+    /* a trailer pointing beyond the end of the file is not used, so the bytes after the chunk are read as one */
+    UT_ResetState(0);
+    FileSize = sizeof(CFE_FS_Header_t) + UT_CHUNK_SIZE + sizeof(SB_RECORDER_Trailer_t);
+    UT_SetupFile(FileSize + 1, FileSize);
+    UT_RunReplay();
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 2);
+    UtAssert_UINT32_EQ(UT_EventID, SB_RECORDER_REPLAY_DONE_INF_EID);
+    UtAssert_UINT32_EQ(UT_EventType, CFE_EVS_EventType_ERROR);
+
+    /* a file too short to hold a trailer is not searched for one */
+    UT_ResetState(0);
+    UT_SetupFile(0, sizeof(CFE_FS_Header_t));
+    UT_RunReplay();
+    UtAssert_STUB_COUNT(OS_read, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 0);
+    UtAssert_UINT32_EQ(UT_EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+void Test_SB_RECORDER_ReplayCorrupt(void)
+{
+    /*
+     * Test Case For:
+     * void SB_RECORDER_ReplayTask(void)
+     * with a damaged recording
+     */
+    uint32                  IndexOffset;
+    SB_RECORDER_RecordHdr_t RecHdr;
+
+    IndexOffset = sizeof(CFE_FS_Header_t) + UT_CHUNK_SIZE;
+
+    /* bad chunk magic */
+    UT_SetupFile(IndexOffset, IndexOffset + sizeof(SB_RECORDER_Trailer_t));
+    UT_File.Chunk[0] ^= 0xFF;
+    UT_RunReplay();
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 0);
+    UtAssert_UINT32_EQ(UT_EventID, SB_RECORDER_REPLAY_DONE_INF_EID);
+    UtAssert_UINT32_EQ(UT_EventType, CFE_EVS_EventType_ERROR);
+
+    /* a record longer than what is left of the chunk, after the first record was sent */
+    UT_ResetState(0);
+    UT_SetupFile(IndexOffset, IndexOffset + sizeof(SB_RECORDER_Trailer_t));
+    memcpy(&RecHdr, &UT_File.Chunk[sizeof(SB_RECORDER_ChunkHdr_t) + UT_REC_SIZE], sizeof(RecHdr));
+    RecHdr.Length = UT_REC_SIZE;
+    memcpy(&UT_File.Chunk[sizeof(SB_RECORDER_ChunkHdr_t) + UT_REC_SIZE], &RecHdr, sizeof(RecHdr));
+    UT_RunReplay();
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 1);
+    UtAssert_UINT32_EQ(UT_EventType, CFE_EVS_EventType_ERROR);
+
+    /* more records than fit in the chunk */
+    UT_ResetState(0);
+    UT_SetupFile(IndexOffset, IndexOffset + sizeof(SB_RECORDER_Trailer_t));
+    UT_File.Chunk[offsetof(SB_RECORDER_ChunkHdr_t, RecordCount)] = 3;
+    UT_RunReplay();
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 2);
+    UtAssert_UINT32_EQ(UT_EventType, CFE_EVS_EventType_ERROR);
+}
+
+void Test_SB_RECORDER_ReplayDrops(void)
+{
+    /*
+     * Test Case For:
+     * void SB_RECORDER_ReplayTask(void)
+     * when SB can't take the messages
+     */
+    uint32 IndexOffset;
+
+    IndexOffset = sizeof(CFE_FS_Header_t) + UT_CHUNK_SIZE;
+
+    /* no buffer for the first message, the second one is rejected and released */
+    UT_SetupFile(IndexOffset, IndexOffset + sizeof(SB_RECORDER_Trailer_t));
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_AllocateMessageBuffer), 1, -1);
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_TransmitBuffer), 1, CFE_SB_BUF_ALOC_ERR);
+    UT_RunReplay();
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 1);
+    UtAssert_STUB_COUNT(CFE_SB_ReleaseMessageBuffer, 1);
+    UtAssert_UINT32_EQ(UT_EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+void Test_SB_RECORDER_ReplayPaced(void)
+{
+    /*
+     * Test Case For:
+     * void SB_RECORDER_ReplayTask(void)
+     * at the recorded rate
+     */
+    CFE_TIME_SysTime_t Gap = {2, 0};
+    uint32             IndexOffset;
+
+    /* the second record is due later, and the replay is stopped while waiting for it */
+    IndexOffset = sizeof(CFE_FS_Header_t) + UT_CHUNK_SIZE;
+    UT_SetupFile(IndexOffset, IndexOffset + sizeof(SB_RECORDER_Trailer_t));
+    SB_RECORDER_Data.ReplaySpeed = 1;
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TIME_Compare), CFE_TIME_A_GT_B);
+    UT_SetDataBuffer(UT_KEY(CFE_TIME_Subtract), &Gap, sizeof(Gap), false);
+    UT_SetHookFunction(UT_KEY(OS_TaskDelay), UT_TaskDelayHook, NULL);
+    UT_RunReplay();
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 2);
+    UtAssert_UINT32_EQ(UT_EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+void Test_SB_RECORDER_ReplayFileErr(void)
+{
+    /*
+     * Test Case For:
+     * void SB_RECORDER_ReplayTask(void)
+     * when the file can't be replayed at all
+     */
+
+    /* the file can't be opened */
+    UT_SetDeferredRetcode(UT_KEY(OS_OpenCreate), 1, OS_ERROR);
+    UT_RunReplay();
+    UtAssert_STUB_COUNT(OS_close, 0);
+    UtAssert_UINT32_EQ(UT_EventID, SB_RECORDER_REPLAY_FILE_ERR_EID);
+
+    /* the file is not a recording */
+    UT_ResetState(0);
+    UT_SetupFile(0, 0);
+    UT_FsHdr.SubType = 0;
+    UT_RunReplay();
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 0);
+    UtAssert_UINT32_EQ(UT_EventID, SB_RECORDER_REPLAY_FILE_ERR_EID);
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(SB_RECORDER_ReplayTrailer);
+    ADD_TEST(SB_RECORDER_ReplayNoTrailer);
+    ADD_TEST(SB_RECORDER_ReplayCorrupt);
+    ADD_TEST(SB_RECORDER_ReplayDrops);
+    ADD_TEST(SB_RECORDER_ReplayPaced);
+    ADD_TEST(SB_RECORDER_ReplayFileErr);
+}
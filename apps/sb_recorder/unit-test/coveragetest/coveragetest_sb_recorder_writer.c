@@ -0,0 +1,307 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** File: coveragetest_sb_recorder_writer.c
+**
+** Purpose:
+** Coverage Unit Test cases for the SB Recorder file writer
+*/
+
+/*
+ * Includes
+ */
+#include "sb_recorder_coveragetest_common.h"
+
+#include <string.h>
+
+/* Size of the test messages, and of their records within a chunk */
+#define UT_MSG_SIZE 32
+#define UT_REC_SIZE \
+    ((sizeof(SB_RECORDER_RecordHdr_t) + UT_MSG_SIZE + SB_RECORDER_RECORD_ALIGN - 1) & ~(SB_RECORDER_RECORD_ALIGN - 1))
+
+typedef union
+{
+    CFE_SB_Buffer_t Buf;
+    uint8           Bytes[UT_MSG_SIZE];
+} UT_Msg_t;
+
+static UT_Msg_t UT_Msg;
+
+/*
+ * Open a recording and append Count test messages to it
+ */
+static void UT_OpenAndAppend(uint32 Count)
+{
+    uint32 i;
+
+    UtAssert_INT32_EQ(SB_RECORDER_WriterOpen("/ram/ut.rec"), OS_SUCCESS);
+
+    for (i = 0; i < Count; ++i)
+    {
+        UtAssert_INT32_EQ(SB_RECORDER_WriterAppend(&UT_Msg.Buf, UT_MSG_SIZE), OS_SUCCESS);
+    }
+}
+
+/*
+**********************************************************************************
+**          TEST CASE FUNCTIONS
+**********************************************************************************
+*/
+
+void Test_SB_RECORDER_WriterOpen(void)
+{
+    /*
+     * Test Case For:
+     * int32 SB_RECORDER_WriterOpen(const char *Filename)
+     */
+
+    /* nominal, the chunks follow the cFE file header */
+    UtAssert_INT32_EQ(SB_RECORDER_WriterOpen("/ram/ut.rec"), OS_SUCCESS);
+    UtAssert_UINT32_EQ(SB_RECORDER_Data.FileOffset, sizeof(CFE_FS_Header_t));
+    UtAssert_BOOL_TRUE(SB_RECORDER_Data.UseAsync);
+    UtAssert_UINT32_EQ(SB_RECORDER_Data.ChunkCount, 0);
+
+    /* the file can't be created */
+    UT_SetDeferredRetcode(UT_KEY(OS_OpenCreate), 1, OS_ERROR);
+    UtAssert_INT32_EQ(SB_RECORDER_WriterOpen("/ram/ut.rec"), OS_ERROR);
+
+    /* the file header can't be written, the file is closed again */
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_WriteHeader), 1, 0);
+    UtAssert_INT32_EQ(SB_RECORDER_WriterOpen("/ram/ut.rec"), OS_ERROR);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(SB_RECORDER_Data.Fd));
+}
+
+void Test_SB_RECORDER_WriterFlush(void)
+{
+    /*
+     * Test Case For:
+     * int32 SB_RECORDER_WriterFlush(void)
+     */
+    SB_RECORDER_IndexEntry_t *Entry = &SB_RECORDER_Data.Index[0];
+    uint32                    ChunkLen;
+
+    ChunkLen = sizeof(SB_RECORDER_ChunkHdr_t) + (2 * UT_REC_SIZE);
+
+    /* an empty chunk is not written */
+    UT_OpenAndAppend(0);
+    UtAssert_INT32_EQ(SB_RECORDER_WriterFlush(), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_AsyncWrite, 0);
+
+    /* nominal, the chunk is submitted and indexed at the current end of the chunks */
+    UtAssert_INT32_EQ(SB_RECORDER_WriterAppend(&UT_Msg.Buf, UT_MSG_SIZE), OS_SUCCESS);
+    UtAssert_INT32_EQ(SB_RECORDER_WriterAppend(&UT_Msg.Buf, UT_MSG_SIZE), OS_SUCCESS);
+    UtAssert_INT32_EQ(SB_RECORDER_WriterFlush(), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_AsyncWrite, 1);
+    UtAssert_BOOL_TRUE(SB_RECORDER_Data.Chunks[0].Submitted);
+    UtAssert_UINT32_EQ(SB_RECORDER_Data.Chunks[0].Data.Hdr.Length, ChunkLen);
+    UtAssert_UINT32_EQ(SB_RECORDER_Data.ChunkCount, 1);
+    UtAssert_UINT32_EQ(Entry->Offset, sizeof(CFE_FS_Header_t));
+    UtAssert_UINT32_EQ(Entry->Length, ChunkLen);
+    UtAssert_UINT32_EQ(Entry->RecordCount, 2);
+    UtAssert_UINT32_EQ(SB_RECORDER_Data.FileOffset, sizeof(CFE_FS_Header_t) + ChunkLen);
+    UtAssert_UINT32_EQ(SB_RECORDER_Data.FillIdx, 1);
+
+    /* a chunk still in flight is not submitted twice */
+    SB_RECORDER_Data.FillIdx = 0;
+    UtAssert_INT32_EQ(SB_RECORDER_WriterFlush(), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_AsyncWrite, 1);
+
+    /* the chunk index is full */
+    SB_RECORDER_Data.FillIdx    = 1;
+    SB_RECORDER_Data.ChunkCount = SB_RECORDER_MAX_CHUNKS;
+    UtAssert_INT32_EQ(SB_RECORDER_WriterAppend(&UT_Msg.Buf, UT_MSG_SIZE), OS_SUCCESS);
+    UtAssert_INT32_EQ(SB_RECORDER_WriterFlush(), OS_ERR_NO_FREE_IDS);
+}
+
+void Test_SB_RECORDER_WriterFlushSubmitError(void)
+{
+    /*
+     * Test Case For:
+     * int32 SB_RECORDER_WriterFlush(void)
+     * when the asynchronous write can't be submitted
+     */
+    SB_RECORDER_IndexEntry_t *Entry = &SB_RECORDER_Data.Index[0];
+
+    /* the records are dropped and nothing is indexed, recording goes on */
+    UT_OpenAndAppend(2);
+    UT_SetDeferredRetcode(UT_KEY(OS_AsyncWrite), 1, OS_ERROR);
+    UtAssert_INT32_EQ(SB_RECORDER_WriterFlush(), OS_SUCCESS);
+    UtAssert_UINT32_EQ(SB_RECORDER_Data.ChunkCount, 0);
+    UtAssert_UINT32_EQ(SB_RECORDER_Data.FileOffset, sizeof(CFE_FS_Header_t));
+    UtAssert_UINT32_EQ(SB_RECORDER_Data.RecordDropCount, 2);
+    UtAssert_UINT32_EQ(SB_RECORDER_Data.RecordCount, 0);
+    UtAssert_UINT32_EQ(SB_RECORDER_Data.RecordBytes, 0);
+    UtAssert_UINT32_EQ(SB_RECORDER_Data.WriteErrCount, 1);
+    UtAssert_BOOL_FALSE(SB_RECORDER_Data.Chunks[0].Submitted);
+    UtAssert_UINT32_EQ(SB_RECORDER_Data.Chunks[0].Length, 0);
+    UtAssert_BOOL_TRUE(SB_RECORDER_Data.UseAsync);
+
+    /* the next chunk takes the place of the dropped one */
+    UtAssert_INT32_EQ(SB_RECORDER_WriterAppend(&UT_Msg.Buf, UT_MSG_SIZE), OS_SUCCESS);
+    UtAssert_INT32_EQ(SB_RECORDER_WriterFlush(), OS_SUCCESS);
+    UtAssert_UINT32_EQ(SB_RECORDER_Data.ChunkCount, 1);
+    UtAssert_UINT32_EQ(SB_RECORDER_Data.Chunks[0].Data.Hdr.Sequence, 0);
+    UtAssert_UINT32_EQ(Entry->Offset, sizeof(CFE_FS_Header_t));
+    UtAssert_UINT32_EQ(Entry->RecordCount, 1);
+    UtAssert_UINT32_EQ(SB_RECORDER_Data.RecordCount, 1);
+    UtAssert_UINT32_EQ(SB_RECORDER_Data.RecordBytes, UT_MSG_SIZE);
+}
+
+void Test_SB_RECORDER_WriterFlushSync(void)
+{
+    /*
+     * Test Case For:
+     * int32 SB_RECORDER_WriterFlush(void)
+     * without asynchronous I/O
+     */
+    uint32 ChunkLen;
+
+    ChunkLen = sizeof(SB_RECORDER_ChunkHdr_t) + UT_REC_SIZE;
+
+    /* the write falls back to the recorder task, and stays there */
+    UT_OpenAndAppend(1);
+    UT_SetDeferredRetcode(UT_KEY(OS_AsyncWrite), 1, OS_ERR_NOT_IMPLEMENTED);
+    UtAssert_INT32_EQ(SB_RECORDER_WriterFlush(), OS_SUCCESS);
+    UtAssert_BOOL_FALSE(SB_RECORDER_Data.UseAsync);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_UINT32_EQ(SB_RECORDER_Data.ChunkCount, 1);
+    UtAssert_UINT32_EQ(SB_RECORDER_Data.FileOffset, sizeof(CFE_FS_Header_t) + ChunkLen);
+    UtAssert_UINT32_EQ(SB_RECORDER_Data.Chunks[0].Length, 0);
+
+    /* a failed synchronous write is reported and not indexed */
+    UtAssert_INT32_EQ(SB_RECORDER_WriterAppend(&UT_Msg.Buf, UT_MSG_SIZE), OS_SUCCESS);
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, OS_ERROR);
+    UtAssert_INT32_EQ(SB_RECORDER_WriterFlush(), OS_ERROR);
+    UtAssert_STUB_COUNT(OS_AsyncWrite, 1);
+    UtAssert_UINT32_EQ(SB_RECORDER_Data.ChunkCount, 1);
+    UtAssert_UINT32_EQ(SB_RECORDER_Data.FileOffset, sizeof(CFE_FS_Header_t) + ChunkLen);
+
+    /* a short synchronous write is an error too */
+    UtAssert_INT32_EQ(SB_RECORDER_WriterAppend(&UT_Msg.Buf, UT_MSG_SIZE), OS_SUCCESS);
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, 1);
+    UtAssert_INT32_EQ(SB_RECORDER_WriterFlush(), OS_ERROR);
+}
+
+void Test_SB_RECORDER_WriterAppend(void)
+{
+    /*
+     * Test Case For:
+     * int32 SB_RECORDER_WriterAppend(const CFE_SB_Buffer_t *BufPtr, CFE_MSG_Size_t Size)
+     */
+    SB_RECORDER_Chunk_t *Chunk = &SB_RECORDER_Data.Chunks[0];
+
+    /* nominal, the record lands after the chunk header */
+    UT_OpenAndAppend(1);
+    UtAssert_UINT32_EQ(Chunk->Length, sizeof(SB_RECORDER_ChunkHdr_t) + UT_REC_SIZE);
+    UtAssert_UINT32_EQ(Chunk->Data.Hdr.RecordCount, 1);
+    UtAssert_UINT32_EQ(SB_RECORDER_Data.RecordCount, 1);
+    UtAssert_UINT32_EQ(SB_RECORDER_Data.RecordBytes, UT_MSG_SIZE);
+
+    /* a message that can never fit in a chunk */
+    UtAssert_INT32_EQ(SB_RECORDER_WriterAppend(&UT_Msg.Buf, SB_RECORDER_CHUNK_SIZE), OS_ERR_INVALID_SIZE);
+
+    /* a full chunk is flushed and filling moves on to the next one */
+    Chunk->Length = SB_RECORDER_CHUNK_SIZE - UT_REC_SIZE + 1;
+    UtAssert_INT32_EQ(SB_RECORDER_WriterAppend(&UT_Msg.Buf, UT_MSG_SIZE), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_AsyncWrite, 1);
+    UtAssert_UINT32_EQ(SB_RECORDER_Data.FillIdx, 1);
+    UtAssert_UINT32_EQ(SB_RECORDER_Data.Chunks[1].Data.Hdr.RecordCount, 1);
+
+    /* the next chunk is still being written, so the message is dropped */
+    SB_RECORDER_Data.FillIdx = 0;
+    UT_SetDeferredRetcode(UT_KEY(OS_AsyncWait), 1, OS_ERROR_TIMEOUT);
+    UtAssert_INT32_EQ(SB_RECORDER_WriterAppend(&UT_Msg.Buf, UT_MSG_SIZE), OS_ERROR_TIMEOUT);
+    UtAssert_BOOL_TRUE(Chunk->Submitted);
+
+    /* the write completes short, which counts as a write error */
+    Chunk->Req.Result = 0;
+    UtAssert_INT32_EQ(SB_RECORDER_WriterAppend(&UT_Msg.Buf, UT_MSG_SIZE), OS_SUCCESS);
+    UtAssert_BOOL_FALSE(Chunk->Submitted);
+    UtAssert_UINT32_EQ(SB_RECORDER_Data.WriteErrCount, 1);
+
+    /* the chunk index is full when a full chunk is flushed */
+    Chunk->Length               = SB_RECORDER_CHUNK_SIZE;
+    SB_RECORDER_Data.ChunkCount = SB_RECORDER_MAX_CHUNKS;
+    UtAssert_INT32_EQ(SB_RECORDER_WriterAppend(&UT_Msg.Buf, UT_MSG_SIZE), OS_ERR_NO_FREE_IDS);
+}
+
+void Test_SB_RECORDER_WriterClose(void)
+{
+    /*
+     * Test Case For:
+     * int32 SB_RECORDER_WriterClose(void)
+     */
+    struct
+    {
+        SB_RECORDER_IndexEntry_t Index;
+        SB_RECORDER_Trailer_t    Trailer;
+    } Tail;
+    uint32 ChunkLen;
+
+    ChunkLen = sizeof(SB_RECORDER_ChunkHdr_t) + UT_REC_SIZE;
+
+    /* nominal, the index and the trailer follow the chunks */
+    memset(&Tail, 0, sizeof(Tail));
+    UT_OpenAndAppend(1);
+    UT_SetDataBuffer(UT_KEY(OS_write), &Tail, sizeof(Tail), false);
+    UtAssert_INT32_EQ(SB_RECORDER_WriterClose(), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_AsyncWrite, 1);
+    UtAssert_STUB_COUNT(OS_write, 2);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(SB_RECORDER_Data.Fd));
+    UtAssert_UINT32_EQ(Tail.Index.Offset, sizeof(CFE_FS_Header_t));
+    UtAssert_UINT32_EQ(Tail.Index.Length, ChunkLen);
+    UtAssert_UINT32_EQ(Tail.Trailer.Magic, SB_RECORDER_TRAILER_MAGIC);
+    UtAssert_UINT32_EQ(Tail.Trailer.IndexOffset, sizeof(CFE_FS_Header_t) + ChunkLen);
+    UtAssert_UINT32_EQ(Tail.Trailer.ChunkCount, 1);
+    UtAssert_UINT32_EQ(Tail.Trailer.RecordCount, 1);
+
+    /* a dropped chunk leaves a valid file, but the close reports the error */
+    UT_ResetState(0);
+    memset(&Tail, 0, sizeof(Tail));
+    UT_OpenAndAppend(1);
+    UT_SetDeferredRetcode(UT_KEY(OS_AsyncWrite), 1, OS_ERROR);
+    UT_SetDataBuffer(UT_KEY(OS_write), &Tail.Trailer, sizeof(Tail.Trailer), false);
+    UtAssert_INT32_EQ(SB_RECORDER_WriterClose(), OS_ERROR);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_UINT32_EQ(Tail.Trailer.IndexOffset, sizeof(CFE_FS_Header_t));
+    UtAssert_UINT32_EQ(Tail.Trailer.ChunkCount, 0);
+    UtAssert_UINT32_EQ(Tail.Trailer.RecordCount, 0);
+
+    /* the first error writing the index is returned */
+    UT_ResetState(0);
+    UT_OpenAndAppend(1);
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, OS_ERROR);
+    UtAssert_INT32_EQ(SB_RECORDER_WriterClose(), OS_ERROR);
+    UtAssert_STUB_COUNT(OS_write, 1);
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(SB_RECORDER_WriterOpen);
+    ADD_TEST(SB_RECORDER_WriterFlush);
+    ADD_TEST(SB_RECORDER_WriterFlushSubmitError);
+    ADD_TEST(SB_RECORDER_WriterFlushSync);
+    ADD_TEST(SB_RECORDER_WriterAppend);
+    ADD_TEST(SB_RECORDER_WriterClose);
+}
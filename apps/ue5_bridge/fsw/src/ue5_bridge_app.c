@@ -225,6 +225,8 @@ void UE5_BRIDGE_Init(void)
     CFE_EVS_Register(NULL, 0, CFE_EVS_EventFilter_BINARY);
 
     CFE_SB_CreatePipe(&UE5_BRIDGE_Data.CmdPipe, UE5_BRIDGE_PIPE_DEPTH, UE5_BRIDGE_PIPE_NAME);
+    /* Only the newest nav state matters, a slow bridge should not work through stale samples */
+    CFE_SB_SetPipeOpts(UE5_BRIDGE_Data.CmdPipe, CFE_SB_PIPEOPTS_LATEST_VALUE);
     /* Subscribe to centurio_nav HK so we can mirror it to UE5 */
     CFE_SB_Subscribe(CFE_SB_ValueToMsgId(CENTURIO_NAV_HK_TLM_MID), UE5_BRIDGE_Data.CmdPipe);
 
@@ -107,7 +107,7 @@ endif(CFE_EDS_ENABLED_BUILD)
 # used.
 list(APPEND MISSION_GLOBAL_APPLIST cfe_assert)
 
-# If ENABLE_UNIT_TEST is enabled, then include the cfe_testcase app
+# If ENABLE_UNIT_TEST is enabled, then include the cfe_testcase and cfe_bench apps
 if (ENABLE_UNIT_TESTS)
-    list(APPEND MISSION_GLOBAL_APPLIST cfe_testcase)
+    list(APPEND MISSION_GLOBAL_APPLIST cfe_testcase cfe_bench)
 endif (ENABLE_UNIT_TESTS)
@@ -109,6 +109,11 @@
 #define CFE_TIME_DATA_CMD_MID CFE_PLATFORM_CMD_MID_BASE_GLOB + CFE_MISSION_TIME_DATA_CMD_MSG /* 0x1860 */
 #define CFE_TIME_SEND_CMD_MID CFE_PLATFORM_CMD_MID_BASE_GLOB + CFE_MISSION_TIME_SEND_CMD_MSG /* 0x1862 */
 
+/*
+** Application Command Message Id's
+*/
+#define SB_RECORDER_CMD_MID CFE_PLATFORM_CMD_MID_BASE + 0x96 /* 0x1896, CFE_MISSION_SB_RECORDER_CMD_TOPICID */
+
 /*
 ** CFE Telemetry Message Id's
 */
@@ -126,6 +131,8 @@
 #define CFE_TBL_REG_TLM_MID         CFE_PLATFORM_TLM_MID_BASE + CFE_MISSION_TBL_REG_TLM_MSG         /* 0x080C */
 #define CFE_SB_ALLSUBS_TLM_MID      CFE_PLATFORM_TLM_MID_BASE + CFE_MISSION_SB_ALLSUBS_TLM_MSG      /* 0x080D */
 #define CFE_SB_ONESUB_TLM_MID       CFE_PLATFORM_TLM_MID_BASE + CFE_MISSION_SB_ONESUB_TLM_MSG       /* 0x080E */
+#define CFE_SB_LATENCY_TLM_MID      CFE_PLATFORM_TLM_MID_BASE + CFE_MISSION_SB_LATENCY_TLM_MSG      /* 0x080F */
 #define CFE_ES_MEMSTATS_TLM_MID     CFE_PLATFORM_TLM_MID_BASE + CFE_MISSION_ES_MEMSTATS_TLM_MSG     /* 0x0810 */
+#define CFE_ES_APP_RESOURCE_TLM_MID CFE_PLATFORM_TLM_MID_BASE + CFE_MISSION_ES_APP_RESOURCE_TLM_MSG /* 0x0811 */
 
 #endif /* CPU1_MSGIDS_H */
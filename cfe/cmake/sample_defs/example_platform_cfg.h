@@ -829,6 +829,27 @@
 #define CFE_PLATFORM_ES_CDS_MEM_BLOCK_SIZE_16 32768
 #define CFE_PLATFORM_ES_CDS_MAX_BLOCK_SIZE    80000
 
+/**
+**  \cfeescfg Define ES Critical Data Store CRC Chunk Size
+**
+**  \par Description:
+**       The user data in each CDS block is protected by one CRC per chunk of
+**       this many bytes.  Partial updates of a CDS block (see CFE_ES_CopyRangesToCDS)
+**       only copy and re-checksum the chunks that contain modified bytes, so a
+**       smaller value reduces the cost of small updates at the expense of
+**       4 bytes of CDS storage per chunk.
+**
+**       The CRC table is stored in the same CDS block as the user data.  The
+**       largest pool block is enlarged by the CRC table of a
+**       #CFE_PLATFORM_ES_CDS_MAX_BLOCK_SIZE block, so the largest CDS an
+**       application can register is not reduced, but #CFE_PLATFORM_ES_CDS_SIZE
+**       must leave room for the tables of all registered blocks.
+**
+**  \par Limits
+**       Must be an integral multiple of 4 and at least 16.
+*/
+#define CFE_PLATFORM_ES_CDS_CHUNK_SIZE 256
+
 /** \cfeescfg Poll timer for startup sync delay
 **
 **  \par Description:
@@ -869,6 +890,72 @@
 */
 #define CFE_PLATFORM_ES_STARTUP_SCRIPT_TIMEOUT_MSEC 1000
 
+/** \cfeescfg Startup module loader workers
+**
+**  \par Description:
+**      Number of worker tasks used to load the modules listed in the CFE ES startup
+**      script concurrently.  Modules are still started (library init functions called
+**      and app main tasks created) one at a time in the order they appear in the script.
+**
+**      An optional 9th field in each startup script entry lists the names of earlier
+**      entries, separated by ':', whose modules must be loaded before this one, or
+**      NONE.  Entries without this field wait for all earlier libraries.
+**
+**      Set to 0 to load and start each module in turn as the script is read.
+**
+**  \par Limits:
+**       Must be defined as an integer value that is greater than
+**       or equal to zero.
+*/
+#define CFE_PLATFORM_ES_STARTUP_LOAD_WORKERS 0
+
+/**
+**  \cfeescfg Default State Snapshot Filename
+**
+**  \par Description:
+**       The value of this constant defines the filename used to store the
+**       reset area, Critical Data Store and table snapshot.  This filename is used
+**       only when no filename is specified in the Write Snapshot command.
+**
+**  \par Limits
+**       The length of each string, including the NULL terminator cannot exceed the
+**       #OS_MAX_PATH_LEN value.
+*/
+#define CFE_PLATFORM_ES_DEFAULT_SNAPSHOT_FILE "/ram/cfe_es_snapshot.snap"
+
+/**
+**  \cfeescfg State Snapshot Restore Filename
+**
+**  \par Description:
+**       If a file with this name exists when the cFE starts from a power-on reset,
+**       its reset area and Critical Data Store contents are restored and the start is
+**       treated as a processor reset.  Tables registered during startup take their
+**       contents from the file.  The file is removed once startup is complete, so it
+**       is only restored once.
+**       The file system containing it must be available before #CFE_ES_Main is called.
+**       Set to an empty string to disable the restore check.
+**
+**  \par Limits
+**       The length of each string, including the NULL terminator cannot exceed the
+**       #OS_MAX_PATH_LEN value.
+*/
+#define CFE_PLATFORM_ES_SNAPSHOT_RESTORE_FILE "/cf/cfe_es_restore.snap"
+
+/**
+**  \cfeescfg State Snapshot Quiesce Timeout
+**
+**  \par Description:
+**       Maximum time to wait for running external applications to reach their
+**       #CFE_ES_RunLoop boundary before a requested snapshot is written anyway.
+**
+**      Units are in milliseconds
+**
+**  \par Limits:
+**       Must be defined as an integer value that is greater than
+**       or equal to zero.
+*/
+#define CFE_PLATFORM_ES_SNAPSHOT_QUIESCE_TIMEOUT_MSEC 1000
+
 /********************************************************************************/
 /*
  *   CFE Event Services (CFE_EVS) Application Private Config Definitions
@@ -1096,6 +1183,40 @@
 */
 #define CFE_PLATFORM_SB_MAX_DEST_PER_PKT 16
 
+/**
+**  \cfesbcfg Depth of the high priority lane of a pipe
+**
+**  \par Description:
+**       Messages subscribed with a #CFE_SB_QosPriority_HIGH quality of service are
+**       held in a separate lane of each pipe, which is read before the regular
+**       queue.  This sets how many high priority messages a single pipe can hold.
+**       Each pipe descriptor reserves one buffer pointer per entry.
+**
+**  \par Limits
+**       This parameter has a lower limit of 1 and an upper limit of 255.
+**
+*/
+#define CFE_PLATFORM_SB_PIPE_PRIORITY_LANE_DEPTH 16
+
+/**
+**  \cfesbcfg Enable message latency histograms
+**
+**  \par Description:
+**       When set to 1, the software bus timestamps every transmit and receive and
+**       keeps latency histograms per pipe and per message route.  These are reported
+**       in the latency telemetry packet and the routing and pipe info files.  When
+**       set to 0 the timestamps and histogram storage are compiled out, the latency
+**       packet is not sent and the latency fields in the info files read as zero.
+**
+**       The cost is one clock read per transmit and per receive plus one more at
+**       the end of each transmit, and a histogram update per delivery.
+**
+**  \par Limits
+**       This parameter must be 0 or 1.
+**
+*/
+#define CFE_PLATFORM_SB_LATENCY_STATS 1
+
 /**
 **  \cfesbcfg Default Subscription Message Limit
 **
@@ -1133,6 +1254,26 @@
 */
 #define CFE_PLATFORM_SB_BUF_MEMORY_BYTES 524288
 
+/**
+**  \cfesbcfg Small message buffer size and count
+**
+**  \par Description:
+**       Messages of up to CFE_PLATFORM_SB_SMALL_BUF_SIZE bytes (wakeups,
+**       housekeeping requests, short commands) are placed in one of
+**       CFE_PLATFORM_SB_SMALL_BUF_COUNT fixed slots kept on a free list, rather
+**       than being allocated from the SB memory pool.  Each slot holds the
+**       buffer descriptor and the content, rounded up to a multiple of 64 bytes.
+**       When all slots are in use, small messages fall back to the memory pool.
+**       The hit rate is reported in the SB statistics packet.
+**
+**  \par Limits
+**       CFE_PLATFORM_SB_SMALL_BUF_SIZE must be at least 8 and no more than
+**       CFE_MISSION_SB_MAX_SB_MSG_SIZE.  Setting CFE_PLATFORM_SB_SMALL_BUF_COUNT
+**       to 0 sends all messages through the memory pool.
+*/
+#define CFE_PLATFORM_SB_SMALL_BUF_SIZE  64
+#define CFE_PLATFORM_SB_SMALL_BUF_COUNT 64
+
 /**
 **  \cfesbcfg Highest Valid Message Id
 **
@@ -1155,9 +1296,37 @@
 **       CFE_PLATFORM_SB_MAX_MSG_IDS is used to size the message map.  In that case
 **       the range selected here does not impact message map memory use, so it's
 **       reasonable to use up to the full range supported by the message ID implementation.
+**
+**       When using the paged implementation for software bus routing, this value sets
+**       the number of levels in the map, see #CFE_PLATFORM_SB_MSGMAP_PAGE_BITS.
 */
 #define CFE_PLATFORM_SB_HIGHEST_VALID_MSGID 0x1FFF
 
+/**
+**  \cfesbcfg Message Map Page Size
+**
+**  \par Description:
+**       Only used by the paged implementation for software bus routing, which splits
+**       each message ID into fields of CFE_PLATFORM_SB_MSGMAP_PAGE_BITS bits, as in a
+**       page table.  The lowest field indexes a page holding the routes for
+**       2^CFE_PLATFORM_SB_MSGMAP_PAGE_BITS consecutive message IDs, the fields above it
+**       index tables of page numbers, and the highest field indexes the directory.  The
+**       map has as few levels (2 to 4) as cover CFE_PLATFORM_SB_HIGHEST_VALID_MSGID, so
+**       the directory has at most 2^CFE_PLATFORM_SB_MSGMAP_PAGE_BITS entries.  A table or
+**       page is only assigned to a span of message IDs once a route exists within it.
+**
+**       Each directory entry, table entry and page entry uses 2 bytes.  At each level the
+**       map reserves up to CFE_PLATFORM_SB_MAX_MSG_IDS tables or pages, fewer if the
+**       message ID range has fewer spans, so memory grows with the number of routes
+**       rather than the message ID range.  Smaller pages suit message IDs scattered
+**       across the range, larger pages suit message IDs clustered together.
+**
+**  \par Limits
+**       This parameter has a lower limit of 1 and an upper limit of 16, and must be
+**       large enough that four levels cover CFE_PLATFORM_SB_HIGHEST_VALID_MSGID.
+*/
+#define CFE_PLATFORM_SB_MSGMAP_PAGE_BITS 8
+
 /**
 **  \cfesbcfg Default Routing Information Filename
 **
@@ -1745,4 +1914,19 @@
 #define CFE_PLATFORM_TIME_TONE_TASK_STACK_SIZE  4096
 #define CFE_PLATFORM_TIME_ONEHZ_TASK_STACK_SIZE 8192
 
+/**
+**  \cfetimecfg Define TIME Child Task CPU Affinity
+**
+**  \par Description:
+**       Restricts the cFE_TIME Tone and 1HZ tasks to the CPUs set in this mask,
+**       where bit 0 is CPU 0.  Used with the OSAL_CONFIG_TIMEBASE_CPU_MASK option,
+**       this keeps the time critical threads together on a reserved CPU, away
+**       from the application tasks.  Has no effect on platforms without CPU
+**       affinity support.
+**
+**  \par Limits
+**       Zero leaves the tasks free to run on any CPU.
+*/
+#define CFE_PLATFORM_TIME_CHILD_TASK_CPU_MASK 0
+
 #endif /* EXAMPLE_PLATFORM_CFG_H */
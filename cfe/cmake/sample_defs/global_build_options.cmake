@@ -25,3 +25,11 @@ else()
   message (STATUS "OMIT_DEPRECATED=false: Deprecated elements included in build")
   set(MISSION_RESOURCEID_MODE "SIMPLE") # less type safe, but more backward compatible
 endif (OMIT_DEPRECATED)
+
+# Uncomment to compile the most frequently used message header accessors
+# (CFE_MSG_GetMsgId, CFE_MSG_GetSize, CFE_MSG_SetSequenceCount, ...) inline
+# into every user of cfe_msg.h, specialized for the mission header layout.
+# This must be set here rather than on the command line so the target builds
+# see it, and it is ignored in builds with unit tests.  The saving is small,
+# about 1% of the instructions executed per SB publish.
+#set(MISSION_MSG_INLINE_ACCESSORS TRUE)
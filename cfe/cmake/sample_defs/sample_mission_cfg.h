@@ -369,7 +369,9 @@
 #define CFE_MISSION_TBL_REG_TLM_MSG         12
 #define CFE_MISSION_SB_ALLSUBS_TLM_MSG      13
 #define CFE_MISSION_SB_ONESUB_TLM_MSG       14
+#define CFE_MISSION_SB_LATENCY_TLM_MSG      15
 #define CFE_MISSION_ES_MEMSTATS_TLM_MSG     16
+#define CFE_MISSION_ES_APP_RESOURCE_TLM_MSG 17
 
 /**
 **  \cfeescfg Mission Max Apps in a message
@@ -46,6 +46,9 @@
 #define CFE_MISSION_SB_MSG_LIM_PERF_ID    5  /**< \brief Performance ID for Software Bus Msg Limit Errors */
 #define CFE_MISSION_SB_PIPE_OFLOW_PERF_ID 27 /**< \brief Performance ID for Software Bus Pipe Overflow Errors */
 
+#define CFE_MISSION_ES_STARTUP_LOAD_PERF_ID  28 /**< \brief Performance ID for ES Startup Module Load */
+#define CFE_MISSION_ES_STARTUP_START_PERF_ID 29 /**< \brief Performance ID for ES Startup Module Start */
+
 #define CFE_MISSION_TIME_MAIN_PERF_ID        6 /**< \brief Performance ID for Time Services Task */
 #define CFE_MISSION_TIME_TONE1HZISR_PERF_ID  7 /**< \brief Performance ID for 1 Hz Tone ISR */
 #define CFE_MISSION_TIME_LOCAL1HZISR_PERF_ID 8 /**< \brief Performance ID for 1 Hz Local ISR */
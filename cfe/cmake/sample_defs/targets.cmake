@@ -102,14 +102,14 @@ SET(FT_INSTALL_SUBDIR "host/functional-test")
 SET(MISSION_CPUNAMES cpu1)
 
 SET(cpu1_PROCESSORID 1)
-SET(cpu1_APPLIST ci_lab to_lab sch_lab)
+SET(cpu1_APPLIST ci_lab to_lab sch_lab sb_bridge sb_recorder)
 SET(cpu1_FILELIST cfe_es_startup.scr)
 SET(cpu1_SYSTEM i686-linux-gnu)
 
 # CPU2 example.  This is not built by default anymore but
 # serves as an example of how one would configure multiple cpus.
 SET(cpu2_PROCESSORID 2)
-SET(cpu2_APPLIST ci_lab to_lab sch_lab)
+SET(cpu2_APPLIST ci_lab to_lab sch_lab sb_bridge sb_recorder)
 SET(cpu2_FILELIST cfe_es_startup.scr)
 SET(cpu2_SYSTEM i686-linux-gnu)
 
@@ -0,0 +1,100 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   CFE Benchmark app (CFE_BENCH) Platform Configuration
+ */
+#ifndef CFE_BENCH_PLATFORM_CFG_H
+#define CFE_BENCH_PLATFORM_CFG_H
+
+/**
+**  \brief Results file
+**
+**  \par Description:
+**      One CSV line is written here per measurement, with a header line
+**      first.  The file is truncated at the start of every run.
+*/
+#define CFE_BENCH_RESULTS_FILE "/cf/cfe_bench.csv"
+
+/**
+**  \brief Default number of iterations per measurement
+**
+**  \par Description:
+**      Cheap operations (time reads, pool and queue calls, perf markers)
+**      run this many times.  SB measurements scale it down by the number
+**      of subscribers and the message size so every case takes a similar
+**      amount of wall time.
+**
+**  \par Limits
+**      Must be at least 1.
+*/
+#define CFE_BENCH_ITERATIONS 10000
+
+/**
+**  \brief Number of table loads per measurement
+**
+**  \par Description:
+**      Table loads after the first one send an informational event each,
+**      so these run far fewer times than the other measurements.
+*/
+#define CFE_BENCH_TBL_ITERATIONS 100
+
+/**
+**  \brief Table files for the load from file measurement
+**
+**  \par Description:
+**      The same table image stored raw and compressed (elf2cfetbl -z),
+**      for table "CFE_BENCH.BenchFile".  Either file may be absent, in
+**      which case its measurement is skipped.  The first load of each
+**      file is reported separately since it is the only one that can
+**      miss the file system cache.
+*/
+#define CFE_BENCH_TBL_RAW_FILE "/cf/cfe_bench_raw.tbl"
+#define CFE_BENCH_TBL_LZ4_FILE "/cf/cfe_bench_lz4.tbl"
+
+/**
+**  \brief Size of table "CFE_BENCH.BenchFile"
+**
+**  \par Limits
+**      Must not exceed CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE.
+*/
+#define CFE_BENCH_TBL_FILE_SIZE 16384
+
+/**
+**  \brief Largest number of SB subscribers to measure
+**
+**  \par Description:
+**      SB publish/receive is measured with 1, 2, 4, ... subscribers up to
+**      this count.  Each subscriber is a separate pipe.
+**
+**  \par Limits
+**      Must not exceed CFE_PLATFORM_SB_MAX_DEST_PER_PKT.
+*/
+#define CFE_BENCH_MAX_SUBSCRIBERS 8
+
+/**
+**  \brief Performance ID used by the benchmark
+**
+**  \par Description:
+**      Marker logged by the ES performance log measurement.  Pick an ID
+**      that is not in use by any other app on the target.
+*/
+#define CFE_BENCH_PERF_ID 97
+
+#endif
@@ -0,0 +1,38 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   CFE Benchmark app (CFE_BENCH) Application Topic IDs
+ */
+#ifndef CFE_BENCH_TOPICIDS_H
+#define CFE_BENCH_TOPICIDS_H
+
+/**
+**  \cfemissioncfg cFE Portable Message Numbers for Telemetry
+**
+**  \par Description:
+**      Portable message number for the telemetry packets the benchmark
+**      publishes to itself.  Nothing else should use it.
+**
+**  \par Limits
+**      Not Applicable
+*/
+#define CFE_MISSION_BENCH_TLM_TOPICID 0x7F
+
+#endif
@@ -0,0 +1,30 @@
+###########################################################
+#
+# BENCH Core Module mission build setup
+#
+# This file is evaluated as part of the "prepare" stage
+# and can be used to set up prerequisites for the build,
+# such as generating header files
+#
+###########################################################
+
+# The list of header files that control the BENCH configuration
+set(BENCH_MISSION_CONFIG_FILE_LIST
+  cfe_bench_topicids.h
+)
+
+# Create wrappers around the all the config header files
+# This makes them individually overridable by the missions, without modifying
+# the distribution default copies
+foreach(BENCH_CFGFILE ${BENCH_MISSION_CONFIG_FILE_LIST})
+  get_filename_component(CFGKEY "${BENCH_CFGFILE}" NAME_WE)
+  if (DEFINED BENCH_CFGFILE_SRC_${CFGKEY})
+    set(DEFAULT_SOURCE GENERATED_FILE "${BENCH_CFGFILE_SRC_${CFGKEY}}")
+  else()
+    set(DEFAULT_SOURCE FALLBACK_FILE "${CMAKE_CURRENT_LIST_DIR}/config/default_${BENCH_CFGFILE}")
+  endif()
+  generate_config_includefile(
+    FILE_NAME           "${BENCH_CFGFILE}"
+    ${DEFAULT_SOURCE}
+  )
+endforeach()
@@ -0,0 +1,118 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Benchmarks of ES memory pools, performance log markers and CRC
+ */
+
+#include "cfe_bench.h"
+
+/* Block sizes for the pool measurement */
+static const uint32 BENCH_POOL_SIZES[] = {32, 512, 4096};
+
+/* Data lengths for the CRC measurement */
+static const uint32 BENCH_CRC_SIZES[] = {64, 1024, 16384};
+
+static CFE_ES_STATIC_POOL_TYPE(65536) BenchPoolMem;
+static uint8 BenchCrcData[16384];
+
+void BenchESPool(void)
+{
+    CFE_ES_MemHandle_t  PoolId;
+    CFE_ES_MemPoolBuf_t BufPtr;
+    uint32              SizeIdx;
+    uint32              Count;
+
+    if (!CFE_Assert_STATUS_OK(CFE_ES_PoolCreate(&PoolId, &BenchPoolMem, sizeof(BenchPoolMem))))
+    {
+        return;
+    }
+
+    for (SizeIdx = 0; SizeIdx < sizeof(BENCH_POOL_SIZES) / sizeof(BENCH_POOL_SIZES[0]); ++SizeIdx)
+    {
+        CFE_Bench_Start();
+        for (Count = 0; Count < CFE_BENCH_ITERATIONS; ++Count)
+        {
+            /* GetPoolBuf returns the block size on success, not CFE_SUCCESS */
+            if (CFE_ES_GetPoolBuf(&BufPtr, PoolId, BENCH_POOL_SIZES[SizeIdx]) < 0)
+            {
+                UtAssert_Failed("CFE_ES_GetPoolBuf(%lu) failed", (unsigned long)BENCH_POOL_SIZES[SizeIdx]);
+                break;
+            }
+            if (CFE_ES_PutPoolBuf(PoolId, BufPtr) < 0)
+            {
+                UtAssert_Failed("CFE_ES_PutPoolBuf() failed");
+                break;
+            }
+        }
+        CFE_Bench_Stop("ES", "GetPoolBuf+PutPoolBuf", BENCH_POOL_SIZES[SizeIdx], 0, Count);
+    }
+
+    CFE_Assert_STATUS_OK(CFE_ES_PoolDelete(PoolId));
+}
+
+void BenchESPerfLog(void)
+{
+    uint32 Count;
+
+    CFE_Bench_Start();
+    for (Count = 0; Count < CFE_BENCH_ITERATIONS; ++Count)
+    {
+        CFE_ES_PerfLogEntry(CFE_BENCH_PERF_ID);
+        CFE_ES_PerfLogExit(CFE_BENCH_PERF_ID);
+    }
+    CFE_Bench_Stop("ES", "PerfLogEntry+PerfLogExit", 0, 0, Count);
+}
+
+void BenchESCrc(void)
+{
+    uint32 SizeIdx;
+    uint32 Iterations;
+    uint32 Count;
+    uint32 Crc;
+
+    for (Count = 0; Count < sizeof(BenchCrcData); ++Count)
+    {
+        BenchCrcData[Count] = (uint8)(Count * 7);
+    }
+
+    for (SizeIdx = 0; SizeIdx < sizeof(BENCH_CRC_SIZES) / sizeof(BENCH_CRC_SIZES[0]); ++SizeIdx)
+    {
+        Iterations = CFE_Bench_ScaleIterations(CFE_BENCH_ITERATIONS, BENCH_CRC_SIZES[SizeIdx]);
+        Crc        = 0;
+
+        CFE_Bench_Start();
+        for (Count = 0; Count < Iterations; ++Count)
+        {
+            Crc = CFE_ES_CalculateCRC(BenchCrcData, BENCH_CRC_SIZES[SizeIdx], Crc, CFE_ES_CrcType_16_ARC);
+        }
+        CFE_Bench_Stop("ES", "CalculateCRC", BENCH_CRC_SIZES[SizeIdx], 0, Count);
+
+        /* keeps the result live */
+        UtPrintf("CRC chain result: 0x%04lx", (unsigned long)Crc);
+    }
+}
+
+void BenchESSetup(void)
+{
+    UtTest_Add(BenchESPool, NULL, NULL, "ES Memory Pool");
+    UtTest_Add(BenchESPerfLog, NULL, NULL, "ES Performance Log");
+    UtTest_Add(BenchESCrc, NULL, NULL, "ES CRC");
+}
@@ -0,0 +1,61 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Benchmarks of EVS event sending
+ */
+
+#include "cfe_bench.h"
+
+#define BENCH_EVS_EID 1
+
+/*
+ * The benchmark event is filtered after its first occurrence, so this
+ * measures the full SendEvent path up to and including the filter but
+ * not the output ports, which would flood the console.
+ */
+void BenchEVSSendEvent(void)
+{
+    CFE_EVS_BinFilter_t Filter;
+    uint32              Count;
+
+    Filter.EventID = BENCH_EVS_EID;
+    Filter.Mask    = CFE_EVS_FIRST_ONE_STOP;
+
+    if (!CFE_Assert_STATUS_OK(CFE_EVS_Register(&Filter, 1, CFE_EVS_EventFilter_BINARY)))
+    {
+        return;
+    }
+
+    CFE_Bench_Start();
+    for (Count = 0; Count < CFE_BENCH_ITERATIONS; ++Count)
+    {
+        CFE_EVS_SendEvent(BENCH_EVS_EID, CFE_EVS_EventType_INFORMATION, "Benchmark event %lu", (unsigned long)Count);
+    }
+    CFE_Bench_Stop("EVS", "SendEvent (filtered)", 0, 0, Count);
+
+    /* Registering again with no filters drops the benchmark filter */
+    CFE_Assert_STATUS_OK(CFE_EVS_Register(NULL, 0, CFE_EVS_EventFilter_BINARY));
+}
+
+void BenchEVSSetup(void)
+{
+    UtTest_Add(BenchEVSSendEvent, NULL, NULL, "EVS Send Event");
+}
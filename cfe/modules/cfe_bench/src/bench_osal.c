@@ -0,0 +1,75 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Benchmarks of OSAL queues
+ */
+
+#include "cfe_bench.h"
+
+/* Message sizes for the queue measurement */
+static const uint32 BENCH_QUEUE_SIZES[] = {16, 256, 1024};
+
+static uint8 BenchQueueData[1024];
+
+void BenchOSALQueue(void)
+{
+    osal_id_t QueueId;
+    uint32    SizeIdx;
+    uint32    Size;
+    uint32    Count;
+    size_t    SizeCopied;
+    int32     OsStatus;
+
+    for (SizeIdx = 0; SizeIdx < sizeof(BENCH_QUEUE_SIZES) / sizeof(BENCH_QUEUE_SIZES[0]); ++SizeIdx)
+    {
+        Size = BENCH_QUEUE_SIZES[SizeIdx];
+
+        OsStatus = OS_QueueCreate(&QueueId, "BenchQueue", 4, Size, 0);
+        if (OsStatus != OS_SUCCESS)
+        {
+            UtAssert_Failed("OS_QueueCreate(%lu) failed: %ld", (unsigned long)Size, (long)OsStatus);
+            return;
+        }
+
+        CFE_Bench_Start();
+        for (Count = 0; Count < CFE_BENCH_ITERATIONS; ++Count)
+        {
+            OsStatus = OS_QueuePut(QueueId, BenchQueueData, Size, 0);
+            if (OsStatus == OS_SUCCESS)
+            {
+                OsStatus = OS_QueueGet(QueueId, BenchQueueData, Size, &SizeCopied, OS_CHECK);
+            }
+            if (OsStatus != OS_SUCCESS)
+            {
+                UtAssert_Failed("OS_QueuePut/OS_QueueGet failed: %ld", (long)OsStatus);
+                break;
+            }
+        }
+        CFE_Bench_Stop("OSAL", "QueuePut+QueueGet", Size, 0, Count);
+
+        OS_QueueDelete(QueueId);
+    }
+}
+
+void BenchOSALSetup(void)
+{
+    UtTest_Add(BenchOSALQueue, NULL, NULL, "OSAL Queue");
+}
@@ -0,0 +1,207 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Benchmarks of SB transmit/receive
+ *
+ * Each case publishes one message and receives it on every subscribed
+ * pipe, for a range of message sizes and subscriber counts.  The copy case
+ * uses CFE_SB_TransmitMsg() on a prebuilt message, the zero copy case
+ * allocates, initializes and transmits an SB buffer every iteration.
+ */
+
+#include "cfe_bench.h"
+#include "cfe_bench_msgids.h"
+
+#include <stdio.h>
+
+/* Message sizes to measure, sizes over the mission limit are reported as N/A */
+static const uint32 BENCH_SB_SIZES[] = {16, 256, 4096, 65536};
+
+/* Staging buffer for the copy case, big enough for the largest SB message */
+typedef union
+{
+    CFE_SB_Buffer_t SBBuf;
+    uint8           Bytes[CFE_MISSION_SB_MAX_SB_MSG_SIZE];
+} BenchSBMsgBuffer_t;
+
+static BenchSBMsgBuffer_t BenchSBMsg;
+static CFE_SB_PipeId_t    BenchSBPipes[CFE_BENCH_MAX_SUBSCRIBERS];
+static CFE_SB_MsgId_t     CFE_BENCH_TLM_MSGID;
+
+static bool BenchSBCreatePipes(uint32 NumSubs)
+{
+    char   PipeName[OS_MAX_API_NAME];
+    uint32 i;
+
+    for (i = 0; i < NumSubs; ++i)
+    {
+        snprintf(PipeName, sizeof(PipeName), "BenchPipe%lu", (unsigned long)i);
+        if (!CFE_Assert_STATUS_OK(CFE_SB_CreatePipe(&BenchSBPipes[i], 4, PipeName)))
+        {
+            break;
+        }
+        if (!CFE_Assert_STATUS_OK(CFE_SB_Subscribe(CFE_BENCH_TLM_MSGID, BenchSBPipes[i])))
+        {
+            CFE_SB_DeletePipe(BenchSBPipes[i]);
+            break;
+        }
+    }
+
+    if (i < NumSubs)
+    {
+        while (i > 0)
+        {
+            --i;
+            CFE_SB_DeletePipe(BenchSBPipes[i]);
+        }
+        return false;
+    }
+
+    return true;
+}
+
+static void BenchSBDeletePipes(uint32 NumSubs)
+{
+    uint32 i;
+
+    for (i = 0; i < NumSubs; ++i)
+    {
+        CFE_Assert_STATUS_OK(CFE_SB_DeletePipe(BenchSBPipes[i]));
+    }
+}
+
+static bool BenchSBReceiveAll(uint32 NumSubs)
+{
+    CFE_SB_Buffer_t *MsgBuf;
+    uint32           i;
+
+    for (i = 0; i < NumSubs; ++i)
+    {
+        CFE_Assert_STATUS_STORE(CFE_SB_ReceiveBuffer(&MsgBuf, BenchSBPipes[i], CFE_SB_POLL));
+        if (!CFE_Assert_STATUS_SILENTCHECK(CFE_SUCCESS))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static bool BenchSBTransmitZeroCopy(uint32 Size)
+{
+    CFE_SB_Buffer_t *BufPtr;
+
+    BufPtr = CFE_SB_AllocateMessageBuffer(Size);
+    if (BufPtr == NULL)
+    {
+        UtAssert_Failed("CFE_SB_AllocateMessageBuffer(%lu) failed", (unsigned long)Size);
+        return false;
+    }
+
+    CFE_MSG_Init(&BufPtr->Msg, CFE_BENCH_TLM_MSGID, Size);
+
+    CFE_Assert_STATUS_STORE(CFE_SB_TransmitBuffer(BufPtr, true));
+    if (!CFE_Assert_STATUS_SILENTCHECK(CFE_SUCCESS))
+    {
+        CFE_SB_ReleaseMessageBuffer(BufPtr);
+        return false;
+    }
+
+    return true;
+}
+
+static void BenchSBTransmitReceive(bool IsZeroCopy)
+{
+    uint32 SizeIdx;
+    uint32 Size;
+    uint32 NumSubs;
+    uint32 Iterations;
+    uint32 Count;
+
+    for (SizeIdx = 0; SizeIdx < sizeof(BENCH_SB_SIZES) / sizeof(BENCH_SB_SIZES[0]); ++SizeIdx)
+    {
+        Size = BENCH_SB_SIZES[SizeIdx];
+        if (Size > CFE_MISSION_SB_MAX_SB_MSG_SIZE)
+        {
+            UtAssert_NA("Message size %lu exceeds CFE_MISSION_SB_MAX_SB_MSG_SIZE", (unsigned long)Size);
+            continue;
+        }
+
+        CFE_MSG_Init(&BenchSBMsg.SBBuf.Msg, CFE_BENCH_TLM_MSGID, Size);
+
+        for (NumSubs = 1; NumSubs <= CFE_BENCH_MAX_SUBSCRIBERS; NumSubs *= 2)
+        {
+            if (!BenchSBCreatePipes(NumSubs))
+            {
+                return;
+            }
+
+            Iterations = CFE_Bench_ScaleIterations(CFE_BENCH_ITERATIONS / NumSubs, Size);
+
+            CFE_Bench_Start();
+            for (Count = 0; Count < Iterations; ++Count)
+            {
+                if (IsZeroCopy)
+                {
+                    if (!BenchSBTransmitZeroCopy(Size))
+                    {
+                        break;
+                    }
+                }
+                else
+                {
+                    CFE_Assert_STATUS_STORE(CFE_SB_TransmitMsg(&BenchSBMsg.SBBuf.Msg, true));
+                    if (!CFE_Assert_STATUS_SILENTCHECK(CFE_SUCCESS))
+                    {
+                        break;
+                    }
+                }
+
+                if (!BenchSBReceiveAll(NumSubs))
+                {
+                    break;
+                }
+            }
+            CFE_Bench_Stop("SB", IsZeroCopy ? "TransmitBuffer+Receive" : "TransmitMsg+Receive", Size, NumSubs,
+                           Count);
+
+            BenchSBDeletePipes(NumSubs);
+        }
+    }
+}
+
+void BenchSBCopy(void)
+{
+    BenchSBTransmitReceive(false);
+}
+
+void BenchSBZeroCopy(void)
+{
+    BenchSBTransmitReceive(true);
+}
+
+void BenchSBSetup(void)
+{
+    CFE_BENCH_TLM_MSGID = CFE_SB_ValueToMsgId(CFE_BENCH_TLM_MID);
+
+    UtTest_Add(BenchSBCopy, NULL, NULL, "SB Transmit/Receive, Copy");
+    UtTest_Add(BenchSBZeroCopy, NULL, NULL, "SB Transmit/Receive, Zero Copy");
+}
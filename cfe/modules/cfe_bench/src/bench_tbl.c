@@ -0,0 +1,140 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Benchmarks of table loads and content access
+ */
+
+#include "cfe_bench.h"
+
+#include <stdio.h>
+
+/* Table sizes to measure, must not exceed the single buffered table limit */
+static const uint32 BENCH_TBL_SIZES[] = {256, 4096};
+
+static uint8 BenchTblData[4096];
+
+/* Same table image in each encoding, names used in the results */
+static const char *const BENCH_TBL_FILES[]     = {CFE_BENCH_TBL_RAW_FILE, CFE_BENCH_TBL_LZ4_FILE};
+static const char *const BENCH_TBL_ENCODINGS[] = {"raw", "lz4"};
+
+void BenchTBLLoad(void)
+{
+    CFE_TBL_Handle_t TblHandle;
+    char             TblName[CFE_MISSION_TBL_MAX_NAME_LENGTH];
+    void *           TblPtr;
+    uint32           SizeIdx;
+    uint32           Size;
+    uint32           Count;
+
+    for (SizeIdx = 0; SizeIdx < sizeof(BENCH_TBL_SIZES) / sizeof(BENCH_TBL_SIZES[0]); ++SizeIdx)
+    {
+        Size = BENCH_TBL_SIZES[SizeIdx];
+        snprintf(TblName, sizeof(TblName), "Bench%lu", (unsigned long)Size);
+
+        if (!CFE_Assert_STATUS_OK(CFE_TBL_Register(&TblHandle, TblName, Size, CFE_TBL_OPT_DEFAULT, NULL)))
+        {
+            return;
+        }
+
+        CFE_Bench_Start();
+        for (Count = 0; Count < CFE_BENCH_TBL_ITERATIONS; ++Count)
+        {
+            BenchTblData[0] = (uint8)Count;
+
+            CFE_Assert_STATUS_STORE(CFE_TBL_Load(TblHandle, CFE_TBL_SRC_ADDRESS, BenchTblData));
+            if (!CFE_Assert_STATUS_SILENTCHECK(CFE_SUCCESS))
+            {
+                break;
+            }
+        }
+        CFE_Bench_Stop("TBL", "Load", Size, 0, Count);
+
+        CFE_Bench_Start();
+        for (Count = 0; Count < CFE_BENCH_ITERATIONS; ++Count)
+        {
+            /* Returns CFE_TBL_INFO_UPDATED the first time after a load */
+            if (CFE_TBL_GetAddress(&TblPtr, TblHandle) < 0)
+            {
+                UtAssert_Failed("CFE_TBL_GetAddress() failed");
+                break;
+            }
+            CFE_TBL_ReleaseAddress(TblHandle);
+        }
+        CFE_Bench_Stop("TBL", "GetAddress+ReleaseAddress", Size, 0, Count);
+
+        CFE_Assert_STATUS_OK(CFE_TBL_Unregister(TblHandle));
+    }
+}
+
+void BenchTBLLoadFile(void)
+{
+    CFE_TBL_Handle_t TblHandle;
+    os_fstat_t       FileStats;
+    char             Name[32];
+    uint32           FileIdx;
+    uint32           FileSize;
+    uint32           Count;
+
+    if (!CFE_Assert_STATUS_OK(
+            CFE_TBL_Register(&TblHandle, "BenchFile", CFE_BENCH_TBL_FILE_SIZE, CFE_TBL_OPT_DEFAULT, NULL)))
+    {
+        return;
+    }
+
+    for (FileIdx = 0; FileIdx < sizeof(BENCH_TBL_FILES) / sizeof(BENCH_TBL_FILES[0]); ++FileIdx)
+    {
+        if (OS_stat(BENCH_TBL_FILES[FileIdx], &FileStats) != OS_SUCCESS)
+        {
+            UtAssert_NA("%s not present", BENCH_TBL_FILES[FileIdx]);
+            continue;
+        }
+        FileSize = OS_FILESTAT_SIZE(FileStats);
+
+        /* Only the first load can miss the file system cache */
+        CFE_Bench_Start();
+        if (!CFE_Assert_STATUS_OK(CFE_TBL_Load(TblHandle, CFE_TBL_SRC_FILE, BENCH_TBL_FILES[FileIdx])))
+        {
+            continue;
+        }
+        snprintf(Name, sizeof(Name), "LoadFile %s first", BENCH_TBL_ENCODINGS[FileIdx]);
+        CFE_Bench_Stop("TBL", Name, CFE_BENCH_TBL_FILE_SIZE, FileSize, 1);
+
+        CFE_Bench_Start();
+        for (Count = 0; Count < CFE_BENCH_TBL_ITERATIONS; ++Count)
+        {
+            CFE_Assert_STATUS_STORE(CFE_TBL_Load(TblHandle, CFE_TBL_SRC_FILE, BENCH_TBL_FILES[FileIdx]));
+            if (!CFE_Assert_STATUS_SILENTCHECK(CFE_SUCCESS))
+            {
+                break;
+            }
+        }
+        snprintf(Name, sizeof(Name), "LoadFile %s", BENCH_TBL_ENCODINGS[FileIdx]);
+        CFE_Bench_Stop("TBL", Name, CFE_BENCH_TBL_FILE_SIZE, FileSize, Count);
+    }
+
+    CFE_Assert_STATUS_OK(CFE_TBL_Unregister(TblHandle));
+}
+
+void BenchTBLSetup(void)
+{
+    UtTest_Add(BenchTBLLoad, NULL, NULL, "TBL Load and Access");
+    UtTest_Add(BenchTBLLoadFile, NULL, NULL, "TBL Load from File");
+}
@@ -0,0 +1,58 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Benchmarks of time retrieval
+ */
+
+#include "cfe_bench.h"
+
+#include <string.h>
+
+void BenchTimeGetTime(void)
+{
+    CFE_TIME_SysTime_t Now;
+    OS_time_t          PspNow;
+    uint32             Count;
+
+    memset(&Now, 0, sizeof(Now));
+
+    CFE_Bench_Start();
+    for (Count = 0; Count < CFE_BENCH_ITERATIONS; ++Count)
+    {
+        Now = CFE_TIME_GetTime();
+    }
+    CFE_Bench_Stop("TIME", "GetTime", 0, 0, Count);
+
+    /* The PSP clock underneath, for reference */
+    CFE_Bench_Start();
+    for (Count = 0; Count < CFE_BENCH_ITERATIONS; ++Count)
+    {
+        CFE_PSP_GetTime(&PspNow);
+    }
+    CFE_Bench_Stop("TIME", "CFE_PSP_GetTime", 0, 0, Count);
+
+    UtPrintf("Last time read: %lu.%05lu", (unsigned long)Now.Seconds, (unsigned long)(Now.Subseconds >> 16));
+}
+
+void BenchTimeSetup(void)
+{
+    UtTest_Add(BenchTimeGetTime, NULL, NULL, "TIME Get Time");
+}
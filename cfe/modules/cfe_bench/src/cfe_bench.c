@@ -0,0 +1,155 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *   Initialization routine and result recording for the CFE benchmarks
+ *
+ * The benchmarks use the CFE Assert runtime so they can be loaded into an
+ * unmodified CFE in the same way as the functional tests.  Each benchmark
+ * case runs one operation in a tight loop and records the elapsed PSP time.
+ */
+
+/*
+ * Includes
+ */
+
+#include "cfe_bench.h"
+
+#include <stdio.h>
+#include <string.h>
+
+CFE_Bench_Global_t CFE_Bench_Global;
+
+/*
+ * Internal helper: writes one line to the results file, if open
+ */
+static void CFE_Bench_WriteResult(const char *Line)
+{
+    size_t Length;
+
+    if (OS_ObjectIdDefined(CFE_Bench_Global.ResultsFd))
+    {
+        Length = strlen(Line);
+        if (OS_write(CFE_Bench_Global.ResultsFd, Line, Length) != (int32)Length)
+        {
+            UtAssert_Failed("Unable to write to %s", CFE_BENCH_RESULTS_FILE);
+            OS_close(CFE_Bench_Global.ResultsFd);
+            CFE_Bench_Global.ResultsFd = OS_OBJECT_ID_UNDEFINED;
+        }
+    }
+}
+
+uint32 CFE_Bench_ScaleIterations(uint32 Iterations, uint32 Size)
+{
+    if (Size > 256)
+    {
+        Iterations /= (Size / 256);
+    }
+
+    if (Iterations < 10)
+    {
+        Iterations = 10;
+    }
+
+    return Iterations;
+}
+
+void CFE_Bench_Start(void)
+{
+    CFE_PSP_GetTime(&CFE_Bench_Global.StartTime);
+}
+
+void CFE_Bench_Stop(const char *Suite, const char *Name, uint32 Size, uint32 Width, uint32 Iterations)
+{
+    OS_time_t Elapsed;
+    int64     TotalUsec;
+    int64     NsecPerOp;
+    char      Line[160];
+
+    CFE_PSP_GetTime(&Elapsed);
+    Elapsed = OS_TimeSubtract(Elapsed, CFE_Bench_Global.StartTime);
+
+    TotalUsec = OS_TimeGetTotalMicroseconds(Elapsed);
+    NsecPerOp = 0;
+    if (Iterations != 0)
+    {
+        NsecPerOp = OS_TimeGetTotalNanoseconds(Elapsed) / Iterations;
+    }
+
+    UtAssert_MIR("%s %s size=%lu width=%lu: %lu ops in %ld usec, %ld nsec/op", Suite, Name, (unsigned long)Size,
+                 (unsigned long)Width, (unsigned long)Iterations, (long)TotalUsec, (long)NsecPerOp);
+
+    snprintf(Line, sizeof(Line), "%s,%s,%lu,%lu,%lu,%ld,%ld\n", Suite, Name, (unsigned long)Size, (unsigned long)Width,
+             (unsigned long)Iterations, (long)TotalUsec, (long)NsecPerOp);
+    CFE_Bench_WriteResult(Line);
+}
+
+/*
+ * Benchmark main function
+ * Register the benchmark routines with CFE Assert
+ */
+void CFE_BenchMain(void)
+{
+    int32 OsStatus;
+
+    /*
+     * Register this app with CFE assert
+     *
+     * Note this also waits for the appropriate overall system
+     * state and gets ownership of the UtAssert subsystem
+     */
+    CFE_Assert_RegisterTest("CFE BENCH");
+    CFE_Assert_OpenLogFile(CFE_BENCH_LOG_FILE_NAME);
+
+    OsStatus = OS_OpenCreate(&CFE_Bench_Global.ResultsFd, CFE_BENCH_RESULTS_FILE,
+                             OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_WRITE_ONLY);
+    if (OsStatus != OS_SUCCESS)
+    {
+        UtAssert_Failed("Unable to create %s: %ld", CFE_BENCH_RESULTS_FILE, (long)OsStatus);
+        CFE_Bench_Global.ResultsFd = OS_OBJECT_ID_UNDEFINED;
+    }
+
+    CFE_Bench_WriteResult("suite,name,size,width,iterations,total_usec,nsec_per_op\n");
+
+    /*
+     * Register benchmark cases in UtAssert
+     */
+    BenchESSetup();
+    BenchEVSSetup();
+    BenchOSALSetup();
+    BenchSBSetup();
+    BenchTBLSetup();
+    BenchTimeSetup();
+
+    /*
+     * Execute the benchmarks
+     *
+     * Note this also releases ownership of the UtAssert subsystem when complete
+     */
+    CFE_Assert_ExecuteTest();
+
+    if (OS_ObjectIdDefined(CFE_Bench_Global.ResultsFd))
+    {
+        OS_close(CFE_Bench_Global.ResultsFd);
+        CFE_Bench_Global.ResultsFd = OS_OBJECT_ID_UNDEFINED;
+    }
+
+    /* Nothing more for this app to do */
+    CFE_ES_ExitApp(CFE_ES_RunStatus_APP_EXIT);
+}
@@ -0,0 +1,92 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Declarations and prototypes for cfe_bench module
+ */
+
+#ifndef CFE_BENCH_H
+#define CFE_BENCH_H
+
+/*
+ * Includes
+ */
+#include "cfe.h"
+#include "cfe_bench_platform_cfg.h"
+
+#include "uttest.h"
+#include "utassert.h"
+#include "cfe_assert.h"
+
+typedef struct
+{
+    /* Results file, undefined if it could not be created */
+    osal_id_t ResultsFd;
+
+    /* Start of the measurement in progress */
+    OS_time_t StartTime;
+} CFE_Bench_Global_t;
+
+extern CFE_Bench_Global_t CFE_Bench_Global;
+
+/**
+ * Name of log file to write
+ *
+ * This file captures all of the assert output of the benchmark run.  The
+ * measurements themselves go to #CFE_BENCH_RESULTS_FILE.
+ */
+#define CFE_BENCH_LOG_FILE_NAME "/cf/cfe_bench.log"
+
+/**
+ * Scales the default iteration count down for operations that touch Size bytes
+ *
+ * Operations on up to 256 bytes run #CFE_BENCH_ITERATIONS times, larger
+ * ones proportionally fewer, but never fewer than 10.
+ */
+uint32 CFE_Bench_ScaleIterations(uint32 Iterations, uint32 Size);
+
+/**
+ * Marks the start of a measurement
+ */
+void CFE_Bench_Start(void);
+
+/**
+ * Marks the end of a measurement and records the result
+ *
+ * Writes one line to the results file and reports the per-operation
+ * time through UtAssert.
+ *
+ * \param Suite      Subsystem being measured, e.g. "SB"
+ * \param Name       Operation being measured
+ * \param Size       Bytes per operation, 0 if not applicable
+ * \param Width      Second parameter (subscribers, queue depth), 0 if not applicable
+ * \param Iterations Number of operations completed since CFE_Bench_Start()
+ */
+void CFE_Bench_Stop(const char *Suite, const char *Name, uint32 Size, uint32 Width, uint32 Iterations);
+
+void CFE_BenchMain(void);
+void BenchESSetup(void);
+void BenchEVSSetup(void);
+void BenchOSALSetup(void);
+void BenchSBSetup(void);
+void BenchTBLSetup(void);
+void BenchTimeSetup(void);
+
+#endif /* CFE_BENCH_H */
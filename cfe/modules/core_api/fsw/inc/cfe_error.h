@@ -1280,6 +1280,15 @@ char *CFE_ES_StatusToString(CFE_Status_t status, CFE_StatusString_t *status_stri
  */
 #define CFE_TBL_BAD_ARGUMENT ((CFE_Status_t)0xcc00002d)
 
+/**
+ * @brief Bad Encoding
+ *
+ *  Error code indicating that the table file header specifies a
+ *  data encoding that is not supported by this version of TBL services.
+ *
+ */
+#define CFE_TBL_ERR_BAD_ENCODING ((CFE_Status_t)0xcc00002e)
+
 /**
  * @brief Not Implemented
  *
@@ -796,7 +796,8 @@ int32 CFE_ES_GetModuleInfo(CFE_ES_AppInfo_t *ModuleInfo, CFE_ResourceId_t Resour
 **        This routine creates a new task (a separate execution thread) owned by the calling Application.
 **
 ** \par Assumptions, External Events, and Notes:
-**        None
+**        The new task inherits the CPU affinity of the Application's main task, as
+**        given in the startup script.  Use #CFE_ES_SetTaskAffinity to change it.
 **
 ** \param[out]   TaskIdPtr     A pointer to a variable that will be filled in with the new task's ID @nonnull.
 **TaskIdPtr is
@@ -825,7 +826,7 @@ int32 CFE_ES_GetModuleInfo(CFE_ES_AppInfo_t *ModuleInfo, CFE_ResourceId_t Resour
 ** \retval #CFE_ES_BAD_ARGUMENT              \copybrief CFE_ES_BAD_ARGUMENT
 ** \retval #CFE_ES_ERR_RESOURCEID_NOT_VALID  \copybrief CFE_ES_ERR_RESOURCEID_NOT_VALID
 **
-** \sa #CFE_ES_DeleteChildTask, #CFE_ES_ExitChildTask
+** \sa #CFE_ES_DeleteChildTask, #CFE_ES_ExitChildTask, #CFE_ES_SetTaskAffinity
 **
 ******************************************************************************/
 CFE_Status_t CFE_ES_CreateChildTask(CFE_ES_TaskId_t *TaskIdPtr, const char *TaskName,
@@ -911,6 +912,36 @@ CFE_Status_t CFE_ES_GetTaskName(char *TaskName, CFE_ES_TaskId_t TaskId, size_t B
 ******************************************************************************/
 CFE_Status_t CFE_ES_DeleteChildTask(CFE_ES_TaskId_t TaskId);
 
+/*****************************************************************************/
+/**
+** \brief Restricts a task to a set of CPUs
+**
+** \par Description
+**        This routine sets the CPUs on which the specified task may run.  Each bit
+**        in the mask corresponds to a CPU, with bit 0 being CPU 0.  The mask is kept
+**        in the task record, and child tasks created afterwards by a main task
+**        inherit the mask of that main task.
+**
+** \par Assumptions, External Events, and Notes:
+**        CPU affinity is not supported on all platforms.  Where it is not, this
+**        returns #CFE_ES_NOT_IMPLEMENTED and the task is left unchanged.
+**
+** \param[in]   TaskId     The task ID of the main task or child task to restrict
+**
+** \param[in]   CpuMask    The set of CPUs the task may run on @nonzero
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                       \copybrief CFE_SUCCESS
+** \retval #CFE_ES_BAD_ARGUMENT               \copybrief CFE_ES_BAD_ARGUMENT
+** \retval #CFE_ES_ERR_RESOURCEID_NOT_VALID   \copybrief CFE_ES_ERR_RESOURCEID_NOT_VALID
+** \retval #CFE_ES_NOT_IMPLEMENTED            \copybrief CFE_ES_NOT_IMPLEMENTED
+** \retval #CFE_STATUS_EXTERNAL_RESOURCE_FAIL \copybrief CFE_STATUS_EXTERNAL_RESOURCE_FAIL
+**
+** \sa #CFE_ES_CreateChildTask
+**
+******************************************************************************/
+CFE_Status_t CFE_ES_SetTaskAffinity(CFE_ES_TaskId_t TaskId, uint32 CpuMask);
+
 /*****************************************************************************/
 /**
 ** \brief Exits a child task
@@ -1152,6 +1183,46 @@ CFE_Status_t CFE_ES_GetCDSBlockName(char *BlockName, CFE_ES_CDSHandle_t BlockId,
 */
 CFE_Status_t CFE_ES_CopyToCDS(CFE_ES_CDSHandle_t Handle, const void *DataToCopy);
 
+/*****************************************************************************/
+/**
+** \brief Save modified portions of a block of data in the Critical Data Store (CDS)
+**
+** \par Description
+**        This routine updates a Critical Data Store block that had been previously registered
+**        via #CFE_ES_RegisterCDS, copying only the parts of the block that contain the given
+**        modified ranges.  The CDS maintains a separate CRC for each chunk of
+**        #CFE_PLATFORM_ES_CDS_CHUNK_SIZE bytes, so only the chunks that overlap a modified
+**        range are copied and re-checksummed.  This makes it practical to save large CDS
+**        blocks at a high rate when only a few fields change between saves.
+**
+** \par Assumptions, External Events, and Notes:
+**        \c DataToCopy refers to the complete image of the block, exactly as it would be
+**        passed to #CFE_ES_CopyToCDS, not to the modified bytes alone.  Any bytes outside
+**        of the given ranges must be unchanged since the last save, or the CDS will contain
+**        a mix of old and new data.
+**
+**        All ranges are applied as a single update.  If a reset interrupts the update,
+**        a subsequent #CFE_ES_RestoreFromCDS will report #CFE_ES_CDS_BLOCK_CRC_ERR.
+**
+** \param[in]   Handle       The handle of the CDS block that was previously obtained from #CFE_ES_RegisterCDS.
+**
+** \param[in]   DataToCopy   A Pointer to the complete image of the CDS block @nonnull.
+**
+** \param[in]   Ranges       Pointer to an array of modified ranges within the block @nonnull.
+**
+** \param[in]   NumRanges    Number of entries in the \c Ranges array @nonzero.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                       \copybrief CFE_SUCCESS
+** \retval #CFE_ES_ERR_RESOURCEID_NOT_VALID   \copybrief CFE_ES_ERR_RESOURCEID_NOT_VALID
+** \retval #CFE_ES_BAD_ARGUMENT               \copybrief CFE_ES_BAD_ARGUMENT
+**
+** \sa #CFE_ES_RegisterCDS, #CFE_ES_CopyToCDS, #CFE_ES_RestoreFromCDS
+**
+*/
+CFE_Status_t CFE_ES_CopyRangesToCDS(CFE_ES_CDSHandle_t Handle, const void *DataToCopy, const CFE_ES_CDSRange_t *Ranges,
+                                    uint32 NumRanges);
+
 /*****************************************************************************/
 /**
 ** \brief Recover a block of data from the Critical Data Store (CDS)
@@ -192,6 +192,18 @@ typedef void *CFE_ES_MemPoolBuf_t;
  */
 #define CFE_ES_MEMPOOLBUF_C(x) ((CFE_ES_MemPoolBuf_t)(x))
 
+/**
+ * \brief Modified byte range within a CDS block
+ *
+ * Describes a region of an application CDS image that has changed since
+ * it was last saved, for use with CFE_ES_CopyRangesToCDS().
+ */
+typedef struct CFE_ES_CDSRange
+{
+    size_t Offset; /**< \brief Offset of the first modified byte within the CDS block */
+    size_t Size;   /**< \brief Number of modified bytes starting at Offset */
+} CFE_ES_CDSRange_t;
+
 /** \name Conversions for ES resource IDs */
 /** \{ */
 
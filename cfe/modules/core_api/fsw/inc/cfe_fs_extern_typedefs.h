@@ -187,7 +187,18 @@ enum CFE_FS_SubType
      * command.
      *
      */
-    CFE_FS_SubType_ES_QUERYALLTASKS = 23
+    CFE_FS_SubType_ES_QUERYALLTASKS = 23,
+
+    /**
+     * @brief Executive Services State Snapshot File
+     *
+     * Executive Services State Snapshot File which is generated in response to a
+     * \link #CFE_ES_WRITE_SNAPSHOT_CC \ES_WRITESNAPSHOT \endlink
+     * command.  The file may be used to restore the reset area and CDS on a
+     * subsequent power-on start.
+     *
+     */
+    CFE_FS_SubType_ES_SNAPSHOT = 24
 };
 
 /**
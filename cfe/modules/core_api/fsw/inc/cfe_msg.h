@@ -723,6 +723,8 @@ CFE_Status_t CFE_MSG_GetTypeFromMsgId(CFE_SB_MsgId_t MsgId, CFE_MSG_Type_t *Type
  *          The BufferSize parameter indicates the allocation size message of the buffer that
  *          holds the message (i.e. the message envelope size).  In some implementations, the
  *          allocated buffer may include extra space in order to append a CRC or digital signature.
+ *          The default implementation appends the trailer of any integrity engine selected for
+ *          the message in cfe_msg_integrity_cfg.h, and rejects the message if it does not fit.
  *
  * \sa CFE_MSG_VerificationAction
  *
@@ -746,7 +748,8 @@ CFE_Status_t CFE_MSG_OriginationAction(CFE_MSG_Message_t *MsgPtr, size_t BufferS
  *
  *        The specific function of this API is entirely dependent on the header fields
  *        and may be a no-op if no error checking is implemented.  In that case, it
- *        will always output "true".
+ *        will always output "true".  The default implementation checks the trailer
+ *        of any integrity engine selected for the message in cfe_msg_integrity_cfg.h.
  *
  * \note  Due to the fact that software bus uses a multicast architecture, this function
  *        must not modify the message, as the buffer may be shared among multiple receivers.
@@ -768,4 +771,12 @@ CFE_Status_t CFE_MSG_VerificationAction(const CFE_MSG_Message_t *MsgPtr, size_t
 
 /**\}*/
 
+/*
+ * Missions with MISSION_MSG_INLINE_ACCESSORS get inline versions of the
+ * most frequently used accessors above, with the same semantics
+ */
+#ifdef CFE_MSG_INLINE_ACCESSORS
+#include "cfe_msg_inline.h"
+#endif
+
 #endif /* CFE_MSG_H */
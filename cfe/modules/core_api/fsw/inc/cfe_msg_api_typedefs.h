@@ -40,6 +40,14 @@
 #define CFE_MSG_NOT_IMPLEMENTED CFE_SB_NOT_IMPLEMENTED /**< \brief Error - not implemented */
 #define CFE_MSG_WRONG_MSG_TYPE  CFE_SB_WRONG_MSG_TYPE  /**< \brief Error - wrong type */
 
+/**
+ * \brief Largest trailer any integrity engine appends to a message
+ *
+ * Software bus reserves this much space beyond the requested size of every
+ * message buffer, so a trailer can be added at origination.
+ */
+#define CFE_MSG_INTEGRITY_MAX_TRAILER_SIZE 4
+
 /*
  * Types
  */
@@ -87,6 +95,13 @@ typedef enum CFE_MSG_PlaybackFlag
     CFE_MSG_PlayFlag_Playback  /**< \brief Playback */
 } CFE_MSG_PlaybackFlag_t;
 
+/** \brief Message integrity engine, selected per message id in cfe_msg_integrity_cfg.h */
+typedef enum CFE_MSG_IntegrityEngine
+{
+    CFE_MSG_IntegrityEngine_None,  /**< \brief No integrity trailer */
+    CFE_MSG_IntegrityEngine_Crc32c /**< \brief 4 byte CRC-32C (Castagnoli) trailer, big endian */
+} CFE_MSG_IntegrityEngine_t;
+
 /*
  * Abstract Message Base Types
  *
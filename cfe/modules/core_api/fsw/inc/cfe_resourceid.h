@@ -218,4 +218,53 @@ CFE_ResourceId_t CFE_ResourceId_FindNext(CFE_ResourceId_t StartId, uint32 TableS
  */
 int32 CFE_ResourceId_ToIndex(CFE_ResourceId_t Id, uint32 BaseValue, uint32 TableSize, uint32 *Idx);
 
+/**
+ * @brief Add a registry entry to a name index
+ *
+ * Must be called after the name has been stored in the registry entry, so
+ * that the match function used by lookups will see it.  The caller is
+ * responsible for ensuring the name is not already in use.
+ *
+ * @param[in]  Index     The name index descriptor
+ * @param[in]  Name      The name of the entry
+ * @param[in]  Idx       The registry table index of the entry
+ *
+ * @return Execution status, see @ref CFEReturnCodes
+ * @retval #CFE_SUCCESS                      @copybrief CFE_SUCCESS
+ * @retval #CFE_ES_BAD_ARGUMENT              @copybrief CFE_ES_BAD_ARGUMENT
+ * @retval #CFE_ES_NO_RESOURCE_IDS_AVAILABLE @copybrief CFE_ES_NO_RESOURCE_IDS_AVAILABLE
+ */
+int32 CFE_ResourceId_NameIndexAdd(const CFE_ResourceId_NameIndex_t *Index, const char *Name, uint32 Idx);
+
+/**
+ * @brief Remove a registry entry from a name index
+ *
+ * Must be called before the name in the registry entry is cleared or changed.
+ * To rename an entry, remove it using the old name and then add it again
+ * using the new name.  Removing an entry which is not in the index has no effect.
+ *
+ * @param[in]  Index     The name index descriptor
+ * @param[in]  Name      The name of the entry
+ * @param[in]  Idx       The registry table index of the entry
+ */
+void CFE_ResourceId_NameIndexRemove(const CFE_ResourceId_NameIndex_t *Index, const char *Name, uint32 Idx);
+
+/**
+ * @brief Look up a registry entry by name using a name index
+ *
+ * Only entries with a matching name hash are passed to the match function of
+ * the index, so the cost of a lookup does not depend on the number of entries
+ * in the registry.
+ *
+ * @param[in]  Index     The name index descriptor
+ * @param[in]  Name      The name to look up
+ * @param[out] Idx       The registry table index of the matching entry
+ *
+ * @return Execution status, see @ref CFEReturnCodes
+ * @retval #CFE_SUCCESS                @copybrief CFE_SUCCESS
+ * @retval #CFE_ES_BAD_ARGUMENT        @copybrief CFE_ES_BAD_ARGUMENT
+ * @retval #CFE_ES_ERR_NAME_NOT_FOUND  @copybrief CFE_ES_ERR_NAME_NOT_FOUND
+ */
+int32 CFE_ResourceId_NameIndexFind(const CFE_ResourceId_NameIndex_t *Index, const char *Name, uint32 *Idx);
+
 #endif /* CFE_RESOURCEID_H */
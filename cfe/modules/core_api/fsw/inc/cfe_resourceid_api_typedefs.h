@@ -75,4 +75,43 @@
 
 /** \} */
 
+/**
+ * @brief Name matching function for use with a name index
+ *
+ * Checks whether the registry table entry at the given index is in use
+ * and has the given name.
+ *
+ * @param[in]   Idx     the registry table index to check
+ * @param[in]   Name    the name to compare against
+ * @returns     true if the entry is in use and its name matches
+ */
+typedef bool (*CFE_ResourceId_NameMatchFunc_t)(uint32 Idx, const char *Name);
+
+/**
+ * @brief Describes a hashed name index over a registry table
+ *
+ * The index maps a hash of each entry name to the table index of that entry,
+ * using open addressing.  The bucket storage is owned by the registry and must
+ * hold NumBuckets entries, which should be #CFE_RESOURCEID_NAMEINDEX_BUCKETS
+ * of the table size.  Bucket storage that is all zero represents an empty
+ * index, so clearing the registry also clears the index.
+ *
+ * The descriptor itself does not change and is typically a constant object.
+ */
+typedef struct CFE_ResourceId_NameIndex
+{
+    uint32 *                       Buckets;    /**< Bucket storage, NumBuckets entries */
+    uint32                         NumBuckets; /**< Number of buckets */
+    uint32                         TableSize;  /**< Number of entries in the registry table */
+    CFE_ResourceId_NameMatchFunc_t MatchFunc;  /**< Checks the name of a registry entry */
+} CFE_ResourceId_NameIndex_t;
+
+/**
+ * @brief Number of name index buckets required for a table of the given size
+ *
+ * The index is kept at no more than half full, so that lookups for names that
+ * are not present terminate quickly.
+ */
+#define CFE_RESOURCEID_NAMEINDEX_BUCKETS(n) (2 * (n))
+
 #endif /* CFE_RESOURCEID_API_TYPEDEFS_H */
@@ -150,6 +150,14 @@ CFE_Status_t CFE_SB_PipeId_ToIndex(CFE_SB_PipeId_t PipeID, uint32 *Idx);
 **          This routine sets (or clears) options to alter the pipe's behavior.
 **          Options are (re)set every call to this routine.
 **
+**          With #CFE_SB_PIPEOPTS_LATEST_VALUE set, at most one message per MsgId
+**          is pending on the pipe.  A message published while an older one with
+**          the same MsgId is still queued replaces it, and the older buffer is
+**          released, so a slow reader always receives the newest sample and the
+**          memory held by the pipe does not grow.  This is intended for pipes
+**          subscribed to state telemetry only; it should not be used on pipes
+**          that receive commands.
+**
 ** \param[in]  PipeId       The pipe ID of the pipe to set options on.
 **
 ** \param[in]  Opts         A bit field of options: \ref CFESBPipeOptions
@@ -159,6 +167,7 @@ CFE_Status_t CFE_SB_PipeId_ToIndex(CFE_SB_PipeId_t PipeID, uint32 *Idx);
 ** \retval #CFE_SB_BAD_ARGUMENT \copybrief CFE_SB_BAD_ARGUMENT
 **
 ** \sa #CFE_SB_CreatePipe #CFE_SB_DeletePipe #CFE_SB_GetPipeOpts #CFE_SB_GetPipeIdByName #CFE_SB_PIPEOPTS_IGNOREMINE
+**     #CFE_SB_PIPEOPTS_LATEST_VALUE
 **/
 CFE_Status_t CFE_SB_SetPipeOpts(CFE_SB_PipeId_t PipeId, uint8 Opts);
 
@@ -250,7 +259,10 @@ CFE_Status_t CFE_SB_GetPipeIdByName(CFE_SB_PipeId_t *PipeIdPtr, const char *Pipe
 **
 ** \param[in]  Quality      The requested Quality of Service (QoS) required of
 **                          the messages. Most callers will use #CFE_SB_DEFAULT_QOS
-**                          for this parameter.
+**                          for this parameter.  Messages subscribed with a priority
+**                          of #CFE_SB_QosPriority_HIGH are placed in the priority
+**                          lane of the pipe and are received ahead of any messages
+**                          already waiting in its regular queue.
 **
 ** \param[in]  MsgLim       The maximum number of messages with this Message ID to
 **                          allow in this pipe at the same time.
@@ -437,6 +449,73 @@ CFE_Status_t CFE_SB_UnsubscribeLocal(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeI
 **/
 CFE_Status_t CFE_SB_TransmitMsg(const CFE_MSG_Message_t *MsgPtr, bool IsOrigination);
 
+/*****************************************************************************/
+/**
+** \brief Transmit a message, waiting for full subscribers to make room
+**
+** \par Description
+**          This routine is the same as #CFE_SB_TransmitMsg, except that a subscriber
+**          which is at its message limit, or whose pipe is full, is given up to the
+**          timeout to read a message before the new one is dropped for that subscriber.
+**          It is intended for non-critical producers that would rather slow down than
+**          lose data.
+**
+** \par Assumptions, External Events, and Notes:
+**          - The timeout covers the whole call, not each subscriber.  Subscribers with
+**            room receive the message first, before the call waits on any full ones.
+**          - Subscriptions to the priority lane (see #CFE_SB_SubscribeEx) never wait.
+**          - Pipes created by the calling app never wait either, since only the caller
+**            could make room in them.  When such a pipe is full the message is dropped
+**            for it as with #CFE_SB_POLL, rather than blocking the caller forever.
+**          - The calling task may be delayed in short steps while waiting, so this should
+**            not be used by tasks with hard timing requirements.
+**          - A return of #CFE_SB_TIME_OUT means one or more subscribers did not receive
+**            the message, and is also returned with #CFE_SB_POLL.  The message was still
+**            delivered to every other subscriber.  #CFE_SB_GetRouteCongestion can then be
+**            used to decide how much to reduce the rate.
+**
+** \param[in]  MsgPtr        A pointer to the message to be sent @nonnull.  This must point
+**                           to the first byte of the message header.
+** \param[in]  IsOrigination Update the headers of the message
+** \param[in]  TimeOut       The number of milliseconds to wait for full subscribers.  This can
+**                           also be set to #CFE_SB_POLL to not wait at all, or
+**                           #CFE_SB_PEND_FOREVER to wait until every subscriber has room.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_MSG_TOO_BIG  \copybrief CFE_SB_MSG_TOO_BIG
+** \retval #CFE_SB_TIME_OUT     \copybrief CFE_SB_TIME_OUT
+** \retval #CFE_SB_BUF_ALOC_ERR \covtest \copybrief CFE_SB_BUF_ALOC_ERR
+**/
+CFE_Status_t CFE_SB_TransmitMsgWithTimeout(const CFE_MSG_Message_t *MsgPtr, bool IsOrigination, int32 TimeOut);
+
+/*****************************************************************************/
+/**
+** \brief Get the congestion level of the route for a message ID
+**
+** \par Description
+**          This routine reports how close the subscribers of a message ID are to
+**          dropping messages.  For each active subscriber, the fill level is the
+**          larger of the number of messages queued against its message limit and
+**          the depth of its pipe against the pipe depth.  The highest fill level
+**          across all subscribers is returned, as a percentage.
+**
+** \par Assumptions, External Events, and Notes:
+**          - A message ID with no subscribers reports 0.
+**          - A publisher can call this before each transmit, or after a
+**            #CFE_SB_TransmitMsgWithTimeout returns #CFE_SB_TIME_OUT, to adapt its rate.
+**            No events are sent from this routine so it may be called at any rate.
+**
+** \param[in]  MsgId           The message ID of the route to check.
+** \param[out] FillPercentPtr  A pointer to the fill level, from 0 to 100 @nonnull.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT \copybrief CFE_SB_BAD_ARGUMENT
+**/
+CFE_Status_t CFE_SB_GetRouteCongestion(CFE_SB_MsgId_t MsgId, uint8 *FillPercentPtr);
+
 /*****************************************************************************/
 /**
 ** \brief Receive a message from a software bus pipe
@@ -444,7 +523,9 @@ CFE_Status_t CFE_SB_TransmitMsg(const CFE_MSG_Message_t *MsgPtr, bool IsOriginat
 ** \par Description
 **          This routine retrieves the next message from the specified pipe.
 **          If the pipe is empty, this routine will block until either a new
-**          message comes in or the timeout value is reached.
+**          message comes in or the timeout value is reached.  Messages in the
+**          priority lane of the pipe (see #CFE_SB_SubscribeEx) are returned
+**          before those in the regular queue.
 **
 ** \par Assumptions, External Events, and Notes:
 **          Note - If an error occurs in this API, the *BufPtr value may be NULL or
@@ -631,6 +631,81 @@ CFE_Status_t CFE_TBL_GetAddresses(void **TblPtrs[], uint16 NumTables, const CFE_
 **
 ******************************************************************************/
 CFE_Status_t CFE_TBL_ReleaseAddresses(uint16 NumTables, const CFE_TBL_Handle_t TblHandles[]);
+
+/*****************************************************************************/
+/**
+** \brief Obtain the address and version of a table without taking the registry lock
+**
+** \par Description
+**        This is a lightweight alternative to #CFE_TBL_GetAddress intended for
+**        tables that are read on every cycle.  The active buffer is published
+**        in a per-handle hazard slot rather than under the table registry mutex,
+**        so readers never block each other or a pending double-buffered update.
+**
+**        Along with the address, the current version of the table contents is
+**        returned.  The version advances every time new contents are activated,
+**        so an application may detect an update by comparing the value against
+**        the one it saw on its previous read instead of relying on
+**        #CFE_TBL_INFO_UPDATED.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# The address must be released with #CFE_TBL_ReadRelease before any
+**           blocking call, exactly as with #CFE_TBL_GetAddress.
+**        -# A double buffered table may be updated while a reader holds the
+**           previous buffer; the update only waits for readers before the
+**           inactive buffer is reused for the next load.
+**        -# A single buffered table cannot be updated while any reader holds it.
+**           If an update copy is in progress this call briefly takes the
+**           registry lock to wait for it to complete.
+**        -# A table that has never been loaded returns #CFE_TBL_ERR_NEVER_LOADED
+**           with a NULL address and a zero version.  Nothing is held in that
+**           case, so #CFE_TBL_ReadRelease need not be called.
+**
+** \param[out] TblPtr     Address of a pointer @nonnull that will be loaded with the address of the
+**                        first byte of the table. *TblPtr is the address of the first byte of data
+**                        associated with the specified table.
+**
+** \param[out] VersionPtr Address @nonnull that will be loaded with the version of the table contents.
+**
+** \param[in]  TblHandle  Handle of the table previously obtained from #CFE_TBL_Register or #CFE_TBL_Share.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                     \copybrief CFE_SUCCESS
+** \retval #CFE_TBL_ERR_NEVER_LOADED        \copybrief CFE_TBL_ERR_NEVER_LOADED
+** \retval #CFE_TBL_ERR_UNREGISTERED        \copybrief CFE_TBL_ERR_UNREGISTERED
+** \retval #CFE_TBL_ERR_INVALID_HANDLE      \copybrief CFE_TBL_ERR_INVALID_HANDLE
+** \retval #CFE_TBL_ERR_NO_ACCESS           \copybrief CFE_TBL_ERR_NO_ACCESS
+** \retval #CFE_ES_ERR_RESOURCEID_NOT_VALID \copybrief CFE_ES_ERR_RESOURCEID_NOT_VALID
+** \retval #CFE_TBL_BAD_ARGUMENT            \copybrief CFE_TBL_BAD_ARGUMENT
+**
+** \sa #CFE_TBL_ReadRelease, #CFE_TBL_GetAddress
+**
+******************************************************************************/
+CFE_Status_t CFE_TBL_ReadAcquire(void **TblPtr, uint32 *VersionPtr, CFE_TBL_Handle_t TblHandle);
+
+/*****************************************************************************/
+/**
+** \brief Release a table address obtained through #CFE_TBL_ReadAcquire
+**
+** \par Description
+**        Clears the hazard slot published by #CFE_TBL_ReadAcquire so that the
+**        buffer may be reused by subsequent table updates.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \param[in] TblHandle Handle of the table previously obtained from #CFE_TBL_Register or #CFE_TBL_Share.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                     \copybrief CFE_SUCCESS
+** \retval #CFE_TBL_ERR_INVALID_HANDLE      \copybrief CFE_TBL_ERR_INVALID_HANDLE
+** \retval #CFE_TBL_ERR_NO_ACCESS           \copybrief CFE_TBL_ERR_NO_ACCESS
+** \retval #CFE_ES_ERR_RESOURCEID_NOT_VALID \copybrief CFE_ES_ERR_RESOURCEID_NOT_VALID
+**
+** \sa #CFE_TBL_ReadAcquire
+**
+******************************************************************************/
+CFE_Status_t CFE_TBL_ReadRelease(CFE_TBL_Handle_t TblHandle);
 /**@}*/
 
 /** @defgroup CFEAPITBLInfo cFE Get Table Information APIs
@@ -62,6 +62,29 @@ enum CFE_TBL_BufferSelect
  */
 typedef uint16 CFE_TBL_BufferSelect_Enum_t;
 
+/**
+ * @brief Label definitions associated with CFE_TBL_FileEncoding_Enum_t
+ */
+enum CFE_TBL_FileEncoding
+{
+    /**
+     * @brief Table data follows the header verbatim
+     */
+    CFE_TBL_FileEncoding_RAW = 0,
+
+    /**
+     * @brief Table data is a single LZ4 block that expands to NumBytes bytes
+     */
+    CFE_TBL_FileEncoding_LZ4 = 1
+};
+
+/**
+ * @brief Identifies how the table data following the table file header is encoded
+ *
+ * @sa enum CFE_TBL_FileEncoding
+ */
+typedef uint32 CFE_TBL_FileEncoding_Enum_t;
+
 /**
  * @brief The definition of the header fields that are included in CFE Table Data files.
  *
@@ -69,7 +92,7 @@ typedef uint16 CFE_TBL_BufferSelect_Enum_t;
  */
 typedef struct CFE_TBL_File_Hdr
 {
-    uint32             Reserved;                                     /**< Future Use: NumTblSegments in File?   */
+    uint32             Encoding;                                     /**< Encoding of the table data */
     CFE_ES_MemOffset_t Offset;                                       /**< Byte Offset at which load should commence */
     CFE_ES_MemOffset_t NumBytes;                                     /**< Number of bytes to load into table */
     char               TableName[CFE_MISSION_TBL_MAX_FULL_NAME_LEN]; /**< Fully qualified name of table to load */
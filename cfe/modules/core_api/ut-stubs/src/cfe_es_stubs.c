@@ -92,6 +92,26 @@ uint32 CFE_ES_CalculateCRC(const void *DataPtr, size_t DataLength, uint32 InputC
     return UT_GenStub_GetReturnValue(CFE_ES_CalculateCRC, uint32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_CopyRangesToCDS()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_ES_CopyRangesToCDS(CFE_ES_CDSHandle_t Handle, const void *DataToCopy, const CFE_ES_CDSRange_t *Ranges,
+                                    uint32 NumRanges)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_ES_CopyRangesToCDS, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_ES_CopyRangesToCDS, CFE_ES_CDSHandle_t, Handle);
+    UT_GenStub_AddParam(CFE_ES_CopyRangesToCDS, const void *, DataToCopy);
+    UT_GenStub_AddParam(CFE_ES_CopyRangesToCDS, const CFE_ES_CDSRange_t *, Ranges);
+    UT_GenStub_AddParam(CFE_ES_CopyRangesToCDS, uint32, NumRanges);
+
+    UT_GenStub_Execute(CFE_ES_CopyRangesToCDS, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_ES_CopyRangesToCDS, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_ES_CopyToCDS()
@@ -889,6 +909,23 @@ CFE_Status_t CFE_ES_SetGenCount(CFE_ES_CounterId_t CounterId, uint32 Count)
     return UT_GenStub_GetReturnValue(CFE_ES_SetGenCount, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_SetTaskAffinity()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_ES_SetTaskAffinity(CFE_ES_TaskId_t TaskId, uint32 CpuMask)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_ES_SetTaskAffinity, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_ES_SetTaskAffinity, CFE_ES_TaskId_t, TaskId);
+    UT_GenStub_AddParam(CFE_ES_SetTaskAffinity, uint32, CpuMask);
+
+    UT_GenStub_Execute(CFE_ES_SetTaskAffinity, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_ES_SetTaskAffinity, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_ES_TaskID_ToIndex()
@@ -143,3 +143,43 @@ void UT_DefaultHandler_CFE_ResourceId_ToIndex(void *UserObj, UT_EntryKey_t FuncK
         }
     }
 }
+
+/*------------------------------------------------------------
+ *
+ * Default handler for CFE_ResourceId_NameIndexFind coverage stub function
+ *
+ *------------------------------------------------------------*/
+void UT_DefaultHandler_CFE_ResourceId_NameIndexFind(void *UserObj, UT_EntryKey_t FuncKey,
+                                                    const UT_StubContext_t *Context)
+{
+    const CFE_ResourceId_NameIndex_t *Index =
+        UT_Hook_GetArgValueByName(Context, "Index", const CFE_ResourceId_NameIndex_t *);
+    const char *Name = UT_Hook_GetArgValueByName(Context, "Name", const char *);
+    uint32 *    Idx  = UT_Hook_GetArgValueByName(Context, "Idx", uint32 *);
+    uint32      i;
+    int32       return_code;
+
+    /* If a return code value was set, return it directly */
+    if (UT_Stub_GetInt32StatusCode(Context, &return_code))
+    {
+        return;
+    }
+
+    /*
+     * Otherwise mimic the lookup with a simple search of the whole table,
+     * so that test cases may set up registry entries directly without
+     * also adding them to the index.
+     */
+    return_code = CFE_ES_ERR_NAME_NOT_FOUND;
+    for (i = 0; i < Index->TableSize; ++i)
+    {
+        if (Index->MatchFunc(i, Name))
+        {
+            *Idx        = i;
+            return_code = CFE_SUCCESS;
+            break;
+        }
+    }
+
+    UT_Stub_SetReturnValue(FuncKey, return_code);
+}
@@ -28,6 +28,7 @@
 void UT_DefaultHandler_CFE_ResourceId_FindNext(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CFE_ResourceId_GetBase(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CFE_ResourceId_GetSerial(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_CFE_ResourceId_NameIndexFind(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CFE_ResourceId_ToIndex(void *, UT_EntryKey_t, const UT_StubContext_t *);
 
 /*
@@ -80,6 +81,56 @@ uint32 CFE_ResourceId_GetSerial(CFE_ResourceId_t ResourceId)
     return UT_GenStub_GetReturnValue(CFE_ResourceId_GetSerial, uint32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ResourceId_NameIndexAdd()
+ * ----------------------------------------------------
+ */
+int32 CFE_ResourceId_NameIndexAdd(const CFE_ResourceId_NameIndex_t *Index, const char *Name, uint32 Idx)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_ResourceId_NameIndexAdd, int32);
+
+    UT_GenStub_AddParam(CFE_ResourceId_NameIndexAdd, const CFE_ResourceId_NameIndex_t *, Index);
+    UT_GenStub_AddParam(CFE_ResourceId_NameIndexAdd, const char *, Name);
+    UT_GenStub_AddParam(CFE_ResourceId_NameIndexAdd, uint32, Idx);
+
+    UT_GenStub_Execute(CFE_ResourceId_NameIndexAdd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_ResourceId_NameIndexAdd, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ResourceId_NameIndexFind()
+ * ----------------------------------------------------
+ */
+int32 CFE_ResourceId_NameIndexFind(const CFE_ResourceId_NameIndex_t *Index, const char *Name, uint32 *Idx)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_ResourceId_NameIndexFind, int32);
+
+    UT_GenStub_AddParam(CFE_ResourceId_NameIndexFind, const CFE_ResourceId_NameIndex_t *, Index);
+    UT_GenStub_AddParam(CFE_ResourceId_NameIndexFind, const char *, Name);
+    UT_GenStub_AddParam(CFE_ResourceId_NameIndexFind, uint32 *, Idx);
+
+    UT_GenStub_Execute(CFE_ResourceId_NameIndexFind, Basic, UT_DefaultHandler_CFE_ResourceId_NameIndexFind);
+
+    return UT_GenStub_GetReturnValue(CFE_ResourceId_NameIndexFind, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ResourceId_NameIndexRemove()
+ * ----------------------------------------------------
+ */
+void CFE_ResourceId_NameIndexRemove(const CFE_ResourceId_NameIndex_t *Index, const char *Name, uint32 Idx)
+{
+    UT_GenStub_AddParam(CFE_ResourceId_NameIndexRemove, const CFE_ResourceId_NameIndex_t *, Index);
+    UT_GenStub_AddParam(CFE_ResourceId_NameIndexRemove, const char *, Name);
+    UT_GenStub_AddParam(CFE_ResourceId_NameIndexRemove, uint32, Idx);
+
+    UT_GenStub_Execute(CFE_ResourceId_NameIndexRemove, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_ResourceId_ToIndex()
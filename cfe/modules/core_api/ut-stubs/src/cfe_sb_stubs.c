@@ -166,6 +166,23 @@ CFE_Status_t CFE_SB_GetPipeOpts(CFE_SB_PipeId_t PipeId, uint8 *OptsPtr)
     return UT_GenStub_GetReturnValue(CFE_SB_GetPipeOpts, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_GetRouteCongestion()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_GetRouteCongestion(CFE_SB_MsgId_t MsgId, uint8 *FillPercentPtr)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_GetRouteCongestion, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_GetRouteCongestion, CFE_SB_MsgId_t, MsgId);
+    UT_GenStub_AddParam(CFE_SB_GetRouteCongestion, uint8 *, FillPercentPtr);
+
+    UT_GenStub_Execute(CFE_SB_GetRouteCongestion, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_GetRouteCongestion, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_SB_GetUserData()
@@ -517,6 +534,24 @@ CFE_Status_t CFE_SB_TransmitMsg(const CFE_MSG_Message_t *MsgPtr, bool IsOriginat
     return UT_GenStub_GetReturnValue(CFE_SB_TransmitMsg, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_TransmitMsgWithTimeout()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_TransmitMsgWithTimeout(const CFE_MSG_Message_t *MsgPtr, bool IsOrigination, int32 TimeOut)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_TransmitMsgWithTimeout, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_TransmitMsgWithTimeout, const CFE_MSG_Message_t *, MsgPtr);
+    UT_GenStub_AddParam(CFE_SB_TransmitMsgWithTimeout, bool, IsOrigination);
+    UT_GenStub_AddParam(CFE_SB_TransmitMsgWithTimeout, int32, TimeOut);
+
+    UT_GenStub_Execute(CFE_SB_TransmitMsgWithTimeout, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_TransmitMsgWithTimeout, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_SB_Unsubscribe()
@@ -64,6 +64,26 @@ void UT_DefaultHandler_CFE_TBL_GetAddress(void *UserObj, UT_EntryKey_t FuncKey,
     }
 }
 
+/*------------------------------------------------------------
+ *
+ * Default handler for CFE_TBL_ReadAcquire coverage stub function
+ *
+ *------------------------------------------------------------*/
+void UT_DefaultHandler_CFE_TBL_ReadAcquire(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    void ** TblPtr     = UT_Hook_GetArgValueByName(Context, "TblPtr", void **);
+    uint32 *VersionPtr = UT_Hook_GetArgValueByName(Context, "VersionPtr", uint32 *);
+
+    int32 status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+    if (status >= 0)
+    {
+        UT_Stub_CopyToLocal(UT_KEY(CFE_TBL_ReadAcquire), (uint8 *)TblPtr, sizeof(void *));
+        *VersionPtr = 1;
+    }
+}
+
 /*------------------------------------------------------------
  *
  * Default handler for CFE_TBL_GetInfo coverage stub function
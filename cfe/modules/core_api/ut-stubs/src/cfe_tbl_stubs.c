@@ -27,6 +27,7 @@
 
 void UT_DefaultHandler_CFE_TBL_GetAddress(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CFE_TBL_GetInfo(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_CFE_TBL_ReadAcquire(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CFE_TBL_Register(void *, UT_EntryKey_t, const UT_StubContext_t *);
 
 /*
@@ -181,6 +182,40 @@ CFE_Status_t CFE_TBL_NotifyByMessage(CFE_TBL_Handle_t TblHandle, CFE_SB_MsgId_t
     return UT_GenStub_GetReturnValue(CFE_TBL_NotifyByMessage, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_TBL_ReadAcquire()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_TBL_ReadAcquire(void **TblPtr, uint32 *VersionPtr, CFE_TBL_Handle_t TblHandle)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_TBL_ReadAcquire, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_TBL_ReadAcquire, void **, TblPtr);
+    UT_GenStub_AddParam(CFE_TBL_ReadAcquire, uint32 *, VersionPtr);
+    UT_GenStub_AddParam(CFE_TBL_ReadAcquire, CFE_TBL_Handle_t, TblHandle);
+
+    UT_GenStub_Execute(CFE_TBL_ReadAcquire, Basic, UT_DefaultHandler_CFE_TBL_ReadAcquire);
+
+    return UT_GenStub_GetReturnValue(CFE_TBL_ReadAcquire, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_TBL_ReadRelease()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_TBL_ReadRelease(CFE_TBL_Handle_t TblHandle)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_TBL_ReadRelease, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_TBL_ReadRelease, CFE_TBL_Handle_t, TblHandle);
+
+    UT_GenStub_Execute(CFE_TBL_ReadRelease, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_TBL_ReadRelease, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_TBL_Register()
@@ -34,7 +34,21 @@
 #define CFE_ES_CORE_INTERNAL_H
 
 #include "common_types.h"
+#include "osconfig.h"
 #include "cfe_es_extern_typedefs.h"
+#include "cfe_tbl_api_typedefs.h"
+
+/**
+ * @brief Header of one table image in the tables section of a state snapshot
+ *
+ * Each header is immediately followed by Size bytes of table data.
+ */
+typedef struct CFE_ES_SnapshotTableHeader
+{
+    char   Name[CFE_TBL_MAX_FULL_NAME_LEN]; /**< Full name of the table, "AppName.TableName" */
+    char   LastFileLoaded[OS_MAX_PATH_LEN]; /**< Source of the table contents when the snapshot was taken */
+    uint32 Size;                            /**< Size of the table data in bytes */
+} CFE_ES_SnapshotTableHeader_t;
 
 /*
  * The internal APIs prototyped within this block are only intended to be invoked from
@@ -135,6 +149,29 @@ int32 CFE_ES_RegisterCDSEx(CFE_ES_CDSHandle_t *HandlePtr, size_t UserBlockSize,
 ******************************************************************************/
 int32 CFE_ES_DeleteCDS(const char *CDSName, bool CalledByTblServices);
 
+/*****************************************************************************/
+/**
+** \brief Copies the contents of a table from a restored state snapshot
+**
+** \par Description
+**        Looks up a table image with the given name and size in the state snapshot
+**        restored during this start, and copies its data into the table buffer.
+**        Called by Table Services when a table is registered.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# Table images are only available until the system reaches the
+**           OPERATIONAL state, at which point the restored snapshot is consumed.
+**
+** \param[in, out] HeaderPtr  On input, the Name and Size of the table.  On success,
+**                            LastFileLoaded is filled in from the snapshot.
+** \param[out]     DataPtr    Table buffer of HeaderPtr->Size bytes to fill
+**
+** \return #CFE_SUCCESS                     \copydoc CFE_SUCCESS
+** \return #CFE_ES_ERR_NAME_NOT_FOUND       \copydoc CFE_ES_ERR_NAME_NOT_FOUND
+** \return #CFE_ES_FILE_IO_ERR              \copydoc CFE_ES_FILE_IO_ERR
+******************************************************************************/
+int32 CFE_ES_RestoreSnapshotTable(CFE_ES_SnapshotTableHeader_t *HeaderPtr, void *DataPtr);
+
 /**@}*/
 
 #endif /* CFE_ES_CORE_INTERNAL_H */
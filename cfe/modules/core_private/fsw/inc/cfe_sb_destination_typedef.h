@@ -44,9 +44,11 @@ typedef struct CFE_SB_DestinationD
     uint16                      BuffCount;
     uint16                      DestCnt;
     uint8                       Scope;
-    uint8                       Spare[3];
+    uint8                       Priority; /* CFE_SB_QosPriority_HIGH selects the priority lane of the pipe */
+    uint8                       Spare[2];
     struct CFE_SB_DestinationD *Prev;
     struct CFE_SB_DestinationD *Next;
+    struct CFE_SB_BufferD *     LatestBuffer; /* newer message replacing the queued one, latest-value pipes only */
 } CFE_SB_DestinationD_t;
 
 #endif /* CFE_SB_DESTINATION_TYPEDEF_H */
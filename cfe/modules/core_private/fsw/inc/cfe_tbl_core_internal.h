@@ -38,6 +38,7 @@
 
 #include "common_types.h"
 #include "cfe_es_extern_typedefs.h"
+#include "cfe_es_core_internal.h"
 
 /*
  * The internal APIs prototyped within this block are only intended to be invoked from
@@ -93,6 +94,31 @@ int32 CFE_TBL_EarlyInit(void);
 ******************************************************************************/
 int32 CFE_TBL_CleanUpApp(CFE_ES_AppId_t AppId);
 
+/*****************************************************************************/
+/**
+** \brief Gets the contents of one table for a state snapshot
+**
+** \par Description
+**        This function is called by cFE Executive Services for each Table Registry
+**        entry in turn while writing a state snapshot.  If the entry holds a loaded
+**        table, its name, size and source are returned along with its active buffer.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# Critical tables are not returned, as their contents are saved in the CDS.
+**        -# User defined address tables are not returned, as their contents belong
+**           to the owning application.
+**        -# The returned buffer is only read after the registry is unlocked, which relies
+**           on the owning application being held in #CFE_ES_RunLoop while the snapshot is written.
+**
+** \param[in]  RecordNum  Table Registry entry, starting from zero
+** \param[out] HeaderPtr  Filled with the table description when DataPtr is set
+** \param[out] DataPtr    Set to the active buffer of the table, or NULL if there is none
+**
+** \return true if RecordNum is the last Table Registry entry, false otherwise
+**
+******************************************************************************/
+bool CFE_TBL_SnapshotTableGetter(uint32 RecordNum, CFE_ES_SnapshotTableHeader_t *HeaderPtr, const void **DataPtr);
+
 /**@}*/
 
 #endif /* CFE_TBL_CORE_INTERNAL_H */
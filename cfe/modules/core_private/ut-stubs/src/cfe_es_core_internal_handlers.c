@@ -32,6 +32,7 @@
 */
 #include <string.h>
 #include "cfe_es_core_internal.h"
+#include "cfe_error.h"
 #include "cfe_resourceid.h"
 #include "cfe_resourceid_basevalue.h"
 
@@ -71,3 +72,29 @@ void UT_DefaultHandler_CFE_ES_RegisterCDSEx(void *UserObj, UT_EntryKey_t FuncKey
         }
     }
 }
+
+/*------------------------------------------------------------
+ *
+ * Default handler for CFE_ES_RestoreSnapshotTable coverage stub function
+ *
+ *------------------------------------------------------------*/
+void UT_DefaultHandler_CFE_ES_RestoreSnapshotTable(void *UserObj, UT_EntryKey_t FuncKey,
+                                                   const UT_StubContext_t *Context)
+{
+    CFE_ES_SnapshotTableHeader_t *HeaderPtr =
+        UT_Hook_GetArgValueByName(Context, "HeaderPtr", CFE_ES_SnapshotTableHeader_t *);
+    void *DataPtr = UT_Hook_GetArgValueByName(Context, "DataPtr", void *);
+    int32 status;
+
+    /* Unless set otherwise, no snapshot was restored */
+    if (!UT_Stub_GetInt32StatusCode(Context, &status))
+    {
+        status = CFE_ES_ERR_NAME_NOT_FOUND;
+    }
+    else if (status >= 0)
+    {
+        UT_Stub_CopyToLocal(FuncKey, DataPtr, HeaderPtr->Size);
+    }
+
+    UT_Stub_SetReturnValue(FuncKey, status);
+}
@@ -26,6 +26,7 @@
 #include "utgenstub.h"
 
 void UT_DefaultHandler_CFE_ES_RegisterCDSEx(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_CFE_ES_RestoreSnapshotTable(void *, UT_EntryKey_t, const UT_StubContext_t *);
 
 /*
  * ----------------------------------------------------
@@ -77,6 +78,23 @@ int32 CFE_ES_RegisterCDSEx(CFE_ES_CDSHandle_t *HandlePtr, size_t UserBlockSize,
     return UT_GenStub_GetReturnValue(CFE_ES_RegisterCDSEx, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_RestoreSnapshotTable()
+ * ----------------------------------------------------
+ */
+int32 CFE_ES_RestoreSnapshotTable(CFE_ES_SnapshotTableHeader_t *HeaderPtr, void *DataPtr)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_ES_RestoreSnapshotTable, int32);
+
+    UT_GenStub_AddParam(CFE_ES_RestoreSnapshotTable, CFE_ES_SnapshotTableHeader_t *, HeaderPtr);
+    UT_GenStub_AddParam(CFE_ES_RestoreSnapshotTable, void *, DataPtr);
+
+    UT_GenStub_Execute(CFE_ES_RestoreSnapshotTable, Basic, UT_DefaultHandler_CFE_ES_RestoreSnapshotTable);
+
+    return UT_GenStub_GetReturnValue(CFE_ES_RestoreSnapshotTable, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_ES_TaskMain()
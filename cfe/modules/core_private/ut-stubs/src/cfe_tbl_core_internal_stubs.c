@@ -25,6 +25,8 @@
 #include "cfe_tbl_core_internal.h"
 #include "utgenstub.h"
 
+void UT_DefaultHandler_CFE_TBL_SnapshotTableGetter(void *, UT_EntryKey_t, const UT_StubContext_t *);
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_TBL_CleanUpApp()
@@ -55,6 +57,24 @@ int32 CFE_TBL_EarlyInit(void)
     return UT_GenStub_GetReturnValue(CFE_TBL_EarlyInit, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_TBL_SnapshotTableGetter()
+ * ----------------------------------------------------
+ */
+bool CFE_TBL_SnapshotTableGetter(uint32 RecordNum, CFE_ES_SnapshotTableHeader_t *HeaderPtr, const void **DataPtr)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_TBL_SnapshotTableGetter, bool);
+
+    UT_GenStub_AddParam(CFE_TBL_SnapshotTableGetter, uint32, RecordNum);
+    UT_GenStub_AddParam(CFE_TBL_SnapshotTableGetter, CFE_ES_SnapshotTableHeader_t *, HeaderPtr);
+    UT_GenStub_AddParam(CFE_TBL_SnapshotTableGetter, const void **, DataPtr);
+
+    UT_GenStub_Execute(CFE_TBL_SnapshotTableGetter, Basic, UT_DefaultHandler_CFE_TBL_SnapshotTableGetter);
+
+    return UT_GenStub_GetReturnValue(CFE_TBL_SnapshotTableGetter, bool);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_TBL_TaskMain()
@@ -483,6 +483,12 @@ typedef struct CFE_ES_AppInfo
                                                         \brief The Application's Main Task ID */
     uint32 NumOfChildTasks;                        /**< \cfetlmmnemonic \ES_CHILDTASKS
                                                         \brief Number of Child tasks for an App */
+    uint32 CpuUtilization;                         /**< \cfetlmmnemonic \ES_CPUUTIL
+                                                        \brief CPU utilization of all the App's tasks over the last
+                                                        sample period, in hundredths of a percent of one CPU */
+    uint32 MaxRunLoopTime;                         /**< \cfetlmmnemonic \ES_MAXLOOPTIME
+                                                        \brief Longest wall time between two calls to #CFE_ES_RunLoop
+                                                        by the main task in the last sample period, in microseconds */
 } CFE_ES_AppInfo_t;
 
 /**
@@ -587,6 +587,12 @@
 **  \par Description
 **       This command causes the Performance Analyzer to begin collecting data using the specified trigger mode.
 **
+**       In the #CFE_ES_PerfTrigger_STREAM mode, collection continues until stopped and
+**       the ES background task continuously writes the entries to a rotating set of
+**       files named after #CFE_PLATFORM_ES_PERF_STREAM_FILE_PREFIX, in addition to the
+**       usual circular buffer.  The files use the same format as the file written by
+**       #CFE_ES_STOP_PERF_DATA_CC.
+**
 **  \cfecmdmnemonic \ES_STARTLADATA
 **
 **  \par Command Structure
@@ -601,7 +607,7 @@
 **         either WAITING FOR TRIGGER or, if conditions are appropriate fast enough,
 **         TRIGGERED.
 **       - \b \c \ES_PERFMODE - Performance Analyzer Mode will change to the commanded trigger mode (TRIGGER START,
-**         TRIGGER CENTER, or TRIGGER END).
+**         TRIGGER CENTER, TRIGGER END, or STREAM).
 **       - \b \c \ES_PERFTRIGCNT - Performance Trigger Count will go to zero
 **       - \b \c \ES_PERFDATASTART - Data Start Index will go to zero
 **       - \b \c \ES_PERFDATAEND - Data End Index will go to zero
@@ -612,6 +618,7 @@
 **  \par Error Conditions
 **       This command may fail for the following reason(s):
 **       - A previous #CFE_ES_STOP_PERF_DATA_CC command has not completely finished.
+**       - The files of a previous streaming collection are still being flushed.
 **       - An invalid trigger mode is requested.
 **
 **       Evidence of failure may be found in the following telemetry:
@@ -1031,6 +1038,56 @@
 */
 #define CFE_ES_QUERY_ALL_TASKS_CC 24
 
+/** \cfeescmd Writes a Snapshot of Flight Software State to a File
+**
+**  \par Description
+**       This command requests that all external applications be parked at
+**       their next #CFE_ES_RunLoop boundary, after which the contents of the
+**       reset area, the Critical Data Store (which includes the CDS registry,
+**       all registered application CDS blocks and the images of critical tables)
+**       and the active buffers of all other loaded tables are written to the
+**       specified file.  Each section of the file is page aligned so the file may
+**       be memory mapped.  An existing file is replaced as a whole, so an interrupted
+**       write never loses the previous snapshot.  If the file named by
+**       #CFE_PLATFORM_ES_SNAPSHOT_RESTORE_FILE exists on a subsequent power-on
+**       start, its contents are restored, the start is treated as a processor
+**       reset, and tables registered during startup recover their saved contents.
+**       The file is removed once startup is complete, so it is restored only once.
+**
+**  \cfecmdmnemonic \ES_WRITESNAPSHOT
+**
+**  \par Command Structure
+**       #CFE_ES_WriteSnapshotCmd_t
+**
+**  \par Command Verification
+**       Successful execution of this command may be verified with
+**       the following telemetry:
+**       - \b \c \ES_CMDPC - command execution counter will
+**         increment
+**       - The #CFE_ES_SNAPSHOT_INF_EID informational event message will be
+**         generated when the snapshot file has been written.
+**
+**  \par Error Conditions
+**       This command may fail for the following reason(s):
+**       - A previous request to write a snapshot has not yet completed
+**       - The specified FileName cannot be parsed
+**       - An Error occurs while trying to write to the file
+**
+**       Evidence of failure may be found in the following telemetry:
+**       - \b \c \ES_CMDEC - command error counter will increment
+**       - A command specific error event message is issued for all error
+**         cases
+**
+**  \par Criticality
+**       This command briefly suspends all external applications at their
+**       run loop boundary (bounded by #CFE_PLATFORM_ES_SNAPSHOT_QUIESCE_TIMEOUT_MSEC)
+**       and creates a file whose size is on the order of the reset area plus the
+**       CDS.  Care should be taken when issuing it during time critical activities.
+**
+**  \sa #CFE_ES_DUMP_CDS_REGISTRY_CC, #CFE_ES_WRITE_ER_LOG_CC
+*/
+#define CFE_ES_WRITE_SNAPSHOT_CC 25
+
 /** \} */
 
 #endif
@@ -634,6 +634,58 @@
 */
 #define CFE_PLATFORM_ES_PERF_ENTRIES_BTWN_DLYS 50
 
+/**
+**  \cfeescfg Performance Log Streaming File Name Prefix
+**
+**  \par Description:
+**       When performance data is collected in the #CFE_ES_PerfTrigger_STREAM
+**       mode, entries are written continuously to a rotating set of files.
+**       Each file is named by appending "_<index>.dat" to this prefix.
+**
+**  \par Limits
+**       The length of the complete file names, including the NULL terminator,
+**       cannot exceed the #OS_MAX_PATH_LEN value.
+*/
+#define CFE_PLATFORM_ES_PERF_STREAM_FILE_PREFIX "/ram/cfe_es_perfstream"
+
+/**
+**  \cfeescfg Performance Log Streaming File Count
+**
+**  \par Description:
+**       Number of files in the rotating set used by the streaming mode.  Once
+**       the last file is full, the first one is overwritten.
+**
+**  \par Limits
+**       Must be greater than zero.
+*/
+#define CFE_PLATFORM_ES_PERF_STREAM_MAX_FILES 4
+
+/**
+**  \cfeescfg Performance Log Streaming Entries Per File
+**
+**  \par Description:
+**       Number of performance log entries written to each streaming file before
+**       moving on to the next file of the set.
+**
+**  \par Limits
+**       Must be greater than zero.
+*/
+#define CFE_PLATFORM_ES_PERF_STREAM_FILE_ENTRIES 100000
+
+/**
+**  \cfeescfg Performance Log Streaming Buffer Size
+**
+**  \par Description:
+**       Number of entries in each of the two buffers used by the streaming mode.
+**       Producers fill one buffer while the ES background task writes the other
+**       to the file, so producers never wait for file I/O.  Entries logged while
+**       both buffers are full are dropped and counted.
+**
+**  \par Limits
+**       Must be greater than zero.
+*/
+#define CFE_PLATFORM_ES_PERF_STREAM_BUFFER_SIZE 1024
+
 /**
 **  \cfeescfg Define Default Stack Size for an Application
 **
@@ -773,6 +825,27 @@
 #define CFE_PLATFORM_ES_CDS_MEM_BLOCK_SIZE_16 32768
 #define CFE_PLATFORM_ES_CDS_MAX_BLOCK_SIZE    80000
 
+/**
+**  \cfeescfg Define ES Critical Data Store CRC Chunk Size
+**
+**  \par Description:
+**       The user data in each CDS block is protected by one CRC per chunk of
+**       this many bytes.  Partial updates of a CDS block (see CFE_ES_CopyRangesToCDS)
+**       only copy and re-checksum the chunks that contain modified bytes, so a
+**       smaller value reduces the cost of small updates at the expense of
+**       4 bytes of CDS storage per chunk.
+**
+**       The CRC table is stored in the same CDS block as the user data.  The
+**       largest pool block is enlarged by the CRC table of a
+**       #CFE_PLATFORM_ES_CDS_MAX_BLOCK_SIZE block, so the largest CDS an
+**       application can register is not reduced, but #CFE_PLATFORM_ES_CDS_SIZE
+**       must leave room for the tables of all registered blocks.
+**
+**  \par Limits
+**       Must be an integral multiple of 4 and at least 16.
+*/
+#define CFE_PLATFORM_ES_CDS_CHUNK_SIZE 256
+
 /** \cfeescfg Poll timer for startup sync delay
 **
 **  \par Description:
@@ -813,4 +886,89 @@
 */
 #define CFE_PLATFORM_ES_STARTUP_SCRIPT_TIMEOUT_MSEC 1000
 
+/** \cfeescfg Startup module loader workers
+**
+**  \par Description:
+**      Number of worker tasks used to load the modules listed in the CFE ES startup
+**      script concurrently.  Modules are still started (library init functions called
+**      and app main tasks created) one at a time in the order they appear in the script.
+**
+**      An optional 9th field in each startup script entry lists the names of earlier
+**      entries, separated by ':', whose modules must be loaded before this one, or
+**      NONE.  Entries without this field wait for all earlier libraries.
+**
+**      Set to 0 to load and start each module in turn as the script is read.
+**
+**  \par Limits:
+**       Must be defined as an integer value that is greater than
+**       or equal to zero.
+*/
+#define CFE_PLATFORM_ES_STARTUP_LOAD_WORKERS 0
+
+/**
+**  \cfeescfg Default State Snapshot Filename
+**
+**  \par Description:
+**       The value of this constant defines the filename used to store the
+**       reset area, Critical Data Store and table snapshot.  This filename is used
+**       only when no filename is specified in the Write Snapshot command.
+**
+**  \par Limits
+**       The length of each string, including the NULL terminator cannot exceed the
+**       #OS_MAX_PATH_LEN value.
+*/
+#define CFE_PLATFORM_ES_DEFAULT_SNAPSHOT_FILE "/ram/cfe_es_snapshot.snap"
+
+/**
+**  \cfeescfg State Snapshot Restore Filename
+**
+**  \par Description:
+**       If a file with this name exists when the cFE starts from a power-on reset,
+**       its reset area and Critical Data Store contents are restored and the start is
+**       treated as a processor reset.  Tables registered during startup take their
+**       contents from the file.  The file is removed once startup is complete, so it
+**       is only restored once.
+**       The file system containing it must be available before #CFE_ES_Main is called.
+**       Set to an empty string to disable the restore check.
+**
+**  \par Limits
+**       The length of each string, including the NULL terminator cannot exceed the
+**       #OS_MAX_PATH_LEN value.
+*/
+#define CFE_PLATFORM_ES_SNAPSHOT_RESTORE_FILE "/cf/cfe_es_restore.snap"
+
+/**
+**  \cfeescfg State Snapshot Quiesce Timeout
+**
+**  \par Description:
+**       Maximum time to wait for running external applications to reach their
+**       #CFE_ES_RunLoop boundary before a requested snapshot is written anyway.
+**
+**      Units are in milliseconds
+**
+**  \par Limits:
+**       Must be defined as an integer value that is greater than
+**       or equal to zero.
+*/
+#define CFE_PLATFORM_ES_SNAPSHOT_QUIESCE_TIMEOUT_MSEC 1000
+
+/**
+**  \cfeescfg Application Resource Usage Sample Period
+**
+**  \par Description:
+**       Number of housekeeping requests (#CFE_ES_SEND_HK_MID) between two
+**       samples of the per-application CPU usage.  At the end of each sample
+**       period ES reads the CPU time of every task, charges it to the task's
+**       application, and sends every application's CPU utilization and
+**       longest #CFE_ES_RunLoop iteration wall time in the
+**       #CFE_ES_APP_RESOURCE_TLM_MID packet.
+**
+**       Setting this to zero disables the sampling and the packet.
+**
+**  \par Limits:
+**       Must be defined as an integer value that is greater than
+**       or equal to zero.
+*/
+#define CFE_PLATFORM_ES_APP_RESOURCE_HK_CYCLES 1
+
 #endif
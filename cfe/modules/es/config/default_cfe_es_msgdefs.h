@@ -151,7 +151,13 @@ enum CFE_ES_PerfMode
 {
     CFE_ES_PerfTrigger_START = 0,
     CFE_ES_PerfTrigger_CENTER,
-    CFE_ES_PerfTrigger_END
+    CFE_ES_PerfTrigger_END,
+
+    /**
+     * Collect until stopped, continuously writing the entries to a rotating
+     * set of files (see #CFE_PLATFORM_ES_PERF_STREAM_FILE_PREFIX)
+     */
+    CFE_ES_PerfTrigger_STREAM
 };
 
 typedef uint32 CFE_ES_PerfMode_Enum_t;
@@ -255,6 +261,36 @@ typedef struct CFE_ES_PoolStatsTlm_Payload
     CFE_ES_MemPoolStats_t PoolStats; /**< \brief For more info, see #CFE_ES_MemPoolStats_t */
 } CFE_ES_PoolStatsTlm_Payload_t;
 
+/**
+**  \brief Resource usage of a single application
+**
+**  Entry in the #CFE_ES_AppResourceTlm_Payload_t packet
+**/
+typedef struct CFE_ES_AppResourceEntry
+{
+    CFE_ES_AppId_t AppId;  /**< \cfetlmmnemonic \ES_RES_APPID
+                                \brief Application ID, #CFE_ES_APPID_UNDEFINED if the entry is unused */
+    uint32 CpuUtilization; /**< \cfetlmmnemonic \ES_RES_CPUUTIL
+                                \brief CPU utilization of all tasks, in hundredths of a percent of one CPU */
+    uint32 MaxRunLoopTime; /**< \cfetlmmnemonic \ES_RES_MAXLOOPTIME
+                                \brief Longest wall time of one #CFE_ES_RunLoop iteration, in microseconds */
+    uint32 RunLoopCount;   /**< \cfetlmmnemonic \ES_RES_LOOPCOUNT
+                                \brief Number of #CFE_ES_RunLoop iterations in the sample period */
+} CFE_ES_AppResourceEntry_t;
+
+/**
+**  \cfeestlm Application Resource Usage Packet
+**/
+typedef struct CFE_ES_AppResourceTlm_Payload
+{
+    uint32 SamplePeriodMsec; /**< \cfetlmmnemonic \ES_RES_PERIOD
+                                  \brief Length of the sample period the entries cover, in milliseconds */
+    uint32 NumApps;          /**< \cfetlmmnemonic \ES_RES_NUMAPPS
+                                  \brief Number of valid entries in the Apps array */
+
+    CFE_ES_AppResourceEntry_t Apps[CFE_MISSION_ES_MAX_APPLICATIONS]; /**< \brief Per-application usage */
+} CFE_ES_AppResourceTlm_Payload_t;
+
 /*************************************************************************/
 
 /**
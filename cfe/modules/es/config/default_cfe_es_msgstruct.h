@@ -127,6 +127,12 @@ typedef struct CFE_ES_WriteERLogCmd
     CFE_ES_FileNameCmd_Payload_t Payload;       /**< \brief Command payload */
 } CFE_ES_WriteERLogCmd_t;
 
+typedef struct CFE_ES_WriteSnapshotCmd
+{
+    CFE_MSG_CommandHeader_t      CommandHeader; /**< \brief Command header */
+    CFE_ES_FileNameCmd_Payload_t Payload;       /**< \brief Command payload */
+} CFE_ES_WriteSnapshotCmd_t;
+
 /**
  * \brief Overwrite/Discard System Log Configuration Command Payload
  */
@@ -273,6 +279,15 @@ typedef struct CFE_ES_MemStatsTlm
     CFE_ES_PoolStatsTlm_Payload_t Payload;         /**< \brief Telemetry payload */
 } CFE_ES_MemStatsTlm_t;
 
+/**
+**  \cfeestlm Application Resource Usage Packet
+**/
+typedef struct CFE_ES_AppResourceTlm
+{
+    CFE_MSG_TelemetryHeader_t       TelemetryHeader; /**< \brief Telemetry header */
+    CFE_ES_AppResourceTlm_Payload_t Payload;         /**< \brief Telemetry payload */
+} CFE_ES_AppResourceTlm_t;
+
 /**
 **  \cfeestlm Executive Services Housekeeping Packet
 **/
@@ -44,8 +44,9 @@
 **  \par Limits
 **      Not Applicable
 */
-#define CFE_MISSION_ES_HK_TLM_TOPICID       0
-#define CFE_MISSION_ES_APP_TLM_TOPICID      11
-#define CFE_MISSION_ES_MEMSTATS_TLM_TOPICID 16
+#define CFE_MISSION_ES_HK_TLM_TOPICID           0
+#define CFE_MISSION_ES_APP_TLM_TOPICID          11
+#define CFE_MISSION_ES_MEMSTATS_TLM_TOPICID     16
+#define CFE_MISSION_ES_APP_RESOURCE_TLM_TOPICID 17
 
 #endif
@@ -1057,6 +1057,70 @@
  *  a write already being in progress.
  */
 #define CFE_ES_ERLOG_PENDING_ERR_EID 93
+
+/**
+ * \brief ES Write Snapshot Command Success Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_WRITE_SNAPSHOT_CC ES Write Snapshot Command \endlink success.  The
+ *  reset area and CDS have been written to the snapshot file.  The event reports the
+ *  number of applications that were parked at their run loop boundary while the
+ *  snapshot was taken, out of the number of running external applications.
+ */
+#define CFE_ES_SNAPSHOT_INF_EID 94
+
+/**
+ * \brief ES Write Snapshot Command Request Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_WRITE_SNAPSHOT_CC ES Write Snapshot Command \endlink failure because a
+ *  snapshot is already in progress or the file name could not be parsed.
+ */
+#define CFE_ES_SNAPSHOT_ERR_EID 95
+
+/**
+ * \brief ES Write Snapshot File Error Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_WRITE_SNAPSHOT_CC ES Write Snapshot Command \endlink failure while
+ *  creating or writing the snapshot file.
+ */
+#define CFE_ES_SNAPSHOT_WR_ERR_EID 96
+
+/**
+ * \brief Performance Log Streaming Complete Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  Performance data collection in the streaming mode was stopped and the remaining
+ *  entries have been written.  The event reports the number of entries written,
+ *  the number of files used and the number of entries dropped because the
+ *  background task could not keep up.
+ */
+#define CFE_ES_PERF_STREAM_INF_EID 97
+
+/**
+ * \brief Performance Log Streaming File Error Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  A streaming performance log file could not be created or written.  Streaming
+ *  stops writing files and discards the entries until collection is restarted.
+ */
+#define CFE_ES_PERF_STREAM_ERR_EID 98
 /**\}*/
 
 #endif /* CFE_ES_EVENTS_H */
@@ -470,6 +470,7 @@ void CFE_ES_ExitApp(uint32 ExitStatus)
 bool CFE_ES_RunLoop(uint32 *RunStatus)
 {
     bool                ReturnCode;
+    OS_time_t           LoopTime;
     CFE_ES_AppRecord_t *AppRecPtr;
 
     /*
@@ -499,6 +500,12 @@ bool CFE_ES_RunLoop(uint32 *RunStatus)
         return false;
     }
 
+    /*
+     * Stamp the loop iteration before taking the lock, so that the wait for
+     * the lock is not charged to the next iteration.
+     */
+    CFE_PSP_GetTime(&LoopTime);
+
     CFE_ES_LockSharedData(__func__, __LINE__);
 
     /*
@@ -515,6 +522,15 @@ bool CFE_ES_RunLoop(uint32 *RunStatus)
             AppRecPtr->AppState = CFE_ES_AppState_RUNNING;
         }
 
+        /*
+         * Only the main task's calls delimit the app's loop iterations
+         */
+        if (CFE_PLATFORM_ES_APP_RESOURCE_HK_CYCLES > 0 &&
+            CFE_RESOURCEID_TEST_EQUAL(AppRecPtr->MainTaskId, CFE_ES_TaskId_FromOSAL(OS_TaskGetId())))
+        {
+            CFE_ES_AppCpuRecordLoop(&AppRecPtr->CpuStats, LoopTime);
+        }
+
         /*
          * Check if the control request is also set to "RUN"
          * Anything else should also return false, so the loop will exit.
@@ -522,6 +538,22 @@ bool CFE_ES_RunLoop(uint32 *RunStatus)
         if (AppRecPtr->ControlReq.AppControlRequest == CFE_ES_RunStatus_APP_RUN)
         {
             ReturnCode = true;
+
+            /*
+             * Hold external apps here while a snapshot is pending, so that the
+             * snapshot sees their state between iterations of the main loop.
+             */
+            if (CFE_ES_Global.SnapshotState.Pending && AppRecPtr->Type == CFE_ES_AppType_EXTERNAL)
+            {
+                ++CFE_ES_Global.SnapshotState.ParkedApps;
+                while (CFE_ES_Global.SnapshotState.Pending)
+                {
+                    CFE_ES_UnlockSharedData(__func__, __LINE__);
+                    OS_TaskDelay(CFE_ES_SNAPSHOT_POLL_MSEC);
+                    CFE_ES_LockSharedData(__func__, __LINE__);
+                }
+                --CFE_ES_Global.SnapshotState.ParkedApps;
+            }
         }
         else
         {
@@ -1028,6 +1060,9 @@ CFE_Status_t CFE_ES_GetAppInfo(CFE_ES_AppInfo_t *AppInfo, CFE_ES_AppId_t AppId)
 
         ModuleId = AppRecPtr->LoadStatus.ModuleId;
 
+        AppInfo->CpuUtilization = AppRecPtr->CpuStats.CpuUtilization;
+        AppInfo->MaxRunLoopTime = AppRecPtr->CpuStats.MaxRunLoopTime;
+
         /*
         ** Calculate the number of child tasks
         */
@@ -1316,6 +1351,9 @@ CFE_Status_t CFE_ES_CreateChildTask(CFE_ES_TaskId_t *TaskIdPtr, const char *Task
         {
             ParentAppId = CFE_ES_AppRecordGetID(AppRecPtr);
             ReturnCode  = CFE_SUCCESS;
+
+            /* Child tasks stay on the same CPUs as the main task */
+            Params.CpuMask = CFE_ES_LocateTaskRecordByID(SelfTaskId)->StartParams.CpuMask;
         } /* end If AppID is valid */
 
         CFE_ES_UnlockSharedData(__func__, __LINE__);
@@ -1475,6 +1513,56 @@ CFE_Status_t CFE_ES_DeleteChildTask(CFE_ES_TaskId_t TaskId)
     return ReturnCode;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_ES_SetTaskAffinity(CFE_ES_TaskId_t TaskId, uint32 CpuMask)
+{
+    CFE_ES_TaskRecord_t *TaskRecPtr;
+    int32                ReturnCode;
+    int32                OsStatus;
+
+    if (CpuMask == 0)
+    {
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
+    TaskRecPtr = CFE_ES_LocateTaskRecordByID(TaskId);
+
+    CFE_ES_LockSharedData(__func__, __LINE__);
+
+    if (CFE_ES_TaskRecordIsMatch(TaskRecPtr, TaskId))
+    {
+        OsStatus = OS_TaskSetAffinity(CFE_ES_TaskId_ToOSAL(TaskId), CpuMask);
+        if (OsStatus == OS_SUCCESS)
+        {
+            TaskRecPtr->StartParams.CpuMask = CpuMask;
+            ReturnCode                      = CFE_SUCCESS;
+        }
+        else if (OsStatus == OS_ERR_NOT_IMPLEMENTED)
+        {
+            ReturnCode = CFE_ES_NOT_IMPLEMENTED;
+        }
+        else
+        {
+            CFE_ES_SysLogWrite_Unsync("%s: Error Calling OS_TaskSetAffinity: Task %lu, RC = %ld\n", __func__,
+                                      CFE_RESOURCEID_TO_ULONG(TaskId), (long)OsStatus);
+            ReturnCode = CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+        }
+    }
+    else
+    {
+        ReturnCode = CFE_ES_ERR_RESOURCEID_NOT_VALID;
+    }
+
+    CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+    return ReturnCode;
+}
+
 /*----------------------------------------------------------------
  *
  * Implemented per public API
@@ -1770,6 +1858,23 @@ CFE_Status_t CFE_ES_CopyToCDS(CFE_ES_CDSHandle_t Handle, const void *DataToCopy)
     return CFE_ES_CDSBlockWrite(Handle, DataToCopy);
 }
 
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_ES_CopyRangesToCDS(CFE_ES_CDSHandle_t Handle, const void *DataToCopy, const CFE_ES_CDSRange_t *Ranges,
+                                    uint32 NumRanges)
+{
+    if (DataToCopy == NULL || Ranges == NULL || NumRanges == 0)
+    {
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
+    return CFE_ES_CDSBlockWriteRanges(Handle, DataToCopy, Ranges, NumRanges);
+}
+
 /*----------------------------------------------------------------
  *
  * Implemented per public API
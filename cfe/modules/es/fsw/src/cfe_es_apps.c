@@ -50,6 +50,11 @@
 */
 #define ES_START_BUFF_SIZE 128
 
+/*
+** Delay between checks while waiting on a module load by another task
+*/
+#define ES_STARTUP_LOAD_POLL_MSEC 1
+
 /*
 **
 **  Global Variables
@@ -255,7 +260,14 @@ void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath)
                         ** Ensure termination of the last token and send it along
                         */
                         ES_AppLoadBuffer[BuffLen] = 0;
-                        CFE_ES_ParseFileEntry(TokenList, 1 + NumTokens);
+                        if (CFE_PLATFORM_ES_STARTUP_LOAD_WORKERS > 0)
+                        {
+                            CFE_ES_QueueStartupEntry(TokenList, 1 + NumTokens);
+                        }
+                        else
+                        {
+                            CFE_ES_ParseFileEntry(TokenList, 1 + NumTokens);
+                        }
                     }
                     BuffLen   = 0;
                     NumTokens = 0;
@@ -273,6 +285,15 @@ void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath)
         ** close the file
         */
         OS_close(AppFile);
+
+        /*
+        ** With the parallel startup loader, the script only queued the
+        ** entries above, so load and start them now.
+        */
+        if (CFE_PLATFORM_ES_STARTUP_LOAD_WORKERS > 0)
+        {
+            CFE_ES_RunStartupQueue();
+        }
     }
 }
 
@@ -284,9 +305,8 @@ void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath)
  *-----------------------------------------------------------------*/
 int32 CFE_ES_ParseFileEntry(const char **TokenList, uint32 NumTokens)
 {
-    const char   *ModuleName;
-    const char   *EntryType;
-    unsigned long ParsedValue;
+    const char *ModuleName;
+    bool        IsLibrary;
     union
     {
         CFE_ES_AppId_t AppId;
@@ -295,7 +315,50 @@ int32 CFE_ES_ParseFileEntry(const char **TokenList, uint32 NumTokens)
     int32                   Status;
     CFE_ES_AppStartParams_t ParamBuf;
 
-    memset(&ParamBuf, 0, sizeof(ParamBuf));
+    Status = CFE_ES_ParseStartupParams(TokenList, NumTokens, &IsLibrary, &ParamBuf);
+    if (Status != CFE_SUCCESS)
+    {
+        return Status;
+    }
+
+    ModuleName = TokenList[3];
+
+    if (!IsLibrary)
+    {
+        CFE_ES_WriteToSysLog("%s: Loading file: %s, APP: %s\n", __func__, ParamBuf.BasicInfo.FileName, ModuleName);
+
+        /*
+        ** Now create the application
+        */
+        Status = CFE_ES_AppCreate(&IdBuf.AppId, ModuleName, &ParamBuf);
+    }
+    else
+    {
+        CFE_ES_WriteToSysLog("%s: Loading shared library: %s\n", __func__, ParamBuf.BasicInfo.FileName);
+
+        /*
+        ** Now load the library
+        */
+        Status = CFE_ES_LoadLibrary(&IdBuf.LibId, ModuleName, &ParamBuf.BasicInfo);
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_ParseStartupParams(const char **TokenList, uint32 NumTokens, bool *IsLibraryPtr,
+                                CFE_ES_AppStartParams_t *ParamsPtr)
+{
+    const char   *EntryType;
+    unsigned long ParsedValue;
+    int32         Status;
+
+    memset(ParamsPtr, 0, sizeof(*ParamsPtr));
 
     /*
     ** Check to see if the correct number of items were parsed
@@ -307,27 +370,25 @@ int32 CFE_ES_ParseFileEntry(const char **TokenList, uint32 NumTokens)
     }
 
     /* Get pointers to specific tokens that are simple strings used as-is */
-    EntryType  = TokenList[0];
-    ModuleName = TokenList[3];
+    EntryType = TokenList[0];
 
     /*
      * Other tokens will need to be scrubbed/converted.
      * Both Libraries and Apps use File Name (1) and Symbol Name (2) fields so copy those now
      */
-    memset(&ParamBuf, 0, sizeof(ParamBuf));
-    Status = CFE_FS_ParseInputFileName(ParamBuf.BasicInfo.FileName, TokenList[1], sizeof(ParamBuf.BasicInfo.FileName),
-                                       CFE_FS_FileCategory_DYNAMIC_MODULE);
+    Status = CFE_FS_ParseInputFileName(ParamsPtr->BasicInfo.FileName, TokenList[1],
+                                       sizeof(ParamsPtr->BasicInfo.FileName), CFE_FS_FileCategory_DYNAMIC_MODULE);
     if (Status != CFE_SUCCESS)
     {
         CFE_ES_WriteToSysLog("%s: Invalid ES Startup script file name: %s\n", __func__, TokenList[1]);
         return Status;
     }
 
-    strncpy(ParamBuf.BasicInfo.InitSymbolName, TokenList[2], sizeof(ParamBuf.BasicInfo.InitSymbolName) - 1);
+    strncpy(ParamsPtr->BasicInfo.InitSymbolName, TokenList[2], sizeof(ParamsPtr->BasicInfo.InitSymbolName) - 1);
 
     if (strcmp(EntryType, "CFE_APP") == 0)
     {
-        CFE_ES_WriteToSysLog("%s: Loading file: %s, APP: %s\n", __func__, ParamBuf.BasicInfo.FileName, ModuleName);
+        *IsLibraryPtr = false;
 
         /*
          * Priority and Exception action have limited ranges, which is checked here
@@ -336,16 +397,16 @@ int32 CFE_ES_ParseFileEntry(const char **TokenList, uint32 NumTokens)
         ParsedValue = strtoul(TokenList[4], NULL, 0);
         if (ParsedValue > OS_MAX_TASK_PRIORITY)
         {
-            ParamBuf.MainTaskInfo.Priority = OS_MAX_TASK_PRIORITY;
+            ParamsPtr->MainTaskInfo.Priority = OS_MAX_TASK_PRIORITY;
         }
         else
         {
             /* convert parsed value to correct type */
-            ParamBuf.MainTaskInfo.Priority = (CFE_ES_TaskPriority_Atom_t)ParsedValue;
+            ParamsPtr->MainTaskInfo.Priority = (CFE_ES_TaskPriority_Atom_t)ParsedValue;
         }
 
         /* No specific upper/lower limit for stack size - will pass value through */
-        ParamBuf.MainTaskInfo.StackSize = strtoul(TokenList[5], NULL, 0);
+        ParamsPtr->MainTaskInfo.StackSize = strtoul(TokenList[5], NULL, 0);
 
         /*
         ** Validate Some parameters
@@ -356,27 +417,26 @@ int32 CFE_ES_ParseFileEntry(const char **TokenList, uint32 NumTokens)
         ParsedValue = strtoul(TokenList[7], NULL, 0);
         if (ParsedValue > CFE_ES_ExceptionAction_RESTART_APP)
         {
-            ParamBuf.ExceptionAction = CFE_ES_ExceptionAction_PROC_RESTART;
+            ParamsPtr->ExceptionAction = CFE_ES_ExceptionAction_PROC_RESTART;
         }
         else
         {
             /* convert parsed value to correct type */
-            ParamBuf.ExceptionAction = (CFE_ES_ExceptionAction_Enum_t)ParsedValue;
+            ParamsPtr->ExceptionAction = (CFE_ES_ExceptionAction_Enum_t)ParsedValue;
         }
 
         /*
-        ** Now create the application
+        ** The CPU affinity mask in the optional 10th field is passed through
+        ** as-is.  If omitted, the task may run on any CPU.
         */
-        Status = CFE_ES_AppCreate(&IdBuf.AppId, ModuleName, &ParamBuf);
+        if (NumTokens > 9)
+        {
+            ParamsPtr->MainTaskInfo.CpuMask = strtoul(TokenList[9], NULL, 0);
+        }
     }
     else if (strcmp(EntryType, "CFE_LIB") == 0)
     {
-        CFE_ES_WriteToSysLog("%s: Loading shared library: %s\n", __func__, ParamBuf.BasicInfo.FileName);
-
-        /*
-        ** Now load the library
-        */
-        Status = CFE_ES_LoadLibrary(&IdBuf.LibId, ModuleName, &ParamBuf.BasicInfo);
+        *IsLibraryPtr = true;
     }
     else
     {
@@ -387,6 +447,380 @@ int32 CFE_ES_ParseFileEntry(const char **TokenList, uint32 NumTokens)
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_QueueStartupEntry(const char **TokenList, uint32 NumTokens)
+{
+    CFE_ES_StartupQueue_t *QueuePtr;
+    CFE_ES_StartupEntry_t *EntryPtr;
+    int32                  Status;
+
+    QueuePtr = &CFE_ES_Global.StartupQueue;
+
+    if (QueuePtr->NumEntries >= CFE_ES_STARTUP_MAX_ENTRIES)
+    {
+        CFE_ES_WriteToSysLog("%s: Startup queue full, max entries = %u\n", __func__,
+                             (unsigned int)CFE_ES_STARTUP_MAX_ENTRIES);
+        return CFE_ES_NO_RESOURCE_IDS_AVAILABLE;
+    }
+
+    EntryPtr = &QueuePtr->Entries[QueuePtr->NumEntries];
+    memset(EntryPtr, 0, sizeof(*EntryPtr));
+
+    Status = CFE_ES_ParseStartupParams(TokenList, NumTokens, &EntryPtr->IsLibrary, &EntryPtr->Params);
+    if (Status != CFE_SUCCESS)
+    {
+        return Status;
+    }
+
+    /* Confirm name will fit inside the record */
+    if (memchr(TokenList[3], 0, sizeof(EntryPtr->ModuleName)) == NULL)
+    {
+        CFE_ES_WriteToSysLog("%s: Module name too long: %s\n", __func__, TokenList[3]);
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
+    strncpy(EntryPtr->ModuleName, TokenList[3], sizeof(EntryPtr->ModuleName) - 1);
+
+    /*
+     * The optional 9th field carries the dependency hints.  Without it, the
+     * entry waits for every library listed before it, which matches the
+     * ordering the sequential startup provides.
+     */
+    if (NumTokens > 8)
+    {
+        CFE_ES_ParseStartupDepends(EntryPtr, TokenList[8]);
+    }
+    else
+    {
+        EntryPtr->DependsOnAllLibs = true;
+    }
+
+    EntryPtr->State = CFE_ES_StartupEntryState_PENDING;
+    ++QueuePtr->NumEntries;
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_ParseStartupDepends(CFE_ES_StartupEntry_t *EntryPtr, const char *DependList)
+{
+    CFE_ES_StartupQueue_t *QueuePtr;
+    const char            *NamePtr;
+    size_t                 NameLen;
+    uint32                 i;
+
+    QueuePtr = &CFE_ES_Global.StartupQueue;
+
+    if (DependList[0] == 0)
+    {
+        EntryPtr->DependsOnAllLibs = true;
+        return;
+    }
+
+    if (strcmp(DependList, "NONE") == 0)
+    {
+        return;
+    }
+
+    NamePtr = DependList;
+    while (*NamePtr != 0)
+    {
+        NameLen = strcspn(NamePtr, ":");
+
+        /* Only entries earlier in the script are in the queue yet */
+        for (i = 0; i < QueuePtr->NumEntries; ++i)
+        {
+            if (strncmp(QueuePtr->Entries[i].ModuleName, NamePtr, NameLen) == 0 &&
+                QueuePtr->Entries[i].ModuleName[NameLen] == 0)
+            {
+                break;
+            }
+        }
+
+        if (i < QueuePtr->NumEntries && EntryPtr->NumDepends < CFE_ES_STARTUP_MAX_DEPENDS)
+        {
+            EntryPtr->Depends[EntryPtr->NumDepends] = i;
+            ++EntryPtr->NumDepends;
+        }
+        else
+        {
+            CFE_ES_WriteToSysLog("%s: Cannot use dependency %.*s of %s, waiting for all earlier libraries\n",
+                                 __func__, (int)NameLen, NamePtr, EntryPtr->ModuleName);
+            EntryPtr->DependsOnAllLibs = true;
+        }
+
+        NamePtr += NameLen;
+        if (*NamePtr == ':')
+        {
+            ++NamePtr;
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_StartupEntryIsReady(uint32 EntryIdx)
+{
+    const CFE_ES_StartupQueue_t *QueuePtr;
+    const CFE_ES_StartupEntry_t *EntryPtr;
+    uint32                       i;
+    bool                         IsReady;
+
+    QueuePtr = &CFE_ES_Global.StartupQueue;
+    EntryPtr = &QueuePtr->Entries[EntryIdx];
+    IsReady  = true;
+
+    for (i = 0; IsReady && i < EntryPtr->NumDepends; ++i)
+    {
+        IsReady = (QueuePtr->Entries[EntryPtr->Depends[i]].State >= CFE_ES_StartupEntryState_LOADED);
+    }
+
+    if (EntryPtr->DependsOnAllLibs)
+    {
+        for (i = 0; IsReady && i < EntryIdx; ++i)
+        {
+            IsReady = (!QueuePtr->Entries[i].IsLibrary ||
+                       QueuePtr->Entries[i].State >= CFE_ES_StartupEntryState_LOADED);
+        }
+    }
+
+    return IsReady;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_LoadStartupEntry(CFE_ES_StartupEntry_t *EntryPtr)
+{
+    CFE_ResourceId_t ParentBase;
+    OS_time_t        StartTime;
+    OS_time_t        EndTime;
+    int32            Status;
+
+    /* Only the base of the parent ID is used, to choose the symbol visibility */
+    if (EntryPtr->IsLibrary)
+    {
+        ParentBase = CFE_ResourceId_FromInteger(CFE_ES_LIBID_BASE);
+    }
+    else
+    {
+        ParentBase = CFE_ResourceId_FromInteger(CFE_ES_APPID_BASE);
+    }
+
+    CFE_ES_PerfLogEntry(CFE_MISSION_ES_STARTUP_LOAD_PERF_ID);
+    CFE_PSP_GetTime(&StartTime);
+
+    Status = CFE_ES_LoadModule(ParentBase, EntryPtr->ModuleName, &EntryPtr->Params.BasicInfo, &EntryPtr->LoadStatus);
+
+    CFE_PSP_GetTime(&EndTime);
+    CFE_ES_PerfLogExit(CFE_MISSION_ES_STARTUP_LOAD_PERF_ID);
+
+    CFE_ES_LockSharedData(__func__, __LINE__);
+
+    EntryPtr->LoadResult   = Status;
+    EntryPtr->LoadTimeUsec = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(EndTime, StartTime));
+    if (Status == CFE_SUCCESS)
+    {
+        EntryPtr->State = CFE_ES_StartupEntryState_LOADED;
+    }
+    else
+    {
+        EntryPtr->State = CFE_ES_StartupEntryState_FAILED;
+    }
+
+    CFE_ES_UnlockSharedData(__func__, __LINE__);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_StartupLoadWorker(void)
+{
+    CFE_ES_StartupQueue_t *QueuePtr;
+    CFE_ES_StartupEntry_t *ClaimedPtr;
+    uint32                 i;
+    bool                   AnyPending;
+
+    QueuePtr = &CFE_ES_Global.StartupQueue;
+
+    do
+    {
+        ClaimedPtr = NULL;
+        AnyPending = false;
+
+        CFE_ES_LockSharedData(__func__, __LINE__);
+
+        for (i = 0; ClaimedPtr == NULL && i < QueuePtr->NumEntries; ++i)
+        {
+            if (QueuePtr->Entries[i].State == CFE_ES_StartupEntryState_PENDING)
+            {
+                AnyPending = true;
+                if (CFE_ES_StartupEntryIsReady(i))
+                {
+                    ClaimedPtr        = &QueuePtr->Entries[i];
+                    ClaimedPtr->State = CFE_ES_StartupEntryState_LOADING;
+                }
+            }
+        }
+
+        CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+        if (ClaimedPtr != NULL)
+        {
+            CFE_ES_LoadStartupEntry(ClaimedPtr);
+        }
+        else if (AnyPending)
+        {
+            /* Everything left is waiting on a module that is still loading */
+            OS_TaskDelay(ES_STARTUP_LOAD_POLL_MSEC);
+        }
+    } while (AnyPending);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_StartStartupEntry(CFE_ES_StartupEntry_t *EntryPtr)
+{
+    union
+    {
+        CFE_ES_AppId_t AppId;
+        CFE_ES_LibId_t LibId;
+    } IdBuf;
+    OS_time_t StartTime;
+    OS_time_t EndTime;
+    int32     Status;
+
+    if (EntryPtr->State != CFE_ES_StartupEntryState_LOADED)
+    {
+        CFE_ES_WriteToSysLog("%s: Not starting %s, module load failed. RC=0x%08x\n", __func__, EntryPtr->ModuleName,
+                             (unsigned int)EntryPtr->LoadResult);
+        return;
+    }
+
+    CFE_ES_PerfLogEntry(CFE_MISSION_ES_STARTUP_START_PERF_ID);
+    CFE_PSP_GetTime(&StartTime);
+
+    if (EntryPtr->IsLibrary)
+    {
+        Status = CFE_ES_LoadLibraryEx(&IdBuf.LibId, EntryPtr->ModuleName, &EntryPtr->Params.BasicInfo,
+                                      &EntryPtr->LoadStatus);
+    }
+    else
+    {
+        Status = CFE_ES_AppCreateEx(&IdBuf.AppId, EntryPtr->ModuleName, &EntryPtr->Params, &EntryPtr->LoadStatus);
+    }
+
+    CFE_PSP_GetTime(&EndTime);
+    CFE_ES_PerfLogExit(CFE_MISSION_ES_STARTUP_START_PERF_ID);
+
+    CFE_ES_WriteToSysLog("%s: %s %s: load %lu usec, start %lu usec, RC=0x%08x\n", __func__,
+                         EntryPtr->IsLibrary ? "Library" : "App", EntryPtr->ModuleName,
+                         (unsigned long)EntryPtr->LoadTimeUsec,
+                         (unsigned long)OS_TimeGetTotalMicroseconds(OS_TimeSubtract(EndTime, StartTime)),
+                         (unsigned int)Status);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_RunStartupQueue(void)
+{
+    CFE_ES_StartupQueue_t     *QueuePtr;
+    CFE_ES_StartupEntry_t     *EntryPtr;
+    CFE_ES_StartupEntryState_t State;
+    char                       WorkerName[OS_MAX_API_NAME];
+    osal_id_t                  WorkerId;
+    uint32                     NumWorkers;
+    uint32                     i;
+    int32                      OsStatus;
+
+    QueuePtr = &CFE_ES_Global.StartupQueue;
+
+    NumWorkers = CFE_PLATFORM_ES_STARTUP_LOAD_WORKERS;
+    if (NumWorkers > QueuePtr->NumEntries)
+    {
+        NumWorkers = QueuePtr->NumEntries;
+    }
+
+    for (i = 0; i < NumWorkers; ++i)
+    {
+        snprintf(WorkerName, sizeof(WorkerName), "ES_StartLoad%u", (unsigned int)i);
+        OsStatus = OS_TaskCreate(&WorkerId, WorkerName, CFE_ES_StartupLoadWorker, OSAL_TASK_STACK_ALLOCATE,
+                                 CFE_PLATFORM_ES_START_TASK_STACK_SIZE, CFE_PLATFORM_ES_START_TASK_PRIORITY, 0);
+        if (OsStatus != OS_SUCCESS)
+        {
+            /* Not fatal, any entries not picked up by a worker are loaded below */
+            CFE_ES_WriteToSysLog("%s: Cannot create startup loader task %s, RC=%ld\n", __func__, WorkerName,
+                                 (long)OsStatus);
+            break;
+        }
+    }
+
+    CFE_ES_WriteToSysLog("%s: Loading %u startup modules on %u worker tasks\n", __func__,
+                         (unsigned int)QueuePtr->NumEntries, (unsigned int)i);
+
+    /*
+     * Start the modules in script order as they finish loading.  All dependencies
+     * of an entry are earlier in the script and have already been handled here, so
+     * an entry that no worker has claimed yet can always be loaded directly.
+     */
+    for (i = 0; i < QueuePtr->NumEntries; ++i)
+    {
+        EntryPtr = &QueuePtr->Entries[i];
+
+        do
+        {
+            CFE_ES_LockSharedData(__func__, __LINE__);
+
+            State = EntryPtr->State;
+            if (State == CFE_ES_StartupEntryState_PENDING)
+            {
+                EntryPtr->State = CFE_ES_StartupEntryState_LOADING;
+            }
+
+            CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+            if (State == CFE_ES_StartupEntryState_PENDING)
+            {
+                CFE_ES_LoadStartupEntry(EntryPtr);
+            }
+            else if (State == CFE_ES_StartupEntryState_LOADING)
+            {
+                OS_TaskDelay(ES_STARTUP_LOAD_POLL_MSEC);
+            }
+        } while (State == CFE_ES_StartupEntryState_PENDING || State == CFE_ES_StartupEntryState_LOADING);
+
+        CFE_ES_StartStartupEntry(EntryPtr);
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -622,6 +1056,22 @@ int32 CFE_ES_StartAppTask(CFE_ES_TaskId_t *TaskIdPtr, const char *TaskName, CFE_
         TaskRecPtr->EntryFunc   = EntryFunc;
         TaskRecPtr->StartParams = *Params;
 
+        /*
+         * The new task waits in CFE_ES_GetTaskFunction() until this record is
+         * in use, so the affinity takes effect before any app code runs.  This
+         * is best effort; the task still runs if it cannot be applied.
+         */
+        if (Params->CpuMask != 0)
+        {
+            OsStatus = OS_TaskSetAffinity(OsalTaskId, Params->CpuMask);
+            if (OsStatus != OS_SUCCESS)
+            {
+                CFE_ES_SysLogWrite_Unsync("%s: Cannot set CPU affinity 0x%08lx of %s, RC = %ld\n", __func__,
+                                          (unsigned long)Params->CpuMask, TaskName, (long)OsStatus);
+                TaskRecPtr->StartParams.CpuMask = 0;
+            }
+        }
+
         strncpy(TaskRecPtr->TaskName, TaskName, sizeof(TaskRecPtr->TaskName) - 1);
         TaskRecPtr->TaskName[sizeof(TaskRecPtr->TaskName) - 1] = 0;
 
@@ -647,6 +1097,26 @@ int32 CFE_ES_StartAppTask(CFE_ES_TaskId_t *TaskIdPtr, const char *TaskName, CFE_
     return ReturnCode;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_UnloadPreloadedModule(const char *ModuleName, const CFE_ES_ModuleLoadStatus_t *LoadedModule)
+{
+    int32 OsStatus;
+
+    if (LoadedModule != NULL && OS_ObjectIdDefined(LoadedModule->ModuleId))
+    {
+        OsStatus = OS_ModuleUnload(LoadedModule->ModuleId);
+        if (OsStatus != OS_SUCCESS) /* There's not much we can do except notify */
+        {
+            CFE_ES_WriteToSysLog("%s: Failed to unload: %s. EC = %ld\n", __func__, ModuleName, (long)OsStatus);
+        }
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -654,6 +1124,18 @@ int32 CFE_ES_StartAppTask(CFE_ES_TaskId_t *TaskIdPtr, const char *TaskName, CFE_
  *
  *-----------------------------------------------------------------*/
 int32 CFE_ES_AppCreate(CFE_ES_AppId_t *ApplicationIdPtr, const char *AppName, const CFE_ES_AppStartParams_t *Params)
+{
+    return CFE_ES_AppCreateEx(ApplicationIdPtr, AppName, Params, NULL);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_AppCreateEx(CFE_ES_AppId_t *ApplicationIdPtr, const char *AppName, const CFE_ES_AppStartParams_t *Params,
+                         const CFE_ES_ModuleLoadStatus_t *LoadedModule)
 {
     CFE_Status_t        Status;
     CFE_Status_t        CleanupStatus;
@@ -741,6 +1223,7 @@ int32 CFE_ES_AppCreate(CFE_ES_AppId_t *ApplicationIdPtr, const char *AppName, co
             AppRecPtr->ControlReq.AppTimerMsec      = 0;
 
             CFE_ES_AppRecordSetUsed(AppRecPtr, CFE_RESOURCEID_RESERVED);
+            CFE_ES_AppRecordAddName(AppRecPtr);
             CFE_ES_Global.LastAppId = PendingResourceId;
             Status                  = CFE_SUCCESS;
         }
@@ -754,13 +1237,23 @@ int32 CFE_ES_AppCreate(CFE_ES_AppId_t *ApplicationIdPtr, const char *AppName, co
      */
     if (Status != CFE_SUCCESS)
     {
+        CFE_ES_UnloadPreloadedModule(AppName, LoadedModule);
         return Status;
     }
 
     /*
-     * Load the module based on StartParams configured above.
+     * Load the module based on StartParams configured above,
+     * unless the caller already loaded it.
      */
-    Status = CFE_ES_LoadModule(PendingResourceId, AppName, &AppRecPtr->StartParams.BasicInfo, &AppRecPtr->LoadStatus);
+    if (LoadedModule != NULL)
+    {
+        AppRecPtr->LoadStatus = *LoadedModule;
+    }
+    else
+    {
+        Status =
+            CFE_ES_LoadModule(PendingResourceId, AppName, &AppRecPtr->StartParams.BasicInfo, &AppRecPtr->LoadStatus);
+    }
 
     /*
      * If the Load was OK, then complete the initialization
@@ -809,7 +1302,8 @@ int32 CFE_ES_AppCreate(CFE_ES_AppId_t *ApplicationIdPtr, const char *AppName, co
                                     OS_ObjectIdToInteger(AppRecPtr->LoadStatus.ModuleId), (long)CleanupStatus);
             }
         }
-        
+
+        CFE_ES_AppRecordRemoveName(AppRecPtr);
         CFE_ES_AppRecordSetFree(AppRecPtr);
         PendingResourceId = CFE_RESOURCEID_UNDEFINED;
     }
@@ -828,6 +1322,18 @@ int32 CFE_ES_AppCreate(CFE_ES_AppId_t *ApplicationIdPtr, const char *AppName, co
  *
  *-----------------------------------------------------------------*/
 int32 CFE_ES_LoadLibrary(CFE_ES_LibId_t *LibraryIdPtr, const char *LibName, const CFE_ES_ModuleLoadParams_t *Params)
+{
+    return CFE_ES_LoadLibraryEx(LibraryIdPtr, LibName, Params, NULL);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_LoadLibraryEx(CFE_ES_LibId_t *LibraryIdPtr, const char *LibName, const CFE_ES_ModuleLoadParams_t *Params,
+                           const CFE_ES_ModuleLoadStatus_t *LoadedModule)
 {
     CFE_ES_LibraryEntryFuncPtr_t FunctionPointer;
     CFE_ES_LibRecord_t          *LibSlotPtr;
@@ -921,14 +1427,24 @@ int32 CFE_ES_LoadLibrary(CFE_ES_LibId_t *LibraryIdPtr, const char *LibName, cons
      */
     if (Status != CFE_SUCCESS)
     {
+        CFE_ES_UnloadPreloadedModule(LibName, LoadedModule);
         *LibraryIdPtr = CFE_ES_LIBID_C(PendingResourceId);
         return Status;
     }
 
     /*
-     * Load the module based on StartParams configured above.
+     * Load the module based on StartParams configured above,
+     * unless the caller already loaded it.
      */
-    Status = CFE_ES_LoadModule(PendingResourceId, LibName, &LibSlotPtr->LoadParams, &LibSlotPtr->LoadStatus);
+    if (LoadedModule != NULL)
+    {
+        LibSlotPtr->LoadStatus = *LoadedModule;
+    }
+    else
+    {
+        Status = CFE_ES_LoadModule(PendingResourceId, LibName, &LibSlotPtr->LoadParams, &LibSlotPtr->LoadStatus);
+    }
+
     if (Status == CFE_SUCCESS)
     {
         FunctionPointer = (CFE_ES_LibraryEntryFuncPtr_t)LibSlotPtr->LoadStatus.InitSymbolAddress;
@@ -1540,6 +2056,7 @@ int32 CFE_ES_CleanUpApp(CFE_ES_AppId_t AppId)
      */
     if (CFE_ES_AppRecordIsMatch(AppRecPtr, CFE_ES_APPID_C(CFE_RESOURCEID_RESERVED)))
     {
+        CFE_ES_AppRecordRemoveName(AppRecPtr);
         CFE_ES_AppRecordSetFree(AppRecPtr);
     }
 
@@ -1767,3 +2284,116 @@ void CFE_ES_CopyModuleAddressInfo(osal_id_t ModuleId, CFE_ES_AppInfo_t *AppInfoP
     AppInfoPtr->BSSAddress  = CFE_ES_MEMADDRESS_C(ModuleInfo.addr.bss_address);
     AppInfoPtr->BSSSize     = CFE_ES_MEMOFFSET_C(ModuleInfo.addr.bss_size);
 }
+
+/*----------------------------------------------------------------
+ *
+ * Local Helper function
+ * Not invoked outside of this unit
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CFE_ES_AppCpuElapsedUsec(OS_time_t Start, OS_time_t End)
+{
+    int64 Usec;
+
+    Usec = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(End, Start));
+    if (Usec > 0xFFFFFFFF)
+    {
+        Usec = 0xFFFFFFFF;
+    }
+    else if (Usec < 0)
+    {
+        Usec = 0;
+    }
+
+    return (uint32)Usec;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_AppCpuRecordLoop(CFE_ES_AppCpuStats_t *StatsPtr, OS_time_t LoopTime)
+{
+    uint32 LoopUsec;
+
+    if (StatsPtr->LoopValid)
+    {
+        LoopUsec = CFE_ES_AppCpuElapsedUsec(StatsPtr->LastLoopTime, LoopTime);
+        if (LoopUsec > StatsPtr->PeriodMaxLoopUsec)
+        {
+            StatsPtr->PeriodMaxLoopUsec = LoopUsec;
+        }
+        ++StatsPtr->PeriodLoopCount;
+    }
+
+    StatsPtr->LastLoopTime = LoopTime;
+    StatsPtr->LoopValid    = true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_TaskCpuSample(CFE_ES_TaskRecord_t *TaskRecPtr, CFE_ES_AppCpuStats_t *StatsPtr)
+{
+    OS_time_t CpuTime;
+
+    if (CFE_PSP_GetTaskCpuTime(CFE_ES_TaskId_ToOSAL(CFE_ES_TaskRecordGetID(TaskRecPtr)), &CpuTime) != CFE_PSP_SUCCESS)
+    {
+        return;
+    }
+
+    StatsPtr->PeriodCpuTime = OS_TimeAdd(StatsPtr->PeriodCpuTime, OS_TimeSubtract(CpuTime, TaskRecPtr->CpuTime));
+    TaskRecPtr->CpuTime     = CpuTime;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_AppCpuClosePeriod(CFE_ES_AppCpuStats_t *StatsPtr, OS_time_t PeriodEnd, int64 PeriodUsec)
+{
+    int64  Utilization;
+    uint32 LoopUsec;
+
+    Utilization = 0;
+    if (PeriodUsec > 0)
+    {
+        /*
+         * An app with several tasks may use more than one CPU at a time,
+         * so this is not bounded to 100%
+         */
+        Utilization = (OS_TimeGetTotalMicroseconds(StatsPtr->PeriodCpuTime) * 10000) / PeriodUsec;
+        if (Utilization > 0xFFFFFFFF)
+        {
+            Utilization = 0xFFFFFFFF;
+        }
+        else if (Utilization < 0)
+        {
+            Utilization = 0;
+        }
+    }
+
+    if (StatsPtr->LoopValid)
+    {
+        LoopUsec = CFE_ES_AppCpuElapsedUsec(StatsPtr->LastLoopTime, PeriodEnd);
+        if (LoopUsec > StatsPtr->PeriodMaxLoopUsec)
+        {
+            StatsPtr->PeriodMaxLoopUsec = LoopUsec;
+        }
+    }
+
+    StatsPtr->CpuUtilization = (uint32)Utilization;
+    StatsPtr->MaxRunLoopTime = StatsPtr->PeriodMaxLoopUsec;
+    StatsPtr->RunLoopCount   = StatsPtr->PeriodLoopCount;
+
+    StatsPtr->PeriodCpuTime     = OS_TimeAssembleFromNanoseconds(0, 0);
+    StatsPtr->PeriodMaxLoopUsec = 0;
+    StatsPtr->PeriodLoopCount   = 0;
+}
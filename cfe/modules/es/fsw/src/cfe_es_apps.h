@@ -43,7 +43,17 @@
 /*
 ** Macro Definitions
 */
-#define CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE 8
+#define CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE 10
+
+/*
+** Number of startup script entries the parallel startup loader can hold
+*/
+#define CFE_ES_STARTUP_MAX_ENTRIES (CFE_PLATFORM_ES_MAX_APPLICATIONS + CFE_PLATFORM_ES_MAX_LIBRARIES)
+
+/*
+** Maximum number of explicit dependencies listed for a single startup script entry
+*/
+#define CFE_ES_STARTUP_MAX_DEPENDS 4
 
 /*
 ** Type Definitions
@@ -101,6 +111,7 @@ typedef struct
     size_t                     StackSize;
     CFE_ES_StackPointer_t      StackPtr;
     CFE_ES_TaskPriority_Atom_t Priority;
+    uint32                     CpuMask; /* CPUs the task may run on, zero for no restriction */
 } CFE_ES_TaskStartParams_t;
 
 /*
@@ -121,6 +132,28 @@ typedef struct
     CFE_ES_ExceptionAction_Enum_t ExceptionAction;
 } CFE_ES_AppStartParams_t;
 
+/*
+** CFE_ES_AppCpuStats_t holds the CPU usage accounting of an app
+**
+** ES samples the CPU time of every task of the app at the end of each
+** sample period and charges it to the app.  The main task stamps the wall
+** time of each of its CFE_ES_RunLoop calls, from which the loop iteration
+** times are derived.  The "Period" members accumulate over the current
+** sample period, and are published into the last three members when ES
+** closes the period.
+*/
+typedef struct
+{
+    bool      LoopValid;         /* LastLoopTime holds the time of a CFE_ES_RunLoop call */
+    OS_time_t LastLoopTime;      /* Wall time of the previous CFE_ES_RunLoop call by the main task */
+    OS_time_t PeriodCpuTime;     /* CPU time of all tasks of the app in the current period */
+    uint32    PeriodMaxLoopUsec; /* Longest loop iteration in the current period */
+    uint32    PeriodLoopCount;   /* Number of loop iterations in the current period */
+    uint32    CpuUtilization;    /* Utilization over the last period, in hundredths of a percent */
+    uint32    MaxRunLoopTime;    /* Longest loop iteration in the last period, in usec */
+    uint32    RunLoopCount;      /* Number of loop iterations in the last period */
+} CFE_ES_AppCpuStats_t;
+
 /*
 ** CFE_ES_AppRecord_t is an internal structure used to keep track of
 ** CFE Applications that are active in the system.
@@ -135,6 +168,7 @@ typedef struct
     CFE_ES_ModuleLoadStatus_t LoadStatus;               /* Runtime module information */
     CFE_ES_ControlReq_t       ControlReq;               /* The Control Request Record for External cFE Apps */
     CFE_ES_TaskId_t           MainTaskId;               /* The Application's Main Task ID */
+    CFE_ES_AppCpuStats_t      CpuStats;                 /* CPU usage accounting */
 } CFE_ES_AppRecord_t;
 
 /*
@@ -149,6 +183,7 @@ typedef struct
     CFE_ES_TaskStartParams_t  StartParams;               /* The start parameters for the task */
     CFE_ES_TaskEntryFuncPtr_t EntryFunc;                 /* Task entry function */
     uint32                    ExecutionCounter;          /* The execution counter for the task */
+    OS_time_t                 CpuTime;                   /* CPU time of the task at the last sample */
 } CFE_ES_TaskRecord_t;
 
 /*
@@ -174,6 +209,46 @@ typedef struct
     uint8  LastScanCommandCount;
 } CFE_ES_AppTableScanState_t;
 
+/*
+** CFE_ES_StartupEntryState_t tracks the progress of a single startup script
+** entry through the parallel startup loader.
+*/
+typedef enum
+{
+    CFE_ES_StartupEntryState_PENDING = 0, /* Parsed, module not yet loaded */
+    CFE_ES_StartupEntryState_LOADING,     /* Module load in progress */
+    CFE_ES_StartupEntryState_LOADED,      /* Module loaded, waiting to be started in script order */
+    CFE_ES_StartupEntryState_FAILED       /* Module load failed */
+} CFE_ES_StartupEntryState_t;
+
+/*
+** CFE_ES_StartupEntry_t is an internal structure holding one startup script
+** entry while its module is loaded by the parallel startup loader.
+*/
+typedef struct
+{
+    char                       ModuleName[OS_MAX_API_NAME];         /* The cFE name of the app or library */
+    bool                       IsLibrary;                           /* Entry is a CFE_LIB rather than a CFE_APP */
+    bool                       DependsOnAllLibs;                    /* Wait for all earlier libraries to load */
+    uint8                      NumDepends;                          /* Number of valid entries in Depends */
+    uint16                     Depends[CFE_ES_STARTUP_MAX_DEPENDS]; /* Earlier entries that must load first */
+    CFE_ES_StartupEntryState_t State;                               /* Load progress of this entry */
+    int32                      LoadResult;                          /* Status code of the module load */
+    uint32                     LoadTimeUsec;                        /* Time spent loading the module */
+    CFE_ES_AppStartParams_t    Params;                              /* Parameters parsed from the script */
+    CFE_ES_ModuleLoadStatus_t  LoadStatus;                          /* Loaded module, passed on at start */
+} CFE_ES_StartupEntry_t;
+
+/*
+** CFE_ES_StartupQueue_t is an internal structure holding all entries of the
+** startup script when the parallel startup loader is enabled.
+*/
+typedef struct
+{
+    uint32                NumEntries;
+    CFE_ES_StartupEntry_t Entries[CFE_ES_STARTUP_MAX_ENTRIES];
+} CFE_ES_StartupQueue_t;
+
 /*****************************************************************************/
 /*
 ** Function prototypes
@@ -191,6 +266,72 @@ void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath);
  */
 int32 CFE_ES_ParseFileEntry(const char **TokenList, uint32 NumTokens);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Converts the tokens of a startup file line into module start parameters.
+ *
+ * Validates the entry type and fills in the parameters used by both
+ * CFE_ES_ParseFileEntry() and the parallel startup loader.
+ */
+int32 CFE_ES_ParseStartupParams(const char **TokenList, uint32 NumTokens, bool *IsLibraryPtr,
+                                CFE_ES_AppStartParams_t *ParamsPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Adds a startup file line to the parallel startup loader queue.
+ *
+ * The module is not loaded here; see CFE_ES_RunStartupQueue().
+ */
+int32 CFE_ES_QueueStartupEntry(const char **TokenList, uint32 NumTokens);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Records the dependency hints of a queued startup entry.
+ *
+ * The hint is a ':' separated list of earlier module names, or "NONE".
+ * Names not found earlier in the script make the entry wait for all
+ * earlier libraries, which is also the behavior when no hint is given.
+ */
+void CFE_ES_ParseStartupDepends(CFE_ES_StartupEntry_t *EntryPtr, const char *DependList);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Checks whether all dependencies of a queued startup entry are loaded.
+ *
+ * Must be called with the ES shared data locked.
+ */
+bool CFE_ES_StartupEntryIsReady(uint32 EntryIdx);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Loads the module of a queued startup entry and records the result.
+ *
+ * The entry must have been claimed (set to LOADING) by the caller.
+ */
+void CFE_ES_LoadStartupEntry(CFE_ES_StartupEntry_t *EntryPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Entry point of the startup loader worker tasks.
+ *
+ * Claims and loads queued entries whose dependencies are satisfied,
+ * and exits once no entries are left to load.
+ */
+void CFE_ES_StartupLoadWorker(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Creates the app or initializes the library of a loaded startup entry.
+ */
+void CFE_ES_StartStartupEntry(CFE_ES_StartupEntry_t *EntryPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Loads all queued startup entries on a pool of worker tasks and starts
+ * them in the order they appear in the startup script.
+ */
+void CFE_ES_RunStartupQueue(void);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * Helper function to load + configure (but not start) a new app/lib module
@@ -237,6 +378,14 @@ void CFE_ES_TaskEntryPoint(void);
 int32 CFE_ES_StartAppTask(CFE_ES_TaskId_t *TaskIdPtr, const char *TaskName, CFE_ES_TaskEntryFuncPtr_t EntryFunc,
                           const CFE_ES_TaskStartParams_t *Params, CFE_ES_AppId_t ParentAppId);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Unloads a module that was loaded ahead of creating its app or library record.
+ *
+ * Does nothing if LoadedModule is NULL.
+ */
+void CFE_ES_UnloadPreloadedModule(const char *ModuleName, const CFE_ES_ModuleLoadStatus_t *LoadedModule);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * This function loads and creates a cFE Application.
@@ -247,12 +396,34 @@ int32 CFE_ES_StartAppTask(CFE_ES_TaskId_t *TaskIdPtr, const char *TaskName, CFE_
  */
 int32 CFE_ES_AppCreate(CFE_ES_AppId_t *ApplicationIdPtr, const char *AppName, const CFE_ES_AppStartParams_t *Params);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * This function creates a cFE Application, optionally from an already loaded module.
+ *
+ * If LoadedModule is not NULL, the module it refers to is used instead of loading
+ * the file named in the start parameters.  Once the arguments are validated, ownership
+ * of the module passes to this function, which unloads it if the app cannot be created.
+ */
+int32 CFE_ES_AppCreateEx(CFE_ES_AppId_t *ApplicationIdPtr, const char *AppName, const CFE_ES_AppStartParams_t *Params,
+                         const CFE_ES_ModuleLoadStatus_t *LoadedModule);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * This function loads and initializes a cFE Shared Library.
  */
 int32 CFE_ES_LoadLibrary(CFE_ES_LibId_t *LibraryIdPtr, const char *LibName, const CFE_ES_ModuleLoadParams_t *Params);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * This function initializes a cFE Shared Library, optionally from an already loaded module.
+ *
+ * If LoadedModule is not NULL, the module it refers to is used instead of loading
+ * the file named in the load parameters.  Once the arguments are validated, ownership
+ * of the module passes to this function, which unloads it if no library slot is available.
+ */
+int32 CFE_ES_LoadLibraryEx(CFE_ES_LibId_t *LibraryIdPtr, const char *LibName, const CFE_ES_ModuleLoadParams_t *Params,
+                           const CFE_ES_ModuleLoadStatus_t *LoadedModule);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * Scan the Application Table for actions to take
@@ -340,4 +511,52 @@ void CFE_ES_CopyModuleStatusInfo(const CFE_ES_ModuleLoadStatus_t *StatusPtr, CFE
  */
 void CFE_ES_CopyModuleAddressInfo(osal_id_t ModuleId, CFE_ES_AppInfo_t *AppInfoPtr);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Account for one iteration of an app's main loop.
+ *
+ * Called from CFE_ES_RunLoop by the app's main task with the current wall
+ * time.  The time since the previous call is the length of one loop
+ * iteration, including any time the app spent pending on its pipe.
+ *
+ * The caller must hold the ES shared data lock.
+ *
+ * @param[inout] StatsPtr  CPU accounting of the app
+ * @param[in]    LoopTime  Wall time of the call
+ */
+void CFE_ES_AppCpuRecordLoop(CFE_ES_AppCpuStats_t *StatsPtr, OS_time_t LoopTime);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Charge the CPU time a task used since its previous sample to its app.
+ *
+ * A task that was never sampled is charged all of its CPU time since it
+ * was created.  If the PSP cannot sample the task nothing is charged.
+ *
+ * The caller must hold the ES shared data lock.
+ *
+ * @param[inout] TaskRecPtr  Task to sample
+ * @param[inout] StatsPtr    CPU accounting of the task's parent app
+ */
+void CFE_ES_TaskCpuSample(CFE_ES_TaskRecord_t *TaskRecPtr, CFE_ES_AppCpuStats_t *StatsPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Close the current CPU accounting sample period of an app.
+ *
+ * Computes the utilization of the app's tasks over the period and
+ * publishes it, together with the loop statistics, then starts a new period.
+ *
+ * A loop iteration still in progress at the end of the period counts with
+ * the time it has taken so far, so a main loop that overruns or hangs is
+ * reported without waiting for the iteration to end.
+ *
+ * The caller must hold the ES shared data lock.
+ *
+ * @param[inout] StatsPtr    CPU accounting of the app
+ * @param[in]    PeriodEnd   Wall time at the end of the period
+ * @param[in]    PeriodUsec  Wall clock length of the period, in microseconds
+ */
+void CFE_ES_AppCpuClosePeriod(CFE_ES_AppCpuStats_t *StatsPtr, OS_time_t PeriodEnd, int64 PeriodUsec);
+
 #endif /* CFE_ES_APPS_H */
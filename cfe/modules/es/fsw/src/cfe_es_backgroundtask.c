@@ -74,6 +74,11 @@ const CFE_ES_BackgroundJobEntry_t CFE_ES_BACKGROUND_JOB_TABLE[] = {
      .JobArg       = &CFE_ES_Global.BackgroundPerfDumpState,
      .ActivePeriod = CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY,
      .IdlePeriod   = CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY * 1000},
+    {/* Performance Log Data streaming to the rotating file set */
+     .RunFunc      = CFE_ES_RunPerfLogStream,
+     .JobArg       = &CFE_ES_Global.BackgroundPerfStreamState,
+     .ActivePeriod = CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY,
+     .IdlePeriod   = 0},
     {/* Check for exceptions stored in the PSP */
      .RunFunc      = CFE_ES_RunExceptionScan,
      .JobArg       = NULL,
@@ -83,7 +88,12 @@ const CFE_ES_BackgroundJobEntry_t CFE_ES_BACKGROUND_JOB_TABLE[] = {
      .RunFunc      = CFE_FS_RunBackgroundFileDump,
      .JobArg       = NULL,
      .ActivePeriod = CFE_PLATFORM_ES_APP_SCAN_RATE,
-     .IdlePeriod   = CFE_PLATFORM_ES_APP_SCAN_RATE}};
+     .IdlePeriod   = CFE_PLATFORM_ES_APP_SCAN_RATE},
+    {/* State snapshot to file, once apps are parked */
+     .RunFunc      = CFE_ES_RunSnapshot,
+     .JobArg       = &CFE_ES_Global.SnapshotState,
+     .ActivePeriod = CFE_ES_SNAPSHOT_POLL_MSEC,
+     .IdlePeriod   = 0}};
 
 #define CFE_ES_BACKGROUND_NUM_JOBS (sizeof(CFE_ES_BACKGROUND_JOB_TABLE) / sizeof(CFE_ES_BACKGROUND_JOB_TABLE[0]))
 
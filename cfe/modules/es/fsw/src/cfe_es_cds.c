@@ -42,6 +42,25 @@
 #include <stdio.h>
 #include <stdarg.h>
 
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Name match function for the CDS registry name index
+ *
+ *-----------------------------------------------------------------*/
+static bool CFE_ES_CDSNameMatch(uint32 Idx, const char *Name)
+{
+    CFE_ES_CDS_RegRec_t *RegRecPtr = &CFE_ES_Global.CDSVars.Registry[Idx];
+
+    return (CFE_ES_CDSBlockRecordIsUsed(RegRecPtr) && strcmp(Name, RegRecPtr->Name) == 0);
+}
+
+static const CFE_ResourceId_NameIndex_t CFE_ES_CDSNameIndex = {
+    .Buckets    = CFE_ES_Global.CDSVars.RegistryNameIndex,
+    .NumBuckets = CFE_RESOURCEID_NAMEINDEX_BUCKETS(CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES),
+    .TableSize  = CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES,
+    .MatchFunc  = CFE_ES_CDSNameMatch};
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -365,9 +384,8 @@ int32 CFE_ES_RegisterCDSEx(CFE_ES_CDSHandle_t *HandlePtr, size_t UserBlockSize,
 
     if (RegRecPtr != NULL)
     {
-        /* Account for the extra header which will be added */
-        NewBlockSize = UserBlockSize;
-        NewBlockSize += sizeof(CFE_ES_CDS_BlockHeader_t);
+        /* Account for the extra header and per-chunk CRC table which will be added */
+        NewBlockSize = CFE_ES_CDSBlockSizeForUserSize(UserBlockSize);
 
         /* If a reallocation is needed, the old block may need to be freed first */
         if (Status == CFE_SUCCESS && RegRecPtr->BlockOffset != 0 && NewBlockSize != RegRecPtr->BlockSize)
@@ -409,6 +427,7 @@ int32 CFE_ES_RegisterCDSEx(CFE_ES_CDSHandle_t *HandlePtr, size_t UserBlockSize,
             strncpy(RegRecPtr->Name, Name, sizeof(RegRecPtr->Name) - 1);
             RegRecPtr->Name[sizeof(RegRecPtr->Name) - 1] = 0;
             CFE_ES_CDSBlockRecordSetUsed(RegRecPtr, PendingBlockId);
+            CFE_ES_CDSBlockRecordAddName(RegRecPtr);
         }
 
         if (Status == CFE_SUCCESS && IsNewOffset)
@@ -601,6 +620,7 @@ int32 CFE_ES_InitCDSRegistry(void)
     if (Status == CFE_SUCCESS)
     {
         memset(CDS->Registry, 0, sizeof(CDS->Registry));
+        memset(CDS->RegistryNameIndex, 0, sizeof(CDS->RegistryNameIndex));
 
         Status = CFE_ES_UpdateCDSRegistry();
     }
@@ -717,35 +737,37 @@ int32 CFE_ES_UnlockCDS(void)
  *-----------------------------------------------------------------*/
 CFE_ES_CDS_RegRec_t *CFE_ES_LocateCDSBlockRecordByName(const char *CDSName)
 {
-    CFE_ES_CDS_Instance_t *CDS = &CFE_ES_Global.CDSVars;
-    CFE_ES_CDS_RegRec_t *  CDSRegRecPtr;
-    uint32                 NumReg;
+    uint32 Idx;
 
-    CDSRegRecPtr = CDS->Registry;
-    NumReg       = CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES;
-    while (true)
+    /* Perform a case sensitive name lookup using the registry name index */
+    if (CFE_ResourceId_NameIndexFind(&CFE_ES_CDSNameIndex, CDSName, &Idx) != CFE_SUCCESS)
     {
-        if (NumReg == 0)
-        {
-            CDSRegRecPtr = NULL; /* not found */
-            break;
-        }
+        return NULL; /* not found */
+    }
 
-        if (CFE_ES_CDSBlockRecordIsUsed(CDSRegRecPtr))
-        {
-            /* Perform a case sensitive name comparison */
-            if (strcmp(CDSName, CDSRegRecPtr->Name) == 0)
-            {
-                /* If the names match, then stop */
-                break;
-            }
-        }
+    return &CFE_ES_Global.CDSVars.Registry[Idx];
+}
 
-        ++CDSRegRecPtr;
-        --NumReg;
-    }
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_CDSBlockRecordAddName(CFE_ES_CDS_RegRec_t *RegRecPtr)
+{
+    CFE_ResourceId_NameIndexAdd(&CFE_ES_CDSNameIndex, RegRecPtr->Name, RegRecPtr - CFE_ES_Global.CDSVars.Registry);
+}
 
-    return CDSRegRecPtr;
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_CDSBlockRecordRemoveName(CFE_ES_CDS_RegRec_t *RegRecPtr)
+{
+    CFE_ResourceId_NameIndexRemove(&CFE_ES_CDSNameIndex, RegRecPtr->Name, RegRecPtr - CFE_ES_Global.CDSVars.Registry);
 }
 
 /*----------------------------------------------------------------
@@ -759,6 +781,7 @@ int32 CFE_ES_RebuildCDS(void)
     CFE_ES_CDS_Instance_t *CDS = &CFE_ES_Global.CDSVars;
     int32                  Status;
     int32                  PspStatus;
+    uint32                 i;
 
     /* First, determine if the CDS registry stored in the CDS is smaller or equal */
     /* in size to the CDS registry we are currently configured for                */
@@ -783,6 +806,16 @@ int32 CFE_ES_RebuildCDS(void)
 
     if (PspStatus == CFE_PSP_SUCCESS)
     {
+        /* Index the names of the recovered registry entries */
+        memset(CDS->RegistryNameIndex, 0, sizeof(CDS->RegistryNameIndex));
+        for (i = 0; i < CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES; ++i)
+        {
+            if (CFE_ES_CDSBlockRecordIsUsed(&CDS->Registry[i]))
+            {
+                CFE_ES_CDSBlockRecordAddName(&CDS->Registry[i]);
+            }
+        }
+
         /* Scan the memory pool and identify the created but currently unused memory blocks */
         Status = CFE_ES_RebuildCDSPool(CDS->DataSize, CDS_POOL_OFFSET);
     }
@@ -864,6 +897,7 @@ int32 CFE_ES_DeleteCDS(const char *CDSName, bool CalledByTblServices)
                 else
                 {
                     /* Remove entry from the CDS Registry */
+                    CFE_ES_CDSBlockRecordRemoveName(RegRecPtr);
                     CFE_ES_CDSBlockRecordSetFree(RegRecPtr);
 
                     Status = CFE_ES_UpdateCDSRegistry();
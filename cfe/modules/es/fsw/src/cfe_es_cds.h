@@ -82,10 +82,19 @@
  * User-defined platform limits (in cfe_platform_cfg.h) may be lower,
  * but this is a hard limit to avoid overflow of a 32 bit integer.
  *
- * This ensures the size is safe for a PSP that uses 32 bit CDS offsets.
+ * This ensures the size is safe for a PSP that uses 32 bit CDS offsets,
+ * including the block header and per-chunk CRC table added by the CDS code.
  * (It is not anticipated that a CDS would need to exceed this size)
  */
-#define CDS_ABS_MAX_BLOCK_SIZE ((size_t)(1 << 30) - sizeof(CFE_ES_CDS_BlockHeader_t))
+#define CDS_ABS_MAX_BLOCK_SIZE ((size_t)(1 << 29))
+
+/*
+ * Size of the per-chunk CRC table stored in a CDS block holding the given
+ * amount of user data.  This is a macro, rather than an inline function,
+ * so that it can be used in the constant pool block size table.
+ */
+#define CFE_ES_CDS_CRC_TABLE_SIZE(UserSize) \
+    ((((UserSize) + CFE_PLATFORM_ES_CDS_CHUNK_SIZE - 1) / CFE_PLATFORM_ES_CDS_CHUNK_SIZE) * sizeof(uint32))
 
 /*
 ** Type Definitions
@@ -110,9 +119,24 @@ typedef struct
     bool               Table; /**< \brief Flag that indicates whether CDS contains a Critical Table */
 } CFE_ES_CDS_RegRec_t;
 
+/**
+ * The header stored at the beginning of every user block in the CDS.
+ *
+ * The user data within each block is divided into chunks of
+ * #CFE_PLATFORM_ES_CDS_CHUNK_SIZE bytes, each of which has its own CRC.
+ * The per-chunk CRC table immediately follows this header, and the user
+ * data immediately follows the CRC table.  This allows a partial update
+ * of the block to copy and re-checksum only the chunks that changed.
+ *
+ * The CommitSeq field serves as the commit marker for an update.  It is
+ * made odd before any chunk is modified and even again once the update
+ * is complete, so an update that was interrupted by a reset can be
+ * detected when the block is restored.
+ */
 typedef struct CFE_ES_CDSBlockHeader
 {
-    uint32 Crc; /**< CRC of content */
+    uint32 Crc;       /**< CRC of the per-chunk CRC table */
+    uint32 CommitSeq; /**< Commit marker, odd while an update is in progress */
 } CFE_ES_CDS_BlockHeader_t;
 
 /*
@@ -163,6 +187,9 @@ typedef struct
     size_t              DataSize;       /**< \brief Size of actual user data pool */
     CFE_ResourceId_t    LastCDSBlockId; /**< \brief Last issued CDS block ID */
     CFE_ES_CDS_RegRec_t Registry[CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES]; /**< \brief CDS Registry (Local Copy) */
+
+    /** \brief Hashed index of the names in the local registry */
+    uint32 RegistryNameIndex[CFE_RESOURCEID_NAMEINDEX_BUCKETS(CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES)];
 } CFE_ES_CDS_Instance_t;
 
 /*
@@ -416,7 +443,56 @@ static inline bool CFE_ES_CDSBlockRecordIsMatch(const CFE_ES_CDS_RegRec_t *CDSBl
  */
 static inline size_t CFE_ES_CDSBlockRecordGetUserSize(const CFE_ES_CDS_RegRec_t *CDSBlockRecPtr)
 {
-    return (CDSBlockRecPtr->BlockSize - sizeof(CFE_ES_CDS_BlockHeader_t));
+    size_t ChunkStride;
+    size_t Remainder;
+    size_t UserSize;
+
+    if (CDSBlockRecPtr->BlockSize <= sizeof(CFE_ES_CDS_BlockHeader_t))
+    {
+        return 0;
+    }
+
+    /*
+     * Each full chunk consumes its data plus one CRC table entry, and a
+     * partial chunk at the end consumes a CRC table entry plus the remainder.
+     */
+    ChunkStride = CFE_PLATFORM_ES_CDS_CHUNK_SIZE + sizeof(uint32);
+    UserSize    = CDSBlockRecPtr->BlockSize - sizeof(CFE_ES_CDS_BlockHeader_t);
+    Remainder   = UserSize % ChunkStride;
+    UserSize    = (UserSize / ChunkStride) * CFE_PLATFORM_ES_CDS_CHUNK_SIZE;
+
+    if (Remainder > sizeof(uint32))
+    {
+        UserSize += Remainder - sizeof(uint32);
+    }
+
+    return UserSize;
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Gets the number of CRC chunks for a given amount of user data
+ *
+ * @param[in]   UserSize   Size of the user data in the block
+ * @returns     Number of entries in the per-chunk CRC table
+ */
+static inline size_t CFE_ES_CDSChunkCount(size_t UserSize)
+{
+    return ((UserSize + CFE_PLATFORM_ES_CDS_CHUNK_SIZE - 1) / CFE_PLATFORM_ES_CDS_CHUNK_SIZE);
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Gets the total CDS block size needed to store a given amount of user data
+ *
+ * This includes the block header and the per-chunk CRC table.
+ *
+ * @param[in]   UserSize   Size of the user data in the block
+ * @returns     Raw size of the CDS block
+ */
+static inline size_t CFE_ES_CDSBlockSizeForUserSize(size_t UserSize)
+{
+    return (sizeof(CFE_ES_CDS_BlockHeader_t) + CFE_ES_CDS_CRC_TABLE_SIZE(UserSize) + UserSize);
 }
 
 /*---------------------------------------------------------------------------------------*/
@@ -564,6 +640,28 @@ void CFE_ES_FormCDSName(char *FullCDSName, const char *CDSName, CFE_ES_AppId_t T
 ******************************************************************************/
 CFE_ES_CDS_RegRec_t *CFE_ES_LocateCDSBlockRecordByName(const char *CDSName);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Adds a CDS registry entry to the registry name index
+ *
+ * Must be called after the name has been stored in the entry.
+ * Must be called while the CDS is locked.
+ *
+ * @param[in]  RegRecPtr  the registry entry
+ */
+void CFE_ES_CDSBlockRecordAddName(CFE_ES_CDS_RegRec_t *RegRecPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Removes a CDS registry entry from the registry name index
+ *
+ * Must be called before the entry is freed.
+ * Must be called while the CDS is locked.
+ *
+ * @param[in]  RegRecPtr  the registry entry
+ */
+void CFE_ES_CDSBlockRecordRemoveName(CFE_ES_CDS_RegRec_t *RegRecPtr);
+
 /*---------------------------------------------------------------------------------------*/
 /**
 ** \brief Locks access to the CDS
@@ -48,8 +48,14 @@
 ** File Global Data
 */
 
+/*
+ * The largest block also holds the per-chunk CRC table of a maximum size
+ * block, so that the CRC table does not reduce the largest CDS an
+ * application can register.
+ */
 const size_t CFE_ES_CDSMemPoolDefSize[CFE_ES_CDS_NUM_BLOCK_SIZES] = {
-    CFE_PLATFORM_ES_CDS_MAX_BLOCK_SIZE,    CFE_PLATFORM_ES_CDS_MEM_BLOCK_SIZE_16, CFE_PLATFORM_ES_CDS_MEM_BLOCK_SIZE_15,
+    CFE_PLATFORM_ES_CDS_MAX_BLOCK_SIZE + CFE_ES_CDS_CRC_TABLE_SIZE(CFE_PLATFORM_ES_CDS_MAX_BLOCK_SIZE),
+    CFE_PLATFORM_ES_CDS_MEM_BLOCK_SIZE_16, CFE_PLATFORM_ES_CDS_MEM_BLOCK_SIZE_15,
     CFE_PLATFORM_ES_CDS_MEM_BLOCK_SIZE_14, CFE_PLATFORM_ES_CDS_MEM_BLOCK_SIZE_13, CFE_PLATFORM_ES_CDS_MEM_BLOCK_SIZE_12,
     CFE_PLATFORM_ES_CDS_MEM_BLOCK_SIZE_11, CFE_PLATFORM_ES_CDS_MEM_BLOCK_SIZE_10, CFE_PLATFORM_ES_CDS_MEM_BLOCK_SIZE_09,
     CFE_PLATFORM_ES_CDS_MEM_BLOCK_SIZE_08, CFE_PLATFORM_ES_CDS_MEM_BLOCK_SIZE_07, CFE_PLATFORM_ES_CDS_MEM_BLOCK_SIZE_06,
@@ -160,6 +166,140 @@ int32 CFE_ES_RebuildCDSPool(size_t CDSPoolSize, size_t StartOffset)
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Computes the CRC of the per-chunk CRC table of a CDS block, reading
+ * the table back from CDS storage in small batches.  Optionally verifies
+ * each table entry against the corresponding chunk of user data.
+ *
+ * CDS access mutex must be locked by the caller.
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_CDS_ComputeChunkTableCrc(size_t TableOffset, size_t NumChunks, const void *UserData, size_t UserDataSize,
+                                      uint32 *TableCrcPtr)
+{
+    uint32       ChunkCrcBuf[CFE_ES_CDS_CHUNK_CRC_BATCH];
+    const uint8 *ChunkPtr;
+    size_t       ChunkNum;
+    size_t       BatchCount;
+    size_t       ChunkSize;
+    size_t       i;
+    int32        PspStatus;
+    int32        Status;
+
+    Status       = CFE_SUCCESS;
+    ChunkNum     = 0;
+    *TableCrcPtr = 0;
+
+    while (ChunkNum < NumChunks)
+    {
+        BatchCount = NumChunks - ChunkNum;
+        if (BatchCount > CFE_ES_CDS_CHUNK_CRC_BATCH)
+        {
+            BatchCount = CFE_ES_CDS_CHUNK_CRC_BATCH;
+        }
+
+        PspStatus = CFE_PSP_ReadFromCDS(ChunkCrcBuf, TableOffset + (ChunkNum * sizeof(uint32)),
+                                        BatchCount * sizeof(uint32));
+        if (PspStatus != CFE_PSP_SUCCESS)
+        {
+            return CFE_ES_CDS_ACCESS_ERROR;
+        }
+
+        if (UserData != NULL)
+        {
+            for (i = 0; i < BatchCount; ++i)
+            {
+                ChunkPtr  = (const uint8 *)UserData + ((ChunkNum + i) * CFE_PLATFORM_ES_CDS_CHUNK_SIZE);
+                ChunkSize = UserDataSize - ((ChunkNum + i) * CFE_PLATFORM_ES_CDS_CHUNK_SIZE);
+                if (ChunkSize > CFE_PLATFORM_ES_CDS_CHUNK_SIZE)
+                {
+                    ChunkSize = CFE_PLATFORM_ES_CDS_CHUNK_SIZE;
+                }
+
+                if (CFE_ES_CalculateCRC(ChunkPtr, ChunkSize, 0, CFE_MISSION_ES_DEFAULT_CRC) != ChunkCrcBuf[i])
+                {
+                    Status = CFE_ES_CDS_BLOCK_CRC_ERR;
+                }
+            }
+        }
+
+        *TableCrcPtr = CFE_ES_CalculateCRC(ChunkCrcBuf, BatchCount * sizeof(uint32), *TableCrcPtr,
+                                           CFE_MISSION_ES_DEFAULT_CRC);
+        ChunkNum += BatchCount;
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Writes a contiguous run of chunks of user data to CDS storage,
+ * along with the updated CRC table entries for those chunks.
+ *
+ * CDS access mutex must be locked by the caller.
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_CDS_WriteChunkRun(size_t TableOffset, size_t UserDataOffset, const void *UserData, size_t UserDataSize,
+                               size_t FirstChunk, size_t LastChunk)
+{
+    uint32       ChunkCrcBuf[CFE_ES_CDS_CHUNK_CRC_BATCH];
+    const uint8 *ChunkPtr;
+    size_t       ChunkNum;
+    size_t       BatchStart;
+    size_t       BatchCount;
+    size_t       ChunkSize;
+    size_t       RunStart;
+    size_t       RunSize;
+    int32        PspStatus;
+
+    RunStart = FirstChunk * CFE_PLATFORM_ES_CDS_CHUNK_SIZE;
+    RunSize  = ((LastChunk + 1) * CFE_PLATFORM_ES_CDS_CHUNK_SIZE) - RunStart;
+    if (RunStart + RunSize > UserDataSize)
+    {
+        RunSize = UserDataSize - RunStart;
+    }
+
+    PspStatus = CFE_PSP_WriteToCDS((const uint8 *)UserData + RunStart, UserDataOffset + RunStart, RunSize);
+    if (PspStatus != CFE_PSP_SUCCESS)
+    {
+        return CFE_ES_CDS_ACCESS_ERROR;
+    }
+
+    ChunkNum = FirstChunk;
+    while (ChunkNum <= LastChunk)
+    {
+        BatchStart = ChunkNum;
+        BatchCount = 0;
+        while (ChunkNum <= LastChunk && BatchCount < CFE_ES_CDS_CHUNK_CRC_BATCH)
+        {
+            ChunkPtr  = (const uint8 *)UserData + (ChunkNum * CFE_PLATFORM_ES_CDS_CHUNK_SIZE);
+            ChunkSize = UserDataSize - (ChunkNum * CFE_PLATFORM_ES_CDS_CHUNK_SIZE);
+            if (ChunkSize > CFE_PLATFORM_ES_CDS_CHUNK_SIZE)
+            {
+                ChunkSize = CFE_PLATFORM_ES_CDS_CHUNK_SIZE;
+            }
+
+            ChunkCrcBuf[BatchCount] = CFE_ES_CalculateCRC(ChunkPtr, ChunkSize, 0, CFE_MISSION_ES_DEFAULT_CRC);
+            ++BatchCount;
+            ++ChunkNum;
+        }
+
+        PspStatus = CFE_PSP_WriteToCDS(ChunkCrcBuf, TableOffset + (BatchStart * sizeof(uint32)),
+                                       BatchCount * sizeof(uint32));
+        if (PspStatus != CFE_PSP_SUCCESS)
+        {
+            return CFE_ES_CDS_ACCESS_ERROR;
+        }
+    }
+
+    return CFE_SUCCESS;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -167,18 +307,38 @@ int32 CFE_ES_RebuildCDSPool(size_t CDSPoolSize, size_t StartOffset)
  *
  *-----------------------------------------------------------------*/
 int32 CFE_ES_CDSBlockWrite(CFE_ES_CDSHandle_t Handle, const void *DataToWrite)
+{
+    return CFE_ES_CDSBlockWriteRanges(Handle, DataToWrite, NULL, 0);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_CDSBlockWriteRanges(CFE_ES_CDSHandle_t Handle, const void *DataToWrite, const CFE_ES_CDSRange_t *Ranges,
+                                 uint32 NumRanges)
 {
     CFE_ES_CDS_Instance_t *CDS = &CFE_ES_Global.CDSVars;
     char                   LogMessage[CFE_ES_MAX_SYSLOG_MSG_SIZE];
     int32                  Status;
-    int32                  PspStatus;
+    uint32                 TableCrc;
+    uint32                 CommitSeq;
+    uint32                 i;
     size_t                 BlockSize;
     size_t                 UserDataSize;
     size_t                 UserDataOffset;
+    size_t                 TableOffset;
+    size_t                 NumChunks;
+    size_t                 FirstChunk;
+    size_t                 LastChunk;
+    CFE_ES_CDSRange_t      FullRange;
     CFE_ES_CDS_RegRec_t *  CDSRegRecPtr;
 
     /* Ensure the log message is an empty string in case it is never written to */
     LogMessage[0] = 0;
+    CommitSeq     = 0;
 
     CDSRegRecPtr = CFE_ES_LocateCDSBlockRecordByID(Handle);
 
@@ -195,12 +355,13 @@ int32 CFE_ES_CDSBlockWrite(CFE_ES_CDSHandle_t Handle, const void *DataToWrite)
          * internal descriptor, and validates the descriptor as part of the operation.
          * This should always agree with the size in the registry for this block.
          */
-        Status = CFE_ES_GenPoolGetBlockSize(&CDS->Pool, &BlockSize, CDSRegRecPtr->BlockOffset);
+        Status       = CFE_ES_GenPoolGetBlockSize(&CDS->Pool, &BlockSize, CDSRegRecPtr->BlockOffset);
+        UserDataSize = CFE_ES_CDSBlockRecordGetUserSize(CDSRegRecPtr);
         if (Status != CFE_SUCCESS)
         {
             snprintf(LogMessage, sizeof(LogMessage), "Invalid Handle or Block Descriptor.\n");
         }
-        else if (BlockSize <= sizeof(CFE_ES_CDS_BlockHeader_t) || BlockSize != CDSRegRecPtr->BlockSize)
+        else if (UserDataSize == 0 || BlockSize != CDSRegRecPtr->BlockSize)
         {
             snprintf(LogMessage, sizeof(LogMessage), "Block size %lu invalid, expected %lu\n", (unsigned long)BlockSize,
                      (unsigned long)CDSRegRecPtr->BlockSize);
@@ -208,34 +369,86 @@ int32 CFE_ES_CDSBlockWrite(CFE_ES_CDSHandle_t Handle, const void *DataToWrite)
         }
         else
         {
-            UserDataSize = CDSRegRecPtr->BlockSize;
-            UserDataSize -= sizeof(CFE_ES_CDS_BlockHeader_t);
-            UserDataOffset = CDSRegRecPtr->BlockOffset;
-            UserDataOffset += sizeof(CFE_ES_CDS_BlockHeader_t);
-
-            CDS->Cache.Data.BlockHeader.Crc =
-                CFE_ES_CalculateCRC(DataToWrite, UserDataSize, 0, CFE_MISSION_ES_DEFAULT_CRC);
-            CDS->Cache.Offset = CDSRegRecPtr->BlockOffset;
-            CDS->Cache.Size   = sizeof(CFE_ES_CDS_BlockHeader_t);
-
-            /* Write the new block descriptor for the data coming from the Application */
-            Status = CFE_ES_CDS_CacheFlush(&CDS->Cache);
-            if (Status != CFE_SUCCESS)
+            NumChunks   = CFE_ES_CDSChunkCount(UserDataSize);
+            TableOffset = CDSRegRecPtr->BlockOffset;
+            TableOffset += sizeof(CFE_ES_CDS_BlockHeader_t);
+            UserDataOffset = TableOffset;
+            UserDataOffset += NumChunks * sizeof(uint32);
+
+            if (Ranges == NULL)
             {
-                snprintf(LogMessage, sizeof(LogMessage),
-                         "Err writing header data to CDS (Stat=0x%08x) @Offset=0x%08lx\n",
-                         (unsigned int)CDS->Cache.AccessStatus, (unsigned long)CDSRegRecPtr->BlockOffset);
+                /* A full write is just a single range covering the entire block */
+                FullRange.Offset = 0;
+                FullRange.Size   = UserDataSize;
+                Ranges           = &FullRange;
+                NumRanges        = 1;
             }
-            else
+
+            for (i = 0; i < NumRanges; ++i)
             {
-                PspStatus = CFE_PSP_WriteToCDS(DataToWrite, UserDataOffset, UserDataSize);
-                if (PspStatus != CFE_PSP_SUCCESS)
+                if (Ranges[i].Size == 0 || Ranges[i].Offset >= UserDataSize ||
+                    Ranges[i].Size > (UserDataSize - Ranges[i].Offset))
+                {
+                    snprintf(LogMessage, sizeof(LogMessage), "Range %lu+%lu outside of block size %lu\n",
+                             (unsigned long)Ranges[i].Offset, (unsigned long)Ranges[i].Size,
+                             (unsigned long)UserDataSize);
+                    Status = CFE_ES_BAD_ARGUMENT;
+                    break;
+                }
+            }
+
+            /* Open the update by making the commit marker odd */
+            if (Status == CFE_SUCCESS)
+            {
+                Status = CFE_ES_CDS_CacheFetch(&CDS->Cache, CDSRegRecPtr->BlockOffset, sizeof(CFE_ES_CDS_BlockHeader_t));
+                if (Status == CFE_SUCCESS)
+                {
+                    CommitSeq                             = CDS->Cache.Data.BlockHeader.CommitSeq | 1;
+                    CDS->Cache.Data.BlockHeader.CommitSeq = CommitSeq;
+                    Status                                = CFE_ES_CDS_CacheFlush(&CDS->Cache);
+                }
+
+                if (Status != CFE_SUCCESS)
                 {
                     snprintf(LogMessage, sizeof(LogMessage),
-                             "Err writing user data to CDS (Stat=0x%08x) @Offset=0x%08lx\n", (unsigned int)PspStatus,
+                             "Err writing header data to CDS (Stat=0x%08x) @Offset=0x%08lx\n",
+                             (unsigned int)CDS->Cache.AccessStatus, (unsigned long)CDSRegRecPtr->BlockOffset);
+                }
+            }
+
+            /* Copy and re-checksum only the chunks that overlap a modified range */
+            for (i = 0; Status == CFE_SUCCESS && i < NumRanges; ++i)
+            {
+                FirstChunk = Ranges[i].Offset / CFE_PLATFORM_ES_CDS_CHUNK_SIZE;
+                LastChunk  = (Ranges[i].Offset + Ranges[i].Size - 1) / CFE_PLATFORM_ES_CDS_CHUNK_SIZE;
+
+                Status = CFE_ES_CDS_WriteChunkRun(TableOffset, UserDataOffset, DataToWrite, UserDataSize, FirstChunk,
+                                                  LastChunk);
+                if (Status != CFE_SUCCESS)
+                {
+                    snprintf(LogMessage, sizeof(LogMessage), "Err writing user data to CDS @Offset=0x%08lx\n",
                              (unsigned long)UserDataOffset);
+                }
+            }
+
+            /* Close the update by storing the new table CRC with an even commit marker */
+            if (Status == CFE_SUCCESS)
+            {
+                Status = CFE_ES_CDS_ComputeChunkTableCrc(TableOffset, NumChunks, NULL, 0, &TableCrc);
+                if (Status == CFE_SUCCESS)
+                {
+                    CDS->Cache.Data.BlockHeader.Crc       = TableCrc;
+                    CDS->Cache.Data.BlockHeader.CommitSeq = CommitSeq + 1;
+                    CDS->Cache.Offset                     = CDSRegRecPtr->BlockOffset;
+                    CDS->Cache.Size                       = sizeof(CFE_ES_CDS_BlockHeader_t);
 
-                    Status = CFE_ES_CDS_ACCESS_ERROR;
+                    Status = CFE_ES_CDS_CacheFlush(&CDS->Cache);
+                }
+
+                if (Status != CFE_SUCCESS)
+                {
+                    snprintf(LogMessage, sizeof(LogMessage), "Err committing CDS block update @Offset=0x%08lx\n",
+                             (unsigned long)CDSRegRecPtr->BlockOffset);
                 }
             }
         }
@@ -267,10 +480,12 @@ int32 CFE_ES_CDSBlockRead(void *DataRead, CFE_ES_CDSHandle_t Handle)
     CFE_ES_CDS_Instance_t *CDS = &CFE_ES_Global.CDSVars;
     int32                  Status;
     int32                  PspStatus;
-    uint32                 CrcOfCDSData;
+    uint32                 TableCrc;
     size_t                 BlockSize;
     size_t                 UserDataSize;
     size_t                 UserDataOffset;
+    size_t                 TableOffset;
+    size_t                 NumChunks;
     CFE_ES_CDS_RegRec_t *  CDSRegRecPtr;
 
     CDSRegRecPtr = CFE_ES_LocateCDSBlockRecordByID(Handle);
@@ -291,16 +506,18 @@ int32 CFE_ES_CDSBlockRead(void *DataRead, CFE_ES_CDSHandle_t Handle)
         Status = CFE_ES_GenPoolGetBlockSize(&CDS->Pool, &BlockSize, CDSRegRecPtr->BlockOffset);
         if (Status == CFE_SUCCESS)
         {
-            if (BlockSize <= sizeof(CFE_ES_CDS_BlockHeader_t) || BlockSize != CDSRegRecPtr->BlockSize)
+            UserDataSize = CFE_ES_CDSBlockRecordGetUserSize(CDSRegRecPtr);
+            if (UserDataSize == 0 || BlockSize != CDSRegRecPtr->BlockSize)
             {
                 Status = CFE_ES_CDS_INVALID_SIZE;
             }
             else
             {
-                UserDataSize = CDSRegRecPtr->BlockSize;
-                UserDataSize -= sizeof(CFE_ES_CDS_BlockHeader_t);
-                UserDataOffset = CDSRegRecPtr->BlockOffset;
-                UserDataOffset += sizeof(CFE_ES_CDS_BlockHeader_t);
+                NumChunks   = CFE_ES_CDSChunkCount(UserDataSize);
+                TableOffset = CDSRegRecPtr->BlockOffset;
+                TableOffset += sizeof(CFE_ES_CDS_BlockHeader_t);
+                UserDataOffset = TableOffset;
+                UserDataOffset += NumChunks * sizeof(uint32);
 
                 /* Read the header */
                 Status =
@@ -312,18 +529,19 @@ int32 CFE_ES_CDSBlockRead(void *DataRead, CFE_ES_CDSHandle_t Handle)
                     PspStatus = CFE_PSP_ReadFromCDS(DataRead, UserDataOffset, UserDataSize);
                     if (PspStatus == CFE_PSP_SUCCESS)
                     {
-                        /* Compute the CRC for the data read from the CDS and determine if the data is still valid */
-                        CrcOfCDSData = CFE_ES_CalculateCRC(DataRead, UserDataSize, 0, CFE_MISSION_ES_DEFAULT_CRC);
-
-                        /* If the CRCs do not match, report an error */
-                        if (CrcOfCDSData != CDS->Cache.Data.BlockHeader.Crc)
+                        /* Verify every chunk against its CRC, and the CRC table against the header */
+                        Status = CFE_ES_CDS_ComputeChunkTableCrc(TableOffset, NumChunks, DataRead, UserDataSize,
+                                                                 &TableCrc);
+
+                        /*
+                         * If the CRCs do not match, or the last update was never committed
+                         * (i.e. it was interrupted by a reset), report an error
+                         */
+                        if (Status == CFE_SUCCESS && (TableCrc != CDS->Cache.Data.BlockHeader.Crc ||
+                                                      (CDS->Cache.Data.BlockHeader.CommitSeq & 1) != 0))
                         {
                             Status = CFE_ES_CDS_BLOCK_CRC_ERR;
                         }
-                        else
-                        {
-                            Status = CFE_SUCCESS;
-                        }
                     }
                     else
                     {
@@ -44,6 +44,12 @@
 */
 #define CFE_ES_CDS_NUM_BLOCK_SIZES 17
 
+/*
+ * Number of per-chunk CRC table entries processed at a time when
+ * reading or writing the CRC table of a CDS block
+ */
+#define CFE_ES_CDS_CHUNK_CRC_BATCH 16
+
 /*****************************************************************************/
 /*
 ** Function prototypes
@@ -85,6 +91,36 @@ int32 CFE_ES_RebuildCDSPool(size_t CDSPoolSize, size_t StartOffset);
  */
 int32 CFE_ES_CDSBlockWrite(CFE_ES_CDSHandle_t Handle, const void *DataToWrite);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Writes the modified ranges of a block of data to CDS
+ *
+ * Only the chunks overlapping one of the given ranges are copied and have
+ * their CRC recomputed.  If Ranges is NULL the entire block is written.
+ *
+ * The update is bracketed by the commit marker in the block header, so an
+ * update interrupted by a reset is detected by CFE_ES_CDSBlockRead().
+ */
+int32 CFE_ES_CDSBlockWriteRanges(CFE_ES_CDSHandle_t Handle, const void *DataToWrite, const CFE_ES_CDSRange_t *Ranges,
+                                 uint32 NumRanges);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Writes a run of chunks of user data, and their CRC table entries, to CDS
+ */
+int32 CFE_ES_CDS_WriteChunkRun(size_t TableOffset, size_t UserDataOffset, const void *UserData, size_t UserDataSize,
+                               size_t FirstChunk, size_t LastChunk);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Computes the CRC of the per-chunk CRC table of a CDS block
+ *
+ * If UserData is not NULL, each chunk of user data is also checked against
+ * its entry in the table, and #CFE_ES_CDS_BLOCK_CRC_ERR is returned on mismatch.
+ */
+int32 CFE_ES_CDS_ComputeChunkTableCrc(size_t TableOffset, size_t NumChunks, const void *UserData, size_t UserDataSize,
+                                      uint32 *TableCrcPtr);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Reads a block of data from CDS
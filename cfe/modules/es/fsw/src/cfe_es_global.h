@@ -117,6 +117,13 @@ typedef struct
     */
     CFE_ES_MemStatsTlm_t MemStatsPacket;
 
+    /*
+    ** Application resource usage telemetry, and the state of its sample period
+    */
+    CFE_ES_AppResourceTlm_t AppResourcePacket;
+    uint32                  AppResourceHkCount;
+    OS_time_t               AppResourcePeriodStart;
+
     /*
     ** ES Task operational data (not reported in housekeeping)
     */
@@ -163,6 +170,7 @@ typedef struct
     uint32             RegisteredExternalApps;
     CFE_ResourceId_t   LastAppId;
     CFE_ES_AppRecord_t AppTable[CFE_PLATFORM_ES_MAX_APPLICATIONS];
+    uint32             AppNameIndex[CFE_RESOURCEID_NAMEINDEX_BUCKETS(CFE_PLATFORM_ES_MAX_APPLICATIONS)];
 
     /*
     ** ES Shared Library Table
@@ -205,11 +213,26 @@ typedef struct
      */
     CFE_ES_PerfDumpGlobal_t BackgroundPerfDumpState;
 
+    /*
+     * Persistent state data associated with performance log streaming
+     */
+    CFE_ES_PerfStreamGlobal_t BackgroundPerfStreamState;
+
     /*
      * Persistent state data associated with background app table scans
      */
     CFE_ES_AppTableScanState_t BackgroundAppScanState;
 
+    /*
+     * Startup script entries held by the parallel startup loader
+     */
+    CFE_ES_StartupQueue_t StartupQueue;
+
+    /*
+     * Persistent state data associated with state snapshot requests
+     */
+    CFE_ES_SnapshotState_t SnapshotState;
+
     /*
      * Task global data (formerly a separate global).
      */
@@ -43,6 +43,7 @@
 #include "cfe_es_cds.h"
 #include "cfe_es_crc.h"
 #include "cfe_es_perf.h"
+#include "cfe_es_snapshot.h"
 #include "cfe_es_generic_pool.h"
 #include "cfe_es_mempool.h"
 #include "cfe_es_global.h"
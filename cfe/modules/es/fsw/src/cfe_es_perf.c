@@ -29,6 +29,7 @@
 */
 #include "cfe_es_module_all.h"
 
+#include <stdio.h>
 #include <string.h>
 
 /*----------------------------------------------------------------
@@ -141,8 +142,9 @@ uint32 CFE_ES_GetPerfLogDumpRemaining(void)
  *-----------------------------------------------------------------*/
 int32 CFE_ES_StartPerfDataCmd(const CFE_ES_StartPerfDataCmd_t *data)
 {
-    const CFE_ES_StartPerfCmd_Payload_t *CmdPtr        = &data->Payload;
-    CFE_ES_PerfDumpGlobal_t *            PerfDumpState = &CFE_ES_Global.BackgroundPerfDumpState;
+    const CFE_ES_StartPerfCmd_Payload_t *CmdPtr          = &data->Payload;
+    CFE_ES_PerfDumpGlobal_t *            PerfDumpState   = &CFE_ES_Global.BackgroundPerfDumpState;
+    CFE_ES_PerfStreamGlobal_t *          PerfStreamState = &CFE_ES_Global.BackgroundPerfStreamState;
     CFE_ES_PerfData_t *                  Perf;
 
     /*
@@ -152,10 +154,10 @@ int32 CFE_ES_StartPerfDataCmd(const CFE_ES_StartPerfDataCmd_t *data)
 
     /* Ensure there is no file write in progress before proceeding */
     if (PerfDumpState->CurrentState == CFE_ES_PerfDumpState_IDLE &&
-        PerfDumpState->PendingState == CFE_ES_PerfDumpState_IDLE)
+        PerfDumpState->PendingState == CFE_ES_PerfDumpState_IDLE && !OS_ObjectIdDefined(PerfStreamState->FileDesc))
     {
         /* Make sure Trigger Mode is valid */
-        if (CmdPtr->TriggerMode <= CFE_ES_PerfTrigger_END)
+        if (CmdPtr->TriggerMode <= CFE_ES_PerfTrigger_STREAM)
         {
             CFE_ES_Global.TaskData.CommandCounter++;
 
@@ -168,9 +170,25 @@ int32 CFE_ES_StartPerfDataCmd(const CFE_ES_StartPerfDataCmd_t *data)
             Perf->MetaData.DataEnd               = 0;
             Perf->MetaData.DataCount             = 0;
             Perf->MetaData.InvalidMarkerReported = false;
-            Perf->MetaData.State                 = CFE_ES_PERF_WAITING_FOR_TRIGGER; /* this must be done last */
+
+            /* Streaming always starts over with empty buffers and the first file of the set */
+            PerfStreamState->Buffer[0].Count = 0;
+            PerfStreamState->Buffer[1].Count = 0;
+            PerfStreamState->FillIdx         = 0;
+            PerfStreamState->DroppedEntries  = 0;
+            PerfStreamState->FileIndex       = 0;
+            PerfStreamState->FileEntries     = 0;
+            PerfStreamState->FileCount       = 0;
+            PerfStreamState->TotalEntries    = 0;
+            PerfStreamState->Failed          = false;
+            Perf->MetaData.State             = CFE_ES_PERF_WAITING_FOR_TRIGGER; /* this must be done last */
             OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
 
+            if (CmdPtr->TriggerMode == CFE_ES_PerfTrigger_STREAM)
+            {
+                CFE_ES_BackgroundWakeup();
+            }
+
             CFE_EVS_SendEvent(CFE_ES_PERF_STARTCMD_EID, CFE_EVS_EventType_DEBUG,
                               "Start collecting performance data cmd received, trigger mode = %d",
                               (int)CmdPtr->TriggerMode);
@@ -180,7 +198,7 @@ int32 CFE_ES_StartPerfDataCmd(const CFE_ES_StartPerfDataCmd_t *data)
             CFE_ES_Global.TaskData.CommandErrorCounter++;
             CFE_EVS_SendEvent(CFE_ES_PERF_STARTCMD_TRIG_ERR_EID, CFE_EVS_EventType_ERROR,
                               "Cannot start collecting performance data, trigger mode (%d) out of range (%d to %d)",
-                              (int)CmdPtr->TriggerMode, (int)CFE_ES_PerfTrigger_START, (int)CFE_ES_PerfTrigger_END);
+                              (int)CmdPtr->TriggerMode, (int)CFE_ES_PerfTrigger_START, (int)CFE_ES_PerfTrigger_STREAM);
         }
     }
     else
@@ -479,6 +497,240 @@ bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg)
     return (State->CurrentState != CFE_ES_PerfDumpState_IDLE);
 }
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper: write the file header and metadata of a stream file
+ *
+ * The header is written again when the file is closed, with the entry
+ * counts filled in, so the result has the same format as a log dump.
+ *
+ *-----------------------------------------------------------------*/
+static bool CFE_ES_PerfStreamWriteHeader(CFE_ES_PerfStreamGlobal_t *State)
+{
+    CFE_FS_Header_t       FileHdr;
+    CFE_ES_PerfMetaData_t MetaData;
+    int32                 Status;
+
+    MetaData           = CFE_ES_Global.ResetDataPtr->Perf.MetaData;
+    MetaData.DataStart = 0;
+    MetaData.DataEnd   = State->FileEntries;
+    MetaData.DataCount = State->FileEntries;
+
+    CFE_FS_InitHeader(&FileHdr, CFE_ES_PERF_LOG_DESC, CFE_FS_SubType_ES_PERFDATA);
+    FileHdr.Length = sizeof(CFE_ES_PerfMetaData_t) + (State->FileEntries * sizeof(CFE_ES_PerfDataEntry_t));
+
+    Status = CFE_FS_WriteHeader(State->FileDesc, &FileHdr);
+    if (Status != sizeof(CFE_FS_Header_t))
+    {
+        CFE_ES_FileWriteByteCntErr(State->FileName, sizeof(CFE_FS_Header_t), Status);
+        return false;
+    }
+
+    Status = OS_write(State->FileDesc, &MetaData, sizeof(MetaData));
+    if (Status != sizeof(MetaData))
+    {
+        CFE_ES_FileWriteByteCntErr(State->FileName, sizeof(MetaData), Status);
+        return false;
+    }
+
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper: finalize and close the current stream file
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_ES_PerfStreamCloseFile(CFE_ES_PerfStreamGlobal_t *State)
+{
+    if (OS_lseek(State->FileDesc, 0, OS_SEEK_SET) != 0 || !CFE_ES_PerfStreamWriteHeader(State))
+    {
+        CFE_EVS_SendEvent(CFE_ES_PERF_STREAM_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Error finalizing perf stream file %s", State->FileName);
+    }
+
+    OS_close(State->FileDesc);
+    State->FileDesc = OS_OBJECT_ID_UNDEFINED;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper: create the next file of the rotating set
+ *
+ *-----------------------------------------------------------------*/
+static bool CFE_ES_PerfStreamOpenFile(CFE_ES_PerfStreamGlobal_t *State)
+{
+    int32 OsStatus;
+
+    snprintf(State->FileName, sizeof(State->FileName), "%s_%u.dat", CFE_PLATFORM_ES_PERF_STREAM_FILE_PREFIX,
+             (unsigned int)State->FileIndex);
+
+    OsStatus = OS_OpenCreate(&State->FileDesc, State->FileName, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE,
+                             OS_WRITE_ONLY);
+    if (OsStatus != OS_SUCCESS)
+    {
+        State->FileDesc = OS_OBJECT_ID_UNDEFINED;
+        CFE_EVS_SendEvent(CFE_ES_PERF_STREAM_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Error creating perf stream file %s, RC = %ld", State->FileName, (long)OsStatus);
+        return false;
+    }
+
+    State->FileEntries = 0;
+    ++State->FileCount;
+
+    if (!CFE_ES_PerfStreamWriteHeader(State))
+    {
+        OS_close(State->FileDesc);
+        State->FileDesc = OS_OBJECT_ID_UNDEFINED;
+        return false;
+    }
+
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper: write a drained stream buffer to the file set
+ *
+ *-----------------------------------------------------------------*/
+static bool CFE_ES_PerfStreamWriteBuffer(CFE_ES_PerfStreamGlobal_t *State, const CFE_ES_PerfStreamBuffer_t *BufPtr)
+{
+    uint32 Written;
+    uint32 Chunk;
+    size_t BlockSize;
+    int32  OsStatus;
+
+    Written = 0;
+    while (Written < BufPtr->Count)
+    {
+        /* Move on to the next file of the set once the current one is full */
+        if (State->FileEntries >= CFE_PLATFORM_ES_PERF_STREAM_FILE_ENTRIES)
+        {
+            CFE_ES_PerfStreamCloseFile(State);
+            State->FileIndex = (State->FileIndex + 1) % CFE_PLATFORM_ES_PERF_STREAM_MAX_FILES;
+            if (!CFE_ES_PerfStreamOpenFile(State))
+            {
+                return false;
+            }
+        }
+
+        Chunk = BufPtr->Count - Written;
+        if (Chunk > CFE_PLATFORM_ES_PERF_STREAM_FILE_ENTRIES - State->FileEntries)
+        {
+            Chunk = CFE_PLATFORM_ES_PERF_STREAM_FILE_ENTRIES - State->FileEntries;
+        }
+
+        BlockSize = Chunk * sizeof(CFE_ES_PerfDataEntry_t);
+        OsStatus  = OS_write(State->FileDesc, &BufPtr->Entries[Written], BlockSize);
+        if (OsStatus != BlockSize)
+        {
+            CFE_ES_FileWriteByteCntErr(State->FileName, BlockSize, OsStatus);
+            return false;
+        }
+
+        Written += Chunk;
+        State->FileEntries += Chunk;
+        State->TotalEntries += Chunk;
+    }
+
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_RunPerfLogStream(uint32 ElapsedTime, void *Arg)
+{
+    CFE_ES_PerfStreamGlobal_t *State = (CFE_ES_PerfStreamGlobal_t *)Arg;
+    CFE_ES_PerfStreamBuffer_t *BufPtr;
+    CFE_ES_PerfData_t *        Perf;
+    bool                       Streaming;
+    uint32                     DrainIdx;
+
+    /*
+    ** Set the pointer to the data area
+    */
+    Perf = &CFE_ES_Global.ResetDataPtr->Perf;
+
+    Streaming = (Perf->MetaData.Mode == CFE_ES_PerfTrigger_STREAM && Perf->MetaData.State != CFE_ES_PERF_IDLE);
+
+    if (!Streaming && !OS_ObjectIdDefined(State->FileDesc))
+    {
+        return false;
+    }
+
+    /* A log dump holds the perf data mutex across calls, flush after it is finished */
+    if (CFE_ES_Global.BackgroundPerfDumpState.CurrentState != CFE_ES_PerfDumpState_IDLE)
+    {
+        return true;
+    }
+
+    if (!OS_ObjectIdDefined(State->FileDesc) && !State->Failed)
+    {
+        State->Failed = !CFE_ES_PerfStreamOpenFile(State);
+    }
+
+    /*
+     * Select the buffer to write.  If the other buffer is empty, take over the one
+     * being filled even if it is only partially filled, so that the file does not
+     * lag behind by more than one background period.
+     */
+    OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
+    DrainIdx = 1 - State->FillIdx;
+    if (State->Buffer[DrainIdx].Count == 0 && State->Buffer[State->FillIdx].Count != 0)
+    {
+        State->FillIdx = DrainIdx;
+        DrainIdx       = 1 - DrainIdx;
+    }
+    OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
+
+    BufPtr = &State->Buffer[DrainIdx];
+    if (BufPtr->Count != 0)
+    {
+        if (!State->Failed && !CFE_ES_PerfStreamWriteBuffer(State, BufPtr))
+        {
+            CFE_EVS_SendEvent(CFE_ES_PERF_STREAM_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Perf stream to %s failed, discarding further entries", State->FileName);
+            if (OS_ObjectIdDefined(State->FileDesc))
+            {
+                CFE_ES_PerfStreamCloseFile(State);
+            }
+            State->Failed = true;
+        }
+
+        OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
+        if (State->Failed)
+        {
+            State->DroppedEntries += BufPtr->Count;
+        }
+        BufPtr->Count = 0;
+        OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
+    }
+
+    /*
+     * Once stopped, producers no longer add entries; the job continues
+     * until both buffers are written, then finalizes the last file.
+     */
+    if (!Streaming && State->Buffer[0].Count == 0 && State->Buffer[1].Count == 0)
+    {
+        if (OS_ObjectIdDefined(State->FileDesc))
+        {
+            CFE_ES_PerfStreamCloseFile(State);
+        }
+
+        CFE_EVS_SendEvent(CFE_ES_PERF_STREAM_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "Perf stream stopped: %lu entries written to %lu files, %lu dropped",
+                          (unsigned long)State->TotalEntries, (unsigned long)State->FileCount,
+                          (unsigned long)State->DroppedEntries);
+        return false;
+    }
+
+    return true;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -555,6 +807,42 @@ int32 CFE_ES_SetPerfTriggerMaskCmd(const CFE_ES_SetPerfTriggerMaskCmd_t *data)
     return CFE_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper: append an entry to the stream buffers
+ *
+ * Called with the perf data mutex held.  Never waits for the background
+ * task; if both buffers are full the entry is dropped and counted.
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_ES_PerfStreamAppend(CFE_ES_PerfStreamGlobal_t *State, const CFE_ES_PerfDataEntry_t *EntryPtr)
+{
+    CFE_ES_PerfStreamBuffer_t *BufPtr;
+
+    BufPtr = &State->Buffer[State->FillIdx];
+    if (BufPtr->Count >= CFE_PLATFORM_ES_PERF_STREAM_BUFFER_SIZE)
+    {
+        /* Switch buffers only once the background task has written the other one */
+        if (State->Buffer[1 - State->FillIdx].Count != 0)
+        {
+            ++State->DroppedEntries;
+            return;
+        }
+
+        State->FillIdx = 1 - State->FillIdx;
+        BufPtr         = &State->Buffer[State->FillIdx];
+    }
+
+    BufPtr->Entries[BufPtr->Count] = *EntryPtr;
+    ++BufPtr->Count;
+
+    /* Hand a full buffer over without waiting for the next background period */
+    if (BufPtr->Count == CFE_PLATFORM_ES_PERF_STREAM_BUFFER_SIZE)
+    {
+        CFE_ES_BackgroundWakeup();
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Implemented per public API
@@ -651,6 +939,12 @@ void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
             Perf->MetaData.DataStart = Perf->MetaData.DataEnd;
         }
 
+        /* streaming mode also hands every entry to the background task */
+        if (Perf->MetaData.Mode == CFE_ES_PerfTrigger_STREAM)
+        {
+            CFE_ES_PerfStreamAppend(&CFE_ES_Global.BackgroundPerfStreamState, &EntryData);
+        }
+
         /* waiting for trigger */
         if (Perf->MetaData.State == CFE_ES_PERF_WAITING_FOR_TRIGGER)
         {
@@ -36,6 +36,7 @@
 #include "common_types.h"
 #include "osconfig.h"
 #include "cfe_es_api_typedefs.h"
+#include "cfe_es_perfdata_typedef.h"
 
 /*
 **  Defines
@@ -110,6 +111,46 @@ typedef struct
     size_t    FileSize;                      /* Total file size, for progress reporting in telemetry */
 } CFE_ES_PerfDumpGlobal_t;
 
+/**
+ * @brief One of the two buffers used by the streaming mode
+ */
+typedef struct
+{
+    CFE_ES_PerfDataEntry_t Entries[CFE_PLATFORM_ES_PERF_STREAM_BUFFER_SIZE];
+    uint32                 Count; /* number of valid entries, the buffer is full when this reaches the size */
+} CFE_ES_PerfStreamBuffer_t;
+
+/**
+ * @brief Performance log streaming state structure
+ *
+ * In the streaming mode, producers (CFE_ES_PerfLogAdd) append entries to
+ * Buffer[FillIdx] while holding the perf data mutex.  When that buffer is full
+ * they switch to the other one if the background task has already drained it,
+ * otherwise the entry is dropped and counted.  Producers therefore never wait
+ * for the file I/O.
+ *
+ * The background task writes the buffer that is not being filled without
+ * holding the mutex, and takes it only to swap or release a buffer.  A buffer
+ * with a nonzero count is never switched to by producers, so it cannot change
+ * while it is being written.
+ *
+ * The file related members are owned by the background task.
+ */
+typedef struct
+{
+    CFE_ES_PerfStreamBuffer_t Buffer[2];
+    uint32                    FillIdx;        /* buffer the producers append to */
+    uint32                    DroppedEntries; /* entries lost because both buffers were full */
+
+    osal_id_t FileDesc;                  /* file being written, or undefined */
+    char      FileName[OS_MAX_PATH_LEN]; /* name of the file being written */
+    uint32    FileIndex;                 /* index of the file within the rotating set */
+    uint32    FileEntries;               /* entries written to the current file */
+    uint32    FileCount;                 /* number of files opened since streaming started */
+    uint32    TotalEntries;              /* entries written since streaming started */
+    bool      Failed;                    /* a file error occurred, data is discarded until restarted */
+} CFE_ES_PerfStreamGlobal_t;
+
 /**
  * @brief Helper function to obtain the progress/remaining items from
  * the background task that is writing the performance log data
@@ -137,6 +178,20 @@ uint32 CFE_ES_GetPerfLogDumpRemaining(void);
  */
 bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Stream performance data to the rotating file set
+ *
+ * Implementation of the background job for the #CFE_ES_PerfTrigger_STREAM
+ * mode.  Each call writes at most one of the two stream buffers to the
+ * current file, moving on to the next file of the set when it is full.
+ *
+ * Once the collection is stopped, the remaining entries are flushed and
+ * the last file is closed.  This is deferred while a log dump is in
+ * progress, because the dump holds the perf data mutex.
+ */
+bool CFE_ES_RunPerfLogStream(uint32 ElapsedTime, void *Arg);
+
 /** @} */
 
 #endif /* CFE_ES_PERF_H */
@@ -37,6 +37,25 @@
 #include <string.h>
 #include <stdlib.h>
 
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Name match function for the application name index
+ *
+ *-----------------------------------------------------------------*/
+static bool CFE_ES_AppNameMatch(uint32 Idx, const char *Name)
+{
+    CFE_ES_AppRecord_t *AppRecPtr = &CFE_ES_Global.AppTable[Idx];
+
+    return (CFE_ES_AppRecordIsUsed(AppRecPtr) && strcmp(Name, CFE_ES_AppRecordGetName(AppRecPtr)) == 0);
+}
+
+static const CFE_ResourceId_NameIndex_t CFE_ES_AppNameIndex = {
+    .Buckets    = CFE_ES_Global.AppNameIndex,
+    .NumBuckets = CFE_RESOURCEID_NAMEINDEX_BUCKETS(CFE_PLATFORM_ES_MAX_APPLICATIONS),
+    .TableSize  = CFE_PLATFORM_ES_MAX_APPLICATIONS,
+    .MatchFunc  = CFE_ES_AppNameMatch};
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -79,31 +98,41 @@ CFE_ES_TaskId_t CFE_ES_TaskId_FromOSAL(osal_id_t id)
  *-----------------------------------------------------------------*/
 CFE_ES_AppRecord_t *CFE_ES_LocateAppRecordByName(const char *Name)
 {
-    CFE_ES_AppRecord_t *AppRecPtr;
-    uint32              Count;
+    uint32 Idx;
 
     /*
-    ** Search the Application table for an app with a matching name.
+    ** Look up the app with a matching name in the application name index.
     */
-    AppRecPtr = CFE_ES_Global.AppTable;
-    Count     = CFE_PLATFORM_ES_MAX_APPLICATIONS;
-    while (true)
+    if (CFE_ResourceId_NameIndexFind(&CFE_ES_AppNameIndex, Name, &Idx) != CFE_SUCCESS)
     {
-        if (Count == 0)
-        {
-            AppRecPtr = NULL;
-            break;
-        }
-        if (CFE_ES_AppRecordIsUsed(AppRecPtr) && strcmp(Name, CFE_ES_AppRecordGetName(AppRecPtr)) == 0)
-        {
-            break;
-        }
-
-        ++AppRecPtr;
-        --Count;
+        return NULL;
     }
 
-    return AppRecPtr;
+    return &CFE_ES_Global.AppTable[Idx];
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_AppRecordAddName(CFE_ES_AppRecord_t *AppRecPtr)
+{
+    CFE_ResourceId_NameIndexAdd(&CFE_ES_AppNameIndex, CFE_ES_AppRecordGetName(AppRecPtr),
+                                AppRecPtr - CFE_ES_Global.AppTable);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_AppRecordRemoveName(CFE_ES_AppRecord_t *AppRecPtr)
+{
+    CFE_ResourceId_NameIndexRemove(&CFE_ES_AppNameIndex, CFE_ES_AppRecordGetName(AppRecPtr),
+                                   AppRecPtr - CFE_ES_Global.AppTable);
 }
 
 /*----------------------------------------------------------------
@@ -744,6 +744,28 @@ CFE_ES_TaskId_t CFE_ES_TaskId_FromOSAL(osal_id_t id);
  */
 CFE_ES_AppRecord_t *CFE_ES_LocateAppRecordByName(const char *Name);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Adds an application table record to the application name index
+ *
+ * Must be called after the name has been stored in the record.
+ * Must be called while locked.
+ *
+ * @param[in]  AppRecPtr  the application record
+ */
+void CFE_ES_AppRecordAddName(CFE_ES_AppRecord_t *AppRecPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Removes an application table record from the application name index
+ *
+ * Must be called before the record is freed or cleared.
+ * Must be called while locked.
+ *
+ * @param[in]  AppRecPtr  the application record
+ */
+void CFE_ES_AppRecordRemoveName(CFE_ES_AppRecord_t *AppRecPtr);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Finds a library table record matching the given name
@@ -0,0 +1,656 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** File: cfe_es_snapshot.c
+**
+** Purpose: This file contains the functions that write the reset area,
+**          Critical Data Store and table buffers to a snapshot file, and
+**          restore them from that file during a power-on start.
+**
+*/
+
+/*
+** Include Section
+*/
+#include <stdio.h>
+#include <string.h>
+
+#include "cfe_es_module_all.h"
+#include "cfe_tbl_core_internal.h"
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Rounds a file offset up to the next page boundary
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CFE_ES_SnapshotPageAlign(uint32 Offset)
+{
+    return (Offset + CFE_ES_SNAPSHOT_PAGE_SIZE - 1) & ~((uint32)CFE_ES_SNAPSHOT_PAGE_SIZE - 1);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Writes the reset area section and computes its CRC
+ *
+ *-----------------------------------------------------------------*/
+static int32 CFE_ES_SnapshotWriteResetArea(CFE_ES_SnapshotState_t *State, osal_id_t FileDesc,
+                                           CFE_ES_SnapshotSection_t *Section)
+{
+    int32   OsStatus;
+    int32   Status;
+    uint32  ResetAreaSize;
+    uint32  Pos;
+    uint32  BlockSize;
+    cpuaddr ResetAreaAddr;
+
+    Status = CFE_PSP_GetResetArea(&ResetAreaAddr, &ResetAreaSize);
+    if (Status != CFE_PSP_SUCCESS)
+    {
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+
+    Section->Type = CFE_ES_SnapshotSection_RESET_AREA;
+    Section->Size = ResetAreaSize;
+    Section->Crc  = 0;
+
+    Status = CFE_SUCCESS;
+    Pos    = 0;
+    while (Status == CFE_SUCCESS && Pos < Section->Size)
+    {
+        BlockSize = Section->Size - Pos;
+        if (BlockSize > sizeof(State->IoBuffer))
+        {
+            BlockSize = sizeof(State->IoBuffer);
+        }
+
+        /*
+         * Syslog and ER log writers hold the shared data lock while updating the
+         * reset area.  Only the copy is done under the lock, the file I/O is not,
+         * so other ES API callers are not held up by the file system.
+         */
+        CFE_ES_LockSharedData(__func__, __LINE__);
+        memcpy(State->IoBuffer, (const uint8 *)ResetAreaAddr + Pos, BlockSize);
+        CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+        Section->Crc = CFE_ES_CalculateCRC(State->IoBuffer, BlockSize, Section->Crc, CFE_MISSION_ES_DEFAULT_CRC);
+
+        OsStatus = OS_write(FileDesc, State->IoBuffer, BlockSize);
+        if (OsStatus != BlockSize)
+        {
+            Status = CFE_ES_FILE_IO_ERR;
+        }
+
+        Pos += BlockSize;
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Writes the CDS section one block at a time and computes its CRC
+ *
+ *-----------------------------------------------------------------*/
+static int32 CFE_ES_SnapshotWriteCDS(CFE_ES_SnapshotState_t *State, osal_id_t FileDesc,
+                                     CFE_ES_SnapshotSection_t *Section)
+{
+    int32  OsStatus;
+    int32  Status;
+    uint32 Pos;
+    uint32 BlockSize;
+
+    Section->Type = CFE_ES_SnapshotSection_CDS;
+    Section->Size = CFE_ES_Global.CDSVars.TotalSize;
+    Section->Crc  = 0;
+
+    Status = CFE_SUCCESS;
+    Pos    = 0;
+    while (Status == CFE_SUCCESS && Pos < Section->Size)
+    {
+        BlockSize = Section->Size - Pos;
+        if (BlockSize > sizeof(State->IoBuffer))
+        {
+            BlockSize = sizeof(State->IoBuffer);
+        }
+
+        CFE_ES_LockCDS();
+        Status = CFE_PSP_ReadFromCDS(State->IoBuffer, Pos, BlockSize);
+        CFE_ES_UnlockCDS();
+
+        if (Status != CFE_PSP_SUCCESS)
+        {
+            Status = CFE_ES_CDS_ACCESS_ERROR;
+            break;
+        }
+
+        Section->Crc = CFE_ES_CalculateCRC(State->IoBuffer, BlockSize, Section->Crc, CFE_MISSION_ES_DEFAULT_CRC);
+
+        OsStatus = OS_write(FileDesc, State->IoBuffer, BlockSize);
+        if (OsStatus != BlockSize)
+        {
+            Status = CFE_ES_FILE_IO_ERR;
+        }
+
+        Pos += BlockSize;
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Appends data to a section and updates its size and CRC
+ *
+ *-----------------------------------------------------------------*/
+static int32 CFE_ES_SnapshotAppend(osal_id_t FileDesc, CFE_ES_SnapshotSection_t *Section, const void *DataPtr,
+                                   uint32 DataSize)
+{
+    Section->Crc = CFE_ES_CalculateCRC(DataPtr, DataSize, Section->Crc, CFE_MISSION_ES_DEFAULT_CRC);
+    Section->Size += DataSize;
+
+    if (OS_write(FileDesc, DataPtr, DataSize) != DataSize)
+    {
+        return CFE_ES_FILE_IO_ERR;
+    }
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Writes the image of each loaded table and computes the section CRC
+ *
+ *-----------------------------------------------------------------*/
+static int32 CFE_ES_SnapshotWriteTables(osal_id_t FileDesc, CFE_ES_SnapshotSection_t *Section)
+{
+    CFE_ES_SnapshotTableHeader_t TblHeader;
+    const void *                 DataPtr;
+    uint32                       RecordNum;
+    bool                         IsEOF;
+    int32                        Status;
+
+    Section->Type = CFE_ES_SnapshotSection_TABLES;
+    Section->Size = 0;
+    Section->Crc  = 0;
+
+    Status = CFE_SUCCESS;
+    IsEOF  = false;
+    for (RecordNum = 0; Status == CFE_SUCCESS && !IsEOF; ++RecordNum)
+    {
+        IsEOF = CFE_TBL_SnapshotTableGetter(RecordNum, &TblHeader, &DataPtr);
+        if (DataPtr != NULL)
+        {
+            Status = CFE_ES_SnapshotAppend(FileDesc, Section, &TblHeader, sizeof(TblHeader));
+            if (Status == CFE_SUCCESS)
+            {
+                Status = CFE_ES_SnapshotAppend(FileDesc, Section, DataPtr, TblHeader.Size);
+            }
+        }
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_WriteSnapshotFile(CFE_ES_SnapshotState_t *State)
+{
+    CFE_FS_Header_t           FsHeader;
+    CFE_ES_SnapshotSection_t *Section;
+    osal_id_t                 FileDesc;
+    int32                     OsStatus;
+    int32                     Status;
+    uint32                    Offset;
+    uint32                    Type;
+    char                      TempFileName[OS_MAX_PATH_LEN];
+
+    memset(&State->Header, 0, sizeof(State->Header));
+    State->Header.Magic    = CFE_ES_SNAPSHOT_MAGIC;
+    State->Header.Version  = CFE_ES_SNAPSHOT_VERSION;
+    State->Header.PageSize = CFE_ES_SNAPSHOT_PAGE_SIZE;
+
+    /* The previous snapshot stays intact until the new one is complete */
+    if ((size_t)snprintf(TempFileName, sizeof(TempFileName), "%s%s", State->FileName, CFE_ES_SNAPSHOT_TEMP_SUFFIX) >=
+        sizeof(TempFileName))
+    {
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
+    OsStatus = OS_OpenCreate(&FileDesc, TempFileName, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_WRITE_ONLY);
+    if (OsStatus != OS_SUCCESS)
+    {
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+
+    CFE_FS_InitHeader(&FsHeader, "ES State Snapshot", CFE_FS_SubType_ES_SNAPSHOT);
+    Status = CFE_FS_WriteHeader(FileDesc, &FsHeader);
+    if (Status != sizeof(CFE_FS_Header_t))
+    {
+        Status = CFE_ES_FILE_IO_ERR;
+    }
+    else
+    {
+        Status = CFE_SUCCESS;
+    }
+
+    /*
+     * Each section starts on a page boundary after the headers.  The
+     * gaps are left as holes, which read back as zero.
+     */
+    Offset = sizeof(CFE_FS_Header_t) + sizeof(CFE_ES_SnapshotFileHeader_t);
+    for (Type = CFE_ES_SnapshotSection_RESET_AREA; Status == CFE_SUCCESS && Type <= CFE_ES_SnapshotSection_TABLES;
+         ++Type)
+    {
+        if (Type == CFE_ES_SnapshotSection_CDS && !CFE_ES_Global.CDSIsAvailable)
+        {
+            /* no CDS on this platform, there is nothing to save */
+            continue;
+        }
+
+        Section         = &State->Header.Sections[State->Header.NumSections];
+        Section->Offset = CFE_ES_SnapshotPageAlign(Offset);
+
+        if (OS_lseek(FileDesc, Section->Offset, OS_SEEK_SET) != Section->Offset)
+        {
+            Status = CFE_ES_FILE_IO_ERR;
+        }
+        else if (Type == CFE_ES_SnapshotSection_RESET_AREA)
+        {
+            Status = CFE_ES_SnapshotWriteResetArea(State, FileDesc, Section);
+        }
+        else if (Type == CFE_ES_SnapshotSection_CDS)
+        {
+            Status = CFE_ES_SnapshotWriteCDS(State, FileDesc, Section);
+        }
+        else
+        {
+            Status = CFE_ES_SnapshotWriteTables(FileDesc, Section);
+        }
+
+        Offset = Section->Offset + Section->Size;
+        ++State->Header.NumSections;
+    }
+
+    /* Now that the CRCs are known, fill in the snapshot header */
+    if (Status == CFE_SUCCESS)
+    {
+        if (OS_lseek(FileDesc, sizeof(CFE_FS_Header_t), OS_SEEK_SET) != sizeof(CFE_FS_Header_t))
+        {
+            Status = CFE_ES_FILE_IO_ERR;
+        }
+        else if (OS_write(FileDesc, &State->Header, sizeof(State->Header)) != sizeof(State->Header))
+        {
+            Status = CFE_ES_FILE_IO_ERR;
+        }
+    }
+
+    OS_close(FileDesc);
+
+    if (Status == CFE_SUCCESS && OS_rename(TempFileName, State->FileName) != OS_SUCCESS)
+    {
+        Status = CFE_ES_FILE_IO_ERR;
+    }
+
+    if (Status != CFE_SUCCESS)
+    {
+        OS_remove(TempFileName);
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_RunSnapshot(uint32 ElapsedTime, void *Arg)
+{
+    CFE_ES_SnapshotState_t *State = Arg;
+    CFE_ES_AppRecord_t *    AppRecPtr;
+    uint32                  i;
+    uint32                  RunningApps;
+    uint32                  ParkedApps;
+    int32                   Status;
+
+    if (!State->Pending)
+    {
+        return false;
+    }
+
+    State->WaitTime += ElapsedTime;
+
+    RunningApps = 0;
+    AppRecPtr   = CFE_ES_Global.AppTable;
+
+    CFE_ES_LockSharedData(__func__, __LINE__);
+    for (i = 0; i < CFE_PLATFORM_ES_MAX_APPLICATIONS; ++i)
+    {
+        if (CFE_ES_AppRecordIsUsed(AppRecPtr) && AppRecPtr->Type == CFE_ES_AppType_EXTERNAL &&
+            AppRecPtr->AppState == CFE_ES_AppState_RUNNING)
+        {
+            ++RunningApps;
+        }
+        ++AppRecPtr;
+    }
+    ParkedApps = State->ParkedApps;
+    CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+    /*
+     * Apps only park when they next call CFE_ES_RunLoop(), so an app that is
+     * blocked waiting on a message may never arrive.  Proceed after the timeout.
+     */
+    if (ParkedApps < RunningApps && State->WaitTime < CFE_PLATFORM_ES_SNAPSHOT_QUIESCE_TIMEOUT_MSEC)
+    {
+        return true;
+    }
+
+    Status = CFE_ES_WriteSnapshotFile(State);
+    if (Status == CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(CFE_ES_SNAPSHOT_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "Snapshot written to '%s', %u of %u apps parked", State->FileName,
+                          (unsigned int)ParkedApps, (unsigned int)RunningApps);
+    }
+    else
+    {
+        CFE_EVS_SendEvent(CFE_ES_SNAPSHOT_WR_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Error writing snapshot to '%s', RC = 0x%08X", State->FileName, (unsigned int)Status);
+    }
+
+    /* releases any apps held in CFE_ES_RunLoop() */
+    CFE_ES_LockSharedData(__func__, __LINE__);
+    State->Pending = false;
+    CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+    return false;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Reads one section of a snapshot file.  If Apply is false the data is
+ * only checked against the section CRC, otherwise it is copied into place.
+ *
+ *-----------------------------------------------------------------*/
+static int32 CFE_ES_SnapshotReadSection(CFE_ES_SnapshotState_t *State, osal_id_t FileDesc,
+                                        const CFE_ES_SnapshotSection_t *Section, cpuaddr ResetArea, bool Apply)
+{
+    uint32 Pos;
+    uint32 BlockSize;
+    uint32 Crc;
+
+    if (OS_lseek(FileDesc, Section->Offset, OS_SEEK_SET) != Section->Offset)
+    {
+        return CFE_ES_FILE_IO_ERR;
+    }
+
+    Crc = 0;
+    for (Pos = 0; Pos < Section->Size; Pos += BlockSize)
+    {
+        BlockSize = Section->Size - Pos;
+        if (BlockSize > sizeof(State->IoBuffer))
+        {
+            BlockSize = sizeof(State->IoBuffer);
+        }
+
+        if (OS_read(FileDesc, State->IoBuffer, BlockSize) != BlockSize)
+        {
+            return CFE_ES_FILE_IO_ERR;
+        }
+
+        if (!Apply)
+        {
+            Crc = CFE_ES_CalculateCRC(State->IoBuffer, BlockSize, Crc, CFE_MISSION_ES_DEFAULT_CRC);
+        }
+        else if (Section->Type == CFE_ES_SnapshotSection_RESET_AREA)
+        {
+            memcpy((uint8 *)ResetArea + Pos, State->IoBuffer, BlockSize);
+        }
+        else if (CFE_PSP_WriteToCDS(State->IoBuffer, Pos, BlockSize) != CFE_PSP_SUCCESS)
+        {
+            return CFE_ES_CDS_ACCESS_ERROR;
+        }
+    }
+
+    if (!Apply && Crc != Section->Crc)
+    {
+        return CFE_STATUS_VALIDATION_FAILURE;
+    }
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_RestoreSnapshot(const char *FileName)
+{
+    CFE_ES_SnapshotState_t *  State = &CFE_ES_Global.SnapshotState;
+    CFE_ES_SnapshotSection_t *Section;
+    CFE_FS_Header_t           FsHeader;
+    osal_id_t                 FileDesc;
+    CFE_ES_SnapshotSection_t  TablesSection;
+    cpuaddr                   ResetAreaAddr;
+    uint32                    ResetAreaSize;
+    uint32                    CDSSize;
+    uint32                    i;
+    int32                     Status;
+
+    if (FileName == NULL || FileName[0] == 0)
+    {
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
+    if (OS_OpenCreate(&FileDesc, FileName, OS_FILE_FLAG_NONE, OS_READ_ONLY) != OS_SUCCESS)
+    {
+        /* no snapshot to restore, which is the normal case */
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+
+    if (CFE_PSP_GetResetArea(&ResetAreaAddr, &ResetAreaSize) != CFE_PSP_SUCCESS)
+    {
+        ResetAreaSize = 0;
+    }
+    if (CFE_PSP_GetCDSSize(&CDSSize) != CFE_PSP_SUCCESS)
+    {
+        CDSSize = 0;
+    }
+
+    Status = CFE_SUCCESS;
+    if (CFE_FS_ReadHeader(&FsHeader, FileDesc) != sizeof(FsHeader) ||
+        OS_read(FileDesc, &State->Header, sizeof(State->Header)) != sizeof(State->Header))
+    {
+        Status = CFE_ES_FILE_IO_ERR;
+    }
+    else if (FsHeader.ContentType != CFE_FS_FILE_CONTENT_ID || FsHeader.SubType != CFE_FS_SubType_ES_SNAPSHOT ||
+             State->Header.Magic != CFE_ES_SNAPSHOT_MAGIC || State->Header.Version != CFE_ES_SNAPSHOT_VERSION ||
+             State->Header.NumSections > CFE_ES_SNAPSHOT_MAX_SECTIONS)
+    {
+        Status = CFE_STATUS_VALIDATION_FAILURE;
+    }
+
+    /* First pass: the layout must match this PSP and every CRC must be good */
+    for (i = 0; Status == CFE_SUCCESS && i < State->Header.NumSections; ++i)
+    {
+        Section = &State->Header.Sections[i];
+        if ((Section->Type == CFE_ES_SnapshotSection_RESET_AREA && Section->Size != ResetAreaSize) ||
+            (Section->Type == CFE_ES_SnapshotSection_CDS && Section->Size != CDSSize))
+        {
+            Status = CFE_STATUS_VALIDATION_FAILURE;
+        }
+        else
+        {
+            Status = CFE_ES_SnapshotReadSection(State, FileDesc, Section, ResetAreaAddr, false);
+        }
+    }
+
+    /*
+     * Second pass: copy the data into place.  Table images are copied later,
+     * as each table is registered, so only the location of that section is kept.
+     */
+    memset(&TablesSection, 0, sizeof(TablesSection));
+    for (i = 0; Status == CFE_SUCCESS && i < State->Header.NumSections; ++i)
+    {
+        Section = &State->Header.Sections[i];
+        if (Section->Type == CFE_ES_SnapshotSection_TABLES)
+        {
+            TablesSection = *Section;
+        }
+        else
+        {
+            Status = CFE_ES_SnapshotReadSection(State, FileDesc, Section, ResetAreaAddr, true);
+        }
+    }
+
+    OS_close(FileDesc);
+
+    if (Status == CFE_SUCCESS)
+    {
+        OS_printf("ES Startup: Restored %u section(s) from snapshot %s\n", (unsigned int)State->Header.NumSections,
+                  FileName);
+    }
+    else
+    {
+        OS_printf("ES Startup: Snapshot %s not restored, RC=0x%08x\n", FileName, (unsigned int)Status);
+    }
+
+    memset(State, 0, sizeof(*State));
+
+    /* The file is consumed by CFE_ES_CompleteSnapshotRestore() once startup is complete */
+    if (Status == CFE_SUCCESS)
+    {
+        strncpy(State->RestoreFileName, FileName, sizeof(State->RestoreFileName) - 1);
+        State->RestoreFileName[sizeof(State->RestoreFileName) - 1] = 0;
+        State->RestoreTables                                       = TablesSection;
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_RestoreSnapshotTable(CFE_ES_SnapshotTableHeader_t *HeaderPtr, void *DataPtr)
+{
+    CFE_ES_SnapshotTableHeader_t TblHeader;
+    CFE_ES_SnapshotSection_t     Section;
+    char                         FileName[OS_MAX_PATH_LEN];
+    osal_id_t                    FileDesc;
+    uint32                       Pos;
+    int32                        Status;
+
+    CFE_ES_LockSharedData(__func__, __LINE__);
+    strncpy(FileName, CFE_ES_Global.SnapshotState.RestoreFileName, sizeof(FileName) - 1);
+    FileName[sizeof(FileName) - 1] = 0;
+    Section                        = CFE_ES_Global.SnapshotState.RestoreTables;
+    CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+    if (FileName[0] == 0 || Section.Size == 0)
+    {
+        /* no snapshot was restored, or it holds no tables */
+        return CFE_ES_ERR_NAME_NOT_FOUND;
+    }
+
+    if (OS_OpenCreate(&FileDesc, FileName, OS_FILE_FLAG_NONE, OS_READ_ONLY) != OS_SUCCESS)
+    {
+        return CFE_ES_FILE_IO_ERR;
+    }
+
+    /* The section CRC was checked during the restore, so only the layout is followed here */
+    Status = CFE_ES_ERR_NAME_NOT_FOUND;
+    Pos    = 0;
+    while (Status == CFE_ES_ERR_NAME_NOT_FOUND && Pos < Section.Size)
+    {
+        if (OS_lseek(FileDesc, Section.Offset + Pos, OS_SEEK_SET) != Section.Offset + Pos ||
+            OS_read(FileDesc, &TblHeader, sizeof(TblHeader)) != sizeof(TblHeader))
+        {
+            Status = CFE_ES_FILE_IO_ERR;
+        }
+        else if (TblHeader.Size != HeaderPtr->Size ||
+                 strncmp(TblHeader.Name, HeaderPtr->Name, sizeof(TblHeader.Name)) != 0)
+        {
+            /* not this table, skip over its data */
+            Pos += sizeof(TblHeader) + TblHeader.Size;
+        }
+        else if (OS_read(FileDesc, DataPtr, TblHeader.Size) != TblHeader.Size)
+        {
+            Status = CFE_ES_FILE_IO_ERR;
+        }
+        else
+        {
+            strncpy(HeaderPtr->LastFileLoaded, TblHeader.LastFileLoaded, sizeof(HeaderPtr->LastFileLoaded) - 1);
+            HeaderPtr->LastFileLoaded[sizeof(HeaderPtr->LastFileLoaded) - 1] = 0;
+
+            Status = CFE_SUCCESS;
+        }
+    }
+
+    OS_close(FileDesc);
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_CompleteSnapshotRestore(void)
+{
+    CFE_ES_SnapshotState_t *State = &CFE_ES_Global.SnapshotState;
+    char                    FileName[OS_MAX_PATH_LEN];
+    int32                   OsStatus;
+
+    CFE_ES_LockSharedData(__func__, __LINE__);
+    strncpy(FileName, State->RestoreFileName, sizeof(FileName) - 1);
+    FileName[sizeof(FileName) - 1] = 0;
+    memset(State->RestoreFileName, 0, sizeof(State->RestoreFileName));
+    memset(&State->RestoreTables, 0, sizeof(State->RestoreTables));
+    CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+    if (FileName[0] == 0)
+    {
+        return;
+    }
+
+    /* A snapshot is restored once, the next power-on start is a normal one */
+    OsStatus = OS_remove(FileName);
+    if (OsStatus != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("%s: Error removing restored snapshot %s, RC=%ld\n", __func__, FileName, (long)OsStatus);
+    }
+}
@@ -0,0 +1,189 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Purpose: State snapshot/restore data structures
+ *
+ * Design Notes:
+ *
+ * A snapshot file consists of the standard cFE file header, followed by
+ * a snapshot header describing each section, followed by the section data.
+ * Each section starts on a CFE_ES_SNAPSHOT_PAGE_SIZE boundary so the file
+ * may be memory mapped directly.  All values are stored in the native byte
+ * order of the processor that wrote the snapshot; a snapshot is only
+ * meaningful to a processor running the same build.
+ *
+ * The tables section is a packed sequence of table images, each made of a
+ * CFE_ES_SnapshotTableHeader_t followed by the table data.
+ *
+ * References:
+ *
+ */
+
+#ifndef CFE_ES_SNAPSHOT_H
+#define CFE_ES_SNAPSHOT_H
+
+/*
+** Include Files
+*/
+#include "common_types.h"
+#include "osconfig.h"
+#include "cfe_es_api_typedefs.h"
+
+/*
+**  Defines
+*/
+#define CFE_ES_SNAPSHOT_MAGIC        0x45535350 /* "ESSP" */
+#define CFE_ES_SNAPSHOT_VERSION      2
+#define CFE_ES_SNAPSHOT_PAGE_SIZE    4096
+#define CFE_ES_SNAPSHOT_IO_BLOCK     1024
+#define CFE_ES_SNAPSHOT_MAX_SECTIONS 3
+#define CFE_ES_SNAPSHOT_POLL_MSEC    10
+#define CFE_ES_SNAPSHOT_TEMP_SUFFIX  ".tmp"
+
+/** @defgroup CFEESSnapshot State Snapshot Data Structures
+ * @{
+ */
+
+/**
+ * @brief Identifies the content of a snapshot file section
+ */
+typedef enum CFE_ES_SnapshotSectionType
+{
+    CFE_ES_SnapshotSection_RESET_AREA = 1, /**< Contents of the PSP reset area */
+    CFE_ES_SnapshotSection_CDS        = 2, /**< Contents of the Critical Data Store */
+    CFE_ES_SnapshotSection_TABLES     = 3  /**< Active buffers of the loaded tables */
+} CFE_ES_SnapshotSectionType_t;
+
+/**
+ * @brief Snapshot file section descriptor
+ */
+typedef struct
+{
+    uint32 Type;   /**< Section type, one of CFE_ES_SnapshotSectionType_t */
+    uint32 Crc;    /**< CRC of the section data */
+    uint32 Offset; /**< Offset of the section data from the start of the file */
+    uint32 Size;   /**< Size of the section data in bytes */
+} CFE_ES_SnapshotSection_t;
+
+/**
+ * @brief Snapshot file header, written immediately after the CFE FS header
+ */
+typedef struct
+{
+    uint32                   Magic;       /**< Always CFE_ES_SNAPSHOT_MAGIC */
+    uint32                   Version;     /**< Layout version, CFE_ES_SNAPSHOT_VERSION */
+    uint32                   PageSize;    /**< Alignment of the section data */
+    uint32                   NumSections; /**< Number of valid entries in Sections */
+    CFE_ES_SnapshotSection_t Sections[CFE_ES_SNAPSHOT_MAX_SECTIONS];
+} CFE_ES_SnapshotFileHeader_t;
+
+/**
+ * @brief Snapshot request state
+ *
+ * The command handler fills in the file name and sets Pending.  From that
+ * point the structure is owned by the background job, which clears Pending
+ * once the file has been written (or the attempt has failed).
+ *
+ * While Pending is set, external applications calling CFE_ES_RunLoop()
+ * are held at that boundary and counted in ParkedApps.
+ *
+ * RestoreFileName and RestoreTables are set when a snapshot has been restored
+ * during this start, and cleared once it has been consumed.  Table images are
+ * read from the file as the tables are registered until then.
+ */
+typedef struct
+{
+    bool   Pending;    /**< Set while a snapshot has been requested and not yet completed */
+    uint32 ParkedApps; /**< Number of apps currently held in CFE_ES_RunLoop() */
+    uint32 WaitTime;   /**< Time spent waiting for apps to park, in milliseconds */
+
+    char FileName[OS_MAX_PATH_LEN]; /**< Output file name from the command */
+
+    CFE_ES_SnapshotFileHeader_t Header;                            /**< Header for file being written/read */
+    uint8                       IoBuffer[CFE_ES_SNAPSHOT_IO_BLOCK]; /**< Staging area for file transfers */
+
+    char                     RestoreFileName[OS_MAX_PATH_LEN]; /**< Snapshot restored during this start, if any */
+    CFE_ES_SnapshotSection_t RestoreTables;                    /**< Tables section of that snapshot */
+} CFE_ES_SnapshotState_t;
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Write the snapshot file
+ *
+ * Writes the reset area, the CDS and the loaded table images to the file
+ * named in the snapshot state.  Called from the background job once apps
+ * are parked.
+ *
+ * The data is written to a temporary file alongside the named file, which is
+ * then renamed over it, so an existing snapshot is only replaced by a complete one.
+ *
+ * @param[in,out] State   the snapshot state
+ *
+ * @returns CFE_SUCCESS if the file was written, or an error code
+ */
+int32 CFE_ES_WriteSnapshotFile(CFE_ES_SnapshotState_t *State);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Background job to take a requested snapshot
+ *
+ * Waits until all running external apps have parked in CFE_ES_RunLoop(),
+ * or until CFE_PLATFORM_ES_SNAPSHOT_QUIESCE_TIMEOUT_MSEC has elapsed, and
+ * then writes the snapshot file.
+ *
+ * @returns true while a snapshot is pending, false when idle
+ */
+bool CFE_ES_RunSnapshot(uint32 ElapsedTime, void *Arg);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Restore the reset area and CDS from a snapshot file
+ *
+ * Called very early during a power-on start, before the reset variables
+ * are set up.  The reset area and CDS sizes recorded in the file must match
+ * the current PSP, and each section CRC must be correct, before anything
+ * is restored.
+ *
+ * The table images are not copied here, as no tables are registered yet.
+ * They are read from the file by CFE_ES_RestoreSnapshotTable() as the tables
+ * are registered, until CFE_ES_CompleteSnapshotRestore() consumes the file.
+ *
+ * @note Runs before the system log is available; messages go to OS_printf()
+ *
+ * @param[in] FileName   the snapshot file to read
+ *
+ * @returns CFE_SUCCESS if the state was restored, or an error code
+ */
+int32 CFE_ES_RestoreSnapshot(const char *FileName);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Consume the snapshot restored during this start
+ *
+ * Called once startup is complete.  Removes the restored snapshot file, so
+ * it is not restored again on the next power-on start, and ends the lookup
+ * of table images.  Does nothing if no snapshot was restored.
+ */
+void CFE_ES_CompleteSnapshotRestore(void);
+
+/** @} */
+
+#endif /* CFE_ES_SNAPSHOT_H */
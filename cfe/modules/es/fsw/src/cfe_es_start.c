@@ -111,6 +111,18 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
         return;
     }
 
+    /*
+    ** A power-on start may resume from a previously written state snapshot.
+    ** The restored reset area and CDS are then treated as a processor reset
+    ** so that apps and critical tables recover their saved contents.
+    */
+    if (StartType == CFE_PSP_RST_TYPE_POWERON &&
+        CFE_ES_RestoreSnapshot(CFE_PLATFORM_ES_SNAPSHOT_RESTORE_FILE) == CFE_SUCCESS)
+    {
+        StartType    = CFE_PSP_RST_TYPE_PROCESSOR;
+        StartSubtype = CFE_PSP_RST_SUBTYPE_RESET_COMMAND;
+    }
+
     /*
     ** Initialize the Reset variables. This call is required
     ** Before most of the ES functions can be used including the
@@ -230,6 +242,12 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
     */
     CFE_ES_WriteToSysLog("%s: CFE_ES_Main entering OPERATIONAL state\n", __func__);
     CFE_ES_Global.SystemState = CFE_ES_SystemState_OPERATIONAL;
+
+    /*
+    ** Tables registered during startup have taken their contents from any
+    ** restored snapshot by now, so it is consumed and not restored again.
+    */
+    CFE_ES_CompleteSnapshotRestore();
 }
 
 /*----------------------------------------------------------------
@@ -750,6 +768,7 @@ void CFE_ES_CreateObjects(void)
                     AppRecPtr->ControlReq.AppTimerMsec      = 0;
 
                     CFE_ES_AppRecordSetUsed(AppRecPtr, CFE_RESOURCEID_RESERVED);
+                    CFE_ES_AppRecordAddName(AppRecPtr);
                     CFE_ES_Global.LastAppId = PendingAppId;
                 }
 
@@ -789,6 +808,7 @@ void CFE_ES_CreateObjects(void)
                         /* failure mode - just clear the whole app table entry.
                          * This will set the AppType back to CFE_ES_ResourceType_INVALID (0),
                          * as well as clearing any other data that had been written */
+                        CFE_ES_AppRecordRemoveName(AppRecPtr);
                         memset(AppRecPtr, 0, sizeof(*AppRecPtr));
                     }
 
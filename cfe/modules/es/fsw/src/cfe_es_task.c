@@ -325,6 +325,15 @@ int32 CFE_ES_TaskInit(void)
     CFE_MSG_Init(CFE_MSG_PTR(CFE_ES_Global.TaskData.MemStatsPacket.TelemetryHeader),
                  CFE_SB_ValueToMsgId(CFE_ES_MEMSTATS_TLM_MID), sizeof(CFE_ES_Global.TaskData.MemStatsPacket));
 
+    /*
+    ** Initialize application resource usage telemetry packet, the first
+    ** sample period starts now
+    */
+    CFE_MSG_Init(CFE_MSG_PTR(CFE_ES_Global.TaskData.AppResourcePacket.TelemetryHeader),
+                 CFE_SB_ValueToMsgId(CFE_ES_APP_RESOURCE_TLM_MID), sizeof(CFE_ES_Global.TaskData.AppResourcePacket));
+    CFE_ES_Global.TaskData.AppResourceHkCount = 0;
+    CFE_PSP_GetTime(&CFE_ES_Global.TaskData.AppResourcePeriodStart);
+
     /*
     ** Create Software Bus message pipe
     */
@@ -543,6 +552,19 @@ int32 CFE_ES_SendHkCmd(const CFE_ES_SendHkCmd_t *data)
     CFE_SB_TimeStampMsg(CFE_MSG_PTR(CFE_ES_Global.TaskData.HkPacket.TelemetryHeader));
     CFE_SB_TransmitMsg(CFE_MSG_PTR(CFE_ES_Global.TaskData.HkPacket.TelemetryHeader), true);
 
+    /*
+    ** Send the application resource usage at the end of each sample period
+    */
+    if (CFE_PLATFORM_ES_APP_RESOURCE_HK_CYCLES > 0)
+    {
+        ++CFE_ES_Global.TaskData.AppResourceHkCount;
+        if (CFE_ES_Global.TaskData.AppResourceHkCount >= CFE_PLATFORM_ES_APP_RESOURCE_HK_CYCLES)
+        {
+            CFE_ES_Global.TaskData.AppResourceHkCount = 0;
+            CFE_ES_SendAppResourceTlm();
+        }
+    }
+
     /*
     ** This command does not affect the command execution counter.
     */
@@ -550,6 +572,89 @@ int32 CFE_ES_SendHkCmd(const CFE_ES_SendHkCmd_t *data)
     return CFE_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_SendAppResourceTlm(void)
+{
+    CFE_ES_AppResourceTlm_Payload_t *PayloadPtr;
+    CFE_ES_AppResourceEntry_t *      EntryPtr;
+    CFE_ES_AppRecord_t *             AppRecPtr;
+    CFE_ES_TaskRecord_t *            TaskRecPtr;
+    OS_time_t                        PeriodEnd;
+    int64                            PeriodUsec;
+    uint32                           i;
+
+    PayloadPtr = &CFE_ES_Global.TaskData.AppResourcePacket.Payload;
+    memset(PayloadPtr, 0, sizeof(*PayloadPtr));
+
+    CFE_PSP_GetTime(&PeriodEnd);
+    PeriodUsec = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(PeriodEnd, CFE_ES_Global.TaskData.AppResourcePeriodStart));
+    CFE_ES_Global.TaskData.AppResourcePeriodStart = PeriodEnd;
+
+    CFE_ES_LockSharedData(__func__, __LINE__);
+
+    /*
+     * Sample every task, child tasks and tasks of apps that never call
+     * CFE_ES_RunLoop included, and charge it to its parent app
+     */
+    TaskRecPtr = CFE_ES_Global.TaskTable;
+    for (i = 0; i < OS_MAX_TASKS; ++i)
+    {
+        if (CFE_ES_TaskRecordIsUsed(TaskRecPtr))
+        {
+            AppRecPtr = CFE_ES_LocateAppRecordByID(TaskRecPtr->AppId);
+            if (CFE_ES_AppRecordIsMatch(AppRecPtr, TaskRecPtr->AppId))
+            {
+                CFE_ES_TaskCpuSample(TaskRecPtr, &AppRecPtr->CpuStats);
+            }
+        }
+        ++TaskRecPtr;
+    }
+
+    /*
+     * Apps beyond the capacity of the packet are still sampled, so
+     * their values remain available through the query commands.
+     */
+    AppRecPtr = CFE_ES_Global.AppTable;
+    for (i = 0; i < CFE_PLATFORM_ES_MAX_APPLICATIONS; ++i)
+    {
+        if (CFE_ES_AppRecordIsUsed(AppRecPtr))
+        {
+            CFE_ES_AppCpuClosePeriod(&AppRecPtr->CpuStats, PeriodEnd, PeriodUsec);
+
+            if (PayloadPtr->NumApps < CFE_MISSION_ES_MAX_APPLICATIONS)
+            {
+                EntryPtr = &PayloadPtr->Apps[PayloadPtr->NumApps];
+
+                EntryPtr->AppId          = CFE_ES_AppRecordGetID(AppRecPtr);
+                EntryPtr->CpuUtilization = AppRecPtr->CpuStats.CpuUtilization;
+                EntryPtr->MaxRunLoopTime = AppRecPtr->CpuStats.MaxRunLoopTime;
+                EntryPtr->RunLoopCount   = AppRecPtr->CpuStats.RunLoopCount;
+
+                ++PayloadPtr->NumApps;
+            }
+        }
+        ++AppRecPtr;
+    }
+
+    CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+    /* Entries past NumApps keep an undefined ID so they are not mistaken for app 0 */
+    for (i = PayloadPtr->NumApps; i < CFE_MISSION_ES_MAX_APPLICATIONS; ++i)
+    {
+        PayloadPtr->Apps[i].AppId = CFE_ES_APPID_UNDEFINED;
+    }
+
+    PayloadPtr->SamplePeriodMsec = (uint32)(PeriodUsec / 1000);
+
+    CFE_SB_TimeStampMsg(CFE_MSG_PTR(CFE_ES_Global.TaskData.AppResourcePacket.TelemetryHeader));
+    CFE_SB_TransmitMsg(CFE_MSG_PTR(CFE_ES_Global.TaskData.AppResourcePacket.TelemetryHeader), true);
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -1745,6 +1850,59 @@ int32 CFE_ES_DumpCDSRegistryCmd(const CFE_ES_DumpCDSRegistryCmd_t *data)
     return CFE_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_WriteSnapshotCmd(const CFE_ES_WriteSnapshotCmd_t *data)
+{
+    const CFE_ES_FileNameCmd_Payload_t *CmdPtr   = &data->Payload;
+    CFE_ES_SnapshotState_t *            StatePtr = &CFE_ES_Global.SnapshotState;
+    char                                FileName[OS_MAX_PATH_LEN];
+    int32                               Status;
+
+    /* check if pending before overwriting fields in the structure */
+    if (StatePtr->Pending)
+    {
+        CFE_EVS_SendEvent(CFE_ES_SNAPSHOT_ERR_EID, CFE_EVS_EventType_ERROR, "Snapshot already in progress");
+        CFE_ES_Global.TaskData.CommandErrorCounter++;
+        return CFE_SUCCESS;
+    }
+
+    /*
+    ** Copy the filename into local buffer with default name/path/extension if not specified
+    */
+    Status = CFE_FS_ParseInputFileNameEx(FileName, CmdPtr->FileName, sizeof(FileName), sizeof(CmdPtr->FileName),
+                                         CFE_PLATFORM_ES_DEFAULT_SNAPSHOT_FILE,
+                                         CFE_FS_GetDefaultMountPoint(CFE_FS_FileCategory_BINARY_DATA_DUMP),
+                                         CFE_FS_GetDefaultExtension(CFE_FS_FileCategory_BINARY_DATA_DUMP));
+
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(CFE_ES_SNAPSHOT_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Error parsing snapshot filename, RC = 0x%08X", (unsigned int)Status);
+        CFE_ES_Global.TaskData.CommandErrorCounter++;
+    }
+    else
+    {
+        CFE_ES_LockSharedData(__func__, __LINE__);
+        strncpy(StatePtr->FileName, FileName, sizeof(StatePtr->FileName) - 1);
+        StatePtr->FileName[sizeof(StatePtr->FileName) - 1] = 0;
+        StatePtr->WaitTime                                 = 0;
+        StatePtr->Pending                                  = true;
+        CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+        /* The background job takes the snapshot once apps are parked */
+        CFE_ES_BackgroundWakeup();
+
+        CFE_ES_Global.TaskData.CommandCounter++;
+    }
+
+    return CFE_SUCCESS;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
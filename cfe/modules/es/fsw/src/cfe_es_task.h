@@ -119,6 +119,17 @@ void CFE_ES_BackgroundTask(void);
  */
 void CFE_ES_BackgroundCleanup(void);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Close the application resource sample period and send the usage packet
+ *
+ * Called from the housekeeping request every #CFE_PLATFORM_ES_APP_RESOURCE_HK_CYCLES
+ * requests.  Samples the CPU time of every task, closes the CPU accounting period
+ * of every registered app and sends the results in the #CFE_ES_APP_RESOURCE_TLM_MID
+ * packet.
+ */
+void CFE_ES_SendAppResourceTlm(void);
+
 /*
 ** ES Task message dispatch functions
 */
@@ -267,6 +278,12 @@ int32 CFE_ES_SendMemPoolStatsCmd(const CFE_ES_SendMemPoolStatsCmd_t *data);
  */
 int32 CFE_ES_DumpCDSRegistryCmd(const CFE_ES_DumpCDSRegistryCmd_t *data);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief  Request a snapshot of the reset area and CDS to a file
+ */
+int32 CFE_ES_WriteSnapshotCmd(const CFE_ES_WriteSnapshotCmd_t *data);
+
 /*
 ** Message Handler Helper Functions
 */
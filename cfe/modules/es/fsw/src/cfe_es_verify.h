@@ -149,6 +149,19 @@
 #error CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE cannot be less than 1025 entries!
 #endif
 
+/*
+** Performance data streaming
+*/
+#if CFE_PLATFORM_ES_PERF_STREAM_MAX_FILES < 1
+#error CFE_PLATFORM_ES_PERF_STREAM_MAX_FILES cannot be less than 1!
+#endif
+#if CFE_PLATFORM_ES_PERF_STREAM_FILE_ENTRIES < 1
+#error CFE_PLATFORM_ES_PERF_STREAM_FILE_ENTRIES cannot be less than 1!
+#endif
+#if CFE_PLATFORM_ES_PERF_STREAM_BUFFER_SIZE < 1
+#error CFE_PLATFORM_ES_PERF_STREAM_BUFFER_SIZE cannot be less than 1!
+#endif
+
 /*
 ** Maximum number of Registered CDS blocks
 */
@@ -318,6 +331,36 @@
 #error CFE_PLATFORM_ES_CDS_MEM_BLOCK_SIZE_16 must be less than CFE_PLATFORM_ES_CDS_MAX_BLOCK_SIZE
 #endif
 
+/*
+** CDS CRC chunk size
+*/
+#if CFE_PLATFORM_ES_CDS_CHUNK_SIZE < 16
+#error CFE_PLATFORM_ES_CDS_CHUNK_SIZE cannot be less than 16!
+#elif (CFE_PLATFORM_ES_CDS_CHUNK_SIZE % 4) != 0
+#error CFE_PLATFORM_ES_CDS_CHUNK_SIZE must be a multiple of 4
+#endif
+
+/*
+** Startup loader worker count
+*/
+#if CFE_PLATFORM_ES_STARTUP_LOAD_WORKERS < 0
+#error CFE_PLATFORM_ES_STARTUP_LOAD_WORKERS cannot be less than 0!
+#endif
+
+/*
+** Snapshot quiesce timeout
+*/
+#if CFE_PLATFORM_ES_SNAPSHOT_QUIESCE_TIMEOUT_MSEC < 0
+#error CFE_PLATFORM_ES_SNAPSHOT_QUIESCE_TIMEOUT_MSEC cannot be less than 0!
+#endif
+
+/*
+** Application resource sample period
+*/
+#if CFE_PLATFORM_ES_APP_RESOURCE_HK_CYCLES < 0
+#error CFE_PLATFORM_ES_APP_RESOURCE_HK_CYCLES cannot be less than 0!
+#endif
+
 /*
 ** Validate task stack size...
 */
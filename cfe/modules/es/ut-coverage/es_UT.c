@@ -147,6 +147,8 @@ static const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_SEND_MEM_POOL_STATS_CC =
     { ES_UT_CC_DISPATCH(CMD, CFE_ES_SEND_MEM_POOL_STATS_CC, SendMemPoolStatsCmd) };
 static const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_DUMP_CDS_REGISTRY_CC =
     { ES_UT_CC_DISPATCH(CMD, CFE_ES_DUMP_CDS_REGISTRY_CC, DumpCDSRegistryCmd) };
+static const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_WRITE_SNAPSHOT_CC =
+    { ES_UT_CC_DISPATCH(CMD, CFE_ES_WRITE_SNAPSHOT_CC, WriteSnapshotCmd) };
 static const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_SEND_HK =
     { ES_UT_MSG_DISPATCH(SEND_HK, SendHkCmd) };
 static const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_INVALID_LENGTH =
@@ -624,6 +626,41 @@ static int32 ES_UT_SetAppStateHook(void *UserObj, int32 StubRetcode, uint32 Call
     return StubRetcode;
 }
 
+/*
+ * Hook to release apps parked in CFE_ES_RunLoop() on the first delay
+ */
+static int32 ES_UT_ClearSnapshotPendingHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                            const UT_StubContext_t *Context)
+{
+    CFE_ES_Global.SnapshotState.Pending = false;
+    return StubRetcode;
+}
+
+/*
+ * Table Services getter with one loaded table in the first of two registry entries
+ */
+static uint8 ES_UT_SnapshotTableData[24];
+
+static void ES_UT_SnapshotTableGetterHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    uint32                        RecordNum = UT_Hook_GetArgValueByName(Context, "RecordNum", uint32);
+    CFE_ES_SnapshotTableHeader_t *HeaderPtr =
+        UT_Hook_GetArgValueByName(Context, "HeaderPtr", CFE_ES_SnapshotTableHeader_t *);
+    const void **DataPtr = UT_Hook_GetArgValueByName(Context, "DataPtr", const void **);
+    bool         IsEOF   = (RecordNum >= 1);
+
+    *DataPtr = NULL;
+    if (RecordNum == 0)
+    {
+        memset(HeaderPtr, 0, sizeof(*HeaderPtr));
+        strncpy(HeaderPtr->Name, "UT.Table", sizeof(HeaderPtr->Name) - 1);
+        HeaderPtr->Size = sizeof(ES_UT_SnapshotTableData);
+        *DataPtr        = ES_UT_SnapshotTableData;
+    }
+
+    UT_Stub_SetReturnValue(FuncKey, IsEOF);
+}
+
 void UtTest_Setup(void)
 {
     UT_Init("es");
@@ -645,6 +682,8 @@ void UtTest_Setup(void)
     UT_ADD_TEST(TestESMempool);
     UT_ADD_TEST(TestSysLog);
     UT_ADD_TEST(TestBackground);
+    UT_ADD_TEST(TestSnapshot);
+    UT_ADD_TEST(TestAppResource);
     UT_ADD_TEST(TestStatusToString);
 }
 
@@ -1145,17 +1184,19 @@ static void ES_UT_Config_IterateAll(void *UserObj, UT_EntryKey_t FuncKey, const
 
 void TestApps(void)
 {
-    size_t                  NumBytes;
-    CFE_ES_AppInfo_t        AppInfo;
-    CFE_ES_AppId_t          AppId;
-    CFE_ES_TaskId_t         TaskId;
-    CFE_ES_TaskRecord_t *   UtTaskRecPtr;
-    CFE_ES_AppRecord_t *    UtAppRecPtr;
-    CFE_ES_AppRecord_t *    UtAppRecPtr1;
-    CFE_ES_MemPoolRecord_t *UtPoolRecPtr;
-    char                    NameBuffer[OS_MAX_API_NAME + 5];
-    CFE_ES_AppStartParams_t StartParams;
-    int                     ObjCount;
+    size_t                    NumBytes;
+    CFE_ES_AppInfo_t          AppInfo;
+    CFE_ES_AppId_t            AppId;
+    CFE_ES_TaskId_t           TaskId;
+    CFE_ES_TaskRecord_t *     UtTaskRecPtr;
+    CFE_ES_AppRecord_t *      UtAppRecPtr;
+    CFE_ES_AppRecord_t *      UtAppRecPtr1;
+    CFE_ES_MemPoolRecord_t *  UtPoolRecPtr;
+    char                      NameBuffer[OS_MAX_API_NAME + 5];
+    CFE_ES_AppStartParams_t   StartParams;
+    CFE_ES_ModuleLoadStatus_t LoadStatus;
+    CFE_ES_LibId_t            LibId;
+    int                       ObjCount;
 
     UtPrintf("Begin Test Apps");
 
@@ -1247,6 +1288,103 @@ void TestApps(void)
     ES_ResetUnitTest();
     UtAssert_INT32_EQ(CFE_ES_ParseFileEntry(NULL, 0), CFE_ES_BAD_ARGUMENT);
 
+    /* Test queueing startup entries with dependency hints for the parallel startup loader */
+    ES_ResetUnitTest();
+    {
+        const char *LibTokens[]   = {"CFE_LIB", "/cf/apps/tst_lib.bundle", "TST_LIB_Init", "TST_LIB", "0", "0", "0x0",
+                                   "1"};
+        const char *AppTokens[]   = {"CFE_APP", "/cf/apps/ci.bundle", "CI_task_main", "CI_APP", "70", "4096", "0x0",
+                                   "1",       "TST_LIB:UNKNOWN"};
+        const char *NoDepTokens[] = {"CFE_APP", "/cf/apps/to.bundle", "TO_task_main", "TO_APP", "74", "4096", "0x0",
+                                     "1",       "NONE"};
+
+        CFE_UtAssert_SUCCESS(CFE_ES_QueueStartupEntry(LibTokens, 8));
+        CFE_UtAssert_SUCCESS(CFE_ES_QueueStartupEntry(AppTokens, 9));
+        CFE_UtAssert_SUCCESS(CFE_ES_QueueStartupEntry(NoDepTokens, 9));
+        UtAssert_UINT32_EQ(CFE_ES_Global.StartupQueue.NumEntries, 3);
+        UtAssert_BOOL_TRUE(CFE_ES_Global.StartupQueue.Entries[0].DependsOnAllLibs);
+        UtAssert_UINT32_EQ(CFE_ES_Global.StartupQueue.Entries[1].NumDepends, 1);
+        UtAssert_BOOL_TRUE(CFE_ES_Global.StartupQueue.Entries[1].DependsOnAllLibs);
+        UtAssert_UINT32_EQ(CFE_ES_Global.StartupQueue.Entries[2].NumDepends, 0);
+        UtAssert_BOOL_FALSE(CFE_ES_Global.StartupQueue.Entries[2].DependsOnAllLibs);
+
+        /* The app must wait for the library, the entry without dependencies need not */
+        UtAssert_BOOL_TRUE(CFE_ES_StartupEntryIsReady(0));
+        UtAssert_BOOL_FALSE(CFE_ES_StartupEntryIsReady(1));
+        UtAssert_BOOL_TRUE(CFE_ES_StartupEntryIsReady(2));
+
+        /* A worker loads every entry, then exits */
+        CFE_ES_StartupLoadWorker();
+        UtAssert_STUB_COUNT(OS_ModuleLoad, 3);
+        UtAssert_BOOL_TRUE(CFE_ES_StartupEntryIsReady(1));
+
+        /* Modules already loaded are only started */
+        UT_SetHookFunction(UT_KEY(OS_TaskCreate), ES_UT_SetAppStateHook, NULL);
+        CFE_ES_RunStartupQueue();
+        UtAssert_STUB_COUNT(OS_ModuleLoad, 3);
+        UtAssert_UINT32_EQ(CFE_ES_Global.RegisteredLibs, 1);
+        UtAssert_UINT32_EQ(CFE_ES_Global.RegisteredExternalApps, 2);
+    }
+
+    /* Test the startup loader where entries are loaded by the starting task and one load fails */
+    ES_ResetUnitTest();
+    {
+        const char *LibTokens[] = {"CFE_LIB", "/cf/apps/tst_lib.bundle", "TST_LIB_Init", "TST_LIB", "0", "0", "0x0",
+                                   "1"};
+        const char *AppTokens[] = {"CFE_APP", "/cf/apps/ci.bundle", "CI_task_main", "CI_APP", "70", "4096", "0x0",
+                                   "1"};
+
+        CFE_UtAssert_SUCCESS(CFE_ES_QueueStartupEntry(LibTokens, 8));
+        CFE_UtAssert_SUCCESS(CFE_ES_QueueStartupEntry(AppTokens, 8));
+        UT_SetDeferredRetcode(UT_KEY(OS_ModuleLoad), 1, OS_ERROR);
+        UT_SetHookFunction(UT_KEY(OS_TaskCreate), ES_UT_SetAppStateHook, NULL);
+        CFE_ES_RunStartupQueue();
+        UtAssert_UINT32_EQ(CFE_ES_Global.StartupQueue.Entries[0].State, CFE_ES_StartupEntryState_FAILED);
+        UtAssert_UINT32_EQ(CFE_ES_Global.StartupQueue.Entries[1].State, CFE_ES_StartupEntryState_LOADED);
+        UtAssert_UINT32_EQ(CFE_ES_Global.RegisteredLibs, 0);
+        UtAssert_UINT32_EQ(CFE_ES_Global.RegisteredExternalApps, 1);
+    }
+
+    /* Test queueing startup entries with invalid content */
+    ES_ResetUnitTest();
+    {
+        const char *TokenList[] = {"CFE_APP", "/cf/apps/ci.bundle", "CI_task_main", "CI_APP", "70", "4096", "0x0",
+                                   "1",       ""};
+
+        UtAssert_INT32_EQ(CFE_ES_QueueStartupEntry(TokenList, 7), CFE_ES_BAD_ARGUMENT);
+
+        /* An empty dependency field is the same as none given */
+        CFE_UtAssert_SUCCESS(CFE_ES_QueueStartupEntry(TokenList, 9));
+        UtAssert_BOOL_TRUE(CFE_ES_Global.StartupQueue.Entries[0].DependsOnAllLibs);
+
+        /* More dependencies than can be tracked */
+        TokenList[8] = "CI_APP:CI_APP:CI_APP:CI_APP:CI_APP";
+        CFE_UtAssert_SUCCESS(CFE_ES_QueueStartupEntry(TokenList, 9));
+        UtAssert_UINT32_EQ(CFE_ES_Global.StartupQueue.Entries[1].NumDepends, CFE_ES_STARTUP_MAX_DEPENDS);
+        UtAssert_BOOL_TRUE(CFE_ES_Global.StartupQueue.Entries[1].DependsOnAllLibs);
+
+        memset(NameBuffer, 'a', sizeof(NameBuffer) - 1);
+        NameBuffer[sizeof(NameBuffer) - 1] = 0;
+        TokenList[3]                       = NameBuffer;
+        UtAssert_INT32_EQ(CFE_ES_QueueStartupEntry(TokenList, 8), CFE_ES_BAD_ARGUMENT);
+
+        CFE_ES_Global.StartupQueue.NumEntries = CFE_ES_STARTUP_MAX_ENTRIES;
+        UtAssert_INT32_EQ(CFE_ES_QueueStartupEntry(TokenList, 8), CFE_ES_NO_RESOURCE_IDS_AVAILABLE);
+    }
+
+    /* Test creating an app and a library from already loaded modules with names already in use */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, "AppName", NULL, NULL);
+    ES_UT_SetupAppStartParams(&StartParams, "ut/filename", "EntryPoint", 170, 4096, 1);
+    memset(&LoadStatus, 0, sizeof(LoadStatus));
+    OS_ModuleLoad(&LoadStatus.ModuleId, NULL, NULL, 0);
+    UtAssert_INT32_EQ(CFE_ES_AppCreateEx(&AppId, "AppName", &StartParams, &LoadStatus), CFE_ES_ERR_DUPLICATE_NAME);
+    UtAssert_STUB_COUNT(OS_ModuleUnload, 1);
+    UT_SetDeferredRetcode(UT_KEY(OS_ModuleUnload), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_LoadLibraryEx(&LibId, "AppName", &StartParams.BasicInfo, &LoadStatus),
+                      CFE_ES_ERR_DUPLICATE_NAME);
+    UtAssert_STUB_COUNT(OS_ModuleUnload, 2);
+
     /* Test application loading and creation with a task creation failure */
     ES_ResetUnitTest();
     UT_SetDefaultReturnValue(UT_KEY(OS_TaskCreate), OS_ERROR);
@@ -1766,6 +1904,21 @@ void TestApps(void)
         CFE_UtAssert_SUCCESS(CFE_ES_ParseFileEntry(TokenList, 8));
     }
 
+    /* Test parsing the startup script for a cFE application with a CPU affinity mask */
+    ES_ResetUnitTest();
+    {
+        const char *TokenList[] = {"CFE_APP", "/cf/apps/tst_lib.bundle", "TST_LIB_Init", "TST_LIB", "0", "0", "0x0",
+                                   "0", "", "0x6"};
+        CFE_ES_AppStartParams_t Params;
+        bool                    IsLibrary;
+
+        CFE_UtAssert_SUCCESS(CFE_ES_ParseStartupParams(TokenList, 10, &IsLibrary, &Params));
+        UtAssert_UINT32_EQ(Params.MainTaskInfo.CpuMask, 0x6);
+
+        CFE_UtAssert_SUCCESS(CFE_ES_ParseStartupParams(TokenList, 8, &IsLibrary, &Params));
+        UtAssert_ZERO(Params.MainTaskInfo.CpuMask);
+    }
+
     /* Test scanning and acting on the application table where the timer
      * expires for a waiting application
      */
@@ -3584,8 +3737,9 @@ void TestPerf(void)
 
     UtPrintf("Begin Test Performance Log");
 
-    CFE_ES_PerfData_t *Perf;
-    void *             TempBuff;
+    CFE_ES_PerfData_t *        Perf;
+    CFE_ES_PerfStreamGlobal_t *StreamState;
+    void *                     TempBuff;
 
     /*
     ** Set the pointer to the data area
@@ -3637,11 +3791,31 @@ void TestPerf(void)
      */
     ES_ResetUnitTest();
     memset(&CmdBuf, 0, sizeof(CmdBuf));
-    CmdBuf.PerfStartCmd.Payload.TriggerMode = (CFE_ES_PerfTrigger_END + 1);
+    CmdBuf.PerfStartCmd.Payload.TriggerMode = (CFE_ES_PerfTrigger_STREAM + 1);
     UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.PerfStartCmd),
                     UT_TPID_CFE_ES_CMD_START_PERF_DATA_CC);
     CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STARTCMD_TRIG_ERR_EID);
 
+    /* Test successful performance data collection start in STREAM
+     * trigger mode, which also wakes the background task
+     */
+    ES_ResetUnitTest();
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    CmdBuf.PerfStartCmd.Payload.TriggerMode = CFE_ES_PerfTrigger_STREAM;
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.PerfStartCmd),
+                    UT_TPID_CFE_ES_CMD_START_PERF_DATA_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STARTCMD_EID);
+    UtAssert_STUB_COUNT(OS_BinSemGive, 1);
+
+    /* Test performance data collection start while a stream file is still open */
+    ES_ResetUnitTest();
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    OS_OpenCreate(&CFE_ES_Global.BackgroundPerfStreamState.FileDesc, "UT", 0, OS_WRITE_ONLY);
+    CmdBuf.PerfStartCmd.Payload.TriggerMode = CFE_ES_PerfTrigger_START;
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.PerfStartCmd),
+                    UT_TPID_CFE_ES_CMD_START_PERF_DATA_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STARTCMD_ERR_EID);
+
     /* Test performance data collection start with an invalid trigger mode
      * (too low)
      */
@@ -3989,6 +4163,123 @@ void TestPerf(void)
     /* in WRITE_PERF_ENTRIES, it should report the StateCounter */
     CFE_ES_Global.BackgroundPerfDumpState.CurrentState = CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES;
     UtAssert_UINT32_EQ(CFE_ES_GetPerfLogDumpRemaining(), 10);
+
+    /* Test addition of entries to the stream buffers in STREAM trigger mode */
+    ES_ResetUnitTest();
+    StreamState = &CFE_ES_Global.BackgroundPerfStreamState;
+    memset(StreamState, 0, sizeof(*StreamState));
+    Perf->MetaData.State          = CFE_ES_PERF_TRIGGERED;
+    Perf->MetaData.Mode           = CFE_ES_PerfTrigger_STREAM;
+    Perf->MetaData.FilterMask[0]  = 0xFFFFFFFF;
+    Perf->MetaData.TriggerMask[0] = 0xFFFFFFFF;
+    CFE_ES_PerfLogAdd(1, 0);
+    UtAssert_UINT32_EQ(StreamState->Buffer[0].Count, 1);
+    UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_TRIGGERED);
+    UtAssert_STUB_COUNT(OS_BinSemGive, 0);
+
+    /* Filling a buffer wakes the background task */
+    StreamState->Buffer[0].Count = CFE_PLATFORM_ES_PERF_STREAM_BUFFER_SIZE - 1;
+    CFE_ES_PerfLogAdd(1, 1);
+    UtAssert_UINT32_EQ(StreamState->Buffer[0].Count, CFE_PLATFORM_ES_PERF_STREAM_BUFFER_SIZE);
+    UtAssert_STUB_COUNT(OS_BinSemGive, 1);
+
+    /* The next entry goes to the other buffer */
+    CFE_ES_PerfLogAdd(1, 0);
+    UtAssert_UINT32_EQ(StreamState->FillIdx, 1);
+    UtAssert_UINT32_EQ(StreamState->Buffer[1].Count, 1);
+
+    /* When both buffers are full the entry is dropped and counted */
+    StreamState->Buffer[1].Count = CFE_PLATFORM_ES_PERF_STREAM_BUFFER_SIZE;
+    CFE_ES_PerfLogAdd(1, 1);
+    UtAssert_UINT32_EQ(StreamState->FillIdx, 1);
+    UtAssert_UINT32_EQ(StreamState->DroppedEntries, 1);
+
+    /* Stream job with no streaming active and no open file has nothing to do */
+    ES_ResetUnitTest();
+    memset(StreamState, 0, sizeof(*StreamState));
+    Perf->MetaData.State = CFE_ES_PERF_IDLE;
+    UtAssert_BOOL_FALSE(CFE_ES_RunPerfLogStream(1000, StreamState));
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+
+    /* Stream job defers while a log dump is in progress */
+    ES_ResetUnitTest();
+    memset(StreamState, 0, sizeof(*StreamState));
+    Perf->MetaData.State                               = CFE_ES_PERF_WAITING_FOR_TRIGGER;
+    Perf->MetaData.Mode                                = CFE_ES_PerfTrigger_STREAM;
+    CFE_ES_Global.BackgroundPerfDumpState.CurrentState = CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES;
+    UtAssert_BOOL_TRUE(CFE_ES_RunPerfLogStream(1000, StreamState));
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    CFE_ES_Global.BackgroundPerfDumpState.CurrentState = CFE_ES_PerfDumpState_IDLE;
+
+    /* Nominal stream - opens the first file and drains a partially filled buffer */
+    ES_ResetUnitTest();
+    memset(StreamState, 0, sizeof(*StreamState));
+    Perf->MetaData.State         = CFE_ES_PERF_WAITING_FOR_TRIGGER;
+    Perf->MetaData.Mode          = CFE_ES_PerfTrigger_STREAM;
+    StreamState->Buffer[0].Count = 10;
+    UtAssert_BOOL_TRUE(CFE_ES_RunPerfLogStream(1000, StreamState));
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_BOOL_TRUE(OS_ObjectIdDefined(StreamState->FileDesc));
+    UtAssert_UINT32_EQ(StreamState->FillIdx, 1);
+    UtAssert_UINT32_EQ(StreamState->Buffer[0].Count, 0);
+    UtAssert_UINT32_EQ(StreamState->FileEntries, 10);
+    UtAssert_UINT32_EQ(StreamState->TotalEntries, 10);
+    UtAssert_UINT32_EQ(StreamState->FileCount, 1);
+
+    /* A full file rotates to the next file of the set */
+    StreamState->FileEntries     = CFE_PLATFORM_ES_PERF_STREAM_FILE_ENTRIES;
+    StreamState->Buffer[0].Count = 5;
+    UtAssert_BOOL_TRUE(CFE_ES_RunPerfLogStream(1000, StreamState));
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
+    UtAssert_UINT32_EQ(StreamState->FileIndex, 1 % CFE_PLATFORM_ES_PERF_STREAM_MAX_FILES);
+    UtAssert_UINT32_EQ(StreamState->FileEntries, 5);
+    UtAssert_UINT32_EQ(StreamState->FileCount, 2);
+
+    /* Once stopped, the job finalizes the last file and reports the totals */
+    Perf->MetaData.State = CFE_ES_PERF_IDLE;
+    UtAssert_BOOL_FALSE(CFE_ES_RunPerfLogStream(1000, StreamState));
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(StreamState->FileDesc));
+    UtAssert_STUB_COUNT(OS_close, 2);
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STREAM_INF_EID);
+
+    /* Test a failure to create the stream file, entries are discarded */
+    ES_ResetUnitTest();
+    memset(StreamState, 0, sizeof(*StreamState));
+    Perf->MetaData.State         = CFE_ES_PERF_WAITING_FOR_TRIGGER;
+    Perf->MetaData.Mode          = CFE_ES_PerfTrigger_STREAM;
+    StreamState->Buffer[0].Count = 10;
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_ERROR);
+    UtAssert_BOOL_TRUE(CFE_ES_RunPerfLogStream(1000, StreamState));
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STREAM_ERR_EID);
+    UtAssert_BOOL_TRUE(StreamState->Failed);
+    UtAssert_UINT32_EQ(StreamState->DroppedEntries, 10);
+    UtAssert_UINT32_EQ(StreamState->Buffer[0].Count, 0);
+
+    /* Test a failure to write the stream file */
+    ES_ResetUnitTest();
+    memset(StreamState, 0, sizeof(*StreamState));
+    Perf->MetaData.State = CFE_ES_PERF_WAITING_FOR_TRIGGER;
+    Perf->MetaData.Mode  = CFE_ES_PerfTrigger_STREAM;
+    OS_OpenCreate(&StreamState->FileDesc, "UT", 0, OS_WRITE_ONLY);
+    StreamState->Buffer[0].Count = 10;
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, -10);
+    UtAssert_BOOL_TRUE(CFE_ES_RunPerfLogStream(1000, StreamState));
+    CFE_UtAssert_EVENTSENT(CFE_ES_FILEWRITE_ERR_EID);
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STREAM_ERR_EID);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(StreamState->FileDesc));
+    UtAssert_UINT32_EQ(StreamState->DroppedEntries, 10);
+
+    /* Test a failure to finalize the stream file header on close */
+    ES_ResetUnitTest();
+    memset(StreamState, 0, sizeof(*StreamState));
+    Perf->MetaData.State = CFE_ES_PERF_IDLE;
+    OS_OpenCreate(&StreamState->FileDesc, "UT", 0, OS_WRITE_ONLY);
+    UT_SetDefaultReturnValue(UT_KEY(OS_lseek), -1);
+    UtAssert_BOOL_FALSE(CFE_ES_RunPerfLogStream(1000, StreamState));
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STREAM_ERR_EID);
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STREAM_INF_EID);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(StreamState->FileDesc));
 }
 
 void TestAPI(void)
@@ -4326,6 +4617,20 @@ void TestAPI(void)
     ES_ResetUnitTest();
     ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, NULL, &UtAppRecPtr, NULL);
     CFE_UtAssert_SUCCESS(CFE_ES_CreateChildTask(&TaskId, "TaskName", TestAPI, StackBuf, sizeof(StackBuf), 400, 0));
+    UtAssert_STUB_COUNT(OS_TaskSetAffinity, 0);
+
+    /* Test that a child task is restricted to the same CPUs as the main task */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, NULL, &UtAppRecPtr, &UtTaskRecPtr);
+    UtTaskRecPtr->StartParams.CpuMask = 0x2;
+    CFE_UtAssert_SUCCESS(CFE_ES_CreateChildTask(&TaskId, "TaskName", TestAPI, StackBuf, sizeof(StackBuf), 400, 0));
+    UtAssert_STUB_COUNT(OS_TaskSetAffinity, 1);
+    UtAssert_UINT32_EQ(CFE_ES_LocateTaskRecordByID(TaskId)->StartParams.CpuMask, 0x2);
+
+    /* Failing to apply the affinity does not prevent the task from running */
+    UT_SetDefaultReturnValue(UT_KEY(OS_TaskSetAffinity), OS_ERR_NOT_IMPLEMENTED);
+    CFE_UtAssert_SUCCESS(CFE_ES_CreateChildTask(&TaskId, "TaskName", TestAPI, StackBuf, sizeof(StackBuf), 400, 0));
+    UtAssert_ZERO(CFE_ES_LocateTaskRecordByID(TaskId)->StartParams.CpuMask);
 
     /* Test common entry point */
     ES_ResetUnitTest();
@@ -4400,6 +4705,20 @@ void TestAPI(void)
     TaskId = CFE_ES_TASKID_UNDEFINED;
     UtAssert_INT32_EQ(CFE_ES_DeleteChildTask(TaskId), CFE_ES_ERR_RESOURCEID_NOT_VALID);
 
+    /* Test restricting a task to a set of CPUs */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, NULL, NULL, &UtTaskRecPtr);
+    TaskId = CFE_ES_TaskRecordGetID(UtTaskRecPtr);
+    CFE_UtAssert_SUCCESS(CFE_ES_SetTaskAffinity(TaskId, 0x1));
+    UtAssert_UINT32_EQ(UtTaskRecPtr->StartParams.CpuMask, 0x1);
+    UtAssert_INT32_EQ(CFE_ES_SetTaskAffinity(TaskId, 0), CFE_ES_BAD_ARGUMENT);
+    UT_SetDeferredRetcode(UT_KEY(OS_TaskSetAffinity), 1, OS_ERR_NOT_IMPLEMENTED);
+    UtAssert_INT32_EQ(CFE_ES_SetTaskAffinity(TaskId, 0x2), CFE_ES_NOT_IMPLEMENTED);
+    UT_SetDeferredRetcode(UT_KEY(OS_TaskSetAffinity), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_SetTaskAffinity(TaskId, 0x2), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+    UtAssert_UINT32_EQ(UtTaskRecPtr->StartParams.CpuMask, 0x1);
+    UtAssert_INT32_EQ(CFE_ES_SetTaskAffinity(CFE_ES_TASKID_UNDEFINED, 0x1), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+
     /* Test successfully exiting a child task */
     ES_ResetUnitTest();
     ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, NULL, &UtAppRecPtr, NULL);
@@ -4741,6 +5060,7 @@ void TestCDS()
     uint32               i;
     size_t               TempSize;
     uint8                BlockData[ES_UT_CDS_BLOCK_SIZE];
+    CFE_ES_CDSRange_t    Range;
 
     UtPrintf("Begin Test CDS");
 
@@ -4867,6 +5187,16 @@ void TestCDS()
     /* Copy to CDS with NULL */
     UtAssert_INT32_EQ(CFE_ES_CopyToCDS(CDSHandle, NULL), CFE_ES_BAD_ARGUMENT);
 
+    /* Test successfully copying a modified range to a CDS */
+    Range.Offset = 0;
+    Range.Size   = 1;
+    CFE_UtAssert_SUCCESS(CFE_ES_CopyRangesToCDS(CDSHandle, &BlockData, &Range, 1));
+
+    /* Copy ranges to CDS with NULL or empty arguments */
+    UtAssert_INT32_EQ(CFE_ES_CopyRangesToCDS(CDSHandle, NULL, &Range, 1), CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ES_CopyRangesToCDS(CDSHandle, &BlockData, NULL, 1), CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ES_CopyRangesToCDS(CDSHandle, &BlockData, &Range, 0), CFE_ES_BAD_ARGUMENT);
+
     /* Test successfully restoring from a CDS */
     CFE_UtAssert_SUCCESS(CFE_ES_RestoreFromCDS(&BlockData, CDSHandle));
 
@@ -4891,6 +5221,13 @@ void TestCDS()
     UtAssert_INT32_EQ(CFE_ES_RegisterCDS(&CDSHandle, CDS_ABS_MAX_BLOCK_SIZE + 1, "Name"), CFE_ES_CDS_INVALID_SIZE);
     UtAssert_INT32_EQ(CFE_ES_RegisterCDS(&CDSHandle, CDS_ABS_MAX_BLOCK_SIZE - 1, "Name"), CFE_ES_ERR_MEM_BLOCK_SIZE);
 
+    /* The per-chunk CRC table does not reduce the largest block that can be registered */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_CORE, CFE_ES_AppState_RUNNING, "UT", NULL, NULL);
+    ES_UT_SetupCDSGlobal(ES_UT_CDS_LARGE_TEST_SIZE);
+    CFE_UtAssert_SUCCESS(CFE_ES_RegisterCDS(
+        &CDSHandle, CFE_PLATFORM_ES_CDS_MAX_BLOCK_SIZE - sizeof(CFE_ES_CDS_BlockHeader_t), "Name"));
+
     /* Test memory pool rebuild and registry recovery with an
      * unreadable registry
      */
@@ -5088,6 +5425,7 @@ void TestCDSMempool(void)
     size_t               SavedSize;
     size_t               SavedOffset;
     void *               CdsPtr;
+    CFE_ES_CDSRange_t    Range;
 
     UtPrintf("Begin Test CDS memory pool");
 
@@ -5109,7 +5447,7 @@ void TestCDSMempool(void)
     ES_UT_SetupCDSGlobal(ES_UT_CDS_SMALL_TEST_SIZE);
     SavedSize   = CFE_ES_Global.CDSVars.TotalSize;
     SavedOffset = CFE_ES_Global.CDSVars.Pool.TailPosition;
-    ES_UT_SetupSingleCDSRegistry("UT", sizeof(Data) + sizeof(CFE_ES_CDS_BlockHeader_t), false, &UtCdsRegRecPtr);
+    ES_UT_SetupSingleCDSRegistry("UT", CFE_ES_CDSBlockSizeForUserSize(sizeof(Data)), false, &UtCdsRegRecPtr);
     UtAssert_NONZERO(UtCdsRegRecPtr->BlockOffset);
     UtAssert_NONZERO(UtCdsRegRecPtr->BlockSize);
     CFE_ES_DeleteCDS("UT", false);
@@ -5135,7 +5473,7 @@ void TestCDSMempool(void)
     /* Test CDS block access */
     ES_ResetUnitTest();
     ES_UT_SetupCDSGlobal(ES_UT_CDS_SMALL_TEST_SIZE);
-    ES_UT_SetupSingleCDSRegistry("UT", sizeof(Data) + sizeof(CFE_ES_CDS_BlockHeader_t), false, &UtCdsRegRecPtr);
+    ES_UT_SetupSingleCDSRegistry("UT", CFE_ES_CDSBlockSizeForUserSize(sizeof(Data)), false, &UtCdsRegRecPtr);
     BlockHandle = CFE_ES_CDSBlockRecordGetID(UtCdsRegRecPtr);
     Data        = 42;
 
@@ -5146,6 +5484,22 @@ void TestCDSMempool(void)
 
     UtAssert_INT32_EQ(Data, 42);
 
+    /* Partial update via a modified range */
+    Data         = 43;
+    Range.Offset = 0;
+    Range.Size   = sizeof(Data);
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWriteRanges(BlockHandle, &Data, &Range, 1));
+    Data = 0;
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockRead(&Data, BlockHandle));
+    UtAssert_INT32_EQ(Data, 43);
+
+    /* Modified range outside of the block */
+    Range.Offset = sizeof(Data);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRanges(BlockHandle, &Data, &Range, 1), CFE_ES_BAD_ARGUMENT);
+    Range.Offset = 0;
+    Range.Size   = 0;
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRanges(BlockHandle, &Data, &Range, 1), CFE_ES_BAD_ARGUMENT);
+
     /* Corrupt/change the block offset, should fail validation */
     --UtCdsRegRecPtr->BlockOffset;
     UtAssert_INT32_EQ(CFE_ES_CDSBlockWrite(BlockHandle, &Data), CFE_ES_POOL_BLOCK_INVALID);
@@ -5176,6 +5530,16 @@ void TestCDSMempool(void)
     UT_SetDeferredRetcode(UT_KEY(CFE_PSP_WriteToCDS), 2, OS_ERROR);
     UtAssert_INT32_EQ(CFE_ES_CDSBlockWrite(BlockHandle, &Data), CFE_ES_CDS_ACCESS_ERROR);
 
+    /* Test CDS block write with a CDS write error (chunk CRC table), which leaves the update uncommitted */
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_WriteToCDS), 3, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWrite(BlockHandle, &Data), CFE_ES_CDS_ACCESS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockRead(&Data, BlockHandle), CFE_ES_CDS_BLOCK_CRC_ERR);
+
+    /* Test CDS block write with a CDS read error (chunk CRC table) */
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_ReadFromCDS), 3, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWrite(BlockHandle, &Data), CFE_ES_CDS_ACCESS_ERROR);
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWrite(BlockHandle, &Data));
+
     /* Test CDS block read with a CDS read error (data content) */
     UT_SetDeferredRetcode(UT_KEY(CFE_PSP_ReadFromCDS), 3, OS_ERROR);
     UtAssert_INT32_EQ(CFE_ES_CDSBlockRead(&Data, BlockHandle), CFE_ES_CDS_ACCESS_ERROR);
@@ -5691,6 +6055,437 @@ void TestBackground(void)
     UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundTask.NumJobsRunning, 1);
 }
 
+void TestSnapshot(void)
+{
+    CFE_ES_WriteSnapshotCmd_t    WriteSnapshotCmd;
+    CFE_ES_AppRecord_t *         UtAppRecPtr;
+    CFE_FS_Header_t              FsHeader;
+    CFE_ES_SnapshotTableHeader_t TblHeader;
+    uint32                       RunStatus;
+    uint32                       Crc;
+    size_t                       ResetAreaSize;
+    int32                        ResetAreaWrites;
+    uint8                        TblData[sizeof(ES_UT_SnapshotTableData)];
+    struct
+    {
+        CFE_ES_SnapshotFileHeader_t Header;
+        uint8                       Data[3][128];
+    } ReadBuf;
+    struct
+    {
+        CFE_ES_SnapshotTableHeader_t Other;
+        CFE_ES_SnapshotTableHeader_t Match;
+        uint8                        Data[sizeof(ES_UT_SnapshotTableData)];
+    } TblReadBuf;
+
+    UtPrintf("Begin Test Snapshot");
+
+    /* Command sets the request pending and wakes the background task */
+    ES_ResetUnitTest();
+    memset(&WriteSnapshotCmd, 0, sizeof(WriteSnapshotCmd));
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(WriteSnapshotCmd.CommandHeader), sizeof(WriteSnapshotCmd),
+                    UT_TPID_CFE_ES_CMD_WRITE_SNAPSHOT_CC);
+    UtAssert_BOOL_TRUE(CFE_ES_Global.SnapshotState.Pending);
+    UtAssert_STRINGBUF_EQ(CFE_ES_Global.SnapshotState.FileName, sizeof(CFE_ES_Global.SnapshotState.FileName),
+                          CFE_PLATFORM_ES_DEFAULT_SNAPSHOT_FILE, sizeof(CFE_PLATFORM_ES_DEFAULT_SNAPSHOT_FILE));
+    UtAssert_STUB_COUNT(OS_BinSemGive, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.TaskData.CommandCounter, 1);
+
+    /* Second request while the first is still pending */
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(WriteSnapshotCmd.CommandHeader), sizeof(WriteSnapshotCmd),
+                    UT_TPID_CFE_ES_CMD_WRITE_SNAPSHOT_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_SNAPSHOT_ERR_EID);
+    UtAssert_UINT32_EQ(CFE_ES_Global.TaskData.CommandErrorCounter, 1);
+
+    /* Failure of parsing the file name */
+    ES_ResetUnitTest();
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_ParseInputFileNameEx), 1, CFE_FS_INVALID_PATH);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(WriteSnapshotCmd.CommandHeader), sizeof(WriteSnapshotCmd),
+                    UT_TPID_CFE_ES_CMD_WRITE_SNAPSHOT_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_SNAPSHOT_ERR_EID);
+    UtAssert_BOOL_FALSE(CFE_ES_Global.SnapshotState.Pending);
+
+    /* External app is held in the run loop until the snapshot completes */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, NULL, &UtAppRecPtr, NULL);
+    RunStatus                                 = CFE_ES_RunStatus_APP_RUN;
+    UtAppRecPtr->ControlReq.AppControlRequest = CFE_ES_RunStatus_APP_RUN;
+    CFE_ES_Global.SnapshotState.Pending       = true;
+    UT_SetHookFunction(UT_KEY(OS_TaskDelay), ES_UT_ClearSnapshotPendingHook, NULL);
+    UtAssert_BOOL_TRUE(CFE_ES_RunLoop(&RunStatus));
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.SnapshotState.ParkedApps, 0);
+
+    /* Core apps are never held */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_CORE, CFE_ES_AppState_RUNNING, NULL, &UtAppRecPtr, NULL);
+    UtAppRecPtr->ControlReq.AppControlRequest = CFE_ES_RunStatus_APP_RUN;
+    CFE_ES_Global.SnapshotState.Pending       = true;
+    UtAssert_BOOL_TRUE(CFE_ES_RunLoop(&RunStatus));
+    UtAssert_STUB_COUNT(OS_TaskDelay, 0);
+
+    /* Background job is idle when nothing is pending */
+    ES_ResetUnitTest();
+    UtAssert_BOOL_FALSE(CFE_ES_RunSnapshot(10, &CFE_ES_Global.SnapshotState));
+
+    /* Background job waits for the running app to park */
+    ES_ResetUnitTest();
+    ES_UT_SetupCDSGlobal(ES_UT_CDS_SMALL_TEST_SIZE);
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, NULL, NULL, NULL);
+    CFE_ES_Global.SnapshotState.Pending = true;
+    UtAssert_BOOL_TRUE(CFE_ES_RunSnapshot(10, &CFE_ES_Global.SnapshotState));
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+
+    /* Once parked, the file is written with all sections and the apps released */
+    CFE_ES_Global.SnapshotState.ParkedApps = 1;
+    UtAssert_BOOL_FALSE(CFE_ES_RunSnapshot(10, &CFE_ES_Global.SnapshotState));
+    CFE_UtAssert_EVENTSENT(CFE_ES_SNAPSHOT_INF_EID);
+    UtAssert_BOOL_FALSE(CFE_ES_Global.SnapshotState.Pending);
+    UtAssert_UINT32_EQ(CFE_ES_Global.SnapshotState.Header.NumSections, 3);
+    UtAssert_UINT32_EQ(CFE_ES_Global.SnapshotState.Header.Sections[1].Size, ES_UT_CDS_SMALL_TEST_SIZE);
+    UtAssert_UINT32_EQ(CFE_ES_Global.SnapshotState.Header.Sections[2].Type, CFE_ES_SnapshotSection_TABLES);
+    UtAssert_ZERO(CFE_ES_Global.SnapshotState.Header.Sections[2].Size);
+    UtAssert_ZERO(CFE_ES_Global.SnapshotState.Header.Sections[0].Offset % CFE_ES_SNAPSHOT_PAGE_SIZE);
+    UtAssert_ZERO(CFE_ES_Global.SnapshotState.Header.Sections[1].Offset % CFE_ES_SNAPSHOT_PAGE_SIZE);
+    UtAssert_ZERO(CFE_ES_Global.SnapshotState.Header.Sections[2].Offset % CFE_ES_SNAPSHOT_PAGE_SIZE);
+    UtAssert_STUB_COUNT(OS_rename, 1);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+
+    /* Quiesce timeout writes the file anyway; without a CDS only the reset area and tables are saved */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, NULL, NULL, NULL);
+    CFE_ES_Global.SnapshotState.Pending = true;
+    UtAssert_BOOL_FALSE(
+        CFE_ES_RunSnapshot(CFE_PLATFORM_ES_SNAPSHOT_QUIESCE_TIMEOUT_MSEC, &CFE_ES_Global.SnapshotState));
+    CFE_UtAssert_EVENTSENT(CFE_ES_SNAPSHOT_INF_EID);
+    UtAssert_UINT32_EQ(CFE_ES_Global.SnapshotState.Header.NumSections, 2);
+    UtAssert_UINT32_EQ(CFE_ES_Global.SnapshotState.Header.Sections[1].Type, CFE_ES_SnapshotSection_TABLES);
+
+    /* Each loaded table is saved as its header followed by its active buffer */
+    ES_ResetUnitTest();
+    memset(ES_UT_SnapshotTableData, 0xA5, sizeof(ES_UT_SnapshotTableData));
+    UT_SetHandlerFunction(UT_KEY(CFE_TBL_SnapshotTableGetter), ES_UT_SnapshotTableGetterHandler, NULL);
+    CFE_UtAssert_SUCCESS(CFE_ES_WriteSnapshotFile(&CFE_ES_Global.SnapshotState));
+    UtAssert_STUB_COUNT(CFE_TBL_SnapshotTableGetter, 2);
+    memset(&TblHeader, 0, sizeof(TblHeader));
+    strncpy(TblHeader.Name, "UT.Table", sizeof(TblHeader.Name) - 1);
+    TblHeader.Size = sizeof(ES_UT_SnapshotTableData);
+    Crc            = CFE_ES_CalculateCRC(&TblHeader, sizeof(TblHeader), 0, CFE_MISSION_ES_DEFAULT_CRC);
+    Crc = CFE_ES_CalculateCRC(ES_UT_SnapshotTableData, sizeof(ES_UT_SnapshotTableData), Crc, CFE_MISSION_ES_DEFAULT_CRC);
+    UtAssert_UINT32_EQ(CFE_ES_Global.SnapshotState.Header.Sections[1].Size,
+                       sizeof(TblHeader) + sizeof(ES_UT_SnapshotTableData));
+    UtAssert_UINT32_EQ(CFE_ES_Global.SnapshotState.Header.Sections[1].Crc, Crc);
+
+    /* Failure writing the table header and the table data */
+    UT_GetDataBuffer(UT_KEY(CFE_PSP_GetResetArea), NULL, &ResetAreaSize, NULL);
+    ResetAreaWrites = (ResetAreaSize + CFE_ES_SNAPSHOT_IO_BLOCK - 1) / CFE_ES_SNAPSHOT_IO_BLOCK;
+    ES_ResetUnitTest();
+    UT_SetHandlerFunction(UT_KEY(CFE_TBL_SnapshotTableGetter), ES_UT_SnapshotTableGetterHandler, NULL);
+    UT_SetDeferredRetcode(UT_KEY(OS_write), ResetAreaWrites + 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_WriteSnapshotFile(&CFE_ES_Global.SnapshotState), CFE_ES_FILE_IO_ERR);
+    ES_ResetUnitTest();
+    UT_SetHandlerFunction(UT_KEY(CFE_TBL_SnapshotTableGetter), ES_UT_SnapshotTableGetterHandler, NULL);
+    UT_SetDeferredRetcode(UT_KEY(OS_write), ResetAreaWrites + 2, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_WriteSnapshotFile(&CFE_ES_Global.SnapshotState), CFE_ES_FILE_IO_ERR);
+
+    /* File write errors are reported by event */
+    ES_ResetUnitTest();
+    CFE_ES_Global.SnapshotState.Pending = true;
+    UT_SetDeferredRetcode(UT_KEY(OS_OpenCreate), 1, OS_ERROR);
+    UtAssert_BOOL_FALSE(CFE_ES_RunSnapshot(10, &CFE_ES_Global.SnapshotState));
+    CFE_UtAssert_EVENTSENT(CFE_ES_SNAPSHOT_WR_ERR_EID);
+    UtAssert_BOOL_FALSE(CFE_ES_Global.SnapshotState.Pending);
+
+    ES_ResetUnitTest();
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_WriteHeader), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_WriteSnapshotFile(&CFE_ES_Global.SnapshotState), CFE_ES_FILE_IO_ERR);
+
+    /* A failed write leaves the previous file in place and removes the partial one */
+    ES_ResetUnitTest();
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_WriteSnapshotFile(&CFE_ES_Global.SnapshotState), CFE_ES_FILE_IO_ERR);
+    UtAssert_STUB_COUNT(OS_rename, 0);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+
+    ES_ResetUnitTest();
+    UT_SetDeferredRetcode(UT_KEY(OS_rename), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_WriteSnapshotFile(&CFE_ES_Global.SnapshotState), CFE_ES_FILE_IO_ERR);
+    UtAssert_STUB_COUNT(OS_remove, 1);
+
+    /* The temporary file name must fit */
+    ES_ResetUnitTest();
+    memset(CFE_ES_Global.SnapshotState.FileName, 'a', sizeof(CFE_ES_Global.SnapshotState.FileName) - 1);
+    UtAssert_INT32_EQ(CFE_ES_WriteSnapshotFile(&CFE_ES_Global.SnapshotState), CFE_ES_BAD_ARGUMENT);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    memset(CFE_ES_Global.SnapshotState.FileName, 0, sizeof(CFE_ES_Global.SnapshotState.FileName));
+
+    ES_ResetUnitTest();
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_WriteSnapshotFile(&CFE_ES_Global.SnapshotState), CFE_ES_FILE_IO_ERR);
+
+    ES_ResetUnitTest();
+    UT_SetDefaultReturnValue(UT_KEY(CFE_PSP_GetResetArea), CFE_PSP_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_WriteSnapshotFile(&CFE_ES_Global.SnapshotState), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+
+    ES_ResetUnitTest();
+    ES_UT_SetupCDSGlobal(ES_UT_CDS_SMALL_TEST_SIZE);
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_ReadFromCDS), 1, CFE_PSP_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_WriteSnapshotFile(&CFE_ES_Global.SnapshotState), CFE_ES_CDS_ACCESS_ERROR);
+
+    /* The reset area is written in IO_BLOCK pieces, the first CDS write follows them */
+    ES_ResetUnitTest();
+    ES_UT_SetupCDSGlobal(ES_UT_CDS_SMALL_TEST_SIZE);
+    UT_GetDataBuffer(UT_KEY(CFE_PSP_GetResetArea), NULL, &ResetAreaSize, NULL);
+    ResetAreaWrites = (ResetAreaSize + CFE_ES_SNAPSHOT_IO_BLOCK - 1) / CFE_ES_SNAPSHOT_IO_BLOCK;
+    UT_SetDeferredRetcode(UT_KEY(OS_write), ResetAreaWrites + 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_WriteSnapshotFile(&CFE_ES_Global.SnapshotState), CFE_ES_FILE_IO_ERR);
+
+    /* Restore: nothing to do without a file name or a file */
+    ES_ResetUnitTest();
+    UtAssert_INT32_EQ(CFE_ES_RestoreSnapshot(""), CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ES_RestoreSnapshot(NULL), CFE_ES_BAD_ARGUMENT);
+    UT_SetDeferredRetcode(UT_KEY(OS_OpenCreate), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_RestoreSnapshot("UT"), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+
+    /*
+     * Restore a CDS and a tables section: both verified first, then only the CDS is
+     * written.  The tables section is kept for table registration until the file is consumed.
+     */
+    ES_ResetUnitTest();
+    UT_SetCDSSize(sizeof(ReadBuf.Data[0]));
+    memset(&FsHeader, 0, sizeof(FsHeader));
+    FsHeader.ContentType = CFE_FS_FILE_CONTENT_ID;
+    FsHeader.SubType     = CFE_FS_SubType_ES_SNAPSHOT;
+    memset(&ReadBuf, 0, sizeof(ReadBuf));
+    ReadBuf.Header.Magic              = CFE_ES_SNAPSHOT_MAGIC;
+    ReadBuf.Header.Version            = CFE_ES_SNAPSHOT_VERSION;
+    ReadBuf.Header.PageSize           = CFE_ES_SNAPSHOT_PAGE_SIZE;
+    ReadBuf.Header.NumSections        = 2;
+    ReadBuf.Header.Sections[0].Type   = CFE_ES_SnapshotSection_CDS;
+    ReadBuf.Header.Sections[0].Offset = CFE_ES_SNAPSHOT_PAGE_SIZE;
+    ReadBuf.Header.Sections[0].Size   = sizeof(ReadBuf.Data[0]);
+    ReadBuf.Header.Sections[0].Crc =
+        CFE_ES_CalculateCRC(ReadBuf.Data[0], sizeof(ReadBuf.Data[0]), 0, CFE_MISSION_ES_DEFAULT_CRC);
+    ReadBuf.Header.Sections[1]        = ReadBuf.Header.Sections[0];
+    ReadBuf.Header.Sections[1].Type   = CFE_ES_SnapshotSection_TABLES;
+    ReadBuf.Header.Sections[1].Offset = 2 * CFE_ES_SNAPSHOT_PAGE_SIZE;
+    UT_SetDataBuffer(UT_KEY(CFE_FS_ReadHeader), &FsHeader, sizeof(FsHeader), false);
+    UT_SetReadBuffer(&ReadBuf, sizeof(ReadBuf));
+    UtAssert_INT32_EQ(CFE_ES_RestoreSnapshot("UT"), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(CFE_PSP_WriteToCDS, 1);
+    UtAssert_STUB_COUNT(OS_remove, 0);
+    UtAssert_STRINGBUF_EQ(CFE_ES_Global.SnapshotState.RestoreFileName,
+                          sizeof(CFE_ES_Global.SnapshotState.RestoreFileName), "UT", -1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.SnapshotState.RestoreTables.Offset, 2 * CFE_ES_SNAPSHOT_PAGE_SIZE);
+    UtAssert_UINT32_EQ(CFE_ES_Global.SnapshotState.RestoreTables.Size, sizeof(ReadBuf.Data[0]));
+
+    /* Table lookup skips other tables and copies the matching one */
+    memset(&TblReadBuf, 0, sizeof(TblReadBuf));
+    strncpy(TblReadBuf.Other.Name, "UT.Other", sizeof(TblReadBuf.Other.Name) - 1);
+    TblReadBuf.Other.Size = sizeof(TblReadBuf.Data);
+    strncpy(TblReadBuf.Match.Name, "UT.Table", sizeof(TblReadBuf.Match.Name) - 1);
+    strncpy(TblReadBuf.Match.LastFileLoaded, "/cf/ut.tbl", sizeof(TblReadBuf.Match.LastFileLoaded) - 1);
+    TblReadBuf.Match.Size = sizeof(TblReadBuf.Data);
+    memset(TblReadBuf.Data, 0x5A, sizeof(TblReadBuf.Data));
+    CFE_ES_Global.SnapshotState.RestoreTables.Size = 2 * (sizeof(TblHeader) + sizeof(TblReadBuf.Data));
+    memset(&TblHeader, 0, sizeof(TblHeader));
+    strncpy(TblHeader.Name, "UT.Table", sizeof(TblHeader.Name) - 1);
+    TblHeader.Size = sizeof(TblData);
+    UT_SetReadBuffer(&TblReadBuf, sizeof(TblReadBuf));
+    CFE_UtAssert_SUCCESS(CFE_ES_RestoreSnapshotTable(&TblHeader, TblData));
+    UtAssert_MemCmp(TblData, TblReadBuf.Data, sizeof(TblData), "Restored table data");
+    UtAssert_STRINGBUF_EQ(TblHeader.LastFileLoaded, sizeof(TblHeader.LastFileLoaded), "/cf/ut.tbl", -1);
+
+    /* A table with a different size is not a match, and the lookup ends with the section */
+    UT_ResetState(UT_KEY(OS_read));
+    UT_SetReadBuffer(&TblReadBuf, sizeof(TblReadBuf));
+    TblHeader.Size = sizeof(TblData) - 1;
+    UtAssert_INT32_EQ(CFE_ES_RestoreSnapshotTable(&TblHeader, TblData), CFE_ES_ERR_NAME_NOT_FOUND);
+    TblHeader.Size = sizeof(TblData);
+
+    /* File errors during the lookup */
+    UT_SetDeferredRetcode(UT_KEY(OS_OpenCreate), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_RestoreSnapshotTable(&TblHeader, TblData), CFE_ES_FILE_IO_ERR);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_RestoreSnapshotTable(&TblHeader, TblData), CFE_ES_FILE_IO_ERR);
+    UT_ResetState(UT_KEY(OS_read));
+    UT_SetReadBuffer(&TblReadBuf, sizeof(TblReadBuf));
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 3, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_RestoreSnapshotTable(&TblHeader, TblData), CFE_ES_FILE_IO_ERR);
+
+    /* Completing the restore removes the file, once, and ends the table lookup */
+    CFE_ES_CompleteSnapshotRestore();
+    UtAssert_STUB_COUNT(OS_remove, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.SnapshotState.RestoreFileName[0], 0);
+    UtAssert_INT32_EQ(CFE_ES_RestoreSnapshotTable(&TblHeader, TblData), CFE_ES_ERR_NAME_NOT_FOUND);
+    CFE_ES_CompleteSnapshotRestore();
+    UtAssert_STUB_COUNT(OS_remove, 1);
+
+    /* Failure to remove the file is logged */
+    strncpy(CFE_ES_Global.SnapshotState.RestoreFileName, "UT", sizeof(CFE_ES_Global.SnapshotState.RestoreFileName) - 1);
+    UT_SetDeferredRetcode(UT_KEY(OS_remove), 1, OS_ERROR);
+    CFE_ES_CompleteSnapshotRestore();
+    UtAssert_STUB_COUNT(OS_remove, 2);
+
+    /* Restore with a bad section CRC changes nothing */
+    ES_ResetUnitTest();
+    UT_SetCDSSize(sizeof(ReadBuf.Data[0]));
+    ReadBuf.Header.Sections[0].Crc ^= 1;
+    UT_SetDataBuffer(UT_KEY(CFE_FS_ReadHeader), &FsHeader, sizeof(FsHeader), false);
+    UT_SetReadBuffer(&ReadBuf, sizeof(ReadBuf));
+    UtAssert_INT32_EQ(CFE_ES_RestoreSnapshot("UT"), CFE_STATUS_VALIDATION_FAILURE);
+    UtAssert_STUB_COUNT(CFE_PSP_WriteToCDS, 0);
+    UtAssert_UINT32_EQ(CFE_ES_Global.SnapshotState.RestoreFileName[0], 0);
+
+    /* Restore with a CDS size that does not match this PSP */
+    ES_ResetUnitTest();
+    UT_SetCDSSize(2 * sizeof(ReadBuf.Data[0]));
+    UT_SetDataBuffer(UT_KEY(CFE_FS_ReadHeader), &FsHeader, sizeof(FsHeader), false);
+    UT_SetReadBuffer(&ReadBuf, sizeof(ReadBuf));
+    UtAssert_INT32_EQ(CFE_ES_RestoreSnapshot("UT"), CFE_STATUS_VALIDATION_FAILURE);
+
+    /* Restore of a file that is not a snapshot */
+    ES_ResetUnitTest();
+    ReadBuf.Header.Magic = 0;
+    UT_SetDataBuffer(UT_KEY(CFE_FS_ReadHeader), &FsHeader, sizeof(FsHeader), false);
+    UT_SetReadBuffer(&ReadBuf, sizeof(ReadBuf));
+    UtAssert_INT32_EQ(CFE_ES_RestoreSnapshot("UT"), CFE_STATUS_VALIDATION_FAILURE);
+
+    /* Restore with a short read of the headers */
+    ES_ResetUnitTest();
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_ReadHeader), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_RestoreSnapshot("UT"), CFE_ES_FILE_IO_ERR);
+}
+
+void TestAppResource(void)
+{
+    CFE_ES_SendHkCmd_t   SendHkCmd;
+    CFE_ES_AppRecord_t * UtAppRecPtr;
+    CFE_ES_TaskRecord_t *UtTaskRecPtr;
+    CFE_ES_AppInfo_t     AppInfo;
+    CFE_ES_AppCpuStats_t Stats;
+    CFE_ES_TaskRecord_t  TaskRec;
+    OS_time_t            Times[3];
+    OS_time_t            CpuTime;
+    uint32               RunStatus;
+
+    UtPrintf("Begin Test App Resource");
+
+    /* The main task's calls to the run loop delimit the loop iterations */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, NULL, &UtAppRecPtr, NULL);
+    RunStatus                                 = CFE_ES_RunStatus_APP_RUN;
+    UtAppRecPtr->ControlReq.AppControlRequest = CFE_ES_RunStatus_APP_RUN;
+    Times[0]                                  = OS_TimeFromTotalMicroseconds(1000);
+    Times[1]                                  = OS_TimeFromTotalMicroseconds(1500);
+    Times[2]                                  = OS_TimeFromTotalMicroseconds(3500);
+    UT_SetDataBuffer(UT_KEY(CFE_PSP_GetTime), Times, sizeof(Times), false);
+    UtAssert_BOOL_TRUE(CFE_ES_RunLoop(&RunStatus));
+    UtAssert_BOOL_TRUE(CFE_ES_RunLoop(&RunStatus));
+    UtAssert_BOOL_TRUE(CFE_ES_RunLoop(&RunStatus));
+    UtAssert_BOOL_TRUE(UtAppRecPtr->CpuStats.LoopValid);
+    UtAssert_UINT32_EQ(UtAppRecPtr->CpuStats.PeriodLoopCount, 2);
+    UtAssert_UINT32_EQ(UtAppRecPtr->CpuStats.PeriodMaxLoopUsec, 2000);
+
+    /* Calls to the run loop from another task of the app are not recorded */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, NULL, &UtAppRecPtr, NULL);
+    UtAppRecPtr->ControlReq.AppControlRequest = CFE_ES_RunStatus_APP_RUN;
+    UtAppRecPtr->MainTaskId                   = CFE_ES_TASKID_UNDEFINED;
+    UtAssert_BOOL_TRUE(CFE_ES_RunLoop(&RunStatus));
+    UtAssert_BOOL_FALSE(UtAppRecPtr->CpuStats.LoopValid);
+
+    /* A loop iteration too long for the statistics saturates */
+    memset(&Stats, 0, sizeof(Stats));
+    CFE_ES_AppCpuRecordLoop(&Stats, OS_TimeFromTotalSeconds(1));
+    CFE_ES_AppCpuRecordLoop(&Stats, OS_TimeFromTotalSeconds(10000));
+    UtAssert_UINT32_EQ(Stats.PeriodMaxLoopUsec, 0xFFFFFFFF);
+
+    /* A task sample charges the CPU time used since the previous sample */
+    ES_ResetUnitTest();
+    memset(&Stats, 0, sizeof(Stats));
+    memset(&TaskRec, 0, sizeof(TaskRec));
+    TaskRec.CpuTime = OS_TimeFromTotalMicroseconds(1000);
+    CpuTime         = OS_TimeFromTotalMicroseconds(1750);
+    UT_SetDataBuffer(UT_KEY(CFE_PSP_GetTaskCpuTime), &CpuTime, sizeof(CpuTime), false);
+    CFE_ES_TaskCpuSample(&TaskRec, &Stats);
+    UtAssert_INT32_EQ(OS_TimeGetTotalMicroseconds(Stats.PeriodCpuTime), 750);
+    UtAssert_INT32_EQ(OS_TimeGetTotalMicroseconds(TaskRec.CpuTime), 1750);
+
+    /* Nothing is charged if the PSP cannot provide the CPU time */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_PSP_GetTaskCpuTime), CFE_PSP_ERROR_NOT_IMPLEMENTED);
+    CFE_ES_TaskCpuSample(&TaskRec, &Stats);
+    UtAssert_INT32_EQ(OS_TimeGetTotalMicroseconds(Stats.PeriodCpuTime), 750);
+    UtAssert_INT32_EQ(OS_TimeGetTotalMicroseconds(TaskRec.CpuTime), 1750);
+
+    /* Closing the period publishes the usage and restarts the period statistics */
+    memset(&Stats, 0, sizeof(Stats));
+    Stats.PeriodCpuTime     = OS_TimeFromTotalMicroseconds(250000);
+    Stats.PeriodLoopCount   = 4;
+    Stats.PeriodMaxLoopUsec = 100000;
+    CFE_ES_AppCpuClosePeriod(&Stats, OS_TimeFromTotalSeconds(10), 1000000);
+    UtAssert_UINT32_EQ(Stats.CpuUtilization, 2500);
+    UtAssert_UINT32_EQ(Stats.MaxRunLoopTime, 100000);
+    UtAssert_UINT32_EQ(Stats.RunLoopCount, 4);
+    UtAssert_UINT32_EQ(Stats.PeriodLoopCount, 0);
+    UtAssert_UINT32_EQ(Stats.PeriodMaxLoopUsec, 0);
+    UtAssert_INT32_EQ(OS_TimeGetTotalMicroseconds(Stats.PeriodCpuTime), 0);
+
+    /* Several tasks may use more than one CPU */
+    Stats.PeriodCpuTime = OS_TimeFromTotalMicroseconds(1750000);
+    CFE_ES_AppCpuClosePeriod(&Stats, OS_TimeFromTotalSeconds(10), 1000000);
+    UtAssert_UINT32_EQ(Stats.CpuUtilization, 17500);
+
+    /* An iteration still in progress at the end of the period counts */
+    Stats.LoopValid    = true;
+    Stats.LastLoopTime = OS_TimeFromTotalMicroseconds(7000000);
+    CFE_ES_AppCpuClosePeriod(&Stats, OS_TimeFromTotalSeconds(10), 1000000);
+    UtAssert_UINT32_EQ(Stats.MaxRunLoopTime, 3000000);
+    UtAssert_UINT32_EQ(Stats.RunLoopCount, 0);
+
+    /* An empty period reports no utilization */
+    Stats.PeriodCpuTime = OS_TimeFromTotalMicroseconds(1000);
+    CFE_ES_AppCpuClosePeriod(&Stats, OS_TimeFromTotalSeconds(10), 0);
+    UtAssert_UINT32_EQ(Stats.CpuUtilization, 0);
+
+    /* The housekeeping request samples every task and sends the usage of every app */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, NULL, &UtAppRecPtr, &UtTaskRecPtr);
+    UtTaskRecPtr->CpuTime                         = OS_TimeFromTotalMicroseconds(1000000);
+    CpuTime                                       = OS_TimeFromTotalMicroseconds(1500000);
+    UtAppRecPtr->CpuStats.LoopValid               = true;
+    UtAppRecPtr->CpuStats.LastLoopTime            = OS_TimeAssembleFromNanoseconds(100, 190000);
+    UtAppRecPtr->CpuStats.PeriodMaxLoopUsec       = 20000;
+    UtAppRecPtr->CpuStats.PeriodLoopCount         = 10;
+    CFE_ES_Global.TaskData.AppResourcePeriodStart = OS_TimeAssembleFromNanoseconds(99, 200000);
+    UT_SetDataBuffer(UT_KEY(CFE_PSP_GetTaskCpuTime), &CpuTime, sizeof(CpuTime), false);
+    memset(&SendHkCmd, 0, sizeof(SendHkCmd));
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(SendHkCmd.CommandHeader), sizeof(SendHkCmd), UT_TPID_CFE_ES_SEND_HK);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 2);
+    UtAssert_STUB_COUNT(CFE_PSP_GetTaskCpuTime, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.TaskData.AppResourcePacket.Payload.SamplePeriodMsec, 1000);
+    UtAssert_UINT32_EQ(CFE_ES_Global.TaskData.AppResourcePacket.Payload.NumApps, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.TaskData.AppResourcePacket.Payload.Apps[0].CpuUtilization, 5000);
+    UtAssert_UINT32_EQ(CFE_ES_Global.TaskData.AppResourcePacket.Payload.Apps[0].MaxRunLoopTime, 20000);
+    UtAssert_UINT32_EQ(CFE_ES_Global.TaskData.AppResourcePacket.Payload.Apps[0].RunLoopCount, 10);
+    UtAssert_BOOL_TRUE(CFE_RESOURCEID_TEST_EQUAL(CFE_ES_Global.TaskData.AppResourcePacket.Payload.Apps[0].AppId,
+                                                 CFE_ES_AppRecordGetID(UtAppRecPtr)));
+    UtAssert_BOOL_FALSE(CFE_RESOURCEID_TEST_DEFINED(CFE_ES_Global.TaskData.AppResourcePacket.Payload.Apps[1].AppId));
+
+    /* The published values are also reported in the app info */
+    CFE_UtAssert_SUCCESS(CFE_ES_GetAppInfo(&AppInfo, CFE_ES_AppRecordGetID(UtAppRecPtr)));
+    UtAssert_UINT32_EQ(AppInfo.CpuUtilization, 5000);
+    UtAssert_UINT32_EQ(AppInfo.MaxRunLoopTime, 20000);
+
+    /* Tasks whose parent app is gone are not charged to anyone */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, NULL, &UtAppRecPtr, &UtTaskRecPtr);
+    UtTaskRecPtr->AppId = CFE_ES_APPID_UNDEFINED;
+    memset(&SendHkCmd, 0, sizeof(SendHkCmd));
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(SendHkCmd.CommandHeader), sizeof(SendHkCmd), UT_TPID_CFE_ES_SEND_HK);
+    UtAssert_STUB_COUNT(CFE_PSP_GetTaskCpuTime, 0);
+}
+
 /*--------------------------------------------------------------------------------*
  * TestStatusToString test helper function to avoid repeating logic
  *--------------------------------------------------------------------------------*/
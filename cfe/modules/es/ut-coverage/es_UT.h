@@ -162,6 +162,38 @@ void TestTask(void);
 ******************************************************************************/
 void TestBackground(void);
 
+/*****************************************************************************/
+/**
+** \brief Performs tests of the state snapshot functions contained in
+**        cfe_es_snapshot.c
+**
+** \par Description
+**        Gets Coverage on all lines/functions in this unit
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void TestSnapshot(void);
+
+/*****************************************************************************/
+/**
+** \brief Performs tests of the per-application CPU accounting in
+**        cfe_es_api.c, cfe_es_apps.c and cfe_es_task.c
+**
+** \par Description
+**        Gets Coverage on all lines/functions in this unit
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void TestAppResource(void);
+
 /*****************************************************************************/
 /**
 ** \brief Performs tests on the functions that implement the software timing
@@ -748,6 +748,8 @@ bool CFE_FS_RunBackgroundFileDump(uint32 ElapsedTime, void *Arg)
                 State->FileSize = sizeof(CFE_FS_Header_t);
                 State->Credit -= sizeof(CFE_FS_Header_t);
                 State->RecordNum = 0;
+                State->UseAsync  = true;
+                State->FillIdx   = 0;
             }
         }
     }
@@ -769,15 +771,17 @@ bool CFE_FS_RunBackgroundFileDump(uint32 ElapsedTime, void *Arg)
             State->Credit -= RecordSize;
 
             /*
-             * Now write to file
+             * Now stage the record for writing.  Staging buffers are written
+             * asynchronously as they fill, so the file I/O overlaps with the
+             * getter producing the following records.
              */
-            OsStatus = OS_write(State->Fd, RecordPtr, RecordSize);
+            OsStatus = CFE_FS_BackgroundWrite(State, RecordPtr, RecordSize);
 
-            if (OsStatus != RecordSize)
+            if (OsStatus != OS_SUCCESS)
             {
-                /* end the file early (cannot set "IsEOF" as this would cause the complete event to be generated too) */
-                OS_close(State->Fd);
-                State->Fd = OS_OBJECT_ID_UNDEFINED;
+                /* end the file early (clear "IsEOF" as this would cause the complete event to be generated too) */
+                CFE_FS_BackgroundClose(State, false);
+                IsEOF = false;
 
                 /* generate write error event */
                 /* NOTE: This converts the OSAL status directly into a CFE status for logging */
@@ -794,14 +798,22 @@ bool CFE_FS_RunBackgroundFileDump(uint32 ElapsedTime, void *Arg)
         ++State->RecordNum;
     }
 
-    /* On normal EOF close the file and generate the complete event */
+    /* On normal EOF write out the remaining data, close the file and generate the complete event */
     if (IsEOF)
     {
-        OS_close(State->Fd);
-        State->Fd = OS_OBJECT_ID_UNDEFINED;
+        OsStatus = CFE_FS_BackgroundClose(State, true);
 
-        /* generate complete event */
-        Meta->OnEvent(Meta, CFE_FS_FileWriteEvent_COMPLETE, CFE_SUCCESS, State->RecordNum, 0, State->FileSize);
+        if (OsStatus != OS_SUCCESS)
+        {
+            /* NOTE: This converts the OSAL status directly into a CFE status for logging */
+            Meta->OnEvent(Meta, CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR, (long)OsStatus, State->RecordNum, 0,
+                          State->FileSize);
+        }
+        else
+        {
+            /* generate complete event */
+            Meta->OnEvent(Meta, CFE_FS_FileWriteEvent_COMPLETE, CFE_SUCCESS, State->RecordNum, 0, State->FileSize);
+        }
     }
 
     /*
@@ -101,3 +101,167 @@ void CFE_FS_UnlockSharedData(const char *FunctionName)
                              CFE_RESOURCEID_TO_ULONG(AppId), FunctionName);
     }
 }
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_FS_BackgroundWaitBuffer(CFE_FS_BackgroundBuffer_t *Buf)
+{
+    int32 OsStatus;
+
+    OsStatus = OS_SUCCESS;
+
+    if (Buf->Submitted)
+    {
+        OsStatus = OS_AsyncWait(&Buf->Req, OS_PEND);
+        if (OsStatus == OS_SUCCESS && Buf->Req.Result != Buf->Length)
+        {
+            OsStatus = (Buf->Req.Result < 0) ? Buf->Req.Result : OS_ERROR;
+        }
+
+        Buf->Submitted = false;
+        Buf->Length    = 0;
+    }
+
+    return OsStatus;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_FS_BackgroundFlush(CFE_FS_CurrentFileState_t *State)
+{
+    CFE_FS_BackgroundBuffer_t *Buf;
+    int32                      OsStatus;
+
+    Buf = &State->Buffers[State->FillIdx];
+    if (Buf->Length == 0)
+    {
+        return OS_SUCCESS;
+    }
+
+    OsStatus = OS_ERR_NOT_IMPLEMENTED;
+    if (State->UseAsync)
+    {
+        OsStatus = OS_AsyncWrite(State->Fd, Buf->Data, Buf->Length, &Buf->Req);
+    }
+
+    if (OsStatus == OS_SUCCESS)
+    {
+        Buf->Submitted = true;
+
+        /* The next buffer may still be in flight from an earlier flush */
+        State->FillIdx = (State->FillIdx + 1) % CFE_FS_BACKGROUND_NUM_BUFFERS;
+        OsStatus       = CFE_FS_BackgroundWaitBuffer(&State->Buffers[State->FillIdx]);
+    }
+    else if (OsStatus == OS_ERR_NOT_IMPLEMENTED)
+    {
+        /* No asynchronous I/O on this platform, write it out directly for the rest of this file */
+        State->UseAsync = false;
+
+        OsStatus = OS_write(State->Fd, Buf->Data, Buf->Length);
+        if (OsStatus == Buf->Length)
+        {
+            OsStatus = OS_SUCCESS;
+        }
+        else if (OsStatus >= 0)
+        {
+            OsStatus = OS_ERROR;
+        }
+
+        Buf->Length = 0;
+    }
+
+    return OsStatus;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_FS_BackgroundWrite(CFE_FS_CurrentFileState_t *State, const void *Data, size_t Size)
+{
+    CFE_FS_BackgroundBuffer_t *Buf;
+    int32                      OsStatus;
+
+    OsStatus = OS_SUCCESS;
+    Buf      = &State->Buffers[State->FillIdx];
+
+    if (Buf->Length + Size > sizeof(Buf->Data))
+    {
+        OsStatus = CFE_FS_BackgroundFlush(State);
+        Buf      = &State->Buffers[State->FillIdx];
+    }
+
+    if (OsStatus == OS_SUCCESS)
+    {
+        if (Size > sizeof(Buf->Data))
+        {
+            /*
+             * Too large to stage.  OSAL reserves the file region of each asynchronous
+             * write when it is submitted, so this lands after any data still in flight.
+             */
+            OsStatus = OS_write(State->Fd, Data, Size);
+            if (OsStatus == Size)
+            {
+                OsStatus = OS_SUCCESS;
+            }
+            else if (OsStatus >= 0)
+            {
+                OsStatus = OS_ERROR;
+            }
+        }
+        else
+        {
+            memcpy(&Buf->Data[Buf->Length], Data, Size);
+            Buf->Length += Size;
+        }
+    }
+
+    return OsStatus;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_FS_BackgroundClose(CFE_FS_CurrentFileState_t *State, bool Flush)
+{
+    int32  OsStatus;
+    int32  WaitStatus;
+    uint32 i;
+
+    OsStatus = OS_SUCCESS;
+    if (Flush)
+    {
+        OsStatus = CFE_FS_BackgroundFlush(State);
+    }
+
+    /* All writes must be complete before the file is closed and the buffers reused */
+    for (i = 0; i < CFE_FS_BACKGROUND_NUM_BUFFERS; ++i)
+    {
+        WaitStatus = CFE_FS_BackgroundWaitBuffer(&State->Buffers[i]);
+        if (OsStatus == OS_SUCCESS)
+        {
+            OsStatus = WaitStatus;
+        }
+        State->Buffers[i].Length = 0;
+    }
+
+    State->FillIdx = 0;
+
+    OS_close(State->Fd);
+    State->Fd = OS_OBJECT_ID_UNDEFINED;
+
+    return OsStatus;
+}
@@ -34,6 +34,7 @@
 ** Includes
 */
 #include "common_types.h"
+#include "osapi.h"
 #include "cfe_fs_api_typedefs.h"
 #include "cfe_es_api_typedefs.h"
 
@@ -72,6 +73,20 @@
  */
 #define CFE_FS_BACKGROUND_MAX_CREDIT 10000
 
+/*
+ * Size of each background file staging buffer
+ *
+ * Records are copied into one staging buffer while the other is being
+ * written asynchronously, so the record getters and the file I/O overlap.
+ * Records larger than this are written directly.
+ */
+#define CFE_FS_BACKGROUND_BUFFER_SIZE 4096
+
+/*
+ * Number of background file staging buffers
+ */
+#define CFE_FS_BACKGROUND_NUM_BUFFERS 2
+
 /*
 ** Type Definitions
 */
@@ -88,12 +103,27 @@ typedef struct
     CFE_FS_FileWriteMetaData_t *Meta;
 } CFE_FS_BackgroundFileDumpEntry_t;
 
+/*
+ * Background file staging buffer
+ */
+typedef struct
+{
+    OS_AsyncIo_t Req;       /**< Asynchronous write request for this buffer */
+    bool         Submitted; /**< Set while the buffer contents are being written */
+    size_t       Length;    /**< Number of bytes staged in the buffer */
+    uint8        Data[CFE_FS_BACKGROUND_BUFFER_SIZE];
+} CFE_FS_BackgroundBuffer_t;
+
 typedef struct
 {
     osal_id_t Fd;
     int32     Credit;
     uint32    RecordNum;
     size_t    FileSize;
+    bool      UseAsync; /**< Cleared if the platform does not implement asynchronous writes */
+    uint32    FillIdx;  /**< Index of the staging buffer being filled */
+
+    CFE_FS_BackgroundBuffer_t Buffers[CFE_FS_BACKGROUND_NUM_BUFFERS];
 } CFE_FS_CurrentFileState_t;
 
 /*---------------------------------------------------------------------------------------*/
@@ -176,4 +206,54 @@ void CFE_FS_ByteSwapCFEHeader(CFE_FS_Header_t *Hdr);
  */
 void CFE_FS_ByteSwapUint32(uint32 *Uint32ToSwapPtr);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Stage a record for the background file write
+ *
+ * The record is copied into the current staging buffer.  Full staging buffers
+ * are handed to OSAL for asynchronous writing, waiting only if the next staging
+ * buffer is still being written.
+ *
+ * @param State  The current file state
+ * @param Data   The record data
+ * @param Size   The record size
+ *
+ * @returns OS_SUCCESS, or the OSAL status of a failed write
+ */
+int32 CFE_FS_BackgroundWrite(CFE_FS_CurrentFileState_t *State, const void *Data, size_t Size);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Submit the current background staging buffer for writing
+ *
+ * Switches to the next staging buffer, waiting for it to be free.  Falls back
+ * to a synchronous write if asynchronous writes are not implemented.
+ *
+ * @param State  The current file state
+ *
+ * @returns OS_SUCCESS, or the OSAL status of a failed write
+ */
+int32 CFE_FS_BackgroundFlush(CFE_FS_CurrentFileState_t *State);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Wait for a background staging buffer write to complete
+ *
+ * @param Buf  The staging buffer
+ *
+ * @returns OS_SUCCESS, or the OSAL status of a failed write
+ */
+int32 CFE_FS_BackgroundWaitBuffer(CFE_FS_BackgroundBuffer_t *Buf);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Complete all outstanding background writes and close the file
+ *
+ * @param State  The current file state
+ * @param Flush  Whether to write any staged data before closing
+ *
+ * @returns OS_SUCCESS, or the OSAL status of the first failed write
+ */
+int32 CFE_FS_BackgroundClose(CFE_FS_CurrentFileState_t *State, bool Flush);
+
 #endif /* CFE_FS_PRIV_H */
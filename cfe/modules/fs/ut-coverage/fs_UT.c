@@ -83,6 +83,7 @@ void UtTest_Setup(void)
     UT_ADD_TEST(Test_CFE_FS_Private);
 
     UT_ADD_TEST(Test_CFE_FS_BackgroundFileDump);
+    UT_ADD_TEST(Test_CFE_FS_BackgroundBuffers);
 }
 
 /*
@@ -618,17 +619,26 @@ void Test_CFE_FS_BackgroundFileDump(void)
     /* No more pending requests */
     UtAssert_UINT32_EQ(CFE_FS_Global.FileDump.CompleteCount, CFE_FS_Global.FileDump.RequestCount);
 
-    /* Error writing data */
+    /* Error writing data - enough credit to fill a staging buffer */
     CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State));
-    UT_SetDeferredRetcode(UT_KEY(OS_write), 2, OS_ERROR);
+    UT_SetDeferredRetcode(UT_KEY(OS_AsyncWrite), 1, OS_ERROR);
     UT_SetDataBuffer(UT_KEY(UT_FS_DataGetter), MyBuffer, sizeof(MyBuffer), false);
-    UtAssert_BOOL_TRUE(CFE_FS_RunBackgroundFileDump(100, NULL));
+    UtAssert_BOOL_TRUE(CFE_FS_RunBackgroundFileDump(1000, NULL));
     /* record error event was sent */
     UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR], 1);
     UtAssert_BOOL_FALSE(CFE_FS_BackgroundFileDumpIsPending(&State));
     /* No more pending requests */
     UtAssert_UINT32_EQ(CFE_FS_Global.FileDump.CompleteCount, CFE_FS_Global.FileDump.RequestCount);
 
+    /* Error writing the remaining staged data at EOF */
+    CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State));
+    UT_SetDeferredRetcode(UT_KEY(OS_AsyncWrite), 1, OS_ERROR);
+    UT_SetDeferredRetcode(UT_KEY(UT_FS_DataGetter), 2, true); /* return EOF */
+    UtAssert_BOOL_FALSE(CFE_FS_RunBackgroundFileDump(100, NULL));
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR], 2);
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_COMPLETE], 1);
+    UtAssert_BOOL_FALSE(CFE_FS_BackgroundFileDumpIsPending(&State));
+
     UT_ResetState(UT_KEY(UT_FS_DataGetter));
 
     /* Request multiple file dumps, check queuing logic */
@@ -659,3 +669,93 @@ void Test_CFE_FS_BackgroundFileDump(void)
     UT_SetDeferredRetcode(UT_KEY(UT_FS_DataGetter), 2, true); /* avoid infinite loop */
     UtAssert_BOOL_FALSE(CFE_FS_RunBackgroundFileDump(100, NULL));
 }
+
+void Test_CFE_FS_BackgroundBuffers(void)
+{
+    /*
+     * Test routine for:
+     * int32 CFE_FS_BackgroundWrite(CFE_FS_CurrentFileState_t *State, const void *Data, size_t Size)
+     * int32 CFE_FS_BackgroundFlush(CFE_FS_CurrentFileState_t *State)
+     * int32 CFE_FS_BackgroundWaitBuffer(CFE_FS_BackgroundBuffer_t *Buf)
+     * int32 CFE_FS_BackgroundClose(CFE_FS_CurrentFileState_t *State, bool Flush)
+     */
+    CFE_FS_CurrentFileState_t *State;
+    static uint8               Record[CFE_FS_BACKGROUND_BUFFER_SIZE + 1];
+
+    UT_ResetState(0);
+
+    State = &CFE_FS_Global.FileDump.Current;
+    memset(State, 0, sizeof(*State));
+    State->UseAsync = true;
+    OS_OpenCreate(&State->Fd, "/ram/UT.bin", OS_FILE_FLAG_CREATE, OS_WRITE_ONLY);
+
+    /* Nothing staged */
+    UtAssert_INT32_EQ(CFE_FS_BackgroundFlush(State), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_AsyncWrite, 0);
+
+    /* Nominal staging, a full buffer is submitted and the other becomes the fill buffer */
+    UtAssert_INT32_EQ(CFE_FS_BackgroundWrite(State, Record, CFE_FS_BACKGROUND_BUFFER_SIZE / 2), OS_SUCCESS);
+    UtAssert_UINT32_EQ(State->Buffers[0].Length, CFE_FS_BACKGROUND_BUFFER_SIZE / 2);
+    UtAssert_INT32_EQ(CFE_FS_BackgroundWrite(State, Record, CFE_FS_BACKGROUND_BUFFER_SIZE / 2), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_AsyncWrite, 0);
+    UtAssert_INT32_EQ(CFE_FS_BackgroundWrite(State, Record, 1), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_AsyncWrite, 1);
+    UtAssert_UINT32_EQ(State->FillIdx, 1);
+    UtAssert_BOOL_TRUE(State->Buffers[0].Submitted);
+    UtAssert_UINT32_EQ(State->Buffers[1].Length, 1);
+
+    /* Completed write is collected */
+    UtAssert_INT32_EQ(CFE_FS_BackgroundWaitBuffer(&State->Buffers[0]), OS_SUCCESS);
+    UtAssert_BOOL_FALSE(State->Buffers[0].Submitted);
+    UtAssert_UINT32_EQ(State->Buffers[0].Length, 0);
+
+    /* Failed or short completion */
+    State->Buffers[0].Submitted  = true;
+    State->Buffers[0].Length     = 10;
+    State->Buffers[0].Req.Result = OS_ERROR;
+    UtAssert_INT32_EQ(CFE_FS_BackgroundWaitBuffer(&State->Buffers[0]), OS_ERROR);
+    State->Buffers[0].Submitted  = true;
+    State->Buffers[0].Length     = 10;
+    State->Buffers[0].Req.Result = 5;
+    UtAssert_INT32_EQ(CFE_FS_BackgroundWaitBuffer(&State->Buffers[0]), OS_ERROR);
+
+    /* Records larger than a staging buffer are written directly */
+    UtAssert_INT32_EQ(CFE_FS_BackgroundWrite(State, Record, sizeof(Record)), OS_SUCCESS);
+    UtAssert_STUB_COUNT(OS_AsyncWrite, 2);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, 1);
+    UtAssert_INT32_EQ(CFE_FS_BackgroundWrite(State, Record, sizeof(Record)), OS_ERROR);
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, OS_ERR_INVALID_ID);
+    UtAssert_INT32_EQ(CFE_FS_BackgroundWrite(State, Record, sizeof(Record)), OS_ERR_INVALID_ID);
+
+    /* No asynchronous I/O - fall back to synchronous writes for the rest of the file */
+    UtAssert_INT32_EQ(CFE_FS_BackgroundWrite(State, Record, 8), OS_SUCCESS);
+    UT_SetDeferredRetcode(UT_KEY(OS_AsyncWrite), 1, OS_ERR_NOT_IMPLEMENTED);
+    UtAssert_INT32_EQ(CFE_FS_BackgroundFlush(State), OS_SUCCESS);
+    UtAssert_BOOL_FALSE(State->UseAsync);
+    UtAssert_STUB_COUNT(OS_write, 4);
+    UtAssert_INT32_EQ(CFE_FS_BackgroundWrite(State, Record, 8), OS_SUCCESS);
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, 1);
+    UtAssert_INT32_EQ(CFE_FS_BackgroundFlush(State), OS_ERROR);
+    UtAssert_INT32_EQ(CFE_FS_BackgroundWrite(State, Record, 8), OS_SUCCESS);
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, OS_ERR_INVALID_ID);
+    UtAssert_INT32_EQ(CFE_FS_BackgroundFlush(State), OS_ERR_INVALID_ID);
+    UtAssert_STUB_COUNT(OS_AsyncWrite, 3);
+
+    /* Close waits for all outstanding writes and reports the first failure */
+    State->UseAsync              = true;
+    State->Buffers[1].Submitted  = true;
+    State->Buffers[1].Length     = 10;
+    State->Buffers[1].Req.Result = OS_ERROR;
+    UtAssert_INT32_EQ(CFE_FS_BackgroundClose(State, true), OS_ERROR);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(State->Fd));
+    UtAssert_UINT32_EQ(State->FillIdx, 0);
+    UtAssert_BOOL_FALSE(State->Buffers[1].Submitted);
+
+    OS_OpenCreate(&State->Fd, "/ram/UT.bin", OS_FILE_FLAG_CREATE, OS_WRITE_ONLY);
+    UtAssert_INT32_EQ(CFE_FS_BackgroundWrite(State, Record, 8), OS_SUCCESS);
+    UtAssert_INT32_EQ(CFE_FS_BackgroundClose(State, false), OS_SUCCESS);
+    UtAssert_UINT32_EQ(State->Buffers[0].Length, 0);
+    UtAssert_STUB_COUNT(OS_AsyncWrite, 3);
+}
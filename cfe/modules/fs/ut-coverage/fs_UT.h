@@ -312,4 +312,17 @@ void Test_CFE_FS_GetUncompressedFile(void);
 ******************************************************************************/
 void Test_CFE_FS_BackgroundFileDump(void);
 
+/*****************************************************************************/
+/**
+** \brief Tests for FS background file staging buffers
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+******************************************************************************/
+void Test_CFE_FS_BackgroundBuffers(void);
+
 #endif /* FS_UT_H */
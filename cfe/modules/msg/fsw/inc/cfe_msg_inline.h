@@ -0,0 +1,208 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Inline implementations of the most frequently used message header accessors
+ *
+ * These have the same semantics (including argument checks and return codes) as
+ * the out-of-line implementations in this module, but with the header layout
+ * fixed at build time the compiler can reduce each call to a few loads and
+ * stores, and drop the argument checks when the pointers are known to be valid.
+ *
+ * When the mission enables MISSION_MSG_INLINE_ACCESSORS, cfe_msg.h includes
+ * this file and maps the corresponding API calls onto these implementations.
+ */
+
+#ifndef CFE_MSG_INLINE_H
+#define CFE_MSG_INLINE_H
+
+/*
+ * Include Files
+ */
+#include "common_types.h"
+#include "cfe_error.h"
+#include "cfe_msg_hdr.h"
+#include "cfe_msg_api_typedefs.h"
+#include "cfe_sb.h"
+
+/*
+ * Defines, these must match the out-of-line implementation
+ */
+#define CFE_MSG_INLINE_SIZE_OFFSET 7      /**< \brief CCSDS size offset */
+#define CFE_MSG_INLINE_TYPE_MASK   0x1000 /**< \brief CCSDS type mask, command when set */
+#define CFE_MSG_INLINE_SHDR_MASK   0x0800 /**< \brief CCSDS secondary header mask, exists when set*/
+#define CFE_MSG_INLINE_SEQCNT_MASK 0x3FFF /**< \brief CCSDS Sequence count mask */
+#define CFE_MSG_INLINE_FC_MASK     0x7F   /**< \brief Function code mask */
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Inline implementation of CFE_MSG_GetType()
+ */
+static inline CFE_Status_t CFE_MSG_Inline_GetType(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_Type_t *Type)
+{
+    if (MsgPtr == NULL || Type == NULL)
+    {
+        return CFE_MSG_BAD_ARGUMENT;
+    }
+
+    if ((MsgPtr->CCSDS.Pri.StreamId[0] & (CFE_MSG_INLINE_TYPE_MASK >> 8)) != 0)
+    {
+        *Type = CFE_MSG_Type_Cmd;
+    }
+    else
+    {
+        *Type = CFE_MSG_Type_Tlm;
+    }
+
+    return CFE_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Inline implementation of CFE_MSG_GetHasSecondaryHeader()
+ */
+static inline CFE_Status_t CFE_MSG_Inline_GetHasSecondaryHeader(const CFE_MSG_Message_t *MsgPtr, bool *HasSecondary)
+{
+    if (MsgPtr == NULL || HasSecondary == NULL)
+    {
+        return CFE_MSG_BAD_ARGUMENT;
+    }
+
+    *HasSecondary = (MsgPtr->CCSDS.Pri.StreamId[0] & (CFE_MSG_INLINE_SHDR_MASK >> 8)) != 0;
+
+    return CFE_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Inline implementation of CFE_MSG_GetSize()
+ */
+static inline CFE_Status_t CFE_MSG_Inline_GetSize(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_Size_t *Size)
+{
+    if (MsgPtr == NULL || Size == NULL)
+    {
+        return CFE_MSG_BAD_ARGUMENT;
+    }
+
+    *Size = (MsgPtr->CCSDS.Pri.Length[0] << 8) + MsgPtr->CCSDS.Pri.Length[1] + CFE_MSG_INLINE_SIZE_OFFSET;
+
+    return CFE_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Inline implementation of CFE_MSG_SetSize()
+ */
+static inline CFE_Status_t CFE_MSG_Inline_SetSize(CFE_MSG_Message_t *MsgPtr, CFE_MSG_Size_t Size)
+{
+    if (MsgPtr == NULL || Size < CFE_MSG_INLINE_SIZE_OFFSET || Size > (0xFFFF + CFE_MSG_INLINE_SIZE_OFFSET))
+    {
+        return CFE_MSG_BAD_ARGUMENT;
+    }
+
+    Size -= CFE_MSG_INLINE_SIZE_OFFSET;
+
+    MsgPtr->CCSDS.Pri.Length[0] = (Size >> 8) & 0xFF;
+    MsgPtr->CCSDS.Pri.Length[1] = Size & 0xFF;
+
+    return CFE_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Inline implementation of CFE_MSG_GetSequenceCount()
+ */
+static inline CFE_Status_t CFE_MSG_Inline_GetSequenceCount(const CFE_MSG_Message_t *MsgPtr,
+                                                           CFE_MSG_SequenceCount_t *SeqCnt)
+{
+    if (MsgPtr == NULL || SeqCnt == NULL)
+    {
+        return CFE_MSG_BAD_ARGUMENT;
+    }
+
+    *SeqCnt = (MsgPtr->CCSDS.Pri.Sequence[0] << 8 | MsgPtr->CCSDS.Pri.Sequence[1]) & CFE_MSG_INLINE_SEQCNT_MASK;
+
+    return CFE_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Inline implementation of CFE_MSG_SetSequenceCount()
+ */
+static inline CFE_Status_t CFE_MSG_Inline_SetSequenceCount(CFE_MSG_Message_t *MsgPtr, CFE_MSG_SequenceCount_t SeqCnt)
+{
+    if (MsgPtr == NULL || ((SeqCnt & ~CFE_MSG_INLINE_SEQCNT_MASK) != 0))
+    {
+        return CFE_MSG_BAD_ARGUMENT;
+    }
+
+    /* Segmentation flags share the upper byte and are preserved */
+    MsgPtr->CCSDS.Pri.Sequence[0] =
+        (MsgPtr->CCSDS.Pri.Sequence[0] & ~(CFE_MSG_INLINE_SEQCNT_MASK >> 8)) | (SeqCnt >> 8);
+    MsgPtr->CCSDS.Pri.Sequence[1] = SeqCnt & 0xFF;
+
+    return CFE_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Inline implementation of CFE_MSG_GetFcnCode()
+ */
+static inline CFE_Status_t CFE_MSG_Inline_GetFcnCode(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_FcnCode_t *FcnCode)
+{
+    if (MsgPtr == NULL || FcnCode == NULL)
+    {
+        return CFE_MSG_BAD_ARGUMENT;
+    }
+
+    /* Both the command type and secondary header flags must be set */
+    if ((MsgPtr->CCSDS.Pri.StreamId[0] & ((CFE_MSG_INLINE_TYPE_MASK | CFE_MSG_INLINE_SHDR_MASK) >> 8)) !=
+        ((CFE_MSG_INLINE_TYPE_MASK | CFE_MSG_INLINE_SHDR_MASK) >> 8))
+    {
+        *FcnCode = 0;
+        return CFE_MSG_WRONG_MSG_TYPE;
+    }
+
+    *FcnCode = ((const CFE_MSG_CommandHeader_t *)MsgPtr)->Sec.FunctionCode & CFE_MSG_INLINE_FC_MASK;
+
+    return CFE_SUCCESS;
+}
+
+/*
+ * Message id accessor for the mission message id scheme
+ */
+#include "cfe_msg_inline_msgid.h"
+
+/*
+ * Map the API onto the inline implementations, except within the
+ * MSG module itself where the out-of-line versions are defined
+ */
+#if defined(CFE_MSG_INLINE_ACCESSORS) && !defined(CFE_MSG_OMIT_INLINE_ACCESSORS)
+#define CFE_MSG_GetType(MsgPtr, Type)                 CFE_MSG_Inline_GetType(MsgPtr, Type)
+#define CFE_MSG_GetHasSecondaryHeader(MsgPtr, HasSec) CFE_MSG_Inline_GetHasSecondaryHeader(MsgPtr, HasSec)
+#define CFE_MSG_GetSize(MsgPtr, Size)                 CFE_MSG_Inline_GetSize(MsgPtr, Size)
+#define CFE_MSG_SetSize(MsgPtr, Size)                 CFE_MSG_Inline_SetSize(MsgPtr, Size)
+#define CFE_MSG_GetSequenceCount(MsgPtr, SeqCnt)      CFE_MSG_Inline_GetSequenceCount(MsgPtr, SeqCnt)
+#define CFE_MSG_SetSequenceCount(MsgPtr, SeqCnt)      CFE_MSG_Inline_SetSequenceCount(MsgPtr, SeqCnt)
+#define CFE_MSG_GetFcnCode(MsgPtr, FcnCode)           CFE_MSG_Inline_GetFcnCode(MsgPtr, FcnCode)
+#define CFE_MSG_GetMsgId(MsgPtr, MsgId)               CFE_MSG_Inline_GetMsgId(MsgPtr, MsgId)
+#endif
+
+#endif /* CFE_MSG_INLINE_H */
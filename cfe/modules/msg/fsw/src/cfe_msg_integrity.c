@@ -20,6 +20,162 @@
 #include "cfe_msg_priv.h"
 #include "cfe_msg_defaults.h"
 #include "cfe_time.h"
+#include "cfe_sb.h"
+#include "cfe_msg_integrity_cfg.h"
+
+/*
+ * Integrity engine definition, indexed by CFE_MSG_IntegrityEngine_t
+ */
+typedef struct CFE_MSG_IntegrityEngineDef
+{
+    size_t TrailerSize; /* Bytes appended to the message */
+    uint32 (*ComputeFunc)(const void *DataPtr, size_t Size);
+} CFE_MSG_IntegrityEngineDef_t;
+
+/*
+ * Integrity table entry, see cfe_msg_integrity_cfg.h
+ */
+typedef struct CFE_MSG_IntegrityTableEntry
+{
+    CFE_SB_MsgId_Atom_t       MsgIdValue;
+    CFE_MSG_IntegrityEngine_t Engine;
+} CFE_MSG_IntegrityTableEntry_t;
+
+static const CFE_MSG_IntegrityEngineDef_t CFE_MSG_IntegrityEngines[] = {
+    {0, NULL},                 /* CFE_MSG_IntegrityEngine_None */
+    {4, CFE_MSG_ComputeCrc32c} /* CFE_MSG_IntegrityEngine_Crc32c */
+};
+
+/* The final entry keeps the table from being empty, and selects nothing */
+static const CFE_MSG_IntegrityTableEntry_t CFE_MSG_IntegrityTable[] = {
+    CFE_MSG_INTEGRITY_TABLE_ENTRIES /* From cfe_msg_integrity_cfg.h */
+    {0, CFE_MSG_IntegrityEngine_None}};
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static const CFE_MSG_IntegrityEngineDef_t *CFE_MSG_GetIntegrityEngineDef(CFE_MSG_IntegrityEngine_t Engine)
+{
+    if ((size_t)Engine >= (sizeof(CFE_MSG_IntegrityEngines) / sizeof(CFE_MSG_IntegrityEngines[0])) ||
+        CFE_MSG_IntegrityEngines[Engine].TrailerSize == 0)
+    {
+        return NULL;
+    }
+
+    return &CFE_MSG_IntegrityEngines[Engine];
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+CFE_MSG_IntegrityEngine_t CFE_MSG_GetIntegrityEngine(const CFE_MSG_Message_t *MsgPtr)
+{
+    CFE_MSG_Type_t      Type;
+    CFE_SB_MsgId_t      MsgId;
+    CFE_SB_MsgId_Atom_t MsgIdValue;
+    size_t              i;
+
+    /* Commands are protected by the secondary header checksum instead */
+    if (CFE_MSG_GetType(MsgPtr, &Type) != CFE_SUCCESS || Type != CFE_MSG_Type_Tlm ||
+        CFE_MSG_GetMsgId(MsgPtr, &MsgId) != CFE_SUCCESS)
+    {
+        return CFE_MSG_IntegrityEngine_None;
+    }
+
+    MsgIdValue = CFE_SB_MsgIdToValue(MsgId);
+
+    for (i = 0; i < (sizeof(CFE_MSG_IntegrityTable) / sizeof(CFE_MSG_IntegrityTable[0])); ++i)
+    {
+        if (CFE_MSG_IntegrityTable[i].MsgIdValue == MsgIdValue)
+        {
+            return CFE_MSG_IntegrityTable[i].Engine;
+        }
+    }
+
+    return CFE_MSG_IntegrityEngine_None;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_MSG_GenerateIntegrity(CFE_MSG_Message_t *MsgPtr, size_t BufferSize, CFE_MSG_IntegrityEngine_t Engine)
+{
+    const CFE_MSG_IntegrityEngineDef_t *EngineDef = CFE_MSG_GetIntegrityEngineDef(Engine);
+    uint8 *                             TrailerPtr;
+    CFE_MSG_Size_t                      Size = 0;
+    uint32                              Value;
+    size_t                              i;
+
+    if (EngineDef == NULL)
+    {
+        return true;
+    }
+
+    /* Message already checked, no error case reachable */
+    CFE_MSG_GetSize(MsgPtr, &Size);
+
+    if (Size + EngineDef->TrailerSize > BufferSize ||
+        CFE_MSG_SetSize(MsgPtr, Size + EngineDef->TrailerSize) != CFE_SUCCESS)
+    {
+        return false;
+    }
+
+    /* Computed after the size update, so the length field is covered as transmitted */
+    Value      = EngineDef->ComputeFunc(MsgPtr, Size);
+    TrailerPtr = (uint8 *)MsgPtr + Size;
+
+    /* Big endian, like the rest of the CCSDS packet */
+    for (i = EngineDef->TrailerSize; i > 0; --i)
+    {
+        TrailerPtr[i - 1] = Value & 0xFF;
+        Value >>= 8;
+    }
+
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_MSG_ValidateIntegrity(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_IntegrityEngine_t Engine)
+{
+    const CFE_MSG_IntegrityEngineDef_t *EngineDef = CFE_MSG_GetIntegrityEngineDef(Engine);
+    const uint8 *                       TrailerPtr;
+    CFE_MSG_Size_t                      Size = 0;
+    uint32                              Value;
+    size_t                              i;
+
+    if (EngineDef == NULL)
+    {
+        return true;
+    }
+
+    /* Message already checked, no error case reachable */
+    CFE_MSG_GetSize(MsgPtr, &Size);
+
+    if (Size < sizeof(CCSDS_SpacePacket_t) + EngineDef->TrailerSize)
+    {
+        return false;
+    }
+
+    Size -= EngineDef->TrailerSize;
+    TrailerPtr = (const uint8 *)MsgPtr + Size;
+    Value      = 0;
+    for (i = 0; i < EngineDef->TrailerSize; ++i)
+    {
+        Value = (Value << 8) | TrailerPtr[i];
+    }
+
+    return (EngineDef->ComputeFunc(MsgPtr, Size) == Value);
+}
 
 /*----------------------------------------------------------------
  *
@@ -46,8 +202,12 @@ CFE_Status_t CFE_MSG_OriginationAction(CFE_MSG_Message_t *MsgPtr, size_t BufferS
      */
     CFE_MSG_GenerateChecksum(MsgPtr);
 
-    /* This implementation permits all outgoing messages */
-    *IsAcceptable = true;
+    /*
+     * TLM packets may be selected for an integrity trailer.  This is last,
+     * so the trailer covers the final content of the message.  Outgoing
+     * messages are only refused if the trailer does not fit.
+     */
+    *IsAcceptable = CFE_MSG_GenerateIntegrity(MsgPtr, BufferSize, CFE_MSG_GetIntegrityEngine(MsgPtr));
 
     return CFE_SUCCESS;
 }
@@ -65,12 +225,13 @@ CFE_Status_t CFE_MSG_VerificationAction(const CFE_MSG_Message_t *MsgPtr, size_t
     }
 
     /*
-     * In the default implementation, there is not anything to check here.
+     * Check the integrity trailer, if this message has one.  The command
+     * checksum is left to the command ingest point, as before.
      *
-     * This is mainly a hook for user expansion, in case a custom implementation
-     * has message verification capability.
+     * This is also a hook for user expansion, in case a custom implementation
+     * has other message verification capability.
      */
-    *IsAcceptable = true;
+    *IsAcceptable = CFE_MSG_ValidateIntegrity(MsgPtr, CFE_MSG_GetIntegrityEngine(MsgPtr));
 
     return CFE_SUCCESS;
 }
\ No newline at end of file
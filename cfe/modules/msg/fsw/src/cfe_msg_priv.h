@@ -31,6 +31,7 @@
  */
 #include "common_types.h"
 #include "cfe_msg_hdr.h"
+#include "cfe_msg_api_typedefs.h"
 
 /*---------------------------------------------------------------------------------------*/
 /**
@@ -79,4 +80,77 @@ static inline void CFE_MSG_SetHeaderField(uint8 *Word, uint16 Val, uint16 Mask)
  */
 void CFE_MSG_InitDefaultHdr(CFE_MSG_Message_t *MsgPtr);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Compute the command secondary header checksum
+ *
+ * \par DESCRIPTION
+ *     XOR of 0xFF and every byte of the message.  Internal function assumes
+ *     pointer is valid.
+ *
+ * \param[in]      MsgPtr  Message to compute the checksum over
+ *
+ * \returns Computed checksum
+ */
+CFE_MSG_Checksum_t CFE_MSG_ComputeCheckSum(const CFE_MSG_Message_t *MsgPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Compute a CRC-32C (Castagnoli)
+ *
+ * \par DESCRIPTION
+ *     Standard CRC-32C with initial value and final XOR of 0xFFFFFFFF, using
+ *     the CPU CRC instructions if the build enables them.
+ *
+ * \param[in]      DataPtr Data to compute the CRC over
+ * \param[in]      Size    Number of bytes
+ *
+ * \returns Computed CRC
+ */
+uint32 CFE_MSG_ComputeCrc32c(const void *DataPtr, size_t Size);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Look up the integrity engine for a message
+ *
+ * \par DESCRIPTION
+ *     Commands and message ids not in the integrity table use
+ *     #CFE_MSG_IntegrityEngine_None.  Internal function assumes pointer is valid.
+ *
+ * \param[in]      MsgPtr  Message to look up
+ *
+ * \returns Integrity engine for the message
+ */
+CFE_MSG_IntegrityEngine_t CFE_MSG_GetIntegrityEngine(const CFE_MSG_Message_t *MsgPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Append an integrity trailer to a message
+ *
+ * \par DESCRIPTION
+ *     Grows the message size by the trailer size of the engine and writes
+ *     the trailer over the new bytes.  Internal function assumes pointer is valid.
+ *
+ * \param[in, out] MsgPtr     Message to protect
+ * \param[in]      BufferSize Size of the buffer holding the message
+ * \param[in]      Engine     Integrity engine to use
+ *
+ * \returns true if the trailer was added (or the engine has none), false if it does not fit
+ */
+bool CFE_MSG_GenerateIntegrity(CFE_MSG_Message_t *MsgPtr, size_t BufferSize, CFE_MSG_IntegrityEngine_t Engine);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Check the integrity trailer of a message
+ *
+ * \par DESCRIPTION
+ *     Internal function assumes pointer is valid.
+ *
+ * \param[in]      MsgPtr  Message to check
+ * \param[in]      Engine  Integrity engine to use
+ *
+ * \returns true if the trailer matches the message (or the engine has none)
+ */
+bool CFE_MSG_ValidateIntegrity(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_IntegrityEngine_t Engine);
+
 #endif /* CFE_MSG_PRIV_H */
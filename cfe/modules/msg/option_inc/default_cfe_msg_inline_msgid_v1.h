@@ -0,0 +1,45 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Inline message id accessor, cFS version 1 implementation
+ *  - Included by cfe_msg_inline.h, see cfe_msg_msgid_v1.c for the out-of-line version
+ */
+
+#ifndef DEFAULT_CFE_MSG_INLINE_MSGID_V1_H
+#define DEFAULT_CFE_MSG_INLINE_MSGID_V1_H
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Inline implementation of CFE_MSG_GetMsgId()
+ */
+static inline CFE_Status_t CFE_MSG_Inline_GetMsgId(const CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t *MsgId)
+{
+    if (MsgPtr == NULL || MsgId == NULL)
+    {
+        return CFE_MSG_BAD_ARGUMENT;
+    }
+
+    *MsgId = CFE_SB_ValueToMsgId((MsgPtr->CCSDS.Pri.StreamId[0] << 8) + MsgPtr->CCSDS.Pri.StreamId[1]);
+
+    return CFE_SUCCESS;
+}
+
+#endif /* DEFAULT_CFE_MSG_INLINE_MSGID_V1_H */
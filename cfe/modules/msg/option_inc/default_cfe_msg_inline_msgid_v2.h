@@ -0,0 +1,62 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Inline message id accessor, cFS default version 2 implementation
+ *  - Included by cfe_msg_inline.h, see cfe_msg_msgid_v2.c for the out-of-line version
+ *    and a description of the message id bits
+ *  - Requires the CCSDS extended header
+ */
+
+#ifndef DEFAULT_CFE_MSG_INLINE_MSGID_V2_H
+#define DEFAULT_CFE_MSG_INLINE_MSGID_V2_H
+
+/* cFS MsgId definitions, these must match the out-of-line implementation */
+#define CFE_MSG_INLINE_MSGID_APID_MASK   0x007F /**< \brief CCSDS ApId mask for MsgId */
+#define CFE_MSG_INLINE_MSGID_TYPE_MASK   0x0080 /**< \brief Message type mask for MsgId, set = cmd */
+#define CFE_MSG_INLINE_MSGID_SUBSYS_MASK 0xFF00 /**< \brief Subsystem mask for MsgId */
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Inline implementation of CFE_MSG_GetMsgId()
+ */
+static inline CFE_Status_t CFE_MSG_Inline_GetMsgId(const CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t *MsgId)
+{
+    CFE_SB_MsgId_Atom_t msgidval;
+
+    if (MsgPtr == NULL || MsgId == NULL)
+    {
+        return CFE_MSG_BAD_ARGUMENT;
+    }
+
+    /* Set message ID bits from CCSDS header fields */
+    msgidval = MsgPtr->CCSDS.Pri.StreamId[1] & CFE_MSG_INLINE_MSGID_APID_MASK;
+    if ((MsgPtr->CCSDS.Pri.StreamId[0] & (CFE_MSG_INLINE_TYPE_MASK >> 8)) != 0)
+    {
+        msgidval |= CFE_MSG_INLINE_MSGID_TYPE_MASK;
+    }
+    msgidval |= (MsgPtr->CCSDS.Ext.Subsystem[1] << 8) & CFE_MSG_INLINE_MSGID_SUBSYS_MASK;
+
+    *MsgId = CFE_SB_ValueToMsgId(msgidval);
+
+    return CFE_SUCCESS;
+}
+
+#endif /* DEFAULT_CFE_MSG_INLINE_MSGID_V2_H */
@@ -0,0 +1,55 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Default message integrity configuration
+ *  - Selects the integrity engine applied to telemetry, per message id
+ *  - Override by providing cfe_msg_integrity_cfg.h in the mission defs directory
+ */
+
+#ifndef DEFAULT_CFE_MSG_INTEGRITY_CFG_H
+#define DEFAULT_CFE_MSG_INTEGRITY_CFG_H
+
+/*
+ * Include Files
+ */
+#include "cfe_msg_api_typedefs.h"
+
+/**
+ * \brief Integrity engine selection table entries
+ *
+ * A comma separated list of initializers, each pairing a telemetry message
+ * id value with the integrity engine that protects it.  On origination the
+ * engine appends its trailer to the message (the trailer is included in the
+ * CCSDS length), and on verification at a software bus endpoint the trailer
+ * is checked.  Command messages keep using the secondary header checksum and
+ * are never given a trailer.
+ *
+ * Message ids not listed use #CFE_MSG_IntegrityEngine_None.  For example:
+ *
+ *     #define CFE_MSG_INTEGRITY_TABLE_ENTRIES \
+ *         {0x0884, CFE_MSG_IntegrityEngine_Crc32c}, {0x0885, CFE_MSG_IntegrityEngine_Crc32c},
+ *
+ * Telemetry given a trailer must leave room for it within
+ * CFE_MISSION_SB_MAX_SB_MSG_SIZE.
+ */
+#define CFE_MSG_INTEGRITY_TABLE_ENTRIES
+
+#endif /* DEFAULT_CFE_MSG_INTEGRITY_CFG_H */
@@ -0,0 +1,187 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ * Message checksum and integrity benchmark
+ *
+ * Times the byte at a time checksum CFE_MSG_ComputeCheckSum replaced,
+ * CFE_MSG_ComputeCheckSum itself, and the CRC-32C used by the integrity
+ * trailer, over a range of message sizes.  This links the MSG library as
+ * built for the target, so which checksum kernel is used and whether the
+ * CRC uses the hardware instructions depends on the mission compile flags
+ * (e.g. -mavx2, -msse4.2).
+ *
+ * Usage: msg_integrity_bench [bytes per size]
+ */
+
+/*
+ * Includes
+ */
+#include "common_types.h"
+#include "cfe_msg.h"
+#include "cfe_msg_priv.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/*
+ * Defines
+ */
+#define MSG_BENCH_DEFAULT_BYTES (64 * 1024 * 1024)
+#define MSG_BENCH_PASSES        5
+#define MSG_BENCH_MAX_SIZE      4096
+
+typedef enum
+{
+    MSG_BENCH_BYTEWISE,
+    MSG_BENCH_CHECKSUM,
+    MSG_BENCH_CRC32C
+} MSG_Bench_Case_t;
+
+static const char *const MSG_Bench_CaseName[] = {"bytewise_checksum", "checksum", "crc32c"};
+
+static const uint32 MSG_Bench_Sizes[] = {64, 256, 1024, 4000};
+
+/*
+ * The byte at a time checksum, as CFE_MSG_ComputeCheckSum was before
+ */
+static CFE_MSG_Checksum_t MSG_Bench_ByteCheckSum(const CFE_MSG_Message_t *MsgPtr)
+{
+    CFE_MSG_Size_t     PktLen  = 0;
+    const uint8 *      BytePtr = (const uint8 *)MsgPtr;
+    CFE_MSG_Checksum_t chksum  = 0xFF;
+
+    CFE_MSG_GetSize(MsgPtr, &PktLen);
+
+    while (PktLen--)
+    {
+        chksum ^= *(BytePtr++);
+    }
+
+    return chksum;
+}
+
+/*
+ * Returns the monotonic clock in nanoseconds
+ */
+static uint64 MSG_Bench_Nsec(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64)now.tv_sec * 1000000000) + now.tv_nsec;
+}
+
+/*
+ * Runs one case over a message of the given size, returns the best ns per call
+ */
+static double MSG_Bench_Run(MSG_Bench_Case_t Case, CFE_MSG_Message_t *MsgPtr, uint32 Size, uint32 Iterations)
+{
+    volatile uint32 Sink;
+    uint32          Result;
+    uint32          pass;
+    uint32          i;
+    uint64          start;
+    uint64          elapsed;
+    uint64          best;
+
+    CFE_MSG_SetSize(MsgPtr, Size);
+
+    best = UINT64_MAX;
+    for (pass = 0; pass < MSG_BENCH_PASSES; pass++)
+    {
+        Result = 0;
+        start  = MSG_Bench_Nsec();
+        for (i = 0; i < Iterations; i++)
+        {
+            switch (Case)
+            {
+                case MSG_BENCH_BYTEWISE:
+                    Result ^= MSG_Bench_ByteCheckSum(MsgPtr);
+                    break;
+                case MSG_BENCH_CHECKSUM:
+                    Result ^= CFE_MSG_ComputeCheckSum(MsgPtr);
+                    break;
+                default:
+                    Result ^= CFE_MSG_ComputeCrc32c(MsgPtr, Size);
+                    break;
+            }
+        }
+        elapsed = MSG_Bench_Nsec() - start;
+        Sink    = Result;
+        if (elapsed < best)
+        {
+            best = elapsed;
+        }
+    }
+
+    (void)Sink;
+
+    return (double)best / Iterations;
+}
+
+int main(int argc, char *argv[])
+{
+    union
+    {
+        uint64            Align;
+        CFE_MSG_Message_t Msg;
+        uint8             Bytes[MSG_BENCH_MAX_SIZE];
+    } Buf;
+    uint32           Bytes;
+    uint32           Iterations;
+    uint32           s;
+    uint32           i;
+    MSG_Bench_Case_t Case;
+    double           Nsec;
+
+    Bytes = MSG_BENCH_DEFAULT_BYTES;
+    if (argc > 1)
+    {
+        Bytes = strtoul(argv[1], NULL, 0);
+    }
+
+    for (i = 0; i < sizeof(Buf.Bytes); i++)
+    {
+        Buf.Bytes[i] = (i * 37 + 11) & 0xFF;
+    }
+    CFE_MSG_SetType(&Buf.Msg, CFE_MSG_Type_Cmd);
+    CFE_MSG_SetHasSecondaryHeader(&Buf.Msg, true);
+
+    for (s = 0; s < sizeof(MSG_Bench_Sizes) / sizeof(MSG_Bench_Sizes[0]); s++)
+    {
+        Iterations = Bytes / MSG_Bench_Sizes[s];
+        if (Iterations < 1)
+        {
+            Iterations = 1;
+        }
+
+        for (Case = MSG_BENCH_BYTEWISE; Case <= MSG_BENCH_CRC32C; Case++)
+        {
+            Nsec = MSG_Bench_Run(Case, &Buf.Msg, MSG_Bench_Sizes[s], Iterations);
+            printf("case=%s size=%u iterations=%u ns_per_call=%.1f mb_per_sec=%.0f\n", MSG_Bench_CaseName[Case],
+                   (unsigned int)MSG_Bench_Sizes[s], (unsigned int)Iterations, Nsec,
+                   (MSG_Bench_Sizes[s] * 1000.0) / Nsec);
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -34,6 +34,7 @@
 #include "test_cfe_msg_fc.h"
 #include "test_cfe_msg_checksum.h"
 #include "test_cfe_msg_time.h"
+#include "test_cfe_msg_inline.h"
 
 /*
  * Functions
@@ -49,8 +50,10 @@ void UtTest_Setup(void)
     Test_MSG_CCSDSExt();
     Test_MSG_MsgId_Shared();
     UT_ADD_TEST(Test_MSG_VerificationAction);
+    UT_ADD_TEST(Test_MSG_Integrity);
     UT_ADD_TEST(Test_MSG_MsgId);
     UT_ADD_TEST(Test_MSG_Checksum);
     UT_ADD_TEST(Test_MSG_FcnCode);
     UT_ADD_TEST(Test_MSG_Time);
+    UT_ADD_TEST(Test_MSG_Inline);
 }
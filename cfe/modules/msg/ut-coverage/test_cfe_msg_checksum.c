@@ -30,8 +30,72 @@
 #include "cfe_msg.h"
 #include "test_cfe_msg_checksum.h"
 #include "cfe_error.h"
+#include "cfe_msg_priv.h"
 #include <string.h>
 
+/*
+ * Reference byte at a time checksum, the vector and word-wise implementations must match it
+ */
+static CFE_MSG_Checksum_t Test_MSG_RefCheckSum(const uint8 *BytePtr, size_t Size)
+{
+    CFE_MSG_Checksum_t chksum = 0xFF;
+
+    while (Size--)
+    {
+        chksum ^= *(BytePtr++);
+    }
+
+    return chksum;
+}
+
+/*
+ * Largest vector alignment used by any of the checksum kernels (AVX2)
+ */
+#define TEST_MSG_CHECKSUM_MAX_ALIGN 32
+
+/*
+ * Compare against byte-wise checksum for all alignments and a range of sizes
+ */
+static void Test_MSG_Checksum_WordWise(void)
+{
+    uint8              Buf[512 + 2 * TEST_MSG_CHECKSUM_MAX_ALIGN];
+    uint8 *            Base;
+    CFE_MSG_Message_t *msgptr;
+    uint32             Offset;
+    uint32             Size;
+    uint32             Mismatches;
+    uint32             i;
+
+    for (i = 0; i < sizeof(Buf); ++i)
+    {
+        Buf[i] = (i * 37 + 11) & 0xFF;
+    }
+
+    /* Offsets are relative to a boundary of the largest vector size */
+    Base = &Buf[(TEST_MSG_CHECKSUM_MAX_ALIGN - ((cpuaddr)Buf % TEST_MSG_CHECKSUM_MAX_ALIGN)) %
+                TEST_MSG_CHECKSUM_MAX_ALIGN];
+
+    for (Offset = 0; Offset < TEST_MSG_CHECKSUM_MAX_ALIGN; ++Offset)
+    {
+        msgptr     = (CFE_MSG_Message_t *)&Base[Offset];
+        Mismatches = 0;
+        for (Size = sizeof(CCSDS_SpacePacket_t) + 1; Size <= 512; ++Size)
+        {
+            CFE_MSG_SetSize(msgptr, Size);
+            if (CFE_MSG_ComputeCheckSum(msgptr) != Test_MSG_RefCheckSum(&Base[Offset], Size))
+            {
+                ++Mismatches;
+            }
+        }
+        UtAssert_UINT32_EQ(Mismatches, 0);
+    }
+
+    /* Full buffer, aligned */
+    msgptr = (CFE_MSG_Message_t *)Base;
+    CFE_MSG_SetSize(msgptr, 512);
+    UtAssert_UINT32_EQ(CFE_MSG_ComputeCheckSum(msgptr), Test_MSG_RefCheckSum(Base, 512));
+}
+
 void Test_MSG_Checksum(void)
 {
     CFE_MSG_CommandHeader_t cmd;
@@ -85,4 +149,7 @@ void Test_MSG_Checksum(void)
     CFE_UtAssert_SUCCESS(CFE_MSG_ValidateChecksum(msgptr, &actual));
     UtAssert_BOOL_TRUE(actual);
     UtAssert_INT32_EQ(Test_MSG_NotZero(msgptr), MSG_LENGTH_FLAG | MSG_HASSEC_FLAG | MSG_TYPE_FLAG);
+
+    UtPrintf("Vector and word-wise against byte-wise checksum, all alignments and sizes");
+    Test_MSG_Checksum_WordWise();
 }
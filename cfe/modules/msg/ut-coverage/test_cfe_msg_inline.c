@@ -0,0 +1,97 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ * Test inline accessors against the out-of-line implementations
+ */
+
+/*
+ * Includes
+ */
+#include "utassert.h"
+#include "ut_support.h"
+#include "cfe_msg.h"
+#include "cfe_msg_inline.h"
+#include "test_cfe_msg_inline.h"
+#include "cfe_error.h"
+#include <string.h>
+
+/*
+ * Defines
+ */
+#define TEST_INLINE_PATTERNS 64 /* Number of generated header patterns */
+
+/* Checks a getter returns the same status and output both ways */
+#define TEST_INLINE_GET(Func, Type)                                                                   \
+    do                                                                                                \
+    {                                                                                                 \
+        Type Expected;                                                                                \
+        Type Actual;                                                                                  \
+        memset(&Expected, 0, sizeof(Expected));                                                       \
+        memset(&Actual, 0, sizeof(Actual));                                                           \
+        UtAssert_INT32_EQ(CFE_MSG_Inline_##Func(msgptr, &Actual), CFE_MSG_##Func(msgptr, &Expected)); \
+        UtAssert_MemCmp(&Actual, &Expected, sizeof(Actual), #Func " output");                         \
+        UtAssert_INT32_EQ(CFE_MSG_Inline_##Func(NULL, &Actual), CFE_MSG_BAD_ARGUMENT);                \
+        UtAssert_INT32_EQ(CFE_MSG_Inline_##Func(msgptr, NULL), CFE_MSG_BAD_ARGUMENT);                 \
+    } while (0)
+
+/* Checks a setter returns the same status and makes the same change both ways */
+#define TEST_INLINE_SET(Func, Value)                                                                           \
+    do                                                                                                         \
+    {                                                                                                          \
+        memcpy(&expected, &cmd, sizeof(cmd));                                                                  \
+        UtAssert_INT32_EQ(CFE_MSG_Inline_##Func(msgptr, Value), CFE_MSG_##Func(CFE_MSG_PTR(expected), Value)); \
+        UtAssert_MemCmp(&cmd, &expected, sizeof(cmd), #Func " header");                                        \
+    } while (0)
+
+void Test_MSG_Inline(void)
+{
+    CFE_MSG_CommandHeader_t cmd;
+    CFE_MSG_CommandHeader_t expected;
+    CFE_MSG_Message_t *     msgptr = CFE_MSG_PTR(cmd);
+    uint8 *                 bytes  = (uint8 *)&cmd;
+    uint32                  i;
+    uint32                  j;
+
+    UtPrintf("Null pointer checks for setters");
+    UtAssert_INT32_EQ(CFE_MSG_Inline_SetSize(NULL, sizeof(cmd)), CFE_MSG_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_MSG_Inline_SetSequenceCount(NULL, 0), CFE_MSG_BAD_ARGUMENT);
+
+    UtPrintf("Compare against out-of-line implementations over generated headers");
+    for (i = 0; i < TEST_INLINE_PATTERNS; i++)
+    {
+        /* Include all zeros and all ones, then a spread of mixed bit patterns */
+        for (j = 0; j < sizeof(cmd); j++)
+        {
+            bytes[j] = (i == 0) ? 0 : (i == 1) ? 0xFF : ((i * 151 + j * 97) ^ (i >> 2)) & 0xFF;
+        }
+
+        TEST_INLINE_GET(GetType, CFE_MSG_Type_t);
+        TEST_INLINE_GET(GetHasSecondaryHeader, bool);
+        TEST_INLINE_GET(GetSize, CFE_MSG_Size_t);
+        TEST_INLINE_GET(GetSequenceCount, CFE_MSG_SequenceCount_t);
+        TEST_INLINE_GET(GetFcnCode, CFE_MSG_FcnCode_t);
+        TEST_INLINE_GET(GetMsgId, CFE_SB_MsgId_t);
+
+        /* Valid and out of range values alike */
+        TEST_INLINE_SET(SetSize, i * 1031);
+        TEST_INLINE_SET(SetSize, 0x10006 + i);
+        TEST_INLINE_SET(SetSequenceCount, i * 263);
+        TEST_INLINE_SET(SetSequenceCount, 0x3FFF + i);
+    }
+}
@@ -29,9 +29,30 @@
 #include "test_cfe_msg_verify.h"
 #include "cfe_error.h"
 #include "cfe_msg_defaults.h"
+#include "cfe_msg_priv.h"
 
 #include <string.h>
 
+/*
+ * Reference bit at a time CRC-32C, the table and instruction implementations must match it
+ */
+static uint32 Test_MSG_RefCrc32c(const uint8 *BytePtr, size_t Size)
+{
+    uint32 Crc = 0xFFFFFFFF;
+    uint32 Bit;
+
+    while (Size--)
+    {
+        Crc ^= *(BytePtr++);
+        for (Bit = 0; Bit < 8; ++Bit)
+        {
+            Crc = (Crc >> 1) ^ ((Crc & 1) ? 0x82F63B78 : 0);
+        }
+    }
+
+    return ~Crc;
+}
+
 /*
  * Test MSG integrity origination action(s)
  */
@@ -89,3 +110,104 @@ void Test_MSG_VerificationAction(void)
     CFE_UtAssert_SUCCESS(CFE_MSG_VerificationAction(&LocalBuf.msg, sizeof(LocalBuf), &IsAcceptable));
     UtAssert_BOOL_TRUE(IsAcceptable);
 }
+
+/*
+ * Test MSG integrity engines
+ */
+void Test_MSG_Integrity(void)
+{
+    union
+    {
+        CFE_MSG_Message_t         msg;
+        CFE_MSG_CommandHeader_t   cmd;
+        CFE_MSG_TelemetryHeader_t tlm;
+        uint8                     Bytes[64];
+    } LocalBuf;
+    uint8          Pattern[32];
+    CFE_MSG_Size_t Size;
+    uint32         Crc;
+    uint32         Offset;
+    uint32         Mismatches;
+    uint32         i;
+
+    /* Standard CRC-32C check values */
+    UtAssert_UINT32_EQ(CFE_MSG_ComputeCrc32c("123456789", 9), 0xE3069283);
+    UtAssert_UINT32_EQ(CFE_MSG_ComputeCrc32c(Pattern, 0), 0);
+    memset(Pattern, 0, sizeof(Pattern));
+    UtAssert_UINT32_EQ(CFE_MSG_ComputeCrc32c(Pattern, sizeof(Pattern)), 0x8A9136AA);
+    memset(Pattern, 0xFF, sizeof(Pattern));
+    UtAssert_UINT32_EQ(CFE_MSG_ComputeCrc32c(Pattern, sizeof(Pattern)), 0x62A8AB43);
+    for (i = 0; i < sizeof(Pattern); ++i)
+    {
+        Pattern[i] = i;
+    }
+    UtAssert_UINT32_EQ(CFE_MSG_ComputeCrc32c(Pattern, sizeof(Pattern)), 0x46DD794E);
+    UtAssert_UINT32_EQ(CFE_MSG_ComputeCrc32c(&Pattern[1], 19), 0xC52FD285); /* unaligned start */
+
+    /* All alignments and sizes up to several 8 byte steps against the reference */
+    for (i = 0; i < sizeof(Pattern); ++i)
+    {
+        Pattern[i] = (i * 151 + 7) & 0xFF;
+    }
+    Mismatches = 0;
+    for (Offset = 0; Offset < 8; ++Offset)
+    {
+        for (Size = 0; Size <= sizeof(Pattern) - Offset; ++Size)
+        {
+            if (CFE_MSG_ComputeCrc32c(&Pattern[Offset], Size) != Test_MSG_RefCrc32c(&Pattern[Offset], Size))
+            {
+                ++Mismatches;
+            }
+        }
+    }
+    UtAssert_UINT32_EQ(Mismatches, 0);
+
+    /* Commands never get a trailer, default configuration selects none for telemetry */
+    memset(&LocalBuf, 0, sizeof(LocalBuf));
+    CFE_MSG_SetType(&LocalBuf.msg, CFE_MSG_Type_Cmd);
+    UtAssert_INT32_EQ(CFE_MSG_GetIntegrityEngine(&LocalBuf.msg), CFE_MSG_IntegrityEngine_None);
+    CFE_MSG_SetType(&LocalBuf.msg, CFE_MSG_Type_Tlm);
+    UtAssert_INT32_EQ(CFE_MSG_GetIntegrityEngine(&LocalBuf.msg), CFE_MSG_IntegrityEngine_None);
+
+    /* No engine, or an undefined one, leaves the message alone */
+    CFE_MSG_SetSize(&LocalBuf.msg, 16);
+    UtAssert_BOOL_TRUE(CFE_MSG_GenerateIntegrity(&LocalBuf.msg, sizeof(LocalBuf), CFE_MSG_IntegrityEngine_None));
+    UtAssert_BOOL_TRUE(CFE_MSG_ValidateIntegrity(&LocalBuf.msg, CFE_MSG_IntegrityEngine_None));
+    UtAssert_BOOL_TRUE(CFE_MSG_GenerateIntegrity(&LocalBuf.msg, sizeof(LocalBuf), (CFE_MSG_IntegrityEngine_t)99));
+    UtAssert_BOOL_TRUE(CFE_MSG_ValidateIntegrity(&LocalBuf.msg, (CFE_MSG_IntegrityEngine_t)99));
+    CFE_UtAssert_SUCCESS(CFE_MSG_GetSize(&LocalBuf.msg, &Size));
+    UtAssert_UINT32_EQ(Size, 16);
+
+    /* Trailer does not fit */
+    UtAssert_BOOL_FALSE(CFE_MSG_GenerateIntegrity(&LocalBuf.msg, 19, CFE_MSG_IntegrityEngine_Crc32c));
+    CFE_UtAssert_SUCCESS(CFE_MSG_GetSize(&LocalBuf.msg, &Size));
+    UtAssert_UINT32_EQ(Size, 16);
+    CFE_MSG_SetSize(&LocalBuf.msg, 0xFFFF + 7);
+    UtAssert_BOOL_FALSE(CFE_MSG_GenerateIntegrity(&LocalBuf.msg, 0x20000, CFE_MSG_IntegrityEngine_Crc32c));
+
+    /* Nominal, trailer is the big endian CRC of the message including the updated length */
+    memset(&LocalBuf, 0x5A, sizeof(LocalBuf));
+    CFE_MSG_SetType(&LocalBuf.msg, CFE_MSG_Type_Tlm);
+    CFE_MSG_SetSize(&LocalBuf.msg, 16);
+    UtAssert_BOOL_TRUE(CFE_MSG_GenerateIntegrity(&LocalBuf.msg, 20, CFE_MSG_IntegrityEngine_Crc32c));
+    CFE_UtAssert_SUCCESS(CFE_MSG_GetSize(&LocalBuf.msg, &Size));
+    UtAssert_UINT32_EQ(Size, 20);
+    Crc = CFE_MSG_ComputeCrc32c(LocalBuf.Bytes, 16);
+    UtAssert_UINT32_EQ((LocalBuf.Bytes[16] << 24) | (LocalBuf.Bytes[17] << 16) | (LocalBuf.Bytes[18] << 8) |
+                           LocalBuf.Bytes[19],
+                       Crc);
+    UtAssert_BOOL_TRUE(CFE_MSG_ValidateIntegrity(&LocalBuf.msg, CFE_MSG_IntegrityEngine_Crc32c));
+
+    /* Any corruption of content or trailer is detected */
+    LocalBuf.Bytes[10] ^= 0x01;
+    UtAssert_BOOL_FALSE(CFE_MSG_ValidateIntegrity(&LocalBuf.msg, CFE_MSG_IntegrityEngine_Crc32c));
+    LocalBuf.Bytes[10] ^= 0x01;
+    LocalBuf.Bytes[19] ^= 0x80;
+    UtAssert_BOOL_FALSE(CFE_MSG_ValidateIntegrity(&LocalBuf.msg, CFE_MSG_IntegrityEngine_Crc32c));
+    LocalBuf.Bytes[19] ^= 0x80;
+    UtAssert_BOOL_TRUE(CFE_MSG_ValidateIntegrity(&LocalBuf.msg, CFE_MSG_IntegrityEngine_Crc32c));
+
+    /* Too short to hold a trailer */
+    CFE_MSG_SetSize(&LocalBuf.msg, sizeof(CCSDS_SpacePacket_t) + 3);
+    UtAssert_BOOL_FALSE(CFE_MSG_ValidateIntegrity(&LocalBuf.msg, CFE_MSG_IntegrityEngine_Crc32c));
+}
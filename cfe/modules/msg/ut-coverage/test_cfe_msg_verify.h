@@ -32,5 +32,6 @@
  * Functions
  */
 void Test_MSG_VerificationAction(void);
+void Test_MSG_Integrity(void);
 
 #endif /* TEST_CFE_MSG_VERIFY_H */
@@ -48,6 +48,49 @@
  */
 CompileTimeAssert(((CFE_RESOURCEID_MAX + 1) & CFE_RESOURCEID_MAX) == 0, CFE_RESOURCEID_MAX_BITMASK);
 
+/*
+ * Each name index bucket holds a 16 bit hash tag in the upper half and the
+ * registry table index plus one in the lower half.  A bucket value of zero
+ * is empty.  The home bucket of an entry is computed from the tag alone, so
+ * entries can be moved during removal without access to their names.
+ */
+#define CFE_RESOURCEID_NAMEINDEX_TAG_SHIFT 16
+#define CFE_RESOURCEID_NAMEINDEX_IDX_MASK  0xFFFF
+#define CFE_RESOURCEID_NAMEINDEX_MAX_SIZE  0x10000
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Computes the hash tag of a name (FNV-1a, folded to 16 bits)
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CFE_ResourceId_NameIndexTag(const char *Name)
+{
+    uint32 Hash;
+
+    Hash = 2166136261u;
+    while (*Name != 0)
+    {
+        Hash ^= (uint8)*Name;
+        Hash *= 16777619u;
+        ++Name;
+    }
+
+    return (Hash ^ (Hash >> 16)) & 0xFFFF;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Checks that a name index descriptor is usable
+ *
+ *-----------------------------------------------------------------*/
+static bool CFE_ResourceId_NameIndexIsValid(const CFE_ResourceId_NameIndex_t *Index)
+{
+    return (Index != NULL && Index->Buckets != NULL && Index->NumBuckets != 0 &&
+            Index->NumBuckets <= CFE_RESOURCEID_NAMEINDEX_MAX_SIZE && Index->TableSize < CFE_RESOURCEID_NAMEINDEX_IDX_MASK);
+}
+
 /*----------------------------------------------------------------
  *
  * Implemented per public API
@@ -143,3 +186,164 @@ CFE_ResourceId_t CFE_ResourceId_FindNext(CFE_ResourceId_t StartId, uint32 TableS
 
     return CheckId;
 }
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ResourceId_NameIndexAdd(const CFE_ResourceId_NameIndex_t *Index, const char *Name, uint32 Idx)
+{
+    uint32 Tag;
+    uint32 Pos;
+    uint32 Count;
+
+    if (!CFE_ResourceId_NameIndexIsValid(Index) || Name == NULL || Idx >= Index->TableSize)
+    {
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
+    Tag = CFE_ResourceId_NameIndexTag(Name);
+    Pos = Tag % Index->NumBuckets;
+
+    for (Count = 0; Count < Index->NumBuckets; ++Count)
+    {
+        if (Index->Buckets[Pos] == 0)
+        {
+            Index->Buckets[Pos] = (Tag << CFE_RESOURCEID_NAMEINDEX_TAG_SHIFT) | (Idx + 1);
+            return CFE_SUCCESS;
+        }
+
+        ++Pos;
+        if (Pos >= Index->NumBuckets)
+        {
+            Pos = 0;
+        }
+    }
+
+    return CFE_ES_NO_RESOURCE_IDS_AVAILABLE;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ResourceId_NameIndexRemove(const CFE_ResourceId_NameIndex_t *Index, const char *Name, uint32 Idx)
+{
+    uint32 Entry;
+    uint32 Hole;
+    uint32 Pos;
+    uint32 Home;
+    uint32 Count;
+
+    if (!CFE_ResourceId_NameIndexIsValid(Index) || Name == NULL)
+    {
+        return;
+    }
+
+    Entry = (CFE_ResourceId_NameIndexTag(Name) << CFE_RESOURCEID_NAMEINDEX_TAG_SHIFT) | (Idx + 1);
+    Hole  = (Entry >> CFE_RESOURCEID_NAMEINDEX_TAG_SHIFT) % Index->NumBuckets;
+
+    /* Find the entry, which must be within the run of buckets starting at its home */
+    for (Count = 0; Count < Index->NumBuckets; ++Count)
+    {
+        if (Index->Buckets[Hole] == 0 || Index->Buckets[Hole] == Entry)
+        {
+            break;
+        }
+
+        ++Hole;
+        if (Hole >= Index->NumBuckets)
+        {
+            Hole = 0;
+        }
+    }
+
+    if (Count >= Index->NumBuckets || Index->Buckets[Hole] == 0)
+    {
+        /* not present */
+        return;
+    }
+
+    /*
+     * Close the gap by moving back any later entries in the same run
+     * which would otherwise no longer be reachable from their home bucket.
+     * This avoids the need for deleted markers, which would gradually
+     * lengthen every lookup.
+     */
+    Pos = Hole;
+    for (Count = 1; Count < Index->NumBuckets; ++Count)
+    {
+        ++Pos;
+        if (Pos >= Index->NumBuckets)
+        {
+            Pos = 0;
+        }
+
+        if (Index->Buckets[Pos] == 0)
+        {
+            break;
+        }
+
+        Home = (Index->Buckets[Pos] >> CFE_RESOURCEID_NAMEINDEX_TAG_SHIFT) % Index->NumBuckets;
+
+        /* Move the entry if its home is not cyclically within (Hole, Pos] */
+        if (((Pos + Index->NumBuckets - Home) % Index->NumBuckets) >=
+            ((Pos + Index->NumBuckets - Hole) % Index->NumBuckets))
+        {
+            Index->Buckets[Hole] = Index->Buckets[Pos];
+            Hole                 = Pos;
+        }
+    }
+
+    Index->Buckets[Hole] = 0;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ResourceId_NameIndexFind(const CFE_ResourceId_NameIndex_t *Index, const char *Name, uint32 *Idx)
+{
+    uint32 Tag;
+    uint32 Pos;
+    uint32 Count;
+    uint32 Entry;
+
+    if (!CFE_ResourceId_NameIndexIsValid(Index) || Index->MatchFunc == NULL || Name == NULL || Idx == NULL)
+    {
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
+    Tag = CFE_ResourceId_NameIndexTag(Name);
+    Pos = Tag % Index->NumBuckets;
+
+    for (Count = 0; Count < Index->NumBuckets; ++Count)
+    {
+        Entry = Index->Buckets[Pos];
+        if (Entry == 0)
+        {
+            break;
+        }
+
+        if ((Entry >> CFE_RESOURCEID_NAMEINDEX_TAG_SHIFT) == Tag &&
+            Index->MatchFunc((Entry & CFE_RESOURCEID_NAMEINDEX_IDX_MASK) - 1, Name))
+        {
+            *Idx = (Entry & CFE_RESOURCEID_NAMEINDEX_IDX_MASK) - 1;
+            return CFE_SUCCESS;
+        }
+
+        ++Pos;
+        if (Pos >= Index->NumBuckets)
+        {
+            Pos = 0;
+        }
+    }
+
+    return CFE_ES_ERR_NAME_NOT_FOUND;
+}
@@ -29,11 +29,21 @@
 #define UT_RESOURCEID_BASE_OFFSET 37
 #define UT_RESOURCEID_TEST_SLOTS  149 /* oddball for test purposes */
 
+#define UT_RESOURCEID_NAME_SLOTS   5
+#define UT_RESOURCEID_NAME_BUCKETS 4 /* deliberately smaller than the table, to test a full index */
+
+static const char *UT_ResourceId_NameTable[UT_RESOURCEID_NAME_SLOTS];
+
 static bool UT_ResourceId_CheckIdSlotUsed(CFE_ResourceId_t Id)
 {
     return UT_DEFAULT_IMPL(UT_ResourceId_CheckIdSlotUsed) != 0;
 }
 
+static bool UT_ResourceId_NameMatch(uint32 Idx, const char *Name)
+{
+    return (UT_ResourceId_NameTable[Idx] != NULL && strcmp(UT_ResourceId_NameTable[Idx], Name) == 0);
+}
+
 void TestResourceID(void)
 {
     /*
@@ -176,7 +186,94 @@ void TestResourceID(void)
                   CFE_ResourceId_ToInteger(Id));
 }
 
+void TestNameIndex(void)
+{
+    /*
+     * Test cases for the hashed name index functions
+     */
+    static const char *const   Names[UT_RESOURCEID_NAME_SLOTS] = {"UT_A", "UT_B", "UT_C", "UT_D", "UT_E"};
+    uint32                     Buckets[UT_RESOURCEID_NAME_BUCKETS];
+    CFE_ResourceId_NameIndex_t Index;
+    CFE_ResourceId_NameIndex_t BadIndex;
+    uint32                     Idx;
+    uint32                     i;
+    uint32                     j;
+
+    memset(Buckets, 0, sizeof(Buckets));
+    memset(UT_ResourceId_NameTable, 0, sizeof(UT_ResourceId_NameTable));
+    Index.Buckets    = Buckets;
+    Index.NumBuckets = UT_RESOURCEID_NAME_BUCKETS;
+    Index.TableSize  = UT_RESOURCEID_NAME_SLOTS;
+    Index.MatchFunc  = UT_ResourceId_NameMatch;
+
+    /* Fill the index completely, so some names must share a probe run */
+    for (i = 0; i < UT_RESOURCEID_NAME_BUCKETS; ++i)
+    {
+        UT_ResourceId_NameTable[i] = Names[i];
+        UtAssert_INT32_EQ(CFE_ResourceId_NameIndexAdd(&Index, Names[i], i), CFE_SUCCESS);
+    }
+
+    /* Once full, adding another name must fail */
+    UT_ResourceId_NameTable[i] = Names[i];
+    UtAssert_INT32_EQ(CFE_ResourceId_NameIndexAdd(&Index, Names[i], i), CFE_ES_NO_RESOURCE_IDS_AVAILABLE);
+    UtAssert_INT32_EQ(CFE_ResourceId_NameIndexFind(&Index, Names[i], &Idx), CFE_ES_ERR_NAME_NOT_FOUND);
+    UT_ResourceId_NameTable[i] = NULL;
+
+    for (i = 0; i < UT_RESOURCEID_NAME_BUCKETS; ++i)
+    {
+        UtAssert_INT32_EQ(CFE_ResourceId_NameIndexFind(&Index, Names[i], &Idx), CFE_SUCCESS);
+        UtAssert_UINT32_EQ(Idx, i);
+    }
+
+    /* Remove each entry in turn, all remaining entries must still be found */
+    for (i = 0; i < UT_RESOURCEID_NAME_BUCKETS; ++i)
+    {
+        CFE_ResourceId_NameIndexRemove(&Index, Names[i], i);
+        UT_ResourceId_NameTable[i] = NULL;
+        UtAssert_INT32_EQ(CFE_ResourceId_NameIndexFind(&Index, Names[i], &Idx), CFE_ES_ERR_NAME_NOT_FOUND);
+
+        for (j = i + 1; j < UT_RESOURCEID_NAME_BUCKETS; ++j)
+        {
+            UtAssert_True(CFE_ResourceId_NameIndexFind(&Index, Names[j], &Idx) == CFE_SUCCESS && Idx == j,
+                          "Name %s found after removing %s", Names[j], Names[i]);
+        }
+    }
+
+    for (i = 0; i < UT_RESOURCEID_NAME_BUCKETS; ++i)
+    {
+        UtAssert_ZERO(Buckets[i]);
+    }
+
+    /* Removing an entry that is not present does nothing */
+    CFE_ResourceId_NameIndexRemove(&Index, Names[0], 0);
+
+    /* A name that is indexed but no longer matches the table is not found */
+    UtAssert_INT32_EQ(CFE_ResourceId_NameIndexAdd(&Index, Names[0], 0), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ResourceId_NameIndexFind(&Index, Names[0], &Idx), CFE_ES_ERR_NAME_NOT_FOUND);
+
+    /* Validate off-nominal inputs */
+    UtAssert_INT32_EQ(CFE_ResourceId_NameIndexAdd(NULL, Names[0], 0), CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ResourceId_NameIndexAdd(&Index, NULL, 0), CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ResourceId_NameIndexAdd(&Index, Names[0], UT_RESOURCEID_NAME_SLOTS), CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ResourceId_NameIndexFind(NULL, Names[0], &Idx), CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ResourceId_NameIndexFind(&Index, NULL, &Idx), CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ResourceId_NameIndexFind(&Index, Names[0], NULL), CFE_ES_BAD_ARGUMENT);
+    CFE_ResourceId_NameIndexRemove(NULL, Names[0], 0);
+    CFE_ResourceId_NameIndexRemove(&Index, NULL, 0);
+
+    BadIndex           = Index;
+    BadIndex.MatchFunc = NULL;
+    UtAssert_INT32_EQ(CFE_ResourceId_NameIndexFind(&BadIndex, Names[0], &Idx), CFE_ES_BAD_ARGUMENT);
+    BadIndex            = Index;
+    BadIndex.NumBuckets = 0;
+    UtAssert_INT32_EQ(CFE_ResourceId_NameIndexAdd(&BadIndex, Names[0], 0), CFE_ES_BAD_ARGUMENT);
+    BadIndex         = Index;
+    BadIndex.Buckets = NULL;
+    UtAssert_INT32_EQ(CFE_ResourceId_NameIndexAdd(&BadIndex, Names[0], 0), CFE_ES_BAD_ARGUMENT);
+}
+
 void UtTest_Setup(void)
 {
     UtTest_Add(TestResourceID, NULL, NULL, "Resource ID");
+    UtTest_Add(TestNameIndex, NULL, NULL, "Name Index");
 }
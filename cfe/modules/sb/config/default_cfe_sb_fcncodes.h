@@ -82,6 +82,9 @@
 **       - Pipe Overflow Error Counter (\SB_PIPEOVREC)
 **       - Msg Limit Error Counter (\SB_MSGLIMEC)
 **
+**       It also clears the per-pipe and per-MsgId latency histograms
+**       reported in #CFE_SB_LatencyStatsTlm_t and the info files.
+**
 **  \cfecmdmnemonic \SB_RESETCTRS
 **
 **  \par Command Structure
@@ -118,7 +121,8 @@
 **       This command will cause the SB task to send a statistics packet
 **       containing current utilization figures and high water marks which
 **       may be useful for checking the margin of the SB platform configuration
-**       settings.
+**       settings, followed by a packet summarizing how long messages
+**       have waited on each pipe.
 **
 **  \cfecmdmnemonic \SB_DUMPSTATS
 **
@@ -130,6 +134,8 @@
 **       following telemetry:
 **       - \b \c \SB_CMDPC - command execution counter will increment
 **       - Receipt of statistics packet with MsgId #CFE_SB_STATS_TLM_MID
+**       - Receipt of latency statistics packet with MsgId #CFE_SB_LATENCY_TLM_MID,
+**         if #CFE_PLATFORM_SB_LATENCY_STATS is enabled
 **       - The #CFE_SB_SND_STATS_EID debug event message will be generated
 **
 **  \par Error Conditions
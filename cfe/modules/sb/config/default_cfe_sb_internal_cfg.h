@@ -85,6 +85,40 @@
 */
 #define CFE_PLATFORM_SB_MAX_DEST_PER_PKT 16
 
+/**
+**  \cfesbcfg Depth of the high priority lane of a pipe
+**
+**  \par Description:
+**       Messages subscribed with a #CFE_SB_QosPriority_HIGH quality of service are
+**       held in a separate lane of each pipe, which is read before the regular
+**       queue.  This sets how many high priority messages a single pipe can hold.
+**       Each pipe descriptor reserves one buffer pointer per entry.
+**
+**  \par Limits
+**       This parameter has a lower limit of 1 and an upper limit of 255.
+**
+*/
+#define CFE_PLATFORM_SB_PIPE_PRIORITY_LANE_DEPTH 16
+
+/**
+**  \cfesbcfg Enable message latency histograms
+**
+**  \par Description:
+**       When set to 1, the software bus timestamps every transmit and receive and
+**       keeps latency histograms per pipe and per message route.  These are reported
+**       in the latency telemetry packet and the routing and pipe info files.  When
+**       set to 0 the timestamps and histogram storage are compiled out, the latency
+**       packet is not sent and the latency fields in the info files read as zero.
+**
+**       The cost is one clock read per transmit and per receive plus one more at
+**       the end of each transmit, and a histogram update per delivery.
+**
+**  \par Limits
+**       This parameter must be 0 or 1.
+**
+*/
+#define CFE_PLATFORM_SB_LATENCY_STATS 1
+
 /**
 **  \cfesbcfg Default Subscription Message Limit
 **
@@ -122,6 +156,26 @@
 */
 #define CFE_PLATFORM_SB_BUF_MEMORY_BYTES 524288
 
+/**
+**  \cfesbcfg Small message buffer size and count
+**
+**  \par Description:
+**       Messages of up to CFE_PLATFORM_SB_SMALL_BUF_SIZE bytes (wakeups,
+**       housekeeping requests, short commands) are placed in one of
+**       CFE_PLATFORM_SB_SMALL_BUF_COUNT fixed slots kept on a free list, rather
+**       than being allocated from the SB memory pool.  Each slot holds the
+**       buffer descriptor and the content, rounded up to a multiple of 64 bytes.
+**       When all slots are in use, small messages fall back to the memory pool.
+**       The hit rate is reported in the SB statistics packet.
+**
+**  \par Limits
+**       CFE_PLATFORM_SB_SMALL_BUF_SIZE must be at least 8 and no more than
+**       CFE_MISSION_SB_MAX_SB_MSG_SIZE.  Setting CFE_PLATFORM_SB_SMALL_BUF_COUNT
+**       to 0 sends all messages through the memory pool.
+*/
+#define CFE_PLATFORM_SB_SMALL_BUF_SIZE  64
+#define CFE_PLATFORM_SB_SMALL_BUF_COUNT 64
+
 /**
 **  \cfesbcfg Highest Valid Message Id
 **
@@ -144,9 +198,37 @@
 **       CFE_PLATFORM_SB_MAX_MSG_IDS is used to size the message map.  In that case
 **       the range selected here does not impact message map memory use, so it's
 **       reasonable to use up to the full range supported by the message ID implementation.
+**
+**       When using the paged implementation for software bus routing, this value sets
+**       the number of levels in the map, see #CFE_PLATFORM_SB_MSGMAP_PAGE_BITS.
 */
 #define CFE_PLATFORM_SB_HIGHEST_VALID_MSGID 0x1FFF
 
+/**
+**  \cfesbcfg Message Map Page Size
+**
+**  \par Description:
+**       Only used by the paged implementation for software bus routing, which splits
+**       each message ID into fields of CFE_PLATFORM_SB_MSGMAP_PAGE_BITS bits, as in a
+**       page table.  The lowest field indexes a page holding the routes for
+**       2^CFE_PLATFORM_SB_MSGMAP_PAGE_BITS consecutive message IDs, the fields above it
+**       index tables of page numbers, and the highest field indexes the directory.  The
+**       map has as few levels (2 to 4) as cover CFE_PLATFORM_SB_HIGHEST_VALID_MSGID, so
+**       the directory has at most 2^CFE_PLATFORM_SB_MSGMAP_PAGE_BITS entries.  A table or
+**       page is only assigned to a span of message IDs once a route exists within it.
+**
+**       Each directory entry, table entry and page entry uses 2 bytes.  At each level the
+**       map reserves up to CFE_PLATFORM_SB_MAX_MSG_IDS tables or pages, fewer if the
+**       message ID range has fewer spans, so memory grows with the number of routes
+**       rather than the message ID range.  Smaller pages suit message IDs scattered
+**       across the range, larger pages suit message IDs clustered together.
+**
+**  \par Limits
+**       This parameter has a lower limit of 1 and an upper limit of 16, and must be
+**       large enough that four levels cover CFE_PLATFORM_SB_HIGHEST_VALID_MSGID.
+*/
+#define CFE_PLATFORM_SB_MSGMAP_PAGE_BITS 8
+
 /**
 **  \cfesbcfg Default Routing Information Filename
 **
@@ -126,6 +126,36 @@ typedef struct CFE_SB_PipeDepthStats
                                    \brief Spare word to ensure alignment */
 } CFE_SB_PipeDepthStats_t;
 
+/**
+** \brief SB Latency Summary
+**
+** Condensed form of one SB latency histogram.  Percentiles are the upper
+** bound of the histogram bucket they fall in, so they may overstate the
+** true value by up to a quarter of it, but never exceed MaxUsec.
+**
+** Used in #CFE_SB_LatencyStatsTlm_t and in the pipe and routing info files
+*/
+typedef struct CFE_SB_LatencySummary
+{
+    uint32 Count;   /**< \brief Number of samples since the last counter reset */
+    uint32 P50Usec; /**< \brief Median latency, in microseconds */
+    uint32 P99Usec; /**< \brief 99th percentile latency, in microseconds */
+    uint32 MaxUsec; /**< \brief Largest latency seen, in microseconds */
+} CFE_SB_LatencySummary_t;
+
+/**
+** \brief SB Pipe Latency Statistics
+**
+** Used in SB Latency Statistics Telemetry Packet #CFE_SB_LatencyStatsTlm_t
+*/
+typedef struct CFE_SB_PipeLatencyStats
+{
+    CFE_SB_PipeId_t         PipeId;  /**< \cfetlmmnemonic \SB_PLPIPEID
+                                          \brief Pipe Id associated with the stats below */
+    CFE_SB_LatencySummary_t Latency; /**< \cfetlmmnemonic \SB_PLLAT
+                                          \brief Time messages spent queued on the pipe */
+} CFE_SB_PipeLatencyStats_t;
+
 /**
 ** \brief SB Pipe Information File Entry
 **
@@ -143,16 +173,19 @@ typedef struct CFE_SB_PipeDepthStats
 */
 typedef struct CFE_SB_PipeInfoEntry
 {
-    CFE_SB_PipeId_t PipeId;                            /**< The runtime ID of the pipe */
-    CFE_ES_AppId_t  AppId;                             /**< The runtime ID of the application that owns the pipe */
-    char            PipeName[CFE_MISSION_MAX_API_LEN]; /**< The Name of the pipe */
-    char            AppName[CFE_MISSION_MAX_API_LEN];  /**< The Name of the application that owns the pipe */
-    uint16          MaxQueueDepth;                     /**< The allocated depth of the pipe (max capacity) */
-    uint16          CurrentQueueDepth;                 /**< The current depth of the pipe */
-    uint16          PeakQueueDepth;                    /**< The peak depth of the pipe (high watermark) */
-    uint16          SendErrors;                        /**< Number of errors when writing to this pipe */
-    uint8           Opts;                              /**< Pipe options set (bitmask) */
-    uint8           Spare[3];                          /**< Padding to make this structure a multiple of 4 bytes */
+    CFE_SB_PipeId_t         PipeId;                            /**< The runtime ID of the pipe */
+    CFE_ES_AppId_t          AppId;                             /**< The runtime ID of the application that owns the pipe */
+    char                    PipeName[CFE_MISSION_MAX_API_LEN]; /**< The Name of the pipe */
+    char                    AppName[CFE_MISSION_MAX_API_LEN];  /**< The Name of the application that owns the pipe */
+    uint16                  MaxQueueDepth;                     /**< The allocated depth of the pipe (max capacity) */
+    uint16                  CurrentQueueDepth;                 /**< The current depth of the pipe */
+    uint16                  PeakQueueDepth;                    /**< The peak depth of the pipe (high watermark) */
+    uint16                  SendErrors;                        /**< Number of errors when writing to this pipe */
+    uint8                   Opts;                              /**< Pipe options set (bitmask) */
+    uint8                   PriorityLaneDepth;                 /**< The current depth of the priority lane */
+    uint8                   PeakPriorityLaneDepth;             /**< The peak depth of the priority lane (high watermark) */
+    uint8                   Spare;                             /**< Padding to make this structure a multiple of 4 bytes */
+    CFE_SB_LatencySummary_t Latency; /**< Transmit to receive time of messages read from this pipe */
 } CFE_SB_PipeInfoEntry_t;
 
 /**
@@ -195,6 +228,11 @@ typedef struct CFE_SB_StatsTlm_Payload
                                     \brief Number of SB message buffers currently in use */
     uint32 PeakSBBuffersInUse; /**< \cfetlmmnemonic \SB_SMPSBBIU
                                     \brief Max number of SB message buffers in use */
+    uint32 SmallBufHits;       /**< \cfetlmmnemonic \SB_SMSBHITS
+                                    \brief Number of small messages given a small buffer slot */
+    uint32 SmallBufMisses;     /**< \cfetlmmnemonic \SB_SMSBMISS
+                                    \brief Number of small messages allocated from the memory pool,
+                                    as all small buffer slots were in use */
 
     uint32 MaxPipeDepthAllowed; /**< \cfetlmmnemonic \SB_SMMPDALW
                                      \brief Maximum allowed pipe depth */
@@ -203,6 +241,19 @@ typedef struct CFE_SB_StatsTlm_Payload
                                                \brief Pipe Depth Statistics #CFE_SB_PipeDepthStats_t*/
 } CFE_SB_StatsTlm_Payload_t;
 
+/**
+** \cfesbtlm SB Latency Statistics Telemetry Packet
+**
+** Sent along with #CFE_SB_StatsTlm_t in response to #CFE_SB_SEND_SB_STATS_CC.
+** Per-MsgId latencies are reported in the routing info file.
+*/
+typedef struct CFE_SB_LatencyStatsTlm_Payload
+{
+    CFE_SB_PipeLatencyStats_t
+        PipeLatencyStats[CFE_MISSION_SB_MAX_PIPES]; /**< \cfetlmmnemonic \SB_SMPLS
+                                                   \brief Pipe Latency Statistics #CFE_SB_PipeLatencyStats_t*/
+} CFE_SB_LatencyStatsTlm_Payload_t;
+
 /**
 ** \brief SB Routing File Entry
 **
@@ -210,12 +261,14 @@ typedef struct CFE_SB_StatsTlm_Payload
 */
 typedef struct CFE_SB_RoutingFileEntry
 {
-    CFE_SB_MsgId_t  MsgId;                             /**< \brief Message Id portion of the route */
-    CFE_SB_PipeId_t PipeId;                            /**< \brief Pipe Id portion of the route */
-    uint8           State;                             /**< \brief Route Enabled or Disabled */
-    uint16          MsgCnt;                            /**< \brief Number of msgs with this MsgId sent to this PipeId */
-    char            AppName[CFE_MISSION_MAX_API_LEN];  /**< \brief Pipe Depth Statistics */
-    char            PipeName[CFE_MISSION_MAX_API_LEN]; /**< \brief Pipe Depth Statistics */
+    CFE_SB_MsgId_t          MsgId;                             /**< \brief Message Id portion of the route */
+    CFE_SB_PipeId_t         PipeId;                            /**< \brief Pipe Id portion of the route */
+    uint8                   State;                             /**< \brief Route Enabled or Disabled */
+    uint16                  MsgCnt;                            /**< \brief Number of msgs with this MsgId sent to this PipeId */
+    char                    AppName[CFE_MISSION_MAX_API_LEN];  /**< \brief Pipe Depth Statistics */
+    char                    PipeName[CFE_MISSION_MAX_API_LEN]; /**< \brief Pipe Depth Statistics */
+    CFE_SB_LatencySummary_t Delivery; /**< \brief Transmit to receive time of this MsgId, over all pipes */
+    CFE_SB_LatencySummary_t Publish;  /**< \brief Time spent in the transmit call for this MsgId */
 } CFE_SB_RoutingFileEntry_t;
 
 /**
@@ -136,6 +136,12 @@ typedef struct CFE_SB_StatsTlm
     CFE_SB_StatsTlm_Payload_t Payload;         /**< \brief Telemetry payload */
 } CFE_SB_StatsTlm_t;
 
+typedef struct CFE_SB_LatencyStatsTlm
+{
+    CFE_MSG_TelemetryHeader_t        TelemetryHeader; /**< \brief Telemetry header */
+    CFE_SB_LatencyStatsTlm_Payload_t Payload;         /**< \brief Telemetry payload */
+} CFE_SB_LatencyStatsTlm_t;
+
 typedef struct CFE_SB_SingleSubscriptionTlm
 {
     CFE_MSG_TelemetryHeader_t              TelemetryHeader; /**< \brief Telemetry header */
@@ -49,5 +49,6 @@
 #define CFE_MISSION_SB_STATS_TLM_TOPICID   10
 #define CFE_MISSION_SB_ALLSUBS_TLM_TOPICID 13
 #define CFE_MISSION_SB_ONESUB_TLM_TOPICID  14
+#define CFE_MISSION_SB_LATENCY_TLM_TOPICID 15
 
 #endif
@@ -688,6 +688,11 @@ typedef struct CFE_SB_StatsTlm_Payload
                                     \brief Number of SB message buffers currently in use */
     uint32 PeakSBBuffersInUse; /**< \cfetlmmnemonic \SB_SMPSBBIU
                                     \brief Max number of SB message buffers in use */
+    uint32 SmallBufHits;       /**< \cfetlmmnemonic \SB_SMSBHITS
+                                    \brief Number of small messages given a small buffer slot */
+    uint32 SmallBufMisses;     /**< \cfetlmmnemonic \SB_SMSBMISS
+                                    \brief Number of small messages allocated from the memory pool,
+                                    as all small buffer slots were in use */
 
     uint32 MaxPipeDepthAllowed; /**< \cfetlmmnemonic \SB_SMMPDALW
                                      \brief Maximum allowed pipe depth */
@@ -381,6 +381,15 @@ int32 CFE_SB_DeletePipeFull(CFE_SB_PipeId_t PipeId, CFE_ES_AppId_t AppId)
         SysQueueId = PipeDscPtr->SysQueueId;
         BufDscPtr  = PipeDscPtr->LastBuffer;
 
+        /* Messages in the priority lane are released here, their queue entries are NULL */
+        while (PipeDscPtr->PriorityLaneDepth > 0)
+        {
+            CFE_SB_DecrBufUseCnt(PipeDscPtr->PriorityLane[PipeDscPtr->PriorityLaneHead]);
+            PipeDscPtr->PriorityLaneHead =
+                (PipeDscPtr->PriorityLaneHead + 1) % CFE_PLATFORM_SB_PIPE_PRIORITY_LANE_DEPTH;
+            --PipeDscPtr->PriorityLaneDepth;
+        }
+
         /*
          * Mark entry as "reserved" so other resources can be deleted
          * while the SB global is unlocked.  This prevents other tasks
@@ -1031,8 +1040,10 @@ int32 CFE_SB_SubscribeFull(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, CFE_SB_
                 DestPtr->BuffCount     = 0;
                 DestPtr->DestCnt       = 0;
                 DestPtr->Scope         = Scope;
+                DestPtr->Priority      = Quality.Priority;
                 DestPtr->Prev          = NULL;
                 DestPtr->Next          = NULL;
+                DestPtr->LatestBuffer  = NULL;
 
                 /* add destination node */
                 CFE_SB_AddDestNode(RouteId, DestPtr);
@@ -1516,59 +1527,124 @@ CFE_Status_t CFE_SB_TransmitMsg(const CFE_MSG_Message_t *MsgPtr, bool IsOriginat
 {
     CFE_SB_TransmitTxn_State_t TxnBuf;
     CFE_SB_MessageTxn_State_t *Txn;
-    CFE_SB_Buffer_t *          BufPtr;
 
-    BufPtr = NULL;
-    Txn    = CFE_SB_TransmitTxn_Init(&TxnBuf, MsgPtr);
+    Txn = CFE_SB_TransmitTxn_Init(&TxnBuf, MsgPtr);
+
+    CFE_SB_TransmitTxn_ExecuteFromMsg(Txn, MsgPtr, IsOrigination);
+
+    /* send an event for each pipe write error that may have occurred */
+    CFE_SB_MessageTxn_ReportEvents(Txn);
+
+    return CFE_SB_MessageTxn_GetStatus(Txn);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_SB_TransmitMsgWithTimeout(const CFE_MSG_Message_t *MsgPtr, bool IsOrigination, int32 TimeOut)
+{
+    CFE_SB_TransmitTxn_State_t TxnBuf;
+    CFE_SB_MessageTxn_State_t *Txn;
+    CFE_Status_t               Status;
+
+    Txn = CFE_SB_TransmitTxn_Init(&TxnBuf, MsgPtr);
 
-    /* In this context, the user should have set the the size and MsgId in the content */
     if (CFE_SB_MessageTxn_IsOK(Txn))
     {
-        CFE_SB_TransmitTxn_SetupFromMsg(Txn, MsgPtr);
+        CFE_SB_MessageTxn_SetTimeout(Txn, TimeOut);
     }
 
-    if (CFE_SB_MessageTxn_IsOK(Txn))
+    CFE_SB_TransmitTxn_ExecuteFromMsg(Txn, MsgPtr, IsOrigination);
+
+    /* send an event for each pipe write error that may have occurred */
+    CFE_SB_MessageTxn_ReportEvents(Txn);
+
+    Status = CFE_SB_MessageTxn_GetStatus(Txn);
+
+    /* Unlike the plain transmit, tell the caller if any subscriber missed the message */
+    if (Status == CFE_SUCCESS && CFE_SB_MessageTxn_GetNumPipeErrs(Txn) != 0)
     {
-        /* Get buffer - note this pre-initializes the returned buffer with
-         * a use count of 1, which refers to this task as it fills the buffer. */
-        BufPtr = CFE_SB_AllocateMessageBuffer(CFE_SB_MessageTxn_GetContentSize(Txn));
-        if (BufPtr == NULL)
-        {
-            CFE_SB_MessageTxn_SetEventAndStatus(Txn, CFE_SB_GET_BUF_ERR_EID, CFE_SB_BUF_ALOC_ERR);
-        }
+        Status = CFE_SB_TIME_OUT;
     }
 
-    /*
-     * If a buffer was obtained above, then copy the content into it
-     * and broadcast it to all subscribers in the route.
-     *
-     * Note - if there is no route / no subscribers, the "Status" will
-     * be CFE_SUCCESS because CFE_SB_TransmitMsgValidate() succeeded,
-     * but there will be no buffer because CFE_SBR_IsValidRouteId() returned
-     * false.
-     *
-     * But if the descriptor is non-null it means the message is valid and
-     * there is a route to send it to.
-     */
-    if (CFE_SB_MessageTxn_IsOK(Txn))
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_SB_GetRouteCongestion(CFE_SB_MsgId_t MsgId, uint8 *FillPercentPtr)
+{
+    CFE_SBR_RouteId_t      RouteId;
+    CFE_SB_DestinationD_t *DestPtr;
+    CFE_SB_PipeD_t *       PipeDscPtr;
+    uint32                 Fill;
+    uint32                 MaxFill;
+
+    if (FillPercentPtr == NULL || !CFE_SB_IsValidMsgId(MsgId))
     {
-        /* Copy actual message content into buffer */
-        memcpy(&BufPtr->Msg, MsgPtr, CFE_SB_MessageTxn_GetContentSize(Txn));
+        return CFE_SB_BAD_ARGUMENT;
+    }
 
-        /* Save passed-in parameters */
-        CFE_SB_MessageTxn_SetEndpoint(Txn, IsOrigination);
+    MaxFill = 0;
 
-        CFE_SB_TransmitTxn_Execute(Txn, BufPtr);
+    CFE_SB_LockSharedData(__func__, __LINE__);
 
-        /*
-         * The broadcast function consumes the buffer, so it should not be
-         * accessed in this function anymore
-         */
-        BufPtr = NULL;
+    RouteId = CFE_SBR_GetRouteId(MsgId);
+    if (CFE_SBR_IsValidRouteId(RouteId))
+    {
+        DestPtr = CFE_SBR_GetDestListHeadPtr(RouteId);
+        while (DestPtr != NULL)
+        {
+            if (DestPtr->Active == CFE_SB_ACTIVE)
+            {
+                PipeDscPtr = CFE_SB_LocatePipeDescByID(DestPtr->PipeId);
+            }
+            else
+            {
+                PipeDscPtr = NULL;
+            }
+
+            if (CFE_SB_PipeDescIsMatch(PipeDscPtr, DestPtr->PipeId))
+            {
+                /* Either limit being reached drops the message, so the fuller of the two counts */
+                if (DestPtr->MsgId2PipeLim > 0)
+                {
+                    Fill = ((uint32)DestPtr->BuffCount * 100) / DestPtr->MsgId2PipeLim;
+                    if (Fill > MaxFill)
+                    {
+                        MaxFill = Fill;
+                    }
+                }
+
+                if (PipeDscPtr->MaxQueueDepth > 0)
+                {
+                    Fill = ((uint32)PipeDscPtr->CurrentQueueDepth * 100) / PipeDscPtr->MaxQueueDepth;
+                    if (Fill > MaxFill)
+                    {
+                        MaxFill = Fill;
+                    }
+                }
+            }
+
+            DestPtr = DestPtr->Next;
+        }
     }
 
-    /* send an event for each pipe write error that may have occurred */
-    CFE_SB_MessageTxn_ReportEvents(Txn);
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
 
-    return CFE_SB_MessageTxn_GetStatus(Txn);
+    if (MaxFill > 100)
+    {
+        MaxFill = 100;
+    }
+
+    *FillPercentPtr = MaxFill;
+
+    return CFE_SUCCESS;
 }
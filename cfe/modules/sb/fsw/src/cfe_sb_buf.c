@@ -33,13 +33,6 @@
 
 #include "cfe_sb_module_all.h"
 
-/*
- * The actual message content of a SB Buffer Descriptor is the
- * offset of the content member.  This will be auto-aligned by
- * the compiler according to the requirements of the machine.
- */
-#define CFE_SB_BUFFERD_CONTENT_OFFSET (offsetof(CFE_SB_BufferD_t, Content))
-
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -94,19 +87,52 @@ void CFE_SB_TrackingListAdd(CFE_SB_BufferLink_t *List, CFE_SB_BufferLink_t *Node
  *-----------------------------------------------------------------*/
 CFE_SB_BufferD_t *CFE_SB_GetBufferFromPool(size_t MaxMsgSize)
 {
-    int32               stat1;
-    size_t              AllocSize;
-    CFE_ES_MemPoolBuf_t addr = NULL;
-    CFE_SB_BufferD_t *  bd;
+    int32                stat1;
+    size_t               AllocSize;
+    CFE_ES_MemPoolBuf_t  addr = NULL;
+    CFE_SB_BufferD_t *   bd   = NULL;
+    CFE_SB_BufferLink_t *SlotLink;
 
-    /* The allocation needs to include enough space for the descriptor object */
-    AllocSize = MaxMsgSize + CFE_SB_BUFFERD_CONTENT_OFFSET;
+    /* The allocation needs to include enough space for the descriptor object and an integrity trailer */
+    AllocSize = MaxMsgSize + CFE_MSG_INTEGRITY_MAX_TRAILER_SIZE + CFE_SB_BUFFERD_CONTENT_OFFSET;
 
-    /* Allocate a new buffer descriptor from the SB memory pool.*/
-    stat1 = CFE_ES_GetPoolBuf(&addr, CFE_SB_Global.Mem.PoolHdl, AllocSize);
-    if (stat1 < 0)
+    /* Small messages take the most recently freed slot, while it is likely still in cache */
+    if (MaxMsgSize <= CFE_PLATFORM_SB_SMALL_BUF_SIZE)
     {
-        return NULL;
+        SlotLink = CFE_SB_Global.SmallBufFreeList.Prev;
+        if (!CFE_SB_TrackingListIsEnd(&CFE_SB_Global.SmallBufFreeList, SlotLink))
+        {
+            CFE_SB_TrackingListRemove(SlotLink);
+
+            /* NOTE: casting via void* avoids a false alignment warning, the link is the first member */
+            bd        = (void *)SlotLink;
+            AllocSize = CFE_SB_SMALL_BUF_SLOT_SIZE;
+            CFE_SB_Global.StatTlmMsg.Payload.SmallBufHits++;
+        }
+        else
+        {
+            CFE_SB_Global.StatTlmMsg.Payload.SmallBufMisses++;
+        }
+    }
+
+    if (bd == NULL)
+    {
+        /* Allocate a new buffer descriptor from the SB memory pool.*/
+        stat1 = CFE_ES_GetPoolBuf(&addr, CFE_SB_Global.Mem.PoolHdl, AllocSize);
+        if (stat1 < 0)
+        {
+            return NULL;
+        }
+
+        /* Add the size of the actual buffer to the memory-in-use ctr and */
+        /* adjust the high water mark if needed */
+        CFE_SB_Global.StatTlmMsg.Payload.MemInUse += AllocSize;
+        if (CFE_SB_Global.StatTlmMsg.Payload.MemInUse > CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse)
+        {
+            CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse = CFE_SB_Global.StatTlmMsg.Payload.MemInUse;
+        }
+
+        bd = (CFE_SB_BufferD_t *)addr;
     }
 
     /* increment the number of buffers in use and adjust the high water mark if needed */
@@ -116,20 +142,12 @@ CFE_SB_BufferD_t *CFE_SB_GetBufferFromPool(size_t MaxMsgSize)
         CFE_SB_Global.StatTlmMsg.Payload.PeakSBBuffersInUse = CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse;
     }
 
-    /* Add the size of the actual buffer to the memory-in-use ctr and */
-    /* adjust the high water mark if needed */
-    CFE_SB_Global.StatTlmMsg.Payload.MemInUse += AllocSize;
-    if (CFE_SB_Global.StatTlmMsg.Payload.MemInUse > CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse)
-    {
-        CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse = CFE_SB_Global.StatTlmMsg.Payload.MemInUse;
-    }
-
     /* Initialize the buffer descriptor structure. */
-    bd = (CFE_SB_BufferD_t *)addr;
     memset(bd, 0, CFE_SB_BUFFERD_CONTENT_OFFSET);
 
     bd->UseCount      = 1;
     bd->AllocatedSize = AllocSize;
+    bd->IsSmallBuf    = (addr == NULL);
 
     CFE_SB_TrackingListReset(&bd->Link);
 
@@ -148,10 +166,19 @@ void CFE_SB_ReturnBufferToPool(CFE_SB_BufferD_t *bd)
     CFE_SB_TrackingListRemove(&bd->Link);
 
     --CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse;
-    CFE_SB_Global.StatTlmMsg.Payload.MemInUse -= bd->AllocatedSize;
 
-    /* finally give the buf descriptor back to the buf descriptor pool */
-    CFE_ES_PutPoolBuf(CFE_SB_Global.Mem.PoolHdl, bd);
+    if (bd->IsSmallBuf)
+    {
+        /* Small buffer slots go back on the free list */
+        CFE_SB_TrackingListAdd(&CFE_SB_Global.SmallBufFreeList, &bd->Link);
+    }
+    else
+    {
+        CFE_SB_Global.StatTlmMsg.Payload.MemInUse -= bd->AllocatedSize;
+
+        /* finally give the buf descriptor back to the buf descriptor pool */
+        CFE_ES_PutPoolBuf(CFE_SB_Global.Mem.PoolHdl, bd);
+    }
 }
 
 /*----------------------------------------------------------------
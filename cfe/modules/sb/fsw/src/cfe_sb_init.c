@@ -88,6 +88,12 @@ int32 CFE_SB_EarlyInit(void)
     CFE_MSG_Init(CFE_MSG_PTR(CFE_SB_Global.StatTlmMsg.TelemetryHeader), CFE_SB_ValueToMsgId(CFE_SB_STATS_TLM_MID),
                  sizeof(CFE_SB_Global.StatTlmMsg));
 
+#if CFE_PLATFORM_SB_LATENCY_STATS
+    /* Initialize the SB Latency Statistics Pkt */
+    CFE_MSG_Init(CFE_MSG_PTR(CFE_SB_Global.LatencyTlmMsg.TelemetryHeader), CFE_SB_ValueToMsgId(CFE_SB_LATENCY_TLM_MID),
+                 sizeof(CFE_SB_Global.LatencyTlmMsg));
+#endif
+
     return Stat;
 }
 
@@ -99,7 +105,8 @@ int32 CFE_SB_EarlyInit(void)
  *-----------------------------------------------------------------*/
 int32 CFE_SB_InitBuffers(void)
 {
-    int32 Stat = 0;
+    int32  Stat = 0;
+    uint32 i;
 
     Stat = CFE_ES_PoolCreateEx(&CFE_SB_Global.Mem.PoolHdl, CFE_SB_Global.Mem.Partition.Data,
                                CFE_PLATFORM_SB_BUF_MEMORY_BYTES, CFE_PLATFORM_ES_POOL_MAX_BUCKETS,
@@ -119,6 +126,15 @@ int32 CFE_SB_InitBuffers(void)
     CFE_SB_TrackingListReset(&CFE_SB_Global.InTransitList);
     CFE_SB_TrackingListReset(&CFE_SB_Global.ZeroCopyList);
 
+    /*
+     * All small buffer slots start out free
+     */
+    CFE_SB_TrackingListReset(&CFE_SB_Global.SmallBufFreeList);
+    for (i = 0; i < CFE_PLATFORM_SB_SMALL_BUF_COUNT; ++i)
+    {
+        CFE_SB_TrackingListAdd(&CFE_SB_Global.SmallBufFreeList, &CFE_SB_Global.SmallBufs[i].Desc.Link);
+    }
+
     return CFE_SUCCESS;
 }
 
@@ -341,6 +341,158 @@ void CFE_SB_FinishSendEvent(CFE_ES_TaskId_t TaskId, int32 Bit)
     CFE_CLR(CFE_SB_Global.StopRecurseFlags[Indx], Bit);
 }
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper: maps a latency to its histogram bucket
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CFE_SB_LatencyBucket(uint32 Usec)
+{
+    uint32 Msb;
+    uint32 Index;
+
+    if (Usec < 2)
+    {
+        return Usec;
+    }
+
+    Msb = 1;
+    while (Msb < 31 && (Usec >> (Msb + 1)) != 0)
+    {
+        ++Msb;
+    }
+
+    /* two buckets per power of two, picked by the bit below the MSB */
+    Index = (2 * Msb) + ((Usec >> (Msb - 1)) & 1);
+    if (Index >= CFE_SB_LATENCY_BUCKETS)
+    {
+        Index = CFE_SB_LATENCY_BUCKETS - 1;
+    }
+
+    return Index;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper: largest latency that maps to a histogram bucket
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CFE_SB_LatencyBucketLimit(uint32 Index)
+{
+    uint32 Shift;
+
+    if (Index < 2)
+    {
+        return Index;
+    }
+    if (Index >= CFE_SB_LATENCY_BUCKETS - 1)
+    {
+        return UINT32_MAX;
+    }
+
+    Shift = (Index / 2) - 1;
+    return ((2 + (Index & 1) + 1) << Shift) - 1;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_LatencyRecord(CFE_SB_LatencyHist_t *Hist, uint32 Usec)
+{
+    /* once a counter saturates the percentiles stop moving, reset clears it */
+    if (Hist->Count == UINT32_MAX)
+    {
+        return;
+    }
+
+    ++Hist->Count;
+    ++Hist->Bucket[CFE_SB_LatencyBucket(Usec)];
+    if (Usec > Hist->MaxUsec)
+    {
+        Hist->MaxUsec = Usec;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper: value at or below which the given share of samples fall
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CFE_SB_LatencyPercentile(const CFE_SB_LatencyHist_t *Hist, uint32 Percent)
+{
+    uint64 Target;
+    uint64 Sum;
+    uint32 Limit;
+    uint32 i;
+
+    /* the rank of the percentile sample, rounded up */
+    Target = (((uint64)Hist->Count * Percent) + 99) / 100;
+    Sum    = 0;
+    Limit  = Hist->MaxUsec;
+
+    for (i = 0; i < CFE_SB_LATENCY_BUCKETS; ++i)
+    {
+        Sum += Hist->Bucket[i];
+        if (Sum >= Target)
+        {
+            Limit = CFE_SB_LatencyBucketLimit(i);
+            break;
+        }
+    }
+
+    if (Limit > Hist->MaxUsec)
+    {
+        Limit = Hist->MaxUsec;
+    }
+
+    return Limit;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_LatencySummarize(const CFE_SB_LatencyHist_t *Hist, CFE_SB_LatencySummary_t *Summary)
+{
+    memset(Summary, 0, sizeof(*Summary));
+
+    if (Hist->Count != 0)
+    {
+        Summary->Count   = Hist->Count;
+        Summary->P50Usec = CFE_SB_LatencyPercentile(Hist, 50);
+        Summary->P99Usec = CFE_SB_LatencyPercentile(Hist, 99);
+        Summary->MaxUsec = Hist->MaxUsec;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_SB_LatencyElapsedUsec(OS_time_t Start, OS_time_t Now)
+{
+    int64 Usec;
+
+    Usec = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(Now, Start));
+    if (Usec < 0)
+    {
+        Usec = 0;
+    }
+    else if (Usec > UINT32_MAX)
+    {
+        Usec = UINT32_MAX;
+    }
+
+    return (uint32)Usec;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -387,6 +539,13 @@ int32 CFE_SB_AddDestNode(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *NewNo
  *-----------------------------------------------------------------*/
 void CFE_SB_RemoveDest(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *DestPtr)
 {
+    /* Release the reference held for a latest-value pipe */
+    if (DestPtr->LatestBuffer != NULL)
+    {
+        CFE_SB_DecrBufUseCnt(DestPtr->LatestBuffer);
+        DestPtr->LatestBuffer = NULL;
+    }
+
     CFE_SB_RemoveDestNode(RouteId, DestPtr);
     CFE_SB_PutDestinationBlk(DestPtr);
     CFE_SB_Global.StatTlmMsg.Payload.SubscriptionsInUse--;
@@ -558,6 +717,10 @@ void CFE_SB_MessageTxn_SetTimeout(CFE_SB_MessageTxn_State_t *TxnPtr, int32 Timeo
     {
         TxnPtr->TimeoutMode = CFE_SB_MessageTxn_TimeoutMode_PEND;
     }
+    else if (TxnPtr->IsTransmit)
+    {
+        CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, CFE_SB_SEND_BAD_ARG_EID, CFE_SB_BAD_ARGUMENT);
+    }
     else
     {
         CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, CFE_SB_RCV_BAD_ARG_EID, CFE_SB_BAD_ARGUMENT);
@@ -976,8 +1139,27 @@ void CFE_SB_TransmitTxn_FindDestinations(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_
 
             if (CFE_SB_PipeDescIsMatch(PipeDscPtr, DestPtr->PipeId))
             {
-                if ((PipeDscPtr->Opts & CFE_SB_PIPEOPTS_IGNOREMINE) == 0 ||
-                    !CFE_RESOURCEID_TEST_EQUAL(PipeDscPtr->AppId, AppId))
+                if ((PipeDscPtr->Opts & CFE_SB_PIPEOPTS_IGNOREMINE) != 0 &&
+                    CFE_RESOURCEID_TEST_EQUAL(PipeDscPtr->AppId, AppId))
+                {
+                    /* loopback to the sender is not wanted on this pipe */
+                }
+                else if ((PipeDscPtr->Opts & CFE_SB_PIPEOPTS_LATEST_VALUE) != 0 && DestPtr->BuffCount > 0)
+                {
+                    /*
+                     * A message with this MsgId is already queued on a latest-value pipe.
+                     * Rather than enqueue another one, keep this buffer with the destination;
+                     * the reader gets it in place of the queued one.  Any buffer kept by an
+                     * earlier publish is now stale and is released.
+                     */
+                    CFE_SB_IncrBufUseCnt(BufDscPtr);
+                    if (DestPtr->LatestBuffer != NULL)
+                    {
+                        CFE_SB_DecrBufUseCnt(DestPtr->LatestBuffer);
+                    }
+                    DestPtr->LatestBuffer = BufDscPtr;
+                }
+                else
                 {
                     ContextPtr = &TxnPtr->PipeSet[TxnPtr->NumPipes];
                     ++TxnPtr->NumPipes;
@@ -991,20 +1173,66 @@ void CFE_SB_TransmitTxn_FindDestinations(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_
                 ContextPtr->PipeId     = DestPtr->PipeId;
                 ContextPtr->SysQueueId = PipeDscPtr->SysQueueId;
 
+                ContextPtr->IsPriority = (DestPtr->Priority >= CFE_SB_QosPriority_HIGH);
+
                 /* if Msg limit exceeded, log event, increment counter */
                 /* and go to next destination */
-                if (DestPtr->BuffCount >= DestPtr->MsgId2PipeLim)
+                if (!ContextPtr->IsPriority && TxnPtr->TimeoutMode != CFE_SB_MessageTxn_TimeoutMode_POLL &&
+                    !CFE_RESOURCEID_TEST_EQUAL(PipeDscPtr->AppId, AppId) &&
+                    (DestPtr->BuffCount >= DestPtr->MsgId2PipeLim ||
+                     PipeDscPtr->CurrentQueueDepth >= PipeDscPtr->MaxQueueDepth))
+                {
+                    /*
+                     * A blocking transmit waits for the receiver instead, see CFE_SB_TransmitTxn_WaitForRoom().
+                     * Pipes owned by the sending app are excluded, as they can only be drained by the
+                     * sender itself and waiting on them would never end with CFE_SB_PEND_FOREVER.
+                     */
+                    ContextPtr->IsDeferred = true;
+                }
+                else if (DestPtr->BuffCount >= DestPtr->MsgId2PipeLim)
                 {
                     ContextPtr->PendingEventId = CFE_SB_MSGID_LIM_ERR_EID;
                     ++CFE_SB_Global.HKTlmMsg.Payload.MsgLimitErrorCounter;
                     ++PipeDscPtr->SendErrors;
                     ++TxnPtr->NumPipeErrs;
                 }
+                else if (ContextPtr->IsPriority &&
+                         PipeDscPtr->PriorityLaneDepth >= CFE_PLATFORM_SB_PIPE_PRIORITY_LANE_DEPTH)
+                {
+                    /* The priority lane has its own limit, report it like a full queue */
+                    ContextPtr->PendingEventId = CFE_SB_Q_FULL_ERR_EID;
+                    ++CFE_SB_Global.HKTlmMsg.Payload.PipeOverflowErrorCounter;
+                    ++PipeDscPtr->SendErrors;
+                    ++TxnPtr->NumPipeErrs;
+                }
                 else
                 {
                     CFE_SB_IncrBufUseCnt(BufDscPtr);
                     ++DestPtr->BuffCount;
 
+                    if (ContextPtr->IsPriority)
+                    {
+                        PipeDscPtr->PriorityLane[(PipeDscPtr->PriorityLaneHead + PipeDscPtr->PriorityLaneDepth) %
+                                                 CFE_PLATFORM_SB_PIPE_PRIORITY_LANE_DEPTH] = BufDscPtr;
+                        ++PipeDscPtr->PriorityLaneDepth;
+                        if (PipeDscPtr->PriorityLaneDepth > PipeDscPtr->PeakPriorityLaneDepth)
+                        {
+                            PipeDscPtr->PeakPriorityLaneDepth = PipeDscPtr->PriorityLaneDepth;
+                        }
+
+                        /*
+                         * A wakeup already in the queue covers this message too, since
+                         * the receiver drains the whole lane before reading the queue.
+                         * Otherwise one is written, and holds a queue slot until read.
+                         */
+                        if (!PipeDscPtr->PriorityWakeupQueued)
+                        {
+                            PipeDscPtr->PriorityWakeupQueued = true;
+                            ContextPtr->IsWakeup             = true;
+                            ++PipeDscPtr->CurrentQueueDepth;
+                        }
+                    }
+
                     ++PipeDscPtr->CurrentQueueDepth;
                     if (PipeDscPtr->CurrentQueueDepth > PipeDscPtr->PeakQueueDepth)
                     {
@@ -1050,7 +1278,8 @@ void CFE_SB_TransmitTxn_FindDestinations(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_
     if (CFE_SB_MessageTxn_IsOK(TxnPtr) && TxnPtr->IsEndpoint)
     {
         /* Update any other system-specific MSG headers based on the current sequence */
-        Status = CFE_MSG_OriginationAction(&BufDscPtr->Content.Msg, BufDscPtr->AllocatedSize, &IsAcceptable);
+        Status = CFE_MSG_OriginationAction(&BufDscPtr->Content.Msg,
+                                           BufDscPtr->AllocatedSize - CFE_SB_BUFFERD_CONTENT_OFFSET, &IsAcceptable);
         if (Status != CFE_SUCCESS || !IsAcceptable)
         {
             CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, CFE_SB_SEND_MESSAGE_INTEGRITY_FAIL_EID, Status);
@@ -1092,6 +1321,88 @@ int32 CFE_SB_MessageTxn_GetOsTimeout(const CFE_SB_MessageTxn_State_t *TxnPtr)
     return OsTimeout;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Local Helper function
+ * Not invoked outside of this unit
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_SB_TransmitTxn_WaitForRoom(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeSetEntry_t *ContextPtr,
+                                    CFE_SB_BufferD_t *BufDscPtr)
+{
+    CFE_SB_DestinationD_t *DestPtr;
+    CFE_SB_PipeD_t *       PipeDscPtr;
+    int32                  OsTimeout;
+    bool                   IsReady;
+
+    IsReady = false;
+
+    while (ContextPtr->IsDeferred)
+    {
+        /* Sample the time first, so that a final check for room is made after the timeout expires */
+        OsTimeout = CFE_SB_MessageTxn_GetOsTimeout(TxnPtr);
+
+        CFE_SB_LockSharedData(__func__, __LINE__);
+
+        PipeDscPtr = CFE_SB_LocatePipeDescByID(ContextPtr->PipeId);
+        DestPtr    = CFE_SB_GetDestPtr(BufDscPtr->DestRouteId, ContextPtr->PipeId);
+
+        if (!CFE_SB_PipeDescIsMatch(PipeDscPtr, ContextPtr->PipeId) || DestPtr == NULL ||
+            DestPtr->Active != CFE_SB_ACTIVE)
+        {
+            /* Unsubscribed or deleted while waiting, nothing is owed to this pipe */
+            ContextPtr->IsDeferred = false;
+        }
+        else if (DestPtr->BuffCount < DestPtr->MsgId2PipeLim &&
+                 PipeDscPtr->CurrentQueueDepth < PipeDscPtr->MaxQueueDepth)
+        {
+            CFE_SB_IncrBufUseCnt(BufDscPtr);
+            ++DestPtr->BuffCount;
+
+            ++PipeDscPtr->CurrentQueueDepth;
+            if (PipeDscPtr->CurrentQueueDepth > PipeDscPtr->PeakQueueDepth)
+            {
+                PipeDscPtr->PeakQueueDepth = PipeDscPtr->CurrentQueueDepth;
+            }
+
+            ContextPtr->IsDeferred = false;
+            IsReady                = true;
+        }
+        else if (OsTimeout == OS_CHECK)
+        {
+            if (DestPtr->BuffCount >= DestPtr->MsgId2PipeLim)
+            {
+                ContextPtr->PendingEventId = CFE_SB_MSGID_LIM_ERR_EID;
+                ++CFE_SB_Global.HKTlmMsg.Payload.MsgLimitErrorCounter;
+            }
+            else
+            {
+                ContextPtr->PendingEventId = CFE_SB_Q_FULL_ERR_EID;
+                ++CFE_SB_Global.HKTlmMsg.Payload.PipeOverflowErrorCounter;
+            }
+
+            ++PipeDscPtr->SendErrors;
+            ++TxnPtr->NumPipeErrs;
+
+            ContextPtr->IsDeferred = false;
+        }
+
+        CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+        if (ContextPtr->IsDeferred)
+        {
+            if (OsTimeout < 0 || OsTimeout > CFE_SB_TRANSMIT_RETRY_DLY)
+            {
+                OsTimeout = CFE_SB_TRANSMIT_RETRY_DLY;
+            }
+
+            OS_TaskDelay(OsTimeout);
+        }
+    }
+
+    return IsReady;
+}
+
 /*----------------------------------------------------------------
  *
  * Local Helper function
@@ -1103,17 +1414,53 @@ bool CFE_SB_TransmitTxn_PipeHandler(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_Pi
     CFE_SB_DestinationD_t *DestPtr;
     CFE_SB_PipeD_t *       PipeDscPtr;
     CFE_SB_BufferD_t *     BufDscPtr;
+    CFE_SB_BufferD_t *     QueueEntry;
 
     BufDscPtr = Arg;
 
+    if (ContextPtr->IsDeferred)
+    {
+        /* Written by CFE_SB_TransmitTxn_DeferredPipeHandler() once all others are done */
+        return true;
+    }
+
+    if (ContextPtr->IsPriority)
+    {
+        /*
+         * The message is already in the priority lane, the queue entry only wakes
+         * up the receiver.  If the queue is full the receiver is not waiting and
+         * will find the message on its next read, so a failure is not an error,
+         * but the slot reserved for the wakeup is given back.
+         */
+        QueueEntry = NULL;
+        if (ContextPtr->IsWakeup &&
+            OS_QueuePut(ContextPtr->SysQueueId, &QueueEntry, sizeof(QueueEntry), 0) != OS_SUCCESS)
+        {
+            CFE_SB_LockSharedData(__func__, __LINE__);
+
+            PipeDscPtr = CFE_SB_LocatePipeDescByID(ContextPtr->PipeId);
+            if (CFE_SB_PipeDescIsMatch(PipeDscPtr, ContextPtr->PipeId) && PipeDscPtr->PriorityWakeupQueued)
+            {
+                PipeDscPtr->PriorityWakeupQueued = false;
+                --PipeDscPtr->CurrentQueueDepth;
+            }
+
+            CFE_SB_UnlockSharedData(__func__, __LINE__);
+        }
+
+        return true;
+    }
+
     /*
      * Write the buffer descriptor to the queue of the pipe.  Note that
      * accounting for depth and buffer limits was already done as part
      * of "FindDestinations" assuming this write will be successful - which
      * is the expected/typical result here.
+     *
+     * OSAL queue writes never block, a blocking transmit has already waited
+     * for room in CFE_SB_TransmitTxn_WaitForRoom() above.
      */
-    ContextPtr->OsStatus =
-        OS_QueuePut(ContextPtr->SysQueueId, &BufDscPtr, sizeof(BufDscPtr), CFE_SB_MessageTxn_GetOsTimeout(TxnPtr));
+    ContextPtr->OsStatus = OS_QueuePut(ContextPtr->SysQueueId, &BufDscPtr, sizeof(BufDscPtr), 0);
 
     /*
      * If it succeeded, nothing else to do.  But if it fails then we must undo the
@@ -1149,6 +1496,13 @@ bool CFE_SB_TransmitTxn_PipeHandler(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_Pi
             DestPtr->BuffCount--;
         }
 
+        /* Nothing is queued for a newer buffer to replace */
+        if (DestPtr != NULL && DestPtr->BuffCount == 0 && DestPtr->LatestBuffer != NULL)
+        {
+            CFE_SB_DecrBufUseCnt(DestPtr->LatestBuffer);
+            DestPtr->LatestBuffer = NULL;
+        }
+
         CFE_SB_DecrBufUseCnt(BufDscPtr);
 
         CFE_SB_UnlockSharedData(__func__, __LINE__);
@@ -1158,6 +1512,23 @@ bool CFE_SB_TransmitTxn_PipeHandler(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_Pi
     return true;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Local Helper function
+ * Not invoked outside of this unit
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_SB_TransmitTxn_DeferredPipeHandler(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeSetEntry_t *ContextPtr,
+                                            void *Arg)
+{
+    if (ContextPtr->IsDeferred && CFE_SB_TransmitTxn_WaitForRoom(TxnPtr, ContextPtr, Arg))
+    {
+        return CFE_SB_TransmitTxn_PipeHandler(TxnPtr, ContextPtr, Arg);
+    }
+
+    return true;
+}
+
 /*----------------------------------------------------------------
  *
  * Local Helper function
@@ -1193,6 +1564,9 @@ void CFE_SB_TransmitTxn_Execute(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_Buffer
 {
     int32             Status;
     CFE_SB_BufferD_t *BufDscPtr;
+#if CFE_PLATFORM_SB_LATENCY_STATS
+    OS_time_t         TimeNow;
+#endif
 
     /* Sanity check on the input buffer - if this doesn't work, stop now */
     Status = CFE_SB_ZeroCopyBufferValidate(BufPtr, &BufDscPtr);
@@ -1207,6 +1581,11 @@ void CFE_SB_TransmitTxn_Execute(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_Buffer
     BufDscPtr->ContentSize = CFE_SB_MessageTxn_GetContentSize(TxnPtr);
     BufDscPtr->MsgId       = CFE_SB_MessageTxn_GetRoutingMsgId(TxnPtr);
 
+#if CFE_PLATFORM_SB_LATENCY_STATS
+    /* Stamp before the first enqueue, receivers measure their latency from here */
+    CFE_PSP_GetTime(&BufDscPtr->TransmitTime);
+#endif
+
     /* Convert the route to a set of pipes/destinations */
     CFE_SB_TransmitTxn_FindDestinations(TxnPtr, BufDscPtr);
 
@@ -1214,15 +1593,87 @@ void CFE_SB_TransmitTxn_Execute(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_Buffer
      * the transaction will simply have 0 pipes and this next call becomes a no-op */
     CFE_SB_MessageTxn_ProcessPipes(CFE_SB_TransmitTxn_PipeHandler, TxnPtr, BufDscPtr);
 
+    /* Only then wait on destinations that were full, so the others are not held up */
+    CFE_SB_MessageTxn_ProcessPipes(CFE_SB_TransmitTxn_DeferredPipeHandler, TxnPtr, BufDscPtr);
+
     /*
      * Decrement the buffer UseCount - This means that the caller
      * should not use the buffer anymore after this call.
      */
+#if CFE_PLATFORM_SB_LATENCY_STATS
+    CFE_PSP_GetTime(&TimeNow);
+#endif
+
     CFE_SB_LockSharedData(__func__, __LINE__);
+#if CFE_PLATFORM_SB_LATENCY_STATS
+    if (CFE_SBR_IsValidRouteId(BufDscPtr->DestRouteId))
+    {
+        CFE_SB_LatencyRecord(&CFE_SB_Global.RoutePublish[CFE_SBR_RouteIdToValue(BufDscPtr->DestRouteId)],
+                             CFE_SB_LatencyElapsedUsec(BufDscPtr->TransmitTime, TimeNow));
+    }
+#endif
     CFE_SB_DecrBufUseCnt(BufDscPtr);
     CFE_SB_UnlockSharedData(__func__, __LINE__);
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_TransmitTxn_ExecuteFromMsg(CFE_SB_MessageTxn_State_t *TxnPtr, const CFE_MSG_Message_t *MsgPtr,
+                                       bool IsOrigination)
+{
+    CFE_SB_Buffer_t *BufPtr;
+
+    BufPtr = NULL;
+
+    /* In this context, the user should have set the the size and MsgId in the content */
+    if (CFE_SB_MessageTxn_IsOK(TxnPtr))
+    {
+        CFE_SB_TransmitTxn_SetupFromMsg(TxnPtr, MsgPtr);
+    }
+
+    if (CFE_SB_MessageTxn_IsOK(TxnPtr))
+    {
+        /* Get buffer - note this pre-initializes the returned buffer with
+         * a use count of 1, which refers to this task as it fills the buffer. */
+        BufPtr = CFE_SB_AllocateMessageBuffer(CFE_SB_MessageTxn_GetContentSize(TxnPtr));
+        if (BufPtr == NULL)
+        {
+            CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, CFE_SB_GET_BUF_ERR_EID, CFE_SB_BUF_ALOC_ERR);
+        }
+    }
+
+    /*
+     * If a buffer was obtained above, then copy the content into it
+     * and broadcast it to all subscribers in the route.
+     *
+     * Note - if there is no route / no subscribers, the "Status" will
+     * be CFE_SUCCESS because CFE_SB_TransmitMsgValidate() succeeded,
+     * but there will be no buffer because CFE_SBR_IsValidRouteId() returned
+     * false.
+     *
+     * But if the descriptor is non-null it means the message is valid and
+     * there is a route to send it to.
+     */
+    if (CFE_SB_MessageTxn_IsOK(TxnPtr))
+    {
+        /* Copy actual message content into buffer */
+        memcpy(&BufPtr->Msg, MsgPtr, CFE_SB_MessageTxn_GetContentSize(TxnPtr));
+
+        /* Save passed-in parameters */
+        CFE_SB_MessageTxn_SetEndpoint(TxnPtr, IsOrigination);
+
+        /*
+         * The broadcast function consumes the buffer, so it should not be
+         * accessed in this function anymore
+         */
+        CFE_SB_TransmitTxn_Execute(TxnPtr, BufPtr);
+    }
+}
+
 /******************************************************************
  *
  * RECEIVE TRANSACTION IMPLEMENTATION FUNCTIONS
@@ -1330,9 +1781,18 @@ void CFE_SB_ReceiveTxn_ExportReference(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB
 {
     CFE_SB_PipeD_t *       PipeDscPtr;
     CFE_SB_DestinationD_t *DestPtr;
+#if CFE_PLATFORM_SB_LATENCY_STATS
+    OS_time_t              TimeNow;
+    uint32                 LatencyUsec;
+#endif
 
     PipeDscPtr = CFE_SB_LocatePipeDescByID(ContextPtr->PipeId);
 
+#if CFE_PLATFORM_SB_LATENCY_STATS
+    /* Take the receive time outside the lock so lock contention does not count */
+    CFE_PSP_GetTime(&TimeNow);
+#endif
+
     /* Now re-lock to store the buffer in the pipe descriptor */
     CFE_SB_LockSharedData(__func__, __LINE__);
 
@@ -1343,6 +1803,24 @@ void CFE_SB_ReceiveTxn_ExportReference(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB
      */
     if (CFE_SB_PipeDescIsMatch(PipeDscPtr, ContextPtr->PipeId))
     {
+        /* get pointer to destination to be used in decrementing msg limit cnt*/
+        DestPtr = CFE_SB_GetDestPtr(BufDscPtr->DestRouteId, ContextPtr->PipeId);
+
+        /*
+         * On a latest-value pipe a newer message may have replaced the queued one.
+         * Deliver the newer one; its reference takes the place of the queued reference.
+         */
+        if (DestPtr != NULL && DestPtr->LatestBuffer != NULL)
+        {
+            CFE_SB_DecrBufUseCnt(BufDscPtr);
+            BufDscPtr             = DestPtr->LatestBuffer;
+            DestPtr->LatestBuffer = NULL;
+        }
+
+#if CFE_PLATFORM_SB_LATENCY_STATS
+        LatencyUsec = CFE_SB_LatencyElapsedUsec(BufDscPtr->TransmitTime, TimeNow);
+#endif
+
         /*
         ** Load the pipe tables 'CurrentBuff' with the buffer descriptor
         ** ptr corresponding to the message just read. This is done so that
@@ -1359,9 +1837,6 @@ void CFE_SB_ReceiveTxn_ExportReference(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB
          */
         *ParentBufDscPtrP = BufDscPtr;
 
-        /* get pointer to destination to be used in decrementing msg limit cnt*/
-        DestPtr = CFE_SB_GetDestPtr(BufDscPtr->DestRouteId, ContextPtr->PipeId);
-
         /*
         ** DestPtr would be NULL if the msg is unsubscribed to while it is on
         ** the pipe. The BuffCount may be zero if the msg is unsubscribed to and
@@ -1377,6 +1852,15 @@ void CFE_SB_ReceiveTxn_ExportReference(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB
         {
             --PipeDscPtr->CurrentQueueDepth;
         }
+
+#if CFE_PLATFORM_SB_LATENCY_STATS
+        CFE_SB_LatencyRecord(&PipeDscPtr->Latency, LatencyUsec);
+        if (CFE_SBR_IsValidRouteId(BufDscPtr->DestRouteId))
+        {
+            CFE_SB_LatencyRecord(&CFE_SB_Global.RouteDelivery[CFE_SBR_RouteIdToValue(BufDscPtr->DestRouteId)],
+                                 LatencyUsec);
+        }
+#endif
     }
     else
     {
@@ -1392,6 +1876,68 @@ void CFE_SB_ReceiveTxn_ExportReference(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB
     CFE_SB_UnlockSharedData(__func__, __LINE__);
 }
 
+/*----------------------------------------------------------------
+ *
+ * Local Helper function
+ * Not invoked outside of this unit
+ *
+ *-----------------------------------------------------------------*/
+CFE_SB_BufferD_t *CFE_SB_ReceiveTxn_PopPriorityLane(CFE_SB_PipeSetEntry_t *ContextPtr)
+{
+    CFE_SB_PipeD_t *  PipeDscPtr;
+    CFE_SB_BufferD_t *BufDscPtr;
+
+    BufDscPtr  = NULL;
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(ContextPtr->PipeId);
+
+    /*
+     * Checked once without the lock so that pipes without priority
+     * traffic do not pay for it; rechecked below once locked.
+     */
+    if (PipeDscPtr != NULL && PipeDscPtr->PriorityLaneDepth != 0)
+    {
+        CFE_SB_LockSharedData(__func__, __LINE__);
+
+        if (CFE_SB_PipeDescIsMatch(PipeDscPtr, ContextPtr->PipeId) && PipeDscPtr->PriorityLaneDepth != 0)
+        {
+            BufDscPtr = PipeDscPtr->PriorityLane[PipeDscPtr->PriorityLaneHead];
+            PipeDscPtr->PriorityLaneHead =
+                (PipeDscPtr->PriorityLaneHead + 1) % CFE_PLATFORM_SB_PIPE_PRIORITY_LANE_DEPTH;
+            --PipeDscPtr->PriorityLaneDepth;
+        }
+
+        CFE_SB_UnlockSharedData(__func__, __LINE__);
+    }
+
+    return BufDscPtr;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local Helper function
+ * Not invoked outside of this unit
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_ReceiveTxn_ConsumeWakeup(CFE_SB_PipeSetEntry_t *ContextPtr)
+{
+    CFE_SB_PipeD_t *PipeDscPtr;
+
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    /* The wakeup has left the queue, so the next priority message needs a new one */
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(ContextPtr->PipeId);
+    if (CFE_SB_PipeDescIsMatch(PipeDscPtr, ContextPtr->PipeId) && PipeDscPtr->PriorityWakeupQueued)
+    {
+        PipeDscPtr->PriorityWakeupQueued = false;
+        if (PipeDscPtr->CurrentQueueDepth > 0)
+        {
+            --PipeDscPtr->CurrentQueueDepth;
+        }
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+}
+
 /*----------------------------------------------------------------
  *
  * Local Helper function
@@ -1403,12 +1949,37 @@ bool CFE_SB_ReceiveTxn_PipeHandler(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_Pip
     CFE_SB_BufferD_t * BufDscPtr;
     CFE_SB_BufferD_t **ParentBufDscPtrP;
     size_t             BufDscSize;
+    uint32             ReadCount;
 
     ParentBufDscPtrP = Arg;
+    ReadCount        = 0;
 
-    /* Read the buffer descriptor address from the queue.  */
-    ContextPtr->OsStatus = OS_QueueGet(ContextPtr->SysQueueId, &BufDscPtr, sizeof(BufDscPtr), &BufDscSize,
-                                       CFE_SB_MessageTxn_GetOsTimeout(TxnPtr));
+    /*
+     * The priority lane is served first.  A NULL entry in the queue is the wakeup
+     * for priority messages, which may have been read already - in that case
+     * keep reading the queue.  Only one wakeup is queued at a time, so this
+     * reads at most one more, the count only guards against a corrupt queue.
+     */
+    do
+    {
+        ++ReadCount;
+        BufDscPtr = CFE_SB_ReceiveTxn_PopPriorityLane(ContextPtr);
+        if (BufDscPtr != NULL)
+        {
+            ContextPtr->OsStatus = OS_SUCCESS;
+            BufDscSize           = sizeof(BufDscPtr);
+            break;
+        }
+
+        /* Read the buffer descriptor address from the queue.  */
+        ContextPtr->OsStatus = OS_QueueGet(ContextPtr->SysQueueId, &BufDscPtr, sizeof(BufDscPtr), &BufDscSize,
+                                           CFE_SB_MessageTxn_GetOsTimeout(TxnPtr));
+        if (ContextPtr->OsStatus == OS_SUCCESS && BufDscPtr == NULL && BufDscSize == sizeof(BufDscPtr))
+        {
+            CFE_SB_ReceiveTxn_ConsumeWakeup(ContextPtr);
+        }
+    } while (ContextPtr->OsStatus == OS_SUCCESS && BufDscPtr == NULL && BufDscSize == sizeof(BufDscPtr) &&
+             ReadCount <= OS_QUEUE_MAX_DEPTH);
 
     /*
      * translate the return value -
@@ -1483,7 +2054,9 @@ const CFE_SB_Buffer_t *CFE_SB_ReceiveTxn_Execute(CFE_SB_MessageTxn_State_t *TxnP
 
         if (TxnPtr->IsEndpoint)
         {
-            Status = CFE_MSG_VerificationAction(&BufDscPtr->Content.Msg, BufDscPtr->AllocatedSize, &IsAcceptable);
+            Status = CFE_MSG_VerificationAction(&BufDscPtr->Content.Msg,
+                                                BufDscPtr->AllocatedSize - CFE_SB_BUFFERD_CONTENT_OFFSET,
+                                                &IsAcceptable);
             if (Status != CFE_SUCCESS)
             {
                 /* This typically should not happen - only if VerificationAction got bad arguments */
@@ -78,6 +78,7 @@
 #define CFE_SB_INCREMENT_TLM    1
 
 #define CFE_SB_MAIN_LOOP_ERR_DLY             1000
+#define CFE_SB_TRANSMIT_RETRY_DLY            1
 #define CFE_SB_CMD_PIPE_DEPTH                32
 #define CFE_SB_CMD_PIPE_NAME                 "SB_CMD_PIPE"
 #define CFE_SB_MAX_CFG_FILE_EVENTS_TO_FILTER 8
@@ -153,11 +154,76 @@ typedef struct CFE_SB_BufferD
     size_t AllocatedSize; /**< Total size of this descriptor (including descriptor itself) */
     size_t ContentSize;   /**< Actual size of message content currently stored in the buffer */
 
-    uint16 UseCount; /**< Number of active references to this buffer in the system */
+    uint16 UseCount;   /**< Number of active references to this buffer in the system */
+    bool   IsSmallBuf; /**< Buffer is one of the small buffer slots, not from the memory pool */
+
+#if CFE_PLATFORM_SB_LATENCY_STATS
+    OS_time_t TransmitTime; /**< PSP time at which the current transmit of this buffer started */
+#endif
 
     CFE_SB_Buffer_t Content; /* Variably sized content field, Keep last */
 } CFE_SB_BufferD_t;
 
+/*
+ * The actual message content of a SB Buffer Descriptor is the
+ * offset of the content member.  This will be auto-aligned by
+ * the compiler according to the requirements of the machine.
+ */
+#define CFE_SB_BUFFERD_CONTENT_OFFSET (offsetof(CFE_SB_BufferD_t, Content))
+
+/*
+ * A small buffer slot holds the descriptor and CFE_PLATFORM_SB_SMALL_BUF_SIZE
+ * bytes of content plus room for an integrity trailer, rounded up to a multiple
+ * of a typical cache line size so neighboring slots do not share lines.
+ */
+#define CFE_SB_SMALL_BUF_LINE_SIZE 64
+#define CFE_SB_SMALL_BUF_SLOT_SIZE                                                                                   \
+    (((CFE_SB_BUFFERD_CONTENT_OFFSET + CFE_PLATFORM_SB_SMALL_BUF_SIZE + CFE_MSG_INTEGRITY_MAX_TRAILER_SIZE +         \
+       CFE_SB_SMALL_BUF_LINE_SIZE - 1) /                                                                             \
+      CFE_SB_SMALL_BUF_LINE_SIZE) *                                                                                  \
+     CFE_SB_SMALL_BUF_LINE_SIZE)
+
+/*
+ * The slot size alone only keeps slots off each other's lines if the array
+ * itself starts on a line boundary, so the slot type carries the alignment
+ * where the compiler supports it.
+ */
+#if defined(__GNUC__)
+#define CFE_SB_SMALL_BUF_ALIGN __attribute__((aligned(CFE_SB_SMALL_BUF_LINE_SIZE)))
+#else
+#define CFE_SB_SMALL_BUF_ALIGN
+#endif
+
+/******************************************************************************
+**  Typedef:  CFE_SB_SmallBuf_t
+**
+**  Purpose:
+**     One fixed slot for a small message, see #CFE_PLATFORM_SB_SMALL_BUF_SIZE.
+*/
+typedef union CFE_SB_SmallBuf
+{
+    CFE_SB_BufferD_t Desc;
+    uint8            Slot[CFE_SB_SMALL_BUF_SLOT_SIZE];
+} CFE_SB_SMALL_BUF_ALIGN CFE_SB_SmallBuf_t;
+
+/******************************************************************************
+**  Typedef:  CFE_SB_LatencyHist_t
+**
+**  Purpose:
+**     Log-linear histogram of latencies in microseconds.  Buckets 0 and 1 hold
+**     exactly 0 and 1 usec, after that each power of two is split into two
+**     buckets so the bucket width is never more than half its lower bound.
+**     The last bucket also collects everything beyond its range.
+*/
+#define CFE_SB_LATENCY_BUCKETS 40
+
+typedef struct
+{
+    uint32 Count;
+    uint32 MaxUsec;
+    uint32 Bucket[CFE_SB_LATENCY_BUCKETS];
+} CFE_SB_LatencyHist_t;
+
 /******************************************************************************
 **  Typedef:  CFE_SB_PipeD_t
 **
@@ -168,16 +234,31 @@ typedef struct CFE_SB_BufferD
 
 typedef struct
 {
-    CFE_SB_PipeId_t   PipeId;
-    CFE_ES_AppId_t    AppId;
-    osal_id_t         SysQueueId;
-    uint8             Opts;
-    uint8             Spare;
-    uint16            SendErrors;
-    uint16            MaxQueueDepth;
-    uint16            CurrentQueueDepth;
-    uint16            PeakQueueDepth;
-    CFE_SB_BufferD_t *LastBuffer;
+    CFE_SB_PipeId_t      PipeId;
+    CFE_ES_AppId_t       AppId;
+    osal_id_t            SysQueueId;
+    uint8                Opts;
+    uint8                Spare;
+    uint16               SendErrors;
+    uint16               MaxQueueDepth;
+    uint16               CurrentQueueDepth;
+    uint16               PeakQueueDepth;
+    CFE_SB_BufferD_t    *LastBuffer;
+#if CFE_PLATFORM_SB_LATENCY_STATS
+    CFE_SB_LatencyHist_t Latency; /**< Transmit to receive time of messages read from this pipe */
+#endif
+
+    /*
+     * Priority lane, a ring of messages from high priority subscriptions.  The
+     * receiver reads this before the OS queue.  A NULL entry in the OS queue
+     * wakes up a pending receiver; only one is outstanding at a time, and it
+     * counts in CurrentQueueDepth for as long as it occupies a queue slot.
+     */
+    uint16            PriorityLaneHead;
+    uint16            PriorityLaneDepth;
+    uint16            PeakPriorityLaneDepth;
+    bool              PriorityWakeupQueued;
+    CFE_SB_BufferD_t *PriorityLane[CFE_PLATFORM_SB_PIPE_PRIORITY_LANE_DEPTH];
 } CFE_SB_PipeD_t;
 
 /******************************************************************************
@@ -243,6 +324,9 @@ typedef struct
     CFE_SB_PipeD_t               PipeTbl[CFE_PLATFORM_SB_MAX_PIPES];
     CFE_SB_HousekeepingTlm_t     HKTlmMsg;
     CFE_SB_StatsTlm_t            StatTlmMsg;
+#if CFE_PLATFORM_SB_LATENCY_STATS
+    CFE_SB_LatencyStatsTlm_t LatencyTlmMsg;
+#endif
     CFE_SB_PipeId_t              CmdPipe;
     CFE_SB_MemParams_t           Mem;
     CFE_SB_AllSubscriptionsTlm_t PrevSubMsg;
@@ -257,6 +341,16 @@ typedef struct
 
     /* A list of buffers currently issued to apps for zero-copy */
     CFE_SB_BufferLink_t ZeroCopyList;
+
+    /* Fixed slots for small messages, and the list of those not in use */
+    CFE_SB_BufferLink_t SmallBufFreeList;
+    CFE_SB_SmallBuf_t   SmallBufs[CFE_PLATFORM_SB_SMALL_BUF_COUNT];
+
+#if CFE_PLATFORM_SB_LATENCY_STATS
+    /* Per-route latency histograms, indexed by CFE_SBR_RouteIdToValue() */
+    CFE_SB_LatencyHist_t RouteDelivery[CFE_PLATFORM_SB_MAX_MSG_IDS]; /* transmit to receive, all pipes */
+    CFE_SB_LatencyHist_t RoutePublish[CFE_PLATFORM_SB_MAX_MSG_IDS];  /* duration of the transmit call */
+#endif
 } CFE_SB_Global_t;
 
 /******************************************************************************
@@ -267,6 +361,9 @@ typedef struct
     CFE_SB_PipeId_t PipeId;
     osal_id_t       SysQueueId;
     uint16          PendingEventId;
+    bool            IsPriority; /**< Message is in the priority lane, only a wakeup goes to the queue */
+    bool            IsWakeup;   /**< Priority message needs the wakeup entry written to the queue */
+    bool            IsDeferred; /**< Destination was full, wait for the receiver before queueing */
     int32           OsStatus;
 } CFE_SB_PipeSetEntry_t;
 
@@ -392,6 +489,15 @@ void CFE_SB_UnlockSharedData(const char *FuncName, int32 LineNumber);
  */
 void CFE_SB_ResetCounters(void);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Clears the per-pipe and per-route latency histograms
+ *
+ * Takes the SB shared data lock, so it must not be invoked while holding it.
+ * Does nothing if #CFE_PLATFORM_SB_LATENCY_STATS is 0.
+ */
+void CFE_SB_ResetLatencyStats(void);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * This function returns a pointer to the app.tsk name string
@@ -563,6 +669,42 @@ uint32 CFE_SB_RequestToSendEvent(CFE_ES_TaskId_t TaskId, int32 Bit);
  */
 void CFE_SB_FinishSendEvent(CFE_ES_TaskId_t TaskId, int32 Bit);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Adds one latency sample to a histogram
+ *
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * @param Hist Histogram to update
+ * @param Usec Latency sample in microseconds
+ */
+void CFE_SB_LatencyRecord(CFE_SB_LatencyHist_t *Hist, uint32 Usec);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Reduces a latency histogram to its count, median, 99th percentile and max
+ *
+ * Percentiles are reported as the upper bound of the bucket they fall in,
+ * limited to the largest sample actually recorded.
+ *
+ * @param Hist    Histogram to summarize
+ * @param Summary Buffer to hold the result
+ */
+void CFE_SB_LatencySummarize(const CFE_SB_LatencyHist_t *Hist, CFE_SB_LatencySummary_t *Summary);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Gets the microseconds between two PSP time stamps
+ *
+ * Negative intervals are reported as 0 and large ones saturate at UINT32_MAX.
+ *
+ * @param Start Earlier time as returned by CFE_PSP_GetTime()
+ * @param Now   Later time as returned by CFE_PSP_GetTime()
+ *
+ * \return Elapsed time in microseconds
+ */
+uint32 CFE_SB_LatencyElapsedUsec(OS_time_t Start, OS_time_t Now);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * This function gets a destination descriptor from the SB memory pool.
@@ -640,6 +782,10 @@ void CFE_SB_TrackingListAdd(CFE_SB_BufferLink_t *List, CFE_SB_BufferLink_t *Node
  * by the SB to dynamically allocate memory to hold the message and a buffer
  * descriptor associated with the message during the sending of a message.
  *
+ * Messages of up to #CFE_PLATFORM_SB_SMALL_BUF_SIZE bytes are given one of the
+ * small buffer slots instead, as long as one is free.  In all cases the buffer
+ * has room for an integrity trailer beyond MaxMsgSize.
+ *
  * @note This must only be invoked while holding the SB global lock
  *
  * \param[in] MaxMsgSize Maximum message content size that the buffer must be capable of holding
@@ -652,7 +798,8 @@ CFE_SB_BufferD_t *CFE_SB_GetBufferFromPool(size_t MaxMsgSize);
  * \brief Returns a buffer to SB memory pool
  *
  * This function will return a block of memory back to the SB memory pool,
- * so it can be re-used for a future message
+ * or a small buffer slot back to the free list, so it can be re-used for a
+ * future message
  *
  * @note This must only be invoked while holding the SB global lock
  * \param[in] bd Pointer to descriptor to return
@@ -828,6 +975,21 @@ static inline CFE_Status_t CFE_SB_MessageTxn_GetStatus(CFE_SB_MessageTxn_State_t
     return TxnPtr->Status;
 }
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Get number of pipes not written by the transaction
+ *
+ * Obtains the number of destination pipes that did not get the message, due to a
+ * message limit, a full queue, or a queue write error.
+ *
+ * \param[in]   TxnPtr     Transaction object
+ * \returns Number of pipe errors
+ */
+static inline uint16 CFE_SB_MessageTxn_GetNumPipeErrs(const CFE_SB_MessageTxn_State_t *TxnPtr)
+{
+    return TxnPtr->NumPipeErrs;
+}
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Set transaction status code and event
@@ -1145,6 +1307,27 @@ void CFE_SB_TransmitTxn_SetupFromMsg(CFE_SB_MessageTxn_State_t *TxnPtr, const CF
  */
 void CFE_SB_TransmitTxn_FindDestinations(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_BufferD_t *BufDscPtr);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Wait for a full destination to take another message
+ *
+ * Helper function for blocking transmit transactions.  A destination that was at its
+ * message limit, or whose pipe was full, when the destinations were collected is marked
+ * as deferred rather than failed.  This polls the destination, with a short delay between
+ * checks, until the receiver has drained a message or the transaction timeout expires.
+ *
+ * Once there is room the buffer is accounted to the destination exactly as
+ * CFE_SB_TransmitTxn_FindDestinations() would have done.  On timeout the message limit or
+ * pipe overflow error is recorded against the pipe, as for a non-blocking transmit.
+ *
+ * \param[inout] TxnPtr     Transaction object
+ * \param[inout] ContextPtr Pointer to the deferred pipe entry within transaction
+ * \param[inout] BufDscPtr  Buffer descriptor that is pending broadcast
+ * \returns true if the buffer should now be written to the pipe, false otherwise
+ */
+bool CFE_SB_TransmitTxn_WaitForRoom(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeSetEntry_t *ContextPtr,
+                                    CFE_SB_BufferD_t *BufDscPtr);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Pipe handler function for transmit transactions
@@ -1153,6 +1336,9 @@ void CFE_SB_TransmitTxn_FindDestinations(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_
  * is only used via CFE_SB_MessageTxn_ProcessPipes(), but declared here so it can be unit
  * tested.
  *
+ * Deferred destinations are skipped, so that one full pipe does not hold up the others;
+ * they are written afterward by CFE_SB_TransmitTxn_DeferredPipeHandler().
+ *
  * \sa CFE_SB_MessageTxn_ProcessPipes
  *
  * \param[inout] TxnPtr     Transaction object
@@ -1162,6 +1348,24 @@ void CFE_SB_TransmitTxn_FindDestinations(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_
  */
 bool CFE_SB_TransmitTxn_PipeHandler(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeSetEntry_t *ContextPtr, void *Arg);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Write a message to a deferred destination during a transmit transaction
+ *
+ * Second pass of a transmit, after CFE_SB_TransmitTxn_PipeHandler() has written the
+ * message to every destination that had room.  Each deferred destination is waited on
+ * with CFE_SB_TransmitTxn_WaitForRoom() and then written as in the first pass.
+ *
+ * \sa CFE_SB_MessageTxn_ProcessPipes
+ *
+ * \param[inout] TxnPtr     Transaction object
+ * \param[in]    ContextPtr Pointer to pipe entry within transaction
+ * \param[inout] Arg        Opaque argument for API, should be a CFE_SB_BufferD_t*
+ * \returns always true to continue the parent loop (transmit transactions process all pipes)
+ */
+bool CFE_SB_TransmitTxn_DeferredPipeHandler(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeSetEntry_t *ContextPtr,
+                                            void *Arg);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Executes the transmit transaction
@@ -1183,6 +1387,21 @@ bool CFE_SB_TransmitTxn_PipeHandler(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_Pi
  */
 void CFE_SB_TransmitTxn_Execute(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_Buffer_t *BufPtr);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Executes the transmit transaction for a message in user memory
+ *
+ * Internal routine that implements CFE_SB_TransmitMsg() and its timed variant.  The message
+ * is copied into a newly allocated SB buffer, which is then broadcast as for
+ * CFE_SB_TransmitTxn_Execute().  Nothing is done if the transaction is not in a good state.
+ *
+ * \param[inout] TxnPtr        Transaction object
+ * \param[in]    MsgPtr        Pointer to message being transmitted
+ * \param[in]    IsOrigination Update applicable header field(s) of a newly constructed message
+ */
+void CFE_SB_TransmitTxn_ExecuteFromMsg(CFE_SB_MessageTxn_State_t *TxnPtr, const CFE_MSG_Message_t *MsgPtr,
+                                       bool IsOrigination);
+
 /*
  * Software Bus Message Handler Function prototypes
  */
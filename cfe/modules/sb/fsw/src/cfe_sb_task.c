@@ -378,6 +378,33 @@ void CFE_SB_ResetCounters(void)
     CFE_SB_Global.HKTlmMsg.Payload.SubscribeErrorCounter         = 0;
     CFE_SB_Global.HKTlmMsg.Payload.PipeOverflowErrorCounter      = 0;
     CFE_SB_Global.HKTlmMsg.Payload.MsgLimitErrorCounter          = 0;
+
+    CFE_SB_ResetLatencyStats();
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_ResetLatencyStats(void)
+{
+#if CFE_PLATFORM_SB_LATENCY_STATS
+    uint32 i;
+
+    CFE_SB_LockSharedData(__FILE__, __LINE__);
+
+    for (i = 0; i < CFE_PLATFORM_SB_MAX_PIPES; ++i)
+    {
+        memset(&CFE_SB_Global.PipeTbl[i].Latency, 0, sizeof(CFE_SB_Global.PipeTbl[i].Latency));
+    }
+
+    memset(CFE_SB_Global.RouteDelivery, 0, sizeof(CFE_SB_Global.RouteDelivery));
+    memset(CFE_SB_Global.RoutePublish, 0, sizeof(CFE_SB_Global.RoutePublish));
+
+    CFE_SB_UnlockSharedData(__FILE__, __LINE__);
+#endif
 }
 
 /*----------------------------------------------------------------
@@ -522,10 +549,13 @@ int32 CFE_SB_DisableRouteCmd(const CFE_SB_DisableRouteCmd_t *data)
  *-----------------------------------------------------------------*/
 int32 CFE_SB_SendStatsCmd(const CFE_SB_SendSbStatsCmd_t *data)
 {
-    uint32                   PipeDscCount;
-    uint32                   PipeStatCount;
-    CFE_SB_PipeD_t *         PipeDscPtr;
-    CFE_SB_PipeDepthStats_t *PipeStatPtr;
+    uint32                     PipeDscCount;
+    uint32                     PipeStatCount;
+    CFE_SB_PipeD_t *           PipeDscPtr;
+    CFE_SB_PipeDepthStats_t *  PipeStatPtr;
+#if CFE_PLATFORM_SB_LATENCY_STATS
+    CFE_SB_PipeLatencyStats_t *PipeLatPtr;
+#endif
 
     CFE_SB_LockSharedData(__FILE__, __LINE__);
 
@@ -534,6 +564,9 @@ int32 CFE_SB_SendStatsCmd(const CFE_SB_SendSbStatsCmd_t *data)
     PipeStatCount = CFE_MISSION_SB_MAX_PIPES;
     PipeDscPtr    = CFE_SB_Global.PipeTbl;
     PipeStatPtr   = CFE_SB_Global.StatTlmMsg.Payload.PipeDepthStats;
+#if CFE_PLATFORM_SB_LATENCY_STATS
+    PipeLatPtr = CFE_SB_Global.LatencyTlmMsg.Payload.PipeLatencyStats;
+#endif
 
     while (PipeDscCount > 0 && PipeStatCount > 0)
     {
@@ -546,6 +579,13 @@ int32 CFE_SB_SendStatsCmd(const CFE_SB_SendSbStatsCmd_t *data)
             PipeStatPtr->PeakQueueDepth    = PipeDscPtr->PeakQueueDepth;
             PipeStatPtr->MaxQueueDepth     = PipeDscPtr->MaxQueueDepth;
 
+#if CFE_PLATFORM_SB_LATENCY_STATS
+            /* Copy latency info */
+            PipeLatPtr->PipeId = PipeDscPtr->PipeId;
+            CFE_SB_LatencySummarize(&PipeDscPtr->Latency, &PipeLatPtr->Latency);
+            ++PipeLatPtr;
+#endif
+
             ++PipeStatPtr;
             --PipeStatCount;
         }
@@ -559,6 +599,10 @@ int32 CFE_SB_SendStatsCmd(const CFE_SB_SendSbStatsCmd_t *data)
     while (PipeStatCount > 0)
     {
         memset(PipeStatPtr, 0, sizeof(*PipeStatPtr));
+#if CFE_PLATFORM_SB_LATENCY_STATS
+        memset(PipeLatPtr, 0, sizeof(*PipeLatPtr));
+        ++PipeLatPtr;
+#endif
 
         ++PipeStatPtr;
         --PipeStatCount;
@@ -567,6 +611,11 @@ int32 CFE_SB_SendStatsCmd(const CFE_SB_SendSbStatsCmd_t *data)
     CFE_SB_TimeStampMsg(CFE_MSG_PTR(CFE_SB_Global.StatTlmMsg.TelemetryHeader));
     CFE_SB_TransmitMsg(CFE_MSG_PTR(CFE_SB_Global.StatTlmMsg.TelemetryHeader), true);
 
+#if CFE_PLATFORM_SB_LATENCY_STATS
+    CFE_SB_TimeStampMsg(CFE_MSG_PTR(CFE_SB_Global.LatencyTlmMsg.TelemetryHeader));
+    CFE_SB_TransmitMsg(CFE_MSG_PTR(CFE_SB_Global.LatencyTlmMsg.TelemetryHeader), true);
+#endif
+
     CFE_EVS_SendEvent(CFE_SB_SND_STATS_EID, CFE_EVS_EventType_DEBUG, "Software Bus Statistics packet sent");
 
     CFE_SB_Global.HKTlmMsg.Payload.CommandCounter++;
@@ -622,6 +671,13 @@ void CFE_SB_CollectRouteInfo(CFE_SBR_RouteId_t RouteId, void *ArgPtr)
                 FileEntryPtr->State  = DestPtr->Active;
                 FileEntryPtr->MsgCnt = DestPtr->DestCnt;
 
+#if CFE_PLATFORM_SB_LATENCY_STATS
+                CFE_SB_LatencySummarize(&CFE_SB_Global.RouteDelivery[CFE_SBR_RouteIdToValue(RouteId)],
+                                        &FileEntryPtr->Delivery);
+                CFE_SB_LatencySummarize(&CFE_SB_Global.RoutePublish[CFE_SBR_RouteIdToValue(RouteId)],
+                                        &FileEntryPtr->Publish);
+#endif
+
                 /* Stash the Pipe Owner AppId - App Name is looked up later (comes from ES) */
                 DestAppId[RouteBufferPtr->NumDestinations] = PipeDscPtr->AppId;
 
@@ -868,10 +924,15 @@ bool CFE_SB_WritePipeInfoDataGetter(void *Meta, uint32 RecordNum, void **Buffer,
             PipeBufferPtr->Opts   = PipeDscPtr->Opts;
 
             /* copy stats info */
-            PipeBufferPtr->SendErrors        = PipeDscPtr->SendErrors;
-            PipeBufferPtr->MaxQueueDepth     = PipeDscPtr->MaxQueueDepth;
-            PipeBufferPtr->CurrentQueueDepth = PipeDscPtr->CurrentQueueDepth;
-            PipeBufferPtr->PeakQueueDepth    = PipeDscPtr->PeakQueueDepth;
+            PipeBufferPtr->SendErrors            = PipeDscPtr->SendErrors;
+            PipeBufferPtr->MaxQueueDepth         = PipeDscPtr->MaxQueueDepth;
+            PipeBufferPtr->CurrentQueueDepth     = PipeDscPtr->CurrentQueueDepth;
+            PipeBufferPtr->PeakQueueDepth        = PipeDscPtr->PeakQueueDepth;
+            PipeBufferPtr->PriorityLaneDepth     = PipeDscPtr->PriorityLaneDepth;
+            PipeBufferPtr->PeakPriorityLaneDepth = PipeDscPtr->PeakPriorityLaneDepth;
+#if CFE_PLATFORM_SB_LATENCY_STATS
+            CFE_SB_LatencySummarize(&PipeDscPtr->Latency, &PipeBufferPtr->Latency);
+#endif
 
             SysQueueId = PipeDscPtr->SysQueueId;
         }
@@ -48,6 +48,18 @@
 #error CFE_PLATFORM_SB_MAX_DEST_PER_PKT cannot be less than 1!
 #endif
 
+#if CFE_PLATFORM_SB_PIPE_PRIORITY_LANE_DEPTH < 1
+#error CFE_PLATFORM_SB_PIPE_PRIORITY_LANE_DEPTH cannot be less than 1!
+#endif
+
+#if CFE_PLATFORM_SB_PIPE_PRIORITY_LANE_DEPTH > 255
+#error CFE_PLATFORM_SB_PIPE_PRIORITY_LANE_DEPTH cannot be greater than 255!
+#endif
+
+#if (CFE_PLATFORM_SB_LATENCY_STATS != 0) && (CFE_PLATFORM_SB_LATENCY_STATS != 1)
+#error CFE_PLATFORM_SB_LATENCY_STATS must be 0 or 1!
+#endif
+
 #if CFE_PLATFORM_SB_HIGHEST_VALID_MSGID < 1
 #error CFE_PLATFORM_SB_HIGHEST_VALID_MSGID cannot be less than 1!
 #endif
@@ -64,6 +76,16 @@
 #error CFE_PLATFORM_SB_BUF_MEMORY_BYTES cannot be greater than UINT32_MAX (4 Gigabytes)!
 #endif
 
+#if CFE_PLATFORM_SB_SMALL_BUF_SIZE < 8
+#error CFE_PLATFORM_SB_SMALL_BUF_SIZE cannot be less than 8 bytes!
+#elif CFE_PLATFORM_SB_SMALL_BUF_SIZE > CFE_MISSION_SB_MAX_SB_MSG_SIZE
+#error CFE_PLATFORM_SB_SMALL_BUF_SIZE cannot be greater than CFE_MISSION_SB_MAX_SB_MSG_SIZE!
+#endif
+
+#if CFE_PLATFORM_SB_SMALL_BUF_COUNT < 1
+#error CFE_PLATFORM_SB_SMALL_BUF_COUNT cannot be less than 1!
+#endif
+
 /*
  * Legacy time formats no longer supported in core cFE, this will pass
  * if default is selected or if both defines are removed
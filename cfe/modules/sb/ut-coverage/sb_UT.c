@@ -559,8 +559,12 @@ void Test_SB_Cmds_Stats(void)
         CFE_SB_Buffer_t         SBBuf;
         CFE_SB_SendSbStatsCmd_t Cmd;
     } SendSbStats;
-    CFE_SB_MsgId_t  MsgId;
-    CFE_MSG_Size_t  Size;
+    CFE_SB_MsgId_t             MsgId[2];
+    CFE_MSG_Size_t             Size[2];
+#if CFE_PLATFORM_SB_LATENCY_STATS
+    CFE_SB_PipeLatencyStats_t *LatPtr;
+    uint32                     i;
+#endif
     CFE_SB_PipeId_t PipeId1 = CFE_SB_INVALID_PIPE;
     CFE_SB_PipeId_t PipeId2 = CFE_SB_INVALID_PIPE;
     CFE_SB_PipeId_t PipeId3 = CFE_SB_INVALID_PIPE;
@@ -575,16 +579,42 @@ void Test_SB_Cmds_Stats(void)
     /* Generic command processing - The dispatch must be set up FIRST */
     UT_SetupBasicMsgDispatch(&UT_TPID_CFE_SB_CMD_SEND_SB_STATS_CC, sizeof(SendSbStats.Cmd), false);
 
-    /* For internal TransmitMsg call */
-    MsgId = CFE_SB_ValueToMsgId(CFE_SB_STATS_TLM_MID);
-    Size  = sizeof(CFE_SB_Global.StatTlmMsg);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    /* For internal TransmitMsg calls, stats packet then latency packet */
+    MsgId[0] = CFE_SB_ValueToMsgId(CFE_SB_STATS_TLM_MID);
+    Size[0]  = sizeof(CFE_SB_Global.StatTlmMsg);
+#if CFE_PLATFORM_SB_LATENCY_STATS
+    MsgId[1] = CFE_SB_ValueToMsgId(CFE_SB_LATENCY_TLM_MID);
+    Size[1]  = sizeof(CFE_SB_Global.LatencyTlmMsg);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), Size, sizeof(Size), false);
+
+    /* Give one pipe a latency history to report */
+    CFE_SB_LatencyRecord(&CFE_SB_LocatePipeDescByID(PipeId2)->Latency, 100);
+#else
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), MsgId, sizeof(MsgId[0]), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), Size, sizeof(Size[0]), false);
+#endif
 
     CFE_SB_ProcessCmdPipePkt(&SendSbStats.SBBuf);
 
-    /* No subs event and command processing event */
-    CFE_UtAssert_EVENTCOUNT(5);
+    /* Pipe creation events, a no subs event per packet sent and command processing event */
+    CFE_UtAssert_EVENTCOUNT(5 + CFE_PLATFORM_SB_LATENCY_STATS);
+
+#if CFE_PLATFORM_SB_LATENCY_STATS
+    for (i = 0; i < CFE_MISSION_SB_MAX_PIPES; ++i)
+    {
+        LatPtr = &CFE_SB_Global.LatencyTlmMsg.Payload.PipeLatencyStats[i];
+        if (CFE_RESOURCEID_TEST_EQUAL(LatPtr->PipeId, PipeId2))
+        {
+            UtAssert_UINT32_EQ(LatPtr->Latency.Count, 1);
+            UtAssert_UINT32_EQ(LatPtr->Latency.MaxUsec, 100);
+        }
+        else
+        {
+            UtAssert_UINT32_EQ(LatPtr->Latency.Count, 0);
+        }
+    }
+#endif
 
     CFE_UtAssert_EVENTSENT(CFE_SB_SND_STATS_EID);
 
@@ -3486,6 +3516,10 @@ void Test_TransmitMsg_API(void)
     SB_UT_ADD_SUBTEST(Test_TransmitBuffer_NoIncrement);
     SB_UT_ADD_SUBTEST(Test_TransmitMsg_ZeroCopyBufferValidate);
     SB_UT_ADD_SUBTEST(Test_TransmitMsg_DisabledDestination);
+    SB_UT_ADD_SUBTEST(Test_TransmitMsg_LatestValue);
+    SB_UT_ADD_SUBTEST(Test_TransmitMsgWithTimeout);
+    SB_UT_ADD_SUBTEST(Test_TransmitMsgWithTimeout_FullFirst);
+    SB_UT_ADD_SUBTEST(Test_GetRouteCongestion);
 
     SB_UT_ADD_SUBTEST(Test_MessageTxn_SetEventAndStatus);
     SB_UT_ADD_SUBTEST(Test_MessageTxn_SetupFromMsg);
@@ -3500,9 +3534,395 @@ void Test_TransmitMsg_API(void)
     SB_UT_ADD_SUBTEST(Test_TransmitTxn_Execute);
 
     SB_UT_ADD_SUBTEST(Test_AllocateMessageBuffer);
+    SB_UT_ADD_SUBTEST(Test_AllocateMessageBuffer_SmallBuf);
     SB_UT_ADD_SUBTEST(Test_ReleaseMessageBuffer);
 }
 
+/*
+** Test send and receive on a latest-value (conflating) pipe
+*/
+void Test_TransmitMsg_LatestValue(void)
+{
+    CFE_SB_PipeId_t            PipeId = CFE_SB_INVALID_PIPE;
+    CFE_SB_MsgId_t             MsgId  = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t           TlmPkt;
+    CFE_SB_Buffer_t *          SBBufPtr;
+    CFE_SB_PipeD_t *           PipeDscPtr;
+    CFE_SB_DestinationD_t *    DestPtr;
+    CFE_SB_BufferD_t           SBBufD;
+    CFE_SB_TransmitTxn_State_t TxnBuf;
+    CFE_SB_MessageTxn_State_t *Txn;
+    CFE_MSG_Size_t             Size = sizeof(TlmPkt);
+    CFE_MSG_Type_t             Type = CFE_MSG_Type_Tlm;
+    uint32                     i;
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 10, "LatestValuePipe"));
+    CFE_UtAssert_SETUP(CFE_SB_SetPipeOpts(PipeId, CFE_SB_PIPEOPTS_LATEST_VALUE));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    DestPtr    = CFE_SB_GetDestPtr(CFE_SBR_GetRouteId(MsgId), PipeId);
+
+    /* Only the first of several publishes is queued, later ones replace it */
+    for (i = 1; i <= 3; ++i)
+    {
+        TlmPkt.Tlm32Param1 = i;
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+        CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    }
+
+    UtAssert_STUB_COUNT(OS_QueuePut, 1);
+    UtAssert_UINT32_EQ(PipeDscPtr->CurrentQueueDepth, 1);
+    UtAssert_UINT32_EQ(DestPtr->BuffCount, 1);
+    UtAssert_NOT_NULL(DestPtr->LatestBuffer);
+    CFE_UtAssert_EVENTNOTSENT(CFE_SB_MSGID_LIM_ERR_EID);
+
+    /* The reader gets the newest sample */
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL));
+    UtAssert_UINT32_EQ(((SB_UT_Test_Tlm_t *)SBBufPtr)->Tlm32Param1, 3);
+    UtAssert_NULL(DestPtr->LatestBuffer);
+    UtAssert_UINT32_EQ(DestPtr->BuffCount, 0);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+
+    /* Queue and replace again, then unsubscribe, which releases the newer buffer */
+    for (i = 1; i <= 2; ++i)
+    {
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+        CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    }
+
+    UtAssert_NOT_NULL(DestPtr->LatestBuffer);
+    CFE_UtAssert_SUCCESS(CFE_SB_Unsubscribe(MsgId, PipeId));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    DestPtr = CFE_SB_GetDestPtr(CFE_SBR_GetRouteId(MsgId), PipeId);
+    UtAssert_NULL(DestPtr->LatestBuffer);
+
+    /* A failed queue write leaves nothing for a newer buffer to replace, so it is released */
+    memset(&SBBufD, 0, sizeof(SBBufD));
+    memset(&TxnBuf, 0, sizeof(TxnBuf));
+    CFE_SB_TrackingListReset(&SBBufD.Link);
+    Txn                    = CFE_SB_TransmitTxn_Init(&TxnBuf, &SBBufD.Content);
+    SBBufD.DestRouteId     = CFE_SBR_GetRouteId(MsgId);
+    Txn->NumPipes          = 1;
+    Txn->PipeSet[0].PipeId = PipeId;
+    DestPtr->BuffCount     = 1;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    UtAssert_NOT_NULL(DestPtr->LatestBuffer);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_QueuePut), 1, OS_QUEUE_FULL);
+    UtAssert_VOIDCALL(CFE_SB_MessageTxn_ProcessPipes(CFE_SB_TransmitTxn_PipeHandler, Txn, &SBBufD));
+    UtAssert_UINT32_EQ(DestPtr->BuffCount, 0);
+    UtAssert_NULL(DestPtr->LatestBuffer);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+}
+
+/*
+** Stands in for a receiver reading one message while the publisher waits
+*/
+static int32 UT_TransmitWaitDrainHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                      const UT_StubContext_t *Context)
+{
+    CFE_SB_DestinationD_t *DestPtr = UserObj;
+
+    --DestPtr->BuffCount;
+
+    return StubRetcode;
+}
+
+/*
+** Moves the clock past the transmit timeout while the publisher waits
+*/
+static int32 UT_TransmitWaitExpireHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                       const UT_StubContext_t *Context)
+{
+    UT_SetDataBuffer(UT_KEY(CFE_PSP_GetTime), UserObj, sizeof(OS_time_t), false);
+
+    return StubRetcode;
+}
+
+/*
+** Stands in for an unsubscribe while the publisher waits
+*/
+static int32 UT_TransmitWaitDisableHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                        const UT_StubContext_t *Context)
+{
+    CFE_SB_DestinationD_t *DestPtr = UserObj;
+
+    DestPtr->Active = CFE_SB_INACTIVE;
+
+    return StubRetcode;
+}
+
+/*
+** Records how many queue writes were made before the publisher first waits,
+** then stands in for the receiver reading one message
+*/
+static int32 UT_TransmitWaitOrderHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                      const UT_StubContext_t *Context)
+{
+    UT_TransmitWaitOrder_t *StatePtr = UserObj;
+
+    if (!StatePtr->HasWaited)
+    {
+        StatePtr->PutsBeforeWait = UT_GetStubCount(UT_KEY(OS_QueuePut));
+        StatePtr->HasWaited      = true;
+    }
+
+    --StatePtr->DestPtr->BuffCount;
+
+    return StubRetcode;
+}
+
+/*
+** Test transmit with timeout to subscribers that are at their limits
+*/
+void Test_TransmitMsgWithTimeout(void)
+{
+    CFE_SB_PipeId_t        PipeId = CFE_SB_INVALID_PIPE;
+    CFE_SB_MsgId_t         MsgId  = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t       TlmPkt;
+    CFE_SB_PipeD_t *       PipeDscPtr;
+    CFE_SB_DestinationD_t *DestPtr;
+    CFE_ES_AppId_t         RealOwner;
+    OS_time_t              LaterTime;
+    CFE_MSG_Size_t         Size = sizeof(TlmPkt);
+    CFE_MSG_Type_t         Type = CFE_MSG_Type_Tlm;
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+
+    /* Invalid timeout is reported as a send error */
+    UtAssert_INT32_EQ(CFE_SB_TransmitMsgWithTimeout(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true, -5),
+                      CFE_SB_BAD_ARGUMENT);
+    CFE_UtAssert_EVENTSENT(CFE_SB_SEND_BAD_ARG_EID);
+    UtAssert_INT32_EQ(CFE_SB_TransmitMsgWithTimeout(NULL, true, CFE_SB_POLL), CFE_SB_BAD_ARGUMENT);
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 2, "TimedTxPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_SubscribeEx(MsgId, PipeId, CFE_SB_DEFAULT_QOS, 1));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    DestPtr    = CFE_SB_GetDestPtr(CFE_SBR_GetRouteId(MsgId), PipeId);
+
+    /* Pipe is read by another app */
+    RealOwner         = PipeDscPtr->AppId;
+    PipeDscPtr->AppId = UT_SB_AppID_Modify(RealOwner, 1);
+
+    /* Room available, delivered without waiting */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsgWithTimeout(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true, 100));
+    UtAssert_UINT32_EQ(DestPtr->BuffCount, 1);
+
+    /* At the message limit, polling reports the drop to the caller */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    UtAssert_INT32_EQ(CFE_SB_TransmitMsgWithTimeout(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true, CFE_SB_POLL),
+                      CFE_SB_TIME_OUT);
+    CFE_UtAssert_EVENTSENT(CFE_SB_MSGID_LIM_ERR_EID);
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgLimitErrorCounter, 1);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 0);
+
+    /* The receiver reads a message while the publisher waits */
+    UT_SetHookFunction(UT_KEY(OS_TaskDelay), UT_TransmitWaitDrainHook, DestPtr);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    CFE_UtAssert_SUCCESS(
+        CFE_SB_TransmitMsgWithTimeout(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true, CFE_SB_PEND_FOREVER));
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+    UtAssert_UINT32_EQ(DestPtr->BuffCount, 1);
+    UtAssert_UINT32_EQ(PipeDscPtr->CurrentQueueDepth, 2);
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgLimitErrorCounter, 1);
+
+    /* Nobody reads before the timeout */
+    UT_ResetState(UT_KEY(OS_TaskDelay));
+    LaterTime = OS_TimeAdd(OS_TimeAssembleFromNanoseconds(100, 200000), OS_TimeFromTotalSeconds(1));
+    UT_SetHookFunction(UT_KEY(OS_TaskDelay), UT_TransmitWaitExpireHook, &LaterTime);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    UtAssert_INT32_EQ(CFE_SB_TransmitMsgWithTimeout(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true, 100),
+                      CFE_SB_TIME_OUT);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgLimitErrorCounter, 2);
+
+    /* Same when the pipe itself is full rather than the message limit */
+    DestPtr->MsgId2PipeLim = 4;
+    UT_ResetState(UT_KEY(OS_TaskDelay));
+    UT_SetHookFunction(UT_KEY(OS_TaskDelay), UT_TransmitWaitExpireHook, &LaterTime);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    UtAssert_INT32_EQ(CFE_SB_TransmitMsgWithTimeout(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true, 100),
+                      CFE_SB_TIME_OUT);
+    CFE_UtAssert_EVENTSENT(CFE_SB_Q_FULL_ERR_EID);
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.PipeOverflowErrorCounter, 1);
+
+    /* The destination goes away while the publisher waits, which is not an error */
+    DestPtr->MsgId2PipeLim = 1;
+    UT_ResetState(UT_KEY(OS_TaskDelay));
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    UT_SetHookFunction(UT_KEY(OS_TaskDelay), UT_TransmitWaitDisableHook, DestPtr);
+    CFE_UtAssert_SUCCESS(
+        CFE_SB_TransmitMsgWithTimeout(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true, CFE_SB_PEND_FOREVER));
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+    UtAssert_UINT32_EQ(DestPtr->BuffCount, 1);
+
+    /* A full pipe of the sending app can never drain while it waits, so it is not waited on */
+    PipeDscPtr->AppId = RealOwner;
+    DestPtr->Active   = CFE_SB_ACTIVE;
+    UT_ResetState(UT_KEY(OS_TaskDelay));
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    UtAssert_INT32_EQ(
+        CFE_SB_TransmitMsgWithTimeout(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true, CFE_SB_PEND_FOREVER),
+        CFE_SB_TIME_OUT);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 0);
+    CFE_UtAssert_EVENTSENT(CFE_SB_MSGID_LIM_ERR_EID);
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgLimitErrorCounter, 3);
+    UtAssert_UINT32_EQ(DestPtr->BuffCount, 1);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+}
+
+/*
+** Test that a full subscriber does not hold up the others during a timed transmit
+*/
+void Test_TransmitMsgWithTimeout_FullFirst(void)
+{
+    CFE_SB_PipeId_t        PipeId1 = CFE_SB_INVALID_PIPE;
+    CFE_SB_PipeId_t        PipeId2 = CFE_SB_INVALID_PIPE;
+    CFE_SB_MsgId_t         MsgId   = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t       TlmPkt;
+    CFE_SB_DestinationD_t *DestPtr1;
+    CFE_SB_PipeD_t *       PipeDscPtr2;
+    CFE_ES_AppId_t         RealOwner;
+    UT_TransmitWaitOrder_t WaitState;
+    CFE_MSG_Size_t         Size = sizeof(TlmPkt);
+    CFE_MSG_Type_t         Type = CFE_MSG_Type_Tlm;
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+    memset(&WaitState, 0, sizeof(WaitState));
+
+    /* New subscriptions go to the head of the route, so the second one is served first and is full */
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId1, 2, "FullFirstPipe1"));
+    CFE_UtAssert_SETUP(CFE_SB_SubscribeEx(MsgId, PipeId1, CFE_SB_DEFAULT_QOS, 1));
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId2, 2, "FullFirstPipe2"));
+    CFE_UtAssert_SETUP(CFE_SB_SubscribeEx(MsgId, PipeId2, CFE_SB_DEFAULT_QOS, 1));
+    DestPtr1          = CFE_SB_GetDestPtr(CFE_SBR_GetRouteId(MsgId), PipeId1);
+    WaitState.DestPtr = CFE_SB_GetDestPtr(CFE_SBR_GetRouteId(MsgId), PipeId2);
+    UtAssert_ADDRESS_EQ(CFE_SBR_GetDestListHeadPtr(CFE_SBR_GetRouteId(MsgId)), WaitState.DestPtr);
+    WaitState.DestPtr->BuffCount = 1;
+    PipeDscPtr2                  = CFE_SB_LocatePipeDescByID(PipeId2);
+    RealOwner                    = PipeDscPtr2->AppId;
+    PipeDscPtr2->AppId           = UT_SB_AppID_Modify(RealOwner, 1);
+
+    /* The second subscriber gets the message before the publisher waits on the first */
+    UT_SetHookFunction(UT_KEY(OS_TaskDelay), UT_TransmitWaitOrderHook, &WaitState);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    CFE_UtAssert_SUCCESS(
+        CFE_SB_TransmitMsgWithTimeout(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true, CFE_SB_PEND_FOREVER));
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+    UtAssert_UINT32_EQ(WaitState.PutsBeforeWait, 1);
+    UtAssert_STUB_COUNT(OS_QueuePut, 2);
+    UtAssert_UINT32_EQ(WaitState.DestPtr->BuffCount, 1);
+    UtAssert_UINT32_EQ(DestPtr1->BuffCount, 1);
+
+    PipeDscPtr2->AppId = RealOwner;
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId1));
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId2));
+}
+
+/*
+** Test getting the congestion level of a route
+*/
+void Test_GetRouteCongestion(void)
+{
+    CFE_SB_PipeId_t        PipeId1 = CFE_SB_INVALID_PIPE;
+    CFE_SB_PipeId_t        PipeId2 = CFE_SB_INVALID_PIPE;
+    CFE_SB_MsgId_t         MsgId   = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t       TlmPkt;
+    CFE_SB_PipeD_t *       PipeDscPtr;
+    CFE_SB_DestinationD_t *DestPtr;
+    CFE_MSG_Size_t         Size = sizeof(TlmPkt);
+    CFE_MSG_Type_t         Type = CFE_MSG_Type_Tlm;
+    uint8                  Fill;
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+
+    UtAssert_INT32_EQ(CFE_SB_GetRouteCongestion(MsgId, NULL), CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_GetRouteCongestion(CFE_SB_INVALID_MSG_ID, &Fill), CFE_SB_BAD_ARGUMENT);
+
+    /* No subscribers */
+    Fill = 50;
+    CFE_UtAssert_SUCCESS(CFE_SB_GetRouteCongestion(MsgId, &Fill));
+    UtAssert_UINT32_EQ(Fill, 0);
+
+    /* The deeper pipe is limited by its message limit, the other by its depth */
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId1, 10, "CongestPipe1"));
+    CFE_UtAssert_SETUP(CFE_SB_SubscribeEx(MsgId, PipeId1, CFE_SB_DEFAULT_QOS, 4));
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId2, 2, "CongestPipe2"));
+    CFE_UtAssert_SETUP(CFE_SB_SubscribeEx(MsgId, PipeId2, CFE_SB_DEFAULT_QOS, 8));
+
+    CFE_UtAssert_SUCCESS(CFE_SB_GetRouteCongestion(MsgId, &Fill));
+    UtAssert_UINT32_EQ(Fill, 0);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+
+    CFE_UtAssert_SUCCESS(CFE_SB_GetRouteCongestion(MsgId, &Fill));
+    UtAssert_UINT32_EQ(Fill, 50);
+
+    /* Inactive destinations are not counted */
+    DestPtr         = CFE_SB_GetDestPtr(CFE_SBR_GetRouteId(MsgId), PipeId2);
+    DestPtr->Active = CFE_SB_INACTIVE;
+    CFE_UtAssert_SUCCESS(CFE_SB_GetRouteCongestion(MsgId, &Fill));
+    UtAssert_UINT32_EQ(Fill, 25);
+    DestPtr->Active = CFE_SB_ACTIVE;
+
+    /* Full, and never reported above 100 */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    CFE_UtAssert_SUCCESS(CFE_SB_GetRouteCongestion(MsgId, &Fill));
+    UtAssert_UINT32_EQ(Fill, 100);
+
+    DestPtr->BuffCount = 20;
+    CFE_UtAssert_SUCCESS(CFE_SB_GetRouteCongestion(MsgId, &Fill));
+    UtAssert_UINT32_EQ(Fill, 100);
+    DestPtr->BuffCount = 2;
+
+    /* Zero limits are skipped rather than divided by */
+    PipeDscPtr                = CFE_SB_LocatePipeDescByID(PipeId2);
+    DestPtr->MsgId2PipeLim    = 0;
+    PipeDscPtr->MaxQueueDepth = 0;
+    CFE_UtAssert_SUCCESS(CFE_SB_GetRouteCongestion(MsgId, &Fill));
+    UtAssert_UINT32_EQ(Fill, 50);
+    PipeDscPtr->MaxQueueDepth = 2;
+    DestPtr->MsgId2PipeLim    = 8;
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId1));
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId2));
+}
+
 /*
 ** Test response to sending a null message on the software bus
 */
@@ -3815,6 +4235,9 @@ void Test_TransmitMsg_GetPoolBufErr(void)
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
 
+    /* No small buffer slots left, so the message comes from the pool */
+    CFE_SB_TrackingListReset(&CFE_SB_Global.SmallBufFreeList);
+
     /* Have GetPoolBuf stub return error on its next call (buf descriptor
      * allocation failed)
      */
@@ -3853,6 +4276,9 @@ void Test_AllocateMessageBuffer(void)
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppID), 1, CFE_ES_ERR_RESOURCEID_NOT_VALID);
     UtAssert_NULL(CFE_SB_AllocateMessageBuffer(MsgSize));
 
+    /* No small buffer slots left, so the message comes from the pool */
+    CFE_SB_TrackingListReset(&CFE_SB_Global.SmallBufFreeList);
+
     /* Have GetPoolBuf stub return error on its next call (buf descriptor
      * allocation failed)
      */
@@ -3866,7 +4292,7 @@ void Test_AllocateMessageBuffer(void)
      */
 
     /* predict memory use for a given descriptor (this needs to match what impl does) */
-    MemUse                                              = MsgSize + offsetof(CFE_SB_BufferD_t, Content);
+    MemUse = MsgSize + CFE_MSG_INTEGRITY_MAX_TRAILER_SIZE + offsetof(CFE_SB_BufferD_t, Content);
     CFE_SB_Global.StatTlmMsg.Payload.MemInUse           = 0;
     CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse       = MemUse + 10;
     CFE_SB_Global.StatTlmMsg.Payload.PeakSBBuffersInUse = CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse + 2;
@@ -3881,6 +4307,68 @@ void Test_AllocateMessageBuffer(void)
     CFE_UtAssert_EVENTCOUNT(0);
 }
 
+/*
+** Test small messages using the small buffer slots rather than the pool
+*/
+void Test_AllocateMessageBuffer_SmallBuf(void)
+{
+    CFE_SB_Buffer_t *BufPtr;
+    CFE_SB_Buffer_t *SlotPtr[CFE_PLATFORM_SB_SMALL_BUF_COUNT];
+    uint32           i;
+
+    /* Largest small message is given a slot, with room for an integrity trailer */
+    UtAssert_NOT_NULL(BufPtr = CFE_SB_AllocateMessageBuffer(CFE_PLATFORM_SB_SMALL_BUF_SIZE));
+    UtAssert_STUB_COUNT(CFE_ES_GetPoolBuf, 0);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SmallBufHits, 1);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 1);
+    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.MemInUse);
+    UtAssert_BOOL_TRUE(CFE_SB_Global.SmallBufs[0].Desc.AllocatedSize - offsetof(CFE_SB_BufferD_t, Content) >=
+                       CFE_PLATFORM_SB_SMALL_BUF_SIZE + CFE_MSG_INTEGRITY_MAX_TRAILER_SIZE);
+
+    /* Every slot starts on its own line */
+    UtAssert_ZERO(CFE_SB_SMALL_BUF_SLOT_SIZE % CFE_SB_SMALL_BUF_LINE_SIZE);
+#if defined(__GNUC__)
+    UtAssert_ZERO((cpuaddr)&CFE_SB_Global.SmallBufs[0] % CFE_SB_SMALL_BUF_LINE_SIZE);
+#endif
+
+    /* Release puts it back on the free list, and it is the next one handed out */
+    CFE_UtAssert_SUCCESS(CFE_SB_ReleaseMessageBuffer(BufPtr));
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 0);
+    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse);
+    UtAssert_ADDRESS_EQ(CFE_SB_AllocateMessageBuffer(1), BufPtr);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReleaseMessageBuffer(BufPtr));
+
+    /* Anything larger comes from the pool */
+    UtAssert_NOT_NULL(BufPtr = CFE_SB_AllocateMessageBuffer(CFE_PLATFORM_SB_SMALL_BUF_SIZE + 1));
+    UtAssert_STUB_COUNT(CFE_ES_GetPoolBuf, 1);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SmallBufHits, 2);
+    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.SmallBufMisses);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReleaseMessageBuffer(BufPtr));
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 1);
+
+    /* Once every slot is in use, small messages fall back to the pool */
+    for (i = 0; i < CFE_PLATFORM_SB_SMALL_BUF_COUNT; ++i)
+    {
+        SlotPtr[i] = CFE_SB_AllocateMessageBuffer(1);
+    }
+    UtAssert_STUB_COUNT(CFE_ES_GetPoolBuf, 1);
+    UtAssert_NOT_NULL(BufPtr = CFE_SB_AllocateMessageBuffer(1));
+    UtAssert_STUB_COUNT(CFE_ES_GetPoolBuf, 2);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SmallBufHits, 2 + CFE_PLATFORM_SB_SMALL_BUF_COUNT);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SmallBufMisses, 1);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, CFE_PLATFORM_SB_SMALL_BUF_COUNT + 1);
+
+    CFE_UtAssert_SUCCESS(CFE_SB_ReleaseMessageBuffer(BufPtr));
+    for (i = 0; i < CFE_PLATFORM_SB_SMALL_BUF_COUNT; ++i)
+    {
+        CFE_UtAssert_SUCCESS(CFE_SB_ReleaseMessageBuffer(SlotPtr[i]));
+    }
+    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 2);
+
+    CFE_UtAssert_EVENTCOUNT(0);
+}
+
 void Test_TransmitMsg_ZeroCopyBufferValidate(void)
 {
     CFE_SB_Buffer_t * SendPtr;
@@ -4116,6 +4604,8 @@ void Test_ReceiveBuffer_API(void)
     SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_PipeReadError);
     SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_PendForever);
     SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_InvalidBufferPtr);
+    SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_PriorityLane);
+    SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_PriorityInterleave);
 }
 
 static void SB_UT_PipeIdModifyHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
@@ -4341,6 +4831,169 @@ void Test_ReceiveBuffer_PendForever(void)
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
 }
 
+/*
+** Test that messages from high priority subscriptions are received first
+*/
+void Test_ReceiveBuffer_PriorityLane(void)
+{
+    CFE_SB_Buffer_t *SBBufPtr;
+    CFE_SB_MsgId_t   TlmMsgId = SB_UT_TLM_MID;
+    CFE_SB_MsgId_t   CmdMsgId = SB_UT_CMD_MID;
+    CFE_SB_PipeId_t  PipeId   = CFE_SB_INVALID_PIPE;
+    CFE_SB_Qos_t     Qos      = CFE_SB_DEFAULT_QOS;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
+    CFE_MSG_Size_t   Size = sizeof(TlmPkt);
+    CFE_SB_PipeD_t * PipeDscPtr;
+    uint32           i;
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+    Qos.Priority = CFE_SB_QosPriority_HIGH;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 10, "PriorityPipe"));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(TlmMsgId, PipeId));
+    CFE_UtAssert_SETUP(CFE_SB_SubscribeEx(CmdMsgId, PipeId, Qos, 4));
+
+    /* Two regular messages followed by a high priority one */
+    for (i = 1; i <= 3; ++i)
+    {
+        TlmPkt.Tlm32Param1 = i;
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), (i == 3) ? &CmdMsgId : &TlmMsgId, sizeof(CFE_SB_MsgId_t), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+        CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    }
+
+    UtAssert_UINT32_EQ(PipeDscPtr->PriorityLaneDepth, 1);
+    UtAssert_UINT32_EQ(PipeDscPtr->PeakPriorityLaneDepth, 1);
+    UtAssert_BOOL_TRUE(PipeDscPtr->PriorityWakeupQueued);
+    UtAssert_UINT32_EQ(PipeDscPtr->CurrentQueueDepth, 4);
+
+    /* The high priority message overtakes the queued ones, then FIFO order resumes */
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL));
+    UtAssert_UINT32_EQ(((SB_UT_Test_Tlm_t *)SBBufPtr)->Tlm32Param1, 3);
+    UtAssert_UINT32_EQ(PipeDscPtr->PriorityLaneDepth, 0);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL));
+    UtAssert_UINT32_EQ(((SB_UT_Test_Tlm_t *)SBBufPtr)->Tlm32Param1, 1);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL));
+    UtAssert_UINT32_EQ(((SB_UT_Test_Tlm_t *)SBBufPtr)->Tlm32Param1, 2);
+
+    /* The wakeup entry of the message already read was skipped on the way */
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+    UtAssert_BOOL_FALSE(PipeDscPtr->PriorityWakeupQueued);
+    UtAssert_UINT32_EQ(PipeDscPtr->CurrentQueueDepth, 0);
+
+    /* A full priority lane is reported like a full pipe */
+    PipeDscPtr->PriorityLaneDepth = CFE_PLATFORM_SB_PIPE_PRIORITY_LANE_DEPTH;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &CmdMsgId, sizeof(CmdMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    CFE_UtAssert_EVENTSENT(CFE_SB_Q_FULL_ERR_EID);
+    PipeDscPtr->PriorityLaneDepth = 0;
+
+    /* A failed wakeup write is not an error, the message stays in the lane */
+    UT_ClearEventHistory();
+    UT_SetDeferredRetcode(UT_KEY(OS_QueuePut), 1, OS_QUEUE_FULL);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &CmdMsgId, sizeof(CmdMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    CFE_UtAssert_EVENTNOTSENT(CFE_SB_Q_FULL_ERR_EID);
+    UtAssert_UINT32_EQ(PipeDscPtr->PriorityLaneDepth, 1);
+    UtAssert_BOOL_FALSE(PipeDscPtr->PriorityWakeupQueued);
+    UtAssert_UINT32_EQ(PipeDscPtr->CurrentQueueDepth, 1);
+
+    /* Deleting the pipe releases messages left in the lane */
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+    UtAssert_UINT32_EQ(PipeDscPtr->PriorityLaneDepth, 0);
+}
+
+/*
+** Test priority and regular messages interleaved up to the pipe depth
+*/
+void Test_ReceiveBuffer_PriorityInterleave(void)
+{
+    CFE_SB_Buffer_t *SBBufPtr;
+    CFE_SB_MsgId_t   TlmMsgId = SB_UT_TLM_MID;
+    CFE_SB_MsgId_t   CmdMsgId = SB_UT_CMD_MID;
+    CFE_SB_PipeId_t  PipeId   = CFE_SB_INVALID_PIPE;
+    CFE_SB_Qos_t     Qos      = CFE_SB_DEFAULT_QOS;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
+    CFE_MSG_Size_t   Size = sizeof(TlmPkt);
+    CFE_SB_PipeD_t * PipeDscPtr;
+    uint32           i;
+    uint32           Round;
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+    Qos.Priority = CFE_SB_QosPriority_HIGH;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 4, "InterleavePipe"));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    CFE_UtAssert_SETUP(CFE_SB_SubscribeEx(TlmMsgId, PipeId, CFE_SB_DEFAULT_QOS, 8));
+    CFE_UtAssert_SETUP(CFE_SB_SubscribeEx(CmdMsgId, PipeId, Qos, 8));
+
+    for (Round = 1; Round <= 3; ++Round)
+    {
+        UT_ResetState(UT_KEY(OS_QueuePut));
+        UT_ClearEventHistory();
+
+        /* A burst of priority messages read straight from the lane leaves one wakeup queued */
+        for (i = 1; i <= 3; ++i)
+        {
+            TlmPkt.Tlm32Param1 = i;
+            UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &CmdMsgId, sizeof(CmdMsgId), false);
+            UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+            UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+            CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+        }
+
+        UtAssert_STUB_COUNT(OS_QueuePut, 1);
+        for (i = 1; i <= 3; ++i)
+        {
+            CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL));
+            UtAssert_UINT32_EQ(((SB_UT_Test_Tlm_t *)SBBufPtr)->Tlm32Param1, i);
+        }
+
+        /* The wakeup still holds a queue slot, and is counted in the depth */
+        UtAssert_BOOL_TRUE(PipeDscPtr->PriorityWakeupQueued);
+        UtAssert_UINT32_EQ(PipeDscPtr->CurrentQueueDepth, 1);
+
+        /*
+         * Regular messages fill the rest: the depth reaches the pipe depth exactly
+         * when the OS queue holds that many entries, wakeup included
+         */
+        for (i = 1; i <= 3; ++i)
+        {
+            TlmPkt.Tlm32Param1 = 10 + i;
+            UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TlmMsgId, sizeof(TlmMsgId), false);
+            UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+            UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+            CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+        }
+
+        UtAssert_STUB_COUNT(OS_QueuePut, 4);
+        UtAssert_UINT32_EQ(PipeDscPtr->CurrentQueueDepth, PipeDscPtr->MaxQueueDepth);
+        CFE_UtAssert_EVENTNOTSENT(CFE_SB_Q_FULL_ERR_EID);
+
+        /* Reading skips the wakeup, which frees its slot */
+        for (i = 1; i <= 3; ++i)
+        {
+            CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL));
+            UtAssert_UINT32_EQ(((SB_UT_Test_Tlm_t *)SBBufPtr)->Tlm32Param1, 10 + i);
+        }
+
+        UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+        UtAssert_BOOL_FALSE(PipeDscPtr->PriorityWakeupQueued);
+        UtAssert_ZERO(PipeDscPtr->CurrentQueueDepth);
+        CFE_UtAssert_EVENTNOTSENT(CFE_SB_Q_RD_ERR_EID);
+    }
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+}
+
 /*
 ** Test releasing zero copy buffers for all pipes owned by a given app ID
 */
@@ -4352,9 +5005,11 @@ void Test_CleanupApp_API(void)
     CFE_ES_AppId_t  AppID2;
 
     /*
-     * Reset global descriptor list
+     * Reset global descriptor list, with no small buffer slots so
+     * the buffers come from (and are freed to) the pool
      */
     CFE_SB_InitBuffers();
+    CFE_SB_TrackingListReset(&CFE_SB_Global.SmallBufFreeList);
 
     CFE_ES_GetAppID(&AppID);
     AppID2 = CFE_ES_APPID_C(CFE_ResourceId_FromInteger(2));
@@ -4430,6 +5085,7 @@ void Test_SB_Utils(void)
     SB_UT_ADD_SUBTEST(Test_CFE_SB_GetUserData);
     SB_UT_ADD_SUBTEST(Test_CFE_SB_SetGetUserDataLength);
     SB_UT_ADD_SUBTEST(Test_CFE_SB_ZeroCopyReleaseAppId);
+    SB_UT_ADD_SUBTEST(Test_CFE_SB_LatencyHist);
 
     SB_UT_ADD_SUBTEST(Test_CFE_SB_ValidateMsgId);
 
@@ -4776,6 +5432,77 @@ void Test_CFE_SB_ZeroCopyReleaseAppId(void)
     CFE_UtAssert_SUCCESS(CFE_SB_ZeroCopyReleaseAppId(SelfId));
 }
 
+/*
+** Test latency histogram recording and summary
+*/
+void Test_CFE_SB_LatencyHist(void)
+{
+    CFE_SB_LatencyHist_t    Hist;
+    CFE_SB_LatencySummary_t Summary;
+    OS_time_t               Start;
+    OS_time_t               Now;
+    uint32                  i;
+
+    /* An empty histogram summarizes to all zeros */
+    memset(&Hist, 0, sizeof(Hist));
+    CFE_SB_LatencySummarize(&Hist, &Summary);
+    UtAssert_UINT32_EQ(Summary.Count, 0);
+    UtAssert_UINT32_EQ(Summary.P99Usec, 0);
+
+    /* Small values are counted exactly */
+    CFE_SB_LatencyRecord(&Hist, 0);
+    CFE_SB_LatencyRecord(&Hist, 1);
+    CFE_SB_LatencyRecord(&Hist, 1);
+    CFE_SB_LatencySummarize(&Hist, &Summary);
+    UtAssert_UINT32_EQ(Summary.Count, 3);
+    UtAssert_UINT32_EQ(Summary.P50Usec, 1);
+    UtAssert_UINT32_EQ(Summary.MaxUsec, 1);
+
+    /* 98 fast samples and 2 slow ones: median is the fast bucket, p99 the slow one */
+    memset(&Hist, 0, sizeof(Hist));
+    for (i = 0; i < 98; ++i)
+    {
+        CFE_SB_LatencyRecord(&Hist, 10);
+    }
+    CFE_SB_LatencyRecord(&Hist, 5000);
+    CFE_SB_LatencyRecord(&Hist, 5100);
+    CFE_SB_LatencySummarize(&Hist, &Summary);
+    UtAssert_UINT32_EQ(Summary.Count, 100);
+    UtAssert_UINT32_EQ(Summary.P50Usec, 11); /* bucket 8..11 */
+    UtAssert_UINT32_EQ(Summary.P99Usec, 5100); /* bucket upper bound limited to the max */
+    UtAssert_UINT32_EQ(Summary.MaxUsec, 5100);
+
+    /* Values beyond the last bucket still count, and the max is tracked exactly */
+    CFE_SB_LatencyRecord(&Hist, UINT32_MAX);
+    CFE_SB_LatencySummarize(&Hist, &Summary);
+    UtAssert_UINT32_EQ(Summary.Count, 101);
+    UtAssert_UINT32_EQ(Summary.MaxUsec, UINT32_MAX);
+
+    /* A saturated count stops recording */
+    Hist.Count = UINT32_MAX;
+    CFE_SB_LatencyRecord(&Hist, 7);
+    UtAssert_UINT32_EQ(Hist.Count, UINT32_MAX);
+
+    /* Elapsed time clamps instead of wrapping */
+    Start = OS_TimeAssembleFromMicroseconds(10, 500);
+    Now   = OS_TimeAssembleFromMicroseconds(10, 750);
+    UtAssert_UINT32_EQ(CFE_SB_LatencyElapsedUsec(Start, Now), 250);
+    UtAssert_UINT32_EQ(CFE_SB_LatencyElapsedUsec(Now, Start), 0);
+    Now = OS_TimeAssembleFromMicroseconds(100000, 0);
+    UtAssert_UINT32_EQ(CFE_SB_LatencyElapsedUsec(Start, Now), UINT32_MAX);
+
+#if CFE_PLATFORM_SB_LATENCY_STATS
+    /* Reset clears both pipe and route histograms */
+    CFE_SB_LatencyRecord(&CFE_SB_Global.PipeTbl[0].Latency, 3);
+    CFE_SB_LatencyRecord(&CFE_SB_Global.RouteDelivery[0], 3);
+    CFE_SB_LatencyRecord(&CFE_SB_Global.RoutePublish[0], 3);
+    CFE_SB_ResetLatencyStats();
+    UtAssert_UINT32_EQ(CFE_SB_Global.PipeTbl[0].Latency.Count, 0);
+    UtAssert_UINT32_EQ(CFE_SB_Global.RouteDelivery[0].Count, 0);
+    UtAssert_UINT32_EQ(CFE_SB_Global.RoutePublish[0].Count, 0);
+#endif
+}
+
 /*
 ** Function for calling SB special test cases functions
 */
@@ -79,6 +79,13 @@ typedef struct
     uint16            Tlm16Param2;
 } SB_UT_TstPktWoSecHdr_t;
 
+typedef struct
+{
+    CFE_SB_DestinationD_t *DestPtr;        /* destination the publisher waits on */
+    uint32                 PutsBeforeWait; /* queue writes made before the first wait */
+    bool                   HasWaited;      /* set on the first wait */
+} UT_TransmitWaitOrder_t;
+
 #define SB_UT_CMD_MID_VALUE_BASE 0x100
 #define SB_UT_TLM_MID_VALUE_BASE 0x200
 
@@ -1964,6 +1971,23 @@ void Test_TransmitMsg_GetPoolBufErr(void);
 ******************************************************************************/
 void Test_AllocateMessageBuffer(void);
 
+/*****************************************************************************/
+/**
+** \brief Test small messages using the small buffer slots
+**
+** \par Description
+**        This function tests that small messages are given a small buffer
+**        slot, that slots are reused, and that the pool is used when all
+**        slots are taken.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_AllocateMessageBuffer_SmallBuf(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test successfully sending a message in zero copy mode (telemetry
@@ -2045,6 +2069,73 @@ void Test_ReleaseMessageBuffer(void);
 ******************************************************************************/
 void Test_TransmitMsg_DisabledDestination(void);
 
+/*****************************************************************************/
+/**
+** \brief Test send and receive on a latest-value pipe
+**
+** \par Description
+**        This function tests that a pipe with the latest-value option keeps
+**        only the newest message per MsgId, and that the replaced and
+**        replacing buffers are released on receive, unsubscribe and queue
+**        write errors.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_TransmitMsg_LatestValue(void);
+
+/*****************************************************************************/
+/**
+** \brief Test transmit with timeout to full subscribers
+**
+** \par Description
+**        This function tests that a timed transmit waits for a subscriber at
+**        its message limit or pipe depth, delivers once the receiver makes
+**        room, and reports the drop to the caller when the timeout expires.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_TransmitMsgWithTimeout(void);
+
+/*****************************************************************************/
+/**
+** \brief Test that a full subscriber does not hold up the others
+**
+** \par Description
+**        This function tests that a timed transmit writes the message to
+**        subscribers with room before it waits on one that is full.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_TransmitMsgWithTimeout_FullFirst(void);
+
+/*****************************************************************************/
+/**
+** \brief Test getting the congestion level of a route
+**
+** \par Description
+**        This function tests the fill level reported for a route across
+**        subscribers with different message limits and pipe depths.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_GetRouteCongestion(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test CFE_SB_TransmitTxn_BroadcastToRoute
@@ -2205,6 +2296,40 @@ void Test_ReceiveBuffer_PipeReadError(void);
 ******************************************************************************/
 void Test_ReceiveBuffer_PendForever(void);
 
+/*****************************************************************************/
+/**
+** \brief Test receiving from a pipe with a high priority subscription
+**
+** \par Description
+**        This function tests that messages subscribed with a high priority
+**        QoS are received ahead of queued messages, and that the priority
+**        lane limit, wakeup write errors and pipe deletion are handled.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_ReceiveBuffer_PriorityLane(void);
+
+/*****************************************************************************/
+/**
+** \brief Test priority and regular messages interleaved up to the pipe depth
+**
+** \par Description
+**        This function tests that the wakeup entries for priority messages
+**        are consumed and counted in the pipe depth, so that interleaved
+**        traffic neither leaves stale wakeups nor overflows the queue.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_ReceiveBuffer_PriorityInterleave(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test receiving a message response to an invalid buffer pointer (null)
@@ -2331,6 +2456,21 @@ void Test_CFE_SB_ValidateMsgId(void);
 ******************************************************************************/
 void Test_CFE_SB_ZeroCopyReleaseAppId(void);
 
+/*****************************************************************************/
+/**
+** \brief Test latency histogram functions
+**
+** \par Description
+**        Test recording, summarizing and resetting SB latency histograms
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_CFE_SB_LatencyHist(void);
+
 /*****************************************************************************/
 /**
 ** \brief Function for calling SB special test cases functions
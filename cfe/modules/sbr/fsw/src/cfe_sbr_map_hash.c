@@ -110,6 +110,17 @@ void CFE_SBR_Init_Map(void)
     memset(&CFE_SBR_MSGMAP, 0, sizeof(CFE_SBR_MSGMAP));
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+size_t CFE_SBR_GetMapSize(void)
+{
+    return sizeof(CFE_SBR_MSGMAP);
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -0,0 +1,268 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+/******************************************************************************
+ * Paged routing map implementation
+ *
+ * Notes:
+ *   These functions manipulate/access global variables and need
+ *   to be protected by the SB Shared data lock.
+ *
+ *   The message id is split into fields of CFE_PLATFORM_SB_MSGMAP_PAGE_BITS
+ *   each, as in a page table.  The lowest field indexes the route within a
+ *   page, the fields above it index tables of page (or lower table) numbers,
+ *   and the highest field indexes the directory.  The number of levels is the
+ *   fewest that cover CFE_PLATFORM_SB_HIGHEST_VALID_MSGID, so the directory
+ *   never has more than 2^CFE_PLATFORM_SB_MSGMAP_PAGE_BITS entries whatever
+ *   the message id width.
+ *
+ *   Spans without any routes all share table 0 and page 0, which are never
+ *   written and so always read back as invalid, making every lookup one load
+ *   per level with no branches or probing regardless of how full the map is.
+ *
+ */
+
+/*
+ * Include Files
+ */
+
+#include "common_types.h"
+#include "cfe_sbr.h"
+#include "cfe_sbr_priv.h"
+#include <string.h>
+
+#include "cfe_sb.h"
+
+/*
+ * Macro Definitions
+ */
+
+/* Verify page size, larger pages would make the empty page alone bigger than most direct maps */
+#if (CFE_PLATFORM_SB_MSGMAP_PAGE_BITS < 1) || (CFE_PLATFORM_SB_MSGMAP_PAGE_BITS > 16)
+#error CFE_PLATFORM_SB_MSGMAP_PAGE_BITS must be between 1 and 16 for paged message map
+#endif
+
+/**
+ * \brief Number of entries in each page, table and the directory
+ */
+#define CFE_SBR_MSG_MAP_PAGE_SIZE (1 << CFE_PLATFORM_SB_MSGMAP_PAGE_BITS)
+
+/**
+ * \brief Index into a node at height n, where pages are at height 0
+ */
+#define CFE_SBR_MSG_MAP_INDEX(msgidx, n) \
+    (((msgidx) >> ((n) * CFE_PLATFORM_SB_MSGMAP_PAGE_BITS)) & (CFE_SBR_MSG_MAP_PAGE_SIZE - 1))
+
+/**
+ * \brief Number of distinct nodes that can be needed at height n - 1
+ *
+ * One for each span of message ids covered by such a node
+ */
+#define CFE_SBR_MSG_MAP_SPANS(n) \
+    ((CFE_PLATFORM_SB_HIGHEST_VALID_MSGID >> ((n) * CFE_PLATFORM_SB_MSGMAP_PAGE_BITS)) + 1)
+
+/**
+ * \brief Nodes to reserve at height n - 1
+ *
+ * Routes are never removed and each one populates at most one node per
+ * level, so a level can never run out before the routing table is full.
+ */
+#define CFE_SBR_MSG_MAP_NODES(n) \
+    ((CFE_SBR_MSG_MAP_SPANS(n) < CFE_PLATFORM_SB_MAX_MSG_IDS) ? CFE_SBR_MSG_MAP_SPANS(n) : CFE_PLATFORM_SB_MAX_MSG_IDS)
+
+/* Number of levels including the directory and pages, and the tables in between */
+#if (CFE_PLATFORM_SB_HIGHEST_VALID_MSGID >> (2 * CFE_PLATFORM_SB_MSGMAP_PAGE_BITS)) == 0
+#define CFE_SBR_MSG_MAP_LEVELS     2
+#define CFE_SBR_MSG_MAP_MAX_TABLES 0
+#elif (CFE_PLATFORM_SB_HIGHEST_VALID_MSGID >> (3 * CFE_PLATFORM_SB_MSGMAP_PAGE_BITS)) == 0
+#define CFE_SBR_MSG_MAP_LEVELS     3
+#define CFE_SBR_MSG_MAP_MAX_TABLES CFE_SBR_MSG_MAP_NODES(2)
+#elif (CFE_PLATFORM_SB_HIGHEST_VALID_MSGID >> (4 * CFE_PLATFORM_SB_MSGMAP_PAGE_BITS)) == 0
+#define CFE_SBR_MSG_MAP_LEVELS     4
+#define CFE_SBR_MSG_MAP_MAX_TABLES (CFE_SBR_MSG_MAP_NODES(2) + CFE_SBR_MSG_MAP_NODES(3))
+#else
+#error CFE_PLATFORM_SB_MSGMAP_PAGE_BITS too small to cover CFE_PLATFORM_SB_HIGHEST_VALID_MSGID in 4 levels
+#endif
+
+/**
+ * \brief Directory size
+ *
+ * One entry for each span of message ids covered by the level below
+ */
+#define CFE_SBR_MSG_MAP_DIR_SIZE CFE_SBR_MSG_MAP_SPANS(CFE_SBR_MSG_MAP_LEVELS - 1)
+
+/**
+ * \brief Message id shift to the directory index
+ */
+#define CFE_SBR_MSG_MAP_DIR_SHIFT ((CFE_SBR_MSG_MAP_LEVELS - 1) * CFE_PLATFORM_SB_MSGMAP_PAGE_BITS)
+
+/**
+ * \brief Number of pages that can be assigned
+ */
+#define CFE_SBR_MSG_MAP_MAX_PAGES CFE_SBR_MSG_MAP_NODES(1)
+
+/* Verify page and table indexes fit in an entry, reserving 0 for the shared empty ones */
+#if (CFE_SBR_MSG_MAP_MAX_PAGES >= 0xFFFF) || (CFE_SBR_MSG_MAP_MAX_TABLES >= 0xFFFF)
+#error CFE_SBR_MSG_MAP_MAX_PAGES and CFE_SBR_MSG_MAP_MAX_TABLES must be less than 65535 for paged message map
+#endif
+
+/******************************************************************************
+ * Type Definitions
+ */
+
+/** \brief Routes for one page sized span of message ids */
+typedef struct
+{
+    CFE_SBR_RouteId_t RouteId[CFE_SBR_MSG_MAP_PAGE_SIZE];
+} CFE_SBR_MsgMapPage_t;
+
+/** \brief Page (or lower table) numbers for one table sized span of message ids */
+typedef struct
+{
+    uint16 Entry[CFE_SBR_MSG_MAP_PAGE_SIZE];
+} CFE_SBR_MsgMapTable_t;
+
+/** \brief Message map */
+typedef struct
+{
+    uint16 Directory[CFE_SBR_MSG_MAP_DIR_SIZE]; /**< \brief Table or page for each span, 0 if none */
+    uint16 PagesUsed;                           /**< \brief Number of pages assigned so far */
+#if CFE_SBR_MSG_MAP_LEVELS > 2
+    uint16                TablesUsed;                            /**< \brief Number of tables assigned so far */
+    CFE_SBR_MsgMapTable_t Tables[CFE_SBR_MSG_MAP_MAX_TABLES + 1]; /**< \brief Table 0 is the shared empty table */
+#endif
+    CFE_SBR_MsgMapPage_t Pages[CFE_SBR_MSG_MAP_MAX_PAGES + 1]; /**< \brief Page 0 is the shared empty page */
+} CFE_SBR_MsgMap_t;
+
+/******************************************************************************
+ * Shared data
+ */
+
+/** \brief Message map shared data */
+CFE_SBR_MsgMap_t CFE_SBR_MSGMAP;
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper: returns the node an entry refers to, first
+ * assigning the next free one if requested and none is assigned
+ *
+ *-----------------------------------------------------------------*/
+static uint16 CFE_SBR_MapNode(uint16 *EntryPtr, bool Assign, uint16 *UsedPtr, uint32 MaxNodes)
+{
+    if (*EntryPtr == 0 && Assign && *UsedPtr < MaxNodes)
+    {
+        (*UsedPtr)++;
+        *EntryPtr = *UsedPtr;
+    }
+
+    return *EntryPtr;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SBR_Init_Map(void)
+{
+    /* Clear the shared data */
+    memset(&CFE_SBR_MSGMAP, 0, sizeof(CFE_SBR_MSGMAP));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+size_t CFE_SBR_GetMapSize(void)
+{
+    return sizeof(CFE_SBR_MSGMAP);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_SBR_SetRouteId(CFE_SB_MsgId_t MsgId, CFE_SBR_RouteId_t RouteId)
+{
+    CFE_SB_MsgId_Atom_t msgidx;
+    uint16 *            entryptr;
+    uint16              node;
+    bool                assign;
+
+    if (CFE_SB_IsValidMsgId(MsgId))
+    {
+        msgidx   = CFE_SB_MsgIdToValue(MsgId);
+        entryptr = &CFE_SBR_MSGMAP.Directory[msgidx >> CFE_SBR_MSG_MAP_DIR_SHIFT];
+
+        /* Only assign tables and pages when there is a route to store, never writing the shared empty ones */
+        assign = CFE_SBR_IsValidRouteId(RouteId);
+
+#if CFE_SBR_MSG_MAP_LEVELS > 3
+        node     = CFE_SBR_MapNode(entryptr, assign, &CFE_SBR_MSGMAP.TablesUsed, CFE_SBR_MSG_MAP_MAX_TABLES);
+        entryptr = &CFE_SBR_MSGMAP.Tables[node].Entry[CFE_SBR_MSG_MAP_INDEX(msgidx, 2)];
+        assign   = assign && node != 0;
+#endif
+#if CFE_SBR_MSG_MAP_LEVELS > 2
+        node     = CFE_SBR_MapNode(entryptr, assign, &CFE_SBR_MSGMAP.TablesUsed, CFE_SBR_MSG_MAP_MAX_TABLES);
+        entryptr = &CFE_SBR_MSGMAP.Tables[node].Entry[CFE_SBR_MSG_MAP_INDEX(msgidx, 1)];
+        assign   = assign && node != 0;
+#endif
+
+        node = CFE_SBR_MapNode(entryptr, assign, &CFE_SBR_MSGMAP.PagesUsed, CFE_SBR_MSG_MAP_MAX_PAGES);
+        if (node != 0)
+        {
+            CFE_SBR_MSGMAP.Pages[node].RouteId[CFE_SBR_MSG_MAP_INDEX(msgidx, 0)] = RouteId;
+        }
+    }
+
+    /* Paged lookup never collides, always return 0 */
+    return 0;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+CFE_SBR_RouteId_t CFE_SBR_GetRouteId(CFE_SB_MsgId_t MsgId)
+{
+    CFE_SB_MsgId_Atom_t msgidx;
+    uint16              node;
+    CFE_SBR_RouteId_t   routeid = CFE_SBR_INVALID_ROUTE_ID;
+
+    if (CFE_SB_IsValidMsgId(MsgId))
+    {
+        msgidx = CFE_SB_MsgIdToValue(MsgId);
+        node   = CFE_SBR_MSGMAP.Directory[msgidx >> CFE_SBR_MSG_MAP_DIR_SHIFT];
+
+#if CFE_SBR_MSG_MAP_LEVELS > 3
+        node = CFE_SBR_MSGMAP.Tables[node].Entry[CFE_SBR_MSG_MAP_INDEX(msgidx, 2)];
+#endif
+#if CFE_SBR_MSG_MAP_LEVELS > 2
+        node = CFE_SBR_MSGMAP.Tables[node].Entry[CFE_SBR_MSG_MAP_INDEX(msgidx, 1)];
+#endif
+
+        routeid = CFE_SBR_MSGMAP.Pages[node].RouteId[CFE_SBR_MSG_MAP_INDEX(msgidx, 0)];
+    }
+
+    return routeid;
+}
@@ -58,4 +58,14 @@ void CFE_SBR_Init_Map(void);
  */
 uint32 CFE_SBR_SetRouteId(CFE_SB_MsgId_t MsgId, CFE_SBR_RouteId_t RouteId);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Returns the memory used by the message map implementation
+ *
+ * Lets the map implementations be compared for the configured message id range.
+ *
+ * \returns Size of the message map, in bytes
+ */
+size_t CFE_SBR_GetMapSize(void);
+
 #endif /* CFE_SBR_PRIV_H */
@@ -0,0 +1,182 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ * Message map lookup and memory benchmark
+ *
+ * Built once per message map implementation, without the UT stubs or
+ * coverage instrumentation, so the lookup itself is what gets timed.
+ * Routes are added for message ids spread at random over the configured
+ * CFE_PLATFORM_SB_HIGHEST_VALID_MSGID range, then a fixed sequence of
+ * random ids, half of them routed, is looked up.
+ *
+ * Usage: sbr_map_<impl>_bench [routes [lookups]]
+ */
+
+/*
+ * Includes
+ */
+#include "common_types.h"
+#include "cfe_sbr.h"
+#include "cfe_sbr_priv.h"
+#include "cfe_sb.h"
+#include "cfe_msg.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*
+ * Defines
+ */
+#define SBR_BENCH_DEFAULT_LOOKUPS 1000000
+#define SBR_BENCH_PASSES          5
+
+/*
+ * The real implementations live in SB and MSG, which are not linked in
+ */
+bool CFE_SB_IsValidMsgId(CFE_SB_MsgId_t MsgId)
+{
+    return (!CFE_SB_MsgId_Equal(MsgId, CFE_SB_INVALID_MSG_ID) &&
+            CFE_SB_MsgIdToValue(MsgId) <= CFE_PLATFORM_SB_HIGHEST_VALID_MSGID);
+}
+
+CFE_MSG_SequenceCount_t CFE_MSG_GetNextSequenceCount(CFE_MSG_SequenceCount_t SeqCnt)
+{
+    return SeqCnt + 1;
+}
+
+/*
+ * Returns a pseudo-random valid message id value
+ */
+static CFE_SB_MsgId_Atom_t SBR_Bench_RandomMsgId(void)
+{
+    uint32 value;
+
+    value = ((uint32)rand() << 16) ^ (uint32)rand();
+
+    return (value % CFE_PLATFORM_SB_HIGHEST_VALID_MSGID) + 1;
+}
+
+/*
+ * Returns the monotonic clock in nanoseconds
+ */
+static uint64 SBR_Bench_Nsec(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64)now.tv_sec * 1000000000) + now.tv_nsec;
+}
+
+int main(int argc, char *argv[])
+{
+    CFE_SB_MsgId_t *lookups;
+    CFE_SB_MsgId_t  routed[CFE_PLATFORM_SB_MAX_MSG_IDS];
+    uint32          numroutes;
+    uint32          numlookups;
+    uint32          collisions;
+    uint32          total;
+    uint32          found;
+    uint32          pass;
+    uint32          i;
+    uint64          start;
+    uint64          elapsed;
+    uint64          best;
+
+    numroutes  = CFE_PLATFORM_SB_MAX_MSG_IDS;
+    numlookups = SBR_BENCH_DEFAULT_LOOKUPS;
+    if (argc > 1)
+    {
+        numroutes = strtoul(argv[1], NULL, 0);
+    }
+    if (argc > 2)
+    {
+        numlookups = strtoul(argv[2], NULL, 0);
+    }
+    if (numroutes < 1 || numroutes > CFE_PLATFORM_SB_MAX_MSG_IDS || numlookups < 1)
+    {
+        fprintf(stderr, "Usage: %s [routes (1-%u) [lookups]]\n", argv[0], (unsigned int)CFE_PLATFORM_SB_MAX_MSG_IDS);
+        return EXIT_FAILURE;
+    }
+
+    lookups = malloc(numlookups * sizeof(*lookups));
+    if (lookups == NULL)
+    {
+        fprintf(stderr, "Unable to allocate %u lookups\n", (unsigned int)numlookups);
+        return EXIT_FAILURE;
+    }
+
+    srand(1);
+    CFE_SBR_Init();
+
+    total = 0;
+    for (i = 0; i < numroutes; i++)
+    {
+        routed[i] = CFE_SB_ValueToMsgId(SBR_Bench_RandomMsgId());
+        if (!CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(routed[i])))
+        {
+            CFE_SBR_AddRoute(routed[i], &collisions);
+            total += collisions;
+        }
+    }
+
+    for (i = 0; i < numlookups; i++)
+    {
+        if (i & 1)
+        {
+            lookups[i] = routed[rand() % numroutes];
+        }
+        else
+        {
+            lookups[i] = CFE_SB_ValueToMsgId(SBR_Bench_RandomMsgId());
+        }
+    }
+
+    /* Best of several passes, to leave out preemption and cold caches */
+    best  = UINT64_MAX;
+    found = 0;
+    for (pass = 0; pass < SBR_BENCH_PASSES; pass++)
+    {
+        found = 0;
+        start = SBR_Bench_Nsec();
+        for (i = 0; i < numlookups; i++)
+        {
+            if (CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(lookups[i])))
+            {
+                found++;
+            }
+        }
+        elapsed = SBR_Bench_Nsec() - start;
+        if (elapsed < best)
+        {
+            best = elapsed;
+        }
+    }
+
+    printf("map=%s highest_msgid=0x%lX map_bytes=%lu routes=%u collisions=%u lookups=%u found=%u "
+           "ns_per_lookup=%.2f\n",
+           SBR_BENCH_MAP, (unsigned long)CFE_PLATFORM_SB_HIGHEST_VALID_MSGID, (unsigned long)CFE_SBR_GetMapSize(),
+           (unsigned int)numroutes, (unsigned int)total, (unsigned int)numlookups, (unsigned int)found,
+           (double)best / numlookups);
+
+    free(lookups);
+
+    return EXIT_SUCCESS;
+}
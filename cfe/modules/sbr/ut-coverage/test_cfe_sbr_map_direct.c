@@ -50,6 +50,7 @@ void Test_SBR_Map_Direct(void)
 
     UtPrintf("Initialize map");
     CFE_SBR_Init_Map();
+    UtAssert_UINT32_EQ(CFE_SBR_GetMapSize(), (CFE_PLATFORM_SB_HIGHEST_VALID_MSGID + 1) * sizeof(CFE_SBR_RouteId_t));
 
     /* Force valid msgid responses */
     UT_SetDefaultReturnValue(UT_KEY(CFE_SB_IsValidMsgId), true);
@@ -68,6 +68,7 @@ void Test_SBR_Map_Hash(void)
 
     UtPrintf("Initialize routing and map");
     CFE_SBR_Init();
+    UtAssert_UINT32_EQ(CFE_SBR_GetMapSize(), 4 * CFE_PLATFORM_SB_MAX_MSG_IDS * sizeof(CFE_SBR_RouteId_t));
 
     /* Force valid msgid responses */
     UT_SetDefaultReturnValue(UT_KEY(CFE_SB_IsValidMsgId), true);
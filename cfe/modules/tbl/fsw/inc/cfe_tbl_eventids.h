@@ -815,6 +815,17 @@
  *  #CFE_TBL_Load API failure due to the application not owning the table.
  */
 #define CFE_TBL_HANDLE_ACCESS_ERR_EID 103
+
+/**
+ * \brief TBL Load Table File Encoding Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  Load table failure due to an unsupported data encoding in the table file header.
+ */
+#define CFE_TBL_FILE_ENCODING_ERR_EID 104
 /**\}*/
 
 #endif /* CFE_TBL_EVENTS_H */
@@ -172,12 +172,18 @@ CFE_Status_t CFE_TBL_Register(CFE_TBL_Handle_t *TblHandlePtr, const char *Name,
                     Status = CFE_TBL_WARN_NOT_CRITICAL;
                 }
             }
+            else if (!RegRecPtr->UserDefAddr)
+            {
+                /* After a start from a state snapshot, locate its previous contents there */
+                Status = CFE_TBL_RestoreTableDataFromSnapshot(RegRecPtr);
+            }
 
             /* The last step of the registration process is claiming ownership.    */
             /* By making it the last step, other APIs do not have to lock registry */
             /* to share the table or get its address because registry entries that */
             /* are unowned are not checked to see if they match names, etc.        */
             RegRecPtr->OwnerAppId = ThisAppId;
+            CFE_TBL_RegistryRecordAddName(RegRecPtr);
         }
 
         /* Unlock Registry for update */
@@ -238,9 +244,10 @@ CFE_Status_t CFE_TBL_Share(CFE_TBL_Handle_t *TblHandlePtr, const char *TblName)
             AccessDescPtr = CFE_TBL_TxnAccDesc(&Txn);
             RegRecPtr     = CFE_TBL_TxnRegRec(&Txn);
 
-            AccessDescPtr->AppId    = ThisAppId;
-            AccessDescPtr->LockFlag = false;
-            AccessDescPtr->Updated  = false;
+            AccessDescPtr->AppId      = ThisAppId;
+            AccessDescPtr->LockFlag   = false;
+            AccessDescPtr->ReadBuffer = 0;
+            AccessDescPtr->Updated    = false;
 
             /* Check current state of table in order to set Notification flags properly */
             if (RegRecPtr->TableLoadedOnce)
@@ -315,6 +322,7 @@ CFE_Status_t CFE_TBL_Unregister(CFE_TBL_Handle_t TblHandle)
             /* NOTE: Allocated memory is freed when all Access Links have been    */
             /*       removed.  This allows Applications to continue to use the    */
             /*       data until they acknowledge that the table has been removed. */
+            CFE_TBL_RegistryRecordRemoveName(RegRecPtr);
             RegRecPtr->OwnerAppId = CFE_TBL_NOT_OWNED;
 
             /* Remove Table Name */
@@ -416,6 +424,7 @@ CFE_Status_t CFE_TBL_Load(CFE_TBL_Handle_t TblHandle, CFE_TBL_SrcEnum_t SrcType,
         /* of the dump only table is being defined by the application.    */
         RegRecPtr->Buffers[0].BufferPtr = (void *)SrcDataPtr;
         RegRecPtr->TableLoadedOnce      = true;
+        CFE_TBL_AdvanceVersion(RegRecPtr);
 
         snprintf(RegRecPtr->Buffers[0].DataSource, sizeof(RegRecPtr->Buffers[0].DataSource), "Addr 0x%08lX",
                  (unsigned long)SrcDataPtr);
@@ -538,6 +547,13 @@ CFE_Status_t CFE_TBL_Load(CFE_TBL_Handle_t TblHandle, CFE_TBL_SrcEnum_t SrcType,
 
     FirstTime = !RegRecPtr->TableLoadedOnce;
 
+    /*
+     * The update must be done under the registry lock, as it is from CFE_TBL_Update().
+     * CFE_TBL_ReadAcquire() does not take the lock, and relies on the lock being held
+     * by the writer to wait out a single buffered copy.
+     */
+    CFE_TBL_LockRegistry();
+
     /* If this is not the first load, then the data must be moved from the inactive buffer      */
     /* to the active buffer to complete the load.  First loads are done directly to the active. */
     if (!FirstTime)
@@ -546,13 +562,6 @@ CFE_Status_t CFE_TBL_Load(CFE_TBL_Handle_t TblHandle, CFE_TBL_SrcEnum_t SrcType,
         RegRecPtr->LoadPending = true;
 
         Status = CFE_TBL_UpdateInternal(TblHandle, RegRecPtr, AccessDescPtr);
-
-        if (Status != CFE_SUCCESS)
-        {
-            CFE_EVS_SendEventWithAppID(CFE_TBL_UPDATE_ERR_EID, CFE_EVS_EventType_ERROR, CFE_TBL_Global.TableTaskAppId,
-                                       "%s: Failed to update '%s' (Stat=%u)", AppName, RegRecPtr->Name,
-                                       (unsigned int)Status);
-        }
     }
     else
     {
@@ -571,6 +580,15 @@ CFE_Status_t CFE_TBL_Load(CFE_TBL_Handle_t TblHandle, CFE_TBL_SrcEnum_t SrcType,
         Status = CFE_SUCCESS;
     }
 
+    CFE_TBL_UnlockRegistry();
+
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEventWithAppID(CFE_TBL_UPDATE_ERR_EID, CFE_EVS_EventType_ERROR, CFE_TBL_Global.TableTaskAppId,
+                                   "%s: Failed to update '%s' (Stat=%u)", AppName, RegRecPtr->Name,
+                                   (unsigned int)Status);
+    }
+
     if (Status == CFE_SUCCESS)
     {
         /* The first time a table is loaded, the event message is DEBUG */
@@ -831,6 +849,108 @@ CFE_Status_t CFE_TBL_ReleaseAddresses(uint16 NumTables, const CFE_TBL_Handle_t T
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_TBL_ReadAcquire(void **TblPtr, uint32 *VersionPtr, CFE_TBL_Handle_t TblHandle)
+{
+    int32                       Status;
+    CFE_ES_AppId_t              ThisAppId;
+    CFE_TBL_AccessDescriptor_t *AccessDescPtr;
+    CFE_TBL_RegistryRec_t *     RegRecPtr;
+    uint32                      Version;
+
+    if (TblPtr == NULL || VersionPtr == NULL)
+    {
+        return CFE_TBL_BAD_ARGUMENT;
+    }
+
+    /* Assume failure at returning the table address */
+    *TblPtr     = NULL;
+    *VersionPtr = 0;
+
+    /*
+     * Unlike CFE_TBL_GetAddress() the registry is not locked here.  The handle
+     * belongs to the calling app, which is the only one that can release it,
+     * so the descriptor and its registry record are stable for this call.
+     */
+    Status = CFE_ES_GetAppID(&ThisAppId);
+    if (Status != CFE_SUCCESS)
+    {
+        return Status;
+    }
+
+    AccessDescPtr = CFE_TBL_LocateAccessDescriptorByHandle(TblHandle);
+    if (!CFE_TBL_AccessDescriptorIsMatch(AccessDescPtr, TblHandle))
+    {
+        return CFE_TBL_ERR_INVALID_HANDLE;
+    }
+
+    if (!CFE_RESOURCEID_TEST_EQUAL(ThisAppId, AccessDescPtr->AppId))
+    {
+        return CFE_TBL_ERR_NO_ACCESS;
+    }
+
+    RegRecPtr = CFE_TBL_LocateRegistryRecordByID(AccessDescPtr->RegIndex);
+    if (!CFE_TBL_RegistryRecordIsMatch(RegRecPtr, AccessDescPtr->RegIndex) ||
+        CFE_RESOURCEID_TEST_EQUAL(RegRecPtr->OwnerAppId, CFE_TBL_NOT_OWNED))
+    {
+        return CFE_TBL_ERR_UNREGISTERED;
+    }
+
+    /* Version is sampled first, so it is never newer than the buffer returned */
+    Version = __atomic_load_n(&RegRecPtr->Version, __ATOMIC_ACQUIRE);
+
+    if (Version == 0)
+    {
+        /* Nothing to read yet; publishing a hazard here would only hold up the next update */
+        return CFE_TBL_ERR_NEVER_LOADED;
+    }
+
+    *TblPtr     = CFE_TBL_AcquireReadBuffer(RegRecPtr, AccessDescPtr);
+    *VersionPtr = Version;
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_TBL_ReadRelease(CFE_TBL_Handle_t TblHandle)
+{
+    int32                       Status;
+    CFE_ES_AppId_t              ThisAppId;
+    CFE_TBL_AccessDescriptor_t *AccessDescPtr;
+
+    Status = CFE_ES_GetAppID(&ThisAppId);
+    if (Status != CFE_SUCCESS)
+    {
+        return Status;
+    }
+
+    AccessDescPtr = CFE_TBL_LocateAccessDescriptorByHandle(TblHandle);
+    if (!CFE_TBL_AccessDescriptorIsMatch(AccessDescPtr, TblHandle))
+    {
+        return CFE_TBL_ERR_INVALID_HANDLE;
+    }
+
+    if (!CFE_RESOURCEID_TEST_EQUAL(ThisAppId, AccessDescPtr->AppId))
+    {
+        return CFE_TBL_ERR_NO_ACCESS;
+    }
+
+    /* Clear the hazard slot */
+    __atomic_store_n(&AccessDescPtr->ReadBuffer, 0, __ATOMIC_RELEASE);
+
+    return CFE_SUCCESS;
+}
+
 /*----------------------------------------------------------------
  *
  * Implemented per public API
@@ -0,0 +1,328 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+**  File:
+**  cfe_tbl_decompress.c
+**
+**  Purpose:
+**      Streaming decoder for compressed (LZ4 block format) table images
+**
+**  References:
+**     Flight Software Branch C Coding Standard Version 1.0a
+**     cFE Flight Software Application Developers Guide
+*/
+
+/*
+** Includes
+*/
+#include "cfe_tbl_module_all.h"
+
+#include <string.h>
+
+/*
+ * Every LZ4 match copies at least this many bytes
+ */
+#define CFE_TBL_LZ4_MIN_MATCH 4
+
+/*
+ * Length nibble value indicating that extra length bytes follow
+ */
+#define CFE_TBL_LZ4_RUN_MASK 0x0F
+
+/*
+ * Local/private state of a decode in progress
+ */
+typedef struct CFE_TBL_DecompressState
+{
+    osal_id_t FileDescriptor;
+    uint8 *   DestPtr;
+    size_t    DestSize;
+    size_t    OutPos;   /* Number of bytes decoded so far */
+    size_t    CrcPos;   /* Number of decoded bytes already folded into the CRC */
+    uint32    Crc;      /* Running CRC */
+    size_t    ChunkPos; /* Next unconsumed byte in Chunk */
+    size_t    ChunkLen; /* Number of valid bytes in Chunk */
+    uint8     Chunk[CFE_TBL_DECOMPRESS_CHUNK_SIZE];
+} CFE_TBL_DecompressState_t;
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Folds the data decoded since the last call into the running CRC
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_TBL_DecompressUpdateCrc(CFE_TBL_DecompressState_t *State)
+{
+    size_t Length = State->OutPos - State->CrcPos;
+
+    State->Crc    = CFE_ES_CalculateCRC(&State->DestPtr[State->CrcPos], Length, State->Crc, CFE_MISSION_ES_DEFAULT_CRC);
+    State->CrcPos = State->OutPos;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Reads the next chunk of compressed data, returns false at end of file
+ *
+ *-----------------------------------------------------------------*/
+static bool CFE_TBL_DecompressRefill(CFE_TBL_DecompressState_t *State)
+{
+    int32 OsStatus;
+
+    CFE_TBL_DecompressUpdateCrc(State);
+
+    OsStatus = OS_read(State->FileDescriptor, State->Chunk, sizeof(State->Chunk));
+
+    State->ChunkPos = 0;
+    if (OsStatus > 0)
+    {
+        State->ChunkLen = OsStatus; /* status code conversion (size) */
+    }
+    else
+    {
+        State->ChunkLen = 0;
+    }
+
+    return (State->ChunkLen > 0);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ *
+ *-----------------------------------------------------------------*/
+static bool CFE_TBL_DecompressGetByte(CFE_TBL_DecompressState_t *State, uint8 *ValuePtr)
+{
+    if (State->ChunkPos == State->ChunkLen && !CFE_TBL_DecompressRefill(State))
+    {
+        return false;
+    }
+
+    *ValuePtr = State->Chunk[State->ChunkPos];
+    ++State->ChunkPos;
+
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Adds the optional extension bytes of a literal or match length
+ *
+ *-----------------------------------------------------------------*/
+static bool CFE_TBL_DecompressGetLength(CFE_TBL_DecompressState_t *State, size_t *LengthPtr)
+{
+    uint8 Value;
+
+    do
+    {
+        if (!CFE_TBL_DecompressGetByte(State, &Value))
+        {
+            return false;
+        }
+
+        *LengthPtr += Value;
+
+        /* Anything longer than the table cannot be valid, stop before the sum can wrap */
+        if (*LengthPtr > State->DestSize)
+        {
+            return false;
+        }
+    } while (Value == 0xFF);
+
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ *
+ *-----------------------------------------------------------------*/
+static bool CFE_TBL_DecompressCopyLiterals(CFE_TBL_DecompressState_t *State, size_t Length)
+{
+    size_t Avail;
+    int32  OsStatus;
+
+    if (Length > (State->DestSize - State->OutPos))
+    {
+        return false;
+    }
+
+    while (Length > 0)
+    {
+        Avail = State->ChunkLen - State->ChunkPos;
+        if (Avail == 0)
+        {
+            if (Length >= sizeof(State->Chunk))
+            {
+                /* Long runs of incompressible data are read straight into the table buffer */
+                OsStatus = OS_read(State->FileDescriptor, &State->DestPtr[State->OutPos], Length);
+                if (OsStatus <= 0)
+                {
+                    return false;
+                }
+
+                State->OutPos += OsStatus;
+                Length -= OsStatus;
+                continue;
+            }
+
+            if (!CFE_TBL_DecompressRefill(State))
+            {
+                return false;
+            }
+
+            Avail = State->ChunkLen;
+        }
+
+        if (Avail > Length)
+        {
+            Avail = Length;
+        }
+
+        memcpy(&State->DestPtr[State->OutPos], &State->Chunk[State->ChunkPos], Avail);
+        State->ChunkPos += Avail;
+        State->OutPos += Avail;
+        Length -= Avail;
+    }
+
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ *
+ *-----------------------------------------------------------------*/
+static bool CFE_TBL_DecompressCopyMatch(CFE_TBL_DecompressState_t *State, uint8 Token)
+{
+    uint8        OffsetBytes[2];
+    size_t       Offset;
+    size_t       Length;
+    const uint8 *SrcPtr;
+    uint8 *      DstPtr;
+
+    if (!CFE_TBL_DecompressGetByte(State, &OffsetBytes[0]) || !CFE_TBL_DecompressGetByte(State, &OffsetBytes[1]))
+    {
+        return false;
+    }
+
+    /* Offsets are little endian and must refer back into data already decoded */
+    Offset = OffsetBytes[0] | ((size_t)OffsetBytes[1] << 8);
+    if (Offset == 0 || Offset > State->OutPos)
+    {
+        return false;
+    }
+
+    Length = Token & CFE_TBL_LZ4_RUN_MASK;
+    if (Length == CFE_TBL_LZ4_RUN_MASK && !CFE_TBL_DecompressGetLength(State, &Length))
+    {
+        return false;
+    }
+
+    Length += CFE_TBL_LZ4_MIN_MATCH;
+    if (Length > (State->DestSize - State->OutPos))
+    {
+        return false;
+    }
+
+    DstPtr = &State->DestPtr[State->OutPos];
+    SrcPtr = DstPtr - Offset;
+    State->OutPos += Length;
+
+    if (Offset >= Length)
+    {
+        memcpy(DstPtr, SrcPtr, Length);
+    }
+    else
+    {
+        /* Overlapping copy repeats the last Offset bytes, so it must go forward one byte at a time */
+        while (Length > 0)
+        {
+            *DstPtr = *SrcPtr;
+            ++DstPtr;
+            ++SrcPtr;
+            --Length;
+        }
+    }
+
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_TBL_DecompressFromFile(osal_id_t FileDescriptor, void *DestPtr, size_t DestSize, uint32 *CrcPtr)
+{
+    CFE_TBL_DecompressState_t State;
+    uint8                     Token;
+    size_t                    Length;
+    bool                      IsValid;
+
+    State.FileDescriptor = FileDescriptor;
+    State.DestPtr        = DestPtr;
+    State.DestSize       = DestSize;
+    State.OutPos         = 0;
+    State.CrcPos         = 0;
+    State.Crc            = *CrcPtr;
+    State.ChunkPos       = 0;
+    State.ChunkLen       = 0;
+
+    /*
+     * Each sequence is a token, a run of literals, then (except at the end) a back reference.
+     * There is always at least one sequence, even for an empty table.
+     */
+    do
+    {
+        IsValid = CFE_TBL_DecompressGetByte(&State, &Token);
+
+        if (IsValid)
+        {
+            Length = Token >> 4;
+            if (Length == CFE_TBL_LZ4_RUN_MASK)
+            {
+                IsValid = CFE_TBL_DecompressGetLength(&State, &Length);
+            }
+        }
+
+        if (IsValid)
+        {
+            IsValid = CFE_TBL_DecompressCopyLiterals(&State, Length);
+        }
+
+        if (IsValid && State.OutPos < DestSize)
+        {
+            IsValid = CFE_TBL_DecompressCopyMatch(&State, Token);
+        }
+    } while (IsValid && State.OutPos < DestSize);
+
+    CFE_TBL_DecompressUpdateCrc(&State);
+    *CrcPtr = State.Crc;
+
+    /* Hand back any read-ahead so the caller can check for trailing data */
+    if (State.ChunkPos < State.ChunkLen)
+    {
+        OS_lseek(FileDescriptor, -(int32)(State.ChunkLen - State.ChunkPos), OS_SEEK_CUR);
+    }
+
+    return (int32)State.OutPos;
+}
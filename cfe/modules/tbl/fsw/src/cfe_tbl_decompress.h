@@ -0,0 +1,75 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Prototypes for decoding compressed table images.
+ *
+ * Compressed table data is stored as a single block in the LZ4 block format,
+ * immediately following the table file header.  The header NumBytes field
+ * gives the decoded size.  The data is decoded as it is read, straight into
+ * the working buffer, so no intermediate copy of the compressed image exists.
+ */
+
+#ifndef CFE_TBL_DECOMPRESS_H
+#define CFE_TBL_DECOMPRESS_H
+
+/*
+** Required header files...
+*/
+#include "common_types.h"
+#include "osapi.h"
+
+/*
+ * Size of the read-ahead buffer used while decoding, in bytes.
+ *
+ * This lives on the stack of the task performing the load.
+ */
+#define CFE_TBL_DECOMPRESS_CHUNK_SIZE 512
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Decodes an LZ4 compressed table image from a file
+**
+** \par Description
+**        Reads the compressed data from the current position of the file in
+**        chunks and decodes it directly into the destination buffer.  The CRC
+**        of the decoded data is folded into *CrcPtr as each chunk completes,
+**        while the data is still fresh in the cache.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# Any data read ahead beyond the end of the compressed block is
+**           returned to the file, so the caller can check for trailing data
+**           exactly as it would after a plain read.
+**        -# Malformed data is never written outside of the destination buffer;
+**           decoding simply stops short.
+**
+** \param[in]      FileDescriptor File positioned at the start of the compressed data
+**
+** \param[out]     DestPtr        Buffer that receives the decoded table data
+**
+** \param[in]      DestSize       Number of decoded bytes expected
+**
+** \param[in, out] CrcPtr         Running CRC, updated to cover the decoded data
+**
+** \return Number of bytes decoded, which is less than DestSize if the data ended early or was malformed
+*/
+int32 CFE_TBL_DecompressFromFile(osal_id_t FileDescriptor, void *DestPtr, size_t DestSize, uint32 *CrcPtr);
+
+#endif /* CFE_TBL_DECOMPRESS_H */
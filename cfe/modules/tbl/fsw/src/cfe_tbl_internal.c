@@ -54,7 +54,8 @@ static void CFE_TBL_CheckInactiveBufferHelper(CFE_TBL_AccessDescriptor_t *AccDes
 {
     CFE_TBL_CheckInactiveBuffer_t *StatPtr = Arg;
 
-    if (AccDescPtr->BufferIndex == StatPtr->BufferIndex && AccDescPtr->LockFlag)
+    if ((AccDescPtr->BufferIndex == StatPtr->BufferIndex && AccDescPtr->LockFlag) ||
+        __atomic_load_n(&AccDescPtr->ReadBuffer, __ATOMIC_SEQ_CST) == (StatPtr->BufferIndex + 1))
     {
         StatPtr->LockingAppId = AccDescPtr->AppId;
     }
@@ -205,6 +206,48 @@ int32 CFE_TBL_EarlyInit(void)
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Name match function for the registry name index
+ *
+ *-----------------------------------------------------------------*/
+static bool CFE_TBL_RegistryNameMatch(uint32 Idx, const char *Name)
+{
+    CFE_TBL_RegistryRec_t *RegRecPtr = &CFE_TBL_Global.Registry[Idx];
+
+    /* Registry records that are not owned are not checked to see if they match names */
+    return (!CFE_RESOURCEID_TEST_EQUAL(RegRecPtr->OwnerAppId, CFE_TBL_NOT_OWNED) && strcmp(Name, RegRecPtr->Name) == 0);
+}
+
+const CFE_ResourceId_NameIndex_t CFE_TBL_RegistryNameIndex = {
+    .Buckets    = CFE_TBL_Global.RegistryNameIndex,
+    .NumBuckets = CFE_RESOURCEID_NAMEINDEX_BUCKETS(CFE_PLATFORM_TBL_MAX_NUM_TABLES),
+    .TableSize  = CFE_PLATFORM_TBL_MAX_NUM_TABLES,
+    .MatchFunc  = CFE_TBL_RegistryNameMatch};
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TBL_RegistryRecordAddName(CFE_TBL_RegistryRec_t *RegRecPtr)
+{
+    CFE_ResourceId_NameIndexAdd(&CFE_TBL_RegistryNameIndex, RegRecPtr->Name, RegRecPtr - CFE_TBL_Global.Registry);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TBL_RegistryRecordRemoveName(CFE_TBL_RegistryRec_t *RegRecPtr)
+{
+    CFE_ResourceId_NameIndexRemove(&CFE_TBL_RegistryNameIndex, RegRecPtr->Name, RegRecPtr - CFE_TBL_Global.Registry);
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -238,6 +281,7 @@ int16 CFE_TBL_FindTableInRegistry(const char *TblName)
 
     /* Note: there is no way for transaction setup to fail when passing false for context check */
     CFE_TBL_TxnInit(&Txn, false);
+    CFE_TBL_TxnLockRegistry(&Txn);
     CFE_TBL_TxnFindRegByName(&Txn, TblName);
     CFE_TBL_TxnFinish(&Txn);
 
@@ -635,8 +679,7 @@ int32 CFE_TBL_LoadFromFile(const char *AppName, CFE_TBL_LoadBuff_t *WorkingBuffe
         Status = CFE_TBL_WARN_SHORT_FILE;
     }
 
-    OsStatus =
-        OS_read(FileDescriptor, ((uint8 *)WorkingBufferPtr->BufferPtr) + TblFileHeader.Offset, TblFileHeader.NumBytes);
+    OsStatus = CFE_TBL_ReadTableData(FileDescriptor, &TblFileHeader, WorkingBufferPtr, RegRecPtr->Size);
     if (OsStatus >= OS_SUCCESS)
     {
         NumBytes = OsStatus; /* status code conversion (size) */
@@ -685,10 +728,6 @@ int32 CFE_TBL_LoadFromFile(const char *AppName, CFE_TBL_LoadBuff_t *WorkingBuffe
     WorkingBufferPtr->FileTime.Seconds    = StdFileHeader.TimeSeconds;
     WorkingBufferPtr->FileTime.Subseconds = StdFileHeader.TimeSubSeconds;
 
-    /* Compute the CRC on the specified table buffer */
-    WorkingBufferPtr->Crc =
-        CFE_ES_CalculateCRC(WorkingBufferPtr->BufferPtr, RegRecPtr->Size, 0, CFE_MISSION_ES_DEFAULT_CRC);
-
     OS_close(FileDescriptor);
 
     return Status;
@@ -704,7 +743,7 @@ static void CFE_TBL_CheckLockHelper(CFE_TBL_AccessDescriptor_t *AccDescPtr, void
 {
     bool *LockStatus = Arg;
 
-    if (AccDescPtr->LockFlag)
+    if (AccDescPtr->LockFlag || __atomic_load_n(&AccDescPtr->ReadBuffer, __ATOMIC_SEQ_CST) != 0)
     {
         *LockStatus = true;
     }
@@ -733,7 +772,8 @@ int32 CFE_TBL_UpdateInternal(CFE_TBL_Handle_t TblHandle, CFE_TBL_RegistryRec_t *
         if (RegRecPtr->DoubleBuffered)
         {
             /* To update a double buffered table only requires a pointer swap */
-            RegRecPtr->ActiveBufferIndex = (uint8)RegRecPtr->LoadInProgress;
+            /* Lock-free readers re-check this index after publishing their hazard */
+            __atomic_store_n(&RegRecPtr->ActiveBufferIndex, (uint8)RegRecPtr->LoadInProgress, __ATOMIC_SEQ_CST);
 
             /* Source description in buffer should already have been updated by either */
             /* the LoadFromFile function or the Load function (when a memory load).    */
@@ -752,11 +792,20 @@ int32 CFE_TBL_UpdateInternal(CFE_TBL_Handle_t TblHandle, CFE_TBL_RegistryRec_t *
         }
         else
         {
+            /*
+             * Announce the copy before scanning for readers, so that a lock-free
+             * reader either shows up in the scan or sees the flag and waits on
+             * the registry lock (which is held here) until the copy is done.
+             */
+            __atomic_store_n(&RegRecPtr->CopyInProgress, true, __ATOMIC_SEQ_CST);
+
             /* Check to see if the Table is locked by anyone */
             CFE_TBL_ForeachAccessDescriptor(RegRecPtr, CFE_TBL_CheckLockHelper, &LockStatus);
 
             if (LockStatus)
             {
+                __atomic_store_n(&RegRecPtr->CopyInProgress, false, __ATOMIC_RELEASE);
+
                 Status = CFE_TBL_INFO_TABLE_LOCKED;
 
                 CFE_ES_WriteToSysLog("%s: Unable to update locked table Handle=%d\n", __func__, TblHandle);
@@ -790,6 +839,8 @@ int32 CFE_TBL_UpdateInternal(CFE_TBL_Handle_t TblHandle, CFE_TBL_RegistryRec_t *
 
                 CFE_TBL_NotifyTblUsersOfUpdate(RegRecPtr);
 
+                __atomic_store_n(&RegRecPtr->CopyInProgress, false, __ATOMIC_RELEASE);
+
                 /* If the table is a critical table, update the appropriate CDS with the new data */
                 if (RegRecPtr->CriticalTable == true)
                 {
@@ -830,6 +881,68 @@ void CFE_TBL_NotifyTblUsersOfUpdate(CFE_TBL_RegistryRec_t *RegRecPtr)
     RegRecPtr->TableLoadedOnce = true;
 
     CFE_TBL_ForeachAccessDescriptor(RegRecPtr, CFE_TBL_SetUpdatedHelper, NULL);
+
+    CFE_TBL_AdvanceVersion(RegRecPtr);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TBL_AdvanceVersion(CFE_TBL_RegistryRec_t *RegRecPtr)
+{
+    uint32 NextVersion;
+
+    /* Zero is reserved to mean "never loaded", so skip it on wraparound */
+    NextVersion = RegRecPtr->Version + 1;
+    if (NextVersion == 0)
+    {
+        NextVersion = 1;
+    }
+
+    __atomic_store_n(&RegRecPtr->Version, NextVersion, __ATOMIC_RELEASE);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void *CFE_TBL_AcquireReadBuffer(CFE_TBL_RegistryRec_t *RegRecPtr, CFE_TBL_AccessDescriptor_t *AccessDescPtr)
+{
+    uint8 BufferIndex;
+
+    /*
+     * Publish the hazard for the active buffer, then confirm the buffer is
+     * still active.  If a double buffered swap raced with the publish, retry
+     * with the new index; the writer only reuses a buffer after checking the
+     * hazard slots, so once confirmed the buffer cannot change underneath.
+     */
+    do
+    {
+        BufferIndex = __atomic_load_n(&RegRecPtr->ActiveBufferIndex, __ATOMIC_SEQ_CST);
+        __atomic_store_n(&AccessDescPtr->ReadBuffer, (uint8)(BufferIndex + 1), __ATOMIC_SEQ_CST);
+    } while (BufferIndex != __atomic_load_n(&RegRecPtr->ActiveBufferIndex, __ATOMIC_SEQ_CST));
+
+    if (__atomic_load_n(&RegRecPtr->CopyInProgress, __ATOMIC_SEQ_CST))
+    {
+        /*
+         * A single buffered update is copying into the buffer.  Step aside so
+         * the writer is not blocked by this hazard, then wait for the copy to
+         * finish by taking the registry lock it holds.
+         */
+        __atomic_store_n(&AccessDescPtr->ReadBuffer, 0, __ATOMIC_RELEASE);
+
+        CFE_TBL_LockRegistry();
+        BufferIndex = RegRecPtr->ActiveBufferIndex;
+        __atomic_store_n(&AccessDescPtr->ReadBuffer, (uint8)(BufferIndex + 1), __ATOMIC_SEQ_CST);
+        CFE_TBL_UnlockRegistry();
+    }
+
+    return RegRecPtr->Buffers[BufferIndex].BufferPtr;
 }
 
 /*----------------------------------------------------------------
@@ -927,6 +1040,18 @@ int32 CFE_TBL_ReadHeaders(osal_id_t FileDescriptor, CFE_FS_Header_t *StdFileHead
                      */
                     TblFileHeaderPtr->TableName[sizeof(TblFileHeaderPtr->TableName) - 1] = '\0';
 
+                    /* Verify the table data is encoded in a way this version can decode */
+                    if (TblFileHeaderPtr->Encoding != CFE_TBL_FileEncoding_RAW &&
+                        TblFileHeaderPtr->Encoding != CFE_TBL_FileEncoding_LZ4)
+                    {
+                        CFE_EVS_SendEventWithAppID(CFE_TBL_FILE_ENCODING_ERR_EID, CFE_EVS_EventType_ERROR,
+                                                   CFE_TBL_Global.TableTaskAppId,
+                                                   "Unsupported data encoding for '%s', Encoding = %lu", LoadFilename,
+                                                   (unsigned long)TblFileHeaderPtr->Encoding);
+
+                        Status = CFE_TBL_ERR_BAD_ENCODING;
+                    }
+
 /* Verify Spacecraft ID contained in table file header [optional] */
 #if (CFE_PLATFORM_TBL_VALID_SCID_COUNT > 0)
                     if (Status == CFE_SUCCESS)
@@ -980,6 +1105,46 @@ int32 CFE_TBL_ReadHeaders(osal_id_t FileDescriptor, CFE_FS_Header_t *StdFileHead
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_TBL_ReadTableData(osal_id_t FileDescriptor, const CFE_TBL_File_Hdr_t *TblFileHeaderPtr,
+                            CFE_TBL_LoadBuff_t *WorkingBufferPtr, size_t TableSize)
+{
+    int32  Status;
+    uint8 *DataPtr = WorkingBufferPtr->BufferPtr;
+    size_t EndOffset;
+    uint32 Crc;
+
+    if (TblFileHeaderPtr->Encoding == CFE_TBL_FileEncoding_LZ4)
+    {
+        /*
+         * The CRC covers the whole table, so fold in the part before the load,
+         * let the decoder fold in the data as it is produced, then finish with
+         * the part after the load.
+         */
+        Crc    = CFE_ES_CalculateCRC(DataPtr, TblFileHeaderPtr->Offset, 0, CFE_MISSION_ES_DEFAULT_CRC);
+        Status = CFE_TBL_DecompressFromFile(FileDescriptor, &DataPtr[TblFileHeaderPtr->Offset],
+                                            TblFileHeaderPtr->NumBytes, &Crc);
+
+        EndOffset = TblFileHeaderPtr->Offset + TblFileHeaderPtr->NumBytes;
+        WorkingBufferPtr->Crc =
+            CFE_ES_CalculateCRC(&DataPtr[EndOffset], TableSize - EndOffset, Crc, CFE_MISSION_ES_DEFAULT_CRC);
+    }
+    else
+    {
+        Status = OS_read(FileDescriptor, &DataPtr[TblFileHeaderPtr->Offset], TblFileHeaderPtr->NumBytes);
+
+        /* Compute the CRC on the specified table buffer */
+        WorkingBufferPtr->Crc = CFE_ES_CalculateCRC(DataPtr, TableSize, 0, CFE_MISSION_ES_DEFAULT_CRC);
+    }
+
+    return Status;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -988,7 +1153,7 @@ int32 CFE_TBL_ReadHeaders(osal_id_t FileDescriptor, CFE_FS_Header_t *StdFileHead
  *-----------------------------------------------------------------*/
 void CFE_TBL_ByteSwapTblHeader(CFE_TBL_File_Hdr_t *HdrPtr)
 {
-    CFE_TBL_ByteSwapUint32(&HdrPtr->Reserved);
+    CFE_TBL_ByteSwapUint32(&HdrPtr->Encoding);
     CFE_TBL_ByteSwapUint32(&HdrPtr->Offset);
     CFE_TBL_ByteSwapUint32(&HdrPtr->NumBytes);
 }
@@ -1056,6 +1221,7 @@ int32 CFE_TBL_CleanUpApp(CFE_ES_AppId_t AppId)
                 /* NOTE: Allocated memory is freed when all Access Links have been    */
                 /*       removed.  This allows Applications to continue to use the    */
                 /*       data until they acknowledge that the table has been removed. */
+                CFE_TBL_RegistryRecordRemoveName(Txn.RegRecPtr);
                 Txn.RegRecPtr->OwnerAppId = CFE_TBL_NOT_OWNED;
 
                 /* Remove Table Name */
@@ -1076,6 +1242,43 @@ int32 CFE_TBL_CleanUpApp(CFE_ES_AppId_t AppId)
     return CFE_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_TBL_SnapshotTableGetter(uint32 RecordNum, CFE_ES_SnapshotTableHeader_t *HeaderPtr, const void **DataPtr)
+{
+    CFE_TBL_RegistryRec_t *RegRecPtr;
+
+    *DataPtr = NULL;
+
+    if (RecordNum < CFE_PLATFORM_TBL_MAX_NUM_TABLES)
+    {
+        RegRecPtr = &CFE_TBL_Global.Registry[RecordNum];
+
+        CFE_TBL_LockRegistry();
+
+        /* Critical tables are saved in the CDS, and user defined tables belong to their app */
+        if (!CFE_RESOURCEID_TEST_EQUAL(RegRecPtr->OwnerAppId, CFE_TBL_NOT_OWNED) && RegRecPtr->TableLoadedOnce &&
+            !RegRecPtr->CriticalTable && !RegRecPtr->UserDefAddr)
+        {
+            memset(HeaderPtr, 0, sizeof(*HeaderPtr));
+            strncpy(HeaderPtr->Name, RegRecPtr->Name, sizeof(HeaderPtr->Name) - 1);
+            strncpy(HeaderPtr->LastFileLoaded, RegRecPtr->LastFileLoaded, sizeof(HeaderPtr->LastFileLoaded) - 1);
+            HeaderPtr->Size = RegRecPtr->Size;
+
+            *DataPtr = CFE_TBL_GetActiveBuffer(RegRecPtr)->BufferPtr;
+        }
+
+        CFE_TBL_UnlockRegistry();
+    }
+
+    /* Check for EOF (last entry) */
+    return (RecordNum >= (CFE_PLATFORM_TBL_MAX_NUM_TABLES - 1));
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -1134,7 +1337,7 @@ void CFE_TBL_UpdateCriticalTblCDS(CFE_TBL_RegistryRec_t *RegRecPtr)
             CritRegRecPtr->TableLoadedOnce                                           = RegRecPtr->TableLoadedOnce;
 
             /* Update copy of Critical Table Registry in the CDS */
-            Status = CFE_ES_CopyToCDS(CFE_TBL_Global.CritRegHandle, CFE_TBL_Global.CritReg);
+            Status = CFE_TBL_UpdateCritRegRecCDS(CritRegRecPtr);
 
             if (Status != CFE_SUCCESS)
             {
@@ -1151,6 +1354,23 @@ void CFE_TBL_UpdateCriticalTblCDS(CFE_TBL_RegistryRec_t *RegRecPtr)
     /* Don't bother notifying the caller of the problem since the active table is still legitimate */
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_TBL_UpdateCritRegRecCDS(const CFE_TBL_CritRegRec_t *CritRegRecPtr)
+{
+    CFE_ES_CDSRange_t DirtyRange;
+
+    /* Only the one record changed, so there is no need to rewrite the entire registry */
+    DirtyRange.Offset = (size_t)(CritRegRecPtr - CFE_TBL_Global.CritReg) * sizeof(CFE_TBL_CritRegRec_t);
+    DirtyRange.Size   = sizeof(CFE_TBL_CritRegRec_t);
+
+    return CFE_ES_CopyRangesToCDS(CFE_TBL_Global.CritRegHandle, CFE_TBL_Global.CritReg, &DirtyRange, 1);
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -1457,6 +1677,50 @@ CFE_Status_t CFE_TBL_RestoreTableDataFromCDS(CFE_TBL_RegistryRec_t *RegRecPtr, c
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_TBL_RestoreTableDataFromSnapshot(CFE_TBL_RegistryRec_t *RegRecPtr)
+{
+    CFE_ES_SnapshotTableHeader_t TblHeader;
+    CFE_TBL_LoadBuff_t *         ActiveBufferPtr;
+
+    memset(&TblHeader, 0, sizeof(TblHeader));
+    strncpy(TblHeader.Name, RegRecPtr->Name, sizeof(TblHeader.Name) - 1);
+    TblHeader.Size = RegRecPtr->Size;
+
+    /* A table that has just been registered has no users yet, so its active buffer is filled directly */
+    ActiveBufferPtr = CFE_TBL_GetActiveBuffer(RegRecPtr);
+
+    if (CFE_ES_RestoreSnapshotTable(&TblHeader, ActiveBufferPtr->BufferPtr) != CFE_SUCCESS)
+    {
+        /* Not in a restored snapshot, so the table is loaded as after any other start */
+        return CFE_SUCCESS;
+    }
+
+    strncpy(ActiveBufferPtr->DataSource, TblHeader.LastFileLoaded, sizeof(ActiveBufferPtr->DataSource) - 1);
+    ActiveBufferPtr->DataSource[sizeof(ActiveBufferPtr->DataSource) - 1] = '\0';
+
+    strncpy(RegRecPtr->LastFileLoaded, TblHeader.LastFileLoaded, sizeof(RegRecPtr->LastFileLoaded) - 1);
+    RegRecPtr->LastFileLoaded[sizeof(RegRecPtr->LastFileLoaded) - 1] = '\0';
+
+    RegRecPtr->TimeOfLastUpdate = CFE_TIME_GetTime();
+    RegRecPtr->TableLoadedOnce  = true;
+
+    /* Compute the CRC on the specified table buffer */
+    ActiveBufferPtr->Crc =
+        CFE_ES_CalculateCRC(ActiveBufferPtr->BufferPtr, RegRecPtr->Size, 0, CFE_MISSION_ES_DEFAULT_CRC);
+
+    /* Make sure everyone who sees the table knows that it has been updated */
+    CFE_TBL_NotifyTblUsersOfUpdate(RegRecPtr);
+
+    /* Make sure the caller realizes the contents have been initialized */
+    return CFE_TBL_INFO_RECOVERED_TBL;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -1480,7 +1744,7 @@ void CFE_TBL_RegisterWithCriticalTableRegistry(CFE_TBL_CritRegRec_t *CritRegRecP
         CritRegRecPtr->FileTime         = CFE_TIME_ZERO_VALUE;
         CritRegRecPtr->TimeOfLastUpdate = CFE_TIME_ZERO_VALUE;
 
-        CFE_ES_CopyToCDS(CFE_TBL_Global.CritRegHandle, CFE_TBL_Global.CritReg);
+        CFE_TBL_UpdateCritRegRecCDS(CritRegRecPtr);
     }
     else
     {
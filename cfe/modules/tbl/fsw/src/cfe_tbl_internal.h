@@ -221,6 +221,8 @@ int32 CFE_TBL_LoadFromFile(const char *AppName, CFE_TBL_LoadBuff_t *WorkingBuffe
 ** \par Assumptions, External Events, and Notes:
 **        -# All parameters are assumed to be verified before function
 **           is called.
+**        -# The caller must hold the registry lock, which lock-free readers
+**           take to wait for a single buffered copy to complete.
 **
 ** \param[in]  TblHandle      Handle of Table to be updated.
 **
@@ -249,6 +251,45 @@ int32 CFE_TBL_UpdateInternal(CFE_TBL_Handle_t TblHandle, CFE_TBL_RegistryRec_t *
 */
 void CFE_TBL_NotifyTblUsersOfUpdate(CFE_TBL_RegistryRec_t *RegRecPtr);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Advances the version of the contents of the specified table
+**
+** \par Description
+**        Increments the version reported by #CFE_TBL_ReadAcquire so that
+**        lock-free readers can detect the update with a simple compare.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# The registry is assumed to be locked by the caller.
+**        -# The version never returns to zero, which is reserved for tables
+**           that have never been loaded.
+**
+** \param[in]  RegRecPtr      Pointer to Table Registry Entry for table that was updated
+*/
+void CFE_TBL_AdvanceVersion(CFE_TBL_RegistryRec_t *RegRecPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Pins the active buffer of a table without holding the registry lock
+**
+** \par Description
+**        Publishes the active buffer index in the hazard slot of the access
+**        descriptor and returns the address of that buffer.  Buffers named in
+**        a hazard slot are treated as locked by the update logic.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# All parameters are assumed to be verified before function
+**           is called.
+**        -# The registry must NOT be locked by the caller.
+**
+** \param[in]  RegRecPtr      Pointer to Table Registry Entry for table to be read
+**
+** \param[in]  AccessDescPtr  Pointer to access descriptor of the reading application
+**
+** \return Address of the pinned buffer
+*/
+void *CFE_TBL_AcquireReadBuffer(CFE_TBL_RegistryRec_t *RegRecPtr, CFE_TBL_AccessDescriptor_t *AccessDescPtr);
+
 /*---------------------------------------------------------------------------------------*/
 /**
 ** \brief Reads Table File Headers
@@ -281,11 +322,40 @@ void CFE_TBL_NotifyTblUsersOfUpdate(CFE_TBL_RegistryRec_t *RegRecPtr);
 ** \retval #CFE_TBL_ERR_BAD_SUBTYPE_ID      \copydoc CFE_TBL_ERR_BAD_SUBTYPE_ID
 ** \retval #CFE_TBL_ERR_BAD_SPACECRAFT_ID   \copydoc CFE_TBL_ERR_BAD_SPACECRAFT_ID
 ** \retval #CFE_TBL_ERR_BAD_PROCESSOR_ID    \copydoc CFE_TBL_ERR_BAD_PROCESSOR_ID
+** \retval #CFE_TBL_ERR_BAD_ENCODING        \copydoc CFE_TBL_ERR_BAD_ENCODING
 **
 */
 int32 CFE_TBL_ReadHeaders(osal_id_t FileDescriptor, CFE_FS_Header_t *StdFileHeaderPtr,
                           CFE_TBL_File_Hdr_t *TblFileHeaderPtr, const char *LoadFilename);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Reads the table data that follows the table file headers
+**
+** \par Description
+**        Reads NumBytes of table data into the working buffer at the offset
+**        given in the table file header, decoding it if the header indicates
+**        a compressed encoding.  The CRC of the complete working buffer is
+**        computed along the way and stored in the working buffer descriptor.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# The file is positioned just after the table file header, and the
+**           header has been validated by #CFE_TBL_ReadHeaders.
+**        -# Offset plus NumBytes has been verified to fit within TableSize.
+**
+** \param[in]  FileDescriptor    File descriptor of the open table file
+**
+** \param[in]  TblFileHeaderPtr  Pointer to the (byte swapped) table file header
+**
+** \param[in, out] WorkingBufferPtr Working buffer that receives the data and its CRC
+**
+** \param[in]  TableSize         Size of the table, in bytes
+**
+** \return Number of bytes placed in the buffer, or a negative OSAL status code, in the same manner as OS_read()
+*/
+int32 CFE_TBL_ReadTableData(osal_id_t FileDescriptor, const CFE_TBL_File_Hdr_t *TblFileHeaderPtr,
+                            CFE_TBL_LoadBuff_t *WorkingBufferPtr, size_t TableSize);
+
 /*---------------------------------------------------------------------------------------*/
 /**
 ** \brief Initializes the entries of a single Table Registry Record
@@ -299,6 +369,28 @@ int32 CFE_TBL_ReadHeaders(osal_id_t FileDescriptor, CFE_FS_Header_t *StdFileHead
 */
 void CFE_TBL_InitRegistryRecord(CFE_TBL_RegistryRec_t *RegRecPtr);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Adds a Table Registry Record to the registry name index
+**
+** \par Assumptions, External Events, and Notes:
+**        -# This function must be called while the registry is locked, once the
+**           record has a name and an owner
+**
+*/
+void CFE_TBL_RegistryRecordAddName(CFE_TBL_RegistryRec_t *RegRecPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Removes a Table Registry Record from the registry name index
+**
+** \par Assumptions, External Events, and Notes:
+**        -# This function must be called while the registry is locked, before
+**           the name of the record is cleared
+**
+*/
+void CFE_TBL_RegistryRecordRemoveName(CFE_TBL_RegistryRec_t *RegRecPtr);
+
 /*---------------------------------------------------------------------------------------*/
 /**
 ** \brief Byte swaps a CFE_TBL_File_Hdr_t structure
@@ -359,6 +451,24 @@ void CFE_TBL_FindCriticalTblInfo(CFE_TBL_CritRegRec_t **CritRegRecPtr, CFE_ES_CD
 */
 void CFE_TBL_UpdateCriticalTblCDS(CFE_TBL_RegistryRec_t *RegRecPtr);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Updates a single record of the Critical Table Registry in the CDS
+**
+** \par Description
+**        Copies only the given record of the Critical Table Registry into the
+**        CDS, rather than rewriting the entire registry.
+**
+** \par Assumptions, External Events, and Notes:
+**        The record must be an entry within #CFE_TBL_Global.CritReg
+**
+** \param[in]  CritRegRecPtr Pointer to Critical Table Registry Record that was modified.
+**
+** \return Execution status, see \ref CFEReturnCodes
+**
+*/
+int32 CFE_TBL_UpdateCritRegRecCDS(const CFE_TBL_CritRegRec_t *CritRegRecPtr);
+
 /*---------------------------------------------------------------------------------------*/
 /**
 ** \brief When enabled, will send a manage notification command message
@@ -532,6 +642,24 @@ void CFE_TBL_InitTableRegistryEntry(CFE_TBL_RegistryRec_t *RegRecPtr, size_t Siz
 CFE_Status_t CFE_TBL_RestoreTableDataFromCDS(CFE_TBL_RegistryRec_t *RegRecPtr, const char *AppName, const char *Name,
                                              CFE_TBL_CritRegRec_t *CritRegRecPtr);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Restore the contents of a table from a restored state snapshot (if it exists)
+**
+** \par Description
+**          This function restores the contents of the specified table from the state
+**          snapshot restored during this start, if the snapshot holds an image of a
+**          table with the same name and size.
+**
+** \par Assumptions, External Events, and Notes:
+**          Only called for tables that are not critical and own their buffers.
+**
+** \retval #CFE_SUCCESS                     \copydoc CFE_SUCCESS
+** \retval #CFE_TBL_INFO_RECOVERED_TBL      \copydoc CFE_TBL_INFO_RECOVERED_TBL
+**
+*/
+CFE_Status_t CFE_TBL_RestoreTableDataFromSnapshot(CFE_TBL_RegistryRec_t *RegRecPtr);
+
 /*---------------------------------------------------------------------------------------*/
 /**
 ** \brief Register a table with the Critical Table Registry
@@ -750,4 +878,9 @@ CFE_TBL_ValidationResult_t *CFE_TBL_CheckValidationRequest(CFE_TBL_ValidationRes
 */
 extern CFE_TBL_Global_t CFE_TBL_Global;
 
+/*
+** Hashed name index over CFE_TBL_Global.Registry
+*/
+extern const CFE_ResourceId_NameIndex_t CFE_TBL_RegistryNameIndex;
+
 #endif /* CFE_TBL_INTERNAL_H */
@@ -47,6 +47,7 @@
 #include "cfe_tbl_dispatch.h"
 #include "cfe_tbl_resource.h"
 #include "cfe_tbl_transaction.h"
+#include "cfe_tbl_decompress.h"
 
 /*
  * Additionally TBL needs to use special/extra CDS APIs that are not in the normal API
@@ -193,6 +193,7 @@ typedef struct
     bool                 LockFlag;    /**< \brief Indicates whether thread is currently accessing table data */
     bool                 Updated;     /**< \brief Indicates table has been updated since last GetAddress call */
     uint8                BufferIndex; /**< \brief Index of buffer currently being used */
+    uint8                ReadBuffer;  /**< \brief Buffer held via CFE_TBL_ReadAcquire, plus one (0 if none) */
 } CFE_TBL_AccessDescriptor_t;
 
 /*******************************************************************************/
@@ -227,9 +228,11 @@ typedef struct
     bool                 UserDefAddr;     /**< \brief Flag indicating Table address was defined by Owner Application */
     bool                 NotifyByMsg; /**< \brief Flag indicating Table Services should notify owning App via message
                                                   when table requires management */
-    uint8 ActiveBufferIndex;          /**< \brief Index identifying which buffer is the active buffer */
-    char  Name[CFE_TBL_MAX_FULL_NAME_LEN]; /**< \brief Processor specific table name */
-    char  LastFileLoaded[OS_MAX_PATH_LEN]; /**< \brief Filename of last file loaded into table */
+    uint8  ActiveBufferIndex;              /**< \brief Index identifying which buffer is the active buffer */
+    bool   CopyInProgress;                 /**< \brief Flag indicating a single buffered update is being copied */
+    uint32 Version;                        /**< \brief Incremented each time new table contents are activated */
+    char   Name[CFE_TBL_MAX_FULL_NAME_LEN]; /**< \brief Processor specific table name */
+    char   LastFileLoaded[OS_MAX_PATH_LEN]; /**< \brief Filename of last file loaded into table */
 } CFE_TBL_RegistryRec_t;
 
 /*******************************************************************************/
@@ -363,6 +366,8 @@ typedef struct
     */
     CFE_TBL_AccessDescriptor_t Handles[CFE_PLATFORM_TBL_MAX_NUM_HANDLES]; /**< \brief Array of Access Descriptors */
     CFE_TBL_RegistryRec_t      Registry[CFE_PLATFORM_TBL_MAX_NUM_TABLES]; /**< \brief Array of Table Registry Records */
+    uint32 RegistryNameIndex[CFE_RESOURCEID_NAMEINDEX_BUCKETS(
+        CFE_PLATFORM_TBL_MAX_NUM_TABLES)]; /**< \brief Hashed index of the names of owned Registry Records */
     CFE_TBL_CritRegRec_t
         CritReg[CFE_PLATFORM_TBL_MAX_CRITICAL_TABLES]; /**< \brief Array of Critical Table Registry Records */
     CFE_TBL_BufParams_t Buf; /**< \brief Parameters associated with Table Task's Memory Pool */
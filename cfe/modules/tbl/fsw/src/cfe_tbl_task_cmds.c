@@ -418,10 +418,9 @@ int32 CFE_TBL_LoadCmd(const CFE_TBL_LoadCmd_t *data)
 
                         if (Status == CFE_SUCCESS)
                         {
-                            /* Copy data from file into working buffer */
-                            OsStatus =
-                                OS_read(FileDescriptor, ((uint8 *)WorkingBufferPtr->BufferPtr) + TblFileHeader.Offset,
-                                        TblFileHeader.NumBytes);
+                            /* Copy data from file into working buffer, this also computes its CRC */
+                            OsStatus = CFE_TBL_ReadTableData(FileDescriptor, &TblFileHeader, WorkingBufferPtr,
+                                                             RegRecPtr->Size);
 
                             /* Make sure the appropriate number of bytes were read */
                             if ((long)OsStatus == TblFileHeader.NumBytes)
@@ -450,10 +449,6 @@ int32 CFE_TBL_LoadCmd(const CFE_TBL_LoadCmd_t *data)
                                     WorkingBufferPtr->FileTime.Seconds    = StdFileHeader.TimeSeconds;
                                     WorkingBufferPtr->FileTime.Subseconds = StdFileHeader.TimeSubSeconds;
 
-                                    /* Compute the CRC on the specified table buffer */
-                                    WorkingBufferPtr->Crc = CFE_ES_CalculateCRC(
-                                        WorkingBufferPtr->BufferPtr, RegRecPtr->Size, 0, CFE_MISSION_ES_DEFAULT_CRC);
-
                                     /* Initialize validation flag with true if no Validation Function is required to be
                                      * called */
                                     WorkingBufferPtr->Validated = (RegRecPtr->ValidationFuncPtr == NULL);
@@ -695,7 +690,7 @@ CFE_TBL_CmdProcRet_t CFE_TBL_DumpToFile(const char *DumpFilename, const char *Ta
             TblFileHeader.TableName[sizeof(TblFileHeader.TableName) - 1] = 0;
             TblFileHeader.Offset                                         = 0;
             TblFileHeader.NumBytes                                       = TblSizeInBytes;
-            TblFileHeader.Reserved                                       = 0;
+            TblFileHeader.Encoding                                       = CFE_TBL_FileEncoding_RAW;
 
             /* Determine if this is a little endian processor */
             if ((*(char *)&EndianCheck) == 0x04)
@@ -320,7 +320,8 @@ CFE_Status_t CFE_TBL_TxnRemoveAccessLink(CFE_TBL_TxnState_t *Txn)
     CFE_TBL_HandleListRemoveLink(RegRecPtr, AccessDescPtr);
 
     /* Return the Access Descriptor to the pool */
-    AccessDescPtr->UsedFlag = false;
+    AccessDescPtr->UsedFlag   = false;
+    AccessDescPtr->ReadBuffer = 0;
 
     /* If this was the last Access Descriptor for this table, we can free the memory buffers as well */
     if (!CFE_TBL_HandleLinkIsAttached(&RegRecPtr->AccessList))
@@ -450,27 +451,16 @@ CFE_Status_t CFE_TBL_TxnGetNextNotification(CFE_TBL_TxnState_t *Txn)
 CFE_Status_t CFE_TBL_TxnFindRegByName(CFE_TBL_TxnState_t *Txn, const char *TblName)
 {
     CFE_Status_t Status = CFE_TBL_ERR_INVALID_NAME;
-    int16        i      = 0;
+    uint32       Idx;
 
-    while (i < CFE_PLATFORM_TBL_MAX_NUM_TABLES)
+    /* Perform a case sensitive name lookup using the registry name index */
+    if (CFE_ResourceId_NameIndexFind(&CFE_TBL_RegistryNameIndex, TblName, &Idx) == CFE_SUCCESS)
     {
-        /* Check to see if the record is currently being used */
-        if (!CFE_RESOURCEID_TEST_EQUAL(CFE_TBL_Global.Registry[i].OwnerAppId, CFE_TBL_NOT_OWNED))
-        {
-            /* Perform a case sensitive name comparison */
-            if (strcmp(TblName, CFE_TBL_Global.Registry[i].Name) == 0)
-            {
-                /* If the names match, then return the index */
-                Txn->RegId     = i;
-                Txn->RegRecPtr = &CFE_TBL_Global.Registry[i];
+        /* If the names match, then return the index */
+        Txn->RegId     = Idx;
+        Txn->RegRecPtr = &CFE_TBL_Global.Registry[Idx];
 
-                Status = CFE_SUCCESS;
-                break;
-            }
-        }
-
-        /* Point to next record in the Table Registry */
-        i++;
+        Status = CFE_SUCCESS;
     }
 
     return Status;
@@ -612,17 +602,19 @@ void CFE_TBL_TxnConnectAccessDescriptor(CFE_TBL_TxnState_t *Txn)
     CFE_TBL_AccessDescriptor_t *AccessDescPtr = CFE_TBL_TxnAccDesc(Txn);
     CFE_TBL_RegistryRec_t *     RegRecPtr     = CFE_TBL_TxnRegRec(Txn);
 
-    AccessDescPtr->AppId    = CFE_TBL_TxnAppId(Txn);
-    AccessDescPtr->LockFlag = false;
-    AccessDescPtr->Updated  = false;
-    AccessDescPtr->UsedFlag = true;
-    AccessDescPtr->RegIndex = CFE_TBL_TxnRegId(Txn);
+    AccessDescPtr->AppId      = CFE_TBL_TxnAppId(Txn);
+    AccessDescPtr->LockFlag   = false;
+    AccessDescPtr->ReadBuffer = 0;
+    AccessDescPtr->Updated    = false;
+    AccessDescPtr->UsedFlag   = true;
+    AccessDescPtr->RegIndex   = CFE_TBL_TxnRegId(Txn);
 
     if ((RegRecPtr->DumpOnly) && (!RegRecPtr->UserDefAddr))
     {
         /* Dump Only Tables are assumed to be loaded at all times unless the address is specified */
         /* by the application. In that case, it isn't loaded until the address is specified       */
         RegRecPtr->TableLoadedOnce = true;
+        CFE_TBL_AdvanceVersion(RegRecPtr);
     }
 
     CFE_TBL_HandleListInsertLink(RegRecPtr, AccessDescPtr);
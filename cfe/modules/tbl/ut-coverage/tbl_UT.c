@@ -103,6 +103,7 @@ CFE_TBL_RegistryRec_t Original[CFE_PLATFORM_TBL_MAX_NUM_TABLES];
  */
 void UT_TBL_SetupHeader(CFE_TBL_File_Hdr_t *TblFileHeader, size_t Offset, size_t NumBytes)
 {
+    TblFileHeader->Encoding = CFE_TBL_FileEncoding_RAW;
     TblFileHeader->Offset   = Offset;
     TblFileHeader->NumBytes = NumBytes;
 
@@ -255,6 +256,7 @@ void UtTest_Setup(void)
     UT_ADD_TEST(Test_CFE_TBL_Manage);
     UT_ADD_TEST(Test_CFE_TBL_DumpToBuffer);
     UT_ADD_TEST(Test_CFE_TBL_Update);
+    UT_ADD_TEST(Test_CFE_TBL_ReadAcquire);
     UT_ADD_TEST(Test_CFE_TBL_GetStatus);
     UT_ADD_TEST(Test_CFE_TBL_GetInfo);
     UT_ADD_TEST(Test_CFE_TBL_TblMod);
@@ -1509,13 +1511,16 @@ void Test_CFE_TBL_ApiInit(void)
 */
 void Test_CFE_TBL_Register(void)
 {
-    CFE_TBL_Handle_t            TblHandle1;
-    CFE_TBL_Handle_t            TblHandle2;
-    CFE_TBL_Handle_t            TblHandle3;
-    char                        TblName[CFE_MISSION_TBL_MAX_NAME_LENGTH + 2];
-    int16                       i;
-    CFE_TBL_AccessDescriptor_t *AccessDescPtr;
-    CFE_TBL_RegistryRec_t *     RegRecPtr;
+    CFE_TBL_Handle_t             TblHandle1;
+    CFE_TBL_Handle_t             TblHandle2;
+    CFE_TBL_Handle_t             TblHandle3;
+    char                         TblName[CFE_MISSION_TBL_MAX_NAME_LENGTH + 2];
+    int16                        i;
+    CFE_TBL_AccessDescriptor_t * AccessDescPtr;
+    CFE_TBL_RegistryRec_t *      RegRecPtr;
+    CFE_ES_SnapshotTableHeader_t SnapshotHeader;
+    UT_Table1_t                  SnapshotData;
+    const void *                 SnapshotDataPtr;
 
     UtPrintf("Begin Test Register");
 
@@ -1774,6 +1779,40 @@ void Test_CFE_TBL_Register(void)
     CFE_UtAssert_SUCCESS(CFE_TBL_Unregister(TblHandle1));
     CFE_UtAssert_EVENTCOUNT(0);
 
+    /* Test registering a table whose contents are in a restored state snapshot */
+    /* a. Perform test */
+    UT_InitData();
+    SnapshotData.TblElement1 = 0x12345678;
+    SnapshotData.TblElement2 = 0x9ABCDEF0;
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_RestoreSnapshotTable), CFE_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(CFE_ES_RestoreSnapshotTable), &SnapshotData, sizeof(SnapshotData), false);
+    UtAssert_INT32_EQ(CFE_TBL_Register(&TblHandle1, "UT_Table1", sizeof(UT_Table1_t), CFE_TBL_OPT_DEFAULT, NULL),
+                      CFE_TBL_INFO_RECOVERED_TBL);
+    CFE_UtAssert_EVENTCOUNT(0);
+    AccessDescPtr = &CFE_TBL_Global.Handles[TblHandle1];
+    RegRecPtr     = &CFE_TBL_Global.Registry[AccessDescPtr->RegIndex];
+    UtAssert_BOOL_TRUE(RegRecPtr->TableLoadedOnce);
+    UtAssert_BOOL_TRUE(AccessDescPtr->Updated);
+    UtAssert_MemCmp(RegRecPtr->Buffers[0].BufferPtr, &SnapshotData, sizeof(SnapshotData), "Restored table contents");
+
+    /* b. The loaded table is part of the next snapshot */
+    UtAssert_BOOL_FALSE(CFE_TBL_SnapshotTableGetter(AccessDescPtr->RegIndex, &SnapshotHeader, &SnapshotDataPtr));
+    UtAssert_ADDRESS_EQ(SnapshotDataPtr, RegRecPtr->Buffers[0].BufferPtr);
+    UtAssert_STRINGBUF_EQ(SnapshotHeader.Name, sizeof(SnapshotHeader.Name), RegRecPtr->Name, sizeof(RegRecPtr->Name));
+    UtAssert_UINT32_EQ(SnapshotHeader.Size, sizeof(UT_Table1_t));
+
+    /* c. Entries without a loaded table are skipped, and the last entry ends the snapshot */
+    UtAssert_BOOL_TRUE(
+        CFE_TBL_SnapshotTableGetter(CFE_PLATFORM_TBL_MAX_NUM_TABLES - 1, &SnapshotHeader, &SnapshotDataPtr));
+    UtAssert_NULL(SnapshotDataPtr);
+    UtAssert_BOOL_TRUE(CFE_TBL_SnapshotTableGetter(CFE_PLATFORM_TBL_MAX_NUM_TABLES, &SnapshotHeader, &SnapshotDataPtr));
+    UtAssert_NULL(SnapshotDataPtr);
+
+    /* d. Test cleanup: unregister table */
+    UT_ClearEventHistory();
+    CFE_UtAssert_SUCCESS(CFE_TBL_Unregister(TblHandle1));
+    CFE_UtAssert_EVENTCOUNT(0);
+
     /* Test registering a critical table that already has an allocated CDS
      * and recovery fails
      */
@@ -3026,6 +3065,131 @@ void Test_CFE_TBL_Update(void)
     CFE_UtAssert_EVENTCOUNT(1);
 }
 
+/*
+** Test function that reads table contents through the lock-free versioned API
+*/
+void Test_CFE_TBL_ReadAcquire(void)
+{
+    CFE_TBL_Handle_t            TblHandle;
+    CFE_TBL_Handle_t            TblHandle2;
+    CFE_TBL_AccessDescriptor_t *AccessDescPtr;
+    CFE_TBL_RegistryRec_t *     RegRecPtr;
+    UT_Table1_t                 TestTable1;
+    void *                      ReadPtr;
+    void *                      HeldPtr;
+    uint32                      Version;
+    uint32                      FirstVersion;
+
+    UtPrintf("Begin Test Read Acquire");
+
+    memset(&TestTable1, 0, sizeof(TestTable1));
+
+    /* Test response to null output pointers */
+    UT_InitData();
+    UtAssert_INT32_EQ(CFE_TBL_ReadAcquire(NULL, &Version, App1TblHandle1), CFE_TBL_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_TBL_ReadAcquire(&ReadPtr, NULL, App1TblHandle1), CFE_TBL_BAD_ARGUMENT);
+
+    /* Test response to a bad app ID */
+    UT_InitData();
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppID), 1, CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_INT32_EQ(CFE_TBL_ReadAcquire(&ReadPtr, &Version, App1TblHandle1), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_NULL(ReadPtr);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppID), 1, CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_INT32_EQ(CFE_TBL_ReadRelease(App1TblHandle1), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+
+    /* Test response to an invalid handle */
+    UT_InitData();
+    UT_SetAppID(UT_TBL_APPID_1);
+    UtAssert_INT32_EQ(CFE_TBL_ReadAcquire(&ReadPtr, &Version, CFE_TBL_BAD_TABLE_HANDLE), CFE_TBL_ERR_INVALID_HANDLE);
+    UtAssert_INT32_EQ(CFE_TBL_ReadRelease(CFE_TBL_BAD_TABLE_HANDLE), CFE_TBL_ERR_INVALID_HANDLE);
+
+    /* Test response to a handle that belongs to another application */
+    UT_InitData();
+    UT_SetAppID(UT_TBL_APPID_2);
+    UtAssert_INT32_EQ(CFE_TBL_ReadAcquire(&ReadPtr, &Version, App1TblHandle1), CFE_TBL_ERR_NO_ACCESS);
+    UtAssert_INT32_EQ(CFE_TBL_ReadRelease(App1TblHandle1), CFE_TBL_ERR_NO_ACCESS);
+
+    /* Test setup - register a double buffered table */
+    UT_InitData();
+    UT_SetAppID(UT_TBL_APPID_1);
+    CFE_UtAssert_SUCCESS(
+        CFE_TBL_Register(&TblHandle, "UT_ReadTbl", sizeof(UT_Table1_t), CFE_TBL_OPT_DBL_BUFFER, NULL));
+    AccessDescPtr = &CFE_TBL_Global.Handles[TblHandle];
+    RegRecPtr     = &CFE_TBL_Global.Registry[AccessDescPtr->RegIndex];
+
+    /* Test reading a table that has never been loaded leaves no hazard behind */
+    UtAssert_INT32_EQ(CFE_TBL_ReadAcquire(&ReadPtr, &Version, TblHandle), CFE_TBL_ERR_NEVER_LOADED);
+    UtAssert_NULL(ReadPtr);
+    UtAssert_UINT32_EQ(Version, 0);
+    UtAssert_UINT8_EQ(AccessDescPtr->ReadBuffer, 0);
+
+    /* Test that a load advances the version, with the update done under the registry lock */
+    UT_InitData();
+    CFE_UtAssert_SUCCESS(CFE_TBL_Load(TblHandle, CFE_TBL_SRC_ADDRESS, &TestTable1));
+    UtAssert_STUB_COUNT(OS_MutSemTake, 2);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 2);
+    CFE_UtAssert_SUCCESS(CFE_TBL_ReadAcquire(&HeldPtr, &FirstVersion, TblHandle));
+    UtAssert_NONZERO(FirstVersion);
+
+    /* Test that a double buffered update proceeds while a reader holds the active buffer */
+    UT_InitData();
+    CFE_UtAssert_SUCCESS(CFE_TBL_Load(TblHandle, CFE_TBL_SRC_ADDRESS, &TestTable1));
+    UtAssert_STUB_COUNT(OS_MutSemTake, 2);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 2);
+    CFE_UtAssert_SUCCESS(CFE_TBL_ReadAcquire(&ReadPtr, &Version, TblHandle));
+    UtAssert_True(Version != FirstVersion, "Version changed after update (%lu != %lu)", (unsigned long)Version,
+                  (unsigned long)FirstVersion);
+    UtAssert_True(ReadPtr != HeldPtr, "Update switched to the other buffer");
+
+    /* Test that the buffer still pinned by a reader is not reused for the next load */
+    UT_InitData();
+    AccessDescPtr->ReadBuffer = (uint8)(2 - RegRecPtr->ActiveBufferIndex);
+    UtAssert_INT32_EQ(CFE_TBL_Load(TblHandle, CFE_TBL_SRC_ADDRESS, &TestTable1), CFE_TBL_ERR_NO_BUFFER_AVAIL);
+    CFE_UtAssert_SUCCESS(CFE_TBL_ReadRelease(TblHandle));
+    CFE_UtAssert_SUCCESS(CFE_TBL_Load(TblHandle, CFE_TBL_SRC_ADDRESS, &TestTable1));
+
+    /* Test setup - register and load a single buffered table */
+    UT_InitData();
+    CFE_UtAssert_SUCCESS(CFE_TBL_Register(&TblHandle2, "UT_ReadTbl2", sizeof(UT_Table1_t), CFE_TBL_OPT_DEFAULT, NULL));
+    CFE_UtAssert_SUCCESS(CFE_TBL_Load(TblHandle2, CFE_TBL_SRC_ADDRESS, &TestTable1));
+    AccessDescPtr = &CFE_TBL_Global.Handles[TblHandle2];
+    RegRecPtr     = &CFE_TBL_Global.Registry[AccessDescPtr->RegIndex];
+
+    /* Test reading while a single buffered update is copying into the buffer */
+    UT_InitData();
+    RegRecPtr->CopyInProgress = true;
+    CFE_UtAssert_SUCCESS(CFE_TBL_ReadAcquire(&ReadPtr, &Version, TblHandle2));
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_UINT8_EQ(AccessDescPtr->ReadBuffer, 1);
+    RegRecPtr->CopyInProgress = false;
+
+    /* Test that a single buffered update is refused while a reader holds the table */
+    UT_InitData();
+    RegRecPtr->LoadPending    = true;
+    RegRecPtr->LoadInProgress = 0;
+    UtAssert_INT32_EQ(CFE_TBL_UpdateInternal(TblHandle2, RegRecPtr, AccessDescPtr), CFE_TBL_INFO_TABLE_LOCKED);
+    UtAssert_BOOL_FALSE(RegRecPtr->CopyInProgress);
+    CFE_UtAssert_SUCCESS(CFE_TBL_ReadRelease(TblHandle2));
+    RegRecPtr->LoadPending    = false;
+    RegRecPtr->LoadInProgress = CFE_TBL_NO_LOAD_IN_PROGRESS;
+
+    /* Test reading a table whose owner has unregistered it */
+    UT_InitData();
+    RegRecPtr->OwnerAppId = CFE_TBL_NOT_OWNED;
+    UtAssert_INT32_EQ(CFE_TBL_ReadAcquire(&ReadPtr, &Version, TblHandle2), CFE_TBL_ERR_UNREGISTERED);
+    RegRecPtr->OwnerAppId = UT_TBL_APPID_1;
+
+    /* Test version wraparound skips zero */
+    RegRecPtr->Version = 0xFFFFFFFF;
+    CFE_TBL_AdvanceVersion(RegRecPtr);
+    UtAssert_UINT32_EQ(RegRecPtr->Version, 1);
+
+    /* Clean up */
+    UT_InitData();
+    CFE_UtAssert_SUCCESS(CFE_TBL_Unregister(TblHandle));
+    CFE_UtAssert_SUCCESS(CFE_TBL_Unregister(TblHandle2));
+}
+
 /*
 ** Test function that obtains the pending action status for specified table
 */
@@ -3271,6 +3435,8 @@ void Test_CFE_TBL_Internal(void)
     CFE_TBL_File_Hdr_t          TblFileHeader;
     osal_id_t                   FileDescriptor;
     void *                      TblPtr;
+    uint8                       FileData[sizeof(CFE_TBL_File_Hdr_t) + 8];
+    static const uint8          Lz4Data[] = {0x20, 'A', 'B', 0x02, 0x00, 0x20, 'A', 'B'};
 
     UtPrintf("Begin Test Internal");
 
@@ -3453,6 +3619,64 @@ void Test_CFE_TBL_Internal(void)
     UtAssert_INT32_EQ(CFE_TBL_LoadFromFile("UT", WorkingBufferPtr, RegRecPtr, Filename), CFE_TBL_WARN_SHORT_FILE);
     CFE_UtAssert_EVENTCOUNT(0);
 
+    /* Test CFE_TBL_LoadFromFile with LZ4 compressed table data; two literals
+     * followed by a match that repeats them, then two trailing literals
+     */
+    UT_InitData();
+    StdFileHeader.ContentType = CFE_FS_FILE_CONTENT_ID;
+    StdFileHeader.SubType     = CFE_FS_SubType_TBL_IMG;
+    strncpy(TblFileHeader.TableName, "ut_cfe_tbl.UT_Table2", sizeof(TblFileHeader.TableName) - 1);
+    TblFileHeader.TableName[sizeof(TblFileHeader.TableName) - 1] = '\0';
+    UT_TBL_SetupHeader(&TblFileHeader, 0, sizeof(UT_Table1_t));
+    TblFileHeader.Encoding = CFE_TBL_FileEncoding_LZ4;
+    if (UT_Endianess == UT_LITTLE_ENDIAN)
+    {
+        CFE_TBL_ByteSwapUint32(&TblFileHeader.Encoding);
+    }
+
+    memcpy(FileData, &TblFileHeader, sizeof(TblFileHeader));
+    memcpy(&FileData[sizeof(TblFileHeader)], Lz4Data, sizeof(Lz4Data));
+    memset(WorkingBufferPtr->BufferPtr, 0, sizeof(UT_Table1_t));
+    UT_SetReadBuffer(FileData, sizeof(TblFileHeader) + sizeof(Lz4Data));
+    UT_SetReadHeader(&StdFileHeader, sizeof(StdFileHeader));
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 3, 0);
+    CFE_UtAssert_SUCCESS(CFE_TBL_LoadFromFile("UT", WorkingBufferPtr, RegRecPtr, Filename));
+    UtAssert_MemCmp(WorkingBufferPtr->BufferPtr, "ABABABAB", sizeof(UT_Table1_t), "Decompressed table data");
+    CFE_UtAssert_EVENTCOUNT(0);
+
+    /* Test CFE_TBL_LoadFromFile response to truncated LZ4 compressed table data */
+    UT_InitData();
+    UT_SetReadBuffer(FileData, sizeof(TblFileHeader) + sizeof(Lz4Data) - 2);
+    UT_SetReadHeader(&StdFileHeader, sizeof(StdFileHeader));
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 3, 0);
+    UtAssert_INT32_EQ(CFE_TBL_LoadFromFile("UT", WorkingBufferPtr, RegRecPtr, Filename), CFE_TBL_ERR_LOAD_INCOMPLETE);
+    CFE_UtAssert_EVENTSENT(CFE_TBL_FILE_INCOMPLETE_ERR_EID);
+    CFE_UtAssert_EVENTCOUNT(1);
+
+    /* Test CFE_TBL_LoadFromFile response to an LZ4 back reference before the start of the table */
+    UT_InitData();
+    FileData[sizeof(TblFileHeader) + 3] = 3;
+    UT_SetReadBuffer(FileData, sizeof(TblFileHeader) + sizeof(Lz4Data));
+    UT_SetReadHeader(&StdFileHeader, sizeof(StdFileHeader));
+    UtAssert_INT32_EQ(CFE_TBL_LoadFromFile("UT", WorkingBufferPtr, RegRecPtr, Filename), CFE_TBL_ERR_LOAD_INCOMPLETE);
+    CFE_UtAssert_EVENTSENT(CFE_TBL_FILE_INCOMPLETE_ERR_EID);
+    CFE_UtAssert_EVENTCOUNT(1);
+
+    /* Test CFE_TBL_LoadFromFile response to an unknown table data encoding */
+    UT_InitData();
+    UT_TBL_SetupHeader(&TblFileHeader, 0, sizeof(UT_Table1_t));
+    TblFileHeader.Encoding = CFE_TBL_FileEncoding_LZ4 + 1;
+    if (UT_Endianess == UT_LITTLE_ENDIAN)
+    {
+        CFE_TBL_ByteSwapUint32(&TblFileHeader.Encoding);
+    }
+
+    UT_SetReadBuffer(&TblFileHeader, sizeof(TblFileHeader));
+    UT_SetReadHeader(&StdFileHeader, sizeof(StdFileHeader));
+    UtAssert_INT32_EQ(CFE_TBL_LoadFromFile("UT", WorkingBufferPtr, RegRecPtr, Filename), CFE_TBL_ERR_BAD_ENCODING);
+    CFE_UtAssert_EVENTSENT(CFE_TBL_FILE_ENCODING_ERR_EID);
+    CFE_UtAssert_EVENTCOUNT(1);
+
     /* Test CFE_TBL_ReadHeaders response to a failure reading the standard cFE
      * file header
      */
@@ -3740,7 +3964,7 @@ void Test_CFE_TBL_Internal(void)
     UT_SetReadBuffer(&TblFileHeader, sizeof(TblFileHeader));
     UT_SetReadHeader(&StdFileHeader, sizeof(StdFileHeader));
     UT_SetDeferredRetcode(UT_KEY(OS_read), 3, 0);
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CopyToCDS), 2, CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CopyRangesToCDS), 1, CFE_ES_ERR_RESOURCEID_NOT_VALID);
     CFE_UtAssert_SUCCESS(CFE_TBL_Load(App1TblHandle2, CFE_TBL_SRC_FILE, "TblSrcFileName.dat"));
     CFE_UtAssert_EVENTSENT(CFE_TBL_LOAD_SUCCESS_INF_EID);
     CFE_UtAssert_EVENTCOUNT(1);
@@ -3769,7 +3993,7 @@ void Test_CFE_TBL_Internal(void)
     UT_SetReadBuffer(&TblFileHeader, sizeof(TblFileHeader));
     UT_SetReadHeader(&StdFileHeader, sizeof(StdFileHeader));
     UT_SetDeferredRetcode(UT_KEY(OS_read), 3, 0);
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CopyToCDS), 2, CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CopyRangesToCDS), 1, CFE_ES_ERR_RESOURCEID_NOT_VALID);
     AccessDescPtr = &CFE_TBL_Global.Handles[App1TblHandle2];
     RegRecPtr     = &CFE_TBL_Global.Registry[AccessDescPtr->RegIndex];
 
@@ -3826,7 +4050,7 @@ void Test_CFE_TBL_Internal(void)
     UT_SetReadBuffer(&TblFileHeader, sizeof(TblFileHeader));
     UT_SetReadHeader(&StdFileHeader, sizeof(StdFileHeader));
     UT_SetDeferredRetcode(UT_KEY(OS_read), 3, 0);
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CopyToCDS), 2, CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CopyRangesToCDS), 1, CFE_ES_ERR_RESOURCEID_NOT_VALID);
     UtAssert_INT32_EQ(CFE_TBL_Load(App1TblHandle2, CFE_TBL_SRC_FILE, "TblSrcFileName.dat"), CFE_TBL_ERR_INVALID_HANDLE);
     CFE_UtAssert_EVENTSENT(CFE_TBL_HANDLE_ACCESS_ERR_EID);
     CFE_UtAssert_EVENTCOUNT(1);
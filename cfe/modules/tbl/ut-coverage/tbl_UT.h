@@ -595,6 +595,24 @@ void Test_CFE_TBL_DumpToBuffer(void);
 ******************************************************************************/
 void Test_CFE_TBL_Update(void);
 
+/*****************************************************************************/
+/**
+** \brief Test function that reads table contents through the lock-free
+**        versioned API
+**
+** \par Description
+**        This function tests the functions that acquire and release table
+**        addresses without taking the registry lock, and the interaction of
+**        the published read buffer with table updates.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_CFE_TBL_ReadAcquire(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test function that obtains the pending action status for specified
@@ -240,4 +240,19 @@
 #define CFE_PLATFORM_TIME_TONE_TASK_STACK_SIZE  4096
 #define CFE_PLATFORM_TIME_ONEHZ_TASK_STACK_SIZE 8192
 
+/**
+**  \cfetimecfg Define TIME Child Task CPU Affinity
+**
+**  \par Description:
+**       Restricts the cFE_TIME Tone and 1HZ tasks to the CPUs set in this mask,
+**       where bit 0 is CPU 0.  Used with the OSAL_CONFIG_TIMEBASE_CPU_MASK option,
+**       this keeps the time critical threads together on a reserved CPU, away
+**       from the application tasks.  Has no effect on platforms without CPU
+**       affinity support.
+**
+**  \par Limits
+**       Zero leaves the tasks free to run on any CPU.
+*/
+#define CFE_PLATFORM_TIME_CHILD_TASK_CPU_MASK 0
+
 #endif
@@ -171,6 +171,23 @@ int32 CFE_TIME_TaskInit(void)
         return Status;
     }
 
+    /*
+    ** Optionally isolate the child tasks on a reserved CPU.  Time keeping
+    ** still works without it, so a failure here is only logged.
+    */
+    if (CFE_PLATFORM_TIME_CHILD_TASK_CPU_MASK != 0)
+    {
+        Status = CFE_ES_SetTaskAffinity(CFE_TIME_Global.ToneTaskID, CFE_PLATFORM_TIME_CHILD_TASK_CPU_MASK);
+        if (Status == CFE_SUCCESS)
+        {
+            Status = CFE_ES_SetTaskAffinity(CFE_TIME_Global.LocalTaskID, CFE_PLATFORM_TIME_CHILD_TASK_CPU_MASK);
+        }
+        if (Status != CFE_SUCCESS)
+        {
+            CFE_ES_WriteToSysLog("%s: Cannot set child task CPU affinity:RC=0x%08X\n", __func__, (unsigned int)Status);
+        }
+    }
+
     Status = CFE_SB_CreatePipe(&CFE_TIME_Global.CmdPipe, CFE_TIME_TASK_PIPE_DEPTH, CFE_TIME_TASK_PIPE_NAME);
     if (Status != CFE_SUCCESS)
     {
@@ -206,6 +206,47 @@ set(OSAL_CONFIG_CONSOLE_ASYNC                   TRUE
     CACHE BOOL "Controls spawning of a separate utility task for OS_printf"
 )
 
+#
+# OSAL_CONFIG_IDMAP_LOCKFREE_REFCOUNT
+# ----------------------------------
+#
+# Controls whether object lookups that only need a reference count
+# (e.g. OS_read, OS_write, OS_SocketSendTo) take the global table lock.
+#
+# If set FALSE, every such lookup and release takes the per-type global
+# table lock, as is done for all other lock modes.
+#
+# If set TRUE (default), the ID is validated and the reference count is
+# adjusted using atomic operations, and the global table lock is only
+# taken when the object is being created or deleted at the same time.
+# This requires a compiler that supports the GCC "__atomic" builtins.
+#
+set(OSAL_CONFIG_IDMAP_LOCKFREE_REFCOUNT         TRUE
+    CACHE BOOL "Use atomic operations for refcount object lookups"
+)
+
+#
+# OSAL_CONFIG_TIMEBASE_TIMERFD
+# ----------------------------------
+#
+# Selects how the POSIX implementation generates a simulated time base tick.
+# Only applicable to Linux.
+#
+# If set FALSE (default), each time base uses a POSIX timer which delivers
+# an RT signal, and the handler thread waits for the signal with sigwait().
+#
+# If set TRUE, each time base uses a timerfd, and the handler thread reads
+# the file descriptor directly.  This avoids signal delivery, which can add
+# hundreds of microseconds of jitter on a loaded host, and does not consume
+# RT signals.
+#
+# In both cases the timer uses an absolute CLOCK_MONOTONIC schedule, and the
+# tick servicing jitter and overruns are reported by OS_TimeBaseGetInfo().
+#
+set(OSAL_CONFIG_TIMEBASE_TIMERFD                FALSE
+    CACHE BOOL "Use timerfd rather than RT signals for POSIX time bases"
+)
+
 #############################################
 # Resource Limits for the OS API
 #############################################
@@ -313,6 +354,18 @@ set(OSAL_CONFIG_PRINTF_BUFFER_DEPTH     100
     CACHE STRING "Maximum Number of printf messages to buffer"
 )
 
+# What OS_printf() does when the console buffer is full
+#
+# If zero (default), the message is dropped and the console overflow
+# counter is incremented.
+#
+# If nonzero, the caller waits up to this many milliseconds for the
+# console utility task to make room, before dropping the message.
+# Only applicable when OSAL_CONFIG_CONSOLE_ASYNC is enabled.
+set(OSAL_CONFIG_PRINTF_OVERFLOW_TIMEOUT 0
+    CACHE STRING "Milliseconds OS_printf waits for console buffer space"
+)
+
 # Priority level of a console output helper task
 #
 # Set logically low (high number) to maximize performance.
@@ -348,6 +401,18 @@ set(OSAL_CONFIG_QUEUE_MAX_DEPTH         50
     CACHE STRING "Maximum depth of message queue"
 )
 
+# CPU affinity of the time base handler threads
+#
+# If nonzero, each time base handler thread is restricted to the CPUs
+# set in this mask (bit 0 = CPU 0).  This allows the time base threads to
+# be isolated on a reserved core, away from the application tasks.
+# Only effective where the OS supports CPU affinity (e.g. Linux).
+#
+# Set to 0 to leave the threads unrestricted
+set(OSAL_CONFIG_TIMEBASE_CPU_MASK           0
+    CACHE STRING "CPU affinity mask for time base threads"
+)
+
 # Flags added to all tasks on creation
 #
 # Some OS's use floating point under the hood, this supports
@@ -109,6 +109,49 @@ typedef enum
     OS_FILE_FLAG_TRUNCATE = 0x02
 } OS_file_flag_t;
 
+/**
+ * @brief Asynchronous I/O request block, see struct OS_AsyncIo
+ */
+typedef struct OS_AsyncIo OS_AsyncIo_t;
+
+/**
+ * @brief Asynchronous I/O completion callback
+ *
+ * Invoked by OSAL once the request has finished, from the internal context
+ * that processes completions.  The callback should be brief and must not
+ * block or resubmit the same request object.
+ *
+ * @param req   The request that has completed
+ */
+typedef void (*OS_AsyncIoCallback_t)(OS_AsyncIo_t *req);
+
+/**
+ * @brief Asynchronous I/O request block
+ *
+ * The request block is owned by the caller and must remain valid (and the
+ * data buffer must remain unmodified) until the request is no longer pending.
+ * The caller may set Callback/CallbackArg prior to submitting the request;
+ * all other members are set by OSAL.
+ */
+struct OS_AsyncIo
+{
+    OS_AsyncIoCallback_t Callback;    /**< Optional completion callback, may be NULL */
+    void *               CallbackArg; /**< Opaque user argument for the callback */
+    int32                Result;      /**< Byte count on success or OSAL error code, valid when not pending */
+    volatile bool        IsPending;   /**< True from submission until the request is complete */
+
+    /*
+     * The following members are for internal use by OSAL and
+     * must not be modified by the caller.
+     */
+    const void *       Buffer;
+    size_t             Size;
+    size_t             Done;
+    int64              Offset;
+    int32              Handle;
+    OS_AsyncIo_t *     Next;
+};
+
 /*
  * Exported Functions
  */
@@ -360,6 +403,57 @@ int32 OS_TimedWriteAbs(osal_id_t filedes, const void *buffer, size_t nbytes, OS_
  */
 int32 OS_TimedWrite(osal_id_t filedes, const void *buffer, size_t nbytes, int32 timeout);
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Submit an asynchronous write to a file
+ *
+ * Queues the write and returns without waiting for the data to reach the file.
+ * The file region for the write is reserved at submission time, so successive
+ * requests on the same file land in submission order regardless of the order
+ * in which they complete, and a synchronous write issued after submission
+ * lands after the reserved region.
+ *
+ * Completion is reported by clearing req->IsPending and setting req->Result,
+ * after invoking req->Callback if one is set.  The caller may also poll or
+ * wait for completion with OS_AsyncWait().
+ *
+ * The caller must wait for all outstanding requests on a file before closing it.
+ *
+ * @param[in]     filedes   The handle ID to operate on
+ * @param[in]     buffer    Source location for file data, must remain valid until completion @nonnull
+ * @param[in]     nbytes    Number of bytes to write @nonzero
+ * @param[in,out] req       Caller-owned request block @nonnull
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if the file descriptor passed in is invalid
+ * @retval #OS_ERR_INVALID_SIZE if the passed-in size is not valid
+ * @retval #OS_INVALID_POINTER if the passed-in buffer or request is not valid
+ * @retval #OS_ERR_INCORRECT_OBJ_STATE if the request block is already pending
+ * @retval #OS_ERR_NOT_IMPLEMENTED if asynchronous I/O is not supported on this platform
+ * @retval #OS_ERROR if the request could not be queued
+ */
+int32 OS_AsyncWrite(osal_id_t filedes, const void *buffer, size_t nbytes, OS_AsyncIo_t *req);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Wait for an asynchronous request to complete
+ *
+ * Returns immediately if the request is not pending, including a request
+ * block that was never submitted.  Once this returns #OS_SUCCESS the
+ * outcome of the request is available in req->Result.
+ *
+ * @param[in] req      Request block previously passed to OS_AsyncWrite() @nonnull
+ * @param[in] timeout  Maximum time to wait, in milliseconds (OS_PEND = forever, OS_CHECK = poll)
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if the request is not valid
+ * @retval #OS_ERROR_TIMEOUT if the request is still pending after the timeout
+ * @retval #OS_ERR_NOT_IMPLEMENTED if asynchronous I/O is not supported on this platform
+ */
+int32 OS_AsyncWait(OS_AsyncIo_t *req, int32 timeout);
+
 /*-------------------------------------------------------------------------------------*/
 /**
  * @brief Changes the permissions of a file
@@ -27,6 +27,7 @@
 
 #include "osconfig.h"
 #include "common_types.h"
+#include "osapi-clock.h" /* required for OS_time_t definition */
 
 /** @brief Upper limit for OSAL task priorities */
 #define OS_MAX_TASK_PRIORITY 255
@@ -181,6 +182,29 @@ int32 OS_TaskDelay(uint32 millisecond);
  */
 int32 OS_TaskSetPriority(osal_id_t task_id, osal_priority_t new_priority);
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Restricts the given task to a set of CPUs
+ *
+ * Each bit in the mask corresponds to a CPU, with bit 0 being CPU 0.  The
+ * task will only be scheduled on CPUs whose bit is set.
+ *
+ * @note CPU affinity is not supported by all implementations.  Where it is
+ * not available this returns OS_ERR_NOT_IMPLEMENTED and the task is left
+ * unchanged, which callers may treat as a successful no-op.
+ *
+ * @param[in] task_id        The object ID to operate on
+ * @param[in] cpu_mask       The set of CPUs the task may run on, must not be zero
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if the ID passed to it is invalid
+ * @retval #OS_ERR_INVALID_ARGUMENT if the mask is zero
+ * @retval #OS_ERR_NOT_IMPLEMENTED if CPU affinity is not supported
+ * @retval #OS_ERROR if the mask does not contain any usable CPU, or an unspecified/other error occurs @covtest
+ */
+int32 OS_TaskSetAffinity(osal_id_t task_id, uint32 cpu_mask);
+
 /*-------------------------------------------------------------------------------------*/
 /**
  * @brief Obtain the task id of the calling task
@@ -226,6 +250,30 @@ int32 OS_TaskGetIdByName(osal_id_t *task_id, const char *task_name);
  */
 int32 OS_TaskGetInfo(osal_id_t task_id, OS_task_prop_t *task_prop);
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Obtain the processor time consumed by a task
+ *
+ * Outputs the total processor time that has been charged to the given task
+ * since it was created.  The task does not need to be the caller, so one
+ * task may sample the usage of all others.  Only the difference between two
+ * samples of the same task is meaningful.
+ *
+ * @note Per-task processor time is not kept by all implementations.  Where it
+ * is not available this returns OS_ERR_NOT_IMPLEMENTED.
+ *
+ * @param[in]   task_id  The object ID to operate on
+ * @param[out]  cpu_time Buffer to store the processor time @nonnull
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if the ID passed to it is invalid
+ * @retval #OS_INVALID_POINTER if the cpu_time pointer is NULL
+ * @retval #OS_ERR_NOT_IMPLEMENTED if per-task processor time is not available
+ * @retval #OS_ERROR if the OS call failed @covtest
+ */
+int32 OS_TaskGetCpuTime(osal_id_t task_id, OS_time_t *cpu_time);
+
 /*-------------------------------------------------------------------------------------*/
 /**
  * @brief Reverse-lookup the OSAL task ID from an operating system ID
@@ -28,6 +28,20 @@
 #include "osconfig.h"
 #include "common_types.h"
 
+/*
+** Defines
+*/
+
+/**
+ * @brief Number of buckets in the time base jitter histogram
+ *
+ * Bucket 0 counts ticks that were serviced less than 1 microsecond after
+ * the scheduled expiry.  Bucket N counts ticks serviced at least 2^(N-1)
+ * but less than 2^N microseconds late, and the last bucket also counts
+ * everything later than that.
+ */
+#define OS_TIMEBASE_JITTER_BUCKETS 12
+
 /*
 ** Typedefs
 */
@@ -41,6 +55,9 @@ typedef struct
     uint32    nominal_interval_time;
     uint32    freerun_time;
     uint32    accuracy;
+    uint32    overrun_count; /**< Expirations that were missed by the servicing task */
+    uint32    max_jitter;    /**< Latest observed servicing of a tick, in microseconds */
+    uint32    jitter_histogram[OS_TIMEBASE_JITTER_BUCKETS]; /**< Tick servicing lateness, see OS_TIMEBASE_JITTER_BUCKETS */
 } OS_timebase_prop_t;
 
 /** @defgroup OSAPITimebase OSAL Time Base APIs
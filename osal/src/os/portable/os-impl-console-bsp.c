@@ -41,6 +41,12 @@
 #include "os-shared-printf.h"
 #include "os-shared-idmap.h"
 
+/*
+ * Size of the local buffer used to batch console records into a single
+ * write to the BSP console device.
+ */
+#define OS_CONSOLE_BATCH_SIZE 512
+
 /****************************************************************************************
                                 CONSOLE OUTPUT
  ***************************************************************************************/
@@ -53,41 +59,100 @@
  *-----------------------------------------------------------------*/
 void OS_ConsoleOutput_Impl(const OS_object_token_t *token)
 {
-    size_t                        StartPos;
-    size_t                        EndPos;
+    size_t                        ReadPos;
+    size_t                        DataPos;
+    size_t                        RecordSize;
     size_t                        WriteSize;
+    size_t                        BatchSize;
+    uint32                        MsgLen;
+    char                          Batch[OS_CONSOLE_BATCH_SIZE];
     OS_console_internal_record_t *console;
 
-    console  = OS_OBJECT_TABLE_GET(OS_console_table, *token);
-    StartPos = console->ReadPos;
-    EndPos   = console->WritePos;
+    console   = OS_OBJECT_TABLE_GET(OS_console_table, *token);
+    BatchSize = 0;
 
+    /*
+     * The BSP lock also makes this the only reader of the ring buffer,
+     * even if called from several tasks on a synchronous console.
+     */
     OS_BSP_Lock_Impl();
 
-    while (StartPos != EndPos)
+    ReadPos = console->ReadPos;
+    while (true)
     {
-        if (StartPos > EndPos)
+        /* Stop at the first record that is free or still being written */
+        MsgLen = __atomic_load_n((uint32 *)&console->BufBase[ReadPos], __ATOMIC_ACQUIRE);
+        if (MsgLen == 0)
+        {
+            break;
+        }
+
+        RecordSize = OS_CONSOLE_RECORD_SIZE(MsgLen);
+        DataPos    = ReadPos + OS_CONSOLE_RECORD_ALIGN;
+        if (DataPos >= console->BufSize)
         {
-            /* handle wrap */
-            WriteSize = console->BufSize - StartPos;
+            DataPos = 0;
         }
-        else
+
+        while (MsgLen > 0)
         {
-            WriteSize = EndPos - StartPos;
+            WriteSize = console->BufSize - DataPos;
+            if (WriteSize > MsgLen)
+            {
+                WriteSize = MsgLen;
+            }
+
+            if ((BatchSize + WriteSize) > sizeof(Batch))
+            {
+                OS_BSP_ConsoleOutput_Impl(Batch, BatchSize);
+                BatchSize = 0;
+            }
+
+            if (WriteSize > sizeof(Batch))
+            {
+                /* too big to batch, write it directly */
+                OS_BSP_ConsoleOutput_Impl(&console->BufBase[DataPos], WriteSize);
+            }
+            else
+            {
+                memcpy(&Batch[BatchSize], &console->BufBase[DataPos], WriteSize);
+                BatchSize += WriteSize;
+            }
+
+            MsgLen -= WriteSize;
+            DataPos += WriteSize;
+            if (DataPos >= console->BufSize)
+            {
+                DataPos = 0;
+            }
         }
 
-        OS_BSP_ConsoleOutput_Impl(&console->BufBase[StartPos], WriteSize);
+        /*
+         * Clear the whole record before handing the space back, so any
+         * position in the free space can later be read as a zero header.
+         */
+        WriteSize = console->BufSize - ReadPos;
+        if (WriteSize > RecordSize)
+        {
+            WriteSize = RecordSize;
+        }
+        memset(&console->BufBase[ReadPos], 0, WriteSize);
+        memset(console->BufBase, 0, RecordSize - WriteSize);
 
-        StartPos += WriteSize;
-        if (StartPos >= console->BufSize)
+        ReadPos += RecordSize;
+        if (ReadPos >= console->BufSize)
         {
-            /* handle wrap */
-            StartPos = 0;
+            ReadPos -= console->BufSize;
         }
+
+        /* Update the global with the new read location */
+        __atomic_store_n(&console->ReadPos, ReadPos, __ATOMIC_RELEASE);
     }
 
-    OS_BSP_Unlock_Impl();
+    if (BatchSize > 0)
+    {
+        OS_BSP_ConsoleOutput_Impl(Batch, BatchSize);
+    }
 
-    /* Update the global with the new read location */
-    console->ReadPos = StartPos;
+    OS_BSP_Unlock_Impl();
 }
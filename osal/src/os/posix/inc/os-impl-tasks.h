@@ -42,5 +42,6 @@ extern OS_impl_task_internal_record_t OS_impl_task_table[OS_MAX_TASKS];
 
 int32 OS_Posix_InternalTaskCreate_Impl(pthread_t *pthr, osal_priority_t priority, osal_stackptr_t stackptr,
                                        size_t stacksz, PthreadFuncPtr_t entry, void *entry_arg);
+int32 OS_Posix_InternalTaskSetAffinity_Impl(pthread_t pthr, uint32 cpu_mask);
 
 #endif /* OS_IMPL_TASKS_H */
@@ -27,6 +27,7 @@
 #define OS_IMPL_TIMEBASE_H
 
 #include "osconfig.h"
+#include "osapi-timebase.h"
 #include <pthread.h>
 #include <signal.h>
 
@@ -35,9 +36,22 @@ typedef struct
     pthread_t       handler_thread;
     pthread_mutex_t handler_mutex;
     timer_t         host_timerid;
+    int             timer_fd;
     int             assigned_signal;
+    bool            simulated_tick;
     sigset_t        sigset;
     sig_atomic_t    reset_flag;
+
+    /*
+     * Tick servicing statistics, updated by the handler thread.
+     * next_expiry is the absolute time of the next scheduled tick, or
+     * zero if no tick is scheduled.
+     */
+    struct timespec next_expiry;
+    struct timespec interval;
+    uint32          overrun_count;
+    uint32          max_jitter;
+    uint32          jitter_histogram[OS_TIMEBASE_JITTER_BUCKETS];
 } OS_impl_timebase_internal_record_t;
 
 /****************************************************************************************
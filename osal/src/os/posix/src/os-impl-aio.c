@@ -0,0 +1,577 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup  posix
+ *
+ * Asynchronous file I/O
+ *
+ * On Linux the requests are handed to the kernel through an io_uring
+ * instance, and a single reaper thread collects the completions.  Where
+ * io_uring is not available, either at build time or at run time (old
+ * kernel, or disabled by the administrator), a single worker thread
+ * performs the writes in submission order.
+ *
+ * The file region for each request is reserved at submission time by
+ * advancing the file position, so requests may complete in any order but
+ * the data always lands in submission order.  Streams that cannot seek
+ * (pipes, sockets) are written at the current position and are serialized.
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "os-posix.h"
+#include "os-impl-io.h"
+#include "os-impl-tasks.h"
+#include "os-shared-file.h"
+#include "os-shared-idmap.h"
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define OS_IMPL_AIO_HAVE_URING
+#endif
+#endif
+
+#ifdef OS_IMPL_AIO_HAVE_URING
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+#endif
+
+/****************************************************************************************
+                                     DEFINES
+ ***************************************************************************************/
+
+#define OS_ASYNC_IO_TASK_PRIORITY OS_UTILITYTASK_PRIORITY
+
+/*
+ * Maximum number of requests in flight in the kernel at once.
+ * Further submissions wait for a completion.
+ */
+#define OS_ASYNC_IO_RING_ENTRIES 64
+
+/****************************************************************************************
+                                   LOCAL TYPEDEFS
+ ***************************************************************************************/
+
+typedef struct
+{
+    pthread_once_t  InitOnce;
+    int32           InitStatus;
+    pthread_mutex_t Lock;
+    pthread_cond_t  Cond; /**< signalled on every completion and on new worker requests */
+    pthread_t       Thread;
+    uint32          InFlight;
+    OS_AsyncIo_t *  QueueHead; /**< worker thread queue, FIFO */
+    OS_AsyncIo_t *  QueueTail;
+
+#ifdef OS_IMPL_AIO_HAVE_URING
+    bool                 UseRing;
+    int                  RingFd;
+    uint32 *             SqTail;
+    uint32 *             SqMask;
+    uint32 *             SqArray;
+    struct io_uring_sqe *Sqes;
+    uint32 *             CqHead;
+    uint32 *             CqTail;
+    uint32 *             CqMask;
+    struct io_uring_cqe *Cqes;
+#endif
+} OS_impl_aio_state_t;
+
+/****************************************************************************************
+                                     GLOBALS
+ ***************************************************************************************/
+
+static OS_impl_aio_state_t OS_impl_aio_state = {.InitOnce = PTHREAD_ONCE_INIT};
+
+/****************************************************************************************
+                                  COMMON HELPERS
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Reports the final status of a request and wakes any waiters
+ *
+ *-----------------------------------------------------------------*/
+static void OS_Posix_AsyncComplete(OS_AsyncIo_t *req, int32 result)
+{
+    req->Result = result;
+
+    if (req->Callback != NULL)
+    {
+        req->Callback(req);
+    }
+
+    pthread_mutex_lock(&OS_impl_aio_state.Lock);
+    req->IsPending = false;
+    --OS_impl_aio_state.InFlight;
+    pthread_cond_broadcast(&OS_impl_aio_state.Cond);
+    pthread_mutex_unlock(&OS_impl_aio_state.Lock);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Worker thread entry point, services the queue in FIFO order
+ *
+ *-----------------------------------------------------------------*/
+static void *OS_Posix_AsyncWorker_Entry(void *arg)
+{
+    OS_AsyncIo_t *req;
+    ssize_t       status;
+
+    while (true)
+    {
+        pthread_mutex_lock(&OS_impl_aio_state.Lock);
+        while (OS_impl_aio_state.QueueHead == NULL)
+        {
+            pthread_cond_wait(&OS_impl_aio_state.Cond, &OS_impl_aio_state.Lock);
+        }
+        req                         = OS_impl_aio_state.QueueHead;
+        OS_impl_aio_state.QueueHead = req->Next;
+        if (OS_impl_aio_state.QueueHead == NULL)
+        {
+            OS_impl_aio_state.QueueTail = NULL;
+        }
+        pthread_mutex_unlock(&OS_impl_aio_state.Lock);
+
+        status = 0;
+        while (req->Done < req->Size)
+        {
+            if (req->Offset >= 0)
+            {
+                status = pwrite(req->Handle, (const uint8 *)req->Buffer + req->Done, req->Size - req->Done,
+                                req->Offset + req->Done);
+            }
+            else
+            {
+                status = write(req->Handle, (const uint8 *)req->Buffer + req->Done, req->Size - req->Done);
+            }
+
+            if (status < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            if (status <= 0)
+            {
+                break;
+            }
+
+            req->Done += status;
+        }
+
+        if (req->Done < req->Size)
+        {
+            OS_DEBUG("async write: %s\n", status < 0 ? strerror(errno) : "no progress");
+            OS_Posix_AsyncComplete(req, OS_ERROR);
+        }
+        else
+        {
+            OS_Posix_AsyncComplete(req, (int32)req->Done);
+        }
+    }
+
+    return NULL;
+}
+
+#ifdef OS_IMPL_AIO_HAVE_URING
+
+/****************************************************************************************
+                                  IO_URING BACKEND
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Places a request on the submission ring and hands it to the kernel.
+ *           Must be called with the lock held and a free ring slot.
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_Posix_AsyncRingSubmit(OS_AsyncIo_t *req)
+{
+    OS_impl_aio_state_t *state = &OS_impl_aio_state;
+    struct io_uring_sqe *sqe;
+    uint32               tail;
+    uint32               index;
+    int                  status;
+
+    tail  = *state->SqTail;
+    index = tail & *state->SqMask;
+    sqe   = &state->Sqes[index];
+
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode    = IORING_OP_WRITE;
+    sqe->fd        = req->Handle;
+    sqe->addr      = (uint64)(unsigned long)((const uint8 *)req->Buffer + req->Done);
+    sqe->len       = req->Size - req->Done;
+    sqe->user_data = (uint64)(unsigned long)req;
+    if (req->Offset >= 0)
+    {
+        sqe->off = req->Offset + req->Done;
+    }
+    else
+    {
+        /* current file position; drain so that stream writes stay in order */
+        sqe->off   = (uint64)-1;
+        sqe->flags = IOSQE_IO_DRAIN;
+    }
+
+    state->SqArray[index] = index;
+    __atomic_store_n(state->SqTail, tail + 1, __ATOMIC_RELEASE);
+
+    do
+    {
+        status = syscall(__NR_io_uring_enter, state->RingFd, 1, 0, 0, NULL, 0);
+    } while (status < 0 && errno == EINTR);
+
+    if (status != 1)
+    {
+        /* the kernel did not consume the entry, take it back */
+        OS_DEBUG("io_uring_enter: %s\n", status < 0 ? strerror(errno) : "not consumed");
+        __atomic_store_n(state->SqTail, tail, __ATOMIC_RELEASE);
+        return OS_ERROR;
+    }
+
+    ++state->InFlight;
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Reaper thread entry point, collects io_uring completions
+ *
+ *-----------------------------------------------------------------*/
+static void *OS_Posix_AsyncReaper_Entry(void *arg)
+{
+    OS_impl_aio_state_t *state = &OS_impl_aio_state;
+    struct io_uring_cqe *cqe;
+    OS_AsyncIo_t *       req;
+    uint32               head;
+    uint32               tail;
+    int32                res;
+
+    while (true)
+    {
+        syscall(__NR_io_uring_enter, state->RingFd, 0, 1, IORING_ENTER_GETEVENTS, NULL, 0);
+
+        head = *state->CqHead;
+        tail = __atomic_load_n(state->CqTail, __ATOMIC_ACQUIRE);
+        while (head != tail)
+        {
+            cqe = &state->Cqes[head & *state->CqMask];
+            req = (OS_AsyncIo_t *)(unsigned long)cqe->user_data;
+            res = cqe->res;
+            ++head;
+            __atomic_store_n(state->CqHead, head, __ATOMIC_RELEASE);
+
+            if (res > 0)
+            {
+                req->Done += res;
+                if (req->Done < req->Size)
+                {
+                    /* short write - resubmit the remainder in the slot just freed */
+                    pthread_mutex_lock(&state->Lock);
+                    --state->InFlight;
+                    res = OS_Posix_AsyncRingSubmit(req);
+                    if (res != OS_SUCCESS)
+                    {
+                        ++state->InFlight;
+                    }
+                    pthread_mutex_unlock(&state->Lock);
+
+                    if (res == OS_SUCCESS)
+                    {
+                        continue;
+                    }
+                }
+            }
+            else if (res < 0)
+            {
+                OS_DEBUG("async write: %s\n", strerror(-res));
+            }
+
+            if (req->Done < req->Size)
+            {
+                OS_Posix_AsyncComplete(req, OS_ERROR);
+            }
+            else
+            {
+                OS_Posix_AsyncComplete(req, (int32)req->Done);
+            }
+        }
+    }
+
+    return NULL;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Creates and maps the io_uring instance.  Any failure here
+ *           is not fatal, the worker thread is used instead.
+ *
+ *-----------------------------------------------------------------*/
+static bool OS_Posix_AsyncRingSetup(void)
+{
+    OS_impl_aio_state_t *  state = &OS_impl_aio_state;
+    struct io_uring_params params;
+    struct io_uring_probe *probe;
+    size_t                 probe_size;
+    size_t                 sq_size;
+    size_t                 cq_size;
+    uint8 *                sq_ptr;
+    uint8 *                cq_ptr;
+    void *                 sqe_ptr;
+    bool                   supported;
+    int                    fd;
+
+    memset(&params, 0, sizeof(params));
+    fd = syscall(__NR_io_uring_setup, OS_ASYNC_IO_RING_ENTRIES, &params);
+    if (fd < 0)
+    {
+        OS_DEBUG("io_uring_setup: %s, using worker thread\n", strerror(errno));
+        return false;
+    }
+
+    /* IORING_OP_WRITE needs a newer kernel than io_uring itself */
+    probe_size = sizeof(*probe) + (IORING_OP_WRITE + 1) * sizeof(struct io_uring_probe_op);
+    probe      = calloc(1, probe_size);
+    supported  = (probe != NULL &&
+                 syscall(__NR_io_uring_register, fd, IORING_REGISTER_PROBE, probe, IORING_OP_WRITE + 1) >= 0 &&
+                 probe->last_op >= IORING_OP_WRITE && (probe->ops[IORING_OP_WRITE].flags & IO_URING_OP_SUPPORTED) != 0);
+    free(probe);
+
+    if (!supported || (params.features & IORING_FEAT_SINGLE_MMAP) == 0)
+    {
+        OS_DEBUG("io_uring lacks required features, using worker thread\n");
+        close(fd);
+        return false;
+    }
+
+    sq_size = params.sq_off.array + params.sq_entries * sizeof(uint32);
+    cq_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    if (cq_size > sq_size)
+    {
+        sq_size = cq_size;
+    }
+
+    sq_ptr = mmap(NULL, sq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    if (sq_ptr == MAP_FAILED)
+    {
+        OS_DEBUG("io_uring mmap: %s, using worker thread\n", strerror(errno));
+        close(fd);
+        return false;
+    }
+    cq_ptr = sq_ptr;
+
+    sqe_ptr = mmap(NULL, params.sq_entries * sizeof(struct io_uring_sqe), PROT_READ | PROT_WRITE,
+                   MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+    if (sqe_ptr == MAP_FAILED)
+    {
+        OS_DEBUG("io_uring mmap: %s, using worker thread\n", strerror(errno));
+        munmap(sq_ptr, sq_size);
+        close(fd);
+        return false;
+    }
+
+    state->RingFd  = fd;
+    state->SqTail  = (uint32 *)(sq_ptr + params.sq_off.tail);
+    state->SqMask  = (uint32 *)(sq_ptr + params.sq_off.ring_mask);
+    state->SqArray = (uint32 *)(sq_ptr + params.sq_off.array);
+    state->Sqes    = sqe_ptr;
+    state->CqHead  = (uint32 *)(cq_ptr + params.cq_off.head);
+    state->CqTail  = (uint32 *)(cq_ptr + params.cq_off.tail);
+    state->CqMask  = (uint32 *)(cq_ptr + params.cq_off.ring_mask);
+    state->Cqes    = (struct io_uring_cqe *)(cq_ptr + params.cq_off.cqes);
+
+    return true;
+}
+
+#endif /* OS_IMPL_AIO_HAVE_URING */
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           One-time initialization, run on first use
+ *
+ *-----------------------------------------------------------------*/
+static void OS_Posix_AsyncInit(void)
+{
+    OS_impl_aio_state_t *state = &OS_impl_aio_state;
+    PthreadFuncPtr_t     entry;
+
+    entry = OS_Posix_AsyncWorker_Entry;
+
+    if (pthread_mutex_init(&state->Lock, NULL) != 0 || pthread_cond_init(&state->Cond, NULL) != 0)
+    {
+        state->InitStatus = OS_ERROR;
+        return;
+    }
+
+#ifdef OS_IMPL_AIO_HAVE_URING
+    state->UseRing = OS_Posix_AsyncRingSetup();
+    if (state->UseRing)
+    {
+        entry = OS_Posix_AsyncReaper_Entry;
+    }
+#endif
+
+    state->InitStatus = OS_Posix_InternalTaskCreate_Impl(&state->Thread, OS_ASYNC_IO_TASK_PRIORITY,
+                                                         OSAL_TASK_STACK_ALLOCATE, PTHREAD_STACK_MIN, entry, NULL);
+}
+
+/****************************************************************************************
+                                  ASYNC I/O API
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_AsyncWrite_Impl(const OS_object_token_t *token, OS_AsyncIo_t *req)
+{
+    OS_impl_aio_state_t *           state = &OS_impl_aio_state;
+    OS_impl_file_internal_record_t *impl;
+    off_t                           pos;
+    int32                           return_code;
+
+    pthread_once(&state->InitOnce, OS_Posix_AsyncInit);
+    if (state->InitStatus != OS_SUCCESS)
+    {
+        return state->InitStatus;
+    }
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
+
+    /*
+     * Reserve the file region by moving the file position past it.  This is a
+     * single atomic operation in the kernel so concurrent submitters on the same
+     * file cannot overlap, and any synchronous writes issued afterwards follow on.
+     */
+    pos = lseek(impl->fd, (off_t)req->Size, SEEK_CUR);
+    if (pos < 0)
+    {
+        req->Offset = -1;
+    }
+    else
+    {
+        req->Offset = pos - (off_t)req->Size;
+    }
+    req->Handle = impl->fd;
+
+    return_code = OS_SUCCESS;
+    pthread_mutex_lock(&state->Lock);
+
+#ifdef OS_IMPL_AIO_HAVE_URING
+    if (state->UseRing)
+    {
+        while (state->InFlight >= OS_ASYNC_IO_RING_ENTRIES)
+        {
+            pthread_cond_wait(&state->Cond, &state->Lock);
+        }
+        return_code = OS_Posix_AsyncRingSubmit(req);
+    }
+    else
+#endif
+    {
+        if (state->QueueTail == NULL)
+        {
+            state->QueueHead = req;
+        }
+        else
+        {
+            state->QueueTail->Next = req;
+        }
+        state->QueueTail = req;
+        ++state->InFlight;
+        pthread_cond_broadcast(&state->Cond);
+    }
+
+    pthread_mutex_unlock(&state->Lock);
+
+    if (return_code != OS_SUCCESS && req->Offset >= 0 &&
+        lseek(impl->fd, 0, SEEK_CUR) == (off_t)(req->Offset + req->Size))
+    {
+        /* give back the reserved region, as nothing has been reserved after it */
+        lseek(impl->fd, req->Offset, SEEK_SET);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_AsyncWait_Impl(OS_AsyncIo_t *req, int32 msecs)
+{
+    OS_impl_aio_state_t *state = &OS_impl_aio_state;
+    struct timespec      ts;
+    int32                return_code;
+
+    if (!req->IsPending)
+    {
+        return OS_SUCCESS;
+    }
+    if (msecs == OS_CHECK)
+    {
+        return OS_ERROR_TIMEOUT;
+    }
+
+    if (msecs > 0)
+    {
+        OS_Posix_CompAbsDelayTime(msecs, &ts);
+    }
+
+    return_code = OS_SUCCESS;
+    pthread_mutex_lock(&state->Lock);
+    while (req->IsPending)
+    {
+        if (msecs < 0)
+        {
+            pthread_cond_wait(&state->Cond, &state->Lock);
+        }
+        else if (pthread_cond_timedwait(&state->Cond, &state->Lock, &ts) == ETIMEDOUT)
+        {
+            if (req->IsPending)
+            {
+                return_code = OS_ERROR_TIMEOUT;
+            }
+            break;
+        }
+    }
+    pthread_mutex_unlock(&state->Lock);
+
+    return return_code;
+}
@@ -790,6 +790,56 @@ int32 OS_TaskSetPriority_Impl(const OS_object_token_t *token, osal_priority_t ne
     return OS_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Sets the CPU affinity of a pthread
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_Posix_InternalTaskSetAffinity_Impl(pthread_t pthr, uint32 cpu_mask)
+{
+#ifdef CPU_SET
+    cpu_set_t cpuset;
+    uint32    cpu;
+    int       ret;
+
+    CPU_ZERO(&cpuset);
+    for (cpu = 0; cpu < 32 && cpu < CPU_SETSIZE; ++cpu)
+    {
+        if ((cpu_mask >> cpu) & 1)
+        {
+            CPU_SET(cpu, &cpuset);
+        }
+    }
+
+    ret = pthread_setaffinity_np(pthr, sizeof(cpuset), &cpuset);
+    if (ret != 0)
+    {
+        OS_DEBUG("pthread_setaffinity_np: mask = 0x%08lx, err = %s\n", (unsigned long)cpu_mask, strerror(ret));
+        return OS_ERROR;
+    }
+
+    return OS_SUCCESS;
+#else
+    return OS_ERR_NOT_IMPLEMENTED;
+#endif
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_TaskSetAffinity_Impl(const OS_object_token_t *token, uint32 cpu_mask)
+{
+    OS_impl_task_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_task_table, *token);
+
+    return OS_Posix_InternalTaskSetAffinity_Impl(impl->id, cpu_mask);
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per internal OSAL API
@@ -858,6 +908,43 @@ int32 OS_TaskGetInfo_Impl(const OS_object_token_t *token, OS_task_prop_t *task_p
     return OS_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_TaskGetCpuTime_Impl(const OS_object_token_t *token, OS_time_t *cpu_time)
+{
+#if defined(_POSIX_THREAD_CPUTIME) && (_POSIX_THREAD_CPUTIME >= 0)
+    OS_impl_task_internal_record_t *impl;
+    clockid_t                       clock_id;
+    struct timespec                 now;
+    int                             ret;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_task_table, *token);
+
+    ret = pthread_getcpuclockid(impl->id, &clock_id);
+    if (ret != 0)
+    {
+        OS_DEBUG("pthread_getcpuclockid: %s\n", strerror(ret));
+        return OS_ERROR;
+    }
+
+    if (clock_gettime(clock_id, &now) != 0)
+    {
+        OS_DEBUG("clock_gettime: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    *cpu_time = OS_TimeAssembleFromNanoseconds(now.tv_sec, now.tv_nsec);
+
+    return OS_SUCCESS;
+#else
+    return OS_ERR_NOT_IMPLEMENTED;
+#endif
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per internal OSAL API
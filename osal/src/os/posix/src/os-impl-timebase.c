@@ -26,6 +26,10 @@
  * This implementation depends on the POSIX Timer API which may not be available
  * in older versions of the Linux kernel. It was developed and tested on
  * RHEL 5 ./ CentOS 5 with Linux kernel 2.6.18
+ *
+ * If OSAL_CONFIG_TIMEBASE_TIMERFD is set, simulated time bases use a Linux
+ * timerfd read directly by the handler thread instead of a POSIX timer
+ * delivering an RT signal.  This avoids the signal delivery latency.
  */
 
 /****************************************************************************************
@@ -40,6 +44,10 @@
 #include "os-shared-idmap.h"
 #include "os-shared-common.h"
 
+#ifdef OSAL_CONFIG_TIMEBASE_TIMERFD
+#include <sys/timerfd.h>
+#endif
+
 /****************************************************************************************
                                 EXTERNAL FUNCTION PROTOTYPES
  ***************************************************************************************/
@@ -126,6 +134,170 @@ void OS_TimeBaseUnlock_Impl(const OS_object_token_t *token)
     pthread_mutex_unlock(&impl->handler_mutex);
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Record how late the handler thread is servicing a tick,
+ *           relative to the time the tick was scheduled to occur,
+ *           and advance to the next scheduled tick.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_TimeBase_RecordJitter(OS_impl_timebase_internal_record_t *impl, uint32 overruns)
+{
+    struct timespec now;
+    int64           late_nsec;
+    uint32          late_usec;
+    uint32          bucket;
+
+    if (impl->next_expiry.tv_sec == 0 && impl->next_expiry.tv_nsec == 0)
+    {
+        /* no tick was scheduled (should not happen) */
+        return;
+    }
+
+    clock_gettime(OS_PREFERRED_CLOCK, &now);
+
+    /* Missed expirations are skipped, so measure against the most recent one */
+    impl->overrun_count += overruns;
+    while (overruns > 0)
+    {
+        impl->next_expiry.tv_sec += impl->interval.tv_sec;
+        impl->next_expiry.tv_nsec += impl->interval.tv_nsec;
+        if (impl->next_expiry.tv_nsec >= 1000000000)
+        {
+            impl->next_expiry.tv_nsec -= 1000000000;
+            ++impl->next_expiry.tv_sec;
+        }
+        --overruns;
+    }
+
+    late_nsec = (int64)(now.tv_sec - impl->next_expiry.tv_sec) * 1000000000;
+    late_nsec += now.tv_nsec - impl->next_expiry.tv_nsec;
+    if (late_nsec < 0)
+    {
+        late_nsec = 0;
+    }
+    if (late_nsec >= ((int64)0xFFFFFFFF * 1000))
+    {
+        late_usec = 0xFFFFFFFF;
+    }
+    else
+    {
+        late_usec = (uint32)(late_nsec / 1000);
+    }
+
+    if (late_usec > impl->max_jitter)
+    {
+        impl->max_jitter = late_usec;
+    }
+
+    bucket = 0;
+    while (late_usec != 0 && bucket < (OS_TIMEBASE_JITTER_BUCKETS - 1))
+    {
+        late_usec >>= 1;
+        ++bucket;
+    }
+    ++impl->jitter_histogram[bucket];
+
+    if (impl->interval.tv_sec == 0 && impl->interval.tv_nsec == 0)
+    {
+        /* one-shot tick, nothing more is scheduled */
+        impl->next_expiry.tv_sec  = 0;
+        impl->next_expiry.tv_nsec = 0;
+    }
+    else
+    {
+        impl->next_expiry.tv_sec += impl->interval.tv_sec;
+        impl->next_expiry.tv_nsec += impl->interval.tv_nsec;
+        if (impl->next_expiry.tv_nsec >= 1000000000)
+        {
+            impl->next_expiry.tv_nsec -= 1000000000;
+            ++impl->next_expiry.tv_sec;
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Determine the elapsed time to report for a tick.
+ *
+ *-----------------------------------------------------------------*/
+static uint32 OS_TimeBase_TickTime(OS_impl_timebase_internal_record_t *impl, OS_timebase_internal_record_t *timebase)
+{
+    uint32 interval_time;
+
+    if (impl->reset_flag == 0)
+    {
+        /*
+         * Normal steady-state behavior.
+         * interval_time reflects the configured interval time.
+         */
+        interval_time = timebase->nominal_interval_time;
+    }
+    else
+    {
+        /*
+         * Reset/First interval behavior.
+         * timer_set() was invoked since the previous interval occurred (if any).
+         * interval_time reflects the configured start time.
+         */
+        interval_time    = timebase->nominal_start_time;
+        impl->reset_flag = 0;
+    }
+
+    return interval_time;
+}
+
+#ifdef OSAL_CONFIG_TIMEBASE_TIMERFD
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *-----------------------------------------------------------------*/
+static uint32 OS_TimeBase_TimerFdWaitImpl(osal_id_t obj_id)
+{
+    ssize_t                             ret;
+    OS_object_token_t                   token;
+    OS_impl_timebase_internal_record_t *impl;
+    OS_timebase_internal_record_t *     timebase;
+    uint32                              interval_time;
+    uint64                              expirations;
+
+    interval_time = 0;
+
+    if (OS_ObjectIdGetById(OS_LOCK_MODE_NONE, OS_OBJECT_TYPE_OS_TIMEBASE, obj_id, &token) == OS_SUCCESS)
+    {
+        impl     = OS_OBJECT_TABLE_GET(OS_impl_timebase_table, token);
+        timebase = OS_OBJECT_TABLE_GET(OS_timebase_table, token);
+
+        /*
+         * The read blocks until the timer expires, and returns the number
+         * of expirations since the previous read.  Anything more than one
+         * means the handler thread missed a tick.
+         */
+        ret = read(impl->timer_fd, &expirations, sizeof(expirations));
+
+        if (ret != sizeof(expirations) || expirations == 0)
+        {
+            /*
+             * the read call failed.
+             * returning 0 will cause the process to repeat.
+             */
+        }
+        else
+        {
+            OS_TimeBase_RecordJitter(impl, (uint32)(expirations - 1));
+            interval_time = OS_TimeBase_TickTime(impl, timebase);
+        }
+    }
+
+    return interval_time;
+}
+
+#else
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Local helper routine, not part of OSAL API.
@@ -139,6 +311,7 @@ static uint32 OS_TimeBase_SigWaitImpl(osal_id_t obj_id)
     OS_timebase_internal_record_t *     timebase;
     uint32                              interval_time;
     int                                 sig;
+    int                                 overruns;
 
     interval_time = 0;
 
@@ -156,29 +329,24 @@ static uint32 OS_TimeBase_SigWaitImpl(osal_id_t obj_id)
              * returning 0 will cause the process to repeat.
              */
         }
-        else if (impl->reset_flag == 0)
-        {
-            /*
-             * Normal steady-state behavior.
-             * interval_time reflects the configured interval time.
-             */
-            interval_time = timebase->nominal_interval_time;
-        }
         else
         {
-            /*
-             * Reset/First interval behavior.
-             * timer_set() was invoked since the previous interval occurred (if any).
-             * interval_time reflects the configured start time.
-             */
-            interval_time    = timebase->nominal_start_time;
-            impl->reset_flag = 0;
+            overruns = timer_getoverrun(impl->host_timerid);
+            if (overruns < 0)
+            {
+                overruns = 0;
+            }
+
+            OS_TimeBase_RecordJitter(impl, (uint32)overruns);
+            interval_time = OS_TimeBase_TickTime(impl, timebase);
         }
     }
 
     return interval_time;
 }
 
+#endif /* OSAL_CONFIG_TIMEBASE_TIMERFD */
+
 /****************************************************************************************
                                 INITIALIZATION FUNCTION
  ***************************************************************************************/
@@ -321,14 +489,16 @@ static void *OS_TimeBasePthreadEntry(void *arg)
 int32 OS_TimeBaseCreate_Impl(const OS_object_token_t *token)
 {
     int32                               return_code;
-    int                                 status;
-    int                                 i;
-    osal_index_t                        idx;
-    struct sigevent                     evp;
-    struct timespec                     ts;
     OS_impl_timebase_internal_record_t *local;
     OS_timebase_internal_record_t *     timebase;
     OS_VoidPtrValueWrapper_t            arg;
+#ifndef OSAL_CONFIG_TIMEBASE_TIMERFD
+    int             status;
+    int             i;
+    osal_index_t    idx;
+    struct sigevent evp;
+    struct timespec ts;
+#endif
 
     local    = OS_OBJECT_TABLE_GET(OS_impl_timebase_table, *token);
     timebase = OS_OBJECT_TABLE_GET(OS_timebase_table, *token);
@@ -354,7 +524,26 @@ int32 OS_TimeBaseCreate_Impl(const OS_object_token_t *token)
         return return_code;
     }
 
+    /*
+     * Optionally keep the handler thread on a reserved CPU, away from the
+     * application tasks, to reduce jitter in the time base.  This is best
+     * effort; the time base still works without it.
+     */
+    if (OS_TIMEBASE_CPU_MASK != 0 &&
+        OS_Posix_InternalTaskSetAffinity_Impl(local->handler_thread, OS_TIMEBASE_CPU_MASK) != OS_SUCCESS)
+    {
+        OS_DEBUG("Unable to set time base CPU affinity to 0x%08lx\n", (unsigned long)OS_TIMEBASE_CPU_MASK);
+    }
+
     local->assigned_signal = 0;
+    local->simulated_tick  = false;
+    local->timer_fd        = -1;
+
+    /* Statistics start over for each new time base */
+    local->overrun_count = 0;
+    local->max_jitter    = 0;
+    memset(&local->next_expiry, 0, sizeof(local->next_expiry));
+    memset(local->jitter_histogram, 0, sizeof(local->jitter_histogram));
 
     /*
      * Set up the necessary OS constructs
@@ -363,8 +552,29 @@ int32 OS_TimeBaseCreate_Impl(const OS_object_token_t *token)
      * we simply call that function and it should synchronize to the time source.
      *
      * If no external sync function is provided then this will set up a POSIX
-     * timer to locally simulate the timer tick using the CPU clock.
+     * timer (or timerfd) to locally simulate the timer tick using the CPU clock.
      */
+#ifdef OSAL_CONFIG_TIMEBASE_TIMERFD
+    if (timebase->external_sync == NULL)
+    {
+        /*
+        ** Create the timer
+        ** Note using the "MONOTONIC" clock here as this will still produce consistent intervals
+        ** even if the system clock is stepped (e.g. clock_settime).
+        */
+        local->timer_fd = timerfd_create(OS_PREFERRED_CLOCK, TFD_CLOEXEC);
+        if (local->timer_fd < 0)
+        {
+            OS_DEBUG("Error in timerfd_create: %s\n", strerror(errno));
+            return_code = OS_TIMER_ERR_UNAVAILABLE;
+        }
+        else
+        {
+            local->simulated_tick   = true;
+            timebase->external_sync = OS_TimeBase_TimerFdWaitImpl;
+        }
+    }
+#else
     if (timebase->external_sync == NULL)
     {
         sigemptyset(&local->sigset);
@@ -458,9 +668,11 @@ int32 OS_TimeBaseCreate_Impl(const OS_object_token_t *token)
                 break;
             }
 
+            local->simulated_tick   = true;
             timebase->external_sync = OS_TimeBase_SigWaitImpl;
         } while (0);
     }
+#endif /* OSAL_CONFIG_TIMEBASE_TIMERFD */
 
     if (return_code != OS_SUCCESS)
     {
@@ -487,6 +699,7 @@ int32 OS_TimeBaseSet_Impl(const OS_object_token_t *token, uint32 start_time, uin
 {
     OS_impl_timebase_internal_record_t *local;
     struct itimerspec                   timeout;
+    struct timespec                     start;
     int32                               return_code;
     int                                 status;
     OS_timebase_internal_record_t *     timebase;
@@ -496,21 +709,45 @@ int32 OS_TimeBaseSet_Impl(const OS_object_token_t *token, uint32 start_time, uin
     return_code = OS_SUCCESS;
 
     /* There is only something to do here if we are generating a simulated tick */
-    if (local->assigned_signal != 0)
+    if (local->simulated_tick)
     {
         /*
         ** Convert from Microseconds to timespec structures
         */
         memset(&timeout, 0, sizeof(timeout));
-        OS_UsecToTimespec(start_time, &timeout.it_value);
+        OS_UsecToTimespec(start_time, &start);
         OS_UsecToTimespec(interval_time, &timeout.it_interval);
 
+        /*
+         * The timer is programmed with an absolute start time, so the
+         * handler thread knows exactly when each tick was due and can
+         * measure how late it was serviced.  A zero value disarms the timer.
+         */
+        if (start_time > 0)
+        {
+            clock_gettime(OS_PREFERRED_CLOCK, &timeout.it_value);
+            timeout.it_value.tv_sec += start.tv_sec;
+            timeout.it_value.tv_nsec += start.tv_nsec;
+            if (timeout.it_value.tv_nsec >= 1000000000)
+            {
+                timeout.it_value.tv_nsec -= 1000000000;
+                ++timeout.it_value.tv_sec;
+            }
+        }
+
+        local->next_expiry = timeout.it_value;
+        local->interval    = timeout.it_interval;
+
         /*
         ** Program the real timer
         */
-        status = timer_settime(local->host_timerid, 0, /* Flags field can be zero */
-                               &timeout,               /* struct itimerspec */
-                               NULL);                  /* Oldvalue */
+#ifdef OSAL_CONFIG_TIMEBASE_TIMERFD
+        status = timerfd_settime(local->timer_fd, TFD_TIMER_ABSTIME, &timeout, NULL);
+#else
+        status = timer_settime(local->host_timerid, TIMER_ABSTIME, /* Start time is absolute */
+                               &timeout,                           /* struct itimerspec */
+                               NULL);                              /* Oldvalue */
+#endif
 
         if (status < 0)
         {
@@ -523,7 +760,7 @@ int32 OS_TimeBaseSet_Impl(const OS_object_token_t *token, uint32 start_time, uin
         }
         else
         {
-            timebase->accuracy_usec = (uint32)((timeout.it_value.tv_nsec + 999) / 1000);
+            timebase->accuracy_usec = (uint32)((start.tv_nsec + 999) / 1000);
         }
     }
 
@@ -549,9 +786,13 @@ int32 OS_TimeBaseDelete_Impl(const OS_object_token_t *token)
     /*
     ** Delete the timer
     */
-    if (local->assigned_signal != 0)
+    if (local->simulated_tick)
     {
+#ifdef OSAL_CONFIG_TIMEBASE_TIMERFD
+        status = close(local->timer_fd);
+#else
         status = timer_delete(local->host_timerid);
+#endif
         if (status < 0)
         {
             OS_DEBUG("Error deleting timer: %s\n", strerror(errno));
@@ -559,6 +800,8 @@ int32 OS_TimeBaseDelete_Impl(const OS_object_token_t *token)
         }
 
         local->assigned_signal = 0;
+        local->simulated_tick  = false;
+        local->timer_fd        = -1;
     }
 
     return OS_SUCCESS;
@@ -572,5 +815,13 @@ int32 OS_TimeBaseDelete_Impl(const OS_object_token_t *token)
  *-----------------------------------------------------------------*/
 int32 OS_TimeBaseGetInfo_Impl(const OS_object_token_t *token, OS_timebase_prop_t *timer_prop)
 {
+    OS_impl_timebase_internal_record_t *local;
+
+    local = OS_OBJECT_TABLE_GET(OS_impl_timebase_table, *token);
+
+    timer_prop->overrun_count = local->overrun_count;
+    timer_prop->max_jitter    = local->max_jitter;
+    memcpy(timer_prop->jitter_histogram, local->jitter_histogram, sizeof(timer_prop->jitter_histogram));
+
     return OS_SUCCESS;
 }
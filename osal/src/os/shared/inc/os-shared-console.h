@@ -29,6 +29,12 @@
  * The implementation layer may optionally spawn a
  * "utility task" or equivalent to forward data, or
  * it may process data immediately.
+ *
+ * Any number of tasks may write into the ring buffer at the same
+ * time without a lock.  Each writer atomically reserves space for a
+ * complete record, copies its message in, and then marks the record
+ * complete.  The single reader (the console output implementation)
+ * consumes complete records in order and clears them.
  */
 
 #ifndef OS_SHARED_CONSOLE_H
@@ -38,6 +44,20 @@
 #include "os-shared-printf.h"
 #include "os-shared-globaldefs.h"
 
+/*
+ * Console ring buffer records
+ *
+ * Each message is stored as a 32-bit header followed by the message
+ * characters, padded to a multiple of the header size.  The header holds
+ * the message length once the record is complete, and zero while the
+ * record is being written or is free.  Records always start on a header
+ * size boundary, so a header never wraps around the end of the buffer,
+ * but the message characters may.
+ */
+#define OS_CONSOLE_RECORD_ALIGN ((size_t)sizeof(uint32))
+#define OS_CONSOLE_RECORD_SIZE(len) \
+    (OS_CONSOLE_RECORD_ALIGN + (((len) + OS_CONSOLE_RECORD_ALIGN - 1) & ~(OS_CONSOLE_RECORD_ALIGN - 1)))
+
 /**
  * The generic console data record
  */
@@ -45,12 +65,13 @@ typedef struct
 {
     char device_name[OS_MAX_API_NAME];
 
-    char *          BufBase;        /**< Start of the buffer memory */
-    size_t          BufSize;        /**< Total size of the buffer */
-    volatile size_t ReadPos;        /**< Offset of next byte to read */
-    volatile size_t WritePos;       /**< Offset of next byte to write */
-    uint32          OverflowEvents; /**< Number of lines dropped due to overflow */
-    bool            IsAsync;        /**< Whether to write data via deferred utility task */
+    char *          BufBase;         /**< Start of the buffer memory, aligned for a record header */
+    size_t          BufSize;         /**< Total size of the buffer, a multiple of the record alignment */
+    volatile size_t ReadPos;         /**< Offset of next record to read */
+    volatile size_t WritePos;        /**< Offset of next record to reserve */
+    uint32          OverflowEvents;  /**< Number of lines dropped due to overflow */
+    uint32          OverflowTimeout; /**< Milliseconds a writer may wait for space before dropping */
+    bool            IsAsync;         /**< Whether to write data via deferred utility task */
 } OS_console_internal_record_t;
 
 extern OS_console_internal_record_t OS_console_table[OS_MAX_CONSOLES];
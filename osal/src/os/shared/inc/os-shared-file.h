@@ -105,6 +105,23 @@ int32 OS_GenericWrite_Impl(const OS_object_token_t *token, const void *buffer, s
  ------------------------------------------------------------------*/
 int32 OS_GenericClose_Impl(const OS_object_token_t *token);
 
+/*----------------------------------------------------------------
+
+    Purpose: Queues an asynchronous write of the request buffer
+             The request block is already marked as pending
+
+    Returns: OS_SUCCESS if queued, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_AsyncWrite_Impl(const OS_object_token_t *token, OS_AsyncIo_t *req);
+
+/*----------------------------------------------------------------
+
+    Purpose: Waits for an asynchronous request to complete
+
+    Returns: OS_SUCCESS if complete, OS_ERROR_TIMEOUT if still pending
+ ------------------------------------------------------------------*/
+int32 OS_AsyncWait_Impl(OS_AsyncIo_t *req, int32 msecs);
+
 /*----------------------------------------------------------------
 
     Purpose: Opens the file indicated by "local_path" with permission
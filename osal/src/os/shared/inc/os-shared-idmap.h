@@ -425,6 +425,20 @@ int32 OS_ObjectIdGetById(OS_lock_mode_t lock_mode, osal_objtype_t idtype, osal_i
  ------------------------------------------------------------------*/
 void OS_ObjectIdRelease(OS_object_token_t *token);
 
+/*----------------------------------------------------------------
+
+    Purpose: Sets or changes the name of an object, and updates the name
+             index used by OS_ObjectIdGetByName() accordingly.
+
+             This is only needed where the name of an object is assigned
+             after it has been created.  The token must be held in
+             OS_LOCK_MODE_EXCLUSIVE mode, and the name must refer to storage
+             within the object's own record.
+
+    Returns: none
+ ------------------------------------------------------------------*/
+void OS_ObjectIdSetName(const OS_object_token_t *token, const char *name);
+
 /*----------------------------------------------------------------
 
     Purpose: Transfers ownership of an object token without unlocking/releasing.
@@ -130,6 +130,14 @@ int32 OS_TaskDelay_Impl(uint32 millisecond);
  ------------------------------------------------------------------*/
 int32 OS_TaskSetPriority_Impl(const OS_object_token_t *token, osal_priority_t new_priority);
 
+/*----------------------------------------------------------------
+
+    Purpose: Set the CPU affinity of the specified task
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_TaskSetAffinity_Impl(const OS_object_token_t *token, uint32 cpu_mask);
+
 /*----------------------------------------------------------------
 
     Purpose: Obtain the OSAL task ID of the caller
@@ -146,6 +154,14 @@ osal_id_t OS_TaskGetId_Impl(void);
  ------------------------------------------------------------------*/
 int32 OS_TaskGetInfo_Impl(const OS_object_token_t *token, OS_task_prop_t *task_prop);
 
+/*----------------------------------------------------------------
+
+    Purpose: Obtain the processor time consumed by a task
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_TaskGetCpuTime_Impl(const OS_object_token_t *token, OS_time_t *cpu_time);
+
 /*----------------------------------------------------------------
 
     Purpose: Perform registration actions after new task creation
@@ -249,6 +249,64 @@ int32 OS_TimedWrite(osal_id_t filedes, const void *buffer, size_t nbytes, int32
     return OS_TimedWriteAbs(filedes, buffer, nbytes, OS_TimeFromRelativeMilliseconds(timeout));
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_AsyncWrite(osal_id_t filedes, const void *buffer, size_t nbytes, OS_AsyncIo_t *req)
+{
+    OS_object_token_t token;
+    int32             return_code;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(buffer);
+    OS_CHECK_SIZE(nbytes);
+    OS_CHECK_POINTER(req);
+
+    if (req->IsPending)
+    {
+        return OS_ERR_INCORRECT_OBJ_STATE;
+    }
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, filedes, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        req->Buffer    = buffer;
+        req->Size      = nbytes;
+        req->Done      = 0;
+        req->Result    = 0;
+        req->Next      = NULL;
+        req->IsPending = true;
+
+        return_code = OS_AsyncWrite_Impl(&token, req);
+        if (return_code != OS_SUCCESS)
+        {
+            req->IsPending = false;
+            req->Result    = return_code;
+        }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_AsyncWait(OS_AsyncIo_t *req, int32 timeout)
+{
+    /* Check Parameters */
+    OS_CHECK_POINTER(req);
+
+    return OS_AsyncWait_Impl(req, timeout);
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per public OSAL API
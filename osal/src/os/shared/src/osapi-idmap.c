@@ -103,6 +103,278 @@ OS_common_record_t *const OS_global_filesys_table   = &OS_common_table[OS_FILESY
 OS_common_record_t *const OS_global_console_table   = &OS_common_table[OS_CONSOLE_BASE];
 OS_common_record_t *const OS_global_condvar_table   = &OS_common_table[OS_CONDVAR_BASE];
 
+/*
+ * Hashed index of object names
+ *
+ * Each object type uses its own range of buckets, twice the size of its
+ * table, so the index is never more than half full.  Each bucket holds a
+ * 16 bit hash of the name in the upper half and the object array index
+ * plus one in the lower half, with zero meaning empty.  The index is only
+ * modified while holding the global lock for the object type.
+ */
+#define OS_NAME_INDEX_TAG_SHIFT 16
+#define OS_NAME_INDEX_IDX_MASK  0xFFFF
+
+static uint32 OS_name_index[2 * OS_MAX_TOTAL_RECORDS];
+
+/*
+ * Accessors for the record fields that may be read or modified without
+ * holding the global table lock.
+ *
+ * When OSAL_CONFIG_IDMAP_LOCKFREE_REFCOUNT is enabled, REFCOUNT lookups and
+ * releases do not take the global table lock, so the active_id and refcount
+ * fields are always accessed atomically.  The ID in each record already
+ * includes a serial number that changes on every create/delete, so it serves
+ * as the generation check for a lock-free lookup.  The refcount itself is
+ * never cleared when a record is reused, so the increment made by a lookup
+ * with a stale ID and the decrement that undoes it always apply to the same
+ * count, whichever object owns the record in between.
+ */
+#ifdef OSAL_CONFIG_IDMAP_LOCKFREE_REFCOUNT
+
+static inline osal_id_t OS_ObjectIdGetActive(const OS_common_record_t *obj)
+{
+    osal_id_t id;
+
+    __atomic_load(&obj->active_id, &id, __ATOMIC_SEQ_CST);
+    return id;
+}
+
+static inline void OS_ObjectIdSetActive(OS_common_record_t *obj, osal_id_t id)
+{
+    __atomic_store(&obj->active_id, &id, __ATOMIC_SEQ_CST);
+}
+
+static inline uint16 OS_ObjectIdGetRefcount(const OS_common_record_t *obj)
+{
+    return __atomic_load_n(&obj->refcount, __ATOMIC_SEQ_CST);
+}
+
+static inline void OS_ObjectIdIncrRefcount(OS_common_record_t *obj)
+{
+    __atomic_add_fetch(&obj->refcount, 1, __ATOMIC_SEQ_CST);
+}
+
+static inline void OS_ObjectIdDecrRefcount(OS_common_record_t *obj)
+{
+    uint16 count = __atomic_load_n(&obj->refcount, __ATOMIC_SEQ_CST);
+
+    while (count > 0 &&
+           !__atomic_compare_exchange_n(&obj->refcount, &count, count - 1, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST))
+    {
+        /* count was reloaded by the failed exchange, retry */
+    }
+}
+
+#else
+
+static inline osal_id_t OS_ObjectIdGetActive(const OS_common_record_t *obj)
+{
+    return obj->active_id;
+}
+
+static inline void OS_ObjectIdSetActive(OS_common_record_t *obj, osal_id_t id)
+{
+    obj->active_id = id;
+}
+
+static inline uint16 OS_ObjectIdGetRefcount(const OS_common_record_t *obj)
+{
+    return obj->refcount;
+}
+
+static inline void OS_ObjectIdIncrRefcount(OS_common_record_t *obj)
+{
+    ++obj->refcount;
+}
+
+static inline void OS_ObjectIdDecrRefcount(OS_common_record_t *obj)
+{
+    if (obj->refcount > 0)
+    {
+        --obj->refcount;
+    }
+}
+
+#endif /* OSAL_CONFIG_IDMAP_LOCKFREE_REFCOUNT */
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Computes the hash tag of an object name (FNV-1a, folded to 16 bits)
+ *
+ *-----------------------------------------------------------------*/
+static uint32 OS_ObjectNameIndexTag(const char *name)
+{
+    uint32 hash;
+
+    hash = 2166136261u;
+    while (*name != 0)
+    {
+        hash ^= (uint8)*name;
+        hash *= 16777619u;
+        ++name;
+    }
+
+    return (hash ^ (hash >> 16)) & 0xFFFF;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Gets the range of name index buckets for an object type
+ *
+ *  returns: pointer to the first bucket, and the number of buckets in *count
+ *
+ *-----------------------------------------------------------------*/
+static uint32 *OS_ObjectNameIndexGet(osal_objtype_t idtype, uint32 *count)
+{
+    *count = 2 * OS_GetMaxForObjectType(idtype);
+    return &OS_name_index[2 * OS_GetBaseForObjectType(idtype)];
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Adds the object referred to by the token to the name index.
+ *           The global lock for the object type must be held.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_ObjectNameIndexAdd(const OS_object_token_t *token, const char *name)
+{
+    uint32 *buckets;
+    uint32  count;
+    uint32  tag;
+    uint32  pos;
+    uint32  i;
+
+    buckets = OS_ObjectNameIndexGet(token->obj_type, &count);
+    tag     = OS_ObjectNameIndexTag(name);
+    pos     = tag % count;
+
+    for (i = 0; i < count; ++i)
+    {
+        if (buckets[pos] == 0)
+        {
+            buckets[pos] = (tag << OS_NAME_INDEX_TAG_SHIFT) | (token->obj_idx + 1);
+            break;
+        }
+
+        pos = (pos + 1) % count;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Removes the object referred to by the token from the name index.
+ *           The global lock for the object type must be held.
+ *
+ *           The name of the object may already be gone at this point, so
+ *           the entry is located by its array index.  Later entries in the
+ *           same run are moved back as needed to keep them reachable.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_ObjectNameIndexRemove(const OS_object_token_t *token)
+{
+    uint32 *buckets;
+    uint32  count;
+    uint32  hole;
+    uint32  pos;
+    uint32  home;
+    uint32  i;
+
+    buckets = OS_ObjectNameIndexGet(token->obj_type, &count);
+
+    for (hole = 0; hole < count; ++hole)
+    {
+        if (buckets[hole] != 0 && (buckets[hole] & OS_NAME_INDEX_IDX_MASK) == (token->obj_idx + 1))
+        {
+            break;
+        }
+    }
+
+    if (hole >= count)
+    {
+        /* object was not indexed */
+        return;
+    }
+
+    pos = hole;
+    for (i = 1; i < count; ++i)
+    {
+        pos = (pos + 1) % count;
+        if (buckets[pos] == 0)
+        {
+            break;
+        }
+
+        /* Move the entry back if its home is not cyclically within (hole, pos] */
+        home = (buckets[pos] >> OS_NAME_INDEX_TAG_SHIFT) % count;
+        if (((pos + count - home) % count) >= ((pos + count - hole) % count))
+        {
+            buckets[hole] = buckets[pos];
+            hole          = pos;
+        }
+    }
+
+    buckets[hole] = 0;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Locates an active object with a matching name using the name index.
+ *           The object type must be set in the token, and the matching
+ *           index and ID are stored in the token.
+ *
+ *           This is an internal function and no table locking is performed here.
+ *           Locking must be done by the calling function.
+ *
+ *  returns: OS_ERR_NAME_NOT_FOUND if not found, OS_SUCCESS if match is found
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_ObjectNameIndexFind(const char *name, OS_object_token_t *token)
+{
+    OS_common_record_t *base;
+    OS_common_record_t *record;
+    uint32 *            buckets;
+    uint32              count;
+    uint32              tag;
+    uint32              pos;
+    uint32              i;
+
+    buckets       = OS_ObjectNameIndexGet(token->obj_type, &count);
+    base          = &OS_common_table[OS_GetBaseForObjectType(token->obj_type)];
+    tag           = OS_ObjectNameIndexTag(name);
+    pos           = 0;
+    token->obj_id = OS_OBJECT_ID_UNDEFINED;
+
+    if (count != 0)
+    {
+        pos = tag % count;
+    }
+
+    for (i = 0; i < count && buckets[pos] != 0; ++i)
+    {
+        if ((buckets[pos] >> OS_NAME_INDEX_TAG_SHIFT) == tag)
+        {
+            token->obj_idx = (buckets[pos] & OS_NAME_INDEX_IDX_MASK) - 1;
+            record         = OS_OBJECT_TABLE_GET(base, *token);
+
+            if (OS_ObjectIdDefined(record->active_id) && OS_ObjectNameMatch((void *)name, token, record))
+            {
+                token->obj_id = record->active_id;
+                return OS_SUCCESS;
+            }
+        }
+
+        pos = (pos + 1) % count;
+    }
+
+    return OS_ERR_NAME_NOT_FOUND;
+}
+
 /*
  *********************************************************************************
  *          IDENTIFIER MAP / UNMAP FUNCTIONS
@@ -119,6 +391,7 @@ int32 OS_ObjectIdInit(void)
 {
     memset(OS_common_table, 0, sizeof(OS_common_table));
     memset(OS_objtype_state, 0, sizeof(OS_objtype_state));
+    memset(OS_name_index, 0, sizeof(OS_name_index));
     return OS_SUCCESS;
 }
 
@@ -415,7 +688,7 @@ int32 OS_ObjectIdConvertToken(OS_object_token_t *token)
     {
         /* Validate the integrity of the ID.  As the "active_id" is a single
          * integer, we can do this check regardless of whether global is locked or not. */
-        if (OS_ObjectIdEqual(obj->active_id, expected_id))
+        if (OS_ObjectIdEqual(OS_ObjectIdGetActive(obj), expected_id))
         {
             /*
              * Got an ID match...
@@ -428,15 +701,15 @@ int32 OS_ObjectIdConvertToken(OS_object_token_t *token)
                  */
                 if (!OS_ObjectIdEqual(expected_id, OS_OBJECT_ID_RESERVED))
                 {
-                    expected_id    = OS_OBJECT_ID_RESERVED;
-                    obj->active_id = expected_id;
+                    expected_id = OS_OBJECT_ID_RESERVED;
+                    OS_ObjectIdSetActive(obj, expected_id);
                 }
 
                 /*
                  * Also confirm that reference count is zero
                  * If not zero, will need to wait for other tasks to release.
                  */
-                if (obj->refcount == 0)
+                if (OS_ObjectIdGetRefcount(obj) == 0)
                 {
                     return_code = OS_SUCCESS;
                     break;
@@ -451,7 +724,8 @@ int32 OS_ObjectIdConvertToken(OS_object_token_t *token)
                 break;
             }
         }
-        else if (token->lock_mode == OS_LOCK_MODE_NONE || !OS_ObjectIdEqual(obj->active_id, OS_OBJECT_ID_RESERVED))
+        else if (token->lock_mode == OS_LOCK_MODE_NONE ||
+                 !OS_ObjectIdEqual(OS_ObjectIdGetActive(obj), OS_OBJECT_ID_RESERVED))
         {
             /* Not an ID match and not RESERVED - fail out */
             return_code = OS_ERR_INVALID_ID;
@@ -491,7 +765,7 @@ int32 OS_ObjectIdConvertToken(OS_object_token_t *token)
         {
             /* always increment the refcount, which means a task is actively
              * using or modifying this record. */
-            ++obj->refcount;
+            OS_ObjectIdIncrRefcount(obj);
 
             /*
              * On a successful operation, the global is unlocked if it is
@@ -516,7 +790,7 @@ int32 OS_ObjectIdConvertToken(OS_object_token_t *token)
              * it back to the original value which is in the token.
              * (note it had to match initially before overwrite)
              */
-            obj->active_id = OS_ObjectIdFromToken(token);
+            OS_ObjectIdSetActive(obj, OS_ObjectIdFromToken(token));
         }
     }
 
@@ -635,11 +909,21 @@ int32 OS_ObjectIdFindNextFree(OS_object_token_t *token)
         token->obj_idx = OSAL_INDEX_C(local_id);
         OS_ObjectIdCompose_Impl(token->obj_type, serial, &token->obj_id);
 
-        /* Ensure any data in the record has been cleared */
-        obj->active_id  = token->obj_id;
+        /*
+         * Ensure any data in the record has been cleared.
+         *
+         * The refcount is the exception, it is left as is.  Every reference to
+         * the previous object was released before its record was freed, as an
+         * EXCLUSIVE lock requires the count to be zero.  Anything counted now is
+         * from a lock-free REFCOUNT lookup with a stale ID, which increments the
+         * count, then sees the ID no longer matches and decrements it again.
+         * Clearing the count here would let that decrement remove a reference
+         * taken on the new object.  The new ID is stored last, so a reader that
+         * sees it also sees the cleared fields.
+         */
         obj->name_entry = NULL;
         obj->creator    = OS_TaskGetId();
-        obj->refcount   = 0;
+        OS_ObjectIdSetActive(obj, token->obj_id);
 
         /* preemptively update the last id issued */
         objtype_state->last_id_issued = token->obj_id;
@@ -947,7 +1231,22 @@ int32 OS_ObjectIdGetBySearch(OS_lock_mode_t lock_mode, osal_objtype_t idtype, OS
  *-----------------------------------------------------------------*/
 int32 OS_ObjectIdGetByName(OS_lock_mode_t lock_mode, osal_objtype_t idtype, const char *name, OS_object_token_t *token)
 {
-    return OS_ObjectIdGetBySearch(lock_mode, idtype, OS_ObjectNameMatch, (void *)name, token);
+    int32 return_code;
+
+    OS_ObjectIdTransactionInit(lock_mode, idtype, token);
+
+    return_code = OS_ObjectNameIndexFind(name, token);
+
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_ObjectIdConvertToken(token);
+    }
+    else
+    {
+        OS_ObjectIdTransactionCancel(token);
+    }
+
+    return return_code;
 }
 
 /*----------------------------------------------------------------
@@ -983,6 +1282,55 @@ int32 OS_ObjectIdFindByName(osal_objtype_t idtype, const char *name, osal_id_t *
     return return_code;
 }
 
+#ifdef OSAL_CONFIG_IDMAP_LOCKFREE_REFCOUNT
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *   Attempts to obtain a REFCOUNT lock on the given ID without taking
+ *   the global table lock.
+ *
+ *   The refcount is incremented only while the ID in the record matches,
+ *   and the ID is checked again afterward.  An EXCLUSIVE lock sets the ID
+ *   to RESERVED before checking that the refcount is zero, so with both
+ *   sides using sequentially consistent atomics, at least one of them will
+ *   see the other and back off.
+ *
+ *   Returns: true if the token now holds a REFCOUNT lock,
+ *            false if the caller should use the locked path.
+ *
+ *-----------------------------------------------------------------*/
+static bool OS_ObjectIdRefcountLockFree(osal_objtype_t idtype, osal_id_t id, OS_object_token_t *token)
+{
+    OS_common_record_t *obj;
+
+    if (OS_ObjectIdTransactionInit(OS_LOCK_MODE_NONE, idtype, token) != OS_SUCCESS ||
+        OS_ObjectIdToArrayIndex(idtype, id, &token->obj_idx) != OS_SUCCESS)
+    {
+        return false;
+    }
+
+    obj = OS_ObjectIdGlobalFromToken(token);
+    if (!OS_ObjectIdIsValid(id) || !OS_ObjectIdEqual(OS_ObjectIdGetActive(obj), id))
+    {
+        return false;
+    }
+
+    OS_ObjectIdIncrRefcount(obj);
+
+    if (!OS_ObjectIdEqual(OS_ObjectIdGetActive(obj), id))
+    {
+        /* lost a race with a delete or exclusive lock */
+        OS_ObjectIdDecrRefcount(obj);
+        return false;
+    }
+
+    token->obj_id    = id;
+    token->lock_mode = OS_LOCK_MODE_REFCOUNT;
+
+    return true;
+}
+#endif
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Local helper routine, not part of OSAL API.
@@ -1001,6 +1349,19 @@ int32 OS_ObjectIdGetById(OS_lock_mode_t lock_mode, osal_objtype_t idtype, osal_i
 {
     int32 return_code;
 
+#ifdef OSAL_CONFIG_IDMAP_LOCKFREE_REFCOUNT
+    /*
+     * Most REFCOUNT lookups are for an object that is not being created or
+     * deleted, and can be satisfied without the global table lock.  If the
+     * lock-free attempt does not succeed, use the normal path, which handles
+     * contention and returns the appropriate error.
+     */
+    if (lock_mode == OS_LOCK_MODE_REFCOUNT && OS_ObjectIdRefcountLockFree(idtype, id, token))
+    {
+        return OS_SUCCESS;
+    }
+#endif
+
     return_code = OS_ObjectIdTransactionInit(lock_mode, idtype, token);
     if (return_code != OS_SUCCESS)
     {
@@ -1055,16 +1416,35 @@ void OS_ObjectIdTransactionFinish(OS_object_token_t *token, const osal_id_t *fin
 
     record = OS_ObjectIdGlobalFromToken(token);
 
+#ifdef OSAL_CONFIG_IDMAP_LOCKFREE_REFCOUNT
+    /*
+     * A plain REFCOUNT release does not change the ID, so the refcount
+     * can be dropped without the global table lock.  The lock is only
+     * cycled if a delete is waiting on this record (ID set to RESERVED)
+     * so that the waiting task is woken promptly.
+     */
+    if (token->lock_mode == OS_LOCK_MODE_REFCOUNT && final_id == NULL)
+    {
+        OS_ObjectIdDecrRefcount(record);
+
+        if (OS_ObjectIdEqual(OS_ObjectIdGetActive(record), OS_OBJECT_ID_RESERVED))
+        {
+            OS_Lock_Global(token);
+            OS_Unlock_Global(token);
+        }
+
+        token->lock_mode = OS_LOCK_MODE_NONE;
+        return;
+    }
+#endif
+
     /* re-acquire global table lock to adjust refcount */
     if (token->lock_mode == OS_LOCK_MODE_EXCLUSIVE || token->lock_mode == OS_LOCK_MODE_REFCOUNT)
     {
         OS_Lock_Global(token);
     }
 
-    if (record->refcount > 0)
-    {
-        --record->refcount;
-    }
+    OS_ObjectIdDecrRefcount(record);
 
     /*
      * at this point the global mutex is always held, either
@@ -1076,7 +1456,13 @@ void OS_ObjectIdTransactionFinish(OS_object_token_t *token, const osal_id_t *fin
      */
     if (final_id != NULL)
     {
-        record->active_id = *final_id;
+        /* an object being returned to the pool must also leave the name index */
+        if (!OS_ObjectIdDefined(*final_id))
+        {
+            OS_ObjectNameIndexRemove(token);
+        }
+
+        OS_ObjectIdSetActive(record, *final_id);
     }
     else if (token->lock_mode == OS_LOCK_MODE_EXCLUSIVE)
     {
@@ -1085,7 +1471,7 @@ void OS_ObjectIdTransactionFinish(OS_object_token_t *token, const osal_id_t *fin
          * was reset to OS_OBJECT_ID_RESERVED.  This must restore the original
          * object ID from the token.
          */
-        record->active_id = token->obj_id;
+        OS_ObjectIdSetActive(record, token->obj_id);
     }
 
     /* always unlock (this also covers OS_LOCK_MODE_GLOBAL case) */
@@ -1167,7 +1553,7 @@ int32 OS_ObjectIdAllocateNew(osal_objtype_t idtype, const char *name, OS_object_
      */
     if (name != NULL)
     {
-        return_code = OS_ObjectIdFindNextMatch(OS_ObjectNameMatch, (void *)name, token);
+        return_code = OS_ObjectNameIndexFind(name, token);
     }
     else
     {
@@ -1183,6 +1569,18 @@ int32 OS_ObjectIdAllocateNew(osal_objtype_t idtype, const char *name, OS_object_
         return_code = OS_ObjectIdFindNextFree(token);
     }
 
+    /*
+     * Index the name now, while the global lock still protects the index.
+     * The entry does not match any lookup until the caller sets name_entry,
+     * which happens after the lock is released, so a lookup by name sees
+     * the object only from that point on.  This is the same visibility as
+     * a scan of the table records, the index only makes the lookup faster.
+     */
+    if (return_code == OS_SUCCESS && name != NULL)
+    {
+        OS_ObjectNameIndexAdd(token, name);
+    }
+
     /* If allocation failed, abort the operation now - no ID was allocated.
      * After this point, if a future step fails, the allocated ID must be
      * released. */
@@ -1209,6 +1607,31 @@ int32 OS_ObjectIdAllocateNew(osal_objtype_t idtype, const char *name, OS_object_
     return return_code;
 }
 
+/*----------------------------------------------------------------
+
+    Purpose: Set or change the name of an object
+ ------------------------------------------------------------------*/
+void OS_ObjectIdSetName(const OS_object_token_t *token, const char *name)
+{
+    OS_object_token_t   lock_token;
+    OS_common_record_t *record;
+
+    /* use a copy, as locking updates the key in the token */
+    lock_token = *token;
+    record     = OS_ObjectIdGlobalFromToken(token);
+
+    OS_Lock_Global(&lock_token);
+
+    OS_ObjectNameIndexRemove(token);
+    record->name_entry = name;
+    if (name != NULL)
+    {
+        OS_ObjectNameIndexAdd(token, name);
+    }
+
+    OS_Unlock_Global(&lock_token);
+}
+
 /*----------------------------------------------------------------
 
     Purpose: Transfer ownership of a token to another buffer
@@ -32,6 +32,10 @@
  *      the machine's C library does not provide this function, the user
  *      would have to provide a compatible substitute to link to.
  *
+ *      The string is formatted into a buffer on the caller's stack, so no
+ *      lock is held while formatting.  It is then copied into the console
+ *      ring buffer, which is also done without a lock, see os-shared-console.h.
+ *
  *      Once the string is formatted, it is passed to the lower level
  *      implementation to do the actual output.  This would typically write
  *      to a console device but may alternatively write to any other
@@ -53,6 +57,7 @@
 #include "os-shared-common.h"
 #include "os-shared-idmap.h"
 #include "os-shared-printf.h"
+#include "os-shared-task.h"
 
 /*
  * The choice of whether to run a separate utility task
@@ -64,8 +69,10 @@
 #define OS_CONSOLE_IS_ASYNC false
 #endif
 
-/* reserve buffer memory for the printf console device */
-static char OS_printf_buffer_mem[(sizeof(OS_PRINTF_CONSOLE_NAME) + OS_BUFFER_SIZE) * OS_BUFFER_MSG_DEPTH];
+/* reserve buffer memory for the printf console device, aligned for the record headers */
+static uint32 OS_printf_buffer_mem[(OS_CONSOLE_RECORD_SIZE(sizeof(OS_PRINTF_CONSOLE_NAME) + OS_BUFFER_SIZE) *
+                                    OS_BUFFER_MSG_DEPTH) /
+                                   sizeof(uint32)];
 
 /* The global console state table */
 OS_console_internal_record_t OS_console_table[OS_MAX_CONSOLES];
@@ -103,9 +110,10 @@ int32 OS_ConsoleAPI_Init(void)
         /*
          * Initialize the ring buffer pointers
          */
-        console->BufBase = OS_printf_buffer_mem;
-        console->BufSize = sizeof(OS_printf_buffer_mem);
-        console->IsAsync = OS_CONSOLE_IS_ASYNC;
+        console->BufBase         = (char *)OS_printf_buffer_mem;
+        console->BufSize         = sizeof(OS_printf_buffer_mem);
+        console->IsAsync         = OS_CONSOLE_IS_ASYNC;
+        console->OverflowTimeout = OS_PRINTF_OVERFLOW_TIMEOUT;
 
         return_code = OS_ConsoleCreate_Impl(&token);
 
@@ -130,53 +138,108 @@ int32 OS_ConsoleAPI_Init(void)
 /*----------------------------------------------------------------
  *
  *  Purpose: Local helper routine, not part of OSAL API.
- *    Write into the console ring buffer
+ *    Reserve space for a record in the console ring buffer
  *
- *    The NextWritePos is an input-output and contains the position
- *    in the ring buffer to start writing into.  This may or may not
- *    be the same as the value in the global.  It is only updated
- *    if the string is written in its entirety.
+ *    Any number of writers may call this concurrently.  The space
+ *    is claimed by atomically advancing the WritePos, so each writer
+ *    gets a distinct record.  The record header is left as zero
+ *    (incomplete) until the writer has copied in the whole message.
  *
- *    The intent is to avoid truncating a string if it does not fit.
- *    Either the entire string should be written, or none of it.
+ *    If there is not enough space, and the console is asynchronous,
+ *    the writer may wait for the utility task to make room, up to
+ *    the configured overflow timeout.
  *
  *-----------------------------------------------------------------*/
-static int32 OS_Console_CopyOut(OS_console_internal_record_t *console, const char *Str, size_t *NextWritePos)
+static int32 OS_Console_Reserve(const OS_object_token_t *token, OS_console_internal_record_t *console,
+                                size_t RecordSize, size_t *RecordPos)
 {
-    const char *pmsg;
-    size_t      WriteOffset;
-    int32       return_code;
-
-    return_code = OS_ERROR;
-    pmsg        = Str;
-    WriteOffset = *NextWritePos;
+    size_t StartPos;
+    size_t EndPos;
+    size_t ReadPos;
+    size_t UsedSize;
+    uint32 WaitTime;
+
+    WaitTime = 0;
+    StartPos = __atomic_load_n(&console->WritePos, __ATOMIC_RELAXED);
     while (true)
     {
-        if (*pmsg == 0)
+        ReadPos = __atomic_load_n(&console->ReadPos, __ATOMIC_ACQUIRE);
+        if (StartPos >= ReadPos)
         {
-            /* String is complete */
-            *NextWritePos = WriteOffset;
-            return_code   = OS_SUCCESS;
-            break;
+            UsedSize = StartPos - ReadPos;
         }
-        console->BufBase[WriteOffset] = *pmsg;
-        WriteOffset                   = WriteOffset + 1;
-        if (WriteOffset >= console->BufSize)
+        else
         {
-            WriteOffset = 0;
+            UsedSize = console->BufSize - ReadPos + StartPos;
         }
 
-        if (WriteOffset == console->ReadPos)
+        /* The buffer is never filled completely, so that full is distinguishable from empty */
+        if ((UsedSize + RecordSize) < console->BufSize)
+        {
+            EndPos = StartPos + RecordSize;
+            if (EndPos >= console->BufSize)
+            {
+                EndPos -= console->BufSize;
+            }
+
+            if (__atomic_compare_exchange_n(&console->WritePos, &StartPos, EndPos, false, __ATOMIC_ACQ_REL,
+                                            __ATOMIC_RELAXED))
+            {
+                *RecordPos = StartPos;
+                return OS_SUCCESS;
+            }
+
+            /* another writer got there first; StartPos was reloaded, so retry */
+        }
+        else if (console->IsAsync && WaitTime < console->OverflowTimeout)
+        {
+            /* out of space - give the utility task a chance to drain the buffer */
+            OS_ConsoleWakeup_Impl(token);
+            OS_TaskDelay_Impl(1);
+            ++WaitTime;
+            StartPos = __atomic_load_n(&console->WritePos, __ATOMIC_RELAXED);
+        }
+        else
         {
             /* out of space */
-            return_code = OS_QUEUE_FULL;
-            break;
+            return OS_QUEUE_FULL;
         }
-
-        ++pmsg;
     }
+}
 
-    return return_code;
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *    Copy characters into a reserved record in the console ring buffer
+ *
+ *    The WriteOffset is an input-output and contains the position
+ *    in the ring buffer to start writing into.  The data may wrap
+ *    around the end of the buffer.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_Console_CopyOut(OS_console_internal_record_t *console, const char *Str, size_t Len,
+                               size_t *WriteOffset)
+{
+    size_t ChunkSize;
+
+    while (Len > 0)
+    {
+        ChunkSize = console->BufSize - *WriteOffset;
+        if (ChunkSize > Len)
+        {
+            ChunkSize = Len;
+        }
+
+        memcpy(&console->BufBase[*WriteOffset], Str, ChunkSize);
+
+        Str += ChunkSize;
+        Len -= ChunkSize;
+        *WriteOffset += ChunkSize;
+        if (*WriteOffset >= console->BufSize)
+        {
+            *WriteOffset = 0;
+        }
+    }
 }
 
 /*
@@ -196,46 +259,59 @@ int32 OS_ConsoleWrite(osal_id_t console_id, const char *Str)
     int32                         return_code;
     OS_object_token_t             token;
     OS_console_internal_record_t *console;
-    size_t                        PendingWritePos;
+    size_t                        NameLen;
+    size_t                        MsgLen;
+    size_t                        RecordPos;
+    size_t                        WriteOffset;
 
-    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_GLOBAL, OS_OBJECT_TYPE_OS_CONSOLE, console_id, &token);
+    /*
+     * Only a reference is needed here - the ring buffer is safe
+     * for concurrent writers, so the console is not locked.
+     */
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, OS_OBJECT_TYPE_OS_CONSOLE, console_id, &token);
     if (return_code == OS_SUCCESS)
     {
         console = OS_OBJECT_TABLE_GET(OS_console_table, token);
 
+        NameLen = strlen(console->device_name);
+        MsgLen  = NameLen + strlen(Str);
+
         /*
          * The entire string should be put to the ring buffer,
-         * or none of it.  Therefore the WritePos in the table
-         * is not updated until complete success.
+         * or none of it.  Therefore the space for the whole
+         * record is reserved first.
          */
-        PendingWritePos = console->WritePos;
-
-        if (console->device_name[0] != 0)
+        if (MsgLen == 0)
         {
-            return_code = OS_Console_CopyOut(console, console->device_name, &PendingWritePos);
+            /* nothing to write (and a zero length record would never be seen as complete) */
         }
-        if (return_code == OS_SUCCESS)
+        else if (OS_Console_Reserve(&token, console, OS_CONSOLE_RECORD_SIZE(MsgLen), &RecordPos) == OS_SUCCESS)
         {
-            return_code = OS_Console_CopyOut(console, Str, &PendingWritePos);
-        }
+            WriteOffset = RecordPos + OS_CONSOLE_RECORD_ALIGN;
+            if (WriteOffset >= console->BufSize)
+            {
+                WriteOffset = 0;
+            }
 
-        if (return_code == OS_SUCCESS)
-        {
-            /* the entire message was successfully written */
-            console->WritePos = PendingWritePos;
+            OS_Console_CopyOut(console, console->device_name, NameLen, &WriteOffset);
+            OS_Console_CopyOut(console, Str, MsgLen - NameLen, &WriteOffset);
+
+            /* the entire message was successfully written, mark the record complete */
+            __atomic_store_n((uint32 *)&console->BufBase[RecordPos], (uint32)MsgLen, __ATOMIC_RELEASE);
         }
         else
         {
             /* the message did not fit */
-            ++console->OverflowEvents;
+            __atomic_add_fetch(&console->OverflowEvents, 1, __ATOMIC_RELAXED);
+            return_code = OS_QUEUE_FULL;
         }
 
         /*
          * Notify the underlying console implementation of new data.
          * This will forward the data to the actual console device.
          *
-         * This is done while still locked, so it can support
-         * either a synchronous or asynchronous implementation.
+         * The implementation serializes the reader side, so this
+         * can support either a synchronous or asynchronous implementation.
          */
         if (console->IsAsync)
         {
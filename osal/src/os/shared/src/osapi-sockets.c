@@ -233,7 +233,6 @@ int32 OS_SocketListen(osal_id_t sock_id)
  *-----------------------------------------------------------------*/
 int32 OS_SocketBindAddress(osal_id_t sock_id, const OS_SockAddr_t *Addr)
 {
-    OS_common_record_t *         record;
     OS_stream_internal_record_t *stream;
     OS_object_token_t            token;
     int32                        return_code;
@@ -244,7 +243,6 @@ int32 OS_SocketBindAddress(osal_id_t sock_id, const OS_SockAddr_t *Addr)
     return_code = OS_ObjectIdGetById(OS_LOCK_MODE_EXCLUSIVE, LOCAL_OBJID_TYPE, sock_id, &token);
     if (return_code == OS_SUCCESS)
     {
-        record = OS_OBJECT_TABLE_GET(OS_global_stream_table, token);
         stream = OS_OBJECT_TABLE_GET(OS_stream_table, token);
 
         if (stream->socket_domain == OS_SocketDomain_INVALID)
@@ -264,7 +262,7 @@ int32 OS_SocketBindAddress(osal_id_t sock_id, const OS_SockAddr_t *Addr)
             if (return_code == OS_SUCCESS)
             {
                 OS_CreateSocketName(&token, Addr, NULL);
-                record->name_entry = stream->stream_name;
+                OS_ObjectIdSetName(&token, stream->stream_name);
                 stream->stream_state |= OS_STREAM_STATE_BOUND;
             }
         }
@@ -284,7 +282,6 @@ int32 OS_SocketBindAddress(osal_id_t sock_id, const OS_SockAddr_t *Addr)
 int32 OS_SocketAcceptAbs(osal_id_t sock_id, osal_id_t *connsock_id, OS_SockAddr_t *Addr, OS_time_t abs_timeout)
 {
     OS_common_record_t *         sock_record;
-    OS_common_record_t *         conn_record;
     OS_stream_internal_record_t *sock;
     OS_stream_internal_record_t *conn;
     OS_object_token_t            sock_token;
@@ -302,7 +299,6 @@ int32 OS_SocketAcceptAbs(osal_id_t sock_id, osal_id_t *connsock_id, OS_SockAddr_
      * return_code is checked, and return_code is only
      * set to OS_SUCCESS when connrecord is also initialized)
      */
-    conn_record = NULL;
     sock_record = NULL;
     sock        = NULL;
     conn        = NULL;
@@ -331,8 +327,7 @@ int32 OS_SocketAcceptAbs(osal_id_t sock_id, osal_id_t *connsock_id, OS_SockAddr_
             return_code = OS_ObjectIdAllocateNew(LOCAL_OBJID_TYPE, NULL, &conn_token);
             if (return_code == OS_SUCCESS)
             {
-                conn_record = OS_OBJECT_TABLE_GET(OS_global_stream_table, conn_token);
-                conn        = OS_OBJECT_TABLE_GET(OS_stream_table, conn_token);
+                conn = OS_OBJECT_TABLE_GET(OS_stream_table, conn_token);
 
                 /* Incr the refcount to record the fact that an operation is pending on this */
                 memset(conn, 0, sizeof(OS_stream_internal_record_t));
@@ -348,7 +343,7 @@ int32 OS_SocketAcceptAbs(osal_id_t sock_id, osal_id_t *connsock_id, OS_SockAddr_
                 {
                     /* Generate an entry name based on the remote address */
                     OS_CreateSocketName(&conn_token, Addr, sock_record->name_entry);
-                    conn_record->name_entry = conn->stream_name;
+                    OS_ObjectIdSetName(&conn_token, conn->stream_name);
                     conn->stream_state |= OS_STREAM_STATE_CONNECTED;
                 }
 
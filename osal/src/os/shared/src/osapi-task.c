@@ -314,6 +314,30 @@ int32 OS_TaskSetPriority(osal_id_t task_id, osal_priority_t new_priority)
     return return_code;
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_TaskSetAffinity(osal_id_t task_id, uint32 cpu_mask)
+{
+    int32             return_code;
+    OS_object_token_t token;
+
+    ARGCHECK(cpu_mask != 0, OS_ERR_INVALID_ARGUMENT);
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_GLOBAL, LOCAL_OBJID_TYPE, task_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_TaskSetAffinity_Impl(&token, cpu_mask);
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per public OSAL API
@@ -389,6 +413,31 @@ int32 OS_TaskGetInfo(osal_id_t task_id, OS_task_prop_t *task_prop)
     return return_code;
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_TaskGetCpuTime(osal_id_t task_id, OS_time_t *cpu_time)
+{
+    int32             return_code;
+    OS_object_token_t token;
+
+    /* Check parameters */
+    OS_CHECK_POINTER(cpu_time);
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_GLOBAL, LOCAL_OBJID_TYPE, task_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_TaskGetCpuTime_Impl(&token, cpu_time);
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per public OSAL API
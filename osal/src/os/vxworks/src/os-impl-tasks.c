@@ -347,6 +347,18 @@ int32 OS_TaskSetPriority_Impl(const OS_object_token_t *token, osal_priority_t ne
     return OS_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_TaskSetAffinity_Impl(const OS_object_token_t *token, uint32 cpu_mask)
+{
+    /* CPU affinity is not supported by this implementation */
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per internal OSAL API
@@ -419,6 +431,18 @@ int32 OS_TaskGetInfo_Impl(const OS_object_token_t *token, OS_task_prop_t *task_p
     return OS_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_TaskGetCpuTime_Impl(const OS_object_token_t *token, OS_time_t *cpu_time)
+{
+    /* VxWorks only keeps per-task execution time with the optional spy library */
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per internal OSAL API
@@ -33,6 +33,7 @@ void TestCreatRemove(void);
 void TestOpenClose(void);
 void TestChmod(void);
 void TestReadWriteLseek(void);
+void TestAsyncWrite(void);
 void TestMkRmDirFreeBytes(void);
 void TestOpenReadCloseDir(void);
 void TestRename(void);
@@ -79,6 +80,7 @@ void UtTest_Setup(void)
     UtTest_Add(TestOpenClose, NULL, NULL, "TestOpenClose");
     UtTest_Add(TestChmod, NULL, NULL, "TestChmod");
     UtTest_Add(TestReadWriteLseek, NULL, NULL, "TestReadWriteLseek");
+    UtTest_Add(TestAsyncWrite, NULL, NULL, "TestAsyncWrite");
     UtTest_Add(TestMkRmDirFreeBytes, NULL, NULL, "TestMkRmDirFreeBytes");
     UtTest_Add(TestOpenReadCloseDir, NULL, NULL, "TestOpenReadCloseDir");
     UtTest_Add(TestStat, NULL, NULL, "TestStat");
@@ -434,6 +436,96 @@ void TestReadWriteLseek(void)
     UtAssert_True(status == OS_SUCCESS, "status after remove = %d", (int)status);
 }
 
+/*---------------------------------------------------------------------------------------
+ *  Name TestAsyncWrite()
+---------------------------------------------------------------------------------------*/
+#define ASYNC_TEST_BLOCKS    16
+#define ASYNC_TEST_BLOCKSIZE 512
+
+static uint32 AsyncCallbackCount;
+
+static void TestAsyncWriteCallback(OS_AsyncIo_t *req)
+{
+    ++AsyncCallbackCount;
+}
+
+void TestAsyncWrite(void)
+{
+    static uint8 blocks[ASYNC_TEST_BLOCKS][ASYNC_TEST_BLOCKSIZE];
+    static uint8 readback[ASYNC_TEST_BLOCKSIZE];
+    OS_AsyncIo_t req[ASYNC_TEST_BLOCKS];
+    uint8        tail[8];
+    uint32       i;
+    int32        status;
+    osal_id_t    fd = OS_OBJECT_ID_UNDEFINED;
+
+    memset(req, 0, sizeof(req));
+    memset(tail, 0xEE, sizeof(tail));
+    AsyncCallbackCount = 0;
+
+    /* A request that was never submitted is not pending */
+    UtAssert_INT32_EQ(OS_AsyncWait(&req[0], OS_CHECK), OS_SUCCESS);
+
+    UtAssert_INT32_EQ(OS_OpenCreate(&fd, "/drive0/AsyncFile", OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE,
+                                    OS_READ_WRITE),
+                      OS_SUCCESS);
+
+    for (i = 0; i < ASYNC_TEST_BLOCKS; ++i)
+    {
+        memset(blocks[i], 'A' + i, sizeof(blocks[i]));
+        req[i].Callback    = TestAsyncWriteCallback;
+        req[i].CallbackArg = &blocks[i];
+
+        status = OS_AsyncWrite(fd, blocks[i], sizeof(blocks[i]), &req[i]);
+        if (status == OS_ERR_NOT_IMPLEMENTED)
+        {
+            UtAssert_NA("Asynchronous I/O not implemented on this platform");
+            OS_close(fd);
+            OS_remove("/drive0/AsyncFile");
+            return;
+        }
+        UtAssert_INT32_EQ(status, OS_SUCCESS);
+    }
+
+    /* a synchronous write follows on after all the queued data */
+    UtAssert_INT32_EQ(OS_write(fd, tail, sizeof(tail)), sizeof(tail));
+
+    for (i = 0; i < ASYNC_TEST_BLOCKS; ++i)
+    {
+        UtAssert_INT32_EQ(OS_AsyncWait(&req[i], OS_PEND), OS_SUCCESS);
+        UtAssert_BOOL_FALSE(req[i].IsPending);
+        UtAssert_INT32_EQ(req[i].Result, ASYNC_TEST_BLOCKSIZE);
+    }
+    UtAssert_UINT32_EQ(AsyncCallbackCount, ASYNC_TEST_BLOCKS);
+
+    /* the request block may be reused once complete */
+    UtAssert_INT32_EQ(OS_AsyncWrite(fd, tail, sizeof(tail), &req[0]), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_AsyncWait(&req[0], 1000), OS_SUCCESS);
+    UtAssert_INT32_EQ(req[0].Result, sizeof(tail));
+
+    /* Bad arguments */
+    UtAssert_INT32_EQ(OS_AsyncWrite(OS_OBJECT_ID_UNDEFINED, tail, sizeof(tail), &req[0]), OS_ERR_INVALID_ID);
+    UtAssert_INT32_EQ(OS_AsyncWrite(fd, NULL, sizeof(tail), &req[0]), OS_INVALID_POINTER);
+    UtAssert_INT32_EQ(OS_AsyncWrite(fd, tail, sizeof(tail), NULL), OS_INVALID_POINTER);
+    UtAssert_INT32_EQ(OS_AsyncWait(NULL, OS_PEND), OS_INVALID_POINTER);
+
+    UtAssert_INT32_EQ(OS_close(fd), OS_SUCCESS);
+
+    /* Verify the data landed in submission order */
+    UtAssert_INT32_EQ(OS_OpenCreate(&fd, "/drive0/AsyncFile", OS_FILE_FLAG_NONE, OS_READ_ONLY), OS_SUCCESS);
+    for (i = 0; i < ASYNC_TEST_BLOCKS; ++i)
+    {
+        UtAssert_INT32_EQ(OS_read(fd, readback, sizeof(readback)), sizeof(readback));
+        UtAssert_True(memcmp(readback, blocks[i], sizeof(readback)) == 0, "Block %u content", (unsigned int)i);
+    }
+    memset(readback, 0, sizeof(readback));
+    UtAssert_INT32_EQ(OS_read(fd, readback, sizeof(readback)), 2 * sizeof(tail));
+    UtAssert_True(memcmp(readback, tail, sizeof(tail)) == 0, "Trailing synchronous write content");
+    UtAssert_INT32_EQ(OS_close(fd), OS_SUCCESS);
+
+    UtAssert_INT32_EQ(OS_remove("/drive0/AsyncFile"), OS_SUCCESS);
+}
+
 /*---------------------------------------------------------------------------------------
  *  Name TestMkRmDir()
 ---------------------------------------------------------------------------------------*/
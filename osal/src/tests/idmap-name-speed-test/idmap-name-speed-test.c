@@ -0,0 +1,170 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** Object Name Lookup Speed Test
+**
+** This is a simple way to gauge the cost of creating objects
+** and looking up an object ID by name on a given machine.
+**
+** Binary semaphores are used as they need no kernel resources
+** beyond memory, so the table can be configured large.  The table
+** is filled to 10, 100 and 1000 objects in turn.  The time taken to
+** create all the objects from an empty table is reported, as it is
+** what startup pays for that many objects.  Then the name of the
+** most recently created semaphore (the last one a table scan would
+** reach) and a name that does not exist are each looked up repeatedly,
+** and the average time per lookup is reported.  With the name index
+** the lookup time should not grow with the number of objects.
+**
+** Counts above OS_MAX_BIN_SEMAPHORES are skipped.  To measure all of
+** them, build with OSAL_CONFIG_MAX_BIN_SEMAPHORES of at least 1000.
+*/
+#include <stdio.h>
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+/*
+ * Number of lookups timed for each object count
+ */
+#define NAMETEST_ITERATIONS 100000
+
+/* Define setup and test functions for UT assert */
+void NameSpeedSetup(void);
+void NameSpeedRun(void);
+void NameSpeedTeardown(void);
+
+/*
+ * Object counts at which the startup and lookup times are reported
+ */
+static const uint32 NAMETEST_COUNTS[] = {10, 100, 1000};
+
+osal_id_t sem_ids[OS_MAX_BIN_SEMAPHORES];
+uint32    num_sems;
+
+/*
+ * Returns the average time of one lookup of the given name, in nanoseconds
+ */
+static int64 NameSpeedMeasure(const char *name, int32 expected_status)
+{
+    OS_time_t start_time;
+    OS_time_t end_time;
+    osal_id_t id;
+    int32     status;
+    uint32    i;
+
+    status = expected_status;
+    OS_GetLocalTime(&start_time);
+    for (i = 0; i < NAMETEST_ITERATIONS && status == expected_status; ++i)
+    {
+        status = OS_BinSemGetIdByName(&id, name);
+    }
+    OS_GetLocalTime(&end_time);
+
+    UtAssert_True(status == expected_status, "OS_BinSemGetIdByName(%s) Rc=%d", name, (int)status);
+
+    return OS_TimeGetTotalNanoseconds(OS_TimeSubtract(end_time, start_time)) / NAMETEST_ITERATIONS;
+}
+
+void UtTest_Setup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    /* the test should call OS_API_Teardown() before exiting */
+    UtTest_AddTeardown(OS_API_Teardown, "Cleanup");
+
+    /*
+     * Register the test setup and check routines in UT assert
+     */
+    UtTest_Add(NameSpeedRun, NameSpeedSetup, NameSpeedTeardown, "NameSpeedTest");
+}
+
+void NameSpeedSetup(void)
+{
+    num_sems = 0;
+}
+
+void NameSpeedRun(void)
+{
+    char      name[OS_MAX_API_NAME];
+    OS_time_t start_time;
+    OS_time_t end_time;
+    int64     create_ns;
+    uint32    step;
+    uint32    target;
+    int32     status;
+    int64     found_ns;
+    int64     missing_ns;
+
+    create_ns = 0;
+
+    for (step = 0; step < sizeof(NAMETEST_COUNTS) / sizeof(NAMETEST_COUNTS[0]); ++step)
+    {
+        target = NAMETEST_COUNTS[step];
+        if (target > OS_MAX_BIN_SEMAPHORES)
+        {
+            UtAssert_NA("%u objects exceeds OS_MAX_BIN_SEMAPHORES (%u)", (unsigned int)target,
+                        (unsigned int)OS_MAX_BIN_SEMAPHORES);
+            continue;
+        }
+
+        /* Creates are timed together, including the check for a duplicate name each one makes */
+        OS_GetLocalTime(&start_time);
+        while (num_sems < target)
+        {
+            snprintf(name, sizeof(name), "NameTest%u", (unsigned int)num_sems);
+            status = OS_BinSemCreate(&sem_ids[num_sems], name, 0, 0);
+            if (status != OS_SUCCESS)
+            {
+                break;
+            }
+            ++num_sems;
+        }
+        OS_GetLocalTime(&end_time);
+        create_ns += OS_TimeGetTotalNanoseconds(OS_TimeSubtract(end_time, start_time));
+
+        UtAssert_True(num_sems == target, "Created %u of %u semaphores", (unsigned int)num_sems,
+                      (unsigned int)target);
+        if (num_sems != target)
+        {
+            break;
+        }
+
+        snprintf(name, sizeof(name), "NameTest%u", (unsigned int)(num_sems - 1));
+        found_ns   = NameSpeedMeasure(name, OS_SUCCESS);
+        missing_ns = NameSpeedMeasure("NameTestNone", OS_ERR_NAME_NOT_FOUND);
+
+        UtPrintf("%u objects: create all %ld us, lookup found %ld ns, not found %ld ns\n", (unsigned int)num_sems,
+                 (long)(create_ns / 1000), (long)found_ns, (long)missing_ns);
+    }
+}
+
+void NameSpeedTeardown(void)
+{
+    while (num_sems > 0)
+    {
+        --num_sems;
+        OS_BinSemDelete(sem_ids[num_sems]);
+    }
+}
@@ -0,0 +1,130 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** Time Base Jitter Test
+**
+** This is a simple way to gauge how precisely the OS
+** services a simulated time base on a given machine.
+**
+** A time base is run at 100 Hz, 1 kHz and 10 kHz for
+** a few seconds each.  At the end of each run the jitter
+** histogram, worst case lateness and overrun count reported
+** by OS_TimeBaseGetInfo() are printed.
+**
+** Compare the output with OSAL_CONFIG_TIMEBASE_TIMERFD set
+** and cleared to see the effect of the timebase implementation.
+*/
+#include <stdio.h>
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+/*
+ * Duration of each run, in milliseconds
+ */
+#define JITTERTEST_RUN_TIME 3000
+
+/* Define test functions for UT assert */
+void JitterRun100Hz(void);
+void JitterRun1kHz(void);
+void JitterRun10kHz(void);
+
+void JitterRun(uint32 interval_usec)
+{
+    osal_id_t          timebase_id;
+    OS_timebase_prop_t prop;
+    uint32             samples;
+    uint32             lower;
+    uint32             i;
+
+    UtAssert_INT32_EQ(OS_TimeBaseCreate(&timebase_id, "JitterTB", NULL), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_TimeBaseSet(timebase_id, interval_usec, interval_usec), OS_SUCCESS);
+
+    /* Time Limited Execution */
+    OS_TaskDelay(JITTERTEST_RUN_TIME);
+
+    UtAssert_INT32_EQ(OS_TimeBaseGetInfo(timebase_id, &prop), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_TimeBaseDelete(timebase_id), OS_SUCCESS);
+
+    samples = 0;
+    lower   = 0;
+    for (i = 0; i < OS_TIMEBASE_JITTER_BUCKETS; ++i)
+    {
+        samples += prop.jitter_histogram[i];
+        if (i < (OS_TIMEBASE_JITTER_BUCKETS - 1))
+        {
+            UtPrintf("  %5lu - %5lu usec: %lu\n", (unsigned long)lower, (unsigned long)(1UL << i) - 1,
+                     (unsigned long)prop.jitter_histogram[i]);
+        }
+        else
+        {
+            UtPrintf("  %5lu+        usec: %lu\n", (unsigned long)lower, (unsigned long)prop.jitter_histogram[i]);
+        }
+        lower = 1UL << i;
+    }
+
+    UtPrintf("Interval %lu usec: %lu ticks, %lu overruns, max jitter %lu usec\n", (unsigned long)interval_usec,
+             (unsigned long)samples, (unsigned long)prop.overrun_count, (unsigned long)prop.max_jitter);
+
+    /*
+     * Only the POSIX implementation collects jitter statistics.  Every
+     * expiration is either serviced (and counted in the histogram) or missed.
+     */
+#ifdef _POSIX_OS_
+    UtAssert_NONZERO(samples);
+    UtAssert_True((samples + prop.overrun_count) <= (((JITTERTEST_RUN_TIME * 1000) / interval_usec) + 1),
+                  "Ticks + overruns (%lu) do not exceed the number of intervals",
+                  (unsigned long)(samples + prop.overrun_count));
+#endif
+}
+
+void JitterRun100Hz(void)
+{
+    JitterRun(10000);
+}
+
+void JitterRun1kHz(void)
+{
+    JitterRun(1000);
+}
+
+void JitterRun10kHz(void)
+{
+    JitterRun(100);
+}
+
+void UtTest_Setup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    /* the test should call OS_API_Teardown() before exiting */
+    UtTest_AddTeardown(OS_API_Teardown, "Cleanup");
+
+    /*
+     * Register the test setup and check routines in UT assert
+     */
+    UtTest_Add(JitterRun100Hz, NULL, NULL, "TimeBaseJitter100Hz");
+    UtTest_Add(JitterRun1kHz, NULL, NULL, "TimeBaseJitter1kHz");
+    UtTest_Add(JitterRun10kHz, NULL, NULL, "TimeBaseJitter10kHz");
+}
@@ -32,32 +32,100 @@
 
 #define TEST_BUFFER_LEN 16
 
-const char TEST_BUF_INITIALIZER[1 + TEST_BUFFER_LEN] = "abcdefghijklmnop";
+/* Buffer large enough to exercise batching of the output */
+#define TEST_BATCH_BUFFER_LEN 2048
+
+static uint32 TestConsoleBspBuffer[TEST_BATCH_BUFFER_LEN / sizeof(uint32)];
+
+/*
+ * Put a complete record into the test console buffer, in the same format
+ * as the shared layer does, and return the offset of the next record
+ */
+static size_t UT_ConsolePutRecord(size_t Pos, const char *Str, size_t Len)
+{
+    char * BufBase = (char *)TestConsoleBspBuffer;
+    size_t BufSize = OS_console_table[0].BufSize;
+    size_t i;
+
+    for (i = 0; i < Len; ++i)
+    {
+        BufBase[(Pos + OS_CONSOLE_RECORD_ALIGN + i) % BufSize] = Str[i];
+    }
+
+    TestConsoleBspBuffer[Pos / sizeof(uint32)] = Len;
+
+    return (Pos + OS_CONSOLE_RECORD_SIZE(Len)) % BufSize;
+}
 
 void Test_OS_ConsoleOutput_Impl(void)
 {
-    char              TestConsoleBspBuffer[TEST_BUFFER_LEN];
     char              TestOutputBuffer[32];
     OS_object_token_t token;
 
     memset(&token, 0, sizeof(token));
 
-    memcpy(TestConsoleBspBuffer, TEST_BUF_INITIALIZER, sizeof(TestConsoleBspBuffer));
+    memset(TestConsoleBspBuffer, 0, sizeof(TestConsoleBspBuffer));
     memset(TestOutputBuffer, 0, sizeof(TestOutputBuffer));
 
-    OS_console_table[0].BufBase = TestConsoleBspBuffer;
-    OS_console_table[0].BufSize = sizeof(TestConsoleBspBuffer);
+    OS_console_table[0].BufBase = (char *)TestConsoleBspBuffer;
+    OS_console_table[0].BufSize = TEST_BUFFER_LEN;
 
     UT_SetDataBuffer(UT_KEY(OCS_OS_BSP_ConsoleOutput_Impl), TestOutputBuffer, sizeof(TestOutputBuffer), false);
 
-    OS_console_table[0].WritePos = 4;
+    /* Nominal, one complete record */
+    OS_console_table[0].WritePos = UT_ConsolePutRecord(0, "abcd", 4);
+    OS_ConsoleOutput_Impl(&token);
+    UtAssert_STRINGBUF_EQ(TestOutputBuffer, sizeof(TestOutputBuffer), "abcd", -1);
+    UtAssert_UINT32_EQ(OS_console_table[0].ReadPos, 8);
+    UtAssert_ZERO(TestConsoleBspBuffer[0]);
+    UtAssert_ZERO(TestConsoleBspBuffer[1]);
+
+    /* Record that wraps around the end of the buffer */
+    OS_console_table[0].WritePos = UT_ConsolePutRecord(8, "efghij", 6);
     OS_ConsoleOutput_Impl(&token);
-    UtAssert_True(strcmp(TestOutputBuffer, "abcd") == 0, "TestOutputBuffer (%s) == abcd", TestOutputBuffer);
+    UtAssert_STRINGBUF_EQ(TestOutputBuffer, sizeof(TestOutputBuffer), "abcdefghij", -1);
+    UtAssert_UINT32_EQ(OS_console_table[0].ReadPos, 4);
+    UtAssert_ZERO(TestConsoleBspBuffer[0]);
+    UtAssert_ZERO(TestConsoleBspBuffer[2]);
+    UtAssert_ZERO(TestConsoleBspBuffer[3]);
 
-    OS_console_table[0].WritePos = 2;
+    /* A record that is reserved but not yet complete is not output */
+    OS_ConsoleOutput_Impl(&token);
+    UtAssert_STRINGBUF_EQ(TestOutputBuffer, sizeof(TestOutputBuffer), "abcdefghij", -1);
+    UtAssert_UINT32_EQ(OS_console_table[0].ReadPos, 4);
+    UtAssert_STUB_COUNT(OCS_OS_BSP_ConsoleOutput_Impl, 2);
+}
+
+void Test_OS_ConsoleOutput_Impl_Batch(void)
+{
+    char              TestRecord[TEST_BATCH_BUFFER_LEN / 2];
+    OS_object_token_t token;
+    size_t            WritePos;
+
+    memset(&token, 0, sizeof(token));
+    memset(TestConsoleBspBuffer, 0, sizeof(TestConsoleBspBuffer));
+    memset(TestRecord, 'x', sizeof(TestRecord) - 1);
+    TestRecord[sizeof(TestRecord) - 1] = 0;
+
+    OS_console_table[0].BufBase = (char *)TestConsoleBspBuffer;
+    OS_console_table[0].BufSize = sizeof(TestConsoleBspBuffer);
+
+    /* Several small records are written to the device in a single call */
+    WritePos = UT_ConsolePutRecord(0, "a", 1);
+    WritePos = UT_ConsolePutRecord(WritePos, "b", 1);
+    WritePos = UT_ConsolePutRecord(WritePos, "c", 1);
+    OS_ConsoleOutput_Impl(&token);
+    UtAssert_STUB_COUNT(OCS_OS_BSP_ConsoleOutput_Impl, 1);
+    UtAssert_UINT32_EQ(OS_console_table[0].ReadPos, WritePos);
+
+    /* Data that does not fit in the batch is flushed first, and a large record is written directly */
+    WritePos = UT_ConsolePutRecord(WritePos, "d", 1);
+    WritePos = UT_ConsolePutRecord(WritePos, TestRecord, 300);
+    WritePos = UT_ConsolePutRecord(WritePos, TestRecord, 300);
+    WritePos = UT_ConsolePutRecord(WritePos, TestRecord, 600);
     OS_ConsoleOutput_Impl(&token);
-    UtAssert_True(strcmp(TestOutputBuffer, "abcdefghijklmnopab") == 0, "TestOutputBuffer (%s) == abcdefghijklmnopab",
-                  TestOutputBuffer);
+    UtAssert_STUB_COUNT(OCS_OS_BSP_ConsoleOutput_Impl, 4);
+    UtAssert_UINT32_EQ(OS_console_table[0].ReadPos, WritePos);
 }
 
 /* ------------------- End of test cases --------------------------------------*/
@@ -89,4 +157,5 @@ void Osapi_Test_Teardown(void) {}
 void UtTest_Setup(void)
 {
     ADD_TEST(OS_ConsoleOutput_Impl);
+    ADD_TEST(OS_ConsoleOutput_Impl_Batch);
 }
@@ -144,6 +144,58 @@ void Test_OS_TimedWrite(void)
     OSAPI_TEST_FUNCTION_RC(OS_TimedWrite(UT_OBJID_1, Buf, OSAL_SIZE_C(UINT32_MAX), 10), OS_ERR_INVALID_SIZE);
 }
 
+void Test_OS_AsyncWrite(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_AsyncWrite(osal_id_t filedes, const void *buffer, size_t nbytes, OS_AsyncIo_t *req)
+     */
+    const char   Buf[4] = "aaa";
+    OS_AsyncIo_t req;
+
+    memset(&req, 0, sizeof(req));
+    OSAPI_TEST_FUNCTION_RC(OS_AsyncWrite(UT_OBJID_1, Buf, sizeof(Buf), &req), OS_SUCCESS);
+    UtAssert_True(req.IsPending, "request pending");
+    UtAssert_ADDRESS_EQ(req.Buffer, Buf);
+    UtAssert_UINT32_EQ(req.Size, sizeof(Buf));
+    UtAssert_STUB_COUNT(OS_AsyncWrite_Impl, 1);
+
+    /* resubmitting a pending request is rejected */
+    OSAPI_TEST_FUNCTION_RC(OS_AsyncWrite(UT_OBJID_1, Buf, sizeof(Buf), &req), OS_ERR_INCORRECT_OBJ_STATE);
+    UtAssert_STUB_COUNT(OS_AsyncWrite_Impl, 1);
+
+    /* failure to queue leaves the request idle with the error as the result */
+    req.IsPending = false;
+    UT_SetDefaultReturnValue(UT_KEY(OS_AsyncWrite_Impl), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_AsyncWrite(UT_OBJID_1, Buf, sizeof(Buf), &req), OS_ERROR);
+    UtAssert_BOOL_FALSE(req.IsPending);
+    UtAssert_INT32_EQ(req.Result, OS_ERROR);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_AsyncWrite(UT_OBJID_1, Buf, sizeof(Buf), &req), OS_ERR_INVALID_ID);
+
+    OSAPI_TEST_FUNCTION_RC(OS_AsyncWrite(UT_OBJID_1, NULL, sizeof(Buf), &req), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_AsyncWrite(UT_OBJID_1, Buf, sizeof(Buf), NULL), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_AsyncWrite(UT_OBJID_1, Buf, OSAL_SIZE_C(0), &req), OS_ERR_INVALID_SIZE);
+}
+
+void Test_OS_AsyncWait(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_AsyncWait(OS_AsyncIo_t *req, int32 timeout)
+     */
+    OS_AsyncIo_t req;
+
+    memset(&req, 0, sizeof(req));
+    OSAPI_TEST_FUNCTION_RC(OS_AsyncWait(&req, OS_PEND), OS_SUCCESS);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_AsyncWait_Impl), OS_ERROR_TIMEOUT);
+    OSAPI_TEST_FUNCTION_RC(OS_AsyncWait(&req, OS_CHECK), OS_ERROR_TIMEOUT);
+
+    OSAPI_TEST_FUNCTION_RC(OS_AsyncWait(NULL, OS_PEND), OS_INVALID_POINTER);
+}
+
 void Test_OS_read(void)
 {
     /*
@@ -409,6 +461,8 @@ void UtTest_Setup(void)
     ADD_TEST(OS_close);
     ADD_TEST(OS_TimedRead);
     ADD_TEST(OS_TimedWrite);
+    ADD_TEST(OS_AsyncWrite);
+    ADD_TEST(OS_AsyncWait);
     ADD_TEST(OS_read);
     ADD_TEST(OS_write);
     ADD_TEST(OS_chmod);
@@ -459,10 +459,11 @@ void Test_OS_ObjectIdFindByName(void)
      * Nominal case (with no additional setup) should return OS_ERR_NAME_NOT_FOUND
      * Setting up a special matching entry should yield OS_SUCCESS
      */
-    char      TaskName[] = "UT_find";
-    osal_id_t objid;
-    int32     expected = OS_ERR_NAME_NOT_FOUND;
-    int32     actual   = OS_ObjectIdFindByName(OS_OBJECT_TYPE_UNDEFINED, NULL, &objid);
+    char              TaskName[] = "UT_find";
+    osal_id_t         objid;
+    OS_object_token_t token;
+    int32             expected = OS_ERR_NAME_NOT_FOUND;
+    int32             actual   = OS_ObjectIdFindByName(OS_OBJECT_TYPE_UNDEFINED, NULL, &objid);
     UtAssert_True(actual == expected, "OS_ObjectFindIdByName(%s) (%ld) == OS_ERR_NAME_NOT_FOUND", "NULL", (long)actual);
 
     /*
@@ -488,12 +489,14 @@ void Test_OS_ObjectIdFindByName(void)
     /*
      * Set up for the ObjectIdSearch function to return success
      */
-    OS_global_task_table[0].active_id  = UT_OBJID_OTHER;
-    OS_global_task_table[0].name_entry = TaskName;
-    actual                             = OS_ObjectIdFindByName(OS_OBJECT_TYPE_OS_TASK, TaskName, &objid);
-    expected                           = OS_SUCCESS;
-    OS_global_task_table[0].active_id  = OS_OBJECT_ID_UNDEFINED;
-    OS_global_task_table[0].name_entry = NULL;
+    memset(&token, 0, sizeof(token));
+    token.obj_type                    = OS_OBJECT_TYPE_OS_TASK;
+    OS_global_task_table[0].active_id = UT_OBJID_OTHER;
+    OS_ObjectIdSetName(&token, TaskName);
+    actual                            = OS_ObjectIdFindByName(OS_OBJECT_TYPE_OS_TASK, TaskName, &objid);
+    expected                          = OS_SUCCESS;
+    OS_global_task_table[0].active_id = OS_OBJECT_ID_UNDEFINED;
+    OS_ObjectIdSetName(&token, NULL);
 
     UtAssert_True(actual == expected, "OS_ObjectFindIdByName(%s) (%ld) == OS_SUCCESS", TaskName, (long)actual);
 }
@@ -555,6 +558,13 @@ void Test_OS_ObjectIdGetById(void)
     OS_ObjectIdRelease(&token1);
     UtAssert_True(rptr->refcount == 0, "refcount (%u) == 0", (unsigned int)rptr->refcount);
 
+    /* refcount lookup of an object being deleted (ID is RESERVED) uses the locked path and fails */
+    rptr->active_id = OS_OBJECT_ID_RESERVED;
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, OS_OBJECT_TYPE_OS_TASK, refobjid, &token1),
+                           OS_ERR_OBJECT_IN_USE);
+    UtAssert_True(rptr->refcount == 0, "refcount (%u) == 0", (unsigned int)rptr->refcount);
+    rptr->active_id = refobjid;
+
     /* attempt to get non-exclusive lock during shutdown should fail */
     OS_SharedGlobalVars.GlobalState = OS_SHUTDOWN_MAGIC_NUMBER;
     expected                        = OS_ERR_INCORRECT_OBJ_STATE;
@@ -571,6 +581,84 @@ void Test_OS_ObjectIdGetById(void)
     memset(&OS_global_task_table[local_idx], 0, sizeof(OS_global_task_table[local_idx]));
 }
 
+/* OS_WaitForStateChange_Impl hook standing in for a stale lookup that backs out its increment */
+static int32 UT_StaleLookupBackOutHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                       const UT_StubContext_t *Context)
+{
+    OS_ObjectIdRelease(UserObj);
+    return StubRetcode;
+}
+
+void Test_OS_ObjectIdRefcountStaleLookup(void)
+{
+    /*
+     * Test Case For:
+     * A REFCOUNT lookup that matched an ID just before the object was deleted,
+     * and so increments the refcount of the free record, while the record is
+     * reused for a new object which is then referenced by another task.  The
+     * stale lookup then sees the ID changed and decrements the refcount again.
+     */
+    OS_object_token_t   stale_token;
+    OS_object_token_t   new_token;
+    OS_object_token_t   live_token;
+    OS_object_token_t   excl_token;
+    OS_common_record_t *rptr;
+    osal_id_t           stale_id;
+    osal_id_t           new_id;
+    uint32              i;
+
+    /* create and delete the object the stale lookup refers to */
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdAllocateNew(OS_OBJECT_TYPE_OS_TASK, NULL, &stale_token), OS_SUCCESS);
+    OS_ObjectIdFinalizeNew(OS_SUCCESS, &stale_token, &stale_id);
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdGetById(OS_LOCK_MODE_EXCLUSIVE, OS_OBJECT_TYPE_OS_TASK, stale_id, &stale_token),
+                           OS_SUCCESS);
+    OS_ObjectIdFinalizeDelete(OS_SUCCESS, &stale_token);
+    rptr = OS_OBJECT_TABLE_GET(OS_global_task_table, stale_token);
+    UtAssert_UINT32_EQ(rptr->refcount, 0);
+
+    /* the stale lookup passed its first ID check before the delete, and increments now */
+    stale_token.lock_mode = OS_LOCK_MODE_REFCOUNT;
+    ++rptr->refcount;
+
+    /*
+     * Reuse the record for a new object.  The create must not discard the
+     * stale increment, and waits for it to be backed out.
+     */
+    UT_SetHookFunction(UT_KEY(OS_WaitForStateChange_Impl), UT_StaleLookupBackOutHook, &stale_token);
+    for (i = 0; i < OS_MAX_TASKS; ++i)
+    {
+        if (OS_ObjectIdAllocateNew(OS_OBJECT_TYPE_OS_TASK, NULL, &new_token) != OS_SUCCESS ||
+            new_token.obj_idx == stale_token.obj_idx)
+        {
+            break;
+        }
+        OS_ObjectIdFinalizeNew(OS_ERROR, &new_token, NULL);
+    }
+    UtAssert_UINT32_EQ(new_token.obj_idx, stale_token.obj_idx);
+    OS_ObjectIdFinalizeNew(OS_SUCCESS, &new_token, &new_id);
+    OSAPI_TEST_OBJID(new_id, !=, stale_id);
+    UT_ResetState(UT_KEY(OS_WaitForStateChange_Impl));
+
+    /* another task references the new object */
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, OS_OBJECT_TYPE_OS_TASK, new_id, &live_token),
+                           OS_SUCCESS);
+
+    /* the stale lookup backs out, if it was not already allowed to do so during the create */
+    OS_ObjectIdRelease(&stale_token);
+    UtAssert_UINT32_EQ(rptr->refcount, 1);
+
+    /* the reference is still held, so a delete must not proceed */
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdGetById(OS_LOCK_MODE_EXCLUSIVE, OS_OBJECT_TYPE_OS_TASK, new_id, &excl_token),
+                           OS_ERR_OBJECT_IN_USE);
+    OSAPI_TEST_OBJID(rptr->active_id, ==, new_id);
+
+    OS_ObjectIdRelease(&live_token);
+    UtAssert_UINT32_EQ(rptr->refcount, 0);
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdGetById(OS_LOCK_MODE_EXCLUSIVE, OS_OBJECT_TYPE_OS_TASK, new_id, &excl_token),
+                           OS_SUCCESS);
+    OS_ObjectIdFinalizeDelete(OS_SUCCESS, &excl_token);
+}
+
 void Test_OS_ObjectIdFindNextFree(void)
 {
     /*
@@ -736,10 +824,12 @@ void Test_OS_ObjectIdAllocateNew(void)
     int32             expected = OS_SUCCESS;
     int32             actual   = ~OS_SUCCESS;
     OS_object_token_t token;
+    OS_object_token_t first_token;
 
     memset(&token, 0, sizeof(token));
 
-    actual = OS_ObjectIdAllocateNew(OS_OBJECT_TYPE_OS_TASK, "UT_alloc", &token);
+    actual      = OS_ObjectIdAllocateNew(OS_OBJECT_TYPE_OS_TASK, "UT_alloc", &token);
+    first_token = token;
 
     /* Verify Outputs */
     UtAssert_True(actual == expected, "OS_ObjectIdAllocate() (%ld) == OS_SUCCESS", (long)actual);
@@ -751,9 +841,10 @@ void Test_OS_ObjectIdAllocateNew(void)
     actual = OS_ObjectIdAllocateNew(OS_OBJECT_TYPE_OS_TASK, NULL, &token);
     UtAssert_True(actual == expected, "OS_ObjectIdAllocate(NULL) (%ld) == OS_SUCCESS", (long)actual);
 
-    OS_global_task_table[0].name_entry = "UT_alloc";
-    expected                           = OS_ERR_NAME_TAKEN;
-    actual                             = OS_ObjectIdAllocateNew(OS_OBJECT_TYPE_OS_TASK, "UT_alloc", &token);
+    OS_global_task_table[first_token.obj_idx].name_entry = "UT_alloc";
+
+    expected = OS_ERR_NAME_TAKEN;
+    actual   = OS_ObjectIdAllocateNew(OS_OBJECT_TYPE_OS_TASK, "UT_alloc", &token);
     UtAssert_True(actual == expected, "OS_ObjectIdAllocate() (%ld) == OS_ERR_NAME_TAKEN", (long)actual);
 
     /*
@@ -903,6 +994,20 @@ void Test_OS_ObjectIdTransaction(void)
     record->refcount  = 1;
     record->active_id = UT_OBJID_1;
     OS_ObjectIdTransactionFinish(&token, NULL);
+#ifdef OSAL_CONFIG_IDMAP_LOCKFREE_REFCOUNT
+    /* released without the global lock */
+    UtAssert_STUB_COUNT(OS_Lock_Global_Impl, 3);
+    UtAssert_STUB_COUNT(OS_Unlock_Global_Impl, 3);
+    UtAssert_UINT32_EQ(token.lock_mode, OS_LOCK_MODE_NONE);
+
+    /* if a delete is waiting (ID is RESERVED) the lock is cycled to wake it */
+    token.lock_mode   = OS_LOCK_MODE_REFCOUNT;
+    record->refcount  = 1;
+    record->active_id = OS_OBJECT_ID_RESERVED;
+    OS_ObjectIdTransactionFinish(&token, NULL);
+    UtAssert_UINT32_EQ(record->refcount, 0);
+    record->active_id = UT_OBJID_1;
+#endif
     UtAssert_STUB_COUNT(OS_Lock_Global_Impl, 4);
     UtAssert_STUB_COUNT(OS_Unlock_Global_Impl, 4);
     OSAPI_TEST_OBJID(record->active_id, ==, UT_OBJID_1);
@@ -1181,7 +1286,7 @@ void Test_OS_ObjectIDInteger(void)
         }
     }
 
-    UtAssert_True(recordscount < OS_MAX_TOTAL_RECORDS, "All Id types checked");
+    UtAssert_True(recordscount == OS_MAX_TOTAL_RECORDS, "All Id types checked");
 
     for (i = 0; i < recordscount; i++)
     {
@@ -1229,6 +1334,9 @@ void Osapi_Test_Setup(void)
     /* for sanity also clear out the task table, which is used by several test cases */
     memset(OS_global_task_table, 0, OS_MAX_TASKS * sizeof(OS_common_record_t));
 
+    /* the name index must be consistent with the table, so clear everything */
+    OS_ObjectIdInit();
+
     /*
      * The OS_SharedGlobalVars is also used here, but set the
      * "GlobalState" field to init by default, as this is needed by most tests.
@@ -1256,6 +1364,7 @@ void UtTest_Setup(void)
     ADD_TEST(OS_ObjectIdToArrayIndex);
     ADD_TEST(OS_ObjectIdFindByName);
     ADD_TEST(OS_ObjectIdGetById);
+    ADD_TEST(OS_ObjectIdRefcountStaleLookup);
     ADD_TEST(OS_ObjectIdTransaction);
     ADD_TEST(OS_ObjectIdAllocateNew);
     ADD_TEST(OS_ObjectIdFinalize);
@@ -25,10 +25,11 @@
 #include "os-shared-coveragetest.h"
 #include "os-shared-printf.h"
 #include "os-shared-common.h"
+#include "os-shared-task.h"
 
 #include "OCS_stdio.h"
 
-char TestConsoleBuffer[16];
+uint32 TestConsoleBuffer[8];
 
 void Test_OS_ConsoleAPI_Init(void)
 {
@@ -98,7 +99,14 @@ void Test_OS_printf(void)
     UtAssert_True(OS_console_table[0].WritePos >= 10, "WritePos (%lu) >= 10",
                   (unsigned long)OS_console_table[0].WritePos);
 
-    /* print a long string that does not fit in the 16-char buffer */
+    /* an empty string does not use any space */
+    OS_console_table[0].WritePos = 0;
+    UT_SetDeferredRetcode(UT_KEY(OCS_vsnprintf), 1, -1);
+    OS_printf("UnitTest3e");
+    UtAssert_ZERO(OS_console_table[0].WritePos);
+    OS_printf("UnitTest3a");
+
+    /* print a long string that does not fit in the 32-char buffer */
     OS_printf_enable();
     OS_printf("UnitTest4BufferLengthExceeded");
     UtAssert_UINT32_EQ(OS_console_table[0].OverflowEvents, 1);
@@ -113,6 +121,26 @@ void Test_OS_printf(void)
     OS_printf("UnitTest5.5");
     UtAssert_UINT32_EQ(OS_console_table[0].OverflowEvents, 3);
 
+    /* When the buffer is full, wait for the configured timeout before dropping the message */
+    OS_console_table[0].OverflowTimeout = 3;
+    OS_printf("UnitTest5.6");
+    UtAssert_UINT32_EQ(OS_console_table[0].OverflowEvents, 4);
+    UtAssert_STUB_COUNT(OS_TaskDelay_Impl, 3);
+
+    /* No waiting on a synchronous console, as nothing else will drain it */
+    OS_console_table[0].IsAsync = false;
+    OS_printf("UnitTest5.7");
+    UtAssert_UINT32_EQ(OS_console_table[0].OverflowEvents, 5);
+    UtAssert_STUB_COUNT(OS_TaskDelay_Impl, 3);
+    OS_console_table[0].IsAsync = true;
+
+    /* Space is reserved once the reader has made room */
+    OS_console_table[0].ReadPos = 0;
+    OS_printf("UnitTest5.8");
+    UtAssert_UINT32_EQ(OS_console_table[0].OverflowEvents, 5);
+    UtAssert_UINT32_EQ(OS_console_table[0].WritePos, 20);
+    UtAssert_UINT32_EQ(TestConsoleBuffer[0], 13);
+
     /*
      * For coverage, exercise different paths depending on the return value
      */
@@ -142,7 +170,8 @@ void Osapi_Test_Setup(void)
     UT_ResetState(0);
     memset(OS_console_table, 0, sizeof(OS_console_table));
     memset(&OS_SharedGlobalVars, 0, sizeof(OS_SharedGlobalVars));
-    OS_console_table[0].BufBase = TestConsoleBuffer;
+    memset(TestConsoleBuffer, 0, sizeof(TestConsoleBuffer));
+    OS_console_table[0].BufBase = (char *)TestConsoleBuffer;
     OS_console_table[0].BufSize = sizeof(TestConsoleBuffer);
 }
 
@@ -197,6 +197,23 @@ void Test_OS_TaskSetPriority(void)
     OSAPI_TEST_FUNCTION_RC(OS_TaskSetPriority(UT_OBJID_1, OSAL_PRIORITY_C(1)), OS_ERROR);
 }
 
+void Test_OS_TaskSetAffinity(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_TaskSetAffinity(osal_id_t task_id, uint32 cpu_mask)
+     */
+    OSAPI_TEST_FUNCTION_RC(OS_TaskSetAffinity(UT_OBJID_1, 1), OS_SUCCESS);
+
+    OSAPI_TEST_FUNCTION_RC(OS_TaskSetAffinity(UT_OBJID_1, 0), OS_ERR_INVALID_ARGUMENT);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 1, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_TaskSetAffinity(UT_OBJID_1, 1), OS_ERR_INVALID_ID);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_TaskSetAffinity_Impl), 1, OS_ERR_NOT_IMPLEMENTED);
+    OSAPI_TEST_FUNCTION_RC(OS_TaskSetAffinity(UT_OBJID_1, 1), OS_ERR_NOT_IMPLEMENTED);
+}
+
 void Test_OS_TaskGetId(void)
 {
     /*
@@ -266,6 +283,25 @@ void Test_OS_TaskGetInfo(void)
     OSAPI_TEST_FUNCTION_RC(OS_TaskGetInfo(UT_OBJID_1, &task_prop), OS_ERR_INVALID_ID);
 }
 
+void Test_OS_TaskGetCpuTime(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_TaskGetCpuTime(osal_id_t task_id, OS_time_t *cpu_time)
+     */
+    OS_time_t cpu_time;
+
+    OSAPI_TEST_FUNCTION_RC(OS_TaskGetCpuTime(UT_OBJID_1, &cpu_time), OS_SUCCESS);
+
+    OSAPI_TEST_FUNCTION_RC(OS_TaskGetCpuTime(UT_OBJID_1, NULL), OS_INVALID_POINTER);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 1, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_TaskGetCpuTime(UT_OBJID_1, &cpu_time), OS_ERR_INVALID_ID);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_TaskGetCpuTime_Impl), 1, OS_ERR_NOT_IMPLEMENTED);
+    OSAPI_TEST_FUNCTION_RC(OS_TaskGetCpuTime(UT_OBJID_1, &cpu_time), OS_ERR_NOT_IMPLEMENTED);
+}
+
 void Test_OS_TaskInstallDeleteHandler(void)
 {
     /*
@@ -348,9 +384,11 @@ void UtTest_Setup(void)
     ADD_TEST(OS_TaskExit);
     ADD_TEST(OS_TaskDelay);
     ADD_TEST(OS_TaskSetPriority);
+    ADD_TEST(OS_TaskSetAffinity);
     ADD_TEST(OS_TaskGetId);
     ADD_TEST(OS_TaskGetIdByName);
     ADD_TEST(OS_TaskGetInfo);
+    ADD_TEST(OS_TaskGetCpuTime);
     ADD_TEST(OS_TaskInstallDeleteHandler);
     ADD_TEST(OS_TaskFindIdBySystemData);
 }
@@ -28,6 +28,40 @@
 void UT_DefaultHandler_OS_GenericRead_Impl(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_GenericWrite_Impl(void *, UT_EntryKey_t, const UT_StubContext_t *);
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_AsyncWait_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_AsyncWait_Impl(OS_AsyncIo_t *req, int32 msecs)
+{
+    UT_GenStub_SetupReturnBuffer(OS_AsyncWait_Impl, int32);
+
+    UT_GenStub_AddParam(OS_AsyncWait_Impl, OS_AsyncIo_t *, req);
+    UT_GenStub_AddParam(OS_AsyncWait_Impl, int32, msecs);
+
+    UT_GenStub_Execute(OS_AsyncWait_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_AsyncWait_Impl, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_AsyncWrite_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_AsyncWrite_Impl(const OS_object_token_t *token, OS_AsyncIo_t *req)
+{
+    UT_GenStub_SetupReturnBuffer(OS_AsyncWrite_Impl, int32);
+
+    UT_GenStub_AddParam(OS_AsyncWrite_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_AsyncWrite_Impl, OS_AsyncIo_t *, req);
+
+    UT_GenStub_Execute(OS_AsyncWrite_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_AsyncWrite_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_FileChmod_Impl()
@@ -407,6 +407,19 @@ void OS_ObjectIdRelease(OS_object_token_t *token)
     UT_GenStub_Execute(OS_ObjectIdRelease, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_ObjectIdSetName()
+ * ----------------------------------------------------
+ */
+void OS_ObjectIdSetName(const OS_object_token_t *token, const char *name)
+{
+    UT_GenStub_AddParam(OS_ObjectIdSetName, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_ObjectIdSetName, const char *, name);
+
+    UT_GenStub_Execute(OS_ObjectIdSetName, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_ObjectIdTransactionCancel()
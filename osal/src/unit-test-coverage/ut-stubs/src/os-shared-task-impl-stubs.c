@@ -101,6 +101,23 @@ void OS_TaskExit_Impl(void)
     UT_GenStub_Execute(OS_TaskExit_Impl, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_TaskGetCpuTime_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_TaskGetCpuTime_Impl(const OS_object_token_t *token, OS_time_t *cpu_time)
+{
+    UT_GenStub_SetupReturnBuffer(OS_TaskGetCpuTime_Impl, int32);
+
+    UT_GenStub_AddParam(OS_TaskGetCpuTime_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_TaskGetCpuTime_Impl, OS_time_t *, cpu_time);
+
+    UT_GenStub_Execute(OS_TaskGetCpuTime_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_TaskGetCpuTime_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_TaskGetId_Impl()
@@ -182,6 +199,23 @@ int32 OS_TaskRegister_Impl(osal_id_t global_task_id)
     return UT_GenStub_GetReturnValue(OS_TaskRegister_Impl, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_TaskSetAffinity_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_TaskSetAffinity_Impl(const OS_object_token_t *token, uint32 cpu_mask)
+{
+    UT_GenStub_SetupReturnBuffer(OS_TaskSetAffinity_Impl, int32);
+
+    UT_GenStub_AddParam(OS_TaskSetAffinity_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_TaskSetAffinity_Impl, uint32, cpu_mask);
+
+    UT_GenStub_Execute(OS_TaskSetAffinity_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_TaskSetAffinity_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_TaskSetPriority_Impl()
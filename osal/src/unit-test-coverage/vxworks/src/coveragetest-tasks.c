@@ -188,6 +188,17 @@ void Test_OS_TaskSetPriority_Impl(void)
     OSAPI_TEST_FUNCTION_RC(OS_TaskSetPriority_Impl(&token, OSAL_PRIORITY_C(100)), OS_ERROR);
 }
 
+void Test_OS_TaskSetAffinity_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_TaskSetAffinity_Impl(const OS_object_token_t *token, uint32 cpu_mask)
+     */
+    OS_object_token_t token = UT_TOKEN_0;
+
+    OSAPI_TEST_FUNCTION_RC(OS_TaskSetAffinity_Impl(&token, 1), OS_ERR_NOT_IMPLEMENTED);
+}
+
 void Test_OS_TaskRegister_Impl(void)
 {
     /*
@@ -241,6 +252,18 @@ void Test_OS_TaskGetInfo_Impl(void)
     OSAPI_TEST_FUNCTION_RC(OS_TaskGetInfo_Impl(&token, &task_prop), OS_SUCCESS);
 }
 
+void Test_OS_TaskGetCpuTime_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_TaskGetCpuTime_Impl(const OS_object_token_t *token, OS_time_t *cpu_time)
+     */
+    OS_time_t         cpu_time;
+    OS_object_token_t token = UT_TOKEN_0;
+
+    OSAPI_TEST_FUNCTION_RC(OS_TaskGetCpuTime_Impl(&token, &cpu_time), OS_ERR_NOT_IMPLEMENTED);
+}
+
 void Test_OS_TaskValidateSystemData_Impl(void)
 {
     /*
@@ -314,9 +337,11 @@ void UtTest_Setup(void)
     ADD_TEST(OS_TaskExit_Impl);
     ADD_TEST(OS_TaskDelay_Impl);
     ADD_TEST(OS_TaskSetPriority_Impl);
+    ADD_TEST(OS_TaskSetAffinity_Impl);
     ADD_TEST(OS_TaskRegister_Impl);
     ADD_TEST(OS_TaskGetId_Impl);
     ADD_TEST(OS_TaskGetInfo_Impl);
+    ADD_TEST(OS_TaskGetCpuTime_Impl);
     ADD_TEST(OS_TaskValidateSystemData_Impl);
     ADD_TEST(OS_TaskIdMatchSystemData_Impl);
 }
@@ -460,6 +460,43 @@ void UT_os_task_set_priority_test()
     }
 }
 
+/*--------------------------------------------------------------------------------*
+** Syntax: OS_TaskSetAffinity
+** Purpose: Restricts the given task to a set of CPUs
+** Parameters: To-be-filled-in
+** Returns: OS_ERR_INVALID_ID if the id passed in is not a valid task id
+**          OS_ERR_INVALID_ARGUMENT if the mask is zero
+**          OS_ERR_NOT_IMPLEMENTED if CPU affinity is not supported
+**          OS_ERROR if the OS call failed
+**          OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+void UT_os_task_set_affinity_test()
+{
+    /*-----------------------------------------------------*/
+    /* #1 Invalid-ID-arg */
+
+    UT_RETVAL(OS_TaskSetAffinity(UT_OBJID_INCORRECT, 1), OS_ERR_INVALID_ID);
+    UT_RETVAL(OS_TaskSetAffinity(OS_OBJECT_ID_UNDEFINED, 1), OS_ERR_INVALID_ID);
+
+    /*-----------------------------------------------------*/
+    /* #2 Nominal */
+
+    if (UT_SETUP(OS_TaskCreate(&g_task_ids[4], g_task_names[4], generic_test_task, OSAL_STACKPTR_C(&g_task_stacks[4]),
+                               sizeof(g_task_stacks[4]), OSAL_PRIORITY_C(UT_TASK_PRIORITY), 0)))
+    {
+        UT_RETVAL(OS_TaskSetAffinity(g_task_ids[4], 0), OS_ERR_INVALID_ARGUMENT);
+
+        /* CPU 0 always exists */
+        UT_NOMINAL_OR_NOTIMPL(OS_TaskSetAffinity(g_task_ids[4], 1));
+
+        /* Delay to let child task run */
+        OS_TaskDelay(500);
+
+        /* Reset test environment */
+        UT_TEARDOWN(OS_TaskDelete(g_task_ids[4]));
+    }
+}
+
 /*--------------------------------------------------------------------------------*/
 
 void getid_test_task(void)
@@ -601,6 +638,52 @@ void UT_os_task_get_info_test()
     }
 }
 
+/*--------------------------------------------------------------------------------*
+** Syntax: OS_TaskGetCpuTime
+** Purpose: Returns the processor time consumed by the given task
+** Parameters: To-be-filled-in
+** Returns: OS_INVALID_POINTER if the pointer passed in is null
+**          OS_ERR_INVALID_ID if the id passed in is not a valid task id
+**          OS_ERR_NOT_IMPLEMENTED if per-task processor time is not available
+**          OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+void UT_os_task_get_cpu_time_test()
+{
+    OS_time_t cpu_time;
+    OS_time_t cpu_time_later;
+
+    /*-----------------------------------------------------*/
+    /* #1 Invalid-ID-arg */
+
+    UT_RETVAL(OS_TaskGetCpuTime(UT_OBJID_INCORRECT, &cpu_time), OS_ERR_INVALID_ID);
+    UT_RETVAL(OS_TaskGetCpuTime(OS_OBJECT_ID_UNDEFINED, &cpu_time), OS_ERR_INVALID_ID);
+
+    /*-----------------------------------------------------*/
+    /* #2 Invalid-pointer-arg and Nominal, sampled from another task */
+
+    if (UT_SETUP(OS_TaskCreate(&g_task_ids[2], g_task_names[2], generic_test_task, OSAL_STACKPTR_C(&g_task_stacks[2]),
+                               sizeof(g_task_stacks[2]), OSAL_PRIORITY_C(UT_TASK_PRIORITY), 0)))
+    {
+        UT_RETVAL(OS_TaskGetCpuTime(g_task_ids[2], NULL), OS_INVALID_POINTER);
+
+        /* Delay to let child task run */
+        OS_TaskDelay(500);
+
+        if (UT_NOMINAL_OR_NOTIMPL(OS_TaskGetCpuTime(g_task_ids[2], &cpu_time)))
+        {
+            OS_TaskDelay(100);
+            UT_NOMINAL(OS_TaskGetCpuTime(g_task_ids[2], &cpu_time_later));
+
+            /* The count never goes backwards */
+            UtAssert_True(OS_TimeGetTotalNanoseconds(OS_TimeSubtract(cpu_time_later, cpu_time)) >= 0,
+                          "CPU time of idle task does not decrease");
+        }
+
+        /* Reset test environment */
+        UT_TEARDOWN(OS_TaskDelete(g_task_ids[2]));
+    }
+}
+
 /*--------------------------------------------------------------------------------*
 ** Syntax: OS_TaskFindIdBySystemData
 ** Purpose: Finds the abstract OSAL task ID from the system ID data
@@ -59,10 +59,12 @@ void UT_os_task_delete_test(void);
 void UT_os_task_install_delete_handler_test(void);
 void UT_os_task_exit_test(void);
 void UT_os_task_set_priority_test(void);
+void UT_os_task_set_affinity_test(void);
 void UT_os_task_register_test(void);
 void UT_os_task_get_id(void);
 void UT_os_task_get_id_by_name_test(void);
 void UT_os_task_get_info_test(void);
+void UT_os_task_get_cpu_time_test(void);
 void UT_os_task_delay_test(void);
 void UT_os_task_get_id_test(void);
 void UT_os_task_getid_by_sysdata_test(void);
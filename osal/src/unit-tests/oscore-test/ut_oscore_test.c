@@ -62,10 +62,12 @@ void UT_os_setup_install_delete_handler_test(void);
 void UT_os_init_task_exit_test(void);
 void UT_os_init_task_delay_test(void);
 void UT_os_init_task_set_priority_test(void);
+void UT_os_init_task_set_affinity_test(void);
 void UT_os_init_task_register_test(void);
 void UT_os_init_task_get_id_test(void);
 void UT_os_init_task_get_id_by_name_test(void);
 void UT_os_init_task_get_info_test(void);
+void UT_os_init_task_get_cpu_time_test(void);
 
 /*--------------------------------------------------------------------------------*
 ** Local function definitions
@@ -142,6 +144,13 @@ void UT_os_init_task_set_priority_test()
 
 /*--------------------------------------------------------------------------------*/
 
+void UT_os_init_task_set_affinity_test()
+{
+    g_task_names[4] = "SetAff_Nominal";
+}
+
+/*--------------------------------------------------------------------------------*/
+
 void UT_os_init_task_register_test()
 {
     g_task_names[0] = "Register_NotImpl";
@@ -180,6 +189,13 @@ void UT_os_init_task_get_info_test()
     g_task_names[3] = "GetInfo_Nominal";
 }
 
+/*--------------------------------------------------------------------------------*/
+
+void UT_os_init_task_get_cpu_time_test()
+{
+    g_task_names[2] = "GetCpu_Nominal";
+}
+
 /*--------------------------------------------------------------------------------*
 ** Main
 **--------------------------------------------------------------------------------*/
@@ -237,9 +253,11 @@ void UtTest_Setup(void)
     UtTest_Add(UT_os_task_exit_test, UT_os_init_task_exit_test, NULL, "OS_TaskExit");
     UtTest_Add(UT_os_task_delay_test, UT_os_init_task_delay_test, NULL, "OS_TaskDelay");
     UtTest_Add(UT_os_task_set_priority_test, UT_os_init_task_set_priority_test, NULL, "OS_TaskSetPriority");
+    UtTest_Add(UT_os_task_set_affinity_test, UT_os_init_task_set_affinity_test, NULL, "OS_TaskSetAffinity");
     UtTest_Add(UT_os_task_get_id_test, UT_os_init_task_get_id_test, NULL, "OS_TaskGetId");
     UtTest_Add(UT_os_task_get_id_by_name_test, UT_os_init_task_get_id_by_name_test, NULL, "OS_TaskGetIdByName");
     UtTest_Add(UT_os_task_get_info_test, UT_os_init_task_get_info_test, NULL, "OS_TaskGetInfo");
+    UtTest_Add(UT_os_task_get_cpu_time_test, UT_os_init_task_get_cpu_time_test, NULL, "OS_TaskGetCpuTime");
     UtTest_Add(UT_os_task_getid_by_sysdata_test, NULL, NULL, "OS_TaskFindIdBySystemData");
 
     UtTest_Add(UT_os_geterrorname_test, NULL, NULL, "OS_GetErrorName");
@@ -162,6 +162,38 @@ void UT_DefaultHandler_OS_write(void *UserObj, UT_EntryKey_t FuncKey, const UT_S
     UT_GenericWriteStub(FuncKey, Context);
 }
 
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_AsyncWrite' stub
+ *
+ * On success the request is completed immediately, as if the
+ * write had finished before the call returned.
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_AsyncWrite(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    const void *  buffer = UT_Hook_GetArgValueByName(Context, "buffer", const void *);
+    size_t        nbytes = UT_Hook_GetArgValueByName(Context, "nbytes", size_t);
+    OS_AsyncIo_t *req    = UT_Hook_GetArgValueByName(Context, "req", OS_AsyncIo_t *);
+    size_t        CopySize;
+    int32         status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    if (status == OS_SUCCESS)
+    {
+        CopySize = UT_Stub_CopyFromLocal(FuncKey, buffer, nbytes);
+
+        req->Result    = (CopySize > 0) ? (int32)CopySize : (int32)nbytes;
+        req->IsPending = false;
+
+        if (req->Callback != NULL)
+        {
+            req->Callback(req);
+        }
+    }
+}
+
 /*
  * -----------------------------------------------------------------
  * Default handler implementation for 'OS_TimedRead' stub
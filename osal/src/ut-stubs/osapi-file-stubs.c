@@ -25,6 +25,7 @@
 #include "osapi-file.h"
 #include "utgenstub.h"
 
+void UT_DefaultHandler_OS_AsyncWrite(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_FDGetInfo(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_OpenCreate(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_TimedRead(void *, UT_EntryKey_t, const UT_StubContext_t *);
@@ -73,6 +74,42 @@ int32 OS_TimedWriteAbs(osal_id_t filedes, const void *buffer, size_t nbytes, OS_
     return UT_GenStub_GetReturnValue(OS_TimedWriteAbs, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_AsyncWait()
+ * ----------------------------------------------------
+ */
+int32 OS_AsyncWait(OS_AsyncIo_t *req, int32 timeout)
+{
+    UT_GenStub_SetupReturnBuffer(OS_AsyncWait, int32);
+
+    UT_GenStub_AddParam(OS_AsyncWait, OS_AsyncIo_t *, req);
+    UT_GenStub_AddParam(OS_AsyncWait, int32, timeout);
+
+    UT_GenStub_Execute(OS_AsyncWait, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_AsyncWait, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_AsyncWrite()
+ * ----------------------------------------------------
+ */
+int32 OS_AsyncWrite(osal_id_t filedes, const void *buffer, size_t nbytes, OS_AsyncIo_t *req)
+{
+    UT_GenStub_SetupReturnBuffer(OS_AsyncWrite, int32);
+
+    UT_GenStub_AddParam(OS_AsyncWrite, osal_id_t, filedes);
+    UT_GenStub_AddParam(OS_AsyncWrite, const void *, buffer);
+    UT_GenStub_AddParam(OS_AsyncWrite, size_t, nbytes);
+    UT_GenStub_AddParam(OS_AsyncWrite, OS_AsyncIo_t *, req);
+
+    UT_GenStub_Execute(OS_AsyncWrite, Basic, UT_DefaultHandler_OS_AsyncWrite);
+
+    return UT_GenStub_GetReturnValue(OS_AsyncWrite, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_CloseAllFiles()
@@ -134,6 +134,25 @@ void UT_DefaultHandler_OS_TaskGetInfo(void *UserObj, UT_EntryKey_t FuncKey, cons
     }
 }
 
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_TaskGetCpuTime' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_TaskGetCpuTime(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    OS_time_t *cpu_time = UT_Hook_GetArgValueByName(Context, "cpu_time", OS_time_t *);
+    int32      status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    if (status == OS_SUCCESS &&
+        UT_Stub_CopyToLocal(UT_KEY(OS_TaskGetCpuTime), cpu_time, sizeof(*cpu_time)) < sizeof(*cpu_time))
+    {
+        *cpu_time = OS_TimeAssembleFromNanoseconds(0, 0);
+    }
+}
+
 /*
  * -----------------------------------------------------------------
  * Default handler implementation for 'OS_TaskFindIdBySystemData' stub
@@ -28,6 +28,7 @@
 void UT_DefaultHandler_OS_TaskCreate(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_TaskDelete(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_TaskFindIdBySystemData(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_TaskGetCpuTime(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_TaskGetId(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_TaskGetIdByName(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_TaskGetInfo(void *, UT_EntryKey_t, const UT_StubContext_t *);
@@ -116,6 +117,23 @@ int32 OS_TaskFindIdBySystemData(osal_id_t *task_id, const void *sysdata, size_t
     return UT_GenStub_GetReturnValue(OS_TaskFindIdBySystemData, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_TaskGetCpuTime()
+ * ----------------------------------------------------
+ */
+int32 OS_TaskGetCpuTime(osal_id_t task_id, OS_time_t *cpu_time)
+{
+    UT_GenStub_SetupReturnBuffer(OS_TaskGetCpuTime, int32);
+
+    UT_GenStub_AddParam(OS_TaskGetCpuTime, osal_id_t, task_id);
+    UT_GenStub_AddParam(OS_TaskGetCpuTime, OS_time_t *, cpu_time);
+
+    UT_GenStub_Execute(OS_TaskGetCpuTime, Basic, UT_DefaultHandler_OS_TaskGetCpuTime);
+
+    return UT_GenStub_GetReturnValue(OS_TaskGetCpuTime, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_TaskGetId()
@@ -180,6 +198,23 @@ int32 OS_TaskInstallDeleteHandler(osal_task_entry function_pointer)
     return UT_GenStub_GetReturnValue(OS_TaskInstallDeleteHandler, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_TaskSetAffinity()
+ * ----------------------------------------------------
+ */
+int32 OS_TaskSetAffinity(osal_id_t task_id, uint32 cpu_mask)
+{
+    UT_GenStub_SetupReturnBuffer(OS_TaskSetAffinity, int32);
+
+    UT_GenStub_AddParam(OS_TaskSetAffinity, osal_id_t, task_id);
+    UT_GenStub_AddParam(OS_TaskSetAffinity, uint32, cpu_mask);
+
+    UT_GenStub_Execute(OS_TaskSetAffinity, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_TaskSetAffinity, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_TaskSetPriority()
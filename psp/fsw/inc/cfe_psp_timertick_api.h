@@ -134,4 +134,24 @@ uint32 CFE_PSP_GetTimerLow32Rollover(void);
  */
 void CFE_PSP_Get_Timebase(uint32 *Tbu, uint32 *Tbl);
 
+
+/*--------------------------------------------------------------------------------------*/
+/**
+ * @brief Sample the CPU time consumed by a task
+ *
+ * Outputs the total processor time that has been charged to the given
+ * task since it was created.  Any task may be sampled, not only the caller,
+ * so Executive Services can account for the CPU utilization of every task
+ * from its housekeeping cycle.  Only differences between two samples of the
+ * same task are meaningful.
+ *
+ * @param[in]  TaskId  OSAL ID of the task to sample
+ * @param[out] CpuTime CPU time consumed by the task as OS_time_t
+ *
+ * @retval CFE_PSP_SUCCESS if the value was sampled
+ * @retval CFE_PSP_ERROR if the task could not be sampled, e.g. it no longer exists
+ * @retval CFE_PSP_ERROR_NOT_IMPLEMENTED if per-task CPU time is not available on this platform
+ */
+int32 CFE_PSP_GetTaskCpuTime(osal_id_t TaskId, OS_time_t *CpuTime);
+
 #endif
@@ -11,6 +11,9 @@
 /*
  * NOTE: This relies on the Linux Kernel sched stats via the /proc filesystem.
  * Documented here: https://docs.kernel.org/scheduler/sched-stats.html
+ *
+ * The per-task statistics come from /proc/self/task/<tid>/sched, which is
+ * only present if the kernel was built with CONFIG_SCHED_DEBUG.
  */
 
 /************************************************************************
@@ -19,6 +22,9 @@
 
 #include <fcntl.h>
 #include <ctype.h>
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <unistd.h>
 #include <errno.h>
 #include <string.h>
@@ -39,8 +45,13 @@
 
 #define LINUX_SYSMON_AGGREGATE_SUBSYS   0
 #define LINUX_SYSMON_CPULOAD_SUBSYS     1
+#define LINUX_SYSMON_MIGRATIONS_SUBSYS  2
+#define LINUX_SYSMON_CTXSW_SUBSYS       3
 #define LINUX_SYSMON_AGGR_CPULOAD_SUBCH 0
 #define LINUX_SYSMON_MAX_CPUS           128
+#define LINUX_SYSMON_MAX_TASKS          128
+#define LINUX_SYSMON_TASK_NAME_LEN      16
+#define LINUX_SYSMON_TASK_SCHED_BUFSIZE 4096
 #define LINUX_SYSMON_SAMPLE_DELAY       30
 
 #ifdef DEBUG_BUILD
@@ -59,6 +70,16 @@ typedef struct linux_sysmon_cpuload_core
     unsigned long              last_run_time;
 } linux_sysmon_cpuload_core_t;
 
+typedef struct linux_sysmon_task
+{
+    pid_t                      tid; /* zero if this slot is unused */
+    char                       name[LINUX_SYSMON_TASK_NAME_LEN];
+    unsigned long              last_migrations;
+    unsigned long              last_nvcsw;
+    CFE_PSP_IODriver_AdcCode_t migrations; /* CPU migrations during the last sample period */
+    CFE_PSP_IODriver_AdcCode_t nvcsw;      /* involuntary context switches during the last sample period */
+} linux_sysmon_task_t;
+
 typedef struct linux_sysmon_cpuload_state
 {
     volatile bool is_running;
@@ -71,6 +92,9 @@ typedef struct linux_sysmon_cpuload_state
     uint64_t  last_sample_time;
 
     linux_sysmon_cpuload_core_t per_core[LINUX_SYSMON_MAX_CPUS];
+
+    uint32_t            num_tasks; /* highest task slot in use, plus one */
+    linux_sysmon_task_t per_task[LINUX_SYSMON_MAX_TASKS];
 } linux_sysmon_cpuload_state_t;
 
 typedef struct linux_sysmon_state
@@ -103,7 +127,8 @@ CFE_PSP_MODULE_DECLARE_IODEVICEDRIVER(linux_sysmon);
 
 static linux_sysmon_state_t linux_sysmon_global;
 
-static const char *linux_sysmon_subsystem_names[]  = {"aggregate", "per-cpu", NULL};
+static const char *linux_sysmon_subsystem_names[]  = {"aggregate", "per-cpu", "per-task-migrations", "per-task-ctxsw",
+                                                      NULL};
 static const char *linux_sysmon_subchannel_names[] = {"cpu-load", NULL};
 
 /***********************************************************************
@@ -259,6 +284,164 @@ void linux_sysmon_update_schedstat(linux_sysmon_cpuload_state_t *state, int elap
     state->num_cpus = 1 + highest_cpu_num;
 }
 
+bool linux_sysmon_read_task_sched(pid_t tid, char *name, unsigned long *migrations, unsigned long *nvcsw)
+{
+    char        path[64];
+    char        sched_data[LINUX_SYSMON_TASK_SCHED_BUFSIZE];
+    const char *val_p;
+    ssize_t     sched_size;
+    size_t      name_len;
+    int         fd;
+
+    snprintf(path, sizeof(path), "/proc/self/task/%d/sched", (int)tid);
+    fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    sched_size = read(fd, sched_data, sizeof(sched_data) - 1);
+    close(fd);
+    if (sched_size <= 0)
+    {
+        return false;
+    }
+    sched_data[sched_size] = 0;
+
+    /* the first line is the thread name followed by " (tid, #threads: n)" */
+    val_p = strstr(sched_data, " (");
+    if (val_p != NULL)
+    {
+        name_len = val_p - sched_data;
+        if (name_len >= LINUX_SYSMON_TASK_NAME_LEN)
+        {
+            name_len = LINUX_SYSMON_TASK_NAME_LEN - 1;
+        }
+        memcpy(name, sched_data, name_len);
+        name[name_len] = 0;
+    }
+
+    /* the remaining lines are in the form "field : value" */
+    val_p = strstr(sched_data, "se.nr_migrations");
+    if (val_p != NULL && (val_p = strchr(val_p, ':')) != NULL)
+    {
+        *migrations = strtoul(val_p + 1, NULL, 10);
+    }
+
+    val_p = strstr(sched_data, "nr_involuntary_switches");
+    if (val_p != NULL && (val_p = strchr(val_p, ':')) != NULL)
+    {
+        *nvcsw = strtoul(val_p + 1, NULL, 10);
+    }
+
+    return true;
+}
+
+void linux_sysmon_update_taskstat(linux_sysmon_cpuload_state_t *state)
+{
+    DIR *                dirp;
+    struct dirent *      entry_p;
+    linux_sysmon_task_t *task_p;
+    bool                 seen[LINUX_SYSMON_MAX_TASKS];
+    char                 name[LINUX_SYSMON_TASK_NAME_LEN];
+    unsigned long        migrations;
+    unsigned long        nvcsw;
+    unsigned long        value;
+    char *               val_end;
+    uint32_t             slot;
+    uint32_t             free_slot;
+
+    dirp = opendir("/proc/self/task");
+    if (dirp == NULL)
+    {
+        return;
+    }
+
+    memset(seen, 0, sizeof(seen));
+
+    while ((entry_p = readdir(dirp)) != NULL)
+    {
+        /* each thread is a directory named by its tid, skip anything else */
+        value = strtoul(entry_p->d_name, &val_end, 10);
+        if (val_end == entry_p->d_name || *val_end != 0)
+        {
+            continue;
+        }
+
+        memset(name, 0, sizeof(name));
+        migrations = 0;
+        nvcsw      = 0;
+        if (!linux_sysmon_read_task_sched(value, name, &migrations, &nvcsw))
+        {
+            continue;
+        }
+
+        /* a thread keeps its slot for as long as it exists */
+        free_slot = LINUX_SYSMON_MAX_TASKS;
+        for (slot = 0; slot < state->num_tasks; ++slot)
+        {
+            if (state->per_task[slot].tid == (pid_t)value)
+            {
+                break;
+            }
+            if (state->per_task[slot].tid == 0 && free_slot == LINUX_SYSMON_MAX_TASKS)
+            {
+                free_slot = slot;
+            }
+        }
+
+        if (slot < state->num_tasks)
+        {
+            task_p             = &state->per_task[slot];
+            task_p->migrations = migrations - task_p->last_migrations;
+            task_p->nvcsw      = nvcsw - task_p->last_nvcsw;
+        }
+        else
+        {
+            if (free_slot < LINUX_SYSMON_MAX_TASKS)
+            {
+                slot = free_slot;
+            }
+            else if (state->num_tasks < LINUX_SYSMON_MAX_TASKS)
+            {
+                slot = state->num_tasks;
+            }
+            else
+            {
+                /* no room to track this thread */
+                continue;
+            }
+
+            task_p = &state->per_task[slot];
+            memset(task_p, 0, sizeof(*task_p));
+            task_p->tid = value;
+            strncpy(task_p->name, name, sizeof(task_p->name) - 1);
+            if (slot >= state->num_tasks)
+            {
+                state->num_tasks = slot + 1;
+            }
+        }
+
+        task_p->last_migrations = migrations;
+        task_p->last_nvcsw      = nvcsw;
+        seen[slot]              = true;
+
+        LINUX_SYSMON_DEBUG("CFE_PSP(linux_sysmon): task %s migrations=%d nvcsw=%d\n", task_p->name,
+                           (int)task_p->migrations, (int)task_p->nvcsw);
+    }
+
+    closedir(dirp);
+
+    /* release the slots of threads that have exited */
+    for (slot = 0; slot < state->num_tasks; ++slot)
+    {
+        if (!seen[slot])
+        {
+            memset(&state->per_task[slot], 0, sizeof(state->per_task[slot]));
+        }
+    }
+}
+
 void *linux_sysmon_Task(void *arg)
 {
     linux_sysmon_cpuload_state_t *state = arg;
@@ -274,6 +457,7 @@ void *linux_sysmon_Task(void *arg)
     memset(&pfd, 0, sizeof(pfd));
 
     linux_sysmon_update_schedstat(state, 0);
+    linux_sysmon_update_taskstat(state);
 
     while (state->should_run)
     {
@@ -288,6 +472,7 @@ void *linux_sysmon_Task(void *arg)
         CFE_PSP_GetTime(&curr_sample);
         msec_diff = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(curr_sample, last_sample));
         linux_sysmon_update_schedstat(state, msec_diff);
+        linux_sysmon_update_taskstat(state);
     }
 
     return NULL;
@@ -551,6 +736,70 @@ int32_t linux_sysmon_cpu_load_dispatch(uint32_t CommandCode, uint16_t Subchannel
     return StatusCode;
 }
 
+int32_t linux_sysmon_task_stat_dispatch(uint32_t CommandCode, uint16_t SubsystemId, uint16_t Subchannel,
+                                        CFE_PSP_IODriver_Arg_t Arg)
+{
+    int32_t                       StatusCode;
+    linux_sysmon_cpuload_state_t *state;
+    linux_sysmon_task_t *         task_p;
+
+    /* There is just one global cpuload object */
+    state      = &linux_sysmon_global.cpu_load;
+    StatusCode = CFE_PSP_ERROR_NOT_IMPLEMENTED;
+    switch (CommandCode)
+    {
+        case CFE_PSP_IODriver_NOOP:
+        case CFE_PSP_IODriver_ANALOG_IO_NOOP:
+        {
+            StatusCode = CFE_PSP_SUCCESS;
+            break;
+        }
+        case CFE_PSP_IODriver_LOOKUP_SUBCHANNEL: /**< const char * argument, looks up the thread name and returns
+                                                    its channel number, negative value for error */
+        {
+            uint16_t i;
+
+            for (i = 0; i < state->num_tasks; ++i)
+            {
+                if (state->per_task[i].tid != 0 && strcmp(Arg.ConstStr, state->per_task[i].name) == 0)
+                {
+                    StatusCode = i;
+                    break;
+                }
+            }
+
+            break;
+        }
+        case CFE_PSP_IODriver_ANALOG_IO_READ_CHANNELS:
+        {
+            CFE_PSP_IODriver_AnalogRdWr_t *RdWr = Arg.Vptr;
+            uint32_t                       ch;
+
+            if (Subchannel < state->num_tasks && (Subchannel + RdWr->NumChannels) <= state->num_tasks)
+            {
+                for (ch = Subchannel; ch < (Subchannel + RdWr->NumChannels); ++ch)
+                {
+                    task_p = &state->per_task[ch];
+                    if (SubsystemId == LINUX_SYSMON_MIGRATIONS_SUBSYS)
+                    {
+                        RdWr->Samples[ch - Subchannel] = task_p->migrations;
+                    }
+                    else
+                    {
+                        RdWr->Samples[ch - Subchannel] = task_p->nvcsw;
+                    }
+                }
+                StatusCode = CFE_PSP_SUCCESS;
+            }
+            break;
+        }
+        default:
+            break;
+    }
+
+    return StatusCode;
+}
+
 /* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 /*    linux_sysmon_DevCmd()                                         */
 /* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
@@ -584,6 +833,10 @@ int32_t linux_sysmon_DevCmd(uint32_t CommandCode, uint16_t SubsystemId, uint16_t
         case LINUX_SYSMON_CPULOAD_SUBSYS:
             StatusCode = linux_sysmon_cpu_load_dispatch(CommandCode, SubchannelId, Arg);
             break;
+        case LINUX_SYSMON_MIGRATIONS_SUBSYS:
+        case LINUX_SYSMON_CTXSW_SUBSYS:
+            StatusCode = linux_sysmon_task_stat_dispatch(CommandCode, SubsystemId, SubchannelId, Arg);
+            break;
         default:
             /* not implemented */
             break;
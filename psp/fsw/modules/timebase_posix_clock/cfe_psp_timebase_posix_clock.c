@@ -32,6 +32,13 @@
  * nanoseconds, but this is converted down to units of microseconds for
  * consistency with previous versions of PSP where CFE_PSP_Get_Timebase()
  * returned units of microseconds.
+ *
+ * On x86-64 processors with an invariant TSC that the kernel itself trusts
+ * as its clocksource, the TSC is calibrated against the monotonic clock at
+ * startup and read directly thereafter.  This avoids the clock_gettime()
+ * call on every time stamp while producing the same units and epoch.  An
+ * OSAL timer re-anchors the calibration to the monotonic clock periodically
+ * so the TSC line cannot drift away from it; see CFE_PSP_TimebaseReanchorTsc().
  */
 
 /*
@@ -39,11 +46,19 @@
 */
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
+#include <unistd.h>
 
 #include "cfe_psp.h"
 #include "cfe_psp_module.h"
 
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <cpuid.h>
+#include <x86intrin.h>
+#define CFE_PSP_TIMEBASE_HAVE_TSC
+#endif
+
 /*
  * The specific clock ID to use with clock_gettime
  *
@@ -59,10 +74,390 @@
  */
 #define CFE_PSP_TIMEBASE_REF_CLOCK CLOCK_MONOTONIC
 
+#ifdef CFE_PSP_TIMEBASE_HAVE_TSC
+
+/*
+ * Length of the TSC calibration interval, in milliseconds.
+ * Sampling jitter of a few hundred ns over this interval keeps
+ * the rate error in the low parts-per-million.
+ */
+#define CFE_PSP_TIMEBASE_TSC_CALIBRATION_MSEC 50
+
+/*
+ * Interval between re-anchors of the TSC line to the reference clock,
+ * in milliseconds.  Each re-anchor also re-measures the rate over the
+ * preceding interval, which tracks NTP slewing of CLOCK_MONOTONIC.
+ */
+#define CFE_PSP_TIMEBASE_TSC_REANCHOR_MSEC 1000
+
+/*
+ * Name of the OSAL timer that re-anchors the TSC line
+ */
+#define CFE_PSP_TIMEBASE_TSC_TIMER_NAME "PSP_TSC_REANCHOR"
+
+/*
+ * The kernel clocksource selection, which is only "tsc" if the kernel
+ * has verified the TSC is synchronized across CPUs and stable.
+ */
+#define CFE_PSP_TIMEBASE_CLOCKSOURCE_FILE "/sys/devices/system/clocksource/clocksource0/current_clocksource"
+
+/*
+ * A line of the TSC to nanosecond conversion
+ */
+typedef struct
+{
+    uint64 TscBase;    /**< TSC value at the start of the line */
+    uint64 NsecBase;   /**< Time at TscBase, in nanoseconds */
+    uint64 NsecPerTsc; /**< Nanoseconds per TSC tick, 32.32 fixed point */
+} CFE_PSP_TimebaseTscLine_t;
+
+/*
+ * One segment of the conversion.
+ *
+ * Each segment ends at TscEnd, where the time stops advancing until the next
+ * segment is published.  The next segment takes over at exactly that point:
+ * its Line starts at the previous TscEnd, and before that it follows the
+ * previous line (Prev) with the same arithmetic.  So for any TSC value, a
+ * reader still on the old segment never gets a later time than a reader on
+ * the new one, however the two race with the publish.
+ */
+typedef struct
+{
+    CFE_PSP_TimebaseTscLine_t Prev;   /**< Line in use before Line.TscBase */
+    CFE_PSP_TimebaseTscLine_t Line;   /**< Line in use from Line.TscBase to TscEnd */
+    uint64                    TscEnd; /**< TSC value at which the time stops until the next segment */
+} CFE_PSP_TimebaseTscSegment_t;
+
+/*
+ * The current segment is published through a version counter in the same
+ * way as the TIME reference state: a re-anchor fills in the inactive copy,
+ * then increments Version to make it current.  Readers copy the segment
+ * selected by Version and retry if Version changed meanwhile, so they never
+ * wait on a re-anchor in progress.  Re-anchors only run on the OSAL timer,
+ * so there is a single writer.
+ */
+typedef struct
+{
+    bool                         UseTsc;
+    uint32                       Version; /**< Selects the current segment, incremented on publish */
+    CFE_PSP_TimebaseTscSegment_t Segment[2];
+    uint64                       RefTsc;      /**< TSC at the last reference clock sample */
+    uint64                       RefNsec;     /**< Reference clock at the last sample, in nanoseconds */
+    uint64                       ReanchorTsc; /**< Re-anchor interval in TSC ticks */
+    osal_id_t                    TimerId;     /**< OSAL timer running the re-anchors */
+} CFE_PSP_TimebaseTsc_t;
+
+/* 128-bit intermediate for the fixed point scaling (a GCC extension on x86-64) */
+__extension__ typedef unsigned __int128 CFE_PSP_TimebaseWide_t;
+
+static CFE_PSP_TimebaseTsc_t CFE_PSP_TimebaseTsc;
+
+static uint64 CFE_PSP_TimebaseReadRefNsec(void)
+{
+    struct timespec now;
+
+    if (clock_gettime(CFE_PSP_TIMEBASE_REF_CLOCK, &now) != 0)
+    {
+        return 0;
+    }
+
+    return ((uint64)now.tv_sec * 1000000000) + now.tv_nsec;
+}
+
+/*
+ * Takes a paired sample of the TSC and the reference clock, keeping
+ * the tightest of a few attempts to limit the effect of preemption.
+ */
+static void CFE_PSP_TimebaseSampleTsc(uint64 *Tsc, uint64 *Nsec)
+{
+    uint64 Before;
+    uint64 After;
+    uint64 Count;
+    uint64 BestSpan;
+    int    i;
+
+    *Tsc     = 0;
+    *Nsec    = 0;
+    BestSpan = UINT64_MAX;
+    for (i = 0; i < 8; ++i)
+    {
+        Before = CFE_PSP_TimebaseReadRefNsec();
+        Count  = __rdtsc();
+        After  = CFE_PSP_TimebaseReadRefNsec();
+
+        if (After - Before < BestSpan)
+        {
+            BestSpan = After - Before;
+            *Tsc     = Count;
+            *Nsec    = Before + (BestSpan / 2);
+        }
+    }
+}
+
+/*
+ * Computes the 32.32 fixed point rate between two paired samples
+ */
+static uint64 CFE_PSP_TimebaseTscRate(uint64 TscSpan, uint64 NsecSpan)
+{
+    return (uint64)(((CFE_PSP_TimebaseWide_t)NsecSpan << 32) / TscSpan);
+}
+
+/*
+ * Converts a number of TSC ticks to nanoseconds at the given rate
+ */
+static inline uint64 CFE_PSP_TimebaseTicksToNsec(uint64 Ticks, uint64 NsecPerTsc)
+{
+    return (uint64)(((CFE_PSP_TimebaseWide_t)Ticks * NsecPerTsc) >> 32);
+}
+
+/*
+ * Converts a TSC value to nanoseconds using the given line
+ */
+static inline uint64 CFE_PSP_TimebaseLineToNsec(const CFE_PSP_TimebaseTscLine_t *Line, uint64 Tsc)
+{
+    uint64 Ticks;
+
+    /* rdtsc is not serializing, so it may be sampled marginally before the line base */
+    Ticks = 0;
+    if (Tsc > Line->TscBase)
+    {
+        Ticks = Tsc - Line->TscBase;
+    }
+
+    return Line->NsecBase + CFE_PSP_TimebaseTicksToNsec(Ticks, Line->NsecPerTsc);
+}
+
+/*
+ * Converts a TSC value to nanoseconds using the given segment
+ */
+static inline uint64 CFE_PSP_TimebaseTscToNsec(const CFE_PSP_TimebaseTscSegment_t *Seg, uint64 Tsc)
+{
+    if (Tsc < Seg->Line.TscBase)
+    {
+        return CFE_PSP_TimebaseLineToNsec(&Seg->Prev, Tsc);
+    }
+
+    if (Tsc > Seg->TscEnd)
+    {
+        Tsc = Seg->TscEnd;
+    }
+
+    return CFE_PSP_TimebaseLineToNsec(&Seg->Line, Tsc);
+}
+
+/*
+ * Publishes the segment after the current one, starting at the end of the
+ * current one and ending one re-anchor interval after the next re-anchor
+ * is due.
+ *
+ * The rate is re-measured over the interval since the previous sample.  The
+ * new line never starts behind the current one, so the output stays
+ * monotonic; if the TSC line has run ahead of the reference clock, the new
+ * line runs slow enough to absorb the difference by its end (but at no less
+ * than half rate), rather than stepping back.  If it has fallen behind, it
+ * steps forward to the reference clock.
+ *
+ * Runs on the OSAL timer every CFE_PSP_TIMEBASE_TSC_REANCHOR_MSEC.  If the
+ * timer is late by more than one interval, the time stands still from the
+ * end of the current segment until this runs.
+ */
+static void CFE_PSP_TimebaseReanchorTsc(osal_id_t TimerId)
+{
+    const CFE_PSP_TimebaseTscSegment_t *Current;
+    CFE_PSP_TimebaseTscSegment_t *      Next;
+    uint32                              Version;
+    uint64                              Tsc;
+    uint64                              Nsec;
+    uint64                              Knee;
+    uint64                              KneeNsec;
+    uint64                              RefKneeNsec;
+    uint64                              Rate;
+    uint64                              Slew;
+
+    Version = CFE_PSP_TimebaseTsc.Version;
+    Current = &CFE_PSP_TimebaseTsc.Segment[Version & 1];
+    Next    = &CFE_PSP_TimebaseTsc.Segment[(Version + 1) & 1];
+
+    CFE_PSP_TimebaseSampleTsc(&Tsc, &Nsec);
+
+    Rate = Current->Line.NsecPerTsc;
+    if (Tsc > CFE_PSP_TimebaseTsc.RefTsc && Nsec > CFE_PSP_TimebaseTsc.RefNsec)
+    {
+        Rate = CFE_PSP_TimebaseTscRate(Tsc - CFE_PSP_TimebaseTsc.RefTsc, Nsec - CFE_PSP_TimebaseTsc.RefNsec);
+    }
+
+    CFE_PSP_TimebaseTsc.RefTsc  = Tsc;
+    CFE_PSP_TimebaseTsc.RefNsec = Nsec;
+
+    /* The new line starts where the current segment stops; where the reference clock is then */
+    Knee     = Current->TscEnd;
+    KneeNsec = CFE_PSP_TimebaseTscToNsec(Current, Knee);
+    if (Knee >= Tsc)
+    {
+        RefKneeNsec = Nsec + CFE_PSP_TimebaseTicksToNsec(Knee - Tsc, Rate);
+    }
+    else
+    {
+        RefKneeNsec = Nsec - CFE_PSP_TimebaseTicksToNsec(Tsc - Knee, Rate);
+    }
+
+    Next->Prev            = Current->Line;
+    Next->Line.TscBase    = Knee;
+    Next->Line.NsecBase   = KneeNsec;
+    Next->Line.NsecPerTsc = Rate;
+    Next->TscEnd          = Tsc + (2 * CFE_PSP_TimebaseTsc.ReanchorTsc);
+    if (Next->TscEnd <= Knee)
+    {
+        Next->TscEnd = Knee + CFE_PSP_TimebaseTsc.ReanchorTsc;
+    }
+
+    if (RefKneeNsec > KneeNsec)
+    {
+        Next->Line.NsecBase = RefKneeNsec;
+    }
+    else if (KneeNsec > RefKneeNsec)
+    {
+        Slew = CFE_PSP_TimebaseTscRate(Next->TscEnd - Knee, KneeNsec - RefKneeNsec);
+        if (Slew > Rate / 2)
+        {
+            Slew = Rate / 2;
+        }
+        Next->Line.NsecPerTsc = Rate - Slew;
+    }
+
+    __atomic_store_n(&CFE_PSP_TimebaseTsc.Version, Version + 1, __ATOMIC_RELEASE);
+}
+
+/*
+ * Checks that the TSC is usable as a timebase, measures its rate and starts
+ * the timer that keeps it anchored to the reference clock.  Returns false
+ * if the clock_gettime() path should be used instead.
+ */
+static bool CFE_PSP_TimebaseCalibrateTsc(void)
+{
+    unsigned int                  eax;
+    unsigned int                  ebx;
+    unsigned int                  ecx;
+    unsigned int                  edx;
+    char                          ClockSource[16];
+    FILE *                        fp;
+    uint64                        Tsc0;
+    uint64                        Nsec0;
+    uint64                        Tsc1;
+    uint64                        Nsec1;
+    uint32                        Accuracy;
+    struct timespec               Delay;
+    CFE_PSP_TimebaseTscSegment_t *Seg;
+
+    /* CPUID 0x80000007 EDX bit 8: invariant TSC */
+    if (__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) == 0 || (edx & (1U << 8)) == 0)
+    {
+        return false;
+    }
+
+    memset(ClockSource, 0, sizeof(ClockSource));
+    fp = fopen(CFE_PSP_TIMEBASE_CLOCKSOURCE_FILE, "r");
+    if (fp != NULL)
+    {
+        if (fgets(ClockSource, sizeof(ClockSource), fp) == NULL)
+        {
+            ClockSource[0] = 0;
+        }
+        fclose(fp);
+    }
+    if (strncmp(ClockSource, "tsc", 3) != 0)
+    {
+        return false;
+    }
+
+    Delay.tv_sec  = 0;
+    Delay.tv_nsec = CFE_PSP_TIMEBASE_TSC_CALIBRATION_MSEC * 1000000;
+
+    CFE_PSP_TimebaseSampleTsc(&Tsc0, &Nsec0);
+    nanosleep(&Delay, NULL);
+    CFE_PSP_TimebaseSampleTsc(&Tsc1, &Nsec1);
+
+    if (Tsc1 <= Tsc0 || Nsec1 <= Nsec0)
+    {
+        return false;
+    }
+
+    Seg                  = &CFE_PSP_TimebaseTsc.Segment[0];
+    Seg->Line.NsecPerTsc = CFE_PSP_TimebaseTscRate(Tsc1 - Tsc0, Nsec1 - Nsec0);
+    Seg->Line.TscBase    = Tsc1;
+    Seg->Line.NsecBase   = Nsec1;
+    Seg->Prev            = Seg->Line;
+
+    CFE_PSP_TimebaseTsc.ReanchorTsc =
+        (uint64)(((CFE_PSP_TimebaseWide_t)CFE_PSP_TIMEBASE_TSC_REANCHOR_MSEC * 1000000 << 32) / Seg->Line.NsecPerTsc);
+
+    Seg->TscEnd                 = Tsc1 + (2 * CFE_PSP_TimebaseTsc.ReanchorTsc);
+    CFE_PSP_TimebaseTsc.RefTsc  = Tsc1;
+    CFE_PSP_TimebaseTsc.RefNsec = Nsec1;
+    CFE_PSP_TimebaseTsc.Version = 0;
+
+    /* Without the re-anchors the TSC line would drift away from the reference clock */
+    if (OS_TimerCreate(&CFE_PSP_TimebaseTsc.TimerId, CFE_PSP_TIMEBASE_TSC_TIMER_NAME, &Accuracy,
+                       CFE_PSP_TimebaseReanchorTsc) != OS_SUCCESS)
+    {
+        return false;
+    }
+    if (OS_TimerSet(CFE_PSP_TimebaseTsc.TimerId, CFE_PSP_TIMEBASE_TSC_REANCHOR_MSEC * 1000,
+                    CFE_PSP_TIMEBASE_TSC_REANCHOR_MSEC * 1000) != OS_SUCCESS)
+    {
+        OS_TimerDelete(CFE_PSP_TimebaseTsc.TimerId);
+        return false;
+    }
+
+    return true;
+}
+
+/*
+ * Gets the current time in nanoseconds from the calibrated TSC
+ */
+static inline uint64 CFE_PSP_TimebaseReadTscNsec(void)
+{
+    CFE_PSP_TimebaseTscSegment_t        Seg;
+    const CFE_PSP_TimebaseTscSegment_t *Src;
+    uint32                              Version;
+    uint64                              Tsc;
+
+    do
+    {
+        Version = __atomic_load_n(&CFE_PSP_TimebaseTsc.Version, __ATOMIC_ACQUIRE);
+        Src     = &CFE_PSP_TimebaseTsc.Segment[Version & 1];
+
+        Seg.Prev.TscBase    = __atomic_load_n(&Src->Prev.TscBase, __ATOMIC_RELAXED);
+        Seg.Prev.NsecBase   = __atomic_load_n(&Src->Prev.NsecBase, __ATOMIC_RELAXED);
+        Seg.Prev.NsecPerTsc = __atomic_load_n(&Src->Prev.NsecPerTsc, __ATOMIC_RELAXED);
+        Seg.Line.TscBase    = __atomic_load_n(&Src->Line.TscBase, __ATOMIC_RELAXED);
+        Seg.Line.NsecBase   = __atomic_load_n(&Src->Line.NsecBase, __ATOMIC_RELAXED);
+        Seg.Line.NsecPerTsc = __atomic_load_n(&Src->Line.NsecPerTsc, __ATOMIC_RELAXED);
+        Seg.TscEnd          = __atomic_load_n(&Src->TscEnd, __ATOMIC_RELAXED);
+        Tsc                 = __rdtsc();
+
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    } while (Version != __atomic_load_n(&CFE_PSP_TimebaseTsc.Version, __ATOMIC_RELAXED));
+
+    return CFE_PSP_TimebaseTscToNsec(&Seg, Tsc);
+}
+
+#endif /* CFE_PSP_TIMEBASE_HAVE_TSC */
+
 CFE_PSP_MODULE_DECLARE_SIMPLE(timebase_posix_clock);
 
 void timebase_posix_clock_Init(uint32 PspModuleId)
 {
+#ifdef CFE_PSP_TIMEBASE_HAVE_TSC
+    CFE_PSP_TimebaseTsc.UseTsc = CFE_PSP_TimebaseCalibrateTsc();
+    if (CFE_PSP_TimebaseTsc.UseTsc)
+    {
+        printf("CFE_PSP: Using calibrated invariant TSC (%lu kHz) as CFE timebase\n",
+               (unsigned long)((1000000ULL << 32) / CFE_PSP_TimebaseTsc.Segment[0].Line.NsecPerTsc));
+        return;
+    }
+#endif
+
     /* Inform the user that this module is in use */
     printf("CFE_PSP: Using POSIX monotonic clock as CFE timebase\n");
 }
@@ -71,8 +466,9 @@ void timebase_posix_clock_Init(uint32 PspModuleId)
  * ----------------------------------------------------------------------
  * The CFE_PSP_Get_Timebase() is a wrapper around clock_gettime()
  *
- * Reads the value of the monotonic POSIX clock, and output the value with
- * the whole seconds in the upper 32 and nanoseconds in the lower 32.
+ * Reads the value of the monotonic POSIX clock (or the TSC calibrated
+ * against it), and output the value with the whole seconds in the upper 32
+ * and nanoseconds in the lower 32.
  *
  * This variant does minimal conversions - just enough to meet the API.
  * For a normalized output use CFE_PSP_GetTime()
@@ -82,6 +478,17 @@ void CFE_PSP_Get_Timebase(uint32 *Tbu, uint32 *Tbl)
 {
     struct timespec now;
 
+#ifdef CFE_PSP_TIMEBASE_HAVE_TSC
+    if (CFE_PSP_TimebaseTsc.UseTsc)
+    {
+        uint64 Nsec = CFE_PSP_TimebaseReadTscNsec();
+
+        *Tbu = (Nsec / 1000000000) & 0xFFFFFFFF;
+        *Tbl = Nsec % 1000000000;
+        return;
+    }
+#endif
+
     if (clock_gettime(CFE_PSP_TIMEBASE_REF_CLOCK, &now) != 0)
     {
         /* unlikely - but avoids undefined behavior */
@@ -97,14 +504,24 @@ void CFE_PSP_Get_Timebase(uint32 *Tbu, uint32 *Tbl)
  * ----------------------------------------------------------------------
  * The CFE_PSP_GetTime() is also a wrapper around the same clock_gettime()
  *
- * Reads the value of the monotonic POSIX clock, and output the value
- * normalized to an OS_time_t format.
+ * Reads the value of the monotonic POSIX clock (or the TSC calibrated
+ * against it), and output the value normalized to an OS_time_t format.
  * ----------------------------------------------------------------------
  */
 void CFE_PSP_GetTime(OS_time_t *LocalTime)
 {
     struct timespec now;
 
+#ifdef CFE_PSP_TIMEBASE_HAVE_TSC
+    if (CFE_PSP_TimebaseTsc.UseTsc)
+    {
+        uint64 Nsec = CFE_PSP_TimebaseReadTscNsec();
+
+        *LocalTime = OS_TimeAssembleFromNanoseconds(Nsec / 1000000000, Nsec % 1000000000);
+        return;
+    }
+#endif
+
     if (clock_gettime(CFE_PSP_TIMEBASE_REF_CLOCK, &now) != 0)
     {
         /* unlikely - but avoids undefined behavior */
@@ -115,6 +532,33 @@ void CFE_PSP_GetTime(OS_time_t *LocalTime)
     *LocalTime = OS_TimeAssembleFromNanoseconds(now.tv_sec, now.tv_nsec);
 }
 
+/*
+ * ----------------------------------------------------------------------
+ * The CFE_PSP_GetTaskCpuTime() reads the POSIX CPU-time clock of a thread
+ *
+ * OSAL owns the pthread handles, so the clock is read through OSAL
+ * (pthread_getcpuclockid).  On Linux this is backed by the same accounting
+ * as the per-task "schedstat" entries, so it includes both user and system
+ * time charged to the thread.
+ * ----------------------------------------------------------------------
+ */
+int32 CFE_PSP_GetTaskCpuTime(osal_id_t TaskId, OS_time_t *CpuTime)
+{
+    int32 Status;
+
+    Status = OS_TaskGetCpuTime(TaskId, CpuTime);
+    if (Status == OS_ERR_NOT_IMPLEMENTED)
+    {
+        return CFE_PSP_ERROR_NOT_IMPLEMENTED;
+    }
+    if (Status != OS_SUCCESS)
+    {
+        return CFE_PSP_ERROR;
+    }
+
+    return CFE_PSP_SUCCESS;
+}
+
 /*----------------------------------------------------------------
  *
  * Implemented per public API
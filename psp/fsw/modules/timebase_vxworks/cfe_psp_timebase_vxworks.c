@@ -235,3 +235,20 @@ void CFE_PSP_GetTime(OS_time_t *LocalTime)
         *LocalTime = (OS_time_t) {NormalizedTicks};
     }
 }
+
+/******************************************************************************
+**
+**  Purpose: Gets the CPU time consumed by a task
+**
+**  Arguments: TaskId - OSAL ID of the task to sample
+**             CpuTime - where the CPU time would be returned through
+**
+**  VxWorks does not keep per-task execution time by default (it requires the
+**  optional spy/CPU usage reporter), so this is not implemented here.
+**
+******************************************************************************/
+
+int32 CFE_PSP_GetTaskCpuTime(osal_id_t TaskId, OS_time_t *CpuTime)
+{
+    return CFE_PSP_ERROR_NOT_IMPLEMENTED;
+}
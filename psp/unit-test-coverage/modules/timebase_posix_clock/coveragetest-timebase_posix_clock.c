@@ -16,23 +16,11 @@
  * limitations under the License.
  ************************************************************************/
 
-/*
- *
- *    Copyright (c) 2020, United States government as represented by the
- *    administrator of the National Aeronautics Space Administration.
- *    All rights reserved. This software was created at NASA Goddard
- *    Space Flight Center pursuant to government contracts.
- *
- *    This is governed by the NASA Open Source Agreement and may be used,
- *    distributed and modified only according to the terms of that agreement.
- *
- */
-
 /**
  * \file
  * \ingroup  modules
  *
- * Coverage test for VxWorks timebase module implementation
+ * Coverage test for POSIX clock timebase module implementation
  */
 
 #include "utassert.h"
@@ -43,347 +31,455 @@
 #include "cfe_psp_config.h"
 #include "cfe_psp_module.h"
 
-#include "PCS_arch_ppc_vxPpcLib.h"
+#include "PCS_cpuid.h"
+#include "PCS_stdio.h"
+#include "PCS_time.h"
+#include "PCS_x86intrin.h"
 
 /*
- * Reference to the API entry point for the module
+ * The simulated TSC runs at 2 GHz, so 2 ticks per nanosecond, and the
+ * module re-anchors every 1 second (2e9 ticks), with segments ending
+ * 2 intervals after the re-anchor that published them
  */
-extern CFE_PSP_ModuleApi_t CFE_PSP_timebase_vxworks_API;
+#define UT_TSC_PER_NSEC    2
+#define UT_REANCHOR_TSC    2000000000ULL
+#define UT_SEGMENT_TSC     (2 * UT_REANCHOR_TSC)
+#define UT_CALIBRATE_NSEC  50000000ULL
+#define UT_START_TSC       1000000ULL
+#define UT_START_NSEC      5000000000ULL
 
-const CFE_PSP_ModuleApi_t *TgtAPI = &CFE_PSP_timebase_vxworks_API;
+extern void timebase_posix_clock_Init(uint32 PspModuleId);
 
-UT_PSP_TimeBase_VxWorks_TestConfig_t UT_PSP_TIMEBASE_VXWORKS_TESTCONFIG;
+/* The simulated TSC and reference clock */
+static uint64 UT_Tsc;
+static uint64 UT_RefNsec;
 
-typedef struct
+/* The re-anchor callback passed to OS_TimerCreate() */
+static OS_TimerCallback_t UT_ReanchorCallback;
+
+static void UT_Handler_rdtsc(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
 {
-    uint32 u;
-    uint32 l;
-} PSP_VxWorks_TimeBaseVal_t;
+    unsigned long long Value = UT_Tsc;
 
-void ModuleTest_ResetState(void)
+    UT_Stub_SetReturnValue(FuncKey, Value);
+}
+
+static void UT_Handler_clock_gettime(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
 {
-    memset(&UT_PSP_TIMEBASE_VXWORKS_TESTCONFIG, 0, sizeof(UT_PSP_TIMEBASE_VXWORKS_TESTCONFIG));
+    struct PCS_timespec *t = UT_Hook_GetArgValueByName(Context, "t", struct PCS_timespec *);
+    int32                Status;
+
+    UT_Stub_GetInt32StatusCode(Context, &Status);
+
+    if (Status == 0)
+    {
+        t->tv_sec  = UT_RefNsec / 1000000000;
+        t->tv_nsec = UT_RefNsec % 1000000000;
+    }
 }
 
-int32 UTHOOK_vxTimeBaseGet(void *UserObj, int32 StubRetcode, uint32 CallCount, const UT_StubContext_t *Context)
+/*
+ * Sleeping advances the TSC and the reference clock together
+ */
+static int32 UT_NanosleepHook(void *UserObj, int32 StubRetcode, uint32 CallCount, const UT_StubContext_t *Context)
 {
-    PSP_VxWorks_TimeBaseVal_t *val = UserObj;
-    uint32 *                   u   = UT_Hook_GetArgValueByName(Context, "u", uint32 *);
-    uint32 *                   l   = UT_Hook_GetArgValueByName(Context, "l", uint32 *);
+    const struct PCS_timespec *req = UT_Hook_GetArgValueByName(Context, "req", const struct PCS_timespec *);
+    uint64                     Nsec;
 
-    *u = val->u;
-    *l = val->l;
+    Nsec = ((uint64)req->tv_sec * 1000000000) + req->tv_nsec;
+    UT_Tsc += Nsec * UT_TSC_PER_NSEC;
+    UT_RefNsec += Nsec;
 
     return StubRetcode;
 }
 
-void Test_Nominal(void)
+static int32 UT_TimerCreateHook(void *UserObj, int32 StubRetcode, uint32 CallCount, const UT_StubContext_t *Context)
 {
-    OS_time_t                 OsTime;
-    PSP_VxWorks_TimeBaseVal_t VxTime;
+    UT_ReanchorCallback = UT_Hook_GetArgValueByName(Context, "callback_ptr", OS_TimerCallback_t);
 
-    memset(&OsTime, 0, sizeof(OsTime));
+    return StubRetcode;
+}
 
-    /* Nominal test with a simple 1:1 ratio */
-    UT_PSP_TIMEBASE_VXWORKS_TESTCONFIG.PeriodNumerator   = 1;
-    UT_PSP_TIMEBASE_VXWORKS_TESTCONFIG.PeriodDenominator = 1;
-    TgtAPI->Init(0);
-    UtAssert_UINT32_EQ(CFE_PSP_GetTimerTicksPerSecond(), 1000000000);
+/*
+ * Makes the simulated host pass every check for using the TSC
+ */
+static void UT_SetupTsc(void)
+{
+    static const unsigned int InvariantTsc[4] = {0, 0, 0, 1U << 8};
+    static char               ClockSource[]   = "tsc\n";
 
-    /* Check operation of CFE_PSP_GetTime() */
-    UT_SetHookFunction(UT_KEY(PCS_vxTimeBaseGet), UTHOOK_vxTimeBaseGet, &VxTime);
-    VxTime.u = 0;
-    VxTime.l = 10000;
-    CFE_PSP_GetTime(&OsTime);
+    UT_Tsc     = UT_START_TSC;
+    UT_RefNsec = UT_START_NSEC;
+
+    UT_SetHandlerFunction(UT_KEY(PCS_rdtsc), UT_Handler_rdtsc, NULL);
+    UT_SetHandlerFunction(UT_KEY(PCS_clock_gettime), UT_Handler_clock_gettime, NULL);
+    UT_SetHookFunction(UT_KEY(PCS_nanosleep), UT_NanosleepHook, NULL);
+    UT_SetHookFunction(UT_KEY(OS_TimerCreate), UT_TimerCreateHook, NULL);
 
-    UtAssert_UINT32_EQ(OS_TimeGetNanosecondsPart(OsTime), 10000);
+    UT_SetDefaultReturnValue(UT_KEY(PCS_get_cpuid), 1);
+    UT_SetDataBuffer(UT_KEY(PCS_get_cpuid), (void *)InvariantTsc, sizeof(InvariantTsc), false);
+    UT_SetDeferredRetcode(UT_KEY(PCS_fgets), 1, 4);
+    UT_SetDataBuffer(UT_KEY(PCS_fgets), ClockSource, 4, false);
 }
 
-void Test_Non_Reducible(void)
+/*
+ * Reads the time with the simulated TSC at the given value
+ */
+static uint64 UT_ReadNsec(uint64 Tsc)
 {
-    OS_time_t                 OsTime;
-    PSP_VxWorks_TimeBaseVal_t VxTime;
-    int64                     TestTime;
-
-    memset(&OsTime, 0, sizeof(OsTime));
-
-    /* Use an oddball ratio of of some primes, will not be reducible */
-    /* Ratio is 43*3 / 53*2  => 129/106 */
-    /* This translates to about ~1.217ns per tick */
-    UT_PSP_TIMEBASE_VXWORKS_TESTCONFIG.PeriodNumerator   = 43 * 3;
-    UT_PSP_TIMEBASE_VXWORKS_TESTCONFIG.PeriodDenominator = 53 * 2;
-    TgtAPI->Init(0);
-    UtAssert_UINT32_EQ(CFE_PSP_GetTimerTicksPerSecond(), 821705426);
-
-    /*
-     * Check operation of CFE_PSP_GetTime()
-     *
-     * This test requires that the conversion uses the actual ratio,
-     * otherwise a rounding error will be noticed.
-     * For example:
-     * Conversion using 1.217ns/tick yields 52269758 usec (wrong).
-     * Conversion using actual ratio yields 52268947 usec.
-     */
-
-    UT_SetHookFunction(UT_KEY(PCS_vxTimeBaseGet), UTHOOK_vxTimeBaseGet, &VxTime);
-    VxTime.u = 10;
-    VxTime.l = 5000;
-    CFE_PSP_GetTime(&OsTime);
+    uint32 Tbu;
+    uint32 Tbl;
+
+    UT_Tsc = Tsc;
+    CFE_PSP_Get_Timebase(&Tbu, &Tbl);
 
-    TestTime = OS_TimeGetTotalMicroseconds(OsTime);
-    UtAssert_True(TestTime == 52268947, "CFE_PSP_GetTime() Microseconds (%lld) == 52268947", (long long)TestTime);
+    return ((uint64)Tbu * 1000000000) + Tbl;
 }
 
-void Test_Reducible_1(void)
+/*
+ * Advances the simulated clocks and runs a re-anchor, checking that no TSC
+ * value around it reads earlier after the re-anchor than before it
+ */
+static void UT_Reanchor(uint64 TscStep, uint64 NsecStep, uint64 *Before, uint64 *After, const uint64 *Points,
+                        uint32 NumPoints)
 {
-    OS_time_t                 OsTime;
-    PSP_VxWorks_TimeBaseVal_t VxTime;
-    int64                     TestTime;
-
-    memset(&OsTime, 0, sizeof(OsTime));
+    uint64 Now;
+    uint32 i;
 
-    /* Test with a ratio that is also 1:1, but can be reduced */
-    UT_PSP_TIMEBASE_VXWORKS_TESTCONFIG.PeriodNumerator   = 1000;
-    UT_PSP_TIMEBASE_VXWORKS_TESTCONFIG.PeriodDenominator = 1000;
-    TgtAPI->Init(0);
-    UtAssert_UINT32_EQ(CFE_PSP_GetTimerTicksPerSecond(), 1000000000);
+    for (i = 0; i < NumPoints; ++i)
+    {
+        Before[i] = UT_ReadNsec(Points[i]);
+    }
 
-    /*
-     * Check operation of CFE_PSP_GetTime()
-     *
-     * Externally calculated value should be 10376293541461622 usec.
-     * If overflow occurs then value will be wrong.
-     */
-    UT_SetHookFunction(UT_KEY(PCS_vxTimeBaseGet), UTHOOK_vxTimeBaseGet, &VxTime);
-    VxTime.u = 0x90000000; /* nearing 64-bit limit */
-    VxTime.l = 0;
-    CFE_PSP_GetTime(&OsTime);
+    Now = UT_Tsc = UT_START_TSC + (UT_TSC_PER_NSEC * UT_CALIBRATE_NSEC) + TscStep;
+    UT_RefNsec   = UT_START_NSEC + UT_CALIBRATE_NSEC + NsecStep;
+    UT_ReanchorCallback(OS_OBJECT_ID_UNDEFINED);
+    UT_Tsc = Now;
 
-    TestTime = OS_TimeGetTotalMicroseconds(OsTime);
-    UtAssert_True(TestTime == 10376293541461622, "CFE_PSP_GetTime() Microseconds (%lld) == 10376293541461622",
-                  (long long)TestTime);
+    for (i = 0; i < NumPoints; ++i)
+    {
+        After[i] = UT_ReadNsec(Points[i]);
+        UtAssert_GTEQ(uint64, After[i], Before[i]);
+        if (i > 0)
+        {
+            UtAssert_GTEQ(uint64, After[i], After[i - 1]);
+        }
+    }
 }
 
-void Test_Reducible_2(void)
+void Test_timebase_posix_clock_Init(void)
 {
-    OS_time_t                 OsTime;
-    PSP_VxWorks_TimeBaseVal_t VxTime;
-    int64                     TestTime;
-
-    memset(&OsTime, 0, sizeof(OsTime));
-
-    /* Test with a ratio that can be reduced */
-    /* Final reduced ratio should be 12:5 with 100ns OS ticks */
-    UT_PSP_TIMEBASE_VXWORKS_TESTCONFIG.PeriodNumerator   = 84000;
-    UT_PSP_TIMEBASE_VXWORKS_TESTCONFIG.PeriodDenominator = 350;
-    TgtAPI->Init(0);
-    UtAssert_UINT32_EQ(CFE_PSP_GetTimerTicksPerSecond(), 4166666);
-
-    /*
-     * Check operation of CFE_PSP_GetTime()
-     *
-     * Externally calculated value should be 276701161105643274 usec.
-     * If overflow occurs then value will be wrong.
-     */
-    UT_SetHookFunction(UT_KEY(PCS_vxTimeBaseGet), UTHOOK_vxTimeBaseGet, &VxTime);
-    VxTime.u = 0x10000000; /* nearing 64-bit limit */
-    VxTime.l = 0;
-    CFE_PSP_GetTime(&OsTime);
-
-    TestTime = OS_TimeGetTotalMicroseconds(OsTime);
-    UtAssert_True(TestTime == 276701161105643274, "CFE_PSP_GetTime() Microseconds(%lld) == 276701161105643274",
-                  (long long)TestTime);
+    /* Test for:
+        void timebase_posix_clock_Init(uint32 PspModuleId)
+    */
+    static const unsigned int NoInvariantTsc[4] = {0, 0, 0, 0};
+    static char               ClockSource[]     = "hpet\n";
+
+    /* no CPUID leaf for the invariant TSC */
+    UtAssert_VOIDCALL(timebase_posix_clock_Init(1));
+    UtAssert_STUB_COUNT(PCS_fopen, 0);
+
+    /* no invariant TSC */
+    UT_SetDefaultReturnValue(UT_KEY(PCS_get_cpuid), 1);
+    UT_SetDataBuffer(UT_KEY(PCS_get_cpuid), (void *)NoInvariantTsc, sizeof(NoInvariantTsc), false);
+    UtAssert_VOIDCALL(timebase_posix_clock_Init(1));
+    UtAssert_STUB_COUNT(PCS_fopen, 0);
+
+    /* the kernel clocksource cannot be read */
+    UT_ResetState(0);
+    UT_SetupTsc();
+    UT_SetDefaultReturnValue(UT_KEY(PCS_fopen), 0);
+    UtAssert_VOIDCALL(timebase_posix_clock_Init(1));
+    UtAssert_STUB_COUNT(PCS_fgets, 0);
+    UtAssert_STUB_COUNT(PCS_nanosleep, 0);
+
+    UT_ResetState(0);
+    UT_SetupTsc();
+    UT_ResetState(UT_KEY(PCS_fgets));
+    UtAssert_VOIDCALL(timebase_posix_clock_Init(1));
+    UtAssert_STUB_COUNT(PCS_fclose, 1);
+    UtAssert_STUB_COUNT(PCS_nanosleep, 0);
+
+    /* the kernel does not use the TSC */
+    UT_ResetState(0);
+    UT_SetupTsc();
+    UT_ResetState(UT_KEY(PCS_fgets));
+    UT_SetDeferredRetcode(UT_KEY(PCS_fgets), 1, 5);
+    UT_SetDataBuffer(UT_KEY(PCS_fgets), ClockSource, 5, false);
+    UtAssert_VOIDCALL(timebase_posix_clock_Init(1));
+    UtAssert_STUB_COUNT(PCS_nanosleep, 0);
+
+    /* the TSC does not advance */
+    UT_ResetState(0);
+    UT_SetupTsc();
+    UT_ResetState(UT_KEY(PCS_nanosleep));
+    UtAssert_VOIDCALL(timebase_posix_clock_Init(1));
+    UtAssert_STUB_COUNT(OS_TimerCreate, 0);
+
+    /* the re-anchor timer cannot be started */
+    UT_ResetState(0);
+    UT_SetupTsc();
+    UT_SetDefaultReturnValue(UT_KEY(OS_TimerCreate), OS_ERROR);
+    UtAssert_VOIDCALL(timebase_posix_clock_Init(1));
+    UtAssert_STUB_COUNT(OS_TimerSet, 0);
+
+    UT_ResetState(0);
+    UT_SetupTsc();
+    UT_SetDefaultReturnValue(UT_KEY(OS_TimerSet), OS_ERROR);
+    UtAssert_VOIDCALL(timebase_posix_clock_Init(1));
+    UtAssert_STUB_COUNT(OS_TimerDelete, 1);
+
+    /* nominal, once per re-anchor interval */
+    UT_ResetState(0);
+    UT_SetupTsc();
+    UtAssert_VOIDCALL(timebase_posix_clock_Init(1));
+    UtAssert_STUB_COUNT(OS_TimerSet, 1);
+    UtAssert_True(UT_ReanchorCallback != NULL, "Re-anchor callback registered");
 }
 
-void Test_Rollover(void)
+void Test_CFE_PSP_GetTime_Clock(void)
 {
-    /* This function always returns 0 */
-    UtAssert_UINT32_EQ(CFE_PSP_GetTimerLow32Rollover(), 0);
+    /* Test for:
+        void CFE_PSP_GetTime(OS_time_t *LocalTime)
+        void CFE_PSP_Get_Timebase(uint32 *Tbu, uint32 *Tbl)
+       reading the reference clock
+    */
+    OS_time_t OsTime;
+    uint32    Tbu;
+    uint32    Tbl;
+
+    UT_SetHandlerFunction(UT_KEY(PCS_clock_gettime), UT_Handler_clock_gettime, NULL);
+    timebase_posix_clock_Init(1);
+
+    UT_RefNsec = 12000000300;
+    CFE_PSP_GetTime(&OsTime);
+    UtAssert_INT32_EQ(OS_TimeGetTotalSeconds(OsTime), 12);
+    UtAssert_UINT32_EQ(OS_TimeGetNanosecondsPart(OsTime), 300);
+    CFE_PSP_Get_Timebase(&Tbu, &Tbl);
+    UtAssert_UINT32_EQ(Tbu, 12);
+    UtAssert_UINT32_EQ(Tbl, 300);
+
+    /* the clock cannot be read */
+    UT_SetDefaultReturnValue(UT_KEY(PCS_clock_gettime), -1);
+    CFE_PSP_GetTime(&OsTime);
+    UtAssert_EQ(int64, OS_TimeGetTotalNanoseconds(OsTime), 0);
+    CFE_PSP_Get_Timebase(&Tbu, &Tbl);
+    UtAssert_UINT32_EQ(Tbu, 0);
+    UtAssert_UINT32_EQ(Tbl, 0);
 }
 
-/******************************************************************************
-**
-**  Purpose:
-**    Provides a common interface to system timebase. This routine
-**    is in the BSP because it is sometimes implemented in hardware and
-**    sometimes taken care of by the RTOS.
-**
-**  Arguments:
-**
-**  Return:
-**  Timebase register value
-*/
-void Test_Get_Timebase(void)
+void Test_CFE_PSP_GetTime_Tsc(void)
 {
-    PSP_VxWorks_TimeBaseVal_t VxTime;
-    uint32                    tbu;
-    uint32                    tbl;
+    /* Test for:
+        void CFE_PSP_GetTime(OS_time_t *LocalTime)
+        void CFE_PSP_Get_Timebase(uint32 *Tbu, uint32 *Tbl)
+       reading the calibrated TSC
+    */
+    OS_time_t OsTime;
+    uint64    Tsc1;
+    uint64    Nsec1;
+
+    UT_SetupTsc();
+    timebase_posix_clock_Init(1);
+    UtAssert_STUB_COUNT(PCS_nanosleep, 1);
+
+    /* the line starts at the end of the calibration */
+    Tsc1  = UT_START_TSC + (UT_TSC_PER_NSEC * UT_CALIBRATE_NSEC);
+    Nsec1 = UT_START_NSEC + UT_CALIBRATE_NSEC;
+    UtAssert_EQ(uint64, UT_Tsc, Tsc1);
+    UtAssert_EQ(uint64, UT_ReadNsec(Tsc1), Nsec1);
+    UtAssert_EQ(uint64, UT_ReadNsec(Tsc1 + 2000), Nsec1 + 1000);
+
+    UT_Tsc = Tsc1 + 3000000200;
+    CFE_PSP_GetTime(&OsTime);
+    UtAssert_EQ(int64, OS_TimeGetTotalNanoseconds(OsTime), Nsec1 + 1500000100);
 
-    /* The value from vxTimeBaseGet() should be passed through unchanged */
-    UT_SetHookFunction(UT_KEY(PCS_vxTimeBaseGet), UTHOOK_vxTimeBaseGet, &VxTime);
-    VxTime.u = 0x00112233;
-    VxTime.l = 0x44556677;
+    /* the reference clock is not read by the readers */
+    UtAssert_STUB_COUNT(PCS_clock_gettime, 32);
 
-    CFE_PSP_Get_Timebase(&tbu, &tbl);
+    /* marginally before the line starts */
+    UtAssert_EQ(uint64, UT_ReadNsec(Tsc1 - 1), Nsec1);
 
-    UtAssert_UINT32_EQ(tbu, VxTime.u);
-    UtAssert_UINT32_EQ(tbl, VxTime.l);
+    /* the time stands still past the end of the segment until the next re-anchor */
+    UtAssert_EQ(uint64, UT_ReadNsec(Tsc1 + UT_SEGMENT_TSC), Nsec1 + (UT_SEGMENT_TSC / UT_TSC_PER_NSEC));
+    UtAssert_EQ(uint64, UT_ReadNsec(Tsc1 + UT_SEGMENT_TSC + 1000), Nsec1 + (UT_SEGMENT_TSC / UT_TSC_PER_NSEC));
 }
 
-/*
- * Macro to add a test case to the list of tests to execute
- */
-#define ADD_TEST(test) UtTest_Add(test, ModuleTest_ResetState, NULL, #test)
+void Test_CFE_PSP_ReanchorTsc_Ahead(void)
+{
+    /* Test for:
+        void CFE_PSP_TimebaseReanchorTsc(osal_id_t TimerId)
+       with the TSC line ahead of the reference clock
+    */
+    uint64 Knee;
+    uint64 Points[8];
+    uint64 Before[8];
+    uint64 After[8];
+    uint64 RefEnd;
+    uint32 i;
+
+    UT_SetupTsc();
+    timebase_posix_clock_Init(1);
+
+    /* one interval later, the reference clock only advanced 999 ms */
+    Knee = UT_START_TSC + (UT_TSC_PER_NSEC * UT_CALIBRATE_NSEC) + UT_SEGMENT_TSC;
+    for (i = 0; i < 8; ++i)
+    {
+        Points[i] = Knee - UT_SEGMENT_TSC + (i * UT_REANCHOR_TSC / 2);
+    }
+    Points[4] = Knee - 1;
+    Points[5] = Knee;
+    Points[6] = Knee + 1;
+    Points[7] = Knee + UT_SEGMENT_TSC;
+    UT_Reanchor(UT_REANCHOR_TSC, 999000000, Before, After, Points, 8);
+
+    /* unchanged up to the knee, however readers race with the publish */
+    for (i = 0; i < 6; ++i)
+    {
+        UtAssert_EQ(uint64, After[i], Before[i]);
+    }
 
-/*
- * Register the test cases to execute with the unit test tool
- */
-void UtTest_Setup(void)
+    /* slower after it, to meet the reference clock by the end of the segment */
+    RefEnd = UT_START_NSEC + UT_CALIBRATE_NSEC + 999000000 + (999000000ULL * 2);
+    UtAssert_GTEQ(uint64, After[7], RefEnd - 2);
+    UtAssert_LTEQ(uint64, After[7], RefEnd + 2);
+}
+
+void Test_CFE_PSP_ReanchorTsc_Behind(void)
 {
-    ADD_TEST(Test_Nominal);
-    ADD_TEST(Test_Non_Reducible);
-    ADD_TEST(Test_Reducible_1);
-    ADD_TEST(Test_Reducible_2);
-    ADD_TEST(Test_Rollover);
-    ADD_TEST(Test_Get_Timebase);
+    /* Test for:
+        void CFE_PSP_TimebaseReanchorTsc(osal_id_t TimerId)
+       with the TSC line behind the reference clock
+    */
+    uint64 Knee;
+    uint64 Points[4];
+    uint64 Before[4];
+    uint64 After[4];
+    uint64 RefKnee;
+
+    UT_SetupTsc();
+    timebase_posix_clock_Init(1);
+
+    /* one interval later, the reference clock advanced 1001 ms */
+    Knee      = UT_START_TSC + (UT_TSC_PER_NSEC * UT_CALIBRATE_NSEC) + UT_SEGMENT_TSC;
+    Points[0] = Knee - UT_REANCHOR_TSC;
+    Points[1] = Knee - 1;
+    Points[2] = Knee;
+    Points[3] = Knee + UT_REANCHOR_TSC;
+    UT_Reanchor(UT_REANCHOR_TSC, 1001000000, Before, After, Points, 4);
+
+    /* unchanged before the knee, then a step forward to the reference clock */
+    RefKnee = UT_START_NSEC + UT_CALIBRATE_NSEC + 1001000000 + 1001000000;
+    UtAssert_EQ(uint64, After[0], Before[0]);
+    UtAssert_EQ(uint64, After[1], Before[1]);
+    UtAssert_GTEQ(uint64, After[2], RefKnee - 2);
+    UtAssert_LTEQ(uint64, After[2], RefKnee + 2);
 }
-/************************************************************************
- * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
- *
- * Copyright (c) 2020 United States Government as represented by the
- * Administrator of the National Aeronautics and Space Administration.
- * All Rights Reserved.
- *
- * Licensed under the Apache License, Version 2.0 (the "License"); you may
- * not use this file except in compliance with the License. You may obtain
- * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
- *
- * Unless required by applicable law or agreed to in writing, software
- * distributed under the License is distributed on an "AS IS" BASIS,
- * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
- * See the License for the specific language governing permissions and
- * limitations under the License.
- ************************************************************************/
 
-/**
- * \file
- *
- * A PSP module to satisfy the PSP time API on systems which
- * do not have a hardware clock register, but do provide a POSIX
- * compliant implementation of clock_gettime() and CLOCK_MONOTONIC
- * that can fulfill this role.
- *
- * The POSIX CLOCK_MONOTONIC is defined as a monotonically increasing
- * clock that has no specific epoch.  It is not affected by local time
- * changes and is not settable.
- *
- * The POSIX interface uses a "struct timespec" which has units in
- * nanoseconds, but this is converted down to units of microseconds for
- * consistency with previous versions of PSP where CFE_PSP_Get_Timebase()
- * returned units of microseconds.
- */
+void Test_CFE_PSP_ReanchorTsc_Late(void)
+{
+    /* Test for:
+        void CFE_PSP_TimebaseReanchorTsc(osal_id_t TimerId)
+       running after the current segment ended
+    */
+    uint64 Points[3];
+    uint64 Before[3];
+    uint64 After[3];
+    uint64 Now;
+
+    UT_SetupTsc();
+    timebase_posix_clock_Init(1);
+
+    /* 2.5 intervals late, the time stood still at the end of the segment and catches up */
+    Now       = UT_START_TSC + (UT_TSC_PER_NSEC * UT_CALIBRATE_NSEC) + (5 * UT_REANCHOR_TSC / 2);
+    Points[0] = Now - (UT_REANCHOR_TSC / 2);
+    Points[1] = Now;
+    Points[2] = Now + UT_REANCHOR_TSC;
+    UT_Reanchor(5 * UT_REANCHOR_TSC / 2, 2500000000, Before, After, Points, 3);
+
+    UtAssert_EQ(uint64, Before[1], Before[0]);
+    UtAssert_EQ(uint64, After[1], UT_START_NSEC + UT_CALIBRATE_NSEC + 2500000000);
+    UtAssert_EQ(uint64, After[2], After[1] + 1000000000);
+}
 
-/*
-**  System Include Files
-*/
-#include <stdio.h>
-#include <stdlib.h>
-#include <time.h>
+void Test_CFE_PSP_ReanchorTsc_Limits(void)
+{
+    /* Test for:
+        void CFE_PSP_TimebaseReanchorTsc(osal_id_t TimerId)
+       slewing by more than half the rate, and without the TSC advancing
+    */
+    uint64 Knee;
+    uint64 Points[3];
+    uint64 Before[3];
+    uint64 After[3];
+
+    UT_SetupTsc();
+    timebase_posix_clock_Init(1);
+
+    /* the reference clock advanced only 10 ms in one interval, the new line runs at half the measured rate */
+    Knee      = UT_START_TSC + (UT_TSC_PER_NSEC * UT_CALIBRATE_NSEC) + UT_SEGMENT_TSC;
+    Points[0] = Knee - 1;
+    Points[1] = Knee;
+    Points[2] = Knee + 1000000000;
+    UT_Reanchor(UT_REANCHOR_TSC, 10000000, Before, After, Points, 3);
+    UtAssert_EQ(uint64, After[1], Before[1]);
+    UtAssert_GTEQ(uint64, After[2] - After[1], 2500000 - 1);
+    UtAssert_LTEQ(uint64, After[2] - After[1], 2500000);
+
+    /* a second re-anchor at the same TSC value starts a segment that is not empty */
+    UT_Reanchor(UT_REANCHOR_TSC, 10000000, Before, After, Points, 3);
+    UtAssert_EQ(uint64, After[2], Before[2]);
+}
 
-#include "cfe_psp.h"
-#include "cfe_psp_module.h"
+void Test_CFE_PSP_GetTaskCpuTime(void)
+{
+    /* Test for:
+        int32 CFE_PSP_GetTaskCpuTime(osal_id_t TaskId, OS_time_t *CpuTime)
+    */
+    OS_time_t CpuTime;
 
-/*
- * The specific clock ID to use with clock_gettime
- *
- * Linux provides some special (non-posix) clock IDs that also
- * could be relevant/useful:
- *
- * CLOCK_MONOTONIC_COARSE - emphasis on read speed at the (possible?) expense of precision
- * CLOCK_MONOTONIC_RAW - possibly hardware based, not affected by NTP or other sync software
- * CLOCK_BOOTTIME - includes time the system is suspended.
- *
- * Defaulting to the POSIX-specified "MONOTONIC" but it should be possible to use
- * one of the Linux-specific variants if the target system provides it.
- */
-#define CFE_PSP_TIMEBASE_REF_CLOCK CLOCK_MONOTONIC
+    UtAssert_INT32_EQ(CFE_PSP_GetTaskCpuTime(OS_OBJECT_ID_UNDEFINED, &CpuTime), CFE_PSP_SUCCESS);
 
-CFE_PSP_MODULE_DECLARE_SIMPLE(timebase_posix_clock);
+    UT_SetDeferredRetcode(UT_KEY(OS_TaskGetCpuTime), 1, OS_ERR_NOT_IMPLEMENTED);
+    UtAssert_INT32_EQ(CFE_PSP_GetTaskCpuTime(OS_OBJECT_ID_UNDEFINED, &CpuTime), CFE_PSP_ERROR_NOT_IMPLEMENTED);
 
-void timebase_posix_clock_Init(uint32 PspModuleId)
-{
-    /* Inform the user that this module is in use */
-    printf("CFE_PSP: Using POSIX monotonic clock as CFE timebase\n");
+    UT_SetDeferredRetcode(UT_KEY(OS_TaskGetCpuTime), 1, OS_ERR_INVALID_ID);
+    UtAssert_INT32_EQ(CFE_PSP_GetTaskCpuTime(OS_OBJECT_ID_UNDEFINED, &CpuTime), CFE_PSP_ERROR);
 }
 
-/*
- * ----------------------------------------------------------------------
- * The CFE_PSP_Get_Timebase() is a wrapper around clock_gettime()
- *
- * Reads the value of the monotonic POSIX clock, and output the value with
- * the whole seconds in the upper 32 and nanoseconds in the lower 32.
- *
- * This variant does minimal conversions - just enough to meet the API.
- * For a normalized output use CFE_PSP_GetTime()
- * ----------------------------------------------------------------------
- */
-void CFE_PSP_Get_Timebase(uint32 *Tbu, uint32 *Tbl)
+void Test_CFE_PSP_GetTimerTicks(void)
 {
-    struct timespec now;
-
-    if (clock_gettime(CFE_PSP_TIMEBASE_REF_CLOCK, &now) != 0)
-    {
-        /* unlikely - but avoids undefined behavior */
-        now.tv_sec  = 0;
-        now.tv_nsec = 0;
-    }
-
-    *Tbu = now.tv_sec & 0xFFFFFFFF;
-    *Tbl = now.tv_nsec;
+    /* Test for:
+        uint32 CFE_PSP_GetTimerTicksPerSecond(void)
+        uint32 CFE_PSP_GetTimerLow32Rollover(void)
+    */
+    UtAssert_UINT32_EQ(CFE_PSP_GetTimerTicksPerSecond(), 1000000000);
+    UtAssert_UINT32_EQ(CFE_PSP_GetTimerLow32Rollover(), 1000000000);
 }
 
 /*
- * ----------------------------------------------------------------------
- * The CFE_PSP_GetTime() is also a wrapper around the same clock_gettime()
- *
- * Reads the value of the monotonic POSIX clock, and output the value
- * normalized to an OS_time_t format.
- * ----------------------------------------------------------------------
+ * Macro to add a test case to the list of tests to execute
  */
-void CFE_PSP_GetTime(OS_time_t *LocalTime)
-{
-    struct timespec now;
-
-    if (clock_gettime(CFE_PSP_TIMEBASE_REF_CLOCK, &now) != 0)
-    {
-        /* unlikely - but avoids undefined behavior */
-        now.tv_sec  = 0;
-        now.tv_nsec = 0;
-    }
+#define ADD_TEST(test) UtTest_Add(test, ResetTest, NULL, #test)
 
-    *LocalTime = OS_TimeAssembleFromNanoseconds(now.tv_sec, now.tv_nsec);
-}
-
-/*----------------------------------------------------------------
- *
- * Implemented per public API
- * See description in header file for argument/return detail
- *
- *-----------------------------------------------------------------*/
-uint32 CFE_PSP_GetTimerTicksPerSecond(void)
+void ResetTest(void)
 {
-    /* POSIX "struct timespec" resolution is defined as nanoseconds */
-    return 1000000000;
+    UT_ResetState(0);
+    UT_ReanchorCallback = NULL;
 }
 
-/*----------------------------------------------------------------
- *
- * Implemented per public API
- * See description in header file for argument/return detail
- *
- *-----------------------------------------------------------------*/
-uint32 CFE_PSP_GetTimerLow32Rollover(void)
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
 {
-    /* POSIX "struct timespec" resolution is defined as nanoseconds */
-    return 1000000000;
+    ADD_TEST(Test_timebase_posix_clock_Init);
+    ADD_TEST(Test_CFE_PSP_GetTime_Clock);
+    ADD_TEST(Test_CFE_PSP_GetTime_Tsc);
+    ADD_TEST(Test_CFE_PSP_ReanchorTsc_Ahead);
+    ADD_TEST(Test_CFE_PSP_ReanchorTsc_Behind);
+    ADD_TEST(Test_CFE_PSP_ReanchorTsc_Late);
+    ADD_TEST(Test_CFE_PSP_ReanchorTsc_Limits);
+    ADD_TEST(Test_CFE_PSP_GetTaskCpuTime);
+    ADD_TEST(Test_CFE_PSP_GetTimerTicks);
 }
@@ -254,6 +254,14 @@ void Test_PSP_GetTimeNullLocalTime(void)
     UtAssert_VOIDCALL(CFE_PSP_GetTime(NULL));
 }
 
+void Test_PSP_GetTaskCpuTime(void)
+{
+    OS_time_t CpuTime;
+
+    /* Per-task execution time is not kept on VxWorks */
+    UtAssert_INT32_EQ(CFE_PSP_GetTaskCpuTime(OS_OBJECT_ID_UNDEFINED, &CpuTime), CFE_PSP_ERROR_NOT_IMPLEMENTED);
+}
+
 /*
  * Macro to add a test case to the list of tests to execute
  */
@@ -273,4 +281,5 @@ void UtTest_Setup(void)
     ADD_TEST(Test_PSP_Get_Timebase_NullUpperRegister);
     ADD_TEST(Test_PSP_Get_Timebase_NullLowerRegister);
     ADD_TEST(Test_PSP_GetTimeNullLocalTime);
+    ADD_TEST(Test_PSP_GetTaskCpuTime);
 }
@@ -21,6 +21,7 @@
 #define PCS_TIME_H
 
 #include "PCS_basetypes.h"
+#include "PCS_sys_types.h"
 
 /* ----------------------------------------- */
 /* constants normally defined in time.h */
@@ -31,7 +32,6 @@
 /* ----------------------------------------- */
 /* types normally defined in time.h */
 /* ----------------------------------------- */
-typedef long PCS_time_t;
 typedef long PCS_suseconds_t;
 
 struct PCS_timespec
@@ -45,5 +45,6 @@ struct PCS_timespec
 /* ----------------------------------------- */
 int PCS_clock_settime(int clk_id, struct PCS_timespec *t);
 int PCS_clock_gettime(int clk_id, struct PCS_timespec *t);
+int PCS_nanosleep(const struct PCS_timespec *req, struct PCS_timespec *rem);
 
 #endif
@@ -22,4 +22,16 @@
 
 #include "PCS_time.h"
 
+/* ----------------------------------------- */
+/* mappings for declarations in time.h */
+/* ----------------------------------------- */
+#define CLOCK_REALTIME  PCS_CLOCK_REALTIME
+#define CLOCK_MONOTONIC PCS_CLOCK_MONOTONIC
+
+#define timespec PCS_timespec
+
+#define clock_gettime PCS_clock_gettime
+#define clock_settime PCS_clock_settime
+#define nanosleep     PCS_nanosleep
+
 #endif
@@ -0,0 +1,42 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/* PSP coverage stub replacement for cpuid.h */
+#include <string.h>
+#include "utstubs.h"
+
+#include "PCS_cpuid.h"
+
+void UT_DefaultHandler_PCS_get_cpuid(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    /* int PCS_get_cpuid(unsigned int leaf, unsigned int *eax, *ebx, *ecx, *edx) */
+    unsigned int *eax = UT_Hook_GetArgValueByName(Context, "eax", unsigned int *);
+    unsigned int *ebx = UT_Hook_GetArgValueByName(Context, "ebx", unsigned int *);
+    unsigned int *ecx = UT_Hook_GetArgValueByName(Context, "ecx", unsigned int *);
+    unsigned int *edx = UT_Hook_GetArgValueByName(Context, "edx", unsigned int *);
+    unsigned int  Regs[4];
+
+    /* The registers come from the data buffer, in the order EAX, EBX, ECX, EDX */
+    memset(Regs, 0, sizeof(Regs));
+    UT_Stub_CopyToLocal(UT_KEY(PCS_get_cpuid), Regs, sizeof(Regs));
+
+    *eax = Regs[0];
+    *ebx = Regs[1];
+    *ecx = Regs[2];
+    *edx = Regs[3];
+}
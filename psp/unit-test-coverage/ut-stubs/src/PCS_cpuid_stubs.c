@@ -0,0 +1,48 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in PCS_cpuid header
+ */
+
+#include "PCS_cpuid.h"
+#include "utgenstub.h"
+
+void UT_DefaultHandler_PCS_get_cpuid(void *, UT_EntryKey_t, const UT_StubContext_t *);
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for PCS_get_cpuid()
+ * ----------------------------------------------------
+ */
+int PCS_get_cpuid(unsigned int leaf, unsigned int *eax, unsigned int *ebx, unsigned int *ecx, unsigned int *edx)
+{
+    UT_GenStub_SetupReturnBuffer(PCS_get_cpuid, int);
+
+    UT_GenStub_AddParam(PCS_get_cpuid, unsigned int, leaf);
+    UT_GenStub_AddParam(PCS_get_cpuid, unsigned int *, eax);
+    UT_GenStub_AddParam(PCS_get_cpuid, unsigned int *, ebx);
+    UT_GenStub_AddParam(PCS_get_cpuid, unsigned int *, ecx);
+    UT_GenStub_AddParam(PCS_get_cpuid, unsigned int *, edx);
+
+    UT_GenStub_Execute(PCS_get_cpuid, Basic, UT_DefaultHandler_PCS_get_cpuid);
+
+    return UT_GenStub_GetReturnValue(PCS_get_cpuid, int);
+}
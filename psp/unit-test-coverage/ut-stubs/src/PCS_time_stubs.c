@@ -60,3 +60,20 @@ int PCS_clock_settime(int clk_id, struct PCS_timespec *t)
 
     return UT_GenStub_GetReturnValue(PCS_clock_settime, int);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for PCS_nanosleep()
+ * ----------------------------------------------------
+ */
+int PCS_nanosleep(const struct PCS_timespec *req, struct PCS_timespec *rem)
+{
+    UT_GenStub_SetupReturnBuffer(PCS_nanosleep, int);
+
+    UT_GenStub_AddParam(PCS_nanosleep, const struct PCS_timespec *, req);
+    UT_GenStub_AddParam(PCS_nanosleep, struct PCS_timespec *, rem);
+
+    UT_GenStub_Execute(PCS_nanosleep, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(PCS_nanosleep, int);
+}
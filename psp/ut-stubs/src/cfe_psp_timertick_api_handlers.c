@@ -39,6 +39,23 @@
 ** Functions
 */
 
+void UT_DefaultHandler_CFE_PSP_GetTaskCpuTime(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    /* int32 CFE_PSP_GetTaskCpuTime(osal_id_t TaskId, OS_time_t *CpuTime) */
+    OS_time_t *CpuTime = UT_Hook_GetArgValueByName(Context, "CpuTime", OS_time_t *);
+    int32      status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    if (status >= 0)
+    {
+        if (UT_Stub_CopyToLocal(UT_KEY(CFE_PSP_GetTaskCpuTime), (uint8 *)CpuTime, sizeof(*CpuTime)) < sizeof(*CpuTime))
+        {
+            *CpuTime = OS_TimeAssembleFromNanoseconds(0, 0);
+        }
+    }
+}
+
 void UT_DefaultHandler_CFE_PSP_GetTime(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
 {
     /* void CFE_PSP_GetTime(OS_time_t *LocalTime) */
@@ -25,10 +25,28 @@
 #include "cfe_psp_timertick_api.h"
 #include "utgenstub.h"
 
+void UT_DefaultHandler_CFE_PSP_GetTaskCpuTime(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CFE_PSP_GetTime(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CFE_PSP_GetTimerLow32Rollover(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CFE_PSP_GetTimerTicksPerSecond(void *, UT_EntryKey_t, const UT_StubContext_t *);
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_PSP_GetTaskCpuTime()
+ * ----------------------------------------------------
+ */
+int32 CFE_PSP_GetTaskCpuTime(osal_id_t TaskId, OS_time_t *CpuTime)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_PSP_GetTaskCpuTime, int32);
+
+    UT_GenStub_AddParam(CFE_PSP_GetTaskCpuTime, osal_id_t, TaskId);
+    UT_GenStub_AddParam(CFE_PSP_GetTaskCpuTime, OS_time_t *, CpuTime);
+
+    UT_GenStub_Execute(CFE_PSP_GetTaskCpuTime, Basic, UT_DefaultHandler_CFE_PSP_GetTaskCpuTime);
+
+    return UT_GenStub_GetReturnValue(CFE_PSP_GetTaskCpuTime, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_PSP_GetTime()
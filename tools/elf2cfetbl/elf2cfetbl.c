@@ -80,6 +80,7 @@ int32 OutputDataToTargetFile(void);
 void  OutputVersionInfo(void);
 void  OutputHelpInfo(void);
 int32 LocateAndReadUserObject(void);
+size_t CompressTableData(const uint8 *Src, size_t SrcSize, uint8 *Dst);
 
 void PrintSymbol32(union Elf_Sym *Symbol);
 void PrintSymbol64(union Elf_Sym *Symbol);
@@ -114,6 +115,7 @@ bool EnableTimeTagInHeader       = false;
 bool TargetWordsizeIs32Bit       = true;
 
 bool TableDataIsAllZeros = false;
+bool CompressOutput      = false;
 
 FILE *SrcFileDesc = NULL;
 FILE *DstFileDesc = NULL;
@@ -1022,6 +1024,10 @@ int32 ProcessCmdLineOptions(int ArgumentCount, char *Arguments[])
         {
             EnableTimeTagInHeader = true;
         }
+        else if ((Arguments[i][0] == '-') && (Arguments[i][1] == 'z'))
+        {
+            CompressOutput = true;
+        }
         else if ((Arguments[i][0] == '-') && (Arguments[i][1] == 'e'))
         {
             ScEpoch.Year = strtoul(&Arguments[i][2], &EndPtr, 0);
@@ -1283,7 +1289,7 @@ void OutputHelpInfo(void)
 {
     printf("\nElf Object File to cFE Table Image File Conversion Tool (elf2cfetbl)\n\n");
     printf("elf2cfetbl [-tTblName] [-d\"Description\"] [-h] [-v] [-V] [-s#] [-p#] [-n] \n");
-    printf("           [-T] [-eYYYY:MM:DD:hh:mm:ss] [-fYYYY:MM:DD:hh:mm:ss] SrcFilename [DestDirectory]\n");
+    printf("           [-T] [-z] [-eYYYY:MM:DD:hh:mm:ss] [-fYYYY:MM:DD:hh:mm:ss] SrcFilename [DestDirectory]\n");
     printf("   where:\n");
     printf("   -tTblName             replaces the table name specified in the object file with 'TblName'\n");
     printf("   -d\"Description\"       replaces the description specified in the object file with 'Description'\n");
@@ -1314,6 +1320,10 @@ void OutputHelpInfo(void)
     printf("                         This option must be specified for either the '-e' and/or '-f' options below to "
            "have any effect.\n");
     printf("                         By default, the time tag fields are set to zero.\n");
+    printf("   -z                    compresses the table data (LZ4 block format) and marks the table header "
+           "accordingly.\n");
+    printf("                         Compressed images take less space.  Decoding costs CPU time on the target, so they\n");
+    printf("                         only load faster where reading the file is slower than decoding it.\n");
     printf("   -eYYYY:MM:DD:hh:mm:ss specifies the spacecraft epoch time.  The SrcFilename's file creation time will "
            "be converted to\n");
     printf("                         seconds since the specified epoch time and stored in the standard cFE File "
@@ -2507,9 +2517,13 @@ int32 LocateAndReadUserObject(void)
 
 int32 OutputDataToTargetFile()
 {
-    int32 Status = SUCCESS;
-    uint8 AByte  = 0;
-    int32 i      = 0;
+    int32  Status         = SUCCESS;
+    uint8  AByte          = 0;
+    int32  i              = 0;
+    size_t DataSize       = 0;
+    size_t CompressedSize = 0;
+    uint8 *RawData        = NULL;
+    uint8 *CompressedData = NULL;
 
     /* Create the standard header */
     FileHeader.ContentType = 0x63464531;
@@ -2590,6 +2604,15 @@ int32 OutputDataToTargetFile()
         Status = FAILED;
     }
 
+    if (CompressOutput)
+    {
+        TableHeader.Encoding = CFE_TBL_FileEncoding_LZ4;
+    }
+    else
+    {
+        TableHeader.Encoding = CFE_TBL_FileEncoding_RAW;
+    }
+
     if (TableNameOverride == true)
     {
         strcpy(TableHeader.TableName, TableName);
@@ -2602,7 +2625,7 @@ int32 OutputDataToTargetFile()
     /* If this machine is little endian, the TBL header must be swapped */
     if (ThisMachineIsLittleEndian == true)
     {
-        SwapUInt32(&TableHeader.Reserved);
+        SwapUInt32(&TableHeader.Encoding);
         SwapUInt32(&TableHeader.Offset);
         SwapUInt32(&TableHeader.NumBytes);
     }
@@ -2618,13 +2641,44 @@ int32 OutputDataToTargetFile()
     fwrite(&FileHeader.TimeSubSeconds, sizeof(uint32), 1, DstFileDesc);
     fwrite(&FileHeader.Description[0], sizeof(FileHeader.Description), 1, DstFileDesc);
 
-    fwrite(&TableHeader.Reserved, sizeof(uint32), 1, DstFileDesc);
+    fwrite(&TableHeader.Encoding, sizeof(uint32), 1, DstFileDesc);
     fwrite(&TableHeader.Offset, sizeof(uint32), 1, DstFileDesc);
     fwrite(&TableHeader.NumBytes, sizeof(uint32), 1, DstFileDesc);
     fwrite(&TableHeader.TableName[0], sizeof(TableHeader.TableName), 1, DstFileDesc);
 
     /* Output the data from the object file */
-    if (TableDataIsAllZeros)
+    if (CompressOutput)
+    {
+        DataSize = get_st_size(SymbolPtrs[UserObjSymbolIndex]);
+
+        /* LZ4 worst case expansion for incompressible data */
+        RawData        = calloc(1, DataSize + 1);
+        CompressedData = malloc(DataSize + (DataSize / 255) + 16);
+        if ((RawData == NULL) || (CompressedData == NULL))
+        {
+            printf("ERROR: Unable to allocate %lu bytes for table compression\n", (unsigned long)DataSize);
+            Status = FAILED;
+        }
+        else
+        {
+            if (!TableDataIsAllZeros && (fread(RawData, 1, DataSize, SrcFileDesc) != DataSize))
+            {
+                printf("ERROR: Unable to read %lu bytes of table data\n", (unsigned long)DataSize);
+                Status = FAILED;
+            }
+
+            CompressedSize = CompressTableData(RawData, DataSize, CompressedData);
+            fwrite(CompressedData, 1, CompressedSize, DstFileDesc);
+
+            if (Verbose)
+                printf("Table data compressed from %lu to %lu bytes\n", (unsigned long)DataSize,
+                       (unsigned long)CompressedSize);
+        }
+
+        free(RawData);
+        free(CompressedData);
+    }
+    else if (TableDataIsAllZeros)
     {
         AByte = 0;
         for (i = 0; i < get_st_size(SymbolPtrs[UserObjSymbolIndex]); i++)
@@ -2643,3 +2697,108 @@ int32 OutputDataToTargetFile()
 
     return Status;
 }
+
+/**
+ *    Table Data Compression (LZ4 block format)
+ */
+#define LZ4_HASH_BITS     12
+#define LZ4_MIN_MATCH     4
+#define LZ4_LAST_LITERALS 5  /* The block must end with at least this many literals */
+#define LZ4_MFLIMIT       12 /* No match may start within this many bytes of the end */
+#define LZ4_MAX_OFFSET    65535
+#define LZ4_RUN_MASK      15
+
+static uint32 Lz4Read32(const uint8 *Ptr)
+{
+    return Ptr[0] | (Ptr[1] << 8) | (Ptr[2] << 16) | ((uint32)Ptr[3] << 24);
+}
+
+static uint8 *Lz4WriteLength(uint8 *Out, size_t Length)
+{
+    while (Length >= 255)
+    {
+        *Out++ = 255;
+        Length -= 255;
+    }
+    *Out++ = (uint8)Length;
+
+    return Out;
+}
+
+static uint8 *Lz4WriteSequence(uint8 *Out, const uint8 *Literals, size_t LiteralLength, size_t Offset,
+                               size_t MatchLength)
+{
+    uint8 *Token = Out++;
+
+    *Token = (LiteralLength >= LZ4_RUN_MASK ? LZ4_RUN_MASK : LiteralLength) << 4;
+    if (LiteralLength >= LZ4_RUN_MASK)
+    {
+        Out = Lz4WriteLength(Out, LiteralLength - LZ4_RUN_MASK);
+    }
+    memcpy(Out, Literals, LiteralLength);
+    Out += LiteralLength;
+
+    /* The final sequence of a block carries literals only */
+    if (MatchLength > 0)
+    {
+        *Out++ = Offset & 0xFF;
+        *Out++ = (Offset >> 8) & 0xFF;
+
+        MatchLength -= LZ4_MIN_MATCH;
+        *Token |= (MatchLength >= LZ4_RUN_MASK ? LZ4_RUN_MASK : MatchLength);
+        if (MatchLength >= LZ4_RUN_MASK)
+        {
+            Out = Lz4WriteLength(Out, MatchLength - LZ4_RUN_MASK);
+        }
+    }
+
+    return Out;
+}
+
+/**
+ *    Compresses SrcSize bytes into Dst, which must hold SrcSize + SrcSize/255 + 16 bytes.
+ *    A simple greedy single-probe match finder is used; the output can be decoded by
+ *    any LZ4 block decoder.  Returns the compressed size.
+ */
+size_t CompressTableData(const uint8 *Src, size_t SrcSize, uint8 *Dst)
+{
+    static size_t HashTable[1 << LZ4_HASH_BITS];
+    uint8 *       Out    = Dst;
+    size_t        Pos    = 0;
+    size_t        Anchor = 0;
+    size_t        Candidate;
+    size_t        Length;
+    uint32        Hash;
+
+    /* Table entries hold position + 1, so zero means empty */
+    memset(HashTable, 0, sizeof(HashTable));
+
+    while (Pos + LZ4_MFLIMIT <= SrcSize)
+    {
+        Hash            = (Lz4Read32(&Src[Pos]) * 2654435761U) >> (32 - LZ4_HASH_BITS);
+        Candidate       = HashTable[Hash];
+        HashTable[Hash] = Pos + 1;
+
+        if ((Candidate == 0) || ((Pos - (Candidate - 1)) > LZ4_MAX_OFFSET) ||
+            (Lz4Read32(&Src[Candidate - 1]) != Lz4Read32(&Src[Pos])))
+        {
+            ++Pos;
+            continue;
+        }
+        --Candidate;
+
+        Length = LZ4_MIN_MATCH;
+        while (((Pos + Length) < (SrcSize - LZ4_LAST_LITERALS)) && (Src[Candidate + Length] == Src[Pos + Length]))
+        {
+            ++Length;
+        }
+
+        Out    = Lz4WriteSequence(Out, &Src[Anchor], Pos - Anchor, Pos - Candidate, Length);
+        Pos    = Pos + Length;
+        Anchor = Pos;
+    }
+
+    Out = Lz4WriteSequence(Out, &Src[Anchor], SrcSize - Anchor, 0, 0);
+
+    return Out - Dst;
+}
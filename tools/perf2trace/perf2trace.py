@@ -0,0 +1,143 @@
+#!/usr/bin/env python3
+#
+# NASA Docket No. GSC-18,719-1, and identified as "core Flight System: Bootes"
+#
+# Copyright (c) 2020 United States Government as represented by the
+# Administrator of the National Aeronautics and Space Administration.
+# All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License"); you may
+# not use this file except in compliance with the License. You may obtain
+# a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+"""
+Convert cFE ES performance log files to Chrome trace event JSON.
+
+Accepts both the output of the "write perf data" command and the
+files of a performance stream (trigger mode STREAM).  When several
+files are given, for example all the files of a rotating stream set,
+the entries are merged and sorted by time.  The output loads in
+chrome://tracing and in the Perfetto UI.
+"""
+
+import argparse
+import json
+import re
+import struct
+import sys
+
+FS_HEADER_FORMAT = ">8I32s"
+FS_HEADER_SIZE = struct.calcsize(FS_HEADER_FORMAT)
+FS_CONTENT_TYPE = 0x63464531  # 'cFE1'
+FS_SUBTYPE_ES_PERFDATA = 4
+
+META_FIXED_SIZE = 4 + 10 * 4
+ENTRY_SIZE = 12
+EXIT_BIT = 31
+MARKER_MASK = (1 << EXIT_BIT) - 1
+
+PERF_ID_PATTERN = re.compile(r"^\s*#\s*define\s+(\w+)_PERF_ID\s+\(?\s*(\w+)\s*\)?")
+
+
+def load_marker_names(paths):
+    """Build a marker id to name map from "#define XXX_PERF_ID n" lines."""
+    names = {}
+    for path in paths:
+        with open(path, "r", errors="replace") as fp:
+            for line in fp:
+                match = PERF_ID_PATTERN.match(line)
+                if match:
+                    try:
+                        names[int(match.group(2), 0)] = match.group(1)
+                    except ValueError:
+                        pass
+    return names
+
+
+def read_perf_file(path):
+    """Return (ticks_per_sec, rollover, entries) from one perf log file."""
+    with open(path, "rb") as fp:
+        data = fp.read()
+
+    if len(data) < FS_HEADER_SIZE + META_FIXED_SIZE:
+        raise ValueError("%s: file too short" % path)
+
+    hdr = struct.unpack_from(FS_HEADER_FORMAT, data, 0)
+    if hdr[0] != FS_CONTENT_TYPE or hdr[1] != FS_SUBTYPE_ES_PERFDATA:
+        raise ValueError("%s: not a cFE performance data file" % path)
+
+    pos = FS_HEADER_SIZE
+    endian = ">" if data[pos + 1] == 1 else "<"
+    (ticks_per_sec, rollover, _state, _mode, _trig_count, _start, _end, count, _invalid,
+     mask_words) = struct.unpack_from(endian + "10I", data, pos + 4)
+    pos += META_FIXED_SIZE + 2 * 4 * mask_words
+
+    # A stream file that was not closed cleanly still has a zero count in
+    # its header, so take whatever complete entries are present
+    avail = (len(data) - pos) // ENTRY_SIZE
+    if count == 0 or count > avail:
+        count = avail
+
+    entries = [struct.unpack_from(endian + "3I", data, pos + i * ENTRY_SIZE) for i in range(count)]
+    return ticks_per_sec, rollover, entries
+
+
+def entry_time_us(upper, lower, ticks_per_sec, rollover):
+    """Convert a timebase value to microseconds."""
+    if rollover != 0:
+        ticks = upper * rollover + lower
+    else:
+        ticks = (upper << 32) | lower
+    return ticks * 1000000.0 / ticks_per_sec
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("files", nargs="+", help="performance log file(s)")
+    parser.add_argument("-o", "--output", default="-", help="output JSON file (default: stdout)")
+    parser.add_argument("-n", "--names", action="append", default=[],
+                        help="header defining *_PERF_ID markers, may be repeated")
+    args = parser.parse_args()
+
+    names = load_marker_names(args.names)
+    events = []
+    for path in args.files:
+        ticks_per_sec, rollover, entries = read_perf_file(path)
+        if ticks_per_sec == 0:
+            raise ValueError("%s: timer ticks per second is zero" % path)
+        for data, upper, lower in entries:
+            marker = data & MARKER_MASK
+            events.append({
+                "name": names.get(marker, "marker_%u" % marker),
+                "ph": "E" if data >> EXIT_BIT else "B",
+                "ts": entry_time_us(upper, lower, ticks_per_sec, rollover),
+                "pid": 1,
+                "tid": marker,
+            })
+
+    # Stable sort keeps file order for entries with identical time stamps
+    events.sort(key=lambda ev: ev["ts"])
+    if events:
+        base = events[0]["ts"]
+        for ev in events:
+            ev["ts"] = round(ev["ts"] - base, 3)
+
+    for marker in sorted({ev["tid"] for ev in events}):
+        events.append({"name": "thread_name", "ph": "M", "pid": 1, "tid": marker,
+                       "args": {"name": names.get(marker, "marker_%u" % marker)}})
+
+    out = sys.stdout if args.output == "-" else open(args.output, "w")
+    json.dump({"traceEvents": events, "displayTimeUnit": "ns"}, out)
+    if out is not sys.stdout:
+        out.close()
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())